@@ -946,6 +946,20 @@ public:
 		@return		AJA_STATUS_SUCCESS if successful.
 	**/
 	virtual AJAStatus						InitWithReceivedData (const ULWordSequence & inData, uint16_t & inOutStartIndex, const bool inIgnoreChecksum = false);
+
+	/**
+		@brief		Initializes me from the given 32-bit IP packet words, reading them in place (e.g. straight out of a
+					received datagram or device anc buffer), without copying them into an intermediate container.
+		@param[in]	pInU32s				Specifies the starting address of the packet words (in network byte order).
+		@param[in]	inNumU32s			Specifies the number of valid 32-bit words at pInU32s.
+		@param		inOutU32Ndx			On entry, specifies the zero-based index of the first 32-bit word associated with
+										this Ancillary data packet (i.e. its anc packet header).
+										On exit, if successful, receives the zero-based index of the first 32-bit word
+										associated with the NEXT packet that may follow it.
+		@param[in]	inIgnoreChecksum	If true, ignores checksum failures. Defaults to false (don't ignore).
+		@return		AJA_STATUS_SUCCESS if successful.
+	**/
+	virtual AJAStatus						InitWithReceivedData (const uint32_t * pInU32s, const size_t inNumU32s, size_t & inOutU32Ndx, const bool inIgnoreChecksum = false);
 	///@}
 
 
@@ -985,6 +999,25 @@ public:
 		@return		AJA_STATUS_SUCCESS if successful.
 	**/
 	virtual AJAStatus						GenerateTransmitData (ULWordSequence & outData);
+
+	/**
+		@return		The number of 32-bit IP packet words that GenerateTransmitData(ULWordSequence&) would append for me,
+					including the anc packet header word, or zero if I'm not a digital packet or my data count exceeds 255.
+		@note		This doesn't call GeneratePayloadData, so call that first if my payload needs to be regenerated.
+	**/
+	virtual uint32_t						GetRTPPacketWordCount (void) const;
+
+	/**
+		@brief		Writes the same 32-bit IP packet words as GenerateTransmitData(ULWordSequence&), but directly into the
+					given memory, without building any intermediate containers or allocating any memory.
+		@param		pOutU32s		Specifies the address where my packet words will be written, in network byte order.
+		@param[in]	inMaxU32s		Specifies the maximum number of 32-bit words that can be written at pOutU32s.
+		@param[out]	outU32Count		Receives the number of 32-bit words written (see GetRTPPacketWordCount).
+		@return		AJA_STATUS_SUCCESS if successful (analog/raw packets write nothing);  AJA_STATUS_RANGE if my data count
+					exceeds 255;  or AJA_STATUS_BADBUFFERSIZE if the memory is too small.
+		@note		Unlike GenerateTransmitData, this doesn't call GeneratePayloadData.
+	**/
+	virtual AJAStatus						WriteRTPPacketWords (uint32_t * pOutU32s, const size_t inMaxU32s, uint32_t & outU32Count) const;
 	///@}
 
 
@@ -1057,6 +1090,24 @@ public:
 	**/
 	static uint16_t							AddEvenParity (const uint8_t inDataByte);
 
+	/**
+		@brief		Adds even parity to each of the given data bytes (using SSE2 when available).
+		@param[in]	pInDataBytes	Specifies the data bytes. Must be non-NULL.
+		@param[out]	pOutWords		Receives the data words (data byte in bits 7:0, even parity in bit 8 and ~bit 8 in bit 9).
+									Must be non-NULL, with room for at least inCount words.
+		@param[in]	inCount			Specifies the number of data bytes to convert.
+		@return		The sum of bits 8:0 of all of the output words, modulo 512 (i.e. their contribution to a 9-bit checksum).
+	**/
+	static uint16_t							AddEvenParity (const uint8_t * pInDataBytes, uint16_t * pOutWords, const size_t inCount);
+
+	/**
+		@brief		Enables or disables the SSE2 VANC line kernels used by GetAncPacketsFromVANCLine, the VANC line unpackers,
+					and the transmit data generators. The scalar and SSE2 kernels produce identical results.
+		@param[in]	inUseSIMD		Specify false to use the scalar kernels (e.g. for testing or benchmarking). The default is true.
+	**/
+	static void								SetUseSIMD (const bool inUseSIMD);
+	static bool								IsUsingSIMD (void);		///< @return	True if the SSE2 VANC line kernels are available and enabled.
+
 
 	typedef UWordSequence			U16Packet;	///< @brief	An ordered sequence of 10-bit packet words stored in uint16_t values.
 	typedef std::vector<U16Packet>	U16Packets;	///< @brief	An ordered sequence of zero or more U16Packet values. 
@@ -1127,6 +1178,22 @@ public:
 																			UWordSequence & outU16YUVLine,
 																			const uint32_t inNumPixels);
 
+	/**
+		@brief		Converts a single line of ::NTV2_FBF_10BIT_YCBCR data from the given source buffer into an ordered
+					sequence of uint16_t values, three per 32-bit word, ready for GetAncPacketsFromVANCLine.
+		@param[in]	pInYUV10Line		A valid, non-NULL pointer to the start of the VANC line in an ::NTV2_FBF_10BIT_YCBCR
+										video buffer.
+		@param[out]	outU16YUVLine		Receives the 10-bit-per-component values. Its capacity is reused, so passing the same
+										sequence for every line of a frame avoids reallocating it.
+		@param[in]	inNumU32s			Specifies the length of the line to be converted, in 32-bit words (typically the
+										format descriptor's line pitch).
+		@return		True if successful;  otherwise false.
+		@note		The result is identical to ::UnpackLine_10BitYUVtoUWordSequence's.
+	**/
+	static bool								Unpack10BitYCbCrToU16sVANCLine (const void * pInYUV10Line,
+																			UWordSequence & outU16YUVLine,
+																			const uint32_t inNumU32s);
+
 	static void								GetInstanceCounts (uint32_t & outConstructed, uint32_t & outDestructed);
 	static uint32_t							GetNumActiveInstances (void);
 	static uint32_t							GetNumConstructed (void);
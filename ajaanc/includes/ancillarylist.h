@@ -483,6 +483,31 @@ public:	//	INSTANCE METHODS
 	virtual AJAStatus						GetIPTransmitDataLength (uint32_t & outF1ByteCount, uint32_t & outF2ByteCount,
 																	const bool inIsProgressive = true, const uint32_t inF2StartLine = 0);
 
+	/**
+		@brief		Encodes my AJAAncillaryData packets in \ref ancrtpformat directly into the given buffers, which may wrap
+					caller-provided memory (see NTV2Buffer::NTV2Buffer(const void*,const size_t)). Produces exactly the same
+					bytes as GetIPTransmitData, but without building intermediate containers or allocating any memory, so the
+					cost is bounded by the number and size of my packets.
+		@param		F1Buffer			Specifies the buffer memory into which Field 1's IP/RTP data will be written.
+										If it's empty/NULL, nothing is written, but outF1ByteCount still receives the byte count.
+		@param		F2Buffer			Specifies the buffer memory into which Field 2's IP/RTP data will be written.
+										If it's empty/NULL, nothing is written, but outF2ByteCount still receives the byte count.
+		@param[out]	outF1ByteCount		Receives the number of bytes written (or that would be written) into F1Buffer.
+		@param[out]	outF2ByteCount		Receives the number of bytes written (or that would be written) into F2Buffer.
+		@param[in]	inIsProgressive		Specify true to designate the output ancillary data stream as progressive; 
+										otherwise, specify false. Defaults to true (is progressive).
+		@param[in]	inF2StartLine		For interlaced/psf frames, specifies the line number where Field 2 begins;  otherwise ignored.
+										Defaults to zero (progressive).
+		@note		Unlike GetIPTransmitData, my packets are encoded in their current order (call SortListByLocation first
+					to get identical results), and the buffers aren't cleared. Only the bytes reported are written, plus up
+					to four zero words past the end, so that stale data can't be mistaken for another RTP packet.
+		@note		AJAAncillaryData::GeneratePayloadData is called on each of my digital packets.
+		@return		AJA_STATUS_SUCCESS if successful;  AJA_STATUS_FAIL if a non-NULL buffer is too small.
+	**/
+	virtual AJAStatus						WriteIPTransmitData (NTV2Buffer & F1Buffer, NTV2Buffer & F2Buffer,
+																uint32_t & outF1ByteCount, uint32_t & outF2ByteCount,
+																const bool inIsProgressive = true, const uint32_t inF2StartLine = 0);
+
 	/**
 		@brief		Answers true if multiple RTP packets will be transmitted/encoded.
 					The default behavior is to transmit/encode a single RTP packet.
@@ -542,6 +567,20 @@ public:	//	INSTANCE METHODS
 	**/
 	virtual AJAStatus			AddReceivedAncillaryData (const ULWordSequence & inReceivedData);
 
+	/**
+		@brief		Parses one or more RTP packets in \ref ancrtpformat straight out of the given memory (e.g. a received
+					datagram or device anc buffer) into separate AJAAncillaryData objects and appends them to me.
+		@param[in]	inReceivedData		Specifies the memory containing the RTP packet(s), each starting with its RTP header,
+										in network byte order. Use NTV2Buffer::NTV2Buffer(const void*,const size_t) to wrap
+										existing memory without copying it.
+		@details	Anc packets are decoded in place, without copying the RTP packets into ULWordSequence vectors, so the
+					only allocations are for the new AJAAncillaryData objects themselves. Like AddFromDeviceAncBuffer, if
+					AllowMultiRTPReceive is true, subsequent RTP packets are looked for (up to four 32-bit words past the end
+					of each one).
+		@return		AJA_STATUS_SUCCESS if successful, including if no RTP packets are found.
+	**/
+	virtual AJAStatus			AddReceivedRTPData (const NTV2Buffer & inReceivedData);
+
 
 	/**
 		@brief		Adds the packet that originated in the VANC lines of an NTV2 frame buffer to my list.
@@ -700,6 +739,14 @@ protected:
 															const bool inIsF2,
 															const bool inIsProgressive);
 
+	/**
+		@brief		Parses a single RTP packet, including its RTP header, straight out of the given memory.
+		@param[in]	pInU32s		Specifies the address of the RTP packet's words, in network byte order.
+		@param[in]	inNumU32s	Specifies the number of valid 32-bit words at pInU32s.
+		@return		AJA_STATUS_SUCCESS if successful.
+	**/
+	virtual AJAStatus						AddReceivedRTPPacket (const uint32_t * pInU32s, const size_t inNumU32s);
+
 private:
 	AJAAncillaryDataList	m_ancList;		///< @brief	My packet list
 	bool					m_rcvMultiRTP;	///< @brief	True: Rcv 1 RTP pkt per Anc pkt;  False: Rcv 1 RTP pkt for all Anc pkts
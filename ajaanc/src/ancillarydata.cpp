@@ -15,6 +15,10 @@
 	#include <stdlib.h>				// For realloc
 #endif
 #include <ios>
+#if defined(__SSE2__)
+	#include <emmintrin.h>
+	#define	NTV2_ANC_SSE2	1
+#endif	//	__SSE2__
 
 using namespace std;
 
@@ -86,6 +90,8 @@ const uint32_t AJAAuxillaryPacketSize		= 32;	//	HDMI Aux packets are always 32 b
 	static uint32_t gDestructCount(0);	//	Number of destructor calls made
 #endif	//	defined(_DEBUG)
 
+static bool		gUseSIMD	(true);		//	Use SSE2 VANC line kernels (when available)?
+
 
 
 
@@ -459,23 +465,23 @@ AJAStatus AJAAncillaryData::GetPayloadData (uint8_t * pOutData, const uint32_t i
 
 AJAStatus AJAAncillaryData::GetPayloadData (UWordSequence & outUDWs, const bool inAddParity) const
 {
-	AJAStatus	status	(AJA_STATUS_SUCCESS);
 	const UWordSequence::size_type	origSize	(outUDWs.size());
-	for (ByteVectorConstIter iter(m_payload.begin());  iter != m_payload.end()	&&	AJA_SUCCESS(status);  ++iter)
+	try
 	{
-		const uint16_t	UDW (inAddParity ? AddEvenParity(*iter) : *iter);
-		try
-		{
-			outUDWs.push_back(UDW); //	Copy 8-bit data into LS 8 bits, add even parity to bit 8, and ~bit 8 to bit 9
-		}
-		catch(...)
-		{
-			status = AJA_STATUS_MEMORY;
-		}
-	}	//	for each packet byte
-	if (AJA_FAILURE(status))
-		outUDWs.resize(origSize);
-	return status;
+		outUDWs.resize(origSize + m_payload.size());
+	}
+	catch(...)
+	{
+		return AJA_STATUS_MEMORY;
+	}
+	if (m_payload.empty())
+		return AJA_STATUS_SUCCESS;
+	if (inAddParity)
+		AddEvenParity(&m_payload[0], &outUDWs[origSize], m_payload.size());	//	Copy 8-bit data into LS 8 bits, add even parity to bit 8, and ~bit 8 to bit 9
+	else
+		for (ByteVector::size_type ndx(0);  ndx < m_payload.size();  ndx++)
+			outUDWs[origSize + ndx] = m_payload[ndx];
+	return AJA_STATUS_SUCCESS;
 }
 
 
@@ -884,32 +890,37 @@ AJAStatus AJAAncillaryData::GenerateTransmitData (UWordSequence & outRawComponen
 	AJAStatus						status		(GeneratePayloadData());
 	const UWordSequence::size_type	origSize	(outRawComponents.size());
 
-	if (IsDigital())
+	if (AJA_SUCCESS(status) && IsDigital())
 	{
+		const uint8_t	dataCount	((GetDC() > 255) ? 255 : uint8_t(GetDC())); //	Truncate payload to max 255 bytes
+		const size_t	numUDWs		(m_payload.size());
 		try
 		{
-			const uint8_t	dataCount	((GetDC() > 255) ? 255 : uint8_t(GetDC())); //	Truncate payload to max 255 bytes
-			outRawComponents.push_back(0x000);											//	000
-			outRawComponents.push_back(0x3FF);											//	3FF
-			outRawComponents.push_back(0x3FF);											//	3FF
-			outRawComponents.push_back(AddEvenParity(GetDID()));		//	DID
-			outRawComponents.push_back(AddEvenParity(GetSID()));		//	SDID
-			outRawComponents.push_back(AddEvenParity(dataCount));	//	DC
+			outRawComponents.resize(origSize + 6 + numUDWs + 1);
 		}
 		catch(...)
 		{
 			outRawComponents.resize(origSize);
 			status = AJA_STATUS_MEMORY;
 		}
+		if (AJA_SUCCESS(status))
+		{	//	Header, UDWs and checksum are generated in one pass, without growing the vector word by word...
+			UWord *	pWords	(&outRawComponents[origSize]);
+			pWords[0] = 0x000;							//	000
+			pWords[1] = 0x3FF;							//	3FF
+			pWords[2] = 0x3FF;							//	3FF
+			pWords[3] = AddEvenParity(GetDID());		//	DID
+			pWords[4] = AddEvenParity(GetSID());		//	SDID
+			pWords[5] = AddEvenParity(dataCount);		//	DC
+			//	The hardware automatically recalcs the CS, but still needs to be there (same math as Calculate9BitChecksum)...
+			UWord	sum	(UWord(pWords[3] + pWords[4] + AddEvenParity(UByte(GetDC()))));
+			if (numUDWs)
+				sum += AddEvenParity(&m_payload[0], pWords + 6, numUDWs);		//	UDWs
+			pWords[6 + numUDWs] = UWord((sum & 0x1FF) | ((~sum & 0x100) << 1));	//	CS
+		}
 	}
-
-	//	Copy payload data into output vector...
-	if (AJA_SUCCESS(status))
-		status = GetPayloadData(outRawComponents, IsDigital() /* Add parity for Digital only */);	//	UDWs
-
-	//	The hardware automatically recalcs the CS, but still needs to be there...
-	if (AJA_SUCCESS(status) && IsDigital())
-		outRawComponents.push_back(Calculate9BitChecksum());	//	CS
+	else if (AJA_SUCCESS(status))
+		status = GetPayloadData(outRawComponents, false);	//	Raw/analog data is copied as-is
 
 	if (AJA_SUCCESS(status))
 		{LOGMYDEBUG((origSize ? "Appended " : "Generated ")	<< (outRawComponents.size() - origSize)	 << " UWords from " << AsString(32) << endl << UWordSequence(outRawComponents));}
@@ -1044,24 +1055,102 @@ AJAStatus AJAAncillaryData::GenerateTransmitData (ULWordSequence & outData)
 }	//	GenerateTransmitData
 
 
+uint32_t AJAAncillaryData::GetRTPPacketWordCount (void) const
+{
+	if (!IsDigital()  ||  GetDC() > 255)
+		return 0;
+	return 1  +  ((GetDC() + 4) * 10 + 31) / 32;	//	Anc pkt header, plus 10-bit DID + SID + DC + UDWs + CS rounded up to a whole U32
+}
+
+
+//	Appends the given 10-bit word to the bit accumulator, writing out the MS 32 bits (in network byte order) whenever they're complete...
+static inline void Pack10BitWord (uint64_t & inOutBits, unsigned & inOutNumBits, uint32_t *& inOutPtr, const uint16_t inWord)
+{
+	inOutBits = (inOutBits << 10) | (inWord & 0x03FF);
+	inOutNumBits += 10;
+	if (inOutNumBits >= 32)
+	{
+		inOutNumBits -= 32;
+		*inOutPtr++ = ENDIAN_32HtoN(uint32_t(inOutBits >> inOutNumBits));
+	}
+}
+
+AJAStatus AJAAncillaryData::WriteRTPPacketWords (uint32_t * pOutU32s, const size_t inMaxU32s, uint32_t & outU32Count) const
+{
+	outU32Count = 0;
+	if (!IsDigital())
+		{XMT2110WARN("Analog/raw packet skipped/ignored: " << AsString(32));	return AJA_STATUS_SUCCESS;}
+	if (GetDC() > 255)
+		{XMT2110ERR("Data count exceeds 255: " << AsString(32));	return AJA_STATUS_RANGE;}
+	const uint32_t	numU32s	(GetRTPPacketWordCount());
+	if (!pOutU32s  ||  numU32s > inMaxU32s)
+		{XMT2110ERR(DEC(numU32s) << " U32s won't fit in " << DEC(inMaxU32s) << "-U32 buffer: " << AsString(32));	return AJA_STATUS_BADBUFFERSIZE;}
+
+	//	My first 32-bit longword is the Anc packet header, which contains location info...
+	uint32_t *	pU32	(pOutU32s);
+	*pU32++ = AJARTPAncPacketHeader(GetDataLocation()).GetULWord();
+
+	//	All subsequent 32-bit longwords hold my 10-bit even-parity DID/SID/DC/UDWs/CS, packed MS bit first...
+	uint64_t			bits	(0);
+	unsigned			numBits	(0);
+	const uint8_t *		pUDWs	(GetPayloadData());
+	const uint32_t		dc		(GetDC());
+	Pack10BitWord (bits, numBits, pU32, AddEvenParity(GetDID()));
+	Pack10BitWord (bits, numBits, pU32, AddEvenParity(GetSID()));
+	Pack10BitWord (bits, numBits, pU32, AddEvenParity(uint8_t(dc)));
+	for (uint32_t ndx(0);  ndx < dc;  ndx++)
+		Pack10BitWord (bits, numBits, pU32, AddEvenParity(pUDWs[ndx]));
+	Pack10BitWord (bits, numBits, pU32, Calculate9BitChecksum());	//	Checksum is the caboose
+	if (numBits)	//	Zero-pad the last longword
+		*pU32++ = ENDIAN_32HtoN(uint32_t(bits << (32 - numBits)));
+
+	outU32Count = uint32_t(pU32 - pOutU32s);
+	NTV2_ASSERT(outU32Count == numU32s);
+	XMT2110DBG("Wrote " << DEC(outU32Count) << " 32-bit words from " << AsString(32));
+	return AJA_STATUS_SUCCESS;
+}	//	WriteRTPPacketWords
+
+
 AJAStatus AJAAncillaryData::InitWithReceivedData (const ULWordSequence & inU32s, uint16_t & inOutU32Ndx, const bool inIgnoreChecksum)
 {
-	const size_t	numU32s (inU32s.size());
+	size_t			u32Ndx	(inOutU32Ndx);
+	const AJAStatus	result	(InitWithReceivedData (inU32s.empty() ? AJA_NULL : &inU32s[0], inU32s.size(), u32Ndx, inIgnoreChecksum));
+	inOutU32Ndx = uint16_t(u32Ndx);
+	return result;
+}	//	InitWithReceivedData (const ULWordSequence&,uint16_t&)
+
+
+//	Answers with the 10-bit word at the given index in a run of big-endian 32-bit words into which 10-bit words
+//	are packed MS bit first (see GenerateTransmitData). Words past the end of the run read as zero.
+static inline uint16_t Unpack10BitWord (const uint32_t * pInU32s, const size_t inNumU32s, const size_t inNdx)
+{
+	const size_t	bitOffset	(inNdx * 10);
+	const size_t	u32Ndx		(bitOffset / 32);
+	uint64_t		u64			(0);
+	if (u32Ndx < inNumU32s)
+		u64 = uint64_t(ENDIAN_32NtoH(pInU32s[u32Ndx])) << 32;
+	if (u32Ndx + 1 < inNumU32s)
+		u64 |= ENDIAN_32NtoH(pInU32s[u32Ndx + 1]);
+	return uint16_t((u64 >> (54 - bitOffset % 32)) & 0x03FF);
+}
 
+AJAStatus AJAAncillaryData::InitWithReceivedData (const uint32_t * pInU32s, const size_t inNumU32s, size_t & inOutU32Ndx, const bool inIgnoreChecksum)
+{
 	Clear();	//	Reset me -- start over
 
-	if (inOutU32Ndx >= numU32s)
-		{RCV2110ERR("Index error: [" << DEC(inOutU32Ndx) << "] past end of [" << DEC(numU32s) << "] element buffer");  return AJA_STATUS_RANGE;}
+	if (!pInU32s  ||  inOutU32Ndx >= inNumU32s)
+		{RCV2110ERR("Index error: [" << DEC(inOutU32Ndx) << "] past end of [" << DEC(inNumU32s) << "] element buffer");  return AJA_STATUS_RANGE;}
 
 	AJARTPAncPacketHeader	ancPktHeader;
-	if (!ancPktHeader.ReadFromULWordVector(inU32s, inOutU32Ndx))
-		{RCV2110ERR("AJARTPAncPacketHeader::ReadFromULWordVector failed at [" << DEC(inOutU32Ndx) << "]");	return AJA_STATUS_FAIL;}
-
+	ancPktHeader.SetFromULWord(pInU32s[inOutU32Ndx]);
 	const AJAAncDataLoc	dataLoc (ancPktHeader.AsDataLocation());
-	RCV2110DDBG("u32=" << xHEX0N(ENDIAN_32NtoH(inU32s.at(inOutU32Ndx)),8) << " inU32s[" << DEC(inOutU32Ndx) << " of " << DEC(numU32s) << "] AncPktHdr: " << ancPktHeader << " -- AncDataLoc: " << dataLoc);
+	RCV2110DDBG("u32=" << xHEX0N(ENDIAN_32NtoH(pInU32s[inOutU32Ndx]),8) << " inU32s[" << DEC(inOutU32Ndx) << " of " << DEC(inNumU32s) << "] AncPktHdr: " << ancPktHeader << " -- AncDataLoc: " << dataLoc);
 
-	if (++inOutU32Ndx >= numU32s)
-		{RCV2110ERR("Index error: [" << DEC(inOutU32Ndx) << "] past end of [" << DEC(numU32s) << "] element buffer");  return AJA_STATUS_RANGE;}
+	//	The 10-bit DID/SID/DC/UDWs/CS words start in the next 32-bit word...
+	const uint32_t *	pU32s	(pInU32s + inOutU32Ndx + 1);
+	const size_t		maxU32s	(inNumU32s - inOutU32Ndx - 1);
+	if (!maxU32s)
+		{RCV2110ERR("Index error: [" << DEC(inOutU32Ndx+1) << "] past end of [" << DEC(inNumU32s) << "] element buffer");  return AJA_STATUS_RANGE;}
 
 	//	Set location info...
 	AJAStatus result;
@@ -1080,151 +1169,38 @@ AJAStatus AJAAncillaryData::InitWithReceivedData (const ULWordSequence & inU32s,
 	result = SetLocationLineNumber(dataLoc.GetLineNumber());
 	if (AJA_FAILURE(result))	{RCV2110ERR("SetLocationLineNumber failed, dataLoc: " << dataLoc);	return result;}
 
-	//	Unpack this anc packet...
-	UWordSequence	u16s;	//	10-bit even-parity words
-	bool			gotChecksum (false);
-	size_t			dataCount	(0);
-	uint32_t		u32			(ENDIAN_32NtoH(inU32s.at(inOutU32Ndx)));
-	const size_t	startU32Ndx (inOutU32Ndx);
-	RCV2110DDBG("u32=" << xHEX0N(u32,8) << " inU32s[" << DEC(inOutU32Ndx) << " of " << DEC(numU32s) << "]");
-	do
+	//	DID, SID & DC are always in the first 32-bit word. The DC determines how many more words the packet occupies...
+	SetDID(uint8_t(Unpack10BitWord(pU32s, maxU32s, 0)));
+	SetSID(uint8_t(Unpack10BitWord(pU32s, maxU32s, 1)));
+	const size_t	dataCount	(Unpack10BitWord(pU32s, maxU32s, 2) & 0x0FF);
+	const size_t	numU32s		(((dataCount + 4) * 10 + 31) / 32);		//	DID + SID + DC + UDWs + CS
+	if (numU32s > maxU32s)
 	{
-		uint16_t	u16 (0);
-		for (unsigned loopNdx(0);  loopNdx < 20	 &&	 !gotChecksum;	loopNdx++)
-		{
-			const bool		is4th	((loopNdx & 3) == 3);
-			const bool		is1st	((loopNdx & 3) == 0);
-			const unsigned	shift	(gShifts[loopNdx]);
-			const uint32_t	mask	(gMasks[loopNdx]);
-			if (is4th)
-			{
-				u16 = uint16_t((u32 & mask) << shift);
-
-				//	Grab next u32 value...
-				if (++inOutU32Ndx >= numU32s)
-				{
-					u16s.push_back(u16);	//	RCV2110DDBG("u16s[" << DEC(u16s.size()-1) << "]=" << xHEX0N(u16,3) << " (Past end)");
-					break;	//	Past end
-				}
-				u32 = ENDIAN_32NtoH(inU32s.at(inOutU32Ndx));
-				RCV2110DDBG("u32=" << xHEX0N(u32,8) << " inU32s[" << DEC(inOutU32Ndx) << " of " << DEC(numU32s) << "], u16=" << xHEX0N(u16,3)
-							<< " from " << DEC(loopNdx) << "(" << xHEX0N(inU32s.at(inOutU32Ndx-1),8) << " & " << xHEX0N(mask,8) << ") << " << DEC(shift));
-				if (shift)
-					continue;	//	go around
-			}
-			else if (is1st)
-			{
-//				RCV2110DDBG("u16s[" << DEC(u16s.size()) << "]=" << xHEX0N(u16,3) << " | " << xHEX0N(uint16_t((u32 & mask) >> shift),3)
-//							<< " = " << xHEX0N(u16 | uint16_t((u32 & mask) >> shift),3));
-				u16 |= uint16_t((u32 & mask) >> shift);
-			}
-			else
-			{
-				u16 = uint16_t((u32 & mask) >> shift);
-//				RCV2110DDBG("u16s[" << DEC(u16s.size()) << "]=" << xHEX0N(u16,3));
-			}
-			u16s.push_back(u16);	//	RCV2110DDBG("u16s[" << DEC(u16s.size()-1) << "]=" << xHEX0N(u16,3));
-			switch(u16s.size())
-			{
-				case 1:		SetDID(uint8_t(u16));				break;	//	Got DID
-				case 2:		SetSID(uint8_t(u16));				break;	//	Got SID
-				case 3:		dataCount = size_t(u16 & 0x0FF);	break;	//	Got DC
-				default:	if (u16s.size() == (dataCount + 4))
-								{gotChecksum = true; RCV2110DDBG("Got checksum, DC=" << xHEX0N(dataCount,2) << " CS=" << xHEX0N(u16s.back(),3));}	//	Got CS
-							break;
-			}
-		}	//	loop 20 times (or until gotChecksum)
-		if (gotChecksum)
-				break;
-	} while (inOutU32Ndx < numU32s);
-
-	if (u16s.size() < 4)
-	{	ostringstream oss;
-		if (u16s.size() < 1) oss << " NoDID";
-		else oss << " DID=" << xHEX0N(UWord(GetDID()),2);
-		if (u16s.size() < 2) oss << " NoSID";
-		else oss << " SID=" << xHEX0N(UWord(GetSID()),2);
-		if (u16s.size() < 3) oss << " NoDC";
-		else oss << " DC=" << DEC(dataCount);
-		RCV2110ERR("Incomplete/bad packet:" << oss.str() << " NoCS" << " -- only unpacked " << u16s);
-		return AJA_STATUS_FAIL;
-	}
-	RCV2110DBG("Consumed " << DEC(inOutU32Ndx - startU32Ndx + 1) << " ULWord(s), " << (gotChecksum?"":"NoCS, ") << "DC=" << DEC(dataCount) << ", unpacked " << u16s);
-	if (inOutU32Ndx < numU32s)
-		inOutU32Ndx++;	//	Bump to next Anc packet, if any
-
-	//	Did we get the whole packet?
-	if (dataCount > (u16s.size()-3))		//	DC > (u16s.size minus DID, SID, DC)?
-	{	//	Uh-oh:	too few u16s -- someone's pulling our leg
-		RCV2110ERR("Incomplete/bad packet: " << DEC(u16s.size()) << " U16s, but missing " << DEC(dataCount - (u16s.size()-3))
-					<< " byte(s), expected DC=" << DEC(dataCount) << " -- DID=" << xHEX0N(UWord(GetDID()),2) << " SID=" << xHEX0N(UWord(GetSID()),2));
+		RCV2110ERR("Incomplete/bad packet: DID=" << xHEX0N(UWord(GetDID()),2) << " SID=" << xHEX0N(UWord(GetSID()),2) << " DC=" << DEC(dataCount)
+					<< " needs " << DEC(numU32s) << " U32s, but only " << DEC(maxU32s) << " remain");
 		return AJA_STATUS_FAIL;
 	}
 
 	//	Copy in the Anc packet data, while stripping off parity...
+	m_payload.resize(dataCount);
 	for (size_t ndx(0);	 ndx < dataCount;  ndx++)
-		m_payload.push_back(uint8_t(u16s.at(ndx+3)));
+		m_payload[ndx] = uint8_t(Unpack10BitWord(pU32s, numU32s, ndx + 3));
+	const uint16_t	cs	(Unpack10BitWord(pU32s, numU32s, dataCount + 3));
+	inOutU32Ndx += 1 + numU32s;		//	Bump to next Anc packet, if any
+	RCV2110DBG("Consumed " << DEC(1 + numU32s) << " ULWord(s), DC=" << DEC(dataCount) << ", CS=" << xHEX0N(cs,3));
 
-	result = SetChecksum(uint8_t(u16s.at(u16s.size()-1)), true /*validate*/);
+	result = SetChecksum(uint8_t(cs), true /*validate*/);
 	if (AJA_FAILURE(result))
 	{
 		if (inIgnoreChecksum)
-			{RCV2110WARN("SetChecksum=" << xHEX0N(u16s.at(u16s.size()-1),3) << " failed, calculated=" << xHEX0N(Calculate9BitChecksum(),3));  result = AJA_STATUS_SUCCESS;}
+			{RCV2110WARN("SetChecksum=" << xHEX0N(cs,3) << " failed, calculated=" << xHEX0N(Calculate9BitChecksum(),3));  result = AJA_STATUS_SUCCESS;}
 		else
-			{RCV2110ERR("SetChecksum=" << xHEX0N(u16s.at(u16s.size()-1),3) << " failed, calculated=" << xHEX0N(Calculate9BitChecksum(),3));	 return result;}
+			{RCV2110ERR("SetChecksum=" << xHEX0N(cs,3) << " failed, calculated=" << xHEX0N(Calculate9BitChecksum(),3));	 return result;}
 	}
 	SetBufferFormat(AJAAncBufferFormat_RTP);
 	RCV2110DBG(AsString(64));
-
-	/*	The Pattern:  (unrolling the above loop):
-		u32 = ENDIAN_32NtoH(inU32s.at(0));
-		u16	 = uint16_t((u32 & 0xFFC00000) >> 22);		//	all 10 bits				0
-		u16s.push_back(u16);
-		u16	 = uint16_t((u32 & 0x003FF000) >> 12);		//	all 10 bits				1
-		u16s.push_back(u16);
-		u16	 = uint16_t((u32 & 0x00000FFC) >>  2);		//	all 10 bits				2
-		u16s.push_back(u16);
-		u16	 = uint16_t((u32 & 0x00000003) <<  8);		//	first (MS 2 bits)		3
-
-		u32 = ENDIAN_32NtoH(inU32s.at(1));
-		u16 |= uint16_t((u32 & 0xFF000000) >> 24);		//	last (LS 8 bits)		4
-		u16s.push_back(u16);
-		u16	 = uint16_t((u32 & 0x00FFC000) >> 14);		//	all 10 bits				5
-		u16s.push_back(u16);
-		u16	 = uint16_t((u32 & 0x00003FF0) >>  4);		//	all 10 bits				6
-		u16s.push_back(u16);
-		u16	 = uint16_t((u32 & 0x0000000F) <<  6);		//	first (MS 4 bits)		7
-
-		u32 = ENDIAN_32NtoH(inU32s.at(2));
-		u16 |= uint16_t((u32 & 0xFC000000) >> 26);		//	last (LS 6 bits)		8
-		u16s.push_back(u16);
-		u16	 = uint16_t((u32 & 0x03FF0000) >> 16);		//	all 10 bits				9
-		u16s.push_back(u16);
-		u16	 = uint16_t((u32 & 0x0000FFC0) >>  6);		//	all 10 bits				10
-		u16s.push_back(u16);
-		u16	 = uint16_t((u32 & 0x0000003F) <<  4);		//	first (MS 6 bits)		11
-
-		u32 = ENDIAN_32NtoH(inU32s.at(3));
-		u16 |= uint16_t((u32 & 0xF0000000) >> 28);		//	last (LS 4 bits)		12
-		u16s.push_back(u16);
-		u16	 = uint16_t((u32 & 0x0FFC0000) >> 18);		//	all 10 bits				13
-		u16s.push_back(u16);
-		u16	 = uint16_t((u32 & 0x0003FF00) >>  8);		//	all 10 bits				14
-		u16s.push_back(u16);
-		u16	 = uint16_t((u32 & 0x000000FF) <<  2);		//	first (MS 8 bits)		15
-
-		u32 = ENDIAN_32NtoH(inU32s.at(4));
-		u16 |= uint16_t((u32 & 0xC0000000) >> 30);		//	last (LS 2 bits)		16
-		u16s.push_back(u16);
-		u16	 = uint16_t((u32 & 0x3FF00000) >> 20);		//	all 10 bits				17
-		u16s.push_back(u16);
-		u16	 = uint16_t((u32 & 0x000FFC00) >> 10);		//	all 10 bits				18
-		u16s.push_back(u16);
-		u16	 = uint16_t((u32 & 0x000003FF) >>  0);		//	all 10 bits				19
-		u16s.push_back(u16);
-*/
 	return result;
-}	//	InitWithReceivedData (const ULWordSequence&,uint16_t&)
+}	//	InitWithReceivedData (const uint32_t*,size_t,size_t&)
 
 
 static const string		gEmptyString;
@@ -1645,6 +1621,88 @@ uint16_t AJAAncillaryData::AddEvenParity (const uint8_t inDataByte)
 }
 
 
+void AJAAncillaryData::SetUseSIMD (const bool inUseSIMD)
+{
+	gUseSIMD = inUseSIMD;
+}
+
+
+bool AJAAncillaryData::IsUsingSIMD (void)
+{
+#if defined(NTV2_ANC_SSE2)
+	return gUseSIMD;
+#else
+	return false;
+#endif	//	NTV2_ANC_SSE2
+}
+
+
+#if defined(NTV2_ANC_SSE2)
+	//	Returns the given data bytes (one per 16-bit lane) with even parity in bit 8 and ~bit 8 in bit 9...
+	static inline __m128i AddEvenParity8 (const __m128i inBytes)
+	{
+		const __m128i	one	(_mm_set1_epi16(1));
+		__m128i			odd	(_mm_xor_si128(inBytes, _mm_srli_epi16(inBytes, 4)));
+		odd = _mm_xor_si128(odd, _mm_srli_epi16(odd, 2));
+		odd = _mm_and_si128(_mm_xor_si128(odd, _mm_srli_epi16(odd, 1)), one);	//	1 if odd number of 1 bits
+		return _mm_or_si128(inBytes, _mm_or_si128(_mm_slli_epi16(odd, 8), _mm_slli_epi16(_mm_xor_si128(odd, one), 9)));
+	}
+
+	//	Loads 8 words, taking every word (inIncr == 1) or every other word (inIncr == 2)...
+	static inline __m128i LoadWords8 (const UWord * pInWords, const UWord inIncr)
+	{
+		if (inIncr == 1)
+			return _mm_loadu_si128(reinterpret_cast<const __m128i*>(pInWords));
+		const __m128i	evens	(_mm_set1_epi32(0x0000FFFF));
+		const __m128i	lo		(_mm_and_si128(_mm_loadu_si128(reinterpret_cast<const __m128i*>(pInWords)), evens));
+		const __m128i	hi		(_mm_and_si128(_mm_loadu_si128(reinterpret_cast<const __m128i*>(pInWords + 8)), evens));
+		return _mm_packs_epi32(lo, hi);	//	10-bit values never saturate
+	}
+
+	//	Returns the sum of the 8 words (modulo 2^16)...
+	static inline UWord SumWords8 (const __m128i inWords)
+	{
+		__m128i	sum	(_mm_add_epi16(inWords, _mm_srli_si128(inWords, 8)));
+		sum = _mm_add_epi16(sum, _mm_srli_si128(sum, 4));
+		sum = _mm_add_epi16(sum, _mm_srli_si128(sum, 2));
+		return UWord(_mm_cvtsi128_si32(sum));
+	}
+#endif	//	NTV2_ANC_SSE2
+
+
+uint16_t AJAAncillaryData::AddEvenParity (const uint8_t * pInDataBytes, uint16_t * pOutWords, const size_t inCount)
+{
+	uint16_t	sum	(0);
+	size_t		ndx	(0);
+	if (!pInDataBytes  ||  !pOutWords)
+		return 0;
+#if defined(NTV2_ANC_SSE2)
+	if (gUseSIMD)
+	{	//	16 bytes at a time...
+		const __m128i	zero	(_mm_setzero_si128());
+		const __m128i	mask9	(_mm_set1_epi16(0x1FF));
+		__m128i			sums	(zero);
+		for (;  ndx + 16 <= inCount;  ndx += 16)
+		{
+			const __m128i	bytes	(_mm_loadu_si128(reinterpret_cast<const __m128i*>(pInDataBytes + ndx)));
+			const __m128i	lo		(AddEvenParity8(_mm_unpacklo_epi8(bytes, zero)));
+			const __m128i	hi		(AddEvenParity8(_mm_unpackhi_epi8(bytes, zero)));
+			_mm_storeu_si128(reinterpret_cast<__m128i*>(pOutWords + ndx), lo);
+			_mm_storeu_si128(reinterpret_cast<__m128i*>(pOutWords + ndx + 8), hi);
+			sums = _mm_add_epi16(sums, _mm_add_epi16(_mm_and_si128(lo, mask9), _mm_and_si128(hi, mask9)));
+		}
+		sum = SumWords8(sums);
+	}
+#endif	//	NTV2_ANC_SSE2
+	for (;  ndx < inCount;  ndx++)
+	{
+		pOutWords[ndx] = AddEvenParity(pInDataBytes[ndx]);
+		sum += pOutWords[ndx] & 0x1FF;
+	}
+	return sum & 0x1FF;
+}
+
+
 string AncChannelSearchSelectToString (const AncChannelSearchSelect inSelect, const bool inCompact)
 {
 	switch (inSelect)
@@ -1668,6 +1726,36 @@ static bool CheckAncParityAndChecksum (const AJAAncillaryData::U16Packet &	inYUV
 	if (inIncrement == 0  ||  inIncrement > 2)
 		return true;	//	Increment must be 1 or 2
 
+#if defined(NTV2_ANC_SSE2)
+	if (gUseSIMD)
+	{	//	Check parity and sum 8 words at a time -- only fall through to the (logging) checks below if something's wrong...
+		const UWord *	pWords	(&inYUV16Line[inStartIndex + 3 * inIncrement]);
+		const UWord		numWords(inTotalCount - 4);	//	DID, SDID, DC and UDWs
+		const __m128i	mask8	(_mm_set1_epi16(0xFF));
+		const __m128i	mask9	(_mm_set1_epi16(0x1FF));
+		__m128i			errs	(_mm_setzero_si128());
+		__m128i			sums	(_mm_setzero_si128());
+		UWord			wordNum	(0);
+		for (;  wordNum + 8 <= numWords;  wordNum += 8)
+		{
+			const __m128i	words	(LoadWords8(pWords + wordNum * inIncrement, inIncrement));
+			errs = _mm_or_si128(errs, _mm_xor_si128(words, AddEvenParity8(_mm_and_si128(words, mask8))));
+			sums = _mm_add_epi16(sums, _mm_and_si128(words, mask9));
+		}
+		bool	ok	(_mm_movemask_epi8(_mm_cmpeq_epi16(errs, _mm_setzero_si128())) == 0xFFFF);
+		UWord	sum	(SumWords8(sums));
+		for (;  ok  &&  wordNum < numWords;  wordNum++)
+		{
+			const UWord	wordValue	(pWords[wordNum * inIncrement]);
+			ok = wordValue == AJAAncillaryData::AddEvenParity(wordValue & 0xFF);
+			sum += wordValue & 0x1FF;
+		}
+		const UWord checksum	(inYUV16Line [inStartIndex + (inTotalCount - 1) * inIncrement]);
+		if (ok  &&  ((checksum & BIT(8)) != 0) != ((checksum & BIT(9)) != 0)  &&  (sum & 0x1FF) == (checksum & 0x1FF))
+			return false;	//	No errors
+	}
+#endif	//	NTV2_ANC_SSE2
+
 	//	Check parity on all words...
 	for (ndx = 3;  ndx < inTotalCount - 1;	ndx++)	//	Skip ANC Data Flags and Checksum
 	{
@@ -1706,6 +1794,57 @@ static bool CheckAncParityAndChecksum (const AJAAncillaryData::U16Packet &	inYUV
 }	//	CheckAncParityAndChecksum
 
 
+//	Extracts the packet whose anc data flag is at the given word offset. Returns false if the line shouldn't be parsed any further...
+static bool ExtractAncPacket (const UWordSequence &				inYUV16Line,
+								const UWord						inWordNum,
+								const UWord						inSearchIncr,
+								const AncChannelSearchSelect	inChanSelect,
+								AJAAncillaryData::U16Packets &	outRawPackets,
+								UWordSequence &					outWordOffsets)
+{
+	const UWord wordCountMax	(UWord(inYUV16Line.size ()));
+	const UWord ancHdr3 (inYUV16Line[inWordNum + (3 * inSearchIncr)]);	//	DID
+	const UWord ancHdr4 (inYUV16Line[inWordNum + (4 * inSearchIncr)]);	//	SDID
+	const UWord ancHdr5 (inYUV16Line[inWordNum + (5 * inSearchIncr)]);	//	DC
+
+	//	Total words in ANC packet: 6 header words + data count + checksum word...
+	UWord	dataCount	(ancHdr5 & 0xFF);
+	UWord	totalCount	(6	+  dataCount  +	 1);
+
+	if (totalCount > wordCountMax)
+	{
+		totalCount = wordCountMax;
+		LOGMYERROR ("packet totalCount " << totalCount << " exceeds max " << wordCountMax);
+		return false;
+	}
+
+	//	Be sure we don't go past the end of the line buffer...
+	if (ULWord (inWordNum + totalCount) >= wordCountMax  ||  ULWord (inWordNum + (totalCount - 1) * inSearchIncr) >= wordCountMax)
+	{
+		LOGMYDEBUG ("past end of line: " << inWordNum << " + " << totalCount << " >= " << wordCountMax);
+		return false;	//	Past end of line buffer
+	}
+
+	if (CheckAncParityAndChecksum (inYUV16Line, inWordNum, totalCount, inSearchIncr))
+		return false;	//	Parity/Checksum error
+
+	outRawPackets.push_back (AJAAncillaryData::U16Packet());
+	AJAAncillaryData::U16Packet &	packet	(outRawPackets.back());
+	packet.resize (totalCount);
+	for (unsigned i = 0;  i < totalCount;  i++)
+		packet[i] = inYUV16Line[inWordNum + (i * inSearchIncr)];
+	outWordOffsets.push_back (inWordNum);
+
+	LOGMYINFO ("Found ANC packet in " << ::AncChannelSearchSelectToString(inChanSelect)
+					<< ": DID=" << xHEX0N(ancHdr3,4)
+					<< " SDID=" << xHEX0N(ancHdr4,4)
+					<< " word=" << inWordNum
+					<< " DC=" << ancHdr5
+					<< " pix=" << (inWordNum / inSearchIncr));
+	return true;
+}	//	ExtractAncPacket
+
+
 bool AJAAncillaryData::GetAncPacketsFromVANCLine (const UWordSequence &				inYUV16Line,
 													const AncChannelSearchSelect	inChanSelect,
 													U16Packets &					outRawPackets,
@@ -1727,57 +1866,72 @@ bool AJAAncillaryData::GetAncPacketsFromVANCLine (const UWordSequence &				inYUV
 	if (wordCountMax < 12)
 		{LOGMYERROR("UWordSequence size " << DEC(wordCountMax) << " too small"); return false;} //	too small
 
-	for (UWord wordNum = searchOffset;	wordNum < (wordCountMax - 12);	wordNum += searchIncr)
-	{
-		const UWord ancHdr0 (inYUV16Line.at (wordNum + (0 * searchIncr)));	//	0x000
-		const UWord ancHdr1 (inYUV16Line.at (wordNum + (1 * searchIncr)));	//	0x3ff
-		const UWord ancHdr2 (inYUV16Line.at (wordNum + (2 * searchIncr)));	//	0x3ff
-		const UWord ancHdr3 (inYUV16Line.at (wordNum + (3 * searchIncr)));	//	DID
-		const UWord ancHdr4 (inYUV16Line.at (wordNum + (4 * searchIncr)));	//	SDID
-		const UWord ancHdr5 (inYUV16Line.at (wordNum + (5 * searchIncr)));	//	DC
-		if (ancHdr0 == 0x000  &&  ancHdr1 == 0x3ff	&&	ancHdr2 == 0x3ff)
+	const UWord *	pWords		(&inYUV16Line[0]);
+	const UWord		searchEnd	(wordCountMax - 12);
+	UWord			wordNum		(searchOffset);
+#if defined(NTV2_ANC_SSE2)
+	if (gUseSIMD)
+	{	//	Look for the 0x000/0x3FF/0x3FF anc data flag at 8 word offsets at a time...
+		const __m128i	zero	(_mm_setzero_si128());
+		const __m128i	x3FF	(_mm_set1_epi16(0x3FF));
+		const int		lanes	(searchIncr == 1 ? 0xFFFF : (searchOffset ? 0xCCCC : 0x3333));	//	movemask bits of the offsets to search
+		UWord			base	(0);
+		for (;  base + 8 <= searchEnd;  base += 8)
 		{
-			//	Total words in ANC packet: 6 header words + data count + checksum word...
-			UWord	dataCount	(ancHdr5 & 0xFF);
-			UWord	totalCount	(6	+  dataCount  +	 1);
-
-			if (totalCount > wordCountMax)
-			{
-				totalCount = wordCountMax;
-				LOGMYERROR ("packet totalCount " << totalCount << " exceeds max " << wordCountMax);
+			const __m128i	hdr0	(_mm_cmpeq_epi16(_mm_loadu_si128(reinterpret_cast<const __m128i*>(pWords + base)), zero));
+			const __m128i	hdr1	(_mm_cmpeq_epi16(_mm_loadu_si128(reinterpret_cast<const __m128i*>(pWords + base + searchIncr)), x3FF));
+			const __m128i	hdr2	(_mm_cmpeq_epi16(_mm_loadu_si128(reinterpret_cast<const __m128i*>(pWords + base + 2 * searchIncr)), x3FF));
+			int				found	(_mm_movemask_epi8(_mm_and_si128(hdr0, _mm_and_si128(hdr1, hdr2))) & lanes);
+			for (UWord lane(0);  found;  lane++, found >>= 2)
+				if (found & 3)
+					if (!ExtractAncPacket (inYUV16Line, base + lane, searchIncr, inChanSelect, outRawPackets, outWordOffsets))
+						return false;
+		}
+		wordNum = base + searchOffset;	//	Finish the rest of the line below
+	}
+#endif	//	NTV2_ANC_SSE2
+	for (;	wordNum < searchEnd;  wordNum += searchIncr)
+		if (pWords[wordNum] == 0x000  &&  pWords[wordNum + searchIncr] == 0x3FF  &&  pWords[wordNum + 2 * searchIncr] == 0x3FF)
+			if (!ExtractAncPacket (inYUV16Line, wordNum, searchIncr, inChanSelect, outRawPackets, outWordOffsets))
 				return false;
-			}
-
-			//	Be sure we don't go past the end of the line buffer...
-			if (ULWord (wordNum + totalCount) >= wordCountMax)
-			{
-				LOGMYDEBUG ("past end of line: " << wordNum << " + " << totalCount << " >= " << wordCountMax);
-				return false;	//	Past end of line buffer
-			}
-
-			if (CheckAncParityAndChecksum (inYUV16Line, wordNum, totalCount, searchIncr))
-				return false;	//	Parity/Checksum error
-
-			U16Packet	packet;
-			for (unsigned i = 0;  i < totalCount;  i++)
-				packet.push_back (inYUV16Line.at (wordNum + (i * searchIncr)));
-			outRawPackets.push_back (packet);
-			outWordOffsets.push_back (wordNum);
-
-			LOGMYINFO ("Found ANC packet in " << ::AncChannelSearchSelectToString(inChanSelect)
-							<< ": DID=" << xHEX0N(ancHdr3,4)
-							<< " SDID=" << xHEX0N(ancHdr4,4)
-							<< " word=" << wordNum
-							<< " DC=" << ancHdr5
-							<< " pix=" << (wordNum / searchIncr));
-		}	//	if ANC packet found (wildcard or matching DID/SDID)
-	}	//	scan the line
 
 	return true;
 
 }	//	GetAncPacketsFromVANCLine
 
 
+//	Expands every inIncr'th 8-bit value in [inStart, inEnd) to 10 bits (zero-padding the 2 LSBs)...
+static void Expand8BitTo10Bit (const UByte * pInBytes, UWord * pOutWords, const ULWord inStart, const ULWord inEnd, const ULWord inIncr)
+{
+	ULWord	ndx	(inStart);
+#if defined(NTV2_ANC_SSE2)
+	if (gUseSIMD)
+	{	//	16 values at a time -- when inIncr == 2, the other channel's words are left untouched...
+		const __m128i	zero	(_mm_setzero_si128());
+		const __m128i	keep	(inIncr == 1  ?  zero  :  _mm_set1_epi32((inStart & 1) ? 0x0000FFFF : int(0xFFFF0000)));
+		ULWord			base	(inIncr == 1  ?  inStart  :  inStart & ~ULWord(1));
+		for (;  base + 16 <= inEnd;  base += 16)
+		{
+			const __m128i	bytes	(_mm_loadu_si128(reinterpret_cast<const __m128i*>(pInBytes + base)));
+			__m128i *		pOut	(reinterpret_cast<__m128i*>(pOutWords + base));
+			__m128i			lo		(_mm_slli_epi16(_mm_unpacklo_epi8(bytes, zero), 2));
+			__m128i			hi		(_mm_slli_epi16(_mm_unpackhi_epi8(bytes, zero), 2));
+			if (inIncr != 1)
+			{
+				lo = _mm_or_si128(_mm_and_si128(_mm_loadu_si128(pOut), keep), _mm_andnot_si128(keep, lo));
+				hi = _mm_or_si128(_mm_and_si128(_mm_loadu_si128(pOut + 1), keep), _mm_andnot_si128(keep, hi));
+			}
+			_mm_storeu_si128(pOut, lo);
+			_mm_storeu_si128(pOut + 1, hi);
+		}
+		ndx = inIncr == 1  ?  base  :  base + (inStart & 1);
+	}
+#endif	//	NTV2_ANC_SSE2
+	for (;  ndx < inEnd;  ndx += inIncr)
+		pOutWords[ndx] = UWord(UWord(pInBytes[ndx]) << 2);	//	Pad 2 LSBs with zeros
+}	//	Expand8BitTo10Bit
+
+
 bool AJAAncillaryData::Unpack8BitYCbCrToU16sVANCLine (const void * pInYUV8Line,
 														UWordSequence & outU16YUVLine,
 														const uint32_t inNumPixels)
@@ -1785,10 +1939,7 @@ bool AJAAncillaryData::Unpack8BitYCbCrToU16sVANCLine (const void * pInYUV8Line,
 	const UByte *	pInYUV8Buffer	(reinterpret_cast <const UByte *> (pInYUV8Line));
 	const ULWord	maxOutElements	(inNumPixels * 2);
 
-	outU16YUVLine.clear ();
-	outU16YUVLine.reserve (maxOutElements);
-	while (outU16YUVLine.size() < size_t(maxOutElements))
-		outU16YUVLine.push_back(0);
+	outU16YUVLine.assign (size_t(maxOutElements), 0);
 
 	if (!pInYUV8Buffer)
 		{LOGMYERROR("NULL/empty YUV8 buffer");	return false;}	//	NULL pointer
@@ -1816,15 +1967,8 @@ bool AJAAncillaryData::Unpack8BitYCbCrToU16sVANCLine (const void * pInYUV8Line,
 			if (bNoMoreAnc)
 			{	//	NoMoreAnc -- there's a gap in the Anc data -- which is assumed to mean there are no more packets on this line.
 				//	Just do a simple 8-bit -> 10-bit expansion with the remaining data on the line...
-				const ULWord	index		(2 * pixNum	 +	comp);
-				const UWord		dataValue	(UWord(UWord(pInYUV8Buffer[index]) << 2));	//	Pad 2 LSBs with zeros
-
-				NTV2_ASSERT (index <= ULWord(outU16YUVLine.size()));
-				if (index < ULWord(outU16YUVLine.size()))
-					outU16YUVLine[index] = dataValue;
-				else
-					outU16YUVLine.push_back(dataValue);
-				pixNum++;
+				::Expand8BitTo10Bit (pInYUV8Buffer, &outU16YUVLine[0], 2 * pixNum + comp, maxOutElements, 2);
+				pixNum = inNumPixels;
 			}
 			else
 			{	//	Still processing (possible) Anc data...
@@ -1887,10 +2031,7 @@ bool AJAAncillaryData::Unpack8BitYCbCrToU16sVANCLineSD (const void * pInYUV8Line
 	const UByte * pInYUV8Buffer (reinterpret_cast<const UByte*>(pInYUV8Line));
 	const ULWord  maxNumElements(inNumPixels * 2);
 
-	outU16YUVLine.clear ();
-	outU16YUVLine.reserve (maxNumElements);
-	while (outU16YUVLine.size() < size_t(maxNumElements))
-		outU16YUVLine.push_back(0);
+	outU16YUVLine.assign (size_t(maxNumElements), 0);
 
 	if (!pInYUV8Buffer)
 		{LOGMYERROR("NULL/empty YUV8 buffer");	return false;}	//	NULL pointer
@@ -1915,13 +2056,8 @@ bool AJAAncillaryData::Unpack8BitYCbCrToU16sVANCLineSD (const void * pInYUV8Line
 		{	//	NoMoreAnc -- there's a gap in the Anc data -- which is assumed to mean there are
 			//	no more packets on this line.  Just do a simple 8-bit -> 10-bit expansion with the
 			//	remaining data on the line...
-			const UWord dataValue (UWord(UWord(pInYUV8Buffer[ndx]) << 2));	//	Pad 2 LSBs with zeros
-			NTV2_ASSERT (ndx <= ULWord(outU16YUVLine.size()));
-			if (ndx < ULWord(outU16YUVLine.size()))
-				outU16YUVLine[ndx] = dataValue;
-			else
-				outU16YUVLine.push_back(dataValue);
-			ndx++;
+			::Expand8BitTo10Bit (pInYUV8Buffer, &outU16YUVLine[0], ndx, maxNumElements, 1);
+			ndx = maxNumElements;
 		}
 		else
 		{	//	Still processing (possible) Anc data...
@@ -1970,6 +2106,52 @@ bool AJAAncillaryData::Unpack8BitYCbCrToU16sVANCLineSD (const void * pInYUV8Line
 }	//	Unpack8BitYCbCrToU16sVANCLineSD
 
 
+bool AJAAncillaryData::Unpack10BitYCbCrToU16sVANCLine (const void * pInYUV10Line,
+														UWordSequence & outU16YUVLine,
+														const uint32_t inNumU32s)
+{
+	const uint32_t *	pInLine	(reinterpret_cast<const uint32_t*>(pInYUV10Line));
+	outU16YUVLine.clear ();
+	if (!pInLine)
+		{LOGMYERROR("NULL/empty YUV10 buffer");	return false;}	//	NULL pointer
+	if (!inNumU32s)
+		{LOGMYERROR("zero-length line"); return false;}			//	Invalid width
+
+	outU16YUVLine.resize (size_t(inNumU32s) * 3);
+	UWord *		pOut	(&outU16YUVLine[0]);
+	uint32_t	ndx		(0);
+#if defined(NTV2_ANC_SSE2)
+	if (gUseSIMD)
+	{	//	Spread each 32-bit word's 3 components into the low 3 words of a 64-bit lane, then store 64 bits every
+		//	3 components (the 4th word of each store gets overwritten by the next store)...
+		const __m128i	zero	(_mm_setzero_si128());
+		const __m128i	mask0	(_mm_set_epi32(0, 0x000003FF, 0, 0x000003FF));
+		const __m128i	mask1	(_mm_set_epi32(0, 0x03FF0000, 0, 0x03FF0000));
+		const __m128i	mask2	(_mm_set_epi32(0x000003FF, 0, 0x000003FF, 0));
+		for (;  ndx + 5 <= inNumU32s;  ndx += 4)
+		{
+			const __m128i	in	(_mm_loadu_si128(reinterpret_cast<const __m128i*>(pInLine + ndx)));
+			const __m128i	w01	(_mm_unpacklo_epi32(in, zero));
+			const __m128i	w23	(_mm_unpackhi_epi32(in, zero));
+			const __m128i	c01	(_mm_or_si128(_mm_and_si128(w01, mask0), _mm_or_si128(_mm_and_si128(_mm_slli_epi64(w01, 6), mask1), _mm_and_si128(_mm_slli_epi64(w01, 12), mask2))));
+			const __m128i	c23	(_mm_or_si128(_mm_and_si128(w23, mask0), _mm_or_si128(_mm_and_si128(_mm_slli_epi64(w23, 6), mask1), _mm_and_si128(_mm_slli_epi64(w23, 12), mask2))));
+			_mm_storel_epi64(reinterpret_cast<__m128i*>(pOut + 3 * ndx + 0), c01);
+			_mm_storel_epi64(reinterpret_cast<__m128i*>(pOut + 3 * ndx + 3), _mm_srli_si128(c01, 8));
+			_mm_storel_epi64(reinterpret_cast<__m128i*>(pOut + 3 * ndx + 6), c23);
+			_mm_storel_epi64(reinterpret_cast<__m128i*>(pOut + 3 * ndx + 9), _mm_srli_si128(c23, 8));
+		}
+	}
+#endif	//	NTV2_ANC_SSE2
+	for (;  ndx < inNumU32s;  ndx++)
+	{
+		pOut[3 * ndx + 0] = UWord((pInLine[ndx]      ) & 0x3FF);
+		pOut[3 * ndx + 1] = UWord((pInLine[ndx] >> 10) & 0x3FF);
+		pOut[3 * ndx + 2] = UWord((pInLine[ndx] >> 20) & 0x3FF);
+	}
+	return true;
+}	//	Unpack10BitYCbCrToU16sVANCLine
+
+
 void AJAAncillaryData::GetInstanceCounts (uint32_t & outConstructed, uint32_t & outDestructed)
 {
 #if defined(_DEBUG)
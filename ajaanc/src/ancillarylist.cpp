@@ -14,9 +14,7 @@
 #if defined (AJALinux)
 	#include <string.h>		//	For memcpy
 #endif	//	AJALinux
-#if defined(AJAANCLISTIMPL_VECTOR)
-	#include <algorithm>
-#endif
+#include <algorithm>
 #if defined(AJA_USE_CPLUSPLUS11)
 	#include <utility>		//	For std::move
 #endif
@@ -771,27 +769,35 @@ AJAStatus AJAAncillaryList::AddReceivedAuxiliaryData (const NTV2Buffer & inRecei
 //	AJAAncillaryData objects and append them to me. 'inReceivedData' includes the RTP header.
 AJAStatus AJAAncillaryList::AddReceivedAncillaryData (const ULWordSequence & inReceivedData)
 {
-	AJAStatus	status	(AJA_STATUS_SUCCESS);
 	if (inReceivedData.empty())
 		{LOGMYWARN("Empty RTP data vector");  return AJA_STATUS_SUCCESS;}
+	LOGMYDEBUG(::ULWordSequenceToStringBE(inReceivedData) << " (BigEndian)");	//	ByteSwap em to make em look right
+	return AddReceivedRTPPacket (&inReceivedData[0], inReceivedData.size());
+}	//	AddReceivedAncillaryData
 
-LOGMYDEBUG(::ULWordSequenceToStringBE(inReceivedData) << " (BigEndian)");	//	ByteSwap em to make em look right
+
+//	Parse one RTP packet (including its RTP header) in place...
+AJAStatus AJAAncillaryList::AddReceivedRTPPacket (const uint32_t * pInU32s, const size_t inNumU32s)
+{
+	AJAStatus	status	(AJA_STATUS_SUCCESS);
+	if (!pInU32s  ||  !inNumU32s)
+		{LOGMYWARN("Empty RTP packet");  return AJA_STATUS_SUCCESS;}
 
 	//	Crack open the RTP packet header...
 	AJARTPAncPayloadHeader	RTPheader;
-	if (!RTPheader.ReadFromULWordVector(inReceivedData))
-		{LOGMYERROR("AJARTPAncPayloadHeader::ReadULWordVector failed, " << DEC(4*inReceivedData.size()) << " header bytes");  return AJA_STATUS_FAIL;}
+	if (!RTPheader.ReadFromBuffer(NTV2Buffer(pInU32s, inNumU32s * sizeof(uint32_t))))
+		{LOGMYERROR("AJARTPAncPayloadHeader::ReadFromBuffer failed, " << DEC(4*inNumU32s) << " header bytes");  return AJA_STATUS_FAIL;}
 	if (RTPheader.IsNULL())
 		{LOGMYWARN("No anc packets added: NULL RTP header: " << RTPheader);	 return AJA_STATUS_SUCCESS;}	//	Not an error
 	if (!RTPheader.IsValid())
 		{LOGMYWARN("RTP header invalid: " << RTPheader);  return AJA_STATUS_FAIL;}
 
 	const size_t	predictedPayloadSize	(RTPheader.GetPayloadLength() / sizeof(uint32_t));	//	Payload length (excluding RTP header)
-	const size_t	actualPayloadSize		(inReceivedData.size() - AJARTPAncPayloadHeader::GetHeaderWordCount());
+	const size_t	actualPayloadSize		(inNumU32s - AJARTPAncPayloadHeader::GetHeaderWordCount());
 	const uint32_t	numPackets				(RTPheader.GetAncPacketCount());
 	uint32_t		pktsAdded				(0);
 
-	//	Sanity check the RTP header against inReceivedData...
+	//	Sanity check the RTP header against the given word count...
 	if (actualPayloadSize < predictedPayloadSize)
 		{LOGMYERROR("Expected " << DEC(predictedPayloadSize) << ", but only given " << DEC(actualPayloadSize) << " U32s: " << RTPheader);  return AJA_STATUS_BADBUFFERCOUNT;}
 	if (!numPackets)
@@ -802,12 +808,12 @@ LOGMYDEBUG(::ULWordSequenceToStringBE(inReceivedData) << " (BigEndian)");	//	Byt
 LOGMYDEBUG(RTPheader);
 
 	//	Parse each anc pkt in the RTP pkt...
-	uint16_t	u32Ndx	(5);	//	First Anc packet starts at ULWord[5]
+	size_t		u32Ndx	(AJARTPAncPayloadHeader::GetHeaderWordCount());	//	First Anc packet starts at ULWord[5]
 	unsigned	pktNum	(0);
 	for (;	pktNum < numPackets	 &&	 AJA_SUCCESS(status);  pktNum++)
 	{
 		AJAAncillaryData	tempPkt;
-		status = tempPkt.InitWithReceivedData(inReceivedData, u32Ndx, IgnoreChecksumErrors());
+		status = tempPkt.InitWithReceivedData(pInU32s, inNumU32s, u32Ndx, IgnoreChecksumErrors());
 		if (AJA_FAILURE(status))
 			continue;
 
@@ -833,7 +839,41 @@ LOGMYDEBUG(RTPheader);
 	else
 		LOGMYINFO(DEC(numPackets) << " pkts added from RTP pkt: " << *this);
 	return status;
-}	//	AddReceivedAncillaryData
+}	//	AddReceivedRTPPacket
+
+
+AJAStatus AJAAncillaryList::AddReceivedRTPData (const NTV2Buffer & inReceivedData)
+{
+	const uint32_t *	pU32s			(reinterpret_cast<const uint32_t*>(inReceivedData.GetHostPointer()));
+	const size_t		totalU32s		(inReceivedData.GetByteCount() / sizeof(uint32_t));
+	const size_t		hdrU32s			(AJARTPAncPayloadHeader::GetHeaderWordCount());
+	size_t				u32Offset		(0);	//	Offset to start of current RTP packet, in 32-bit words
+	uint32_t			RTPPacketCount	(0);	//	Number of packets encountered
+	unsigned			retries			(0);	//	Retry count
+	const unsigned		MAX_RETRIES		(4);	//	Max number of U32s past the end of an RTP packet to look for another
+	AJAStatus			result			(AJA_STATUS_SUCCESS);
+
+	while (pU32s  &&  (u32Offset + hdrU32s) <= totalU32s  &&  retries++ < MAX_RETRIES)
+	{
+		AJARTPAncPayloadHeader	rtpHeader;
+		size_t					u32Count	(1);	//	If no RTP header found, move ahead 1 x U32
+		if (rtpHeader.ReadFromBuffer(NTV2Buffer(pU32s + u32Offset, (totalU32s - u32Offset) * sizeof(uint32_t)))  &&  rtpHeader.IsValid())
+		{
+			++RTPPacketCount;	//	Increment our packet tally
+			retries = 0;		//	Reset our retry counter when we get a good header
+			u32Count = rtpHeader.GetPayloadLength() / sizeof(uint32_t)  +  hdrU32s;		//	Payload size plus RTP header size
+
+			//	Process the full RTP packet in place (AddReceivedRTPPacket fails if it's truncated)...
+			result = AddReceivedRTPPacket (pU32s + u32Offset, std::min(u32Count, totalU32s - u32Offset));
+			if (AJA_FAILURE(result))
+				{RCVWARN("On RTP pkt " << DEC(RTPPacketCount) << " at U32 offset " << DEC(u32Offset) << ": " << ::AJAStatusToString(result));  break;}
+			if (!AllowMultiRTPReceive())
+				break;	//	Only one RTP packet allowed -- done -- success!
+		}
+		u32Offset += u32Count;	//	Look for another RTP packet
+	}	//	loop til no more RTP packets found
+	return result;
+}	//	AddReceivedRTPData
 
 
 static AJAStatus AppendUWordPacketToGump (	UByteSequence &			outGumpPkt,
@@ -961,9 +1001,11 @@ AJAStatus AJAAncillaryList::SetFromVANCData (const NTV2Buffer &		inFB,
 		return AJA_STATUS_UNSUPPORTED;	//	Only 'v210' and '2vuy' currently supported
 	}
 
+	UWordSequence					uwords;		//	Reused for every line
+	AJAAncillaryData::U16Packets	yPackets, cPackets;
+	UWordSequence					yHOffsets, cHOffsets;
 	for (ULWord lineOffset (0);	 lineOffset < inFD.GetFirstActiveLine();  lineOffset++)
 	{
-		UWordSequence	uwords;
 		bool			isF2			(false);
 		ULWord			smpteLineNum	(0);
 		unsigned		ndx				(0);
@@ -971,7 +1013,8 @@ AJAStatus AJAAncillaryList::SetFromVANCData (const NTV2Buffer &		inFB,
 
 		inFD.GetSMPTELineNumber (lineOffset, smpteLineNum, isF2);
 		if (fbf == NTV2_FBF_10BIT_YCBCR)
-			::UnpackLine_10BitYUVtoUWordSequence (inFD.GetRowAddress(inFB.GetHostAddress(0), lineOffset), inFD, uwords);
+			AJAAncillaryData::Unpack10BitYCbCrToU16sVANCLine (inFD.GetRowAddress(inFB.GetHostAddress(0), lineOffset),
+																uwords, inFD.linePitch);
 		else if (isSD)
 			AJAAncillaryData::Unpack8BitYCbCrToU16sVANCLineSD (inFD.GetRowAddress(inFB.GetHostAddress(0), lineOffset),
 																uwords, inFD.GetRasterWidth());
@@ -980,20 +1023,16 @@ AJAStatus AJAAncillaryList::SetFromVANCData (const NTV2Buffer &		inFB,
 															uwords,	 inFD.GetRasterWidth());
 		if (isSD)
 		{
-			AJAAncillaryData::U16Packets	ycPackets;
-			UWordSequence					ycHOffsets;
 			AJAAncDataLoc					loc (defaultLink, AJAAncDataChannel_Both, AJAAncDataSpace_VANC, uint16_t(smpteLineNum));
 
-			AJAAncillaryData::GetAncPacketsFromVANCLine (uwords, AncChannelSearch_Both, ycPackets, ycHOffsets);
-			NTV2_ASSERT(ycPackets.size() == ycHOffsets.size());
+			AJAAncillaryData::GetAncPacketsFromVANCLine (uwords, AncChannelSearch_Both, yPackets, yHOffsets);
+			NTV2_ASSERT(yPackets.size() == yHOffsets.size());
 
-			for (AJAAncillaryData::U16Packets::const_iterator it(ycPackets.begin());  it != ycPackets.end();  ++it, ndx++)
-				outPkts.AddVANCData (*it, loc.SetHorizontalOffset(ycHOffsets[ndx]), inFrameNum);
+			for (AJAAncillaryData::U16Packets::const_iterator it(yPackets.begin());  it != yPackets.end();  ++it, ndx++)
+				outPkts.AddVANCData (*it, loc.SetHorizontalOffset(yHOffsets[ndx]), inFrameNum);
 		}
 		else
 		{
-			AJAAncillaryData::U16Packets	yPackets, cPackets;
-			UWordSequence					yHOffsets, cHOffsets;
 			AJAAncDataLoc					yLoc	(defaultLink, AJAAncDataChannel_Y, AJAAncDataSpace_VANC, uint16_t(smpteLineNum));
 			AJAAncDataLoc					cLoc	(defaultLink, AJAAncDataChannel_C, AJAAncDataSpace_VANC, uint16_t(smpteLineNum));
 			//cerr << endl << "SetFromVANCData: +" << DEC0N(lineOffset,2) << ": ";	inFD.PrintSMPTELineNumber(cerr, lineOffset);  cerr << ":" << endl << uwords << endl;
@@ -1020,7 +1059,6 @@ AJAStatus AJAAncillaryList::AddFromDeviceAncBuffer (const NTV2Buffer & inAncBuff
 													AJAAncillaryList & outPackets,
 													const uint32_t inFrameNum)
 {
-	uint32_t		RTPPacketCount	(0);	//	Number of packets encountered
 	const uint32_t	origPktCount	(outPackets.CountAncillaryData());
 	AJAStatus		result			(AJA_STATUS_SUCCESS);
 
@@ -1034,57 +1072,7 @@ AJAStatus AJAAncillaryList::AddFromDeviceAncBuffer (const NTV2Buffer & inAncBuff
 	else
 	{
 		//	RTP	  RTP	RTP	  RTP	RTP	  RTP	RTP	  RTP	RTP	  RTP	RTP	  RTP	RTP	  RTP	RTP	  RTP	RTP	  RTP
-		NTV2Buffer		ancBuffer		(inAncBuffer.GetHostPointer(), inAncBuffer.GetByteCount()); //	Don't copy
-		size_t			ULWordCount		(0);	//	Size of current RTP packet, including RTP header, in 32-bit words
-		size_t			ULWordOffset	(0);	//	Offset to start of current RTP packet, in 32-bit words
-		unsigned		retries			(0);	//	Retry count
-		const unsigned	MAX_RETRIES		(4);	//	Max number of U32s past the end of an RTP packet to look for another
-
-		while (ancBuffer  &&  retries++ < MAX_RETRIES)
-		{
-			if (AJARTPAncPayloadHeader::BufferStartsWithRTPHeader(ancBuffer))
-			{
-				ULWordSequence			U32s;
-				AJARTPAncPayloadHeader	rtpHeader;
-
-				++RTPPacketCount;	//	Increment our packet tally
-
-				//	Read the RTP packet header to discover the RTP packet's true length...
-				if (!rtpHeader.ReadFromBuffer(ancBuffer))
-				{
-					RCVWARN("On RTP pkt " << DEC(RTPPacketCount) << ", RTP hdr ReadFromBuffer failed at: " << ancBuffer.AsString(40));
-					break;
-				}
-
-				ULWordCount = rtpHeader.GetPayloadLength() / sizeof(uint32_t)		//	payload size
-								+  AJARTPAncPayloadHeader::GetHeaderWordCount();	//	plus RTP header size
-
-				//	Read ULWordCount x U32s from ancBuffer...
-				if (!ancBuffer.GetU32s (U32s,  /*U32Offset=*/0,	 /*maxU32sToGet=*/ULWordCount))
-				{
-					RCVFAIL("On RTP pkt " << DEC(RTPPacketCount) << ", GetU32s(" << DEC(ULWordCount) << ") at: " << ancBuffer.AsString(40));
-					return AJA_STATUS_BADBUFFERSIZE;	//	Ran off the end?
-				}
-
-				retries = 0;	//	Reset our retry counter when we get a good header
-
-				//	Process the full RTP packet U32s...
-				result = outPackets.AddReceivedAncillaryData(U32s);
-				if (AJA_FAILURE(result))
-					break;	//	Done -- failed!
-
-				if (!outPackets.AllowMultiRTPReceive())
-					break;	//	Only one RTP packet allowed -- done -- success!
-			}	//	
-			else
-				ULWordCount = 1;	//	No RTP header found -- move ahead 1 x U32
-
-			//	Move "ancBuffer" forward inside "inAncBuffer" to check for another RTP packet...
-			ULWordOffset += ULWordCount;
-			ancBuffer.Set (inAncBuffer.GetHostAddress(ULWord(ULWordOffset * sizeof(uint32_t))), //	Increment startAddress
-							inAncBuffer.GetByteCount() - ULWordOffset * sizeof(uint32_t));		//	Decrement byteCount
-			RCVDBG("Moved buffer " << inAncBuffer << " forward by " << DEC(ULWordCount) << " U32s: " << ancBuffer.AsString(20));
-		}	//	loop til no more RTP packets found
+		result = outPackets.AddReceivedRTPData (inAncBuffer);	//	Parses in place -- no copying
 	}	//	else RTP
 
 	const uint32_t	pktsAdded (outPackets.CountAncillaryData() - origPktCount);
@@ -1369,6 +1357,36 @@ AJAStatus AJAAncillaryList::GetTransmitData (NTV2Buffer & F1Buffer, NTV2Buffer &
 }
 
 
+//	Overwrites every other 10-bit component of a 'v210' line, starting at inFirstComp, in place. Component N lives in
+//	32-bit word N/3, at bit (N%3)*10. This avoids unpacking and repacking the whole line for each packet...
+static void PatchV210Components (ULWord * pLine, const ULWord inMaxComps, const ULWord inFirstComp, const ULWord inIncr,
+								const UWordSequence & inComps)
+{
+	ULWord	compNdx	(inFirstComp);
+	for (size_t ndx(0);  ndx < inComps.size()  &&  compNdx < inMaxComps;  ndx++, compNdx += inIncr)
+	{
+		const ULWord	shift	((compNdx % 3) * 10);
+		ULWord &		word	(pLine[compNdx / 3]);
+		word = (word & ~(ULWord(0x3FF) << shift))  |  (ULWord(inComps[ndx] & 0x3FF) << shift);
+	}
+}	//	PatchV210Components
+
+
+//	Packs the given components into the start of a 'v210' line, padded with SMPTE black to a multiple of 12 components
+//	(i.e. whole 6-pixel groups), exactly as ::YUVComponentsTo10BitYUVPackedBuffer would...
+static void PackV210LineStart (ULWord * pLine, const ULWord inMaxComps, const UWordSequence & inComps)
+{
+	const ULWord	numComps	(ULWord(inComps.size()) < 12  ?  12  :  (ULWord(inComps.size()) + 11) / 12 * 12);
+	for (ULWord compNdx(0);  compNdx < numComps  &&  compNdx < inMaxComps;  compNdx += 3)
+	{
+		ULWord	word (0);
+		for (ULWord n(0);  n < 3;  n++)
+			word |= ULWord(compNdx + n < ULWord(inComps.size())  ?  inComps[compNdx + n]  :  0x040) << (n * 10);
+		pLine[compNdx / 3] = word;
+	}
+}	//	PackV210LineStart
+
+
 AJAStatus AJAAncillaryList::GetVANCTransmitData (NTV2Buffer & inFrameBuffer,	const NTV2FormatDescriptor & inFormatDesc)
 {
 	if (inFrameBuffer.IsNULL())
@@ -1400,10 +1418,12 @@ AJAStatus AJAAncillaryList::GetVANCTransmitData (NTV2Buffer & inFrameBuffer,	con
 	//	I need to be in ascending line order...
 	SortListByLocation();
 
-	//	BRUTE-FORCE METHOD -- NOT VERY EFFICIENT
 	const bool	isSD	(inFormatDesc.IsSD());
 	AJAAncillaryList	failures, successes;
 	set <uint16_t>		lineOffsetsWritten;
+	UWordSequence		u16PktComponents;	//	Reused for every packet
+	//	'v210' components that a repack of the whole line would have written:  the raster width, rounded up to 6 pixels...
+	const ULWord		maxV210Comps	(min(inFormatDesc.linePitch * 3, (inFormatDesc.GetRasterWidth() * 2 + 11) / 12 * 12));
 
 	//	For each VANC line...
 	for (UWord fbLineOffset(0);	 fbLineOffset < inFormatDesc.GetFirstActiveLine();	fbLineOffset++)
@@ -1417,7 +1437,7 @@ AJAStatus AJAAncillaryList::GetVANCTransmitData (NTV2Buffer & inFrameBuffer,	con
 			bool					muxedOK (false);
 			AJAAncillaryData &		ancData (**iter);
 			const AJAAncDataLoc &	loc	(ancData.GetDataLocation());
-			UWordSequence			u16PktComponents;
+			u16PktComponents.clear();
 			if (ancData.GetDataCoding() != AJAAncDataCoding_Digital)	//	Ignore "Raw" or "Analog" or "Unknown" packets
 				continue;
 			if (loc.GetDataSpace() != AJAAncDataSpace_VANC)				//	Ignore "HANC" or "Unknown" packets
@@ -1456,36 +1476,18 @@ AJAStatus AJAAncillaryList::GetVANCTransmitData (NTV2Buffer & inFrameBuffer,	con
 					}
 				}	//	if 2vuy
 				else	/////////////	v210 FBF:
-				{
-					if (isSD)
-					{	//	For SD, just pack the u16 components into the buffer...
-						while (u16PktComponents.size() < 12	 ||	 u16PktComponents.size() % 12)	//	YUVComponentsTo10BitYUVPackedBuffer fails if packing fewer than 12 words
-							u16PktComponents.push_back(0x040);	//	SMPTE black
-						muxedOK = ::YUVComponentsTo10BitYUVPackedBuffer (u16PktComponents, inFrameBuffer, inFormatDesc, fbLineOffset);
+				{	//	Patch the packet's components into the packed line in place...
+					ULWord *	pLine	(AJA_NULL);
+					if (inFrameBuffer.GetByteCount() >= inFormatDesc.GetBytesPerRow() * ULWord(fbLineOffset+1))
+						pLine = reinterpret_cast<ULWord*>(inFormatDesc.GetWriteableRowAddress(inFrameBuffer.GetHostPointer(), fbLineOffset));
+					muxedOK = pLine != AJA_NULL;
+					if (muxedOK)
+					{
+						if (isSD)	//	For SD, just pack the u16 components into the start of the line...
+							::PackV210LineStart (pLine, maxV210Comps, u16PktComponents);
+						else		//	HD overwrites only the Y or C channel data:
+							::PatchV210Components (pLine, maxV210Comps, loc.IsLumaChannel() ? 1 : 0, 2, u16PktComponents);
 					}
-					else
-					{	//	HD overwrites only the Y or C channel data:
-						UWordSequence	YUV16Line;
-						unsigned		dstNdx	(loc.IsLumaChannel() ? 1 : 0);
-
-						//	Read original Y+C components from FB...
-						muxedOK = UnpackLine_10BitYUVtoU16s (YUV16Line, inFrameBuffer, inFormatDesc, fbLineOffset);
-						//cerr << "WriteVANCData|orig: +" << DEC0N(fbLineOffset,2) << ": ";	 inFormatDesc.PrintSMPTELineNumber(cerr, fbLineOffset);	 cerr << ":" << endl << YUV16Line << endl;
-
-						//	Patch the Y or C channel...
-						if (muxedOK)
-							for (unsigned srcNdx(0);  srcNdx < u16PktComponents.size();	 srcNdx++)
-								YUV16Line[dstNdx + 2*srcNdx] = u16PktComponents[srcNdx] & 0x03FF;
-						//cerr << "WriteVANCData|modi: +" << DEC0N(fbLineOffset,2) << ": ";	 inFormatDesc.PrintSMPTELineNumber(cerr, fbLineOffset);	 cerr << ":" << endl << YUV16Line << endl;
-
-						//	Repack the patched YUV16 line back into the FB...
-						if (muxedOK)
-						{
-							while (YUV16Line.size() < 12  ||  YUV16Line.size() % 12)	//	YUVComponentsTo10BitYUVPackedBuffer fails if packing fewer than 12 words
-								YUV16Line.push_back(0x040); //	SMPTE black
-							muxedOK = ::YUVComponentsTo10BitYUVPackedBuffer (YUV16Line, inFrameBuffer, inFormatDesc, fbLineOffset);
-						}
-					}	//	else HD
 				}	//	else v210
 			}	//	if GenerateTransmitData OK
 
@@ -1628,59 +1630,187 @@ AJAStatus AJAAncillaryList::WriteRTPPackets (NTV2Buffer & theBuffer,	uint32_t &
 AJAStatus AJAAncillaryList::GetIPTransmitData (NTV2Buffer & F1Buffer, NTV2Buffer & F2Buffer,
 												const bool inIsProgressive, const uint32_t inF2StartLine)
 {
-	AJAStatus		result (AJA_STATUS_SUCCESS);
-	AJAU32Pkts		F1U32Pkts, F2U32Pkts;		//	32-bit network-byte-order data
-	AJAAncPktCounts F1AncCounts, F2AncCounts;	//	Per-RTP packet anc packet counts
-	uint32_t		byteCount(0);				//	Not used
+	uint32_t	F1ByteCount(0), F2ByteCount(0);		//	Not used
 
 	//	I need to be in ascending line order...
 	F1Buffer.Fill(uint64_t(0));	 F2Buffer.Fill(uint64_t(0));
 	SortListByLocation();
 
-	//	Get F1 & F2 xmit RTP U32 words (and SMPTE anc packet counts for each RTP packet)...
-	result = GetRTPPackets (F1U32Pkts, F2U32Pkts, F1AncCounts, F2AncCounts, inIsProgressive, inF2StartLine);
-	if (AJA_FAILURE(result))
-		return result;
+	//	Write the F1 & F2 RTP packets straight into the buffers...
+	return WriteIPTransmitData (F1Buffer, F2Buffer, F1ByteCount, F2ByteCount, inIsProgressive, inF2StartLine);
 
-	/*
-	ostringstream oss;	oss << "Anc Counts: F1=";  for (size_t ndx(0);	ndx < F1AncCounts.size();  ndx++)  oss << (ndx?"|":"[") << DEC(uint16_t(F1AncCounts.at(ndx)));
-	oss << "] F2=";	 for (size_t ndx(0);  ndx < F2AncCounts.size();	 ndx++)	 oss << (ndx?"|":"[") << DEC(uint16_t(F2AncCounts.at(ndx)));  oss << "]";
-	XMTDBG(oss.str());
-	*/
+}	//	GetIPTransmitData
 
-	//	Write the F1 buffer...
-	result = WriteRTPPackets (F1Buffer, byteCount, F1U32Pkts, F1AncCounts, /*isF2*/false, inIsProgressive);
-	if (AJA_FAILURE(result))
-		return result;
 
-	//	Write the F2 buffer...
-	if (!inIsProgressive)
-		result = WriteRTPPackets (F2Buffer, byteCount, F2U32Pkts, F2AncCounts, /*isF2*/true, inIsProgressive);
+AJAStatus AJAAncillaryList::GetIPTransmitDataLength (uint32_t & outF1ByteCount, uint32_t & outF2ByteCount,
+													const bool inIsProgressive, const uint32_t inF2StartLine)
+{
+	NTV2Buffer	nullBuffer; //	An empty buffer tells WriteIPTransmitData to just calculate byte counts...
+	return WriteIPTransmitData (nullBuffer, nullBuffer, outF1ByteCount, outF2ByteCount, inIsProgressive, inF2StartLine);
+}
 
-	return result;
 
-}	//	GetIPTransmitData
+//	Writes one field's RTP packets straight into a buffer, or just tallies their size if the buffer is NULL.
+//	Produces the same RTP packets as GetRTPPackets + WriteRTPPackets (see those for details)...
+namespace
+{
+class RTPFieldWriter
+{
+	public:
+		RTPFieldWriter (NTV2Buffer & inBuffer, const bool inIsF2, const bool inIsProgressive, const bool inMultiRTP)
+			:	mBuffer			(inBuffer),
+				mpU32s			(inBuffer.IsNULL() ? AJA_NULL : reinterpret_cast<uint32_t*>(inBuffer.GetHostPointer())),
+				mMaxU32s		(inBuffer.GetByteCount() / sizeof(uint32_t)),
+				mMultiRTP		(inMultiRTP),
+				mIsOpen			(!inMultiRTP),	//	Single RTP pkt is always open, even if it ends up with no anc pkts
+				mU32Offset		(0),
+				mRTPU32Offset	(0),
+				mPayloadU32s	(0),
+				mRTPAncCount	(0),
+				mAncCount		(0)
+		{
+			if (inIsProgressive)
+				mHeader.SetProgressive();
+			else if (inIsF2)
+				mHeader.SetField2();
+			else
+				mHeader.SetField1();
+		}
 
+		//	Appends the given anc packet to the current (or a new) RTP packet, unless it would exceed the RTP packet limits...
+		AJAStatus	AddPacket (AJAAncillaryData & inPkt, unsigned & inOutCountOverflows, size_t & inOutOverflowWords)
+		{
+			if (mAncCount >= MAX_ANC_PKTS_PER_RTP_PKT)
+				{inOutCountOverflows++;  LOGMYDEBUG("Skipped pkt, RTP pkt count overflow: " << inPkt.AsString(16));  return AJA_STATUS_SUCCESS;}
+			inPkt.GeneratePayloadData();
+			if (inPkt.GetDC() > 255)
+				{LOGMYERROR("Data count exceeds 255: " << inPkt.AsString(16));  return AJA_STATUS_RANGE;}
+			const uint32_t	numU32s	(inPkt.GetRTPPacketWordCount());
+			if (!mMultiRTP  &&  (mPayloadU32s + numU32s) > MAX_RTP_PKT_LENGTH_WORDS)
+				{inOutOverflowWords += numU32s;  LOGMYDEBUG("Skipped pkt, RTP pkt length overflow: " << inPkt.AsString(16));  return AJA_STATUS_SUCCESS;}
+			if (mMultiRTP)
+			{	//	One RTP pkt per anc pkt -- close the previous one (if any), and start a new one...
+				if (mIsOpen)
+				{
+					const AJAStatus	status	(CloseRTPPacket(/*isLast*/false));
+					if (AJA_FAILURE(status))
+						return status;
+				}
+				mIsOpen = true;
+			}
+			if (mpU32s)
+			{
+				const size_t	u32Offset	(mRTPU32Offset + AJARTPAncPayloadHeader::GetHeaderWordCount() + mPayloadU32s);
+				uint32_t		u32Count	(0);
+				if (u32Offset > mMaxU32s
+					||  AJA_FAILURE(inPkt.WriteRTPPacketWords (mpU32s + u32Offset, mMaxU32s - u32Offset, u32Count)))
+						{LOGMYERROR("Buffer " << mBuffer << " too small for " << DEC(numU32s) << " U32s at u32offset=" << DEC(u32Offset));  return AJA_STATUS_FAIL;}
+			}
+			mPayloadU32s += numU32s;
+			mRTPAncCount++;
+			mAncCount++;
+			return AJA_STATUS_SUCCESS;
+		}
 
-AJAStatus AJAAncillaryList::GetIPTransmitDataLength (uint32_t & outF1ByteCount, uint32_t & outF2ByteCount,
-													const bool inIsProgressive, const uint32_t inF2StartLine)
+		//	Writes the last RTP packet's header, and answers with the total byte count...
+		AJAStatus	Finish (uint32_t & outByteCount)
+		{
+			outByteCount = 0;
+			if (mIsOpen)
+			{
+				const AJAStatus	status	(CloseRTPPacket(/*isLast*/true));
+				if (AJA_FAILURE(status))
+					return status;
+			}
+			outByteCount = uint32_t(mU32Offset * sizeof(uint32_t));
+			//	Zero a few U32s past the end, so a receiver scanning for another RTP packet won't find a stale one...
+			for (size_t u32Offset(mU32Offset);  mpU32s  &&  u32Offset < mMaxU32s  &&  u32Offset < mU32Offset + 4;  u32Offset++)
+				mpU32s[u32Offset] = 0;
+			return AJA_STATUS_SUCCESS;
+		}
+
+	private:
+		AJAStatus	CloseRTPPacket (const bool inIsLast)
+		{
+			const size_t	totalRTPPktBytes	(AJARTPAncPayloadHeader::GetHeaderByteCount() + mPayloadU32s * sizeof(uint32_t));
+			mHeader.SetEndOfFieldOrFrame(inIsLast);
+			mHeader.SetAncPacketCount(uint8_t(mRTPAncCount));
+			mHeader.SetPayloadLength(uint16_t(mPayloadU32s * sizeof(uint32_t)));
+			//	Playout:  Firmware looks for full RTP pkt bytecount in LS 16 bits of SequenceNumber in RTP header:
+			mHeader.SetSequenceNumber(uint32_t(totalRTPPktBytes) & 0x0000FFFF);
+			if (mpU32s  &&  !mHeader.WriteToBuffer(mBuffer, ULWord(mRTPU32Offset)))
+				{LOGMYERROR("RTP hdr WriteToBuffer failed for buffer " << mBuffer << " at u32offset=" << DEC(mRTPU32Offset));  return AJA_STATUS_FAIL;}
+			LOGMYDEBUG("u32offset=" << xHEX0N(mRTPU32Offset,4) << ": " << mHeader);
+
+			//	IP Anc inserters expect subsequent RTP packets to start on a 64-bit/8-byte word boundary...
+			mU32Offset = mRTPU32Offset + AJARTPAncPayloadHeader::GetHeaderWordCount() + mPayloadU32s;
+			if (mU32Offset & 1)
+			{
+				if (mpU32s  &&  mU32Offset < mMaxU32s)
+					mpU32s[mU32Offset] = 0;
+				mU32Offset++;
+			}
+			mRTPU32Offset = mU32Offset;
+			mPayloadU32s = mRTPAncCount = 0;
+			mIsOpen = false;
+			return AJA_STATUS_SUCCESS;
+		}
+
+	private:
+		NTV2Buffer &			mBuffer;		//	Buffer being written (or NULL)
+		uint32_t *				mpU32s;			//	Buffer's host address (or NULL)
+		const size_t			mMaxU32s;		//	Buffer capacity, in U32s
+		const bool				mMultiRTP;		//	One RTP pkt per anc pkt?
+		bool					mIsOpen;		//	Current RTP pkt needs closing?
+		size_t					mU32Offset;		//	Offset just past the last closed RTP pkt, in U32s
+		size_t					mRTPU32Offset;	//	Offset of current RTP pkt's header, in U32s
+		size_t					mPayloadU32s;	//	Current RTP pkt's payload size, in U32s
+		uint32_t				mRTPAncCount;	//	Anc pkts in current RTP pkt
+		uint32_t				mAncCount;		//	Anc pkts in all RTP pkts
+		AJARTPAncPayloadHeader	mHeader;		//	Current RTP pkt's header
+};	//	RTPFieldWriter
+}	//	anonymous namespace
+
+
+AJAStatus AJAAncillaryList::WriteIPTransmitData (NTV2Buffer & F1Buffer, NTV2Buffer & F2Buffer,
+												uint32_t & outF1ByteCount, uint32_t & outF2ByteCount,
+												const bool inIsProgressive, const uint32_t inF2StartLine)
 {
+	RTPFieldWriter	F1Writer		(F1Buffer, /*isF2*/false, inIsProgressive, AllowMultiRTPTransmit());
+	RTPFieldWriter	F2Writer		(F2Buffer, /*isF2*/true, inIsProgressive, AllowMultiRTPTransmit());
+	AJAStatus		result			(AJA_STATUS_SUCCESS);
+	unsigned		countOverflows	(0);
+	size_t			overflowWords	(0);
 	outF1ByteCount = outF2ByteCount = 0;
 
-	//	Get F1 & F2 xmit RTP U32 words...
-	AJAU32Pkts		F1U32Pkts, F2U32Pkts;	//	U32 network-byte-order data
-	AJAAncPktCounts F1AncCounts, F2AncCounts;	//	Per-RTP packet anc packet counts
-	AJAStatus result (GetRTPPackets (F1U32Pkts, F2U32Pkts,	F1AncCounts, F2AncCounts,  inIsProgressive,	 inF2StartLine));
+	//	Write each of my digital packets straight into its field's buffer...
+	for (AJAAncDataListConstIter it(m_ancList.begin());	 it != m_ancList.end()	&&	AJA_SUCCESS(result);  ++it)
+	{
+		AJAAncillaryData *	pPkt	(*it);
+		if (!pPkt)
+			return AJA_STATUS_NULL; //	Fail
+		if (pPkt->GetDataCoding() != AJAAncDataCoding_Digital)
+			continue;	//	Skip analog/raw packets
+		if (inIsProgressive	 ||	 pPkt->GetLocationLineNumber() < inF2StartLine)
+			result = F1Writer.AddPacket (*pPkt, countOverflows, overflowWords);
+		else
+			result = F2Writer.AddPacket (*pPkt, countOverflows, overflowWords);
+	}	//	for each SMPTE Anc packet
 	if (AJA_FAILURE(result))
-		return result;
+		{LOGMYERROR(::AJAStatusToString(result) << ": failed writing RTP pkts");  return result;}
 
-	NTV2Buffer	nullBuffer; //	An empty buffer tells WriteRTPPackets to just calculate byteCount...
-	result = WriteRTPPackets (nullBuffer, outF1ByteCount, F1U32Pkts, F1AncCounts, /*isF2*/false, inIsProgressive);
+	result = F1Writer.Finish(outF1ByteCount);
 	if (AJA_SUCCESS(result)	 &&	 !inIsProgressive)
-		result = WriteRTPPackets (nullBuffer, outF2ByteCount, F2U32Pkts, F2AncCounts, /*isF2*/true, inIsProgressive);
+		result = F2Writer.Finish(outF2ByteCount);
 
+	if (overflowWords && countOverflows)
+		{LOGMYWARN("Overflow: " << DEC(countOverflows) << " pkts skipped, " << DEC(overflowWords) << " U32s dropped");}
+	else if (overflowWords)
+		{LOGMYWARN("Data overflow: " << DEC(overflowWords) << " U32s dropped");}
+	else if (countOverflows)
+		LOGMYWARN("Packet overflow: " << DEC(countOverflows) << " pkts skipped");
 	return result;
-}
+}	//	WriteIPTransmitData
 
 
 ostream & AJAAncillaryList::Print (ostream & inOutStream, const bool inDumpPayload) const
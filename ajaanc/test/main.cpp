@@ -2471,6 +2471,337 @@ LOGMYDEBUG("BFT_AncListToRTPToAncList: IPF1bytes=" << DEC(IPF1bytes) << ", IPF2b
 		}	//	TEST_CASE("BFT_RTPXmitTooMuchData")
 
 
+		//	Exposes the (protected) AJAU32Pkts-based RTP encoder for comparison...
+		class RTPEncoderTestList : public AJAAncillaryList
+		{
+			public:
+				using AJAAncillaryList::GetRTPPackets;
+				using AJAAncillaryList::WriteRTPPackets;
+		};
+
+		TEST_CASE("BFT_RTPWriteInPlace")
+		{
+			//	Validates that WriteIPTransmitData & AddReceivedRTPData produce/consume exactly the same RTP data as
+			//	GetRTPPackets + WriteRTPPackets, including data counts whose packed 10-bit words exactly fill their U32s...
+			AJAAncillaryData::ResetInstanceCounts();
+			std::mt19937 gen(0x2110);
+			std::uniform_int_distribution<> distrib(0, 255);
+			for (unsigned multiRTP(0);  multiRTP < 2;  multiRTP++)
+				for (unsigned progressive(0);  progressive < 2;  progressive++)
+			{
+				const bool		isProgressive	(progressive ? true : false);
+				const uint32_t	F2StartLine		(isProgressive ? 0 : 563);
+				RTPEncoderTestList	txPkts;
+				txPkts.SetAllowMultiRTPTransmit(multiRTP ? true : false);
+				static const uint32_t	sDCs[]	=	{1, 2, 12, 28, 44, 60, 76, 100, 223, 255};
+				for (unsigned pktNum(0);  pktNum < 200;  pktNum++)
+				{
+					AJAAncillaryData	pkt;
+					AJAAncDataLoc		loc;
+					loc.SetDataLink(AJAAncDataLink_A).SetDataStream(AJAAncDataStream_1)
+						.SetDataChannel(pktNum & 1 ? AJAAncDataChannel_C : AJAAncDataChannel_Y)
+						.SetLineNumber(UWord(pktNum & 2 ? 9 + pktNum % 11 : 570 + pktNum % 13)).SetHorizontalOffset(AJAAncDataHorizOffset_AnyVanc);
+					pkt.SetDataLocation(loc);
+					pkt.SetDataCoding(AJAAncDataCoding_Digital);
+					pkt.SetDID(uint8_t(distrib(gen)));
+					pkt.SetSID(uint8_t(distrib(gen)));
+					const uint32_t	dc	(pktNum < 10 ? sDCs[pktNum] : uint32_t(distrib(gen) % 255 + 1));	//	Zero-length pkts aren't received
+					vector<uint8_t>	payload;
+					while (payload.size() < dc)
+						payload.push_back(uint8_t(distrib(gen)));
+					if (dc)
+						CHECK(AJA_SUCCESS(pkt.SetPayloadData(&payload[0], dc)));
+					CHECK(AJA_SUCCESS(txPkts.AddAncillaryData(pkt)));
+				}
+				txPkts.SortListByLocation();
+
+				//	Old way:  via AJAU32Pkts...
+				AJAU32Pkts		F1U32Pkts, F2U32Pkts;
+				AJAAncPktCounts F1AncCounts, F2AncCounts;
+				NTV2Buffer		F1a(128*1024), F2a(128*1024);
+				uint32_t		F1aBytes(0), F2aBytes(0);
+				CHECK(AJA_SUCCESS(txPkts.GetRTPPackets(F1U32Pkts, F2U32Pkts, F1AncCounts, F2AncCounts, isProgressive, F2StartLine)));
+				CHECK(AJA_SUCCESS(RTPEncoderTestList::WriteRTPPackets(F1a, F1aBytes, F1U32Pkts, F1AncCounts, false, isProgressive)));
+				if (!isProgressive)
+					CHECK(AJA_SUCCESS(RTPEncoderTestList::WriteRTPPackets(F2a, F2aBytes, F2U32Pkts, F2AncCounts, true, isProgressive)));
+
+				//	New way:  precompute the sizes, then write straight into caller-provided memory...
+				uint32_t	F1bBytes(0), F2bBytes(0);
+				CHECK(AJA_SUCCESS(txPkts.GetIPTransmitDataLength(F1bBytes, F2bBytes, isProgressive, F2StartLine)));
+				CHECK_EQ(F1bBytes, F1aBytes);
+				CHECK_EQ(F2bBytes, F2aBytes);
+				vector<uint32_t>	F1Mem(F1bBytes / 4 + 1, 0xFFFFFFFF), F2Mem(F2bBytes / 4 + 1, 0xFFFFFFFF);
+				NTV2Buffer	F1b(&F1Mem[0], F1bBytes), F2b(&F2Mem[0], F2bBytes);	//	Exact fit, no copy
+				CHECK(AJA_SUCCESS(txPkts.WriteIPTransmitData(F1b, F2b, F1bBytes, F2bBytes, isProgressive, F2StartLine)));
+				CHECK_EQ(F1bBytes, F1aBytes);
+				CHECK_EQ(F2bBytes, F2aBytes);
+				CHECK_EQ(::memcmp(F1a.GetHostPointer(), &F1Mem[0], F1aBytes), 0);
+				if (F2aBytes)
+					CHECK_EQ(::memcmp(F2a.GetHostPointer(), &F2Mem[0], F2aBytes), 0);
+				CHECK_EQ(F1Mem.back(), 0xFFFFFFFF);	//	Nothing written past the end of the buffer
+
+				//	Too small a buffer must fail...
+				if (F1aBytes > 24)
+				{
+					NTV2Buffer	tooSmall(&F1Mem[0], F1aBytes - 8);
+					uint32_t	dummy(0);
+					CHECK(AJA_FAILURE(txPkts.WriteIPTransmitData(tooSmall, F2b, dummy, dummy, isProgressive, F2StartLine)));
+				}
+
+				//	Parse straight from the written memory, and compare with the transmitted packets...
+				AJAAncillaryList	rxPkts;
+				rxPkts.SetAllowMultiRTPReceive(multiRTP ? true : false);
+				CHECK(AJA_SUCCESS(rxPkts.AddReceivedRTPData(NTV2Buffer(&F1Mem[0], F1aBytes))));
+				if (!isProgressive)
+					CHECK(AJA_SUCCESS(rxPkts.AddReceivedRTPData(NTV2Buffer(&F2Mem[0], F2aBytes))));
+				CHECK_EQ(rxPkts.CountAncillaryData(), 200);	//	All packets fit (under 255 pkts & 64KB per field)
+				const string	cmpInfo	(txPkts.CompareWithInfo(rxPkts, /*ignoreLocation*/false, /*ignoreChecksum*/true));
+				if (!cmpInfo.empty())
+					LOGMYWARN("BFT_RTPWriteInPlace: " << cmpInfo);
+				CHECK(cmpInfo.empty());
+
+				if (gIsVerbose)
+				{
+					AJAPerformance	perfOld("RTPXmitOld"), perfNew("RTPXmitNew"), perfRcv("RTPRcvInPlace");
+					for (unsigned tripNum(0);  tripNum < 100;  tripNum++)
+					{
+						perfOld.Start();
+						txPkts.GetRTPPackets(F1U32Pkts, F2U32Pkts, F1AncCounts, F2AncCounts, isProgressive, F2StartLine);
+						RTPEncoderTestList::WriteRTPPackets(F1a, F1aBytes, F1U32Pkts, F1AncCounts, false, isProgressive);
+						RTPEncoderTestList::WriteRTPPackets(F2a, F2aBytes, F2U32Pkts, F2AncCounts, true, isProgressive);
+						perfOld.Stop();
+						perfNew.Start();
+						txPkts.WriteIPTransmitData(F1b, F2b, F1bBytes, F2bBytes, isProgressive, F2StartLine);
+						perfNew.Stop();
+						AJAAncillaryList	pkts;
+						perfRcv.Start();
+						pkts.AddReceivedRTPData(F1b);
+						perfRcv.Stop();
+					}
+					perfOld.Report();	perfNew.Report();	perfRcv.Report();
+				}
+			}	//	for multiRTP & progressive
+			DBG_CHECK_EQ(AJAAncillaryData::GetNumActiveInstances(), 0);
+		}	//	TEST_CASE("BFT_RTPWriteInPlace")
+
+
+		//	Writes 'v210' VANC the way GetVANCTransmitData used to:  for each packet, unpack the whole line, patch it, then repack it...
+		static bool LegacyV210VANCTransmit (AJAAncillaryList & inPkts, NTV2Buffer & inFB, const NTV2FormatDescriptor & inFD)
+		{
+			for (UWord lineOffset(0);  lineOffset < inFD.GetFirstActiveLine();  lineOffset++)
+			{
+				ULWord	smpteLine(0);	bool isF2(false);
+				inFD.GetSMPTELineNumber (lineOffset, smpteLine, isF2);
+				for (uint32_t ndx(0);  ndx < inPkts.CountAncillaryData();  ndx++)
+				{
+					AJAAncillaryData &	pkt	(*inPkts.GetAncillaryDataAtIndex(ndx));
+					UWordSequence		comps, line;
+					if (!pkt.IsDigital()  ||  !pkt.IsVanc()  ||  pkt.GetLocationLineNumber() != smpteLine)
+						continue;
+					if (AJA_FAILURE(pkt.GenerateTransmitData(comps)))
+						return false;
+					if (inFD.IsSD())
+						line = comps;
+					else if (::UnpackLine_10BitYUVtoU16s (line, inFB, inFD, lineOffset))
+						for (size_t n(0);  n < comps.size();  n++)
+							line[(pkt.GetDataLocation().IsLumaChannel() ? 1 : 0) + 2*n] = comps[n] & 0x3FF;
+					else
+						return false;
+					while (line.size() < 12  ||  line.size() % 12)
+						line.push_back(0x040);
+					if (!::YUVComponentsTo10BitYUVPackedBuffer (line, inFB, inFD, lineOffset))
+						return false;
+				}	//	for each packet
+			}	//	for each VANC line
+			return true;
+		}
+
+
+		TEST_CASE("BFT_VANCSIMD")
+		{
+			//	Validates that the SSE2 VANC kernels produce exactly the same results as the scalar ones, and that in-place
+			//	'v210' VANC writes match the original unpack/patch/repack method...
+			AJAAncillaryData::ResetInstanceCounts();
+			const bool	wasUsingSIMD	(AJAAncillaryData::IsUsingSIMD());
+			std::mt19937 gen(0x0291);
+			std::uniform_int_distribution<> distrib(0, 255);
+
+			//	Bulk parity generation...
+			{
+				vector<uint8_t>		bytes;
+				vector<uint16_t>	simdWords(300), scalarWords(300);
+				for (unsigned n(0);  n < 300;  n++)
+					bytes.push_back(uint8_t(n < 256 ? n : distrib(gen)));
+				for (size_t count(0);  count <= bytes.size();  count += 13)
+				{
+					AJAAncillaryData::SetUseSIMD(true);
+					const uint16_t	simdSum		(AJAAncillaryData::AddEvenParity(&bytes[0], &simdWords[0], count));
+					AJAAncillaryData::SetUseSIMD(false);
+					const uint16_t	scalarSum	(AJAAncillaryData::AddEvenParity(&bytes[0], &scalarWords[0], count));
+					uint16_t		sum			(0);
+					for (size_t n(0);  n < count;  n++)
+					{
+						CHECK_EQ(simdWords[n], AJAAncillaryData::AddEvenParity(bytes[n]));
+						sum += AJAAncillaryData::AddEvenParity(bytes[n]) & 0x1FF;
+					}
+					CHECK_EQ(simdSum, sum & 0x1FF);
+					CHECK_EQ(scalarSum, sum & 0x1FF);
+					CHECK(simdWords == scalarWords);
+				}
+			}
+
+			//	10-bit line unpacking, for line lengths that do and don't fill whole SSE2 iterations...
+			for (ULWord numU32s(1);  numU32s < 40;  numU32s++)
+			{
+				vector<ULWord>	packed;
+				UWordSequence	ref, simd, scalar;
+				for (ULWord n(0);  n < numU32s;  n++)
+					packed.push_back(ULWord(distrib(gen)) << 24 ^ ULWord(distrib(gen)) << 16 ^ ULWord(distrib(gen)) << 8 ^ ULWord(distrib(gen)));
+				AJAAncillaryData::SetUseSIMD(true);
+				CHECK(AJAAncillaryData::Unpack10BitYCbCrToU16sVANCLine(&packed[0], simd, numU32s));
+				AJAAncillaryData::SetUseSIMD(false);
+				CHECK(AJAAncillaryData::Unpack10BitYCbCrToU16sVANCLine(&packed[0], scalar, numU32s));
+				CHECK(simd == scalar);
+				CHECK_EQ(simd.size(), size_t(numU32s * 3));
+				if (numU32s % 4 == 0)	//	Whole 6-pixel groups
+				{
+					CHECK(::UnpackLine_10BitYUVtoUWordSequence (&packed[0], ref, numU32s / 4 * 6));
+					CHECK(simd == ref);
+				}
+			}
+
+			//	Packet search, with good and bad (parity or checksum) packets at arbitrary offsets in both channels...
+			for (unsigned trial(0);  trial < 200;  trial++)
+			{
+				UWordSequence	line;
+				while (line.size() < size_t(100 + distrib(gen) * 4))
+					line.push_back(UWord(distrib(gen) * 4 + (trial & 3)));
+				for (unsigned pktNum(0);  pktNum < 4;  pktNum++)
+				{
+					AJAAncillaryData	pkt;
+					UWordSequence		comps;
+					vector<uint8_t>		payload;
+					while (payload.size() < size_t(distrib(gen) % 40 + 1))
+						payload.push_back(uint8_t(distrib(gen)));
+					pkt.SetDID(uint8_t(distrib(gen)));	pkt.SetSID(uint8_t(distrib(gen)));
+					pkt.SetPayloadData(&payload[0], uint32_t(payload.size()));
+					CHECK(AJA_SUCCESS(pkt.GenerateTransmitData(comps)));
+					if (pktNum == 3  &&  trial & 1)
+						comps.at(6 + distrib(gen) % payload.size()) ^= (trial & 2) ? 0x100 : 0x001;	//	Bad parity or bad checksum
+					const size_t	incr	(pktNum & 1 ? 2 : 1);
+					const size_t	offset	(size_t(distrib(gen)) * 4 % line.size());
+					for (size_t n(0);  n < comps.size()  &&  offset + n * incr < line.size();  n++)
+						line[offset + n * incr] = comps[n];
+				}
+				for (unsigned chan(AncChannelSearch_Y);  chan <= AncChannelSearch_Both;  chan++)
+				{
+					AJAAncillaryData::U16Packets	simdPkts, scalarPkts;
+					UWordSequence					simdOffsets, scalarOffsets;
+					AJAAncillaryData::SetUseSIMD(true);
+					const bool	simdOK		(AJAAncillaryData::GetAncPacketsFromVANCLine(line, AncChannelSearchSelect(chan), simdPkts, simdOffsets));
+					AJAAncillaryData::SetUseSIMD(false);
+					const bool	scalarOK	(AJAAncillaryData::GetAncPacketsFromVANCLine(line, AncChannelSearchSelect(chan), scalarPkts, scalarOffsets));
+					CHECK_EQ(simdOK, scalarOK);
+					CHECK(simdPkts == scalarPkts);
+					CHECK(simdOffsets == scalarOffsets);
+				}
+			}
+
+			//	Whole-frame tall VANC encode & decode, 8-bit and 10-bit...
+			const NTV2VideoFormat	vFormats[]	=	{NTV2_FORMAT_525_5994, NTV2_FORMAT_720p_5994, NTV2_FORMAT_1080i_5994, NTV2_FORMAT_1080p_3000};
+			const NTV2PixelFormat	pFormats[]	=	{NTV2_FBF_10BIT_YCBCR, NTV2_FBF_8BIT_YCBCR};
+			for (size_t vfNdx(0);  vfNdx < sizeof(vFormats)/sizeof(NTV2VideoFormat);  vfNdx++)
+				for (size_t pfNdx(0);  pfNdx < sizeof(pFormats)/sizeof(NTV2PixelFormat);  pfNdx++)
+			{
+				const NTV2FormatDescriptor	fd	(vFormats[vfNdx], pFormats[pfNdx], NTV2_VANCMODE_TALL);
+				if (!fd.IsValid()  ||  !fd.IsVANC())
+					continue;
+				if (gIsVerbose)	cerr << "BFT_VANCSIMD: " << fd << endl;
+				AJAAncillaryList	txPkts;
+				for (UWord lineOffset(0);  lineOffset < fd.GetFirstActiveLine();  lineOffset++)
+				{
+					ULWord	smpteLine(0);	bool isF2(false);
+					fd.GetSMPTELineNumber (lineOffset, smpteLine, isF2);
+					for (unsigned chan(0);  chan < (fd.IsSD() ? 1U : 2U);  chan++)
+					{
+						if (lineOffset % 3 == 2)
+							continue;	//	Leave some lines empty
+						AJAAncillaryData	pkt;
+						AJAAncDataLoc		loc	(AJAAncDataLink_A, fd.IsSD() ? AJAAncDataChannel_Both : (chan ? AJAAncDataChannel_Y : AJAAncDataChannel_C),
+												AJAAncDataSpace_VANC, uint16_t(smpteLine), AJAAncDataHorizOffset_AnyVanc);
+						vector<uint8_t>		payload;
+						while (payload.size() < size_t(distrib(gen) % 255 + 1))
+							payload.push_back(uint8_t(distrib(gen)));
+						pkt.SetDataLocation(loc);
+						pkt.SetDataCoding(AJAAncDataCoding_Digital);
+						pkt.SetDID(uint8_t(distrib(gen) | 0x40));	pkt.SetSID(uint8_t(distrib(gen)));
+						pkt.SetPayloadData(&payload[0], uint32_t(payload.size()));
+						CHECK(AJA_SUCCESS(txPkts.AddAncillaryData(pkt)));
+					}
+				}
+
+				NTV2Buffer	background	(fd.GetTotalRasterBytes()),  simdFB, scalarFB, legacyFB;
+				for (ULWord n(0);  n < background.GetByteCount() / 4;  n++)	//	Non-black background
+					background.U32(int(n)) = (ULWord(distrib(gen)) << 22 ^ ULWord(distrib(gen)) << 14 ^ ULWord(distrib(gen)) << 6 ^ ULWord(distrib(gen))) & 0x3FFFFFFF;
+				simdFB = background;	scalarFB = background;	legacyFB = background;
+				AJAAncillaryData::SetUseSIMD(true);
+				CHECK(AJA_SUCCESS(txPkts.GetVANCTransmitData(simdFB, fd)));
+				AJAAncillaryData::SetUseSIMD(false);
+				CHECK(AJA_SUCCESS(txPkts.GetVANCTransmitData(scalarFB, fd)));
+				CHECK_EQ(::memcmp(simdFB.GetHostPointer(), scalarFB.GetHostPointer(), simdFB.GetByteCount()), 0);
+				if (fd.GetPixelFormat() == NTV2_FBF_10BIT_YCBCR)
+				{
+					CHECK(LegacyV210VANCTransmit(txPkts, legacyFB, fd));
+					CHECK_EQ(::memcmp(simdFB.GetHostPointer(), legacyFB.GetHostPointer(), simdFB.GetByteCount()), 0);
+				}
+
+				AJAAncillaryList	simdPkts, scalarPkts;
+				AJAAncillaryData::SetUseSIMD(true);
+				CHECK(AJA_SUCCESS(AJAAncillaryList::SetFromVANCData(simdFB, fd, simdPkts)));
+				AJAAncillaryData::SetUseSIMD(false);
+				CHECK(AJA_SUCCESS(AJAAncillaryList::SetFromVANCData(simdFB, fd, scalarPkts)));
+				CHECK_EQ(simdPkts.CountAncillaryData(), txPkts.CountAncillaryData());
+				string	cmpInfo	(simdPkts.CompareWithInfo(scalarPkts, false/*ignoreLocation*/, false/*ignoreChecksum*/));
+				if (!cmpInfo.empty())
+					LOGMYWARN("BFT_VANCSIMD: " << cmpInfo);
+				CHECK(cmpInfo.empty());
+				simdPkts.SortListByLocation();	//	txPkts were sorted by GetVANCTransmitData
+				cmpInfo = simdPkts.CompareWithInfo(txPkts, true/*ignoreLocation*/, true/*ignoreChecksum*/);
+				if (!cmpInfo.empty())
+					LOGMYWARN("BFT_VANCSIMD: " << cmpInfo);
+				CHECK(cmpInfo.empty());
+
+				if (gIsVerbose)
+				{
+					AJAPerformance	perfXmtLegacy("VANCXmitLegacy", AJATimerPrecisionMicroseconds), perfXmtScalar("VANCXmitScalar", AJATimerPrecisionMicroseconds),
+									perfXmtSIMD("VANCXmitSSE2", AJATimerPrecisionMicroseconds), perfRcvScalar("VANCRcvScalar", AJATimerPrecisionMicroseconds),
+									perfRcvSIMD("VANCRcvSSE2", AJATimerPrecisionMicroseconds);
+					for (unsigned tripNum(0);  tripNum < 50;  tripNum++)
+					{
+						AJAAncillaryList	pkts;
+						if (fd.GetPixelFormat() == NTV2_FBF_10BIT_YCBCR)
+						{
+							perfXmtLegacy.Start();	LegacyV210VANCTransmit(txPkts, legacyFB, fd);	perfXmtLegacy.Stop();
+						}
+						AJAAncillaryData::SetUseSIMD(false);
+						perfXmtScalar.Start();	txPkts.GetVANCTransmitData(scalarFB, fd);				perfXmtScalar.Stop();
+						perfRcvScalar.Start();	AJAAncillaryList::SetFromVANCData(simdFB, fd, pkts);	perfRcvScalar.Stop();
+						AJAAncillaryData::SetUseSIMD(true);
+						perfXmtSIMD.Start();	txPkts.GetVANCTransmitData(simdFB, fd);					perfXmtSIMD.Stop();
+						perfRcvSIMD.Start();	AJAAncillaryList::SetFromVANCData(simdFB, fd, pkts);	perfRcvSIMD.Stop();
+					}
+					if (fd.GetPixelFormat() == NTV2_FBF_10BIT_YCBCR)
+						perfXmtLegacy.Report();
+					perfXmtScalar.Report();	perfXmtSIMD.Report();	perfRcvScalar.Report();	perfRcvSIMD.Report();
+					cerr << "BFT_VANCSIMD mean usec: xmit legacy=" << perfXmtLegacy.Mean() << " scalar=" << perfXmtScalar.Mean() << " SSE2=" << perfXmtSIMD.Mean()
+						<< ", rcv scalar=" << perfRcvScalar.Mean() << " SSE2=" << perfRcvSIMD.Mean() << endl;
+				}
+			}	//	for each video & pixel format
+			AJAAncillaryData::SetUseSIMD(wasUsingSIMD);
+			DBG_CHECK_EQ(AJAAncillaryData::GetNumActiveInstances(), 0);
+		}	//	TEST_CASE("BFT_VANCSIMD")
+
+
 		TEST_CASE("BFT_AncListToFBYUV8ToAncList")
 		{
 			const NTV2VideoFormat	vFormats[]	=	{/*NTV2_FORMAT_525_5994, NTV2_FORMAT_625_5000,*/ NTV2_FORMAT_720p_5994, NTV2_FORMAT_1080i_5994, NTV2_FORMAT_1080p_3000};
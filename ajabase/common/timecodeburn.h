@@ -14,6 +14,7 @@
 
 /**
  *	Class to support burning a simple timecode over raster.
+ *	@note	NTV2TimeCodeBurner (in ajantv2) does the same for every NTV2PixelFormat, using pre-rendered glyphs.
  *	@ingroup AJATimeCodeBurn
  */
 class AJATimeCodeBurn
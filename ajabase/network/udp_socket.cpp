@@ -13,6 +13,11 @@
 #include <errno.h>
 #include <string.h>
 #include <iostream>
+#if defined(AJA_LINUX)
+#include <linux/errqueue.h>
+#include <linux/net_tstamp.h>
+#include <time.h>
+#endif
 
 using std::cout;
 using std::cerr;
@@ -25,14 +30,181 @@ using std::string;
 /////////////////////////////
 #define DEBUG_UDP_OPERATION	  0
 
+#if defined(AJA_LINUX)
+	// recvmmsg/sendmmsg & SO_TIMESTAMPING are available
+#	define AJA_UDP_MMSG			  1
+#	define UDP_CONTROL_SIZE		  CMSG_SPACE(sizeof(struct scm_timestamping))
+#endif
+
 
 /////////////////////////////
 // Definitions
 /////////////////////////////
+///////////////////////////////////////////////////////////
+//
+///////////////////////////////////////////////////////////
+AJAUDPPacketBatch::AJAUDPPacketBatch(uint32_t maxPackets, uint32_t maxPacketSize)
+{
+	mMaxPackets	   = 0;
+	mMaxPacketSize = 0;
+	mCount		   = 0;
+	Allocate(maxPackets, maxPacketSize);
+}
+
+
+///////////////////////////////////////////////////////////
+//
+///////////////////////////////////////////////////////////
+AJAUDPPacketBatch::~AJAUDPPacketBatch(void)
+{
+}
+
+
+///////////////////////////////////////////////////////////
+//
+///////////////////////////////////////////////////////////
+bool
+AJAUDPPacketBatch::Allocate(uint32_t maxPackets, uint32_t maxPacketSize)
+{
+	struct sockaddr_in noAddress;
+	memset(&noAddress, 0, sizeof(noAddress));
+
+	mCount = 0;
+	bool ok = maxPackets && maxPacketSize;	//	Empty datagram slots are useless
+	if (ok)
+	{
+		try
+		{
+			mStorage.assign(size_t(maxPackets) * size_t(maxPacketSize), 0);
+			mLengths.assign(maxPackets, 0);
+			mAddresses.assign(maxPackets, noAddress);
+			mTimestamps.assign(maxPackets, 0);
+			mTruncated.assign(maxPackets, 0);
+#if defined(AJA_UDP_MMSG)
+			mMessages.assign(size_t(maxPackets) * (sizeof(struct mmsghdr) + sizeof(struct iovec)), 0);
+			mControl.assign(size_t(maxPackets) * UDP_CONTROL_SIZE, 0);
+#endif
+		}
+		catch (...)
+		{
+			ok = false;
+		}
+	}
+	if (!ok)
+	{
+		mMaxPackets = mMaxPacketSize = 0;
+		mStorage.clear();  mLengths.clear();  mAddresses.clear();  mTimestamps.clear();
+		mTruncated.clear();  mMessages.clear();  mControl.clear();
+		return false;
+	}
+	mMaxPackets	   = maxPackets;
+	mMaxPacketSize = maxPacketSize;
+	return true;
+}
+
+
+///////////////////////////////////////////////////////////
+//
+///////////////////////////////////////////////////////////
+bool
+AJAUDPPacketBatch::SetCount(uint32_t count)
+{
+	if (count > mMaxPackets)
+		return false;
+	mCount = count;
+	return true;
+}
+
+
+///////////////////////////////////////////////////////////
+//
+///////////////////////////////////////////////////////////
+bool
+AJAUDPPacketBatch::Add(const uint8_t* pData, uint32_t dataLength, const struct sockaddr_in& targetAddress)
+{
+	if (IsFull() || dataLength > mMaxPacketSize || (dataLength && !pData))
+		return false;
+	if (dataLength)
+		memcpy(Data(mCount), pData, dataLength);
+	mLengths[mCount]	= dataLength;
+	mAddresses[mCount]	= targetAddress;
+	mTimestamps[mCount] = 0;
+	mTruncated[mCount]	= 0;
+	mCount++;
+	return true;
+}
+
+
+///////////////////////////////////////////////////////////
+//
+///////////////////////////////////////////////////////////
+uint8_t*
+AJAUDPPacketBatch::Data(uint32_t index)
+{
+	return index < mMaxPackets ? &mStorage[size_t(index) * mMaxPacketSize] : NULL;
+}
+
+
+const uint8_t*
+AJAUDPPacketBatch::Data(uint32_t index) const
+{
+	return index < mMaxPackets ? &mStorage[size_t(index) * mMaxPacketSize] : NULL;
+}
+
+
+uint32_t
+AJAUDPPacketBatch::Length(uint32_t index) const
+{
+	return index < mMaxPackets ? mLengths[index] : 0;
+}
+
+
+bool
+AJAUDPPacketBatch::SetLength(uint32_t index, uint32_t dataLength)
+{
+	if (index >= mMaxPackets || dataLength > mMaxPacketSize)
+		return false;
+	mLengths[index] = dataLength;
+	return true;
+}
+
+
+const struct sockaddr_in*
+AJAUDPPacketBatch::Address(uint32_t index) const
+{
+	return index < mMaxPackets ? &mAddresses[index] : NULL;
+}
+
+
+bool
+AJAUDPPacketBatch::SetAddress(uint32_t index, const struct sockaddr_in& address)
+{
+	if (index >= mMaxPackets)
+		return false;
+	mAddresses[index] = address;
+	return true;
+}
+
+
+uint64_t
+AJAUDPPacketBatch::Timestamp(uint32_t index) const
+{
+	return index < mMaxPackets ? mTimestamps[index] : 0;
+}
+
+
+bool
+AJAUDPPacketBatch::IsTruncated(uint32_t index) const
+{
+	return index < mMaxPackets ? mTruncated[index] != 0 : false;
+}
+
+
 ///////////////////////////////////////////////////////////
 //
 ///////////////////////////////////////////////////////////
 AJAUDPSocket::AJAUDPSocket(void)
+	:	mTimestamping(false)
 {
 }
 
@@ -56,6 +228,7 @@ AJAUDPSocket::Open(const string& ipAddress, uint16_t port)
 #else
 	if ((true == IsInstantiated()) && (-1 == mSocket))
 	{
+		mTimestamping = false;
 		if (-1 != (mSocket = (int) socket(AF_INET, SOCK_DGRAM, 0)))
 		{
 			if (0 == ipAddress.length())
@@ -264,3 +437,234 @@ AJAUDPSocket::Write(
 	return uint32_t(bytesSent);
 #endif
 }
+
+
+///////////////////////////////////////////////////////////
+//
+///////////////////////////////////////////////////////////
+uint32_t
+AJAUDPSocket::ReadBatch(AJAUDPPacketBatch& batch, int timeout)
+{
+	batch.Clear();
+#if defined(AJA_BAREMETAL)
+	AJA_UNUSED(timeout);
+	return 0;
+#else
+	if ((-1 == mSocket) || (0 == batch.MaxPackets()))
+	{
+		return 0;
+	}
+
+#if defined(AJA_UDP_MMSG)
+	struct pollfd fds[1];
+	fds[0].fd	   = mSocket;
+	fds[0].events  = POLLIN;
+	fds[0].revents = 0;
+
+	int retVal = poll(fds, 1, timeout);
+	if (0 >= retVal)
+	{
+		if (0 != retVal)
+		{
+			AJA_REPORT(
+				0,
+				AJA_DebugSeverity_Error,
+				"AJAUDPSocket::ReadBatch poll failed (errno:%d)",
+				errno);
+		}
+		return 0;
+	}
+
+	// Point each message at its own slot in the batch's storage...
+	struct mmsghdr* pMessages = reinterpret_cast<struct mmsghdr*>(&batch.mMessages[0]);
+	struct iovec*	pIOVecs	  = reinterpret_cast<struct iovec*>(pMessages + batch.mMaxPackets);
+	for (uint32_t ndx = 0; ndx < batch.mMaxPackets; ndx++)
+	{
+		struct msghdr& header = pMessages[ndx].msg_hdr;
+		pIOVecs[ndx].iov_base = batch.Data(ndx);
+		pIOVecs[ndx].iov_len  = batch.mMaxPacketSize;
+		header.msg_name		  = &batch.mAddresses[ndx];
+		header.msg_namelen	  = sizeof(struct sockaddr_in);
+		header.msg_iov		  = &pIOVecs[ndx];
+		header.msg_iovlen	  = 1;
+		header.msg_control	  = mTimestamping ? &batch.mControl[ndx * UDP_CONTROL_SIZE] : NULL;
+		header.msg_controllen = mTimestamping ? UDP_CONTROL_SIZE : 0;
+		header.msg_flags	  = 0;
+		pMessages[ndx].msg_len = 0;
+	}
+
+	// ...then take everything that's waiting, up to the batch size, in one call
+	retVal = recvmmsg(mSocket, pMessages, batch.mMaxPackets, MSG_DONTWAIT, NULL);
+	if (0 > retVal)
+	{
+		if ((EAGAIN != errno) && (EWOULDBLOCK != errno))
+		{
+			AJA_REPORT(
+				0,
+				AJA_DebugSeverity_Error,
+				"AJAUDPSocket::ReadBatch failed (errno:%d)",
+				errno);
+#if DEBUG_UDP_OPERATION
+			cerr << __FUNCTION__
+				<< ": recvmmsg errno:"
+				<< errno
+				<< endl;
+#endif
+		}
+		return 0;
+	}
+
+	for (uint32_t ndx = 0; ndx < uint32_t(retVal); ndx++)
+	{
+		struct msghdr& header	= pMessages[ndx].msg_hdr;
+		batch.mLengths[ndx]		= pMessages[ndx].msg_len;
+		batch.mTruncated[ndx]	= (header.msg_flags & MSG_TRUNC) ? 1 : 0;
+		batch.mTimestamps[ndx]	= 0;
+		if (!mTimestamping)
+		{
+			continue;
+		}
+		for (struct cmsghdr* pCmsg = CMSG_FIRSTHDR(&header); pCmsg; pCmsg = CMSG_NXTHDR(&header, pCmsg))
+		{
+			if ((SOL_SOCKET == pCmsg->cmsg_level) && (SCM_TIMESTAMPING == pCmsg->cmsg_type))
+			{
+				// ts[0] is the kernel software timestamp, ts[2] the raw hardware timestamp (if any)
+				struct scm_timestamping stamps;
+				memcpy(&stamps, CMSG_DATA(pCmsg), sizeof(stamps));
+				const struct timespec& ts = (stamps.ts[2].tv_sec || stamps.ts[2].tv_nsec) ? stamps.ts[2] : stamps.ts[0];
+				batch.mTimestamps[ndx]	  = uint64_t(ts.tv_sec) * 1000000000ULL + uint64_t(ts.tv_nsec);
+			}
+		}
+	}
+	batch.mCount = uint32_t(retVal);
+#else
+	// One datagram at a time:  wait for the first, then take whatever else is already waiting
+	while (!batch.IsFull())
+	{
+		const uint32_t ndx	 = batch.mCount;
+		const uint32_t bytes = Poll(batch.Data(ndx), batch.mMaxPacketSize, batch.mAddresses[ndx], ndx ? 0 : timeout);
+		if ((0 == bytes) || (bytes > batch.mMaxPacketSize))
+		{
+			break;
+		}
+		batch.mLengths[ndx]	   = bytes;
+		batch.mTruncated[ndx]  = 0;
+		batch.mTimestamps[ndx] = 0;
+		batch.mCount++;
+	}
+#endif
+	return batch.mCount;
+#endif
+}
+
+
+///////////////////////////////////////////////////////////
+//
+///////////////////////////////////////////////////////////
+uint32_t
+AJAUDPSocket::WriteBatch(AJAUDPPacketBatch& batch)
+{
+#if defined(AJA_BAREMETAL)
+	AJA_UNUSED(batch);
+	return 0;
+#else
+	uint32_t sent = 0;
+
+	if (-1 == mSocket)
+	{
+		return 0;
+	}
+
+#if defined(AJA_UDP_MMSG)
+	struct mmsghdr* pMessages = batch.mMaxPackets ? reinterpret_cast<struct mmsghdr*>(&batch.mMessages[0]) : NULL;
+	struct iovec*	pIOVecs	  = pMessages ? reinterpret_cast<struct iovec*>(pMessages + batch.mMaxPackets) : NULL;
+	for (uint32_t ndx = 0; ndx < batch.mCount; ndx++)
+	{
+		struct msghdr& header = pMessages[ndx].msg_hdr;
+		pIOVecs[ndx].iov_base = batch.Data(ndx);
+		pIOVecs[ndx].iov_len  = batch.mLengths[ndx];
+		header.msg_name		  = &batch.mAddresses[ndx];
+		header.msg_namelen	  = sizeof(struct sockaddr_in);
+		header.msg_iov		  = &pIOVecs[ndx];
+		header.msg_iovlen	  = 1;
+		header.msg_control	  = NULL;
+		header.msg_controllen = 0;
+		header.msg_flags	  = 0;
+		pMessages[ndx].msg_len = 0;
+	}
+
+	// sendmmsg may send fewer than requested, so keep going until done (or an error)
+	while (sent < batch.mCount)
+	{
+		const int retVal = sendmmsg(mSocket, pMessages + sent, batch.mCount - sent, 0);
+		if (0 >= retVal)
+		{
+			AJA_REPORT(
+				0,
+				AJA_DebugSeverity_Error,
+				"AJAUDPSocket::WriteBatch failed after %u of %u datagrams (errno:%d)",
+				sent,
+				batch.mCount,
+				errno);
+#if DEBUG_UDP_OPERATION
+			cerr << __FUNCTION__
+				<< ": sendmmsg errno:"
+				<< errno
+				<< endl;
+#endif
+			break;
+		}
+		sent += uint32_t(retVal);
+	}
+#else
+	for (; sent < batch.mCount; sent++)
+	{
+		if (Write(batch.Data(sent), batch.mLengths[sent], batch.mAddresses[sent]) != batch.mLengths[sent])
+		{
+			break;
+		}
+	}
+#endif
+	return sent;
+#endif
+}
+
+
+///////////////////////////////////////////////////////////
+//
+///////////////////////////////////////////////////////////
+bool
+AJAUDPSocket::EnableReceiveTimestamps(bool enable, bool hardware)
+{
+#if defined(AJA_UDP_MMSG)
+	if (-1 == mSocket)
+	{
+		return false;
+	}
+
+	int flags = 0;
+	if (enable)
+	{
+		flags = SOF_TIMESTAMPING_RX_SOFTWARE | SOF_TIMESTAMPING_SOFTWARE;
+		if (hardware)
+		{
+			flags |= SOF_TIMESTAMPING_RX_HARDWARE | SOF_TIMESTAMPING_RAW_HARDWARE;
+		}
+	}
+	if (0 != setsockopt(mSocket, SOL_SOCKET, SO_TIMESTAMPING, &flags, sizeof(flags)))
+	{
+		AJA_REPORT(
+			0,
+			AJA_DebugSeverity_Warning,
+			"AJAUDPSocket::EnableReceiveTimestamps failed (errno:%d)",
+			errno);
+		return false;
+	}
+	mTimestamping = enable;
+	return true;
+#else
+	AJA_UNUSED(enable);
+	AJA_UNUSED(hardware);
+	return false;
+#endif
+}
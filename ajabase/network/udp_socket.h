@@ -12,11 +12,94 @@
 // Includes
 /////////////////////////////
 #include "ajabase/network/ip_socket.h"
+#include <vector>
 
 
 /////////////////////////////
 // Declarations
 /////////////////////////////
+/**
+ *	A reusable batch of datagrams for AJAUDPSocket::ReadBatch and AJAUDPSocket::WriteBatch.
+ *	All packet buffers, addresses, timestamps and the platform's per-message bookkeeping are
+ *	allocated up front (by the constructor or Allocate), so that datagrams are received
+ *	directly into (and sent directly from) the batch's storage, without any per-call
+ *	allocation or copying.
+ */
+class AJA_EXPORT AJAUDPPacketBatch
+{
+	public:
+		/**
+		 *	@param[in]	maxPackets		The maximum number of datagrams in the batch.
+		 *	@param[in]	maxPacketSize	The size of each datagram buffer, in bytes.
+		 *	@note		If either is zero (or the allocation fails), the batch has no storage, and MaxPackets returns zero.
+		 */
+		AJAUDPPacketBatch(uint32_t maxPackets = 64, uint32_t maxPacketSize = 2048);
+		virtual ~AJAUDPPacketBatch(void);
+
+		/**
+		 *	(Re)allocates the batch's storage, and empties the batch.
+		 *	@return		True if successful;  false if maxPackets or maxPacketSize is zero, or the allocation failed
+		 *				(which leaves the batch with no storage).
+		 */
+		bool Allocate(uint32_t maxPackets, uint32_t maxPacketSize);
+
+		inline uint32_t MaxPackets(void) const		{return mMaxPackets;}
+		inline uint32_t MaxPacketSize(void) const	{return mMaxPacketSize;}
+		inline uint32_t Count(void) const			{return mCount;}		///< The number of datagrams in the batch.
+		inline bool		IsFull(void) const			{return mCount >= mMaxPackets;}
+		inline void		Clear(void)					{mCount = 0;}
+
+		/**
+		 *	Sets the number of datagrams in the batch (e.g. after filling them in place using
+		 *	Data, SetLength and SetAddress). Fails if larger than MaxPackets.
+		 */
+		bool SetCount(uint32_t count);
+
+		/**
+		 *	Copies a datagram into the next free slot of the batch.
+		 *	@return		False if the batch is full, or the datagram is larger than MaxPacketSize.
+		 */
+		bool Add(const uint8_t* pData, uint32_t dataLength, const struct sockaddr_in& targetAddress);
+
+		uint8_t*					Data(uint32_t index);			///< The buffer of the given datagram (MaxPacketSize bytes), or NULL if index >= MaxPackets.
+		const uint8_t*				Data(uint32_t index) const;
+		uint32_t					Length(uint32_t index) const;	///< The length of the given datagram, in bytes.
+		bool						SetLength(uint32_t index, uint32_t dataLength);
+		const struct sockaddr_in*	Address(uint32_t index) const;	///< The sender (after reading) or target (for writing), or NULL if index >= MaxPackets.
+		bool						SetAddress(uint32_t index, const struct sockaddr_in& address);
+
+		/**
+		 *	@return		The receive timestamp of the given datagram, in nanoseconds since the epoch
+		 *				(hardware time if the NIC provided it, otherwise kernel software time),
+		 *				or zero if receive timestamps aren't enabled or available.
+		 *	@see		AJAUDPSocket::EnableReceiveTimestamps
+		 */
+		uint64_t					Timestamp(uint32_t index) const;
+
+		/**
+		 *	@return		True if the given received datagram was larger than MaxPacketSize, and was truncated.
+		 */
+		bool						IsTruncated(uint32_t index) const;
+
+	private:
+		AJAUDPPacketBatch(const AJAUDPPacketBatch& other);				//	Not copyable
+		AJAUDPPacketBatch& operator=(const AJAUDPPacketBatch& other);
+
+		friend class AJAUDPSocket;
+
+		uint32_t						mMaxPackets;
+		uint32_t						mMaxPacketSize;
+		uint32_t						mCount;
+		std::vector<uint8_t>			mStorage;		//	mMaxPackets * mMaxPacketSize
+		std::vector<uint32_t>			mLengths;
+		std::vector<struct sockaddr_in>	mAddresses;
+		std::vector<uint64_t>			mTimestamps;
+		std::vector<uint8_t>			mTruncated;
+		std::vector<uint8_t>			mMessages;		//	Platform message headers (e.g. mmsghdr + iovec)
+		std::vector<uint8_t>			mControl;		//	Per-message ancillary (cmsg) buffers
+};
+
+
 class AJA_EXPORT AJAUDPSocket : public AJAIPSocket
 {
 	public:
@@ -25,6 +108,32 @@ class AJA_EXPORT AJAUDPSocket : public AJAIPSocket
 
 		AJAStatus Open(const std::string& ipAddress, uint16_t port);
 
+		/**
+		 *	Receives as many datagrams as are available, up to the batch's MaxPackets, into the
+		 *	given batch, replacing its contents. Uses a single recvmmsg call on Linux.
+		 *	@param[in]	batch	The batch that receives the datagrams.
+		 *	@param[in]	timeout	How long to wait for the first datagram, in milliseconds
+		 *						(0 to return immediately, -1 to wait indefinitely).
+		 *	@return		The number of datagrams received (also batch.Count()).
+		 */
+		uint32_t ReadBatch(AJAUDPPacketBatch& batch, int timeout = 0);
+
+		/**
+		 *	Sends the batch's datagrams, each to its own target address. Uses sendmmsg on Linux.
+		 *	@return		The number of datagrams sent. Fewer than batch.Count() indicates an error.
+		 */
+		uint32_t WriteBatch(AJAUDPPacketBatch& batch);
+
+		/**
+		 *	Enables or disables per-datagram receive timestamps (SO_TIMESTAMPING on Linux), which
+		 *	are reported by AJAUDPPacketBatch::Timestamp after ReadBatch.
+		 *	@param[in]	enable		Specify true to enable receive timestamps.
+		 *	@param[in]	hardware	Specify true to also request NIC hardware timestamps, where supported.
+		 *	@return		True if successful;  false if the socket isn't open, or the platform doesn't support it.
+		 */
+		bool EnableReceiveTimestamps(bool enable, bool hardware = false);
+		inline bool IsReceiveTimestampsEnabled(void) const	{return mTimestamping;}
+
 		uint32_t Poll(
 					uint8_t*			pData,
 					uint32_t			dataLength,
@@ -38,6 +147,7 @@ class AJA_EXPORT AJAUDPSocket : public AJAIPSocket
 
 
 	private:
+		bool mTimestamping;
 };
 
 #endif	//	AJA_UDP_SOCKET_H
@@ -18,7 +18,13 @@
 #if defined(AJA_LINUX) || defined(AJA_BAREMETAL)
 	#include <stdarg.h>
 #endif
+#if defined(AJA_LINUX)
+	#include <linux/futex.h>
+	#include <sys/syscall.h>
+	#include <unistd.h>
+#endif
 #include <assert.h>
+#include <stddef.h>
 #include <string.h>
 #include <stdio.h>
 #include <time.h>
@@ -336,6 +342,21 @@ inline int64_t debug_time (void)
 	return time;
 }
 
+//	Publishes a message written by report_common, and wakes any AJADebugReaders blocked in Wait...
+inline void report_complete (const uint64_t writeIndex, const int32_t messageIndex)
+{
+	// set last to indicate message complete
+	AJAAtomic::Exchange(&spShare->messageRing[messageIndex].sequenceNumber, writeIndex);
+	AJAAtomic::Increment(&spShare->statsMessagesAccepted);
+	if (spShare->readerWaiters)
+	{
+		AJAAtomic::Increment(&spShare->writeSignal);
+#if defined(AJA_LINUX)
+		::syscall(SYS_futex, &spShare->writeSignal, FUTEX_WAKE, INT32_MAX, NULL, NULL, 0);
+#endif
+	}
+}
+
 inline uint64_t report_common(int32_t index, int32_t severity, const char* pFileName, int32_t lineNumber, uint64_t& writeIndex, int32_t& messageIndex)
 {
 	static const char * spUnknown = "unknown";
@@ -415,10 +436,7 @@ void AJADebug::Report (int32_t index, int32_t severity, const char* pFileName, i
 						 AJA_DEBUG_MESSAGE_MAX_SIZE,
 						 pFormat, vargs);
 			va_end(vargs);
-
-			// set last to indicate message complete
-			AJAAtomic::Exchange(&spShare->messageRing[messageIndex].sequenceNumber, writeIndex);
-			AJAAtomic::Increment(&spShare->statsMessagesAccepted);
+			report_complete(writeIndex, messageIndex);
 		}
 	}
 	catch (...)
@@ -439,10 +457,7 @@ void AJADebug::Report (int32_t index, int32_t severity, const char* pFileName, i
 		{
 			// copy the message
 			aja::safer_strncpy(spShare->messageRing[messageIndex].messageText, message.c_str(), message.length()+1, AJA_DEBUG_MESSAGE_MAX_SIZE);
-
-			// set last to indicate message complete
-			AJAAtomic::Exchange(&spShare->messageRing[messageIndex].sequenceNumber, writeIndex);
-			AJAAtomic::Increment(&spShare->statsMessagesAccepted);
+			report_complete(writeIndex, messageIndex);
 		}
 	}
 	catch (...)
@@ -490,10 +505,7 @@ void AJADebug::AssertWithMessage (const char* pFileName, int32_t lineNumber, con
 						AJA_DEBUG_MESSAGE_MAX_SIZE,
 						"assertion failed (file %s, line %d):  %s\n",
 						pFileName, lineNumber, pExpression.c_str());
-
-			// set last to indicate message complete
-			AJAAtomic::Exchange(&spShare->messageRing[messageIndex].sequenceNumber, writeIndex);
-			AJAAtomic::Increment(&spShare->statsMessagesAccepted);
+			report_complete(writeIndex, messageIndex);
 		}
 	}
 	catch (...)
@@ -1505,3 +1517,507 @@ std::ostream & operator << (std::ostream & oss, const AJADebugStat & inStat)
 	oss << inStat.fMin << " (min), " << inStat.Average() << " (avg), " << inStat.fMax << " (max), " << inStat.fCount << " (cnt), " << inStat.fLastTimeStamp;
 	return oss;
 }
+
+
+//////////////////////////////////////////////////////////////////////////////////////////
+//	AJADebugReader
+
+#define	READER_STALL_MICROSECONDS	100000	//	Give up on a message that's been incomplete this long
+
+static inline void debug_read_barrier (void)
+{
+#if defined(AJA_WINDOWS)
+	MemoryBarrier();
+#else
+	__sync_synchronize();
+#endif
+}
+
+//	Copies the NUL-terminated string into the fixed-size buffer, copying only the used portion...
+static inline void debug_copy_string (char * pDst, const char * pSrc, const size_t inMaxSize)
+{
+	size_t len(0);
+	while (len < inMaxSize - 1  &&  pSrc[len])
+		len++;
+	::memcpy(pDst, pSrc, len);
+	pDst[len] = 0;
+}
+
+AJADebugReader::AJADebugReader()
+	:	mNextSeq	(1),
+		mStallSeq	(0),
+		mStallStart	(0),
+		mUnits		(AJA_DEBUG_UNIT_ARRAY_SIZE / 64, 0xFFFFFFFFFFFFFFFFULL),
+		mSeverities	(0xFFFFFFFF),
+		mPID		(0),
+		mTID		(0)
+{
+	SeekToNewest();
+}
+
+AJAStatus AJADebugReader::SeekToOldest (void)
+{
+	if (!spShare)
+		return AJA_STATUS_INITIALIZE;
+	const uint64_t writeIndex (spShare->writeIndex);
+	mNextSeq = writeIndex >= AJA_DEBUG_MESSAGE_RING_SIZE ? writeIndex - AJA_DEBUG_MESSAGE_RING_SIZE + 1 : 1;
+	mStallSeq = 0;
+	return AJA_STATUS_SUCCESS;
+}
+
+AJAStatus AJADebugReader::SeekToNewest (void)
+{
+	if (!spShare)
+		return AJA_STATUS_INITIALIZE;
+	mNextSeq = spShare->writeIndex + 1;
+	mStallSeq = 0;
+	return AJA_STATUS_SUCCESS;
+}
+
+bool AJADebugReader::Wait (const uint32_t inTimeoutMS)
+{
+	if (!spShare)
+		return false;
+	if (spShare->writeIndex >= mNextSeq)
+		return true;
+	if (!inTimeoutMS)
+		return false;
+#if defined(AJA_LINUX)
+	//	Announce that I'm waiting before checking the write index one last time, so that a message reported in
+	//	between is guaranteed to bump writeSignal (which makes the futex wait return immediately)...
+	AJAAtomic::Increment(&spShare->readerWaiters);
+	const uint32_t signal (spShare->writeSignal);
+	if (spShare->writeIndex < mNextSeq)
+	{
+		struct timespec timeout;
+		timeout.tv_sec = time_t(inTimeoutMS / 1000);
+		timeout.tv_nsec = long(inTimeoutMS % 1000) * 1000000L;
+		::syscall(SYS_futex, &spShare->writeSignal, FUTEX_WAIT, signal, &timeout, NULL, 0);
+	}
+	AJAAtomic::Decrement(&spShare->readerWaiters);
+#else
+	for (uint32_t ms(0);  ms < inTimeoutMS  &&  spShare->writeIndex < mNextSeq;  ms++)
+		AJATime::Sleep(1);
+#endif
+	return spShare->writeIndex >= mNextSeq;
+}
+
+size_t AJADebugReader::Read (std::vector<AJADebugMessage> & outMessages, const size_t inMaxMessages)
+{
+	outMessages.clear();
+	if (!spShare)
+		return 0;
+	const uint64_t writeIndex (spShare->writeIndex);
+	if (writeIndex >= mNextSeq + AJA_DEBUG_MESSAGE_RING_SIZE)
+	{	//	Writers lapped me -- skip to the oldest message that's still intact...
+		const uint64_t oldest (writeIndex - AJA_DEBUG_MESSAGE_RING_SIZE + 1);
+		mStats.fMessagesDropped += oldest - mNextSeq;
+		mNextSeq = oldest;
+	}
+	outMessages.reserve(size_t(writeIndex >= mNextSeq ? writeIndex - mNextSeq + 1 : 0));
+	while (mNextSeq <= writeIndex  &&  (!inMaxMessages || outMessages.size() < inMaxMessages))
+	{
+		const AJADebugMessage & msg (spShare->messageRing[mNextSeq % AJA_DEBUG_MESSAGE_RING_SIZE]);
+		const uint64_t seq (msg.sequenceNumber);
+		if (seq < mNextSeq)
+		{	//	Still being written...
+			const uint64_t now (static_cast<uint64_t>(debug_time()));
+			if (mStallSeq != mNextSeq)
+				{mStallSeq = mNextSeq;  mStallStart = now;}
+			if (now - mStallStart < READER_STALL_MICROSECONDS)
+				break;	//	Try again later
+			mStats.fMessagesDropped++;	//	Writer must have died mid-message -- give up on it
+			mNextSeq++;
+			continue;
+		}
+		if (seq > mNextSeq)
+			{mStats.fMessagesDropped++;  mNextSeq++;  continue;}	//	Overwritten since I checked writeIndex
+		debug_read_barrier();
+
+		//	Filter in place, before copying anything...
+		if (msg.destinationMask == AJA_DEBUG_DESTINATION_NONE
+			||  !AcceptsUnit(msg.groupIndex)  ||  !AcceptsSeverity(msg.severity)
+			||  (mPID  &&  msg.pid != mPID)  ||  (mTID  &&  msg.tid != mTID))
+			{mStats.fMessagesFiltered++;  mNextSeq++;  continue;}
+
+		outMessages.resize(outMessages.size() + 1);
+		AJADebugMessage & copy (outMessages.back());
+		::memcpy(&copy, &msg, offsetof(AJADebugMessage, fileName));
+		debug_copy_string(copy.fileName, msg.fileName, AJA_DEBUG_FILE_NAME_MAX_SIZE);
+		debug_copy_string(copy.messageText, msg.messageText, AJA_DEBUG_MESSAGE_MAX_SIZE);
+
+		//	If a writer has since claimed this slot, the copy may be torn...
+		debug_read_barrier();
+		if (spShare->writeIndex >= mNextSeq + AJA_DEBUG_MESSAGE_RING_SIZE)
+			{outMessages.pop_back();  mStats.fMessagesDropped++;  mNextSeq++;  continue;}
+		copy.sequenceNumber = mNextSeq++;
+		mStats.fMessagesRead++;
+	}
+	return outMessages.size();
+}
+
+AJADebugReader & AJADebugReader::SetUnit (const int32_t inUnit, const bool inAccept)
+{
+	if (inUnit >= 0  &&  inUnit < AJA_DEBUG_UNIT_ARRAY_SIZE)
+	{
+		if (inAccept)
+			mUnits[size_t(inUnit) / 64] |= 1ULL << (inUnit % 64);
+		else
+			mUnits[size_t(inUnit) / 64] &= ~(1ULL << (inUnit % 64));
+	}
+	return *this;
+}
+
+AJADebugReader & AJADebugReader::SetAllUnits (const bool inAccept)
+{
+	mUnits.assign(mUnits.size(), inAccept ? 0xFFFFFFFFFFFFFFFFULL : 0);
+	return *this;
+}
+
+AJADebugReader & AJADebugReader::SetSeverity (const int32_t inSeverity, const bool inAccept)
+{
+	if (inSeverity >= 0  &&  inSeverity < 32)
+	{
+		if (inAccept)
+			mSeverities |= 1U << inSeverity;
+		else
+			mSeverities &= ~(1U << inSeverity);
+	}
+	return *this;
+}
+
+AJADebugReader & AJADebugReader::SetAllSeverities (const bool inAccept)
+{
+	mSeverities = inAccept ? 0xFFFFFFFF : 0;
+	return *this;
+}
+
+bool AJADebugReader::AcceptsUnit (const int32_t inUnit) const
+{
+	if (inUnit < 0  ||  inUnit >= AJA_DEBUG_UNIT_ARRAY_SIZE)
+		return false;
+	return (mUnits[size_t(inUnit) / 64] >> (inUnit % 64)) & 1;
+}
+
+bool AJADebugReader::AcceptsSeverity (const int32_t inSeverity) const
+{
+	if (inSeverity < 0  ||  inSeverity >= 32)
+		return false;
+	return (mSeverities >> inSeverity) & 1;
+}
+
+
+//////////////////////////////////////////////////////////////////////////////////////////
+//	AJADebugLogFile
+
+#if defined(AJA_WINDOWS)
+	#define	LOG_FSEEK	_fseeki64
+	#define	LOG_FTELL	_ftelli64
+#else
+	#define	LOG_FSEEK	fseeko
+	#define	LOG_FTELL	ftello
+#endif
+
+static const uint32_t	kLogFileMagic		(AJA_FOURCC('A','D','L','G'));	//	File header magic
+static const uint32_t	kLogIndexMagic		(AJA_FOURCC('A','D','L','I'));	//	Footer magic
+static const uint32_t	kLogFileVersion		(1);
+static const size_t		kLogFlushBytes		(256 * 1024);
+
+//	File header (at offset 0)...
+typedef struct LogFileHeader
+{
+	uint32_t	fMagic;
+	uint32_t	fVersion;
+	uint32_t	fHeaderSize;
+	uint32_t	fBlockSize;
+} LogFileHeader;
+
+//	Fixed portion of each record, followed by the file name and message text (no terminating NULs)...
+typedef struct LogRecordHeader
+{
+	uint32_t	fRecordSize;	//	Total record size, including this header
+	uint16_t	fFileNameLen;
+	uint16_t	fTextLen;
+	uint64_t	fSequenceNumber;
+	int64_t		fTime;
+	int64_t		fWallTime;
+	int32_t		fGroupIndex;
+	uint32_t	fDestinationMask;
+	int32_t		fSeverity;
+	int32_t		fLineNumber;
+	uint64_t	fPID;
+	uint64_t	fTID;
+} LogRecordHeader;
+
+//	Footer (at end of file, after the index)...
+typedef struct LogFileFooter
+{
+	uint64_t	fIndexOffset;
+	uint64_t	fNumMessages;
+	uint32_t	fNumBlocks;
+	uint32_t	fMagic;
+} LogFileFooter;
+
+//	Parses one record from the buffer, returning its size (or zero if the buffer doesn't hold a whole record)...
+static size_t log_parse_record (const uint8_t * pBuffer, const size_t inSize, AJADebugMessage * pOutMessage)
+{
+	if (inSize < sizeof(LogRecordHeader))
+		return 0;
+	LogRecordHeader hdr;
+	::memcpy(&hdr, pBuffer, sizeof(hdr));
+	if (hdr.fRecordSize < sizeof(hdr)  ||  hdr.fRecordSize > inSize
+		||  size_t(hdr.fFileNameLen) + size_t(hdr.fTextLen) + sizeof(hdr) != hdr.fRecordSize
+		||  hdr.fFileNameLen >= AJA_DEBUG_FILE_NAME_MAX_SIZE  ||  hdr.fTextLen >= AJA_DEBUG_MESSAGE_MAX_SIZE)
+		return 0;
+	if (pOutMessage)
+	{
+		pOutMessage->sequenceNumber		= hdr.fSequenceNumber;
+		pOutMessage->time				= hdr.fTime;
+		pOutMessage->wallTime			= hdr.fWallTime;
+		pOutMessage->groupIndex			= hdr.fGroupIndex;
+		pOutMessage->destinationMask	= hdr.fDestinationMask;
+		pOutMessage->severity			= hdr.fSeverity;
+		pOutMessage->lineNumber			= hdr.fLineNumber;
+		pOutMessage->pid				= hdr.fPID;
+		pOutMessage->tid				= hdr.fTID;
+		::memcpy(pOutMessage->fileName, pBuffer + sizeof(hdr), hdr.fFileNameLen);
+		pOutMessage->fileName[hdr.fFileNameLen] = 0;
+		::memcpy(pOutMessage->messageText, pBuffer + sizeof(hdr) + hdr.fFileNameLen, hdr.fTextLen);
+		pOutMessage->messageText[hdr.fTextLen] = 0;
+	}
+	return hdr.fRecordSize;
+}
+
+AJADebugLogFile::AJADebugLogFile()
+	:	mFile			(NULL),
+		mWriting		(false),
+		mNumMessages	(0),
+		mFileOffset		(0),
+		mDataEnd		(0)
+{
+}
+
+AJADebugLogFile::~AJADebugLogFile()
+{
+	Close();
+}
+
+AJAStatus AJADebugLogFile::Create (const std::string & inFilePath)
+{
+	Close();
+	mFile = ::fopen(inFilePath.c_str(), "wb");
+	if (!mFile)
+		return AJA_STATUS_OPEN;
+	mWriting = true;
+	LogFileHeader hdr;
+	hdr.fMagic = kLogFileMagic;
+	hdr.fVersion = kLogFileVersion;
+	hdr.fHeaderSize = uint32_t(sizeof(hdr));
+	hdr.fBlockSize = kBlockSize;
+	mBuffer.reserve(kLogFlushBytes + sizeof(LogRecordHeader) + AJA_DEBUG_FILE_NAME_MAX_SIZE + AJA_DEBUG_MESSAGE_MAX_SIZE);
+	mBuffer.assign(reinterpret_cast<const uint8_t*>(&hdr), reinterpret_cast<const uint8_t*>(&hdr) + sizeof(hdr));
+	return AJA_STATUS_SUCCESS;
+}
+
+AJAStatus AJADebugLogFile::Append (const AJADebugMessage & inMessage)
+{
+	if (!mFile  ||  !mWriting)
+		return AJA_STATUS_INITIALIZE;
+
+	LogRecordHeader hdr;
+	size_t fileNameLen(0), textLen(0);
+	while (fileNameLen < AJA_DEBUG_FILE_NAME_MAX_SIZE - 1  &&  inMessage.fileName[fileNameLen])
+		fileNameLen++;
+	while (textLen < AJA_DEBUG_MESSAGE_MAX_SIZE - 1  &&  inMessage.messageText[textLen])
+		textLen++;
+	hdr.fRecordSize			= uint32_t(sizeof(hdr) + fileNameLen + textLen);
+	hdr.fFileNameLen		= uint16_t(fileNameLen);
+	hdr.fTextLen			= uint16_t(textLen);
+	hdr.fSequenceNumber		= inMessage.sequenceNumber;
+	hdr.fTime				= inMessage.time;
+	hdr.fWallTime			= inMessage.wallTime;
+	hdr.fGroupIndex			= inMessage.groupIndex;
+	hdr.fDestinationMask	= inMessage.destinationMask;
+	hdr.fSeverity			= inMessage.severity;
+	hdr.fLineNumber			= inMessage.lineNumber;
+	hdr.fPID				= inMessage.pid;
+	hdr.fTID				= inMessage.tid;
+
+	//	Start a new index block?
+	if (mBlocks.empty()  ||  mBlocks.back().fNumRecords >= kBlockSize)
+	{
+		Block blk;
+		blk.fOffset = mFileOffset + mBuffer.size();
+		blk.fMinTime = blk.fMaxTime = inMessage.time;
+		blk.fNumRecords = blk.fReserved = 0;
+		mBlocks.push_back(blk);
+	}
+	Block & blk (mBlocks.back());
+	blk.fNumRecords++;
+	if (inMessage.time < blk.fMinTime)
+		blk.fMinTime = inMessage.time;
+	if (inMessage.time > blk.fMaxTime)
+		blk.fMaxTime = inMessage.time;
+
+	const uint8_t * pHdr (reinterpret_cast<const uint8_t*>(&hdr));
+	mBuffer.insert(mBuffer.end(), pHdr, pHdr + sizeof(hdr));
+	mBuffer.insert(mBuffer.end(), inMessage.fileName, inMessage.fileName + fileNameLen);
+	mBuffer.insert(mBuffer.end(), inMessage.messageText, inMessage.messageText + textLen);
+	mNumMessages++;
+	return mBuffer.size() >= kLogFlushBytes ? Flush() : AJA_STATUS_SUCCESS;
+}
+
+AJAStatus AJADebugLogFile::Flush (void)
+{
+	if (!mFile)
+		return AJA_STATUS_INITIALIZE;
+	if (mBuffer.empty())
+		return AJA_STATUS_SUCCESS;
+	const size_t written (::fwrite(&mBuffer[0], 1, mBuffer.size(), mFile));
+	mFileOffset += written;
+	const bool ok (written == mBuffer.size());
+	mBuffer.clear();
+	return ok ? AJA_STATUS_SUCCESS : AJA_STATUS_IO;
+}
+
+AJAStatus AJADebugLogFile::Close (void)
+{
+	if (!mFile)
+		return AJA_STATUS_SUCCESS;
+	AJAStatus status (AJA_STATUS_SUCCESS);
+	if (mWriting)
+	{	//	Write the index and footer...
+		LogFileFooter footer;
+		footer.fIndexOffset = mFileOffset + mBuffer.size();
+		footer.fNumMessages = mNumMessages;
+		footer.fNumBlocks = uint32_t(mBlocks.size());
+		footer.fMagic = kLogIndexMagic;
+		if (!mBlocks.empty())
+		{
+			const uint8_t * pIndex (reinterpret_cast<const uint8_t*>(&mBlocks[0]));
+			mBuffer.insert(mBuffer.end(), pIndex, pIndex + mBlocks.size() * sizeof(Block));
+		}
+		const uint8_t * pFooter (reinterpret_cast<const uint8_t*>(&footer));
+		mBuffer.insert(mBuffer.end(), pFooter, pFooter + sizeof(footer));
+		status = Flush();
+	}
+	::fclose(mFile);
+	mFile = NULL;
+	mWriting = false;
+	mNumMessages = mFileOffset = mDataEnd = 0;
+	mBuffer.clear();
+	mBlocks.clear();
+	return status;
+}
+
+AJAStatus AJADebugLogFile::Open (const std::string & inFilePath)
+{
+	Close();
+	mFile = ::fopen(inFilePath.c_str(), "rb");
+	if (!mFile)
+		return AJA_STATUS_OPEN;
+
+	LogFileHeader hdr;
+	if (::fread(&hdr, 1, sizeof(hdr), mFile) != sizeof(hdr)
+		||  hdr.fMagic != kLogFileMagic  ||  hdr.fVersion != kLogFileVersion  ||  hdr.fHeaderSize != sizeof(hdr))
+		{Close();  return AJA_STATUS_BAD_PARAM;}
+
+	LOG_FSEEK(mFile, 0, SEEK_END);
+	const int64_t fileSize (LOG_FTELL(mFile));
+	LogFileFooter footer;
+	::memset(&footer, 0, sizeof(footer));
+	if (fileSize >= int64_t(sizeof(hdr) + sizeof(footer)))
+	{
+		LOG_FSEEK(mFile, fileSize - int64_t(sizeof(footer)), SEEK_SET);
+		if (::fread(&footer, 1, sizeof(footer), mFile) != sizeof(footer))
+			footer.fMagic = 0;
+	}
+	if (footer.fMagic == kLogIndexMagic
+		&&  footer.fIndexOffset + uint64_t(footer.fNumBlocks) * sizeof(Block) + sizeof(footer) == uint64_t(fileSize))
+	{	//	Read the index...
+		mBlocks.resize(footer.fNumBlocks);
+		LOG_FSEEK(mFile, int64_t(footer.fIndexOffset), SEEK_SET);
+		if (mBlocks.empty()  ||  ::fread(&mBlocks[0], sizeof(Block), mBlocks.size(), mFile) == mBlocks.size())
+		{
+			mNumMessages = footer.fNumMessages;
+			mDataEnd = footer.fIndexOffset;
+			return AJA_STATUS_SUCCESS;
+		}
+		mBlocks.clear();
+	}
+	return RebuildIndex();	//	Not closed properly -- scan it
+}
+
+AJAStatus AJADebugLogFile::RebuildIndex (void)
+{
+	mBlocks.clear();
+	mNumMessages = 0;
+	uint64_t offset (sizeof(LogFileHeader));
+	std::vector<uint8_t> buffer (kLogFlushBytes);
+	size_t used (0);
+	LOG_FSEEK(mFile, int64_t(offset), SEEK_SET);
+	do
+	{
+		const size_t numRead (::fread(buffer.data() + used, 1, buffer.size() - used, mFile));
+		used += numRead;
+		size_t pos (0), recSize (0);
+		AJADebugMessage msg;
+		while ((recSize = log_parse_record(buffer.data() + pos, used - pos, &msg)))
+		{
+			if (mBlocks.empty()  ||  mBlocks.back().fNumRecords >= kBlockSize)
+			{
+				Block blk;
+				blk.fOffset = offset + pos;
+				blk.fMinTime = blk.fMaxTime = msg.time;
+				blk.fNumRecords = blk.fReserved = 0;
+				mBlocks.push_back(blk);
+			}
+			Block & blk (mBlocks.back());
+			blk.fNumRecords++;
+			if (msg.time < blk.fMinTime)	blk.fMinTime = msg.time;
+			if (msg.time > blk.fMaxTime)	blk.fMaxTime = msg.time;
+			mNumMessages++;
+			pos += recSize;
+		}
+		if (!numRead  ||  (!pos  &&  used == buffer.size()))
+			{mDataEnd = offset + pos;  break;}	//	End of file, or garbage
+		::memmove(buffer.data(), buffer.data() + pos, used - pos);
+		used -= pos;
+		offset += pos;
+	} while (true);
+	return AJA_STATUS_SUCCESS;
+}
+
+AJAStatus AJADebugLogFile::Find (const int64_t inStartTime, const int64_t inEndTime,
+								std::vector<AJADebugMessage> & outMessages, const size_t inMaxMessages)
+{
+	outMessages.clear();
+	if (!mFile  ||  mWriting)
+		return AJA_STATUS_INITIALIZE;
+	std::vector<uint8_t> buffer;
+	for (size_t ndx(0);  ndx < mBlocks.size();  ndx++)
+	{
+		const Block & blk (mBlocks[ndx]);
+		if (blk.fMaxTime < inStartTime  ||  blk.fMinTime > inEndTime)
+			continue;	//	Nothing of interest in this block
+		const uint64_t blkEnd (ndx + 1 < mBlocks.size() ? mBlocks[ndx+1].fOffset : mDataEnd);
+		if (blkEnd <= blk.fOffset)
+			continue;
+		buffer.resize(size_t(blkEnd - blk.fOffset));
+		if (LOG_FSEEK(mFile, int64_t(blk.fOffset), SEEK_SET)
+			||  ::fread(&buffer[0], 1, buffer.size(), mFile) != buffer.size())
+			return AJA_STATUS_IO;
+		size_t pos (0), recSize (0);
+		AJADebugMessage msg;
+		while ((recSize = log_parse_record(buffer.data() + pos, buffer.size() - pos, &msg)))
+		{
+			pos += recSize;
+			if (msg.time < inStartTime  ||  msg.time > inEndTime)
+				continue;
+			outMessages.push_back(msg);
+			if (inMaxMessages  &&  outMessages.size() >= inMaxMessages)
+				return AJA_STATUS_SUCCESS;
+		}
+	}
+	return AJA_STATUS_SUCCESS;
+}
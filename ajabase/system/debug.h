@@ -11,6 +11,7 @@
 #include <stdio.h>
 #include <sstream>
 #include <set>
+#include <vector>
 #include "ajabase/common/public.h"
 #include "ajabase/system/debugshare.h"
 
@@ -749,6 +750,191 @@ public:
 
 };	//	AJADebug
 
+
+/** 
+ *	Follows the AJADebug message ring, copying out only the messages that pass its filters.
+ *
+ *	Unlike polling the ring with AJADebug::GetSequenceNumber and the AJADebug::GetMessage... functions...
+ *	-	Each message's unit, severity, process ID and thread ID are checked in place, in shared memory,
+ *		and only the messages that pass are copied.
+ *	-	Wait blocks until a new message is reported, without sleeping or polling (on Linux, it waits on a
+ *		futex in the shared memory region, which reporting processes signal only when a reader is waiting).
+ *		On other platforms, it polls the ring once per millisecond.
+ *	-	Messages that were overwritten before they could be read are counted, not silently skipped.
+ *	@note	The debug facility must be open (see AJADebug::Open), and reporting processes only report messages
+ *			while the client reference count is non-zero (see AJADebug::SetClientReferenceCount).
+ *	@ingroup AJAGroupDebug
+ */
+class AJA_EXPORT AJADebugReader
+{
+public:
+	/**
+	 *	Reader statistics.
+	 */
+	typedef struct Stats
+	{
+		uint64_t	fMessagesRead;		/**< Messages that passed the filters and were copied */
+		uint64_t	fMessagesFiltered;	/**< Messages that were skipped by the filters */
+		uint64_t	fMessagesDropped;	/**< Messages that were overwritten (or abandoned) before they could be read */
+		inline Stats () : fMessagesRead(0), fMessagesFiltered(0), fMessagesDropped(0)	{}
+	} Stats;
+
+	/**
+	 *	Constructs a reader that starts with the next message to be reported, and accepts everything.
+	 */
+	AJADebugReader();
+	virtual inline ~AJADebugReader()	{}
+
+	/**
+	 *	Moves my read position to the oldest message still in the ring.
+	 *	@return		AJA_STATUS_SUCCESS if successful, or AJA_STATUS_INITIALIZE if the debug facility isn't open.
+	 */
+	virtual AJAStatus SeekToOldest (void);
+
+	/**
+	 *	Moves my read position to the next message to be reported (i.e. skips everything currently in the ring).
+	 *	@return		AJA_STATUS_SUCCESS if successful, or AJA_STATUS_INITIALIZE if the debug facility isn't open.
+	 */
+	virtual AJAStatus SeekToNewest (void);
+
+	/**
+	 *	@return		The sequence number of the next message I'll read.
+	 */
+	inline uint64_t GetNextSequenceNumber (void) const		{return mNextSeq;}
+
+	/**
+	 *	Blocks until at least one message I haven't read has been reported, or until the timeout expires.
+	 *	@param[in]	inTimeoutMS		Specifies the maximum wait time, in milliseconds. Zero just checks.
+	 *	@return		True if there are messages to read;  otherwise false.
+	 */
+	virtual bool Wait (const uint32_t inTimeoutMS);
+
+	/**
+	 *	Copies messages that pass my filters, starting at my read position, and advances my read position.
+	 *	Messages whose destination is AJA_DEBUG_DESTINATION_NONE are always skipped.
+	 *	@param[out]	outMessages		Receives the messages that were read. Its previous contents are replaced.
+	 *	@param[in]	inMaxMessages	Optionally limits the number of messages copied. Zero, the default, means no limit.
+	 *	@return		The number of messages copied into outMessages.
+	 */
+	virtual size_t Read (std::vector<AJADebugMessage> & outMessages, const size_t inMaxMessages = 0);
+
+	/**
+	 *	@name	Filters
+	 */
+	///@{
+	virtual AJADebugReader & SetUnit (const int32_t inUnit, const bool inAccept);	/**< Accepts or rejects messages from the given debug unit */
+	virtual AJADebugReader & SetAllUnits (const bool inAccept);						/**< Accepts or rejects messages from all debug units */
+	virtual AJADebugReader & SetSeverity (const int32_t inSeverity, const bool inAccept);	/**< Accepts or rejects messages having the given severity */
+	virtual AJADebugReader & SetAllSeverities (const bool inAccept);				/**< Accepts or rejects messages having any severity */
+	inline AJADebugReader & SetProcessID (const uint64_t inPID)		{mPID = inPID;  return *this;}	/**< Accepts only messages from the given process (zero means any) */
+	inline AJADebugReader & SetThreadID (const uint64_t inTID)		{mTID = inTID;  return *this;}	/**< Accepts only messages from the given thread (zero means any) */
+	virtual bool AcceptsUnit (const int32_t inUnit) const;
+	virtual bool AcceptsSeverity (const int32_t inSeverity) const;
+	///@}
+
+	/**
+	 *	@return		My statistics.
+	 */
+	inline const Stats & GetStats (void) const		{return mStats;}
+
+private:
+	uint64_t				mNextSeq;		///< Sequence number of next message to read
+	uint64_t				mStallSeq;		///< Sequence number of the incomplete message I'm waiting on (if any)
+	uint64_t				mStallStart;	///< When I started waiting on mStallSeq (microseconds)
+	std::vector<uint64_t>	mUnits;			///< Accepted debug units, 1 bit per unit
+	uint32_t				mSeverities;	///< Accepted severities, 1 bit per severity
+	uint64_t				mPID;			///< Accepted process (0 = any)
+	uint64_t				mTID;			///< Accepted thread (0 = any)
+	Stats					mStats;			///< My statistics
+};	//	AJADebugReader
+
+
+/** 
+ *	Reads and writes indexed binary AJADebug message log files, which can be searched by time range without
+ *	reading the whole file.
+ *
+ *	Messages are stored as variable-length records (only the used portion of the file name and message text is
+ *	stored). Every AJADebugLogFile::kBlockSize records start a new block, and the index (each block's file offset,
+ *	and its earliest and latest message time) is written to the end of the file when it's closed. If a file wasn't
+ *	closed (e.g. the writer crashed), the index is rebuilt by scanning the records when it's opened.
+ *	@note	Records are stored in host byte order.
+ *	@ingroup AJAGroupDebug
+ */
+class AJA_EXPORT AJADebugLogFile
+{
+public:
+	static const uint32_t	kBlockSize = 256;	///< Records per index block
+
+	/**
+	 *	One index entry.
+	 */
+	typedef struct Block
+	{
+		uint64_t	fOffset;		/**< File offset of the block's first record */
+		int64_t		fMinTime;		/**< Earliest message time in the block */
+		int64_t		fMaxTime;		/**< Latest message time in the block */
+		uint32_t	fNumRecords;	/**< Number of records in the block */
+		uint32_t	fReserved;
+	} Block;
+
+	AJADebugLogFile();
+	virtual ~AJADebugLogFile();
+
+	/**
+	 *	Creates a new (empty) log file for writing, replacing any existing file at the given path.
+	 *	@param[in]	inFilePath	Specifies the file path.
+	 *	@return		AJA_STATUS_SUCCESS if successful.
+	 */
+	virtual AJAStatus Create (const std::string & inFilePath);
+
+	/**
+	 *	Opens an existing log file for searching.
+	 *	@param[in]	inFilePath	Specifies the file path.
+	 *	@return		AJA_STATUS_SUCCESS if successful.
+	 */
+	virtual AJAStatus Open (const std::string & inFilePath);
+
+	/**
+	 *	Appends a message to the log file I created.
+	 *	@param[in]	inMessage	Specifies the message to append.
+	 *	@return		AJA_STATUS_SUCCESS if successful.
+	 */
+	virtual AJAStatus Append (const AJADebugMessage & inMessage);
+
+	/**
+	 *	Finds all messages whose time falls within the given range.
+	 *	@param[in]	inStartTime		Specifies the earliest message time of interest, in AJADebug time units (microseconds).
+	 *	@param[in]	inEndTime		Specifies the latest message time of interest, in AJADebug time units (microseconds).
+	 *	@param[out]	outMessages		Receives the matching messages, in the order they were appended.
+	 *	@param[in]	inMaxMessages	Optionally limits the number of messages returned. Zero, the default, means no limit.
+	 *	@return		AJA_STATUS_SUCCESS if successful.
+	 */
+	virtual AJAStatus Find (const int64_t inStartTime, const int64_t inEndTime,
+							std::vector<AJADebugMessage> & outMessages, const size_t inMaxMessages = 0);
+
+	/**
+	 *	Writes any buffered records (and, if I'm writing, the index) to the file, and closes it.
+	 *	@return		AJA_STATUS_SUCCESS if successful.
+	 */
+	virtual AJAStatus Close (void);
+
+	inline bool IsOpen (void) const						{return mFile != NULL;}			///< @return	True if I have a file open.
+	inline uint64_t GetMessageCount (void) const		{return mNumMessages;}			///< @return	The number of messages in the file.
+	inline const std::vector<Block> & GetIndex (void) const		{return mBlocks;}		///< @return	The file's index.
+
+private:
+	AJAStatus Flush (void);
+	AJAStatus RebuildIndex (void);
+
+	FILE *					mFile;			///< The open file (NULL if none)
+	bool					mWriting;		///< True if I'm writing
+	uint64_t				mNumMessages;	///< Number of messages in file
+	uint64_t				mFileOffset;	///< File offset of the end of mBuffer
+	uint64_t				mDataEnd;		///< File offset of the end of the records (reading)
+	std::vector<uint8_t>	mBuffer;		///< Buffered records (writing)
+	std::vector<Block>		mBlocks;		///< The index
+};	//	AJADebugLogFile
+
 std::ostream & operator << (std::ostream & oss, const AJADebugStat & inStat);
 
 #endif	//	AJA_DEBUG_H
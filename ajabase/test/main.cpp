@@ -24,18 +24,23 @@
 #include "ajabase/common/timecode.h"
 #include "ajabase/common/timer.h"
 #include "ajabase/common/ajamovingavg.h"
+#include "ajabase/network/udp_socket.h"
 #include "ajabase/persistence/persistence.h"
 #include "ajabase/system/atomic.h"
+#include "ajabase/system/debug.h"
 #include "ajabase/system/file_io.h"
 #include "ajabase/system/info.h"
+#include "ajabase/system/process.h"
 #include "ajabase/system/systemtime.h"
 #include "ajabase/system/thread.h"
 
 #include <algorithm>
 #include <clocale>
+#include <fstream>
 #include <iostream>
 #include <limits>
 #include <string.h>
+#include <thread>
 
 #ifdef AJA_WINDOWS
 #include <direct.h>
@@ -2668,3 +2673,306 @@ TEST_SUITE("file" * doctest::description("functions in ajabase/system/file_io.h"
 	}
 
 } //file
+
+
+void udp_socket_marker() {}
+TEST_SUITE("udp_socket" * doctest::description("functions in ajabase/network/udp_socket.h")) {
+
+	static struct sockaddr_in LoopbackAddress(uint16_t port)
+	{
+		struct sockaddr_in addr;
+		memset(&addr, 0, sizeof(addr));
+		addr.sin_family		 = AF_INET;
+		addr.sin_port		 = htons(port);
+		addr.sin_addr.s_addr = inet_addr("127.0.0.1");
+		return addr;
+	}
+
+	TEST_CASE("AJAUDPPacketBatch")
+	{
+		AJAUDPPacketBatch batch(4, 16);
+		CHECK_EQ(batch.MaxPackets(), 4);
+		CHECK_EQ(batch.MaxPacketSize(), 16);
+		CHECK_EQ(batch.Count(), 0);
+		const struct sockaddr_in addr = LoopbackAddress(1234);
+		uint8_t data[32];
+		for (size_t i = 0; i < sizeof(data); i++)
+			data[i] = uint8_t(i);
+		CHECK(batch.Add(data, 16, addr));
+		CHECK_FALSE(batch.Add(data, 17, addr));		//	too big
+		CHECK(batch.Add(data + 1, 3, addr));
+		CHECK(batch.Add(data, 0, addr));
+		CHECK(batch.Add(data + 2, 8, addr));
+		CHECK(batch.IsFull());
+		CHECK_FALSE(batch.Add(data, 1, addr));		//	full
+		CHECK_EQ(batch.Count(), 4);
+		CHECK_EQ(batch.Length(1), 3);
+		CHECK_EQ(batch.Data(1)[0], 1);
+		CHECK_EQ(batch.Data(3)[7], 9);
+		REQUIRE(batch.Address(2) != NULL);
+		CHECK_EQ(ntohs(batch.Address(2)->sin_port), 1234);
+		CHECK(batch.Data(4) == NULL);
+		CHECK(batch.Address(4) == NULL);
+		CHECK_FALSE(batch.SetCount(5));
+		CHECK_FALSE(batch.SetLength(0, 17));
+		batch.Clear();
+		CHECK_EQ(batch.Count(), 0);
+		CHECK(batch.Allocate(8, 64));
+		CHECK_EQ(batch.MaxPackets(), 8);
+		CHECK_EQ(batch.MaxPacketSize(), 64);
+
+		//	Zero-sized batches have no storage, and no slots...
+		AJAUDPPacketBatch noPackets(0, 64), noBytes(4, 0);
+		CHECK_EQ(noPackets.MaxPackets(), 0);
+		CHECK_EQ(noBytes.MaxPackets(), 0);
+		CHECK_EQ(noBytes.MaxPacketSize(), 0);
+		CHECK(noBytes.IsFull());
+		CHECK(noBytes.Data(0) == NULL);
+		CHECK(noBytes.Address(0) == NULL);
+		CHECK_FALSE(noBytes.Add(data, 1, addr));
+		CHECK_FALSE(batch.Allocate(8, 0));
+		CHECK_EQ(batch.MaxPackets(), 0);
+	}
+
+	TEST_CASE("ReadBatch/WriteBatch loopback")
+	{
+		const uint16_t rxPort(47011), txPort(47012);
+		AJAUDPSocket rx, tx;
+		REQUIRE(rx.Open("127.0.0.1", rxPort) == AJA_STATUS_SUCCESS);
+		REQUIRE(tx.Open("127.0.0.1", txPort) == AJA_STATUS_SUCCESS);
+#if defined(AJA_LINUX)
+		CHECK(rx.EnableReceiveTimestamps(true));
+		CHECK(rx.IsReceiveTimestampsEnabled());
+#endif
+
+		//	Nothing waiting yet
+		AJAUDPPacketBatch rxBatch(16, 1500);
+		CHECK_EQ(rx.ReadBatch(rxBatch, 0), 0);
+
+		//	Send 32 datagrams of varying length & content in one batch
+		const uint32_t numPackets(32);
+		AJAUDPPacketBatch txBatch(numPackets, 1500);
+		const struct sockaddr_in rxAddr = LoopbackAddress(rxPort);
+		for (uint32_t pkt = 0; pkt < numPackets; pkt++)
+		{
+			uint8_t* pData = txBatch.Data(pkt);
+			const uint32_t len = 20 + pkt * 37;
+			for (uint32_t i = 0; i < len; i++)
+				pData[i] = uint8_t(pkt * 7 + i);
+			CHECK(txBatch.SetLength(pkt, len));
+			CHECK(txBatch.SetAddress(pkt, rxAddr));
+		}
+		CHECK(txBatch.SetCount(numPackets));
+		CHECK_EQ(tx.WriteBatch(txBatch), numPackets);
+
+		//	Receive them, 16 at most per call
+		uint32_t received(0), numReads(0);
+		uint64_t lastTimestamp(0);
+		while (received < numPackets && numReads++ < 100)
+		{
+			const uint32_t count = rx.ReadBatch(rxBatch, 500);
+			CHECK_EQ(count, rxBatch.Count());
+			CHECK(count <= rxBatch.MaxPackets());
+			for (uint32_t n = 0; n < count; n++, received++)
+			{
+				const uint32_t len = 20 + received * 37;
+				CHECK_EQ(rxBatch.Length(n), len);
+				CHECK_FALSE(rxBatch.IsTruncated(n));
+				CHECK_EQ(ntohs(rxBatch.Address(n)->sin_port), txPort);
+				bool same(true);
+				for (uint32_t i = 0; i < len && i < rxBatch.MaxPacketSize(); i++)
+					if (rxBatch.Data(n)[i] != uint8_t(received * 7 + i))
+						same = false;
+				CHECK(same);
+#if defined(AJA_LINUX)
+				CHECK(rxBatch.Timestamp(n) != 0);
+				CHECK(rxBatch.Timestamp(n) >= lastTimestamp);
+				lastTimestamp = rxBatch.Timestamp(n);
+#endif
+			}
+		}
+		CHECK_EQ(received, numPackets);
+		CHECK_EQ(rx.ReadBatch(rxBatch, 0), 0);
+
+		//	Datagrams larger than the batch's buffers are truncated
+		AJAUDPPacketBatch smallBatch(4, 64);
+		txBatch.SetLength(1, 200);
+		txBatch.SetCount(2);
+		CHECK_EQ(tx.WriteBatch(txBatch), 2);
+		std::vector<bool> truncated;
+		numReads = 0;
+		while (truncated.size() < 2 && numReads++ < 10)
+		{
+			const uint32_t count = rx.ReadBatch(smallBatch, 500);
+			for (uint32_t n = 0; n < count; n++)
+				truncated.push_back(smallBatch.IsTruncated(n));
+		}
+		REQUIRE_EQ(truncated.size(), 2);
+#if defined(AJA_LINUX)
+		CHECK_FALSE(truncated[0]);
+		CHECK(truncated[1]);
+		CHECK_EQ(smallBatch.Length(smallBatch.Count() - 1), 64);
+#endif
+		rx.Close();
+		tx.Close();
+	}
+
+} //udp_socket
+
+
+void debug_marker() {}
+TEST_SUITE("debug" * doctest::description("functions in ajabase/system/debug.h")) {
+
+	static void makeDebugMessage (AJADebugMessage & outMsg, const uint64_t inSeqNum, const int64_t inTime)
+	{
+		::memset(&outMsg, 0, sizeof(outMsg));
+		outMsg.sequenceNumber = inSeqNum;
+		outMsg.time = inTime;
+		outMsg.wallTime = 1700000000;
+		outMsg.groupIndex = int32_t(inSeqNum % 3);
+		outMsg.destinationMask = AJA_DEBUG_DESTINATION_DEBUG;
+		outMsg.severity = AJA_DebugSeverity_Info;
+		outMsg.lineNumber = int32_t(inSeqNum);
+		outMsg.pid = 1234;
+		outMsg.tid = 5678;
+		::snprintf(outMsg.fileName, sizeof(outMsg.fileName), "file%u.cpp", unsigned(inSeqNum % 7));
+		::snprintf(outMsg.messageText, sizeof(outMsg.messageText), "message %u", unsigned(inSeqNum));
+	}
+
+	TEST_CASE("AJADebugLogFile")
+	{
+		std::string tempDir;
+		if (AJA_FAILURE(AJAFileIO::TempDirectory(tempDir)))
+			tempDir = ".";
+		const std::string path (tempDir + std::string(1, AJA_PATHSEP) + "ajadebuglogfile_test.bin");
+		const std::string pathNoIndex (path + ".noindex");
+		const uint32_t numMsgs (1000);
+		std::vector<AJADebugMessage> found;
+		AJADebugMessage msg;
+
+		AJADebugLogFile writer;
+		CHECK_FALSE(writer.IsOpen());
+		CHECK(AJA_FAILURE(writer.Append(msg)));
+		CHECK(AJA_SUCCESS(writer.Create(path)));
+		for (uint32_t num(1);  num <= numMsgs;  num++)
+		{
+			makeDebugMessage(msg, num, int64_t(num) * 10);
+			CHECK(AJA_SUCCESS(writer.Append(msg)));
+		}
+		CHECK_EQ(writer.GetMessageCount(), numMsgs);
+		CHECK_EQ(writer.GetIndex().size(), (numMsgs + AJADebugLogFile::kBlockSize - 1) / AJADebugLogFile::kBlockSize);
+		CHECK(AJA_FAILURE(writer.Find(0, 1000000, found)));	//	Can't search while writing
+		CHECK(AJA_SUCCESS(writer.Close()));
+
+		AJADebugLogFile reader;
+		CHECK(AJA_SUCCESS(reader.Open(path)));
+		CHECK_EQ(reader.GetMessageCount(), numMsgs);
+		REQUIRE_EQ(reader.GetIndex().size(), 4);
+		CHECK_EQ(reader.GetIndex().at(1).fMinTime, 2570);
+		CHECK_EQ(reader.GetIndex().at(1).fMaxTime, 5120);
+		CHECK(AJA_SUCCESS(reader.Find(2000, 2990, found)));
+		REQUIRE_EQ(found.size(), 100);
+		CHECK_EQ(found.front().sequenceNumber, 200);
+		CHECK_EQ(found.front().time, 2000);
+		CHECK_EQ(found.front().lineNumber, 200);
+		CHECK_EQ(found.front().groupIndex, 2);
+		CHECK_EQ(found.front().pid, 1234);
+		CHECK_EQ(found.front().tid, 5678);
+		CHECK_EQ(std::string(found.front().fileName), "file4.cpp");
+		CHECK_EQ(std::string(found.front().messageText), "message 200");
+		CHECK_EQ(std::string(found.back().messageText), "message 299");
+		CHECK(AJA_SUCCESS(reader.Find(0, 100000, found, 10)));
+		CHECK_EQ(found.size(), 10);
+		CHECK(AJA_SUCCESS(reader.Find(20000, 30000, found)));
+		CHECK(found.empty());
+		CHECK(AJA_SUCCESS(reader.Close()));
+
+		//	Strip the index & footer (as if the writer crashed), and make sure the index gets rebuilt...
+		{
+			std::ifstream ifs (path.c_str(), std::ios::binary);
+			std::vector<char> bytes ((std::istreambuf_iterator<char>(ifs)), std::istreambuf_iterator<char>());
+			const size_t indexBytes (4 * sizeof(AJADebugLogFile::Block) + 24);
+			REQUIRE(bytes.size() > indexBytes);
+			std::ofstream ofs (pathNoIndex.c_str(), std::ios::binary);
+			ofs.write(&bytes[0], std::streamsize(bytes.size() - indexBytes - 10));	//	Also truncate the last record
+		}
+		CHECK(AJA_SUCCESS(reader.Open(pathNoIndex)));
+		CHECK_EQ(reader.GetMessageCount(), numMsgs - 1);
+		CHECK_EQ(reader.GetIndex().size(), 4);
+		CHECK(AJA_SUCCESS(reader.Find(9980, 10000, found)));
+		REQUIRE_EQ(found.size(), 2);
+		CHECK_EQ(std::string(found.back().messageText), "message 999");
+		reader.Close();
+		CHECK(AJA_FAILURE(reader.Open(tempDir + std::string(1, AJA_PATHSEP) + "ajadebuglogfile_missing.bin")));
+		::remove(path.c_str());
+		::remove(pathNoIndex.c_str());
+	}
+
+	TEST_CASE("AJADebugReader")
+	{
+		AJADebugReader filters;
+		filters.SetAllUnits(false).SetUnit(AJA_DebugUnit_AJAAncList, true).SetAllSeverities(false).SetSeverity(AJA_DebugSeverity_Error, true);
+		CHECK(filters.AcceptsUnit(AJA_DebugUnit_AJAAncList));
+		CHECK_FALSE(filters.AcceptsUnit(AJA_DebugUnit_Unknown));
+		CHECK_FALSE(filters.AcceptsUnit(-1));
+		CHECK_FALSE(filters.AcceptsUnit(AJA_DEBUG_UNIT_ARRAY_SIZE));
+		CHECK(filters.AcceptsSeverity(AJA_DebugSeverity_Error));
+		CHECK_FALSE(filters.AcceptsSeverity(AJA_DebugSeverity_Warning));
+
+		if (AJA_FAILURE(AJADebug::Open()))
+			{WARN_MESSAGE(false, "AJADebug facility can't be opened -- skipping reader tests");  return;}
+		int32_t refCount(0);
+		AJADebug::GetClientReferenceCount(&refCount);
+		AJADebug::SetClientReferenceCount(refCount + 1);
+		uint32_t oldDest[2] = {0, 0};
+		AJADebug::GetDestination(AJA_DebugUnit_Unknown, &oldDest[0]);
+		AJADebug::GetDestination(AJA_DebugUnit_AJAAncList, &oldDest[1]);
+		AJADebug::Enable(AJA_DebugUnit_Unknown, AJA_DEBUG_DESTINATION_DEBUG);
+		AJADebug::Enable(AJA_DebugUnit_AJAAncList, AJA_DEBUG_DESTINATION_DEBUG);
+
+		AJADebugReader reader;
+		reader.SetProcessID(AJAProcess::GetPid()).SetUnit(AJA_DebugUnit_Unknown, false);
+		std::vector<AJADebugMessage> msgs;
+		CHECK_FALSE(reader.Wait(0));
+		CHECK_FALSE(reader.Wait(20));
+		CHECK_EQ(reader.Read(msgs), 0);
+
+		for (int num(0);  num < 10;  num++)
+		{
+			AJADebug::Report(AJA_DebugUnit_Unknown, AJA_DebugSeverity_Info, __FILE__, __LINE__, std::string("skip me"));
+			AJADebug::Report(AJA_DebugUnit_AJAAncList, AJA_DebugSeverity_Info, __FILE__, __LINE__, "keep %d", num);
+		}
+		CHECK(reader.Wait(0));
+		CHECK_EQ(reader.Read(msgs, 4), 4);
+		CHECK_EQ(std::string(msgs.front().messageText), "keep 0");
+		CHECK_EQ(reader.Read(msgs), 6);
+		CHECK_EQ(std::string(msgs.back().messageText), "keep 9");
+		CHECK_EQ(msgs.back().groupIndex, int32_t(AJA_DebugUnit_AJAAncList));
+		CHECK_EQ(msgs.back().pid, AJAProcess::GetPid());
+		CHECK_EQ(reader.GetStats().fMessagesRead, 10);
+		CHECK_EQ(reader.GetStats().fMessagesFiltered, 10);
+		CHECK_EQ(reader.GetStats().fMessagesDropped, 0);
+		CHECK_FALSE(reader.Wait(0));
+
+		//	A message reported from another thread wakes a waiting reader...
+		const uint64_t waitStart (AJATime::GetSystemMilliseconds());
+		std::thread writer ([]{AJATime::Sleep(50);  AJADebug::Report(AJA_DebugUnit_AJAAncList, AJA_DebugSeverity_Info, __FILE__, __LINE__, std::string("wake"));});
+		CHECK(reader.Wait(5000));
+		CHECK(AJATime::GetSystemMilliseconds() - waitStart < 4000);
+		writer.join();
+		CHECK_EQ(reader.Read(msgs), 1);
+
+		//	Overrun the ring...
+		for (int num(0);  num < AJA_DEBUG_MESSAGE_RING_SIZE + 100;  num++)
+			AJADebug::Report(AJA_DebugUnit_AJAAncList, AJA_DebugSeverity_Info, __FILE__, __LINE__, "lap %d", num);
+		CHECK_EQ(reader.Read(msgs), AJA_DEBUG_MESSAGE_RING_SIZE);
+		CHECK_EQ(std::string(msgs.front().messageText), "lap 100");
+		CHECK_EQ(reader.GetStats().fMessagesDropped, 100);
+
+		AJADebug::SetDestination(AJA_DebugUnit_Unknown, oldDest[0]);
+		AJADebug::SetDestination(AJA_DebugUnit_AJAAncList, oldDest[1]);
+		AJADebug::SetClientReferenceCount(refCount);
+		AJADebug::Close();
+	}
+
+} //debug
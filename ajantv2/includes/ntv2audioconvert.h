@@ -0,0 +1,169 @@
+/* SPDX-License-Identifier: MIT */
+/**
+	@file		ntv2audioconvert.h
+	@brief		Declares the NTV2AudioConverter class, which de-interleaves, converts and remaps host audio sample buffers.
+	@copyright	(C) 2026 AJA Video Systems, Inc.
+**/
+
+#ifndef NTV2AUDIOCONVERT_H
+#define NTV2AUDIOCONVERT_H
+
+#include "ajaexport.h"
+#include "ajatypes.h"
+
+
+/**
+	@brief	Identifies the dither applied when reducing audio sample bit depth.
+**/
+typedef enum
+{
+	NTV2_AUDIO_DITHER_NONE,			///< @brief	No dither -- round to nearest
+	NTV2_AUDIO_DITHER_RECTANGULAR,	///< @brief	Rectangular (uniform) dither of ±1/2 LSB before rounding
+	NTV2_AUDIO_DITHER_TRIANGULAR,	///< @brief	Triangular (TPDF) dither of ±1 LSB before rounding
+	NTV2_AUDIO_DITHER_INVALID
+} NTV2AudioDither;
+
+#define	NTV2_IS_VALID_AUDIO_DITHER(__d__)	((__d__) >= NTV2_AUDIO_DITHER_NONE  &&  (__d__) < NTV2_AUDIO_DITHER_INVALID)
+
+
+/**
+	@brief		Kernels for the interleaved 32-bit audio that AJA devices capture and play:  de-interleaving to (and
+				interleaving from) planar buffers, sample format conversion, and channel remapping.
+	@details	<b>Sample formats</b> -- Device audio samples are signed 32-bit integers, with 24-bit audio in the
+				most significant 24 bits. Conversions are defined as follows:
+				-	float:  full scale is ±1.0 (i.e. the 32-bit value divided by 2^31). Float values are clamped to
+					[-1.0, +1.0] (NaN becomes -1.0), and rounded to nearest (ties to even) when converted back.
+				-	16-bit:  the most significant 16 bits. Conversion to 16 bits rounds to nearest, after applying the
+					current dither (see setDither), and saturates.
+				-	24-bit:  the most significant 24 bits, packed into 3 little-endian bytes per sample (as used by
+					24-bit WAVE files). Conversion to 24 bits is rounded, dithered and saturated like 16-bit.
+				<b>Frames &amp; planes</b> -- An interleaved buffer holds "frames" of one sample per channel. A planar
+				buffer holds one channel's samples, and the planes are passed as an array of pointers. Any number of
+				channels (up to kMaxChannels) is supported, which includes MADI's 64.
+				<b>Channel maps</b> -- RemapChannels gathers each output channel from the input channel given by the
+				map (or silence, for a negative map entry). ScatterChannels does the reverse, storing each input
+				channel into the output channel given by the map (or nowhere, for a negative entry), leaving the
+				other output channels unchanged. Runs of consecutive channels are copied as blocks.
+				<b>Vectorization</b> -- On x86 the de-interleave, interleave and conversion kernels use SSE2. Other
+				architectures use the scalar kernels, which produce identical results (including the dither, which
+				is generated by four interleaved xorshift generators).
+	@note		Buffers must not overlap (except where noted).
+**/
+class AJAExport NTV2AudioConverter
+{
+	//	CLASS METHODS
+	public:
+		static const ULWord		kMaxChannels	= 128;	///< @brief	Maximum number of channels per frame
+
+		/**
+			@return		True if the vectorized kernels are available on this host;  otherwise false.
+		**/
+		static bool				IsSIMDAvailable (void);
+
+	//	INSTANCE METHODS
+	public:
+								NTV2AudioConverter ();
+		virtual inline			~NTV2AudioConverter ()	{}
+
+		/**
+			@name	De-interleave & Interleave
+		**/
+		///@{
+		/**
+			@brief		Splits interleaved samples into planes.
+			@param[in]	pInFrames		Specifies the interleaved samples ("inNumChannels" per frame).
+			@param[in]	inNumChannels	Specifies the number of channels per frame.
+			@param[out]	pOutPlanes		Specifies "inNumChannels" plane pointers, each of which receives "inNumFrames" samples.
+			@param[in]	inNumFrames		Specifies the number of frames.
+			@return		True if successful;  otherwise false.
+		**/
+		virtual bool			Deinterleave (const int32_t * pInFrames, const ULWord inNumChannels, int32_t * const * pOutPlanes, const ULWord inNumFrames);
+
+		/**
+			@brief		Same as Deinterleave, but also converts each sample to float.
+		**/
+		virtual bool			DeinterleaveToFloat (const int32_t * pInFrames, const ULWord inNumChannels, float * const * pOutPlanes, const ULWord inNumFrames);
+
+		/**
+			@brief		Merges planes into interleaved samples.
+			@param[in]	pInPlanes		Specifies "inNumChannels" plane pointers, each of which holds "inNumFrames" samples.
+			@param[in]	inNumChannels	Specifies the number of channels per frame.
+			@param[out]	pOutFrames		Receives the interleaved samples.
+			@param[in]	inNumFrames		Specifies the number of frames.
+			@return		True if successful;  otherwise false.
+		**/
+		virtual bool			Interleave (const int32_t * const * pInPlanes, const ULWord inNumChannels, int32_t * pOutFrames, const ULWord inNumFrames);
+
+		/**
+			@brief		Same as Interleave, but also converts each sample from float.
+		**/
+		virtual bool			InterleaveFromFloat (const float * const * pInPlanes, const ULWord inNumChannels, int32_t * pOutFrames, const ULWord inNumFrames);
+		///@}
+
+		/**
+			@name	Sample Format Conversion
+			@brief	Each converts "inNumSamples" samples. The input and output may be the same buffer, except for
+					Int16ToInt32 and Int24ToInt32 (whose output samples are larger than their input samples).
+		**/
+		///@{
+		virtual bool			Int32ToFloat (const int32_t * pInSamples, float * pOutSamples, const ULWord inNumSamples);
+		virtual bool			FloatToInt32 (const float * pInSamples, int32_t * pOutSamples, const ULWord inNumSamples);
+		virtual bool			Int32ToInt16 (const int32_t * pInSamples, int16_t * pOutSamples, const ULWord inNumSamples);	///< @brief	Dithered per setDither.
+		virtual bool			Int16ToInt32 (const int16_t * pInSamples, int32_t * pOutSamples, const ULWord inNumSamples);
+		virtual bool			Int32ToInt24 (const int32_t * pInSamples, UByte * pOutSamples, const ULWord inNumSamples);		///< @brief	Dithered per setDither. Writes 3 bytes per sample.
+		virtual bool			Int24ToInt32 (const UByte * pInSamples, int32_t * pOutSamples, const ULWord inNumSamples);		///< @brief	Reads 3 bytes per sample.
+		///@}
+
+		/**
+			@name	Channel Maps
+		**/
+		///@{
+		/**
+			@brief		Builds frames of "inNumOutChannels" channels, each gathered from the input channel given by the map.
+			@param[in]	pInFrames			Specifies the input frames.
+			@param[in]	inNumInChannels		Specifies the number of channels per input frame.
+			@param[out]	pOutFrames			Receives the output frames. Must not overlap the input.
+			@param[in]	inNumOutChannels	Specifies the number of channels per output frame.
+			@param[in]	pInMap				Specifies "inNumOutChannels" input channel numbers. A negative entry silences that output channel.
+			@param[in]	inNumFrames			Specifies the number of frames.
+			@return		True if successful;  otherwise false (e.g. a map entry is out of range).
+		**/
+		virtual bool			RemapChannels (const int32_t * pInFrames, const ULWord inNumInChannels, int32_t * pOutFrames,
+												const ULWord inNumOutChannels, const int * pInMap, const ULWord inNumFrames);
+
+		/**
+			@brief		Stores each input channel into the output channel given by the map. Output channels that aren't
+						mapped are left unchanged (e.g. to assemble a 16-channel frame from several stereo pairs).
+			@param[in]	pInFrames			Specifies the input frames.
+			@param[in]	inNumInChannels		Specifies the number of channels per input frame.
+			@param		pOutFrames			Specifies the output frames. Must not overlap the input.
+			@param[in]	inNumOutChannels	Specifies the number of channels per output frame.
+			@param[in]	pInMap				Specifies "inNumInChannels" output channel numbers. A negative entry discards that input channel.
+			@param[in]	inNumFrames			Specifies the number of frames.
+			@return		True if successful;  otherwise false (e.g. a map entry is out of range).
+		**/
+		virtual bool			ScatterChannels (const int32_t * pInFrames, const ULWord inNumInChannels, int32_t * pOutFrames,
+												const ULWord inNumOutChannels, const int * pInMap, const ULWord inNumFrames);
+		///@}
+
+		/**
+			@name	Options
+		**/
+		///@{
+		NTV2AudioConverter &			setDither (const NTV2AudioDither inDither);		///< @brief	Sets the dither used when reducing bit depth (defaults to ::NTV2_AUDIO_DITHER_TRIANGULAR).
+		NTV2AudioConverter &			setDitherSeed (const ULWord inSeed);			///< @brief	Reseeds the dither generators (for repeatable output).
+		inline NTV2AudioConverter &		setUseSIMD (const bool inUseSIMD)				{mUseSIMD = inUseSIMD; return *this;}	///< @brief	Enables/disables the SSE2 kernels (for testing).
+		inline NTV2AudioDither			getDither (void) const							{return mDither;}
+		inline bool						getUseSIMD (void) const							{return mUseSIMD;}
+		///@}
+
+	private:
+		bool					Requantize (const int32_t * pInSamples, void * pOutSamples, const ULWord inNumSamples, const ULWord inShift);
+
+	private:
+		NTV2AudioDither			mDither;		///< @brief	Dither used when reducing bit depth
+		bool					mUseSIMD;		///< @brief	Use SSE2 kernels?
+		ULWord					mDitherState[4];	///< @brief	Dither generator states (one per SIMD lane)
+};	//	NTV2AudioConverter
+
+#endif	//	NTV2AUDIOCONVERT_H
@@ -0,0 +1,140 @@
+/* SPDX-License-Identifier: MIT */
+/**
+	@file		ntv2audiostreamreader.h
+	@brief		Declares the NTV2AudioStreamReader class, which continuously reads an Audio System's capture buffer without AutoCirculate.
+	@copyright	(C) 2026 AJA Video Systems, Inc.
+**/
+
+#ifndef NTV2AUDIOSTREAMREADER_H
+#define NTV2AUDIOSTREAMREADER_H
+
+#include "ajaexport.h"
+#include "ajatypes.h"
+#include "ntv2enums.h"
+#include "ntv2publicinterface.h"
+
+class CNTV2Card;
+
+
+/**
+	@brief	Follows the capture (input) ring buffer of one ::NTV2AudioSystem on an AJA device, and transfers its audio
+			into a preallocated host ring of fixed-size sample blocks, without using AutoCirculate.
+	@details	Each call to Poll reads the device's "Write Head" (see CNTV2Card::ReadAudioLastIn), then transfers every
+				complete block that has been captured since the previous call. A block that straddles the end of the
+				device ring (see CNTV2Card::GetAudioWrapAddress) is transferred in two DMA segments, so each host block
+				is always contiguous. Completed blocks are then handed to the client as zero-copy views into the host
+				ring (see AcquireBlock and ReleaseBlock).
+				<b>Latency</b> -- The device backlog is limited to a maximum number of blocks (see setMaxLatencyBlocks):
+				when Poll finds more than that, the oldest blocks are skipped. If Poll isn't called often enough, and the
+				device laps the reader, the reader resynchronizes to the Write Head. If the host ring is full (i.e. the
+				client isn't releasing blocks fast enough), newly-captured blocks are dropped. Each of these is counted
+				(see GetStats).
+	@note		The client is responsible for configuring and starting the Audio System's input (see
+				CNTV2Card::StartAudioInput). The audio samples are 32-bit, and the number of channels per sample frame
+				is that of the Audio System when Start is called.
+	@note		An instance isn't thread-safe. Poll, AcquireBlock and ReleaseBlock should be called from one thread.
+**/
+class AJAExport NTV2AudioStreamReader
+{
+	public:
+		/**
+			@brief	Counters describing what happened since Start was called.
+		**/
+		typedef struct Stats
+		{
+			uint64_t	fBlocksRead;		///< @brief	Number of blocks transferred into the host ring
+			uint64_t	fDMATransfers;		///< @brief	Number of DMA transfers
+			ULWord		fWrapSplits;		///< @brief	Number of blocks transferred in two segments (due to device ring wrap)
+			ULWord		fDeviceOverruns;	///< @brief	Number of times the device lapped the reader (causing a resync)
+			ULWord		fLatencySkips;		///< @brief	Number of blocks skipped to keep within the maximum latency
+			ULWord		fHostOverruns;		///< @brief	Number of blocks dropped because the host ring was full
+			ULWord		fMaxBacklogBytes;	///< @brief	Largest device backlog seen by Poll, in bytes
+			inline Stats () : fBlocksRead(0), fDMATransfers(0), fWrapSplits(0), fDeviceOverruns(0), fLatencySkips(0),
+								fHostOverruns(0), fMaxBacklogBytes(0)	{}
+		} Stats;
+
+		/**
+			@brief		My constructor.
+			@param		inDevice	Specifies the (open) device whose audio is to be read. It must outlive me.
+		**/
+								NTV2AudioStreamReader (CNTV2Card & inDevice);
+		virtual					~NTV2AudioStreamReader ();
+
+		/**
+			@brief		Allocates the host ring, and starts following the given Audio System's capture buffer from its
+						current Write Head position. Audio captured before this call is ignored.
+			@param[in]	inAudioSystem		Specifies the Audio System to read from.
+			@param[in]	inSamplesPerBlock	Specifies the number of sample frames in each block.
+			@param[in]	inNumBlocks			Specifies the number of blocks in the host ring. Must be at least 2.
+			@return		True if successful;  otherwise false.
+		**/
+		virtual bool			Start (const NTV2AudioSystem inAudioSystem, const ULWord inSamplesPerBlock, const ULWord inNumBlocks = 16);
+
+		/**
+			@brief		Stops reading, and frees the host ring. Any views handed out by AcquireBlock become invalid.
+		**/
+		virtual void			Stop (void);
+
+		/**
+			@brief		Transfers every complete block captured since the previous call into the host ring.
+			@return		True if successful;  false if not started, or if a register read or DMA transfer failed.
+		**/
+		virtual bool			Poll (void);
+
+		/**
+			@brief		Answers with the oldest completed block, without copying it.
+			@param[out]	outBlock	Receives a view of the block in the host ring, which remains valid until ReleaseBlock
+									or Stop is called. It must not be used to modify the ring.
+			@return		True if a block was available;  otherwise false.
+			@note		Calling this again before ReleaseBlock answers with the same block.
+		**/
+		virtual bool			AcquireBlock (NTV2Buffer & outBlock);
+
+		/**
+			@brief		Releases the block most recently answered by AcquireBlock, making its host ring slot available
+						for new audio.
+			@return		True if successful;  false if no block was available.
+		**/
+		virtual bool			ReleaseBlock (void);
+
+		/**
+			@name	Options
+		**/
+		///@{
+		inline NTV2AudioStreamReader &	setMaxLatencyBlocks (const ULWord inNumBlocks)	{mMaxLatencyBlocks = inNumBlocks; return *this;}	///< @brief	Limits the device backlog Poll will transfer (zero, the default, limits it to what the device ring can hold).
+		inline ULWord					getMaxLatencyBlocks (void) const				{return mMaxLatencyBlocks;}
+		///@}
+
+		inline bool				IsRunning (void) const			{return mRunning;}							///< @return	True if started.
+		inline NTV2AudioSystem	GetAudioSystem (void) const		{return mAudioSystem;}						///< @return	The Audio System being read.
+		inline ULWord			GetNumChannels (void) const		{return mNumChannels;}						///< @return	The number of audio channels per sample frame.
+		inline ULWord			GetBlockBytes (void) const		{return mBlockBytes;}						///< @return	The size of each block, in bytes.
+		inline ULWord			GetNumBlocks (void) const		{return mNumBlocks;}						///< @return	The number of blocks in the host ring.
+		inline ULWord			GetNumReadyBlocks (void) const	{return ULWord(mBlocksFilled - mBlocksReleased);}	///< @return	The number of completed blocks not yet released.
+		inline const Stats &	GetStats (void) const			{return mStats;}							///< @return	My counters.
+
+	private:
+		NTV2AudioStreamReader (const NTV2AudioStreamReader & inObj);				//	No copies
+		NTV2AudioStreamReader & operator = (const NTV2AudioStreamReader & inRHS);	//	No copies
+		bool					TransferBlock (UByte * pOutBlock);
+
+	private:
+		CNTV2Card &				mDevice;			///< @brief	Device being read
+		NTV2AudioSystem			mAudioSystem;		///< @brief	Audio System being read
+		bool					mRunning;			///< @brief	Started?
+		ULWord					mMaxLatencyBlocks;	///< @brief	Maximum device backlog, in blocks (0 = device ring capacity)
+		ULWord					mNumChannels;		///< @brief	Channels per sample frame
+		ULWord					mFrameBytes;		///< @brief	Bytes per sample frame
+		ULWord					mBlockBytes;		///< @brief	Bytes per block
+		ULWord					mNumBlocks;			///< @brief	Blocks in host ring
+		ULWord					mCaptureOffset;		///< @brief	Offset of the capture buffer from the start of the Audio System's buffer
+		ULWord					mDeviceRingBytes;	///< @brief	Size of the device capture ring (its wrap address)
+		ULWord					mDevicePos;			///< @brief	Next byte to read, relative to the capture buffer
+		ULWord					mLeftoverBytes;		///< @brief	Device backlog left untransferred by the previous Poll
+		uint64_t				mBlocksFilled;		///< @brief	Total blocks written into the host ring
+		uint64_t				mBlocksReleased;	///< @brief	Total blocks released by the client
+		NTV2Buffer				mHostRing;			///< @brief	Host ring
+		Stats					mStats;				///< @brief	My counters
+};	//	NTV2AudioStreamReader
+
+#endif	//	NTV2AUDIOSTREAMREADER_H
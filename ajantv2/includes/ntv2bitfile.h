@@ -209,6 +209,11 @@ class AJAExport CNTV2Bitfile
 		**/
 		virtual inline size_t	GetProgramStreamLength (void) const		{return mReady ? size_t(mHeaderParser.ProgramSizeBytes()) : 0;}
 
+		/**
+			@return		Byte offset of the program stream within the file, or zero if error/invalid.
+		**/
+		virtual inline size_t	GetProgramStreamOffset (void) const		{return mReady ? size_t(mHeaderParser.ProgramOffsetBytes()) : 0;}
+
 		/**
 			@return		File stream length in bytes, or zero if error/invalid.
 		**/
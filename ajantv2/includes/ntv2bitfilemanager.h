@@ -10,6 +10,7 @@
 
 #include <string>
 #include <vector>
+#include <map>
 #include <fstream>
 #ifdef AJALinux
 	#include <stdint.h>
@@ -47,11 +48,37 @@ typedef NTV2BitfileInfoList::const_iterator	NTV2BitfileInfoListConstIter;
 
 /**
 	@brief	I manage and cache any number of bitfiles for any number of NTV2 devices/designs.
+	@details	<b>Catalog</b> -- If enabled (see SetUseCatalog), AddDirectory keeps a catalog file (named ".ntv2bitfilecatalog")
+				in each directory it scans, that records the header information of every bitfile in the directory, along
+				with each file's size, modification time (to the nanosecond) and inode. On later scans, bitfiles whose
+				size, modification time and inode haven't changed are added straight from the catalog, without opening
+				them. New or changed bitfiles are parsed as usual, and the catalog is rewritten (if the directory is
+				writable). Catalogs are off by default, since they write into the scanned directory.
+				<b>Bitstreams</b> -- The first request for a bitstream memory-maps its bitfile (where supported), so that
+				switching between bitstreams that have already been requested involves no parsing or reading. GetBitStream
+				always hands out a copy that the caller owns. GetBitStreamView avoids even the copy, by referencing the
+				cached bitstream directly (see its lifetime rules). Before each request, the bitfile's size, modification
+				time and inode are checked again, and if they changed, the stale mapping is dropped and the bitstream is
+				read from the file instead.
 	@note	This class is not thread-safe.
 **/
 class AJAExport CNTV2BitfileManager
 {
 public:
+	/**
+		@brief	Counters that describe how much work I've done since I was constructed or last cleared.
+	**/
+	typedef struct Stats
+	{
+		ULWord	fHeadersParsed;		///< @brief	Number of bitfiles whose headers were read and parsed
+		ULWord	fCatalogHits;		///< @brief	Number of bitfiles added from a catalog, without being opened
+		ULWord	fCatalogsWritten;	///< @brief	Number of catalog files (re)written
+		ULWord	fBitstreamsMapped;	///< @brief	Number of bitstreams that were memory-mapped
+		ULWord	fBitstreamsRead;	///< @brief	Number of bitstreams that had to be read into host memory
+		ULWord	fMappingsDropped;	///< @brief	Number of mappings dropped because their bitfile changed after it was mapped
+		inline Stats () : fHeadersParsed(0), fCatalogHits(0), fCatalogsWritten(0), fBitstreamsMapped(0), fBitstreamsRead(0), fMappingsDropped(0)	{}
+	} Stats;
+
 	/**
 		@brief		My constructor.
 	**/
@@ -70,14 +97,15 @@ public:
 	virtual bool						AddFile (const std::string & inBitfilePath);
 
 	/**
-		@brief		Add the bitfile(s) at the given path to the list of bitfiles.
+		@brief		Add the bitfile(s) at the given path to the list of bitfiles, using (and updating) the
+					directory's bitfile catalog, if enabled.
 		@param[in]	inDirectory		Specifies the path name to the directory.
 		@return		True if successful; otherwise false.
 	**/
 	virtual bool						AddDirectory (const std::string & inDirectory);
 
 	/**
-		@brief		Clear the list of bitfiles.
+		@brief		Clear the list of bitfiles, and unmap/free all cached bitstreams.
 	**/
 	virtual void						Clear (void);
 
@@ -95,8 +123,9 @@ public:
 
 	/**
 		@brief		Retrieves the bitstream specified by design ID & version, and bitfile ID & version.
-					It loads it into host memory, and updates/reallocates the given NTV2Buffer to access it.
-		@param[out]	outBitstream		Receives the bitstream in this NTV2Buffer.
+		@param[out]	outBitstream		Receives a copy of the bitstream. If it's a client-supplied buffer of the right
+										size, the bitstream is copied into it; otherwise it's (re)allocated by the SDK.
+										It never refers to my own memory afterward, even if it did before the call.
 		@param[in]	inDesignID			Specifies the design ID.
 		@param[in]	inDesignVersion		Specifies the design version.
 		@param[in]	inBitfileID			Specifies the bitfile ID.
@@ -111,7 +140,63 @@ public:
 													  const ULWord inBitfileVersion,
 													  const ULWord inBitfileFlags);
 
+	/**
+		@brief		Like GetBitStream, but sets the given buffer to reference my cached bitstream, instead of copying it.
+		@param[out]	outView				Receives a view of the bitstream, which must be treated as read-only (it's usually
+										a read-only memory-mapping of the bitfile, and writing into it will crash). The view
+										is only valid until Clear is called, I'm destroyed, or a later request for the same
+										bitstream finds that its bitfile changed. Any memory the buffer owned before the call
+										is freed.
+		@param[in]	inDesignID			Specifies the design ID.
+		@param[in]	inDesignVersion		Specifies the design version.
+		@param[in]	inBitfileID			Specifies the bitfile ID.
+		@param[in]	inBitfileVersion	Specifies the bitfile version (0xff for latest).
+		@param[in]	inBitfileFlags		Specifies the bitfile flags.
+		@return		True if the bitfile is present and loads successfully; otherwise false.
+		@note		Bitfiles shouldn't be modified in place while views of them are in use. Replace them instead (e.g. by
+					writing a new file and renaming it over the old one).
+	**/
+	virtual bool						GetBitStreamView (NTV2Buffer & outView,
+														  const ULWord inDesignID,
+														  const ULWord inDesignVersion,
+														  const ULWord inBitfileID,
+														  const ULWord inBitfileVersion,
+														  const ULWord inBitfileFlags);
+
+	/**
+		@brief		Enables or disables the use of per-directory bitfile catalogs by AddDirectory. Disabled by default.
+					Only enable catalogs for directories the application owns (e.g. its own firmware cache), since
+					AddDirectory writes the catalog file (and a temporary file) into each directory it scans.
+		@param[in]	inUseCatalog	Specify true to use catalogs;  false to always open and parse every bitfile.
+	**/
+	virtual inline void					SetUseCatalog (const bool inUseCatalog)		{_useCatalog = inUseCatalog;}
+
+	/**
+		@return		True if AddDirectory uses bitfile catalogs.
+	**/
+	virtual inline bool					GetUseCatalog (void) const					{return _useCatalog;}
+
+	/**
+		@return		My work counters.
+	**/
+	virtual inline const Stats &		GetStats (void) const						{return _stats;}
+
+	/**
+		@return		The name of the catalog file that AddDirectory keeps in each directory.
+	**/
+	static std::string					GetCatalogFileName (void);
+
 private:
+	CNTV2BitfileManager (const CNTV2BitfileManager & inObj);				//	No copies
+	CNTV2BitfileManager & operator = (const CNTV2BitfileManager & inRHS);	//	No copies
+
+	/**
+		@brief		Finds the bitstream specified by design ID & version, and bitfile ID & version, and makes sure it's cached.
+		@param[out]	outIndex	Receives the index of the bitfile info.
+		@return		True if the bitstream was found and cached; otherwise false.
+	**/
+	bool FindBitstream (size_t & outIndex, const ULWord inDesignID, const ULWord inDesignVersion,
+						const ULWord inBitfileID, const ULWord inBitfileVersion, const ULWord inBitfileFlags);
 
 	/**
 		@brief		Read the specified bitstream.
@@ -119,12 +204,72 @@ private:
 		@return		True if the bitstream was read; otherwise false.
 	**/
 	bool ReadBitstream (const size_t inIndex);
-		
-	typedef std::vector <NTV2Buffer>	NTV2BitstreamList;
-	typedef NTV2BitstreamList::iterator	NTV2BitstreamListIter;
+
+	/**
+		@brief		Memory-map the specified bitfile.
+		@param[in]	inIndex		Specifies the index of the bitfile info.
+		@return		True if the bitfile was mapped; otherwise false.
+	**/
+	bool MapBitfile (const size_t inIndex);
+
+	/**
+		@brief		Unmaps the specified bitfile, if it's mapped.
+		@param[in]	inIndex		Specifies the index of the bitfile info.
+	**/
+	void UnmapBitfile (const size_t inIndex);
+
+	/**
+		@return		True if the given address is inside one of my mapped bitfiles or cached bitstreams.
+	**/
+	bool IsCachedAddress (const void * pInAddress) const;
+
+	bool LoadCatalog (const std::string & inDirectory);
+	bool SaveCatalog (const std::string & inDirectory);
+
+	/**
+		@brief	Everything I know about a bitfile on disk.
+	**/
+	typedef struct CatalogEntry
+	{
+		NTV2BitfileInfo	info;			///< @brief	Bitfile info (only meaningful if 'usable' is true)
+		uint64_t		fileSize;		///< @brief	File size, in bytes, when cataloged
+		int64_t			modTime;		///< @brief	File modification time when cataloged, in nanoseconds
+		uint64_t		inode;			///< @brief	File inode number when cataloged (0 if not supported)
+		ULWord			programOffset;	///< @brief	Byte offset of the program bitstream in the file
+		ULWord			programBytes;	///< @brief	Size of the program bitstream, in bytes
+		bool			usable;			///< @brief	False if the file can't be used (e.g. not a reconfigurable bitfile)
+		inline CatalogEntry () : fileSize(0), modTime(0), inode(0), programOffset(0), programBytes(0), usable(false)	{}
+	} CatalogEntry;
+
+	/**
+		@brief	Per-bitfile bitstream cache state.
+	**/
+	typedef struct BitstreamCache
+	{
+		uint64_t		fileSize;		///< @brief	Expected file size, in bytes
+		int64_t			modTime;		///< @brief	Expected file modification time, in nanoseconds
+		uint64_t		inode;			///< @brief	Expected file inode number (0 if not supported)
+		ULWord			programOffset;	///< @brief	Byte offset of the program bitstream in the file
+		ULWord			programBytes;	///< @brief	Size of the program bitstream, in bytes
+		void *			mapAddress;		///< @brief	Address of the mapped file, or NULL if not mapped
+		size_t			mapBytes;		///< @brief	Size of the mapping, in bytes
+		void *			mapHandle;		///< @brief	Platform-specific mapping handle (if any)
+		inline BitstreamCache () : fileSize(0), modTime(0), inode(0), programOffset(0), programBytes(0), mapAddress(AJA_NULL), mapBytes(0), mapHandle(AJA_NULL)	{}
+	} BitstreamCache;
+
+	typedef std::vector <NTV2Buffer>					NTV2BitstreamList;
+	typedef NTV2BitstreamList::iterator					NTV2BitstreamListIter;
+	typedef NTV2BitstreamList::const_iterator			NTV2BitstreamListConstIter;
+	typedef std::vector <BitstreamCache>				BitstreamCacheList;
+	typedef std::map <std::string, CatalogEntry>		CatalogMap;
+	typedef CatalogMap::const_iterator					CatalogMapConstIter;
 
 	NTV2BitfileInfoList		_bitfileList;	///< @brief	List of bitfiles that I'm managing
-	NTV2BitstreamList		_bitstreamList;	///< @brief	My cached bitstreams
+	NTV2BitstreamList		_bitstreamList;	///< @brief	My cached (read, not mapped) bitstreams
+	BitstreamCacheList		_cacheList;		///< @brief	Bitstream cache state, parallel to _bitfileList
+	CatalogMap				_catalog;		///< @brief	Catalog entries, keyed by bitfile path
+	bool					_useCatalog;	///< @brief	Use per-directory catalogs?
+	Stats					_stats;			///< @brief	Work counters
 };	//	CNTV2BitfileManager
 
 #endif	//	NTV2BITMANAGER_H
@@ -12,6 +12,8 @@
 	#include "ntv2windriverinterface.h"
 #elif defined (AJAMac)
 	#include "ntv2macdriverinterface.h"
+#elif defined (AJALinux)  &&  defined (NTV2_NTV42_DRIVER_INTERFACE)
+	#include "ntv2ntv42driverinterface.h"
 #elif defined (AJALinux)
 	#include "ntv2linuxdriverinterface.h"
 #elif defined (AJABareMetal)
@@ -30,6 +32,8 @@ class AJAExport CNTV2Card
 	: public CNTV2WinDriverInterface
 #elif defined (AJAMac)
 	: public CNTV2MacDriverInterface
+#elif defined (AJALinux)  &&  defined (NTV2_NTV42_DRIVER_INTERFACE)
+	: public CNTV2Ntv42DriverInterface
 #elif defined (AJALinux)
 	: public CNTV2LinuxDriverInterface
 #elif defined (AJABareMetal)
@@ -4451,6 +4455,22 @@ public:
 	**/
 	AJA_VIRTUAL bool	ApplySignalRoute (const NTV2XptConnections & inConnections, const bool inReplace = false);
 
+	/**
+		@brief		Changes the device's widget routing to match the given connections, writing only the crosspoint
+					select registers whose connections actually change.
+		@return		True if successful; otherwise false.
+		@param[in]	inConnections	Specifies the desired routing connections.
+		@param[in]	inReplace		If true, the default, any input not in inConnections is disconnected, so the
+									device's routing ends up the same as ApplySignalRoute with inReplace=true would
+									leave it. If false, augments the device's existing widget routing.
+		@details	The current routing is read in one ReadRegisters call, CNTV2SignalRouter::GetChangedRegisterWrites
+					works out the difference, and the changes are written in one WriteRegisters call. Unlike
+					ApplySignalRoute, nothing is cleared first, so unchanged signal paths are never interrupted.
+		@note		The connections aren't validated against the device's crosspoint connect ROM.
+		@see		\ref ntv2signalrouting, CNTV2SignalRouter::FindRoute, CNTV2SignalRouter::GetChangedRegisterWrites
+	**/
+	AJA_VIRTUAL bool	ApplySignalRouteChanges (const NTV2XptConnections & inConnections, const bool inReplace = true);
+
 	/**
 		@brief		Removes the given widget routing connections from the AJA device.
 		@return		True if successful; otherwise false.
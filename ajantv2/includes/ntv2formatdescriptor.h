@@ -364,7 +364,9 @@ public:
 
 	private:
 		friend class CNTV2CaptionRenderer;	//	The caption renderer needs to call SetPixelFormat
+		friend class CRP188;				//	CRP188::BurnTC needs to call SetLinePitch
 		inline void					SetPixelFormat (const NTV2PixelFormat inPixFmt)		{mPixelFormat = inPixFmt;}			///< @brief	Internal use only
+		inline void					SetLinePitch (const ULWord inBytesPerRow)			{mLinePitch[0] = inBytesPerRow;  linePitch = inBytesPerRow / 4;}	///< @brief	Internal use only
 		inline void					SetBitsPerComponent (const UByte inLuma, const UByte inChroma, const UByte inAlpha)	{mNumBitsLuma = inLuma; mNumBitsChroma = inChroma; mNumBitsAlpha = inAlpha;}
 		void						FinalizePlanar (void);			///< @brief	Completes initialization for planar formats
 
@@ -0,0 +1,184 @@
+/* SPDX-License-Identifier: MIT */
+/**
+	@file		ntv2frameconverter.h
+	@brief		Declares the NTV2FrameConverter class, an any-to-any host pixel format converter.
+	@copyright	(C) 2026 AJA Video Systems, Inc.
+**/
+
+#ifndef NTV2FRAMECONVERTER_H
+#define NTV2FRAMECONVERTER_H
+
+#include "ajaexport.h"
+#include "ajatypes.h"
+#include "ntv2enums.h"
+#include "ntv2publicinterface.h"
+#include "ntv2formatdescriptor.h"
+#include "ntv2hostcsc.h"
+#include <vector>
+
+
+/**
+	@brief	Converts host rasters between any two uncompressed ::NTV2PixelFormat values.
+	@details	Conversions are done in one of two ways:
+				-	<b>Fast path</b> -- a dedicated line kernel converts directly from the source pixel format to the
+					destination pixel format (e.g. a straight copy, '2vuy' to 'v210', 8-bit RGB component shuffles,
+					and the existing ::ConvertLine_8bitABGR_to_10bitRGBDPX family of transcoders), or a row pair at
+					a time for 4:2:0 destinations (e.g. '2vuy' or YUY2 to 8-bit 2-plane 4:2:0, a.k.a. NV12). The 8-bit
+					4:2:2 and 4:2:0 kernels use SSE2 when available.
+				-	<b>Generic path</b> -- each row is processed in tiles of ::NTV2FrameConverter::kTilePixels pixels.
+					The source tile is unpacked into a small, cache-resident intermediate buffer that holds four
+					16-bit components per pixel (Y/Cb/Cr/A or G/B/R/A, following the CNTV2CSCMatrix component
+					order), a YCbCr&lt;=&gt;RGB matrix is applied (using NTV2HostCSC) if the color families differ,
+					and the tile is then packed into the destination pixel format.
+				Rows are spread across threads using ::NTV2ParallelRows.
+	@note	Compressed and raw formats (ProRes, DVCPro, HDV, and the raw Bayer formats) aren't supported.
+	@note	Bit depth is increased by shifting left, and reduced by rounding to the nearest value. Some fast-path
+			kernels truncate instead, so their results may differ from the generic path by one LSB. YCbCr&lt;=&gt;RGB
+			matrix conversion is done at 14-bit precision (see NTV2HostCSC).
+	@note	4:2:2 chroma is replicated when upsampling, and averaged when downsampling. 4:2:0 chroma is
+			replicated vertically when upsampling, and averaged across row pairs when downsampling.
+**/
+class AJAExport NTV2FrameConverter
+{
+	//	CLASS METHODS
+	public:
+		static const ULWord	kTilePixels	= 1536;	///< @brief	Generic path tile width, in pixels (multiple of 12)
+
+		/**
+			@return		True if the given pixel format can be read or written by NTV2FrameConverter.
+			@param[in]	inPixelFormat	Specifies the pixel format of interest.
+		**/
+		static bool				IsSupportedPixelFormat (const NTV2PixelFormat inPixelFormat);
+
+		/**
+			@return		The set of all pixel formats that can be read and written by NTV2FrameConverter.
+		**/
+		static NTV2PixelFormats	GetSupportedPixelFormats (void);
+
+		/**
+			@return		True if the given source pixel format can be converted into the given destination format.
+			@param[in]	inSrcPixelFormat	Specifies the source pixel format.
+			@param[in]	inDstPixelFormat	Specifies the destination pixel format.
+		**/
+		static bool				CanConvert (const NTV2PixelFormat inSrcPixelFormat, const NTV2PixelFormat inDstPixelFormat);
+
+		/**
+			@return		True if a dedicated line kernel exists for the given conversion (i.e. the generic tiled
+						path isn't needed).
+			@param[in]	inSrcPixelFormat	Specifies the source pixel format.
+			@param[in]	inDstPixelFormat	Specifies the destination pixel format.
+		**/
+		static bool				HasFastPath (const NTV2PixelFormat inSrcPixelFormat, const NTV2PixelFormat inDstPixelFormat);
+
+		/**
+			@return		The number of pixels in the given pixel format's packing group (e.g. 6 for 'v210', 2 for '2vuy'),
+						or zero if the pixel format isn't supported.
+			@param[in]	inPixelFormat	Specifies the pixel format of interest.
+		**/
+		static ULWord			GetPixelGroupSize (const NTV2PixelFormat inPixelFormat);
+
+		/**
+			@brief		Unpacks part of one raster row into the converter's intermediate form, which holds four 16-bit,
+						left-justified components per pixel:  Y/Cb/Cr/A for YCbCr formats, or G/B/R/A for RGB formats.
+			@param[in]	pInRaster		Specifies a valid, non-NULL address of the start of the raster.
+			@param[in]	inDesc			Describes the raster. Planar formats are supported.
+			@param[in]	inRow			Specifies the raster row (zero is the top row of the buffer).
+			@param[in]	inFirstPixel	Specifies the first pixel to unpack. Must be a multiple of the packing group size.
+			@param[in]	inNumPixels		Specifies the number of pixels to unpack. Must be a multiple of the packing group size.
+			@param[out]	pOutPixels		Receives inNumPixels * 4 component values.
+			@return		True if successful;  otherwise false.
+			@note		4:2:2 chroma is replicated into both pixels of each pair, and is shared by both rows of each row pair
+						in 4:2:0 formats. No YCbCr&lt;=&gt;RGB conversion is done.
+		**/
+		static bool				UnpackPixels (const void * pInRaster, const NTV2FormatDescriptor & inDesc, const ULWord inRow,
+												const ULWord inFirstPixel, const ULWord inNumPixels, UWord * pOutPixels);
+
+		/**
+			@brief		Packs pixels in the intermediate form (see UnpackPixels) into part of one raster row.
+			@param[in]	pInPixels		Specifies the intermediate pixels (inNumPixels * 4 component values).
+			@param		pOutRaster		Specifies a valid, non-NULL address of the start of the raster.
+			@param[in]	inDesc			Describes the raster. Planar formats are supported.
+			@param[in]	inRow			Specifies the raster row (zero is the top row of the buffer).
+			@param[in]	inFirstPixel	Specifies the first pixel to pack. Must be a multiple of the packing group size.
+			@param[in]	inNumPixels		Specifies the number of pixels to pack. Must be a multiple of the packing group size.
+			@return		True if successful;  otherwise false.
+			@note		4:2:2 chroma is averaged across each pixel pair. In 4:2:0 formats, only even rows write chroma.
+		**/
+		static bool				PackPixels (const UWord * pInPixels, void * pOutRaster, const NTV2FormatDescriptor & inDesc,
+											const ULWord inRow, const ULWord inFirstPixel, const ULWord inNumPixels);
+
+	//	INSTANCE METHODS
+	public:
+		/**
+			@brief	Statistics describing the most recent conversion.
+		**/
+		typedef struct Stats
+		{
+			uint64_t	fMicroseconds;	///< @brief	Elapsed wall-clock time, in microseconds
+			ULWord		fNumRows;		///< @brief	Number of rows converted
+			ULWord		fNumWorkers;	///< @brief	Number of workers (threads) used
+			bool		fFastPath;		///< @brief	True if a fast-path line kernel was used
+			inline Stats () : fMicroseconds(0), fNumRows(0), fNumWorkers(0), fFastPath(false)	{}
+		} Stats;
+
+								NTV2FrameConverter ();
+		virtual inline			~NTV2FrameConverter ()	{}
+
+		/**
+			@brief		Converts the visible raster of one host frame buffer into another.
+			@param[in]	inSrcBuffer		Specifies the source host buffer.
+			@param[in]	inSrcDesc		Describes the source raster.
+			@param		inDstBuffer		Specifies the destination host buffer.
+			@param[in]	inDstDesc		Describes the destination raster. Must have the same visible raster width
+										and height as the source.
+			@return		True if successful;  otherwise false.
+			@note		If either descriptor describes a VANC geometry, only the visible (active) rows are converted.
+		**/
+		virtual bool			ConvertFrame (const NTV2Buffer & inSrcBuffer, const NTV2FormatDescriptor & inSrcDesc,
+												NTV2Buffer & inDstBuffer, const NTV2FormatDescriptor & inDstDesc);
+
+		/**
+			@brief		Converts a single raster line between two non-planar pixel formats.
+			@param[in]	pInSrcLine		Specifies a valid, non-NULL address of the first byte of the source line.
+			@param[in]	inSrcPixelFormat	Specifies the source pixel format. Must not be planar.
+			@param[out]	pOutDstLine		Specifies a valid, non-NULL address of the first byte of the destination line.
+			@param[in]	inDstPixelFormat	Specifies the destination pixel format. Must not be planar.
+			@param[in]	inNumPixels		Specifies the number of pixels to convert.
+			@return		True if successful;  otherwise false.
+			@note		Unlike ConvertFrame, this function is always single-threaded.
+		**/
+		virtual bool			ConvertLine (const void * pInSrcLine, const NTV2PixelFormat inSrcPixelFormat,
+												void * pOutDstLine, const NTV2PixelFormat inDstPixelFormat,
+												const ULWord inNumPixels);
+
+		/**
+			@name	Options
+		**/
+		///@{
+		inline NTV2FrameConverter &	setMaxThreads (const ULWord inMaxThreads)	{mMaxThreads = inMaxThreads; return *this;}	///< @brief	Limits the worker count (zero means no limit).
+		inline NTV2FrameConverter &	setUseSMPTERange (const bool inSMPTE)		{mSMPTERange = inSMPTE; return *this;}		///< @brief	Use SMPTE (narrow) range for RGB formats (defaults to full range).
+		inline NTV2FrameConverter &	setUseRec601Matrix (const bool inRec601)	{mStandard = inRec601 ? NTV2_HOSTCSC_REC601 : NTV2_HOSTCSC_REC709; return *this;}	///< @brief	Use Rec 601 (or Rec 709) YCbCr matrix.
+		inline NTV2FrameConverter &	setAutoMatrix (void)						{mStandard = NTV2_HOSTCSC_AUTO; return *this;}	///< @brief	Use Rec 601 for rasters narrower than 1280 pixels, Rec 709 otherwise (the default).
+		inline NTV2FrameConverter &	setMatrixStandard (const NTV2HostCSCStandard inStd)	{if (NTV2_IS_VALID_HOSTCSC_STANDARD(inStd)) mStandard = inStd; return *this;}	///< @brief	Use the given YCbCr matrix standard (e.g. Rec 2020).
+		inline NTV2FrameConverter &	setUseFastPaths (const bool inUseFast)		{mUseFastPaths = inUseFast; return *this;}	///< @brief	Enables/disables fast-path line kernels (for benchmarking).
+		inline ULWord				getMaxThreads (void) const					{return mMaxThreads;}
+		inline bool					getUseSMPTERange (void) const				{return mSMPTERange;}
+		inline bool					getUseFastPaths (void) const				{return mUseFastPaths;}
+		inline NTV2HostCSCStandard	getMatrixStandard (void) const				{return mStandard;}
+		///@}
+
+		/**
+			@return		Statistics about my most recent successful conversion.
+		**/
+		inline const Stats &	getLastStats (void) const		{return mStats;}
+
+	private:
+		ULWord					mMaxThreads;	///< @brief	Maximum worker count (0 = unlimited)
+		bool					mSMPTERange;	///< @brief	RGB is SMPTE range?
+		NTV2HostCSCStandard		mStandard;		///< @brief	YCbCr matrix standard
+		bool					mUseFastPaths;	///< @brief	Use fast paths when available?
+		Stats					mStats;			///< @brief	Most recent conversion stats
+		std::vector<UWord>		mScratch;		///< @brief	Per-worker intermediate tile buffers
+};	//	NTV2FrameConverter
+
+#endif	//	NTV2FRAMECONVERTER_H
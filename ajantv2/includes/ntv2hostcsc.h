@@ -0,0 +1,123 @@
+/* SPDX-License-Identifier: MIT */
+/**
+	@file		ntv2hostcsc.h
+	@brief		Declares the NTV2HostCSC class, which applies CNTV2CSCMatrix color space conversions to host buffers.
+	@copyright	(C) 2026 AJA Video Systems, Inc.
+**/
+
+#ifndef NTV2HOSTCSC_H
+#define NTV2HOSTCSC_H
+
+#include "ajaexport.h"
+#include "ajatypes.h"
+#include "ntv2enums.h"
+#include "ntv2cscmatrix.h"
+#include "ntv2enhancedcsc.h"
+
+
+/**
+	@brief	Identifies which YCbCr matrix standard to use for host color space conversion.
+**/
+typedef enum
+{
+	NTV2_HOSTCSC_AUTO,		///< @brief	Rec 601 for rasters narrower than 1280 pixels, otherwise Rec 709
+	NTV2_HOSTCSC_REC601,	///< @brief	Rec 601 (SD)
+	NTV2_HOSTCSC_REC709,	///< @brief	Rec 709 (HD)
+	NTV2_HOSTCSC_REC2020,	///< @brief	Rec 2020 (UHD/HDR)
+	NTV2_HOSTCSC_INVALID
+} NTV2HostCSCStandard;
+
+#define	NTV2_IS_VALID_HOSTCSC_STANDARD(__s__)	((__s__) >= NTV2_HOSTCSC_AUTO  &&  (__s__) < NTV2_HOSTCSC_INVALID)
+
+
+/**
+	@brief		Applies a CNTV2CSCMatrix (pre-subtract, 3x3 multiply, post-add) to lines of host pixels.
+	@details	Each pixel consists of four unsigned, right-justified components stored in consecutive ::UWord values,
+				in the same order the hardware color space converter uses:
+									   YCbCr   RGB
+					Component 0 / A =	 Y		G
+					Component 1 / B =	 Cb		B
+					Component 2 / C =	 Cr		R
+					Component 3		=	 Alpha (passed through unchanged)
+				Any bit depth from 8 through 16 is supported.
+
+				<b>Coefficients</b> -- The matrix coefficients are first quantized to 8.24 fixed point, exactly as
+				CNTV2EnhancedCSC::SendToHardware does, and then to 8.21 fixed point for the kernel. The pre- and
+				post-offsets are the CNTV2CSCMatrix 16-bit left-justified values, scaled to the sample bit depth.
+
+				<b>Rounding tolerance</b> -- For 8, 10 and 12-bit samples, each output component is within ±1 LSB
+				of the exact result computed in double precision with the hardware (8.24) coefficients, rounded to
+				nearest and clamped. Differences only occur when the exact result lies within about 1/100 LSB of a
+				rounding boundary. Samples deeper than 14 bits are processed at 14-bit precision (for 16-bit samples,
+				the two LS bits of each input component are ignored, and those of each output component are zero).
+
+				<b>Vectorization</b> -- On x86 the kernel processes four pixels per SSE2 instruction sequence, using
+				a split high/low coefficient multiply-add to retain 21 fractional bits. Other architectures use the
+				scalar kernel, which produces identical results.
+**/
+class AJAExport NTV2HostCSC
+{
+	//	CLASS METHODS
+	public:
+		/**
+			@return		The CNTV2CSCMatrix preset for the given conversion.
+			@param[in]	inYCbCrToRGB	Specify true for YCbCr-to-RGB, or false for RGB-to-YCbCr.
+			@param[in]	inStandard		Specifies the matrix standard. If ::NTV2_HOSTCSC_AUTO, the raster width is used.
+			@param[in]	inSMPTERange	Specify true for SMPTE range RGB, or false for full range RGB.
+			@param[in]	inRasterWidth	Specifies the raster width, in pixels, which is only used if "inStandard" is ::NTV2_HOSTCSC_AUTO.
+		**/
+		static NTV2ColorSpaceMatrixType	GetMatrixType (const bool inYCbCrToRGB, const NTV2HostCSCStandard inStandard,
+														const bool inSMPTERange, const ULWord inRasterWidth = 0);
+
+		/**
+			@return		True if the vectorized kernel is available on this host;  otherwise false.
+		**/
+		static bool						IsSIMDAvailable (void);
+
+	//	INSTANCE METHODS
+	public:
+		explicit						NTV2HostCSC (const NTV2ColorSpaceMatrixType inPreset = NTV2_Unity_Matrix);
+		explicit						NTV2HostCSC (const CNTV2CSCMatrix & inMatrix);
+		explicit						NTV2HostCSC (const CNTV2EnhancedCSC & inEnhancedCSC);
+		virtual inline					~NTV2HostCSC ()		{}
+
+		/**
+			@brief		Changes my matrix coefficients and offsets.
+			@param[in]	inMatrix	Specifies the new matrix.
+		**/
+		virtual void					SetMatrix (const CNTV2CSCMatrix & inMatrix);
+
+		/**
+			@brief		Converts a line of 4-component pixels.
+			@param[in]	pInLine		Specifies a valid, non-NULL pointer to the first source component.
+			@param[out]	pOutLine	Specifies a valid, non-NULL pointer to the first destination component.
+									May be the same as "pInLine" for in-place conversion.
+			@param[in]	inNumPixels	Specifies the number of pixels to convert.
+			@param[in]	inBitDepth	Specifies the number of significant (LS) bits in each component (8 through 16).
+			@return		True if successful;  otherwise false.
+		**/
+		virtual bool					ConvertLine (const UWord * pInLine, UWord * pOutLine, const ULWord inNumPixels,
+													const UWord inBitDepth) const;
+
+		inline NTV2HostCSC &			setUseSIMD (const bool inUseSIMD)	{mUseSIMD = inUseSIMD;  return *this;}	///< @brief	Enables or disables the vectorized kernel (for testing).
+		inline bool						getUseSIMD (void) const				{return mUseSIMD;}
+
+		/**
+			@return		The coefficient I use, in 8.21 fixed point.
+			@param[in]	inCoeffIndex	Specifies the coefficient of interest.
+		**/
+		inline LWord					GetFixedCoefficient (const NTV2CSCCoeffIndex inCoeffIndex) const	{return mCoeff[inCoeffIndex];}
+
+		/**
+			@return		The given offset, as a 16-bit unsigned value (i.e. for 16-bit samples).
+			@param[in]	inOffsetIndex	Specifies the offset of interest.
+		**/
+		inline LWord					GetOffset16 (const NTV2CSCOffsetIndex inOffsetIndex) const			{return mOffset16[inOffsetIndex];}
+
+	private:
+		LWord	mCoeff[9];		///< @brief	A0 A1 A2 B0 B1 B2 C0 C1 C2 in 8.21 fixed point
+		LWord	mOffset16[6];	///< @brief	Pre0 Pre1 Pre2 PostA PostB PostC, 16-bit unsigned scale
+		bool	mUseSIMD;		///< @brief	Use vectorized kernel if available?
+};	//	NTV2HostCSC
+
+#endif	//	NTV2HOSTCSC_H
@@ -90,6 +90,35 @@ public:
 	bool WaitForFlashNOTBusy();
 	bool ProgramFlashValue(uint32_t address, uint32_t value);
 	bool FastProgramFlash256(uint32_t address, uint32_t* buffer);
+
+	/**
+		@brief		Enables or disables batch mode (disabled by default). In batch mode, Program writes each flash page
+					with one WriteRegisters call instead of one driver call per register, and reads (for VerifyFlash and
+					ReadFlash) issue each word's address & command with one WriteRegisters call. Program also verifies each sector right after programming it (by
+					comparing 64-bit checksums of the read-back and bitfile data), re-erasing and re-programming a sector
+					that doesn't verify, so no separate verify pass is needed.
+		@note		Batch mode always verifies every word, so Program's 'fullVerify' parameter is ignored.
+	**/
+	void			SetBatchMode (const bool inBatchMode = true)	{_batchMode = inBatchMode;}
+	bool			IsBatchMode (void) const						{return _batchMode;}	///< @return	True if batch mode is enabled.
+
+	/**
+		@brief		Programs one 256-byte flash page, writing the page data, address and page-program command in one
+					WriteRegisters call.
+		@param[in]	address		Specifies the page address within the currently-selected bank.
+		@param[in]	buffer		Specifies the 64 words to be programmed.
+		@return		True if successful;  otherwise false.
+	**/
+	bool			BatchProgramFlash256 (const uint32_t address, const uint32_t * buffer);
+
+	/**
+		@brief		Reads consecutive words from flash, using one WriteRegisters call per word to issue each read.
+		@param[in]	address		Specifies the address of the first word within the currently-selected bank.
+		@param[out]	pOutWords	Receives the words that were read.
+		@param[in]	numWords	Specifies the number of words to read.
+		@return		True if successful;  otherwise false.
+	**/
+	bool			BatchReadFlash (const uint32_t address, uint32_t * pOutWords, const uint32_t numWords);
 	bool EraseSector(uint32_t sectorAddress);
 	bool CheckFlashErasedWithBlockID(FlashBlockID flashBlockNumber);
 	uint32_t ReadDeviceID();
@@ -150,6 +179,12 @@ public:
 	bool CheckAndFixMACs();
 	bool MakeMACsFromSerial( const char *sSerialNumber, MacAddr *pMac1, MacAddr *pMac2 );
 #endif	//	IoIP/KonaIP10g purge
+protected:
+	std::string		ProgramBatched (void);
+	bool			VerifyFlashBatched (const FlashBlockID flashID);
+	uint32_t		BatchAddressForOffset (const FlashBlockID blockID, const uint32_t offset, int & ioBank);
+	bool			GetPaddedBitFile (NTV2Buffer & outImage) const;
+
 protected:
 	CNTV2Card &		_card;
 	NTV2Buffer		_bitFileBuffer;
@@ -185,6 +220,7 @@ protected:
 	uint32_t		_failSafePadding;
 	CNTV2SpiFlash * _spiFlash;
 	bool			_hasExtendedCommandSupport;
+	bool			_batchMode;
 };	//	CNTV2KonaFlashProgram
 
 #endif	//	NTV2KONAFLASHPROGRAM_H
@@ -0,0 +1,52 @@
+/* SPDX-License-Identifier: MIT */
+/**
+	@file		ntv2parallel.h
+	@brief		Declares the NTV2ParallelRows function, used to spread row-oriented host raster work across threads.
+	@copyright	(C) 2026 AJA Video Systems, Inc.
+**/
+
+#ifndef NTV2PARALLEL_H
+#define NTV2PARALLEL_H
+
+#include "ajaexport.h"
+#include "ajatypes.h"
+
+
+/**
+	@brief		A function that processes a contiguous range of raster rows.
+	@param		pInContext		The caller's context pointer that was passed to ::NTV2ParallelRows.
+	@param[in]	inWorkerIndex	Identifies the worker calling the function, in the range [0, N), where N is the
+								worker count returned by ::NTV2ParallelRows. No two concurrent calls will ever
+								share the same worker index, so it can be used to select per-thread scratch memory.
+	@param[in]	inFirstRow		The first (zero-based) row to process.
+	@param[in]	inNumRows		The number of rows to process.
+**/
+typedef void (*NTV2RowRangeFunc) (void * pInContext, const ULWord inWorkerIndex, const ULWord inFirstRow, const ULWord inNumRows);
+
+
+/**
+	@brief		Splits the given number of raster rows into contiguous bands and calls the given function once per
+				band, using a lazily-created, process-wide pool of worker threads. The calling thread always processes
+				the first band itself, and doesn't return until all bands have been processed.
+	@param[in]	inNumRows		Specifies the total number of rows to process.
+	@param[in]	inFunc			Specifies the function to call for each band. Must be non-NULL.
+	@param		pInContext		Specifies an opaque pointer that's passed to each call to "inFunc".
+	@param[in]	inMaxWorkers	Optionally limits the number of bands (and thus threads) used. Zero, the default,
+								uses up to ::NTV2ParallelRowsMaxWorkers workers.
+	@param[in]	inRowAlignment	Optionally specifies that band boundaries must fall on a multiple of this many rows
+								(e.g. 2 for 4:2:0 chroma). Defaults to 1.
+	@return		The number of workers (bands) that were used, which is at least 1 if "inNumRows" is non-zero;
+				or zero if nothing was done.
+	@note		If the pool is already busy serving another caller, or the SDK was built without C++11 support,
+				all rows are processed serially in the calling thread.
+**/
+AJAExport ULWord	NTV2ParallelRows (const ULWord inNumRows, NTV2RowRangeFunc inFunc, void * pInContext,
+										const ULWord inMaxWorkers = 0, const ULWord inRowAlignment = 1);
+
+/**
+	@return		The maximum number of workers that ::NTV2ParallelRows will use, which is the number of
+				hardware threads available to the process (or 1 if that can't be determined).
+**/
+AJAExport ULWord	NTV2ParallelRowsMaxWorkers (void);
+
+#endif	//	NTV2PARALLEL_H
@@ -0,0 +1,182 @@
+/* SPDX-License-Identifier: MIT */
+/**
+	@file		ntv2previewcompositor.h
+	@brief		Declares the NTV2PreviewCompositor class, which composites several host frames into one RGB preview mosaic.
+	@copyright	(C) 2026 AJA Video Systems, Inc.
+**/
+
+#ifndef NTV2PREVIEWCOMPOSITOR_H
+#define NTV2PREVIEWCOMPOSITOR_H
+
+#include "ajaexport.h"
+#include "ajatypes.h"
+#include "ntv2enums.h"
+#include "ntv2publicinterface.h"
+#include "ntv2formatdescriptor.h"
+#include "ntv2hostcsc.h"
+#include <vector>
+
+
+/**
+	@brief	Downscales and converts frames from several inputs directly into one 8-bit RGBA (or ARGB/ABGR) mosaic,
+			for multi-channel preview. It has no GUI toolkit dependencies -- the mosaic is a plain host buffer that
+			a preview widget can display as-is, or that can be inspected directly (e.g. in headless tests).
+	@details	The mosaic is a grid of equal-sized tiles (see SetLayout). Each call to Composite renders only the
+				tiles that were given a new frame (see SetTileFrame) since they were last rendered:
+				-	Each tile row is made from (at most) two source rows, which are unpacked into the 16-bit
+					intermediate form (see NTV2FrameConverter::UnpackPixels) and averaged. Only the source rows
+					that contribute are read, so an 8K source feeding a 480-row tile reads fewer than 1000 rows.
+				-	The row is then box-filtered horizontally to the tile width, YCbCr sources are converted to full
+					range RGB (using NTV2HostCSC), and the result is packed straight into the mosaic.
+				-	The row averaging and box filter use SSE2 when available. Mosaic rows are spread across threads
+					using ::NTV2ParallelRows.
+				<b>Frame rate adaptation</b> -- Each tile has an update interval:  an interval of N renders one of
+				every N frames given to the tile. Intervals can be set explicitly (see setTileInterval), or adapted
+				automatically to a per-Composite time budget (see setTimeBudget):  when a Composite call exceeds the
+				budget, the interval of the most expensive tile (the one reading the most source pixels per update)
+				is doubled;  when a call takes less than half the budget, the largest interval is halved.
+	@note		The mosaic is updated incrementally, so pass the same mosaic buffer to every Composite call, or
+				call Invalidate after switching buffers.
+	@note		Tile frames aren't copied. Each frame buffer must stay valid (and shouldn't be modified) until the
+				next Composite call.
+**/
+class AJAExport NTV2PreviewCompositor
+{
+	//	CLASS METHODS
+	public:
+		static const UWord	kMaxTiles		= 64;	///< @brief	Maximum number of tiles in the mosaic
+		static const ULWord	kMaxInterval	= 16;	///< @brief	Maximum tile update interval
+
+		/**
+			@return		True if the given pixel format can be used for the mosaic.
+			@param[in]	inPixelFormat	Specifies the pixel format of interest. ::NTV2_FBF_RGBA, ::NTV2_FBF_ARGB and
+										::NTV2_FBF_ABGR are supported.
+		**/
+		static bool				IsSupportedMosaicFormat (const NTV2PixelFormat inPixelFormat);
+
+		/**
+			@return		True if frames having the given pixel format can be given to a tile.
+			@param[in]	inPixelFormat	Specifies the pixel format of interest. Any pixel format that
+										NTV2FrameConverter supports can be used.
+		**/
+		static bool				IsSupportedTileFormat (const NTV2PixelFormat inPixelFormat);
+
+	//	INSTANCE METHODS
+	public:
+		/**
+			@brief	Statistics describing the most recent Composite call.
+		**/
+		typedef struct Stats
+		{
+			uint64_t	fMicroseconds;	///< @brief	Elapsed wall-clock time, in microseconds
+			ULWord		fNumWorkers;	///< @brief	Number of workers (threads) used
+			ULWord		fTilesRendered;	///< @brief	Number of tiles rendered from a new frame
+			ULWord		fTilesSkipped;	///< @brief	Number of tiles whose new frame was skipped (due to the tile's update interval)
+			ULWord		fTilesCleared;	///< @brief	Number of tiles that were cleared to black
+			uint64_t	fSourcePixels;	///< @brief	Number of source pixels that were read
+			inline Stats () : fMicroseconds(0), fNumWorkers(0), fTilesRendered(0), fTilesSkipped(0), fTilesCleared(0), fSourcePixels(0)	{}
+		} Stats;
+
+								NTV2PreviewCompositor ();
+		virtual inline			~NTV2PreviewCompositor ()	{}
+
+		/**
+			@brief		Changes the mosaic layout. All tiles are cleared, and their update intervals are reset to 1.
+			@param[in]	inNumColumns	Specifies the number of tile columns.
+			@param[in]	inNumRows		Specifies the number of tile rows.
+			@return		True if successful;  otherwise false.
+		**/
+		virtual bool			SetLayout (const UWord inNumColumns, const UWord inNumRows);
+
+		/**
+			@brief		Gives a tile a new frame to display. The frame is rendered into the mosaic by the next
+						Composite call (unless the tile's update interval says to skip it).
+			@param[in]	inTileIndex		Specifies the tile, in row-major order starting at zero.
+			@param[in]	inFrame			Specifies the host frame buffer. Not copied -- see class notes.
+			@param[in]	inDesc			Describes the frame's raster. Only its visible area is used.
+			@return		True if successful;  otherwise false.
+		**/
+		virtual bool			SetTileFrame (const UWord inTileIndex, const NTV2Buffer & inFrame, const NTV2FormatDescriptor & inDesc);
+
+		/**
+			@brief		Removes a tile's frame. The tile is cleared to black by the next Composite call.
+			@param[in]	inTileIndex		Specifies the tile, in row-major order starting at zero.
+			@return		True if successful;  otherwise false.
+		**/
+		virtual bool			ClearTile (const UWord inTileIndex);
+
+		/**
+			@brief		Forces the entire mosaic to be redrawn by the next Composite call. Tiles without a frame
+						are cleared, and every other tile is rendered from its most recent frame.
+		**/
+		virtual void			Invalidate (void);
+
+		/**
+			@brief		Renders the tiles that need it into the given mosaic.
+			@param		inMosaic		Specifies the mosaic's host buffer.
+			@param[in]	inMosaicDesc	Describes the mosaic raster. Its pixel format must be one that
+										IsSupportedMosaicFormat accepts. The visible raster is divided evenly among
+										the tiles;  any leftover columns or rows on the right and bottom edges are
+										left unchanged.
+			@return		True if successful;  otherwise false.
+		**/
+		virtual bool			Composite (NTV2Buffer & inMosaic, const NTV2FormatDescriptor & inMosaicDesc);
+
+		/**
+			@name	Options
+		**/
+		///@{
+		inline NTV2PreviewCompositor &	setMaxThreads (const ULWord inMaxThreads)	{mMaxThreads = inMaxThreads; return *this;}		///< @brief	Limits the worker count (zero means no limit).
+		inline NTV2PreviewCompositor &	setUseSIMD (const bool inUseSIMD)			{mUseSIMD = inUseSIMD; return *this;}			///< @brief	Enables/disables the SSE2 kernels (for testing).
+		inline NTV2PreviewCompositor &	setTimeBudget (const ULWord inMicroseconds)	{mTimeBudget = inMicroseconds; return *this;}	///< @brief	Sets the Composite time budget used to adapt tile update intervals (zero, the default, disables adaptation).
+		NTV2PreviewCompositor &			setTileInterval (const UWord inTileIndex, const ULWord inInterval);	///< @brief	Sets a tile's update interval (1 through kMaxInterval).
+		inline ULWord					getMaxThreads (void) const					{return mMaxThreads;}
+		inline bool						getUseSIMD (void) const						{return mUseSIMD;}
+		inline ULWord					getTimeBudget (void) const					{return mTimeBudget;}
+		ULWord							getTileInterval (const UWord inTileIndex) const;	///< @return	The tile's update interval, or zero if the tile doesn't exist.
+		///@}
+
+		inline UWord			getNumColumns (void) const		{return mNumColumns;}	///< @return	The number of tile columns.
+		inline UWord			getNumRows (void) const			{return mNumRows;}		///< @return	The number of tile rows.
+		inline UWord			getNumTiles (void) const		{return UWord(mTiles.size());}	///< @return	The number of tiles.
+
+		/**
+			@return		Statistics about my most recent successful Composite call.
+		**/
+		inline const Stats &	getLastStats (void) const		{return mStats;}
+
+		/**
+			@brief	Everything I know about one tile.
+		**/
+		typedef struct Tile
+		{
+			const UByte *			fFrame;			///< @brief	Most recent frame (not owned)
+			NTV2FormatDescriptor	fDesc;			///< @brief	Describes fFrame
+			ULWord					fInterval;		///< @brief	Update interval
+			ULWord					fPending;		///< @brief	Frames given since the tile was last rendered
+			bool					fNeedsClear;	///< @brief	Clear to black on next Composite?
+			bool					fRender;		///< @brief	Render during the current Composite?
+			ULWord					fSpanWidth;		///< @brief	Source width the spans were computed for
+			ULWord					fTileWidth;		///< @brief	Tile width the spans were computed for
+			std::vector<ULWord>		fSpanFirst;		///< @brief	First source pixel of each tile pixel
+			std::vector<ULWord>		fSpanCount;		///< @brief	Number of source pixels averaged into each tile pixel
+			std::vector<float>		fSpanRecip;		///< @brief	1 / fSpanCount
+			NTV2HostCSC				fCSC;			///< @brief	YCbCr-to-RGB matrix (for YCbCr sources)
+			bool					fIsYUV;			///< @brief	Source is YCbCr?
+			inline Tile () : fFrame(AJA_NULL), fInterval(1), fPending(0), fNeedsClear(true), fRender(false),
+							fSpanWidth(0), fTileWidth(0), fIsYUV(false)	{}
+		} Tile;
+
+	private:
+		ULWord					mMaxThreads;	///< @brief	Maximum worker count (0 = unlimited)
+		bool					mUseSIMD;		///< @brief	Use SSE2 kernels?
+		ULWord					mTimeBudget;	///< @brief	Composite time budget, in microseconds (0 = no adaptation)
+		UWord					mNumColumns;	///< @brief	Tile columns
+		UWord					mNumRows;		///< @brief	Tile rows
+		std::vector<Tile>		mTiles;			///< @brief	Per-tile state, row-major
+		NTV2FormatDescriptor	mMosaicDesc;	///< @brief	Mosaic geometry of the previous Composite call
+		Stats					mStats;			///< @brief	Most recent Composite stats
+		std::vector<UWord>		mScratch;		///< @brief	Per-worker row buffers
+};	//	NTV2PreviewCompositor
+
+#endif	//	NTV2PREVIEWCOMPOSITOR_H
@@ -6453,6 +6453,18 @@ typedef enum
 					@return		True if successful;	 otherwise false.
 				**/
 				bool			GetRingChangedByteRange (const NTV2Buffer & inBuffer, ULWord & outByteOffsetFirst, ULWord & outByteOffsetLast) const;
+
+				/**
+					@brief		Computes a 64-bit fingerprint of my contents, suitable for detecting changed, repeated or
+								corrupted frames (but not for cryptographic purposes).
+					@details	Buffers up to 1MB are hashed using XXH64. Larger buffers are split into 1MB blocks that are
+								hashed (in parallel, if larger than NTV2Buffer::ParallelThreshold) using XXH64, then the
+								block hashes are themselves hashed. The result depends only on my contents and the seed,
+								not on the host's endianness, SIMD support or thread count.
+					@param[in]	inSeed		Optionally specifies a seed value. Defaults to zero.
+					@return		The hash value, or zero if I'm NULL or empty.
+				**/
+				uint64_t		GetHash64 (const uint64_t inSeed = 0) const;	//	New in SDK 18.1
 				///@}
 
 				/**
@@ -6484,6 +6496,8 @@ typedef enum
 				**/
 				template<typename T>	bool Fill (const T & inValue)
 				{
+					if (sizeof(T) == 1  ||  sizeof(T) == 2  ||  sizeof(T) == 4  ||  sizeof(T) == 8)
+						return FillPattern(&inValue, sizeof(T));	//	Vectorized for the common scalar sizes
 					T* pT = reinterpret_cast<T*>(GetHostPointer());
 					if (!pT)
 						return false;
@@ -6497,6 +6511,16 @@ typedef enum
 					return true;
 				}
 
+				/**
+					@brief		Fills me with copies of the given 1, 2, 4 or 8-byte value, using SIMD stores (and, for
+								buffers larger than NTV2Buffer::ParallelThreshold, several threads).
+					@param[in]	pInValue		Points to the value.
+					@param[in]	inValueSize		Specifies the size of the value, in bytes. Must be 1, 2, 4 or 8.
+					@return		True if I'm currently allocated and at least one value was written;  otherwise false.
+					@note		If my size (in bytes) is not evenly divisible by the value size, the very last byte(s) won't be written.
+				**/
+				bool			FillPattern (const void * pInValue, const size_t inValueSize);	//	New in SDK 18.1
+
 				/**
 					@brief		Fills a portion of me with the given scalar value.
 					@param[in]	inValue			The scalar value.
@@ -7032,6 +7056,38 @@ typedef enum
 				static size_t				HostPageSize (void);	//	New in SDK 16.3
 				///@}
 
+				/**
+					@name	Bulk Operations
+					@brief	IsContentEqual, NextDifference, Fill, the ByteSwap functions and GetHash64 use SSE2 or AVX2
+							instructions (chosen at run-time based on the host CPU), and spread buffers larger than the
+							parallel threshold across threads using ::NTV2ParallelRows.
+				**/
+				///@{
+				/**
+					@brief		Enables or disables the SIMD (SSE2/AVX2) bulk operation kernels (e.g. for testing).
+								When disabled, portable 64-bit-word loops are used. Enabled by default.
+				**/
+				static void					SetUseSIMD (const bool inUseSIMD);	//	New in SDK 18.1
+
+				/**
+					@return		The name of the instruction set the bulk operations are currently using:
+								"AVX2", "SSE2", or "scalar".
+				**/
+				static std::string			SIMDInstructionSet (void);	//	New in SDK 18.1
+
+				/**
+					@return		The buffer size, in bytes, at or above which bulk operations are spread across threads.
+								Zero means they always run in the calling thread.
+				**/
+				static size_t				ParallelThreshold (void);	//	New in SDK 18.1
+
+				/**
+					@brief		Changes the buffer size, in bytes, at or above which bulk operations are spread across threads.
+								Defaults to 8MB. Specify zero to always run in the calling thread.
+				**/
+				static void					SetParallelThreshold (const size_t inByteCount);	//	New in SDK 18.1
+				///@}
+
 				NTV2_RPC_BUFFER_CODEC_DECLS
 			#endif	//	user-space clients only
 		NTV2_STRUCT_END (NTV2Buffer)
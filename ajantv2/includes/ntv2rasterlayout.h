@@ -0,0 +1,99 @@
+/* SPDX-License-Identifier: MIT */
+/**
+	@file		ntv2rasterlayout.h
+	@brief		Declares functions that convert host rasters between full-frame, square-division (quadrant)
+				and two-sample-interleave (TSI) layouts.
+	@copyright	(C) 2026 AJA Video Systems, Inc.
+**/
+
+#ifndef NTV2RASTERLAYOUT_H
+#define NTV2RASTERLAYOUT_H
+
+#include "ajaexport.h"
+#include "ajatypes.h"
+#include "ntv2enums.h"
+#include "ntv2publicinterface.h"
+#include "ntv2formatdescriptor.h"
+
+
+/**
+	@brief	Identifies how a 4K/UHD/8K raster is arranged in a host buffer.
+	@details	The quadrant and TSI layouts store four quarter-size sub-images, one after the other, each having
+				half the rows and half the row bytes of the full raster (the same arrangement ::StackQuadrants
+				produces). Sub-image N starts at byte offset N * (full raster size / 4). Because the layouts
+				only depend on the full raster's geometry, 8K rasters split four ways into UHD/4K sub-images just
+				like UHD/4K rasters split into HD/2K sub-images.
+**/
+typedef enum
+{
+	NTV2_RASTER_LAYOUT_FULL,		///< @brief	Ordinary full raster
+	NTV2_RASTER_LAYOUT_QUADRANTS,	///< @brief	Square division:  upper-left, upper-right, lower-left, lower-right quadrants
+	NTV2_RASTER_LAYOUT_TSI,			///< @brief	Two-sample interleave (SMPTE ST 425-5):  even-line/even-pair, even-line/odd-pair,
+									///<		odd-line/even-pair, odd-line/odd-pair sub-images
+	NTV2_RASTER_LAYOUT_INVALID
+} NTV2RasterLayout;
+
+#define	NTV2_IS_VALID_RASTER_LAYOUT(__l__)	((__l__) >= NTV2_RASTER_LAYOUT_FULL  &&  (__l__) < NTV2_RASTER_LAYOUT_INVALID)
+
+
+/**
+	@return		True if the given full raster can be converted to/from the given layout;  otherwise false.
+	@param[in]	inFullDesc	Describes the full raster. Must not be planar or have VANC lines, and must have an even
+							number of rows.
+	@param[in]	inLayout	Specifies the layout of interest.
+	@note		The quadrant layout works for any pixel format, as it only moves half rows. The TSI layout requires
+				each half row to hold a whole number of pixel pairs, which is true for all packed (non-planar)
+				uncompressed formats whose 2-pixel sample pair is a whole number of bytes, and for 'v210' and
+				10-bit YCbCr DPX, whose 6-pixel groups are split in pairs.
+**/
+AJAExport bool	NTV2RasterLayoutIsSupported (const NTV2FormatDescriptor & inFullDesc, const NTV2RasterLayout inLayout);
+
+/**
+	@brief		Converts a raster from one layout to another, spreading rows across threads using ::NTV2ParallelRows.
+	@param[in]	inSrcBuffer		Specifies the source host buffer. Must be at least as large as the full raster.
+	@param[in]	inSrcLayout		Specifies the source layout.
+	@param		inDstBuffer		Specifies the destination host buffer. Must be at least as large as the full raster,
+								and must not overlap the source buffer.
+	@param[in]	inDstLayout		Specifies the destination layout.
+	@param[in]	inFullDesc		Describes the full raster.
+	@param[in]	inMaxWorkers	Optionally limits the number of worker threads. Defaults to zero (no limit).
+	@return		True if successful;  otherwise false.
+**/
+AJAExport bool	NTV2ConvertRasterLayout (const NTV2Buffer & inSrcBuffer, const NTV2RasterLayout inSrcLayout,
+										NTV2Buffer & inDstBuffer, const NTV2RasterLayout inDstLayout,
+										const NTV2FormatDescriptor & inFullDesc, const ULWord inMaxWorkers = 0);
+
+/**
+	@brief		Converts a raster from one layout to another, using raw pointers and geometry.
+	@param[in]	pInSrc			Specifies a valid, non-NULL pointer to the source raster.
+	@param[in]	inSrcLayout		Specifies the source layout.
+	@param[out]	pOutDst			Specifies a valid, non-NULL pointer to the destination raster, which must not overlap the source.
+	@param[in]	inDstLayout		Specifies the destination layout.
+	@param[in]	inRowBytes		Specifies the number of bytes per full raster row.
+	@param[in]	inNumRows		Specifies the number of full raster rows. Must be even.
+	@param[in]	inPixelFormat	Specifies the pixel format, which is only needed for the TSI layout.
+	@param[in]	inMaxWorkers	Optionally limits the number of worker threads. Defaults to zero (no limit).
+	@return		True if successful;  otherwise false.
+**/
+AJAExport bool	NTV2ConvertRasterLayout (const UByte * pInSrc, const NTV2RasterLayout inSrcLayout,
+										UByte * pOutDst, const NTV2RasterLayout inDstLayout,
+										const ULWord inRowBytes, const ULWord inNumRows,
+										const NTV2PixelFormat inPixelFormat = NTV2_FBF_INVALID, const ULWord inMaxWorkers = 0);
+
+/**
+	@brief		Converts a raster from one layout to another without a second frame buffer.
+	@param		inOutBuffer		Specifies the host buffer to convert. Must be at least as large as the full raster.
+	@param[in]	inFromLayout	Specifies the buffer's current layout.
+	@param[in]	inToLayout		Specifies the buffer's new layout.
+	@param[in]	inFullDesc		Describes the full raster.
+	@param[in]	inMaxWorkers	Optionally limits the number of worker threads. Defaults to zero (no limit).
+	@return		True if successful;  otherwise false.
+	@note		Half rows are moved by following the cycles of the layout permutation, using one half row of
+				scratch memory per worker. Independent cycles are spread across threads, but since these permutations
+				can consist of a few long cycles, this is generally slower than ::NTV2ConvertRasterLayout.
+**/
+AJAExport bool	NTV2ConvertRasterLayoutInPlace (NTV2Buffer & inOutBuffer, const NTV2RasterLayout inFromLayout,
+												const NTV2RasterLayout inToLayout, const NTV2FormatDescriptor & inFullDesc,
+												const ULWord inMaxWorkers = 0);
+
+#endif	//	NTV2RASTERLAYOUT_H
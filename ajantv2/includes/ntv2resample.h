@@ -12,6 +12,8 @@
 #include "ntv2fixed.h"
 #include "ntv2videodefines.h"
 
+//	NOTE:	These are single-line, unfiltered resamplers. To scale whole frames (e.g. for previews or
+//			proxies), use NTV2Scaler (see ntv2scaler.h), which is filtered, vectorized and multi-threaded.
 
 // ReSampleLine
 // RGBAlphaPixel Version
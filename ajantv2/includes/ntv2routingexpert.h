@@ -9,6 +9,7 @@
 #define NTV2ROUTINGEXPERT_H
 
 #include "ntv2signalrouter.h"
+#include <vector>
 
 #include "ajabase/system/lock.h"
 #include "ajabase/common/ajarefptr.h"
@@ -57,6 +58,11 @@ class AJAExport RoutingExpert
 		bool				IsHDMIWidget(const NTV2WidgetType inWidgetType) const;
 		bool				IsHDMIInWidget(const NTV2WidgetType inWidgetType) const;
 		bool				IsHDMIOutWidget(const NTV2WidgetType inWidgetType) const;
+		bool				GetDeviceInputXpts (const NTV2DeviceID inDeviceID, NTV2InputXptIDSet & outInputs);
+		bool				GetDeviceOutputXpts (const NTV2DeviceID inDeviceID, NTV2OutputXptIDSet & outOutputs);
+		bool				FindRoute (const NTV2DeviceID inDeviceID, const NTV2OutputXptID inOutputXpt,
+										const NTV2InputXptID inInputXpt, const NTV2PixelFormat inPixelFormat,
+										NTV2XptConnections & outConnections);
 
 	protected:
 		typedef std::map <std::string, NTV2InputXptID>			String2InputXpt;
@@ -98,6 +104,35 @@ class AJAExport RoutingExpert
 		typedef std::pair <NTV2OutputXptID, NTV2WidgetID>		OutputXpt2WidgetIDPair;
 		typedef OutputXpt2WidgetIDs::const_iterator				OutputXpt2WidgetIDsConstIter;
 
+		/**
+			@brief	A widget the route solver can pass a signal through:  one video input and the outputs it drives.
+		**/
+		typedef struct RouteConverter
+		{
+			NTV2WidgetID					fWidgetID;	///< @brief	The widget
+			NTV2Channel						fChannel;	///< @brief	Its channel (used to prefer same-channel widgets)
+			NTV2InputXptID					fInputXpt;	///< @brief	Its video input
+			std::vector<NTV2OutputXptID>	fOutputXpts;///< @brief	Its video outputs, in ascending order
+		} RouteConverter;
+
+		/**
+			@brief	Everything the route solver knows about one device, built once on first use.
+		**/
+		typedef struct DeviceRouteGraph
+		{
+			NTV2InputXptIDSet					fInputXpts;		///< @brief	Same as CNTV2SignalRouter::GetAllWidgetInputs
+			NTV2OutputXptIDSet					fOutputXpts;	///< @brief	Same as CNTV2SignalRouter::GetAllWidgetOutputs
+			std::vector<uint8_t>				fInputInfo;		///< @brief	Route flags, indexed by NTV2InputXptID
+			std::vector<uint8_t>				fOutputInfo;	///< @brief	Route flags, indexed by NTV2OutputXptID
+			std::vector<NTV2Channel>			fInputChannel;	///< @brief	Owning widget's channel, indexed by NTV2InputXptID
+			std::vector<NTV2Channel>			fOutputChannel;	///< @brief	Owning widget's channel, indexed by NTV2OutputXptID
+			std::vector<RouteConverter>			fConverters;	///< @brief	CSCs first, then dual-link outputs
+			std::map<uint32_t, NTV2XptConnections>	fRoutes;	///< @brief	Solved routes, keyed by RouteKey
+		} DeviceRouteGraph;
+
+		typedef std::map <NTV2DeviceID, DeviceRouteGraph>		DeviceRouteGraphs;
+		typedef DeviceRouteGraphs::const_iterator				DeviceRouteGraphsConstIter;
+
 		private:
 			void InitInputXpt2String(void);
 			void InitOutputXpt2String(void);
@@ -105,6 +140,8 @@ class AJAExport RoutingExpert
 			void InitOutputXpt2WidgetIDs(void);
 			void InitWidgetIDToChannels(void);
 			void InitWidgetIDToWidgetTypes(void);
+			void InitInputXptFlags(void);
+			DeviceRouteGraph & GetDeviceRouteGraph (const NTV2DeviceID inDeviceID);
 
 			mutable AJALock			gLock;
 			String2InputXpt			gString2InputXpt;
@@ -121,6 +158,9 @@ class AJAExport RoutingExpert
 			NTV2InputXptIDSet		gRGBOnlyInputXpts;
 			NTV2InputXptIDSet		gYUVOnlyInputXpts;
 			NTV2InputXptIDSet		gKeyInputXpts;
+			std::vector<uint8_t>	gInputXptFlags;		//	Indexed by NTV2InputXptID:  RGB-only, YUV-only, key bits
+			// Route solver
+			DeviceRouteGraphs		gDeviceRouteGraphs;
 			// NTV2WidgetType Helpers
 			NTV2WidgetTypeSet		gSDIWidgetTypes;
 			NTV2WidgetTypeSet		gSDI3GWidgetTypes;
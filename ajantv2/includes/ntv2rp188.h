@@ -43,6 +43,7 @@ typedef enum
 
 const int64_t kDefaultFrameCount = 0x80000000;
 
+class NTV2TimeCodeBurner;
 
 //--------------------------------------------------------------------------------------------------------------------
 //	class CRP188
@@ -166,14 +167,11 @@ private:
 	RP188_STRUCT		_rp188;				// AJA native format
 
 	bool				_bRendered;			// set 'true' when Burn-In character map has been rendered
-	char *				_pCharRenderMap;	// ptr to rendered Burn-In character set
+	NTV2TimeCodeBurner * _pBurner;			// renders and burns the Burn-In characters
 	NTV2FrameBufferFormat _charRenderFBF;	// frame buffer format of rendered characters
 	ULWord				_charRenderHeight;	// frame height for which rendered characters were rendered
 	ULWord				_charRenderWidth;	// frame width for which rendered characters were rendered
-	int					_charWidthBytes;	// rendered character width in bytes
-	int					_charHeightLines;	// rendered character height in frame lines
-	int					_charPositionX;		// offset (in bytes) from left side of screen to first burn-in character
-	int					_charPositionY;		// offset (in lines) from top of screen to top of burn-in characters
+	LWord				_burnPercentY;		// percent down the screen of the burn-in characters (0 = 80%)
 };	//	CRP188
 
 /**
@@ -0,0 +1,120 @@
+/* SPDX-License-Identifier: MIT */
+/**
+	@file		ntv2scaler.h
+	@brief		Declares the NTV2Scaler class, a separable polyphase host raster scaler.
+	@copyright	(C) 2026 AJA Video Systems, Inc.
+**/
+
+#ifndef NTV2SCALER_H
+#define NTV2SCALER_H
+
+#include "ajaexport.h"
+#include "ajatypes.h"
+#include "ntv2enums.h"
+#include "ntv2publicinterface.h"
+#include "ntv2formatdescriptor.h"
+#include <vector>
+
+
+/**
+	@brief	Scales host rasters to a different width and/or height (e.g. 8K to HD, or UHD to quarter-resolution
+			proxies), without changing their pixel format.
+	@details	The scaler is separable:  each source row is filtered horizontally into a small per-thread cache,
+				and each destination row is then filtered vertically from the cached rows. Rows are spread across
+				threads using ::NTV2ParallelRows.
+				-	The filter is Catmull-Rom (bicubic) when enlarging. When reducing, the filter is stretched by the
+					reduction ratio so that every source pixel contributes (i.e. it low-pass filters to avoid aliasing).
+				-	Filter phases are computed once per source/destination geometry and cached, as 1.14 fixed-point
+					coefficient tables. Each table's coefficients sum to exactly 1.0, so flat areas stay flat.
+				-	The filter loops use SSE2 multiply-accumulate instructions when available.
+				-	Packed source pixels are read directly into the horizontal filter, and filtered results are packed
+					directly into the destination;  there's no full-frame intermediate buffer. 4:2:2 chroma is scaled
+					on its own (co-sited) grid.
+	@note		Each instance keeps its own tables and scratch memory, so use one instance per channel when scaling
+				several channels concurrently.
+**/
+class AJAExport NTV2Scaler
+{
+	//	CLASS METHODS
+	public:
+		/**
+			@return		True if the given pixel format can be scaled.
+			@param[in]	inPixelFormat	Specifies the pixel format of interest. '2vuy' (::NTV2_FBF_8BIT_YCBCR), YUY2,
+										'v210' (::NTV2_FBF_10BIT_YCBCR), and 8-bit RGBA, ARGB and ABGR are supported.
+		**/
+		static bool				IsSupportedPixelFormat (const NTV2PixelFormat inPixelFormat);
+
+	//	INSTANCE METHODS
+	public:
+		/**
+			@brief	Statistics describing the most recent scale operation.
+		**/
+		typedef struct Stats
+		{
+			uint64_t	fMicroseconds;	///< @brief	Elapsed wall-clock time, in microseconds
+			ULWord		fNumWorkers;	///< @brief	Number of workers (threads) used
+			ULWord		fHorzTaps;		///< @brief	Horizontal filter taps (padded to a multiple of 8)
+			ULWord		fVertTaps;		///< @brief	Vertical filter taps
+			bool		fTablesRebuilt;	///< @brief	True if the coefficient tables had to be (re)computed
+			inline Stats () : fMicroseconds(0), fNumWorkers(0), fHorzTaps(0), fVertTaps(0), fTablesRebuilt(false)	{}
+		} Stats;
+
+								NTV2Scaler ();
+		virtual inline			~NTV2Scaler ()	{}
+
+		/**
+			@brief		Scales the visible raster of one host frame buffer into another.
+			@param[in]	inSrcBuffer		Specifies the source host buffer.
+			@param[in]	inSrcDesc		Describes the source raster.
+			@param		inDstBuffer		Specifies the destination host buffer.
+			@param[in]	inDstDesc		Describes the destination raster. Must have the same pixel format as the
+										source, and for 4:2:2 formats, an even width.
+			@return		True if successful;  otherwise false.
+		**/
+		virtual bool			ScaleFrame (const NTV2Buffer & inSrcBuffer, const NTV2FormatDescriptor & inSrcDesc,
+											NTV2Buffer & inDstBuffer, const NTV2FormatDescriptor & inDstDesc);
+
+		/**
+			@name	Options
+		**/
+		///@{
+		inline NTV2Scaler &		setMaxThreads (const ULWord inMaxThreads)	{mMaxThreads = inMaxThreads; return *this;}	///< @brief	Limits the worker count (zero means no limit).
+		inline NTV2Scaler &		setUseSIMD (const bool inUseSIMD)			{mUseSIMD = inUseSIMD; return *this;}		///< @brief	Enables/disables the SSE2 filter loops (for testing).
+		inline ULWord			getMaxThreads (void) const					{return mMaxThreads;}
+		inline bool				getUseSIMD (void) const						{return mUseSIMD;}
+		///@}
+
+		/**
+			@return		Statistics about my most recent successful scale operation.
+		**/
+		inline const Stats &	getLastStats (void) const		{return mStats;}
+
+		/**
+			@brief	One axis of a polyphase filter for one component plane.
+		**/
+		typedef struct Filter
+		{
+			ULWord				fNumTaps;	///< @brief	Coefficients per output sample
+			std::vector<LWord>	fFirst;		///< @brief	First source sample of each output sample (may be negative)
+			std::vector<Word>	fCoeffs;	///< @brief	1.14 fixed-point coefficients (fNumTaps per output sample)
+		} Filter;
+
+	protected:
+		bool					PrepareTables (const NTV2FormatDescriptor & inSrcDesc, const NTV2FormatDescriptor & inDstDesc);
+
+	private:
+		ULWord					mMaxThreads;	///< @brief	Maximum worker count (0 = unlimited)
+		bool					mUseSIMD;		///< @brief	Use SSE2 filter loops?
+		Stats					mStats;			///< @brief	Most recent scale stats
+		NTV2PixelFormat			mPixelFormat;	///< @brief	Pixel format of cached tables
+		ULWord					mSrcWidth;		///< @brief	Source width of cached tables
+		ULWord					mSrcHeight;		///< @brief	Source height of cached tables
+		ULWord					mDstWidth;		///< @brief	Destination width of cached tables
+		ULWord					mDstHeight;		///< @brief	Destination height of cached tables
+		Filter					mHorz[2];		///< @brief	Horizontal filters:  [0] full-width planes, [1] 4:2:2 chroma planes
+		Filter					mVert;			///< @brief	Vertical filter
+		std::vector<Word>		mScratch;		///< @brief	Per-worker row buffers
+		std::vector<LWord>		mCachedRows;	///< @brief	Per-worker source row held in each row cache slot
+};	//	NTV2Scaler
+
+#endif	//	NTV2SCALER_H
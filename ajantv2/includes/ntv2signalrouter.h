@@ -519,6 +519,44 @@ class AJAExport CNTV2SignalRouter
 														NTV2XptConnections & outNew,
 														NTV2XptConnections & outRemoved);	//	New in SDK 16.0
 
+		/**
+			@brief		Computes the register writes needed to change a device's routing from one set of connections
+						to another, touching only the crosspoints that actually change.
+			@param[in]	inCurrent		Specifies the connections currently in effect (e.g. from CNTV2Card::GetConnections).
+			@param[in]	inTarget		Specifies the desired connections. Connections to ::NTV2_XptBlack are disconnects.
+			@param[out] outRegWrites	Receives one masked write per crosspoint select register that changes,
+										or nothing if the routing wouldn't change.
+			@param[in]	inReplace		If true, the default, inputs connected in inCurrent but absent from inTarget
+										are disconnected. If false, they're left alone.
+			@return		True if successful;	 otherwise false.
+		**/
+		static bool					GetChangedRegisterWrites (const NTV2XptConnections & inCurrent,
+															const NTV2XptConnections & inTarget,
+															NTV2RegisterWrites & outRegWrites,
+															const bool inReplace = true);
+
+		/**
+			@brief		Finds the shortest chain of connections that carries the signal from an output crosspoint
+						to an input crosspoint on the given device, passing it through a color space converter (or
+						a dual-link output) if its color space doesn't suit the input.
+			@param[in]	inDeviceID		Specifies the device of interest.
+			@param[in]	inOutputXpt		Specifies where the signal comes from. If it's a FrameStore output, its YUV
+										or RGB variant is picked to match inPixelFormat.
+			@param[in]	inInputXpt		Specifies where the signal goes. If it's a FrameStore input, the signal
+										arriving there must be in the color space of inPixelFormat.
+			@param[in]	inPixelFormat	Specifies the FrameStore pixel format. Use ::NTV2_FBF_INVALID if neither end
+										is a FrameStore.
+			@param[out] outConnections	Receives the connections that make up the route (empty upon failure).
+			@return		True if a route was found;	otherwise false.
+			@note		Each device's widget graph is built the first time it's needed, and every route (found or not)
+						is cached per device, so repeated calls are just a table lookup.
+			@note		Converters are chosen from the same channel as the destination (or source) widget when possible,
+						but the solver doesn't know which widgets are already in use by other routes.
+		**/
+		static bool					FindRoute (const NTV2DeviceID inDeviceID, const NTV2OutputXptID inOutputXpt,
+												const NTV2InputXptID inInputXpt, const NTV2PixelFormat inPixelFormat,
+												NTV2XptConnections & outConnections);
+
 		/**
 			@brief		Decodes a given string into a map of crosspoint connections.
 			@param[in]	inString			Specifies the string to be parsed. It can contain the pnemonics that
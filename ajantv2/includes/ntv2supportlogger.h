@@ -26,10 +26,31 @@ typedef enum
 /**
 	@brief	Generates a standard support log (register log) for any NTV2 device attached to the host.
 			To write the log into a file, open a std::ofstream, then stream this object into it.
+	@details	By default, each section queries the device as it's generated, and the AutoCirculate section waits
+				for a VBI on every channel. In snapshot mode (see setUseSnapshot), the logger instead...
+				-	reads every register (and AutoCirculate status, frame stamps and bitfile info, if needed) up front,
+					using a single bulk CNTV2DriverInterface::ReadRegisters call, and without waiting for any VBIs;
+				-	renders every section from that snapshot, in parallel (using ::NTV2ParallelRows);
+				-	reports how long the device was held (see getLastSnapshotStats).
+				This keeps the driver traffic short enough to take logs periodically from a running production system.
 **/
 class AJAExport CNTV2SupportLogger
 {
 public:
+	/**
+		@brief	Statistics describing the most recent snapshot-mode log.
+	**/
+	typedef struct SnapshotStats
+	{
+		uint64_t	fHoldMicroseconds;		///< @brief	Time spent reading from the device, in microseconds
+		uint64_t	fRenderMicroseconds;	///< @brief	Time spent rendering the log text, in microseconds
+		ULWord		fNumRegisters;			///< @brief	Number of registers in the bulk read
+		ULWord		fNumQueries;			///< @brief	Number of device queries made while holding the device (bulk read, A/C status, etc.)
+		ULWord		fNumLateReads;			///< @brief	Registers that weren't in the snapshot, and were read while rendering
+		ULWord		fNumWorkers;			///< @brief	Number of workers (threads) used to render
+		inline SnapshotStats () : fHoldMicroseconds(0), fRenderMicroseconds(0), fNumRegisters(0), fNumQueries(0), fNumLateReads(0), fNumWorkers(0)	{}
+	} SnapshotStats;
+
 	/**
 		@brief		Construct from CNTV2Card instance.
 		@param[in]	card		Specifies the CNTV2Card instance of the device to be logged. The instance should already be open.
@@ -89,8 +110,23 @@ public:
 
 	virtual bool		LoadFromLog			(const std::string & inLogFilePath, const bool bForceLoad);
 
+	/**
+		@name	Options
+	**/
+	///@{
+	inline CNTV2SupportLogger &	setUseSnapshot (const bool inUseSnapshot)	{mUseSnapshot = inUseSnapshot; return *this;}	///< @brief	Enables/disables snapshot mode (see above). Ignored for remote devices.
+	inline bool					getUseSnapshot (void) const					{return mUseSnapshot;}
+	///@}
+
+	/**
+		@return		Statistics about my most recent snapshot-mode log.
+	**/
+	inline const SnapshotStats &	getLastSnapshotStats (void) const		{return mSnapshotStats;}
+
 
 private:
+	std::string	SnapshotToString	(void) const;
+	static void	RenderSnapshotJobs	(void * pInContext, const ULWord inWorkerIndex, const ULWord inFirstJob, const ULWord inNumJobs);
 	void	FetchInfoLog			(std::ostringstream& oss) const;
 	void	FetchRegisterLog		(std::ostringstream& oss) const;
 	void	FetchAutoCirculateLog	(std::ostringstream& oss) const;
@@ -105,6 +141,8 @@ private:
 	std::string						mFooterStr;
 	std::map<uint32_t, std::string> mPrependMap;
 	std::map<uint32_t, std::string> mAppendMap;
+	bool							mUseSnapshot;
+	mutable SnapshotStats			mSnapshotStats;
 
 public:
 	static std::string	InventLogFilePathAndName (CNTV2Card & inDevice,
@@ -0,0 +1,142 @@
+/* SPDX-License-Identifier: MIT */
+/**
+	@file		ntv2timecodeburner.h
+	@brief		Declares the NTV2TimeCodeBurner class, a glyph-atlas timecode burn-in for host rasters.
+	@copyright	(C) 2026 AJA Video Systems, Inc.
+**/
+
+#ifndef NTV2TIMECODEBURNER_H
+#define NTV2TIMECODEBURNER_H
+
+#include "ajaexport.h"
+#include "ajatypes.h"
+#include "ntv2enums.h"
+#include "ntv2publicinterface.h"
+#include "ntv2formatdescriptor.h"
+#include <string>
+#include <vector>
+
+
+/**
+	@brief	Burns timecode (or any string of the characters "0123456789:;- *") into host rasters of any pixel format
+			that NTV2FrameConverter supports, including 'v210', the 10/12-bit RGB formats, and the planar formats.
+	@details	The glyphs are rendered once per pixel format and raster size into an atlas that holds, for every
+				glyph pixel, a premultiplied color and an inverse alpha, both in NTV2FrameConverter's intermediate
+				16-bit form (see NTV2FrameConverter::UnpackPixels). Each burn then...
+				-	unpacks only the rows and columns covered by the burn-in box;
+				-	alpha-blends every character cell from the atlas (using SSE2 when available);
+				-	packs the box back into the raster.
+				The whole box is always blended, so the cost doesn't depend on how many characters changed since
+				the previous frame.
+	@note		The glyphs are white on a black box. The box is opaque by default, which exactly matches the look
+				of AJATimeCodeBurn and CRP188::BurnTC. Use setBoxOpacity to let the picture show through.
+**/
+class AJAExport NTV2TimeCodeBurner
+{
+	//	CLASS METHODS
+	public:
+		static const ULWord	kDefaultNumChars	= 11;	///< @brief	Default box width, in characters ("00:00:00:00")
+		static const ULWord	kMaxNumChars		= 16;	///< @brief	Maximum characters per burn
+
+		/**
+			@return		True if the given pixel format can be burned into.
+			@param[in]	inPixelFormat	Specifies the pixel format of interest.
+		**/
+		static bool				IsSupportedPixelFormat (const NTV2PixelFormat inPixelFormat);
+
+		/**
+			@return		The glyph index of the given character, or -1 if there's no glyph for it (it's burned as a space).
+			@param[in]	inChar	Specifies the character of interest.
+		**/
+		static int				GetGlyphIndex (const char inChar);
+
+	//	INSTANCE METHODS
+	public:
+		/**
+			@brief	Statistics describing the most recent burn.
+		**/
+		typedef struct Stats
+		{
+			uint64_t	fMicroseconds;	///< @brief	Elapsed wall-clock time, in microseconds
+			ULWord		fNumChars;		///< @brief	Number of character cells blended
+			ULWord		fBoxX;			///< @brief	Left edge of the burn-in box, in pixels
+			ULWord		fBoxY;			///< @brief	Top edge of the burn-in box, in raster rows
+			ULWord		fBoxWidth;		///< @brief	Width of the burn-in box, in pixels
+			ULWord		fBoxHeight;		///< @brief	Height of the burn-in box, in raster rows
+			bool		fAtlasRebuilt;	///< @brief	True if the glyph atlas had to be (re)rendered
+			inline Stats () : fMicroseconds(0), fNumChars(0), fBoxX(0), fBoxY(0), fBoxWidth(0), fBoxHeight(0), fAtlasRebuilt(false)	{}
+		} Stats;
+
+								NTV2TimeCodeBurner ();
+		virtual inline			~NTV2TimeCodeBurner ()	{}
+
+		/**
+			@brief		Renders the glyph atlas for the given raster, if it hasn't already been rendered. This is done
+						automatically by BurnTimeCode, but calling it ahead of time keeps the first burn fast.
+			@param[in]	inDesc		Describes the raster.
+			@return		True if successful;  otherwise false.
+		**/
+		virtual bool			Prepare (const NTV2FormatDescriptor & inDesc);
+
+		/**
+			@brief		Burns the given string into the visible area of the given host raster.
+			@param		inFrame			Specifies the host buffer to burn into.
+			@param[in]	inDesc			Describes the raster.
+			@param[in]	inString		Specifies the string to burn (e.g. "01:00:00:00"). Shorter strings are padded
+										with spaces to fill the box.
+			@param[in]	inYPercent		Specifies how far down the visible raster the box's top edge should be, in percent.
+										Zero means 80%. The box is moved up if it would extend past the bottom edge.
+			@return		True if successful;  otherwise false.
+		**/
+		virtual bool			BurnTimeCode (NTV2Buffer & inFrame, const NTV2FormatDescriptor & inDesc,
+												const std::string & inString, const ULWord inYPercent = 80);
+
+		/**
+			@brief		Same as above, but takes a raw raster address, which must be large enough for the descriptor.
+		**/
+		virtual bool			BurnTimeCode (void * pInFrame, const NTV2FormatDescriptor & inDesc,
+												const std::string & inString, const ULWord inYPercent = 80);
+
+		/**
+			@name	Options
+		**/
+		///@{
+		inline NTV2TimeCodeBurner &	setNumChars (const ULWord inNumChars)		{if (inNumChars && inNumChars <= kMaxNumChars) mNumChars = inNumChars; return *this;}	///< @brief	Sets the box width, in characters. Longer strings extend the box to the right.
+		NTV2TimeCodeBurner &		setBoxOpacity (const double inOpacity);		///< @brief	Sets the box opacity, from 0.0 (glyphs only) to 1.0 (opaque, the default).
+		inline NTV2TimeCodeBurner &	setUseSIMD (const bool inUseSIMD)			{mUseSIMD = inUseSIMD; return *this;}		///< @brief	Enables/disables the SSE2 blend loop (for testing).
+		inline ULWord				getNumChars (void) const					{return mNumChars;}
+		inline double				getBoxOpacity (void) const					{return mBoxOpacity;}
+		inline bool					getUseSIMD (void) const						{return mUseSIMD;}
+		///@}
+
+		/**
+			@return		The width of each character cell, in pixels, or zero if no atlas has been rendered.
+		**/
+		inline ULWord			getCharWidth (void) const		{return mCharWidth;}
+
+		/**
+			@return		The height of each character cell, in raster rows, or zero if no atlas has been rendered.
+		**/
+		inline ULWord			getCharHeight (void) const		{return mCharHeight;}
+
+		/**
+			@return		Statistics about my most recent successful burn.
+		**/
+		inline const Stats &	getLastStats (void) const		{return mStats;}
+
+	private:
+		ULWord					mNumChars;		///< @brief	Box width, in characters
+		double					mBoxOpacity;	///< @brief	Box opacity (0.0 - 1.0)
+		bool					mUseSIMD;		///< @brief	Use SSE2 blend loop?
+		Stats					mStats;			///< @brief	Most recent burn stats
+		NTV2PixelFormat			mPixelFormat;	///< @brief	Pixel format of the atlas
+		ULWord					mRasterWidth;	///< @brief	Raster width the atlas was rendered for
+		ULWord					mRasterHeight;	///< @brief	Raster height the atlas was rendered for
+		ULWord					mCharWidth;		///< @brief	Character cell width, in pixels
+		ULWord					mCharHeight;	///< @brief	Character cell height, in raster rows
+		ULWord					mDotHeight;		///< @brief	Raster rows per glyph dot row
+		std::vector<UWord>		mAtlas;			///< @brief	Rendered glyphs:  [glyph][dot row][pixel] premultiplied color & inverse alpha
+		std::vector<UWord>		mRow;			///< @brief	One unpacked box row
+};	//	NTV2TimeCodeBurner
+
+#endif	//	NTV2TIMECODEBURNER_H
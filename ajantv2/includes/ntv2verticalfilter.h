@@ -1,7 +1,7 @@
 /* SPDX-License-Identifier: MIT */
 /**
 	@file		ntv2verticalfilter.h
-	@brief		Declares the VerticalFilterLine and FieldInterpolateLine functions.
+	@brief		Declares the VerticalFilterLine and FieldInterpolateLine functions, and the NTV2Deinterlacer class.
 	@copyright	(C) 2004-2022 AJA Video Systems, Inc.
 **/
 
@@ -12,6 +12,10 @@
 #include "ajatypes.h"
 #include "ntv2videodefines.h"
 #include "ntv2fixed.h"
+#include "ntv2publicinterface.h"
+#include "ntv2formatdescriptor.h"
+#include "ajabase/common/performance.h"
+#include <vector>
 
 
 AJAExport void	VerticalFilterLine (	RGBAlphaPixel *	topLine,
@@ -25,4 +29,103 @@ AJAExport void	FieldInterpolateLine (	RGBAlphaPixel *	topLine,
 										RGBAlphaPixel *	destLine,
 										LWord			numPixels	);
 
+
+
+/**
+	@brief	Identifies a host deinterlacing method.
+**/
+typedef enum
+{
+	NTV2_DEINTERLACE_BOB,				///< @brief	Keeps one field, and replaces the other field's lines with the average of the lines above and below
+	NTV2_DEINTERLACE_BLEND,				///< @brief	Filters every line with its neighbors (1/4, 1/2, 1/4), blending both fields together
+	NTV2_DEINTERLACE_MOTION_ADAPTIVE,	///< @brief	Keeps one field, and replaces the other field's samples like ::NTV2_DEINTERLACE_BOB
+										///<		only where they've changed since the previous frame (otherwise keeps them)
+	NTV2_DEINTERLACE_INVALID
+} NTV2DeinterlaceMode;
+
+#define	NTV2_IS_VALID_DEINTERLACE_MODE(__m__)	((__m__) >= NTV2_DEINTERLACE_BOB  &&  (__m__) < NTV2_DEINTERLACE_INVALID)
+
+
+/**
+	@brief	Deinterlaces host frames (e.g. for interlaced capture previews and confidence monitors).
+	@details	Works on the visible raster of '2vuy', YUY2, 'v210' and 8-bit RGBA, ARGB and ABGR frames. Each component
+				sample is processed independently, so the same filters apply to YCbCr and RGB. 8-bit rows are filtered
+				in place in their packed form;  'v210' rows are expanded to 16-bit samples (three per 32-bit word) and
+				repacked. The filter loops use SSE2 when available, and rows are spread across threads using
+				::NTV2ParallelRows.
+
+				Motion is detected per sample, as the largest absolute difference between this frame and the previous
+				one at that sample and at the same position in the lines above and below. Samples whose motion exceeds
+				the threshold are interpolated;  others are woven from the current frame. The first frame after a
+				geometry change (or after ::Reset) has no history, and is bobbed.
+
+				Each call's elapsed time is accumulated into an AJAPerformance object (in microseconds).
+	@note		Motion-adaptive mode keeps the two most recent source frames, so use one instance per channel.
+**/
+class AJAExport NTV2Deinterlacer
+{
+	//	CLASS METHODS
+	public:
+		/**
+			@return		True if the given pixel format can be deinterlaced.
+			@param[in]	inPixelFormat	Specifies the pixel format of interest.
+		**/
+		static bool				IsSupportedPixelFormat (const NTV2PixelFormat inPixelFormat);
+
+	//	INSTANCE METHODS
+	public:
+		explicit				NTV2Deinterlacer (const NTV2DeinterlaceMode inMode = NTV2_DEINTERLACE_MOTION_ADAPTIVE);
+		virtual inline			~NTV2Deinterlacer ()	{}
+
+		/**
+			@brief		Deinterlaces one frame.
+			@param[in]	inSrcBuffer		Specifies the source host buffer.
+			@param		inDstBuffer		Specifies the destination host buffer. May be the same as the source buffer.
+			@param[in]	inDesc			Describes both rasters.
+			@return		True if successful;  otherwise false.
+			@note		Only the visible rows are processed;  VANC rows in the destination are left untouched.
+		**/
+		virtual bool			DeinterlaceFrame (const NTV2Buffer & inSrcBuffer, NTV2Buffer & inDstBuffer, const NTV2FormatDescriptor & inDesc);
+
+		/**
+			@brief		Forgets the previous frame, so the next motion-adaptive frame is bobbed.
+		**/
+		virtual void			Reset (void);
+
+		/**
+			@name	Options
+		**/
+		///@{
+		inline NTV2Deinterlacer &	setMode (const NTV2DeinterlaceMode inMode)	{mMode = inMode;  return *this;}
+		inline NTV2Deinterlacer &	setField (const NTV2FieldID inField)		{mField = inField;  return *this;}	///< @brief	Sets the field to keep (NTV2_FIELD0 keeps the even lines).
+		inline NTV2Deinterlacer &	setMotionThreshold (const UWord inThreshold)	{mThreshold = inThreshold;  return *this;}	///< @brief	Sets the motion threshold, in 8-bit units (scaled for 'v210').
+		inline NTV2Deinterlacer &	setMaxThreads (const ULWord inMaxThreads)	{mMaxThreads = inMaxThreads;  return *this;}	///< @brief	Limits the worker count (zero means no limit).
+		inline NTV2Deinterlacer &	setUseSIMD (const bool inUseSIMD)			{mUseSIMD = inUseSIMD;  return *this;}	///< @brief	Enables/disables the SSE2 filter loops (for testing).
+		inline NTV2DeinterlaceMode	getMode (void) const						{return mMode;}
+		inline NTV2FieldID			getField (void) const						{return mField;}
+		inline UWord				getMotionThreshold (void) const				{return mThreshold;}
+		inline ULWord				getMaxThreads (void) const					{return mMaxThreads;}
+		inline bool					getUseSIMD (void) const						{return mUseSIMD;}
+		///@}
+
+		/**
+			@return		A non-constant reference to my per-frame cost statistics (in microseconds).
+		**/
+		inline AJAPerformance &	getPerformance (void)		{return mPerf;}
+
+	private:
+		NTV2DeinterlaceMode		mMode;			///< @brief	Deinterlace method
+		NTV2FieldID				mField;			///< @brief	Field to keep
+		UWord					mThreshold;		///< @brief	Motion threshold, in 8-bit units
+		ULWord					mMaxThreads;	///< @brief	Maximum worker count (0 = unlimited)
+		bool					mUseSIMD;		///< @brief	Use SSE2 filter loops?
+		NTV2Buffer				mHistory[2];	///< @brief	Previous/current source frames (visible rows only)
+		ULWord					mHistoryNdx;	///< @brief	Index of mHistory buffer holding the previous frame
+		bool					mHasHistory;	///< @brief	True if mHistory[mHistoryNdx] holds a previous frame
+		NTV2FormatDescriptor	mHistoryDesc;	///< @brief	Raster the history is for
+		NTV2Buffer				mSrcCopy;		///< @brief	Copy of the source, for in-place blending
+		std::vector<UWord>		mScratch;		///< @brief	Per-worker 'v210' sample rows
+		AJAPerformance			mPerf;			///< @brief	Per-frame cost
+};	//	NTV2Deinterlacer
+
 #endif	//	VERTICALFILTER_H
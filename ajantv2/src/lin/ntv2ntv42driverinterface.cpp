@@ -0,0 +1,641 @@
+/* SPDX-License-Identifier: MIT */
+/**
+	@file		ntv2ntv42driverinterface.cpp
+	@brief		Implementation of the CNTV2Ntv42DriverInterface class.
+	@copyright	(C) 2026 AJA Video Systems, Inc.
+**/
+#include "ntv2ntv42driverinterface.h"
+#include "ntv2version.h"
+#include "ntv2utils.h"
+#include "driver/ntv42ioctl.h"
+#include "ajabase/system/debug.h"
+#include <fcntl.h>
+#include <errno.h>
+#include <sys/ioctl.h>
+#include <unistd.h>
+
+using namespace std;
+
+
+//	Ntv42DriverInterface Logging Macros
+#define HEX8(__x__)			"0x" << hex << setw(8)	<< setfill('0') << (0xFFFFFFFF & uint32_t(__x__)) << dec
+#define HEX16(__x__)		"0x" << hex << setw(16) << setfill('0') <<				 uint64_t(__x__)  << dec
+#define INSTP(_p_)			HEX16(uint64_t(_p_))
+
+#define LDIFAIL(__x__)		AJA_sERROR	(AJA_DebugUnit_DriverInterface, INSTP(this) << "::" << AJAFUNC << ": " << __x__)
+#define LDIWARN(__x__)		AJA_sWARNING(AJA_DebugUnit_DriverInterface, INSTP(this) << "::" << AJAFUNC << ": " << __x__)
+#define LDINOTE(__x__)		AJA_sNOTICE (AJA_DebugUnit_DriverInterface, INSTP(this) << "::" << AJAFUNC << ": " << __x__)
+#define LDIINFO(__x__)		AJA_sINFO	(AJA_DebugUnit_DriverInterface, INSTP(this) << "::" << AJAFUNC << ": " << __x__)
+#define LDIDBG(__x__)		AJA_sDEBUG	(AJA_DebugUnit_DriverInterface, INSTP(this) << "::" << AJAFUNC << ": " << __x__)
+
+#define	NTV42_DIRECTION_TO_DEVICE		1
+#define	NTV42_DIRECTION_FROM_DEVICE		2
+#define	NTV42_EVENT_TYPE_OUTPUT_VSYNC	0x0001
+#define	NTV42_EVENT_TYPE_INPUT_VSYNC	0x0002
+#define	NTV42_EVENT_TYPE_AUDIO_IN_WRAP	0x0200
+#define	NTV42_EVENT_TYPE_AUDIO_OUT_WRAP	0x0201
+
+
+//	Maps an NTV2 interrupt to its ntv42 event type and index. Returns false if the interrupt has no ntv42 event.
+static bool InterruptToNtv42Event (const INTERRUPT_ENUMS inInterrupt, uint32_t & outType, uint32_t & outIndex)
+{
+	static const INTERRUPT_ENUMS sOutputs[] = {eOutput1, eOutput2, eOutput3, eOutput4, eOutput5, eOutput6, eOutput7, eOutput8};
+	static const INTERRUPT_ENUMS sInputs[]	= {eInput1,	eInput2,  eInput3,	eInput4,  eInput5,	eInput6,  eInput7,	eInput8};
+	for (uint32_t ndx(0);  ndx < 8;  ndx++)
+	{
+		if (inInterrupt == sOutputs[ndx])
+			{outType = NTV42_EVENT_TYPE_OUTPUT_VSYNC;	outIndex = ndx;	return true;}
+		if (inInterrupt == sInputs[ndx])
+			{outType = NTV42_EVENT_TYPE_INPUT_VSYNC;	outIndex = ndx;	return true;}
+	}
+	outIndex = 0;
+	if (inInterrupt == eAudioInWrap)
+		{outType = NTV42_EVENT_TYPE_AUDIO_IN_WRAP;	return true;}
+	if (inInterrupt == eAudioOutWrap)
+		{outType = NTV42_EVENT_TYPE_AUDIO_OUT_WRAP;	return true;}
+	return false;
+}
+
+
+CNTV2Ntv42DriverInterface::CNTV2Ntv42DriverInterface()
+	:	_ntv42Version		(0)
+		,_ntv42Capabilities	(0)
+		,_ntv42DMAEngines	(0)
+		,_ntv42BAR0Size		(0)
+		,_ntv2DriverNode	(false)
+{
+	::memset(_ntv42EventCounts, 0, sizeof(_ntv42EventCounts));
+}
+
+CNTV2Ntv42DriverInterface::~CNTV2Ntv42DriverInterface()
+{
+	if (IsOpen())
+		Close();
+}
+
+
+#if !defined(NTV2_NULL_DEVICE)
+/////////////////////////////////////////////////////////////////////////////////////
+// Board Open / Close methods
+/////////////////////////////////////////////////////////////////////////////////////
+bool CNTV2Ntv42DriverInterface::OpenLocalPhysical (const UWord inDeviceIndex)
+{
+	static const string kNodeNames[] = {"ntv42dummy", "ajantv2"};
+	NTV2_ASSERT(!IsRemote());
+	NTV2_ASSERT(!IsOpen());
+
+	string boardStr;
+	UWord count(0);
+	ntv42_ioctl_version_t versionInfo;
+	for (size_t nameNdx(0);  nameNdx < sizeof(kNodeNames) / sizeof(kNodeNames[0])  &&  _hDevice == INVALID_HANDLE_VALUE;  nameNdx++)
+		for (UWord index(0);  index < NTV2_MAXBOARDS;  index++)
+		{
+			ostringstream oss;	oss << "/dev/" << kNodeNames[nameNdx] << DEC(index);
+			boardStr = oss.str();
+			const int fd (open(boardStr.c_str(), O_RDWR));
+			if (fd < 0)
+				continue;
+			memset(&versionInfo, 0, sizeof(versionInfo));
+			if (ioctl(fd, IOCTL_NTV42_VERSION, &versionInfo)  ||  !(versionInfo.capabilities & NTV42_CAP_REGIO))
+			{	//	Not an ntv42 device (e.g. an NTV2 driver built without AJA_NTV42)
+				LDIDBG("'" << boardStr << "' doesn't support the ntv42 interface");
+				close(fd);
+				continue;
+			}
+			if (count++ == inDeviceIndex)
+			{
+				_hDevice = HANDLE(fd);
+				_ntv2DriverNode = nameNdx > 0;
+				break;
+			}
+			close(fd);
+		}
+
+	if (_hDevice == INVALID_HANDLE_VALUE)
+		{LDIFAIL("Failed to open device index '" << inDeviceIndex << "'");  return false;}
+
+	_ntv42Version = versionInfo.version;
+	_ntv42Capabilities = versionInfo.capabilities;
+	ntv42_ioctl_device_info_t deviceInfo;
+	memset(&deviceInfo, 0, sizeof(deviceInfo));
+	if (!ioctl(int(_hDevice), IOCTL_NTV42_DEVICE_INFO, &deviceInfo)  &&  deviceInfo.bar_count)
+		_ntv42BAR0Size = deviceInfo.bar[0].size;
+	ntv42_ioctl_dma_info_t dmaInfo;
+	memset(&dmaInfo, 0, sizeof(dmaInfo));
+	if ((_ntv42Capabilities & NTV42_CAP_DMA)  &&  !ioctl(int(_hDevice), IOCTL_NTV42_DMA_INFO, &dmaInfo))
+		_ntv42DMAEngines = dmaInfo.engine_count;
+	::memset(_ntv42EventCounts, 0, sizeof(_ntv42EventCounts));
+	{
+		AJAAutoLock autoLock(&_emulatedRegsLock);
+		_emulatedRegs.clear();
+		if (!_ntv2DriverNode)
+			_emulatedRegs[kVRegDriverVersion] = NTV2DriverVersionEncode(AJA_NTV2_SDK_VERSION_MAJOR, AJA_NTV2_SDK_VERSION_MINOR,
+																		AJA_NTV2_SDK_VERSION_POINT, AJA_NTV2_SDK_BUILD_NUMBER);
+	}
+
+	setDeviceIndexNumber(inDeviceIndex);
+	if (!CNTV2DriverInterface::ReadRegister(kRegBoardID, _boardID))
+	{
+		LDIFAIL ("ReadRegister failed for 'kRegBoardID': ndx=" << inDeviceIndex << " hDev=" << _hDevice << " id=" << HEX8(_boardID));
+		close(int(_hDevice));
+		_hDevice = INVALID_HANDLE_VALUE;
+		return false;
+	}
+	_boardOpened = true;
+	LDIINFO ("Opened '" << boardStr << "' devID=" << HEX8(_boardID) << " ndx=" << DEC(GetIndexNumber())
+			<< " ntv42v" << DEC(_ntv42Version) << " caps=" << HEX8(_ntv42Capabilities) << " BAR0=" << DEC(_ntv42BAR0Size)
+			<< " DMAEngines=" << DEC(_ntv42DMAEngines));
+	return true;
+}
+
+
+bool CNTV2Ntv42DriverInterface::CloseLocalPhysical (void)
+{
+	LDIINFO ("Closed deviceID=" << HEX8(_boardID) << " ndx=" << DEC(GetIndexNumber()) << " hDev=" << _hDevice);
+	if (_hDevice != INVALID_HANDLE_VALUE)
+		close(int(_hDevice));
+	_hDevice = INVALID_HANDLE_VALUE;
+	_boardOpened = false;
+	_boardID = DEVICE_ID_NOTFOUND;
+	_ntv42Version = _ntv42Capabilities = _ntv42DMAEngines = 0;
+	_ntv42BAR0Size = 0;
+	_ntv2DriverNode = false;
+	::memset(_ntv42EventCounts, 0, sizeof(_ntv42EventCounts));
+	AJAAutoLock autoLock(&_emulatedRegsLock);
+	_emulatedRegs.clear();
+	return true;
+}
+#endif	//	!defined(NTV2_NULL_DEVICE)
+
+
+///////////////////////////////////////////////////////////////////////////////////
+// Read and Write Register methods
+///////////////////////////////////////////////////////////////////////////////////
+
+bool CNTV2Ntv42DriverInterface::IsEmulatedRegister (const ULWord inRegNum) const
+{
+	if (_ntv2DriverNode)
+		return false;	//	The NTV2 driver answers its own virtual registers
+	return inRegNum >= VIRTUALREG_START  ||  (_ntv42BAR0Size  &&  ULWord64(inRegNum) * 4 >= _ntv42BAR0Size);
+}
+
+
+bool CNTV2Ntv42DriverInterface::ReadRegisterWindow (const ULWord inRegNum, ULWord * pOutValues, const ULWord inCount)
+{
+	if ((_hDevice == INVALID_HANDLE_VALUE) || (_hDevice == 0))
+		return false;
+	ntv42_ioctl_regio_t regio;
+	memset(&regio, 0, sizeof(regio));
+	regio.bar		= 0;
+	regio.count		= inCount;
+	regio.offset	= ULWord64(inRegNum) * 4;
+	regio.data_ptr	= uint64_t(uintptr_t(pOutValues));
+	AJADebug::StatTimerStart(AJA_DebugStat_ReadRegister);
+	const int result (ioctl(int(_hDevice), IOCTL_NTV42_REG_READ, &regio));
+	AJADebug::StatTimerStop(AJA_DebugStat_ReadRegister);
+	if (result)
+		{LDIFAIL("IOCTL_NTV42_REG_READ failed: reg=" << DEC(inRegNum) << " count=" << DEC(inCount) << ": " << strerror(errno));	return false;}
+	return true;
+}
+
+
+bool CNTV2Ntv42DriverInterface::WriteRegisterWindow (const ULWord inRegNum, const ULWord * pInValues, const ULWord inCount)
+{
+	if ((_hDevice == INVALID_HANDLE_VALUE) || (_hDevice == 0))
+		{LDIFAIL("_hDevice is invalid (0 or -1)");  return false;}
+	ntv42_ioctl_regio_t regio;
+	memset(&regio, 0, sizeof(regio));
+	regio.bar		= 0;
+	regio.count		= inCount;
+	regio.offset	= ULWord64(inRegNum) * 4;
+	regio.data_ptr	= uint64_t(uintptr_t(pInValues));
+	AJADebug::StatTimerStart(AJA_DebugStat_WriteRegister);
+	const int result (ioctl(int(_hDevice), IOCTL_NTV42_REG_WRITE, &regio));
+	AJADebug::StatTimerStop(AJA_DebugStat_WriteRegister);
+	if (result)
+		{LDIFAIL("IOCTL_NTV42_REG_WRITE failed: reg=" << DEC(inRegNum) << " count=" << DEC(inCount) << ": " << strerror(errno));	return false;}
+	return true;
+}
+
+
+bool CNTV2Ntv42DriverInterface::SubmitRegisterBatch (const NTV2RegInfo * pInRegInfos, const ULWord inCount)
+{
+	if (!pInRegInfos  ||  !inCount  ||  inCount > NTV42_REGBATCH_MAX_ENTRIES)
+		return false;
+	if (!(_ntv42Capabilities & NTV42_CAP_REGBATCH_IMMEDIATE))
+		return false;
+	ntv42_ioctl_regbatch_entry_t entries[NTV42_REGBATCH_MAX_ENTRIES];
+	for (ULWord ndx(0);  ndx < inCount;  ndx++)
+	{
+		const NTV2RegInfo & regInfo (pInRegInfos[ndx]);
+		if (regInfo.registerShift >= 32)
+			return false;
+		entries[ndx].bar	= 0;
+		entries[ndx].offset	= regInfo.registerNumber * 4;
+		entries[ndx].mask	= regInfo.registerMask;
+		entries[ndx].value	= (regInfo.registerValue << regInfo.registerShift) & regInfo.registerMask;
+	}
+	ntv42_ioctl_regbatch_submit_t submit;
+	memset(&submit, 0, sizeof(submit));
+	submit.flags		= NTV42_REGBATCH_IMMEDIATE;
+	submit.entry_count	= inCount;
+	submit.entries_ptr	= uint64_t(uintptr_t(entries));
+	AJADebug::StatTimerStart(AJA_DebugStat_WriteRegister);
+	const int result (ioctl(int(_hDevice), IOCTL_NTV42_REGBATCH_SUBMIT, &submit));
+	AJADebug::StatTimerStop(AJA_DebugStat_WriteRegister);
+	if (result)
+		{LDIFAIL("IOCTL_NTV42_REGBATCH_SUBMIT failed: " << DEC(inCount) << " entries: " << strerror(errno));	return false;}
+	return true;
+}
+
+
+bool CNTV2Ntv42DriverInterface::ReadRegister (const ULWord inRegNum,  ULWord & outValue,  const ULWord inMask,	const ULWord inShift)
+{
+	if (inShift >= 32)
+	{
+		LDIFAIL("Shift " << DEC(inShift) << " > 31, reg=" << DEC(inRegNum) << " msk=" << xHEX0N(inMask,8));
+		return false;
+	}
+	if (IsRemote())
+		return CNTV2LinuxDriverInterface::ReadRegister (inRegNum, outValue, inMask, inShift);
+	if (IsEmulatedRegister(inRegNum))
+	{
+		AJAAutoLock autoLock(&_emulatedRegsLock);
+		NTV2RegValueMapConstIter it (_emulatedRegs.find(inRegNum));
+		outValue = ((it != _emulatedRegs.end() ? it->second : 0) & inMask) >> inShift;
+		return true;
+	}
+	if (inRegNum >= VIRTUALREG_START)
+		return CNTV2LinuxDriverInterface::ReadRegister (inRegNum, outValue, inMask, inShift);
+
+	ULWord value(0);
+	if (!ReadRegisterWindow(inRegNum, &value, 1))
+		return false;
+	outValue = (value & inMask) >> inShift;
+	return true;
+}
+
+
+bool CNTV2Ntv42DriverInterface::WriteRegister (const ULWord inRegNum,  const ULWord inValue,  const ULWord inMask, const ULWord inShift)
+{
+	if (inShift >= 32)
+	{
+		LDIFAIL("Shift " << DEC(inShift) << " > 31, reg=" << DEC(inRegNum) << " msk=" << xHEX0N(inMask,8));
+		return false;
+	}
+#if defined(NTV2_WRITEREG_PROFILING)	//	Register Write Profiling
+	if (mRecordRegWrites)
+	{
+		AJAAutoLock autoLock(&mRegWritesLock);
+		mRegWrites.push_back(NTV2RegInfo(inRegNum, inValue, inMask, inShift));
+		if (mSkipRegWrites)
+			return true;
+	}
+#endif	//	defined(NTV2_WRITEREG_PROFILING)	//	Register Write Profiling
+	if (IsRemote())
+		return CNTV2LinuxDriverInterface::WriteRegister(inRegNum, inValue, inMask, inShift);
+	if (IsEmulatedRegister(inRegNum))
+	{
+		AJAAutoLock autoLock(&_emulatedRegsLock);
+		ULWord & regValue (_emulatedRegs[inRegNum]);
+		regValue = (regValue & ~inMask) | ((inValue << inShift) & inMask);
+		return true;
+	}
+	if (inRegNum >= VIRTUALREG_START)
+		return CNTV2LinuxDriverInterface::WriteRegister(inRegNum, inValue, inMask, inShift);
+
+	if (inMask == 0xFFFFFFFF)
+	{
+		const ULWord value (inValue << inShift);
+		return WriteRegisterWindow(inRegNum, &value, 1);
+	}
+	if (_ntv42Capabilities & NTV42_CAP_REGBATCH_IMMEDIATE)
+	{	//	The driver does the read-modify-write atomically
+		const NTV2RegInfo regInfo (inRegNum, inValue, inMask, inShift);
+		return SubmitRegisterBatch(&regInfo, 1);
+	}
+
+	//	Older drivers:  read-modify-write, atomic only within this process...
+	AJAAutoLock autoLock(&_emulatedRegsLock);
+	ULWord value(0);
+	if (!ReadRegisterWindow(inRegNum, &value, 1))
+		return false;
+	value = (value & ~inMask) | ((inValue << inShift) & inMask);
+	return WriteRegisterWindow(inRegNum, &value, 1);
+}
+
+
+bool CNTV2Ntv42DriverInterface::HandleGetRegisters (NTV2GetRegisters & inOutMessage)
+{
+	const ULWord	numRegs		(inOutMessage.numRegisters());
+	const ULWord *	pRegNums	(inOutMessage.requestedRegisterNumbers());
+	ULWord *		pGoodRegs	(inOutMessage.outGoodRegisterNumbers());
+	ULWord *		pValues		(inOutMessage.outRegisterValues());
+	ULWord &		numGood		(inOutMessage.outNumRegisters());
+	numGood = 0;
+	if (!numRegs)
+		return true;
+	if (!pRegNums  ||  !pGoodRegs  ||  !pValues)
+		return false;
+
+	//	Read each run of consecutive BAR0 registers with one ioctl...
+	NTV2ULWordVector runValues;
+	for (ULWord ndx(0);  ndx < numRegs;  )
+	{
+		const ULWord regNum (pRegNums[ndx]);
+		if (IsEmulatedRegister(regNum)  ||  regNum >= VIRTUALREG_START)
+		{
+			ULWord value(0);
+			if (ReadRegister(regNum, value))
+				{pGoodRegs[numGood] = regNum;	pValues[numGood++] = value;}
+			ndx++;
+			continue;
+		}
+		ULWord runLength(1);
+		while (ndx + runLength < numRegs
+				&&  pRegNums[ndx + runLength] == regNum + runLength
+				&&  !IsEmulatedRegister(regNum + runLength)
+				&&  regNum + runLength < VIRTUALREG_START)
+			runLength++;
+		runValues.resize(runLength);
+		if (ReadRegisterWindow(regNum, &runValues[0], runLength))
+			for (ULWord runNdx(0);  runNdx < runLength;  runNdx++)
+				{pGoodRegs[numGood] = regNum + runNdx;	pValues[numGood++] = runValues[runNdx];}
+		ndx += runLength;
+	}
+	return true;
+}
+
+
+bool CNTV2Ntv42DriverInterface::HandleSetRegisters (NTV2SetRegisters & inOutMessage)
+{
+	const ULWord			numRegs		(inOutMessage.GetRequestedRegisterCount());
+	const NTV2RegInfo *		pRegInfos	(inOutMessage.regInfos());
+	UWord *					pBadNdxs	(inOutMessage.outBadRegIndexes());
+	ULWord &				numFailures	(inOutMessage.outNumFailures());
+	numFailures = 0;
+	if (!numRegs)
+		return true;
+	if (!pRegInfos  ||  !pBadNdxs)
+		return false;
+
+	//	Submit each run of BAR0 register writes as one immediate batch. Writes to other registers
+	//	end the run, so that all writes happen in the order given...
+	const bool canBatch (_ntv42Capabilities & NTV42_CAP_REGBATCH_IMMEDIATE);
+	for (ULWord ndx(0);  ndx < numRegs;  )
+	{
+		const NTV2RegInfo & regInfo (pRegInfos[ndx]);
+		ULWord runLength(0);
+		if (canBatch)
+			while (ndx + runLength < numRegs
+					&&  runLength < NTV42_REGBATCH_MAX_ENTRIES
+					&&  !IsEmulatedRegister(pRegInfos[ndx + runLength].registerNumber)
+					&&  pRegInfos[ndx + runLength].registerNumber < VIRTUALREG_START
+					&&  pRegInfos[ndx + runLength].registerShift < 32)
+				runLength++;
+		if (runLength > 1)
+		{
+#if defined(NTV2_WRITEREG_PROFILING)	//	Register Write Profiling
+			if (mRecordRegWrites)
+			{
+				AJAAutoLock autoLock(&mRegWritesLock);
+				for (ULWord runNdx(0);  runNdx < runLength;  runNdx++)
+					mRegWrites.push_back(pRegInfos[ndx + runNdx]);
+				if (mSkipRegWrites)
+					{ndx += runLength;	continue;}
+			}
+#endif	//	defined(NTV2_WRITEREG_PROFILING)	//	Register Write Profiling
+			if (!SubmitRegisterBatch(&regInfo, runLength))
+				for (ULWord runNdx(0);  runNdx < runLength;  runNdx++)
+					pBadNdxs[numFailures++] = UWord(ndx + runNdx);	//	The driver wrote none of them
+			ndx += runLength;
+			continue;
+		}
+		if (!WriteRegister(regInfo.registerNumber, regInfo.registerValue, regInfo.registerMask, regInfo.registerShift))
+			pBadNdxs[numFailures++] = UWord(ndx);
+		ndx++;
+	}
+	return true;
+}
+
+
+///////////////////////////////////////////////////////////////////////////////////
+// Messages, AutoCirculate
+///////////////////////////////////////////////////////////////////////////////////
+
+bool CNTV2Ntv42DriverInterface::NTV2Message (NTV2_HEADER * pInOutMessage)
+{
+	if (!pInOutMessage)
+		return false;
+	if (IsRemote())
+		return CNTV2LinuxDriverInterface::NTV2Message(pInOutMessage);
+	if (pInOutMessage->GetType() == NTV2_TYPE_GETREGS)
+		return HandleGetRegisters(*reinterpret_cast<NTV2GetRegisters*>(pInOutMessage));
+	if (pInOutMessage->GetType() == NTV2_TYPE_SETREGS)
+		return HandleSetRegisters(*reinterpret_cast<NTV2SetRegisters*>(pInOutMessage));
+	if (_ntv2DriverNode)
+		return CNTV2LinuxDriverInterface::NTV2Message(pInOutMessage);
+	LDIDBG("Message type " << HEX8(pInOutMessage->GetType()) << " not supported by ntv42 device");
+	return false;
+}
+
+
+bool CNTV2Ntv42DriverInterface::AutoCirculate (AUTOCIRCULATE_DATA & autoCircData)
+{
+	if (IsRemote()  ||  _ntv2DriverNode)
+		return CNTV2LinuxDriverInterface::AutoCirculate(autoCircData);
+	LDIFAIL("AutoCirculate not supported by ntv42 device");
+	return false;
+}
+
+
+/////////////////////////////////////////////////////////////////////////////
+// Interrupts
+/////////////////////////////////////////////////////////////////////////////
+
+bool CNTV2Ntv42DriverInterface::ConfigureInterrupt (const bool bEnable, const INTERRUPT_ENUMS eInterruptType)
+{
+	if (IsRemote())
+		return false;
+	NTV2_ASSERT( (_hDevice != INVALID_HANDLE_VALUE) && (_hDevice != 0) );
+	ntv42_ioctl_event_control_t eventControl;
+	memset(&eventControl, 0, sizeof(eventControl));
+	if (!InterruptToNtv42Event(eInterruptType, eventControl.type, eventControl.index))
+		{LDIFAIL("Interrupt " << DEC(eInterruptType) << " has no ntv42 event");	return false;}
+	eventControl.enable = bEnable ? 1 : 0;
+	if (ioctl(int(_hDevice), IOCTL_NTV42_EVENT_CONTROL, &eventControl))
+		{LDIFAIL("IOCTL_NTV42_EVENT_CONTROL failed: " << strerror(errno));	return false;}
+	_ntv42EventCounts[eInterruptType] = 0;	//	Next WaitForInterrupt waits for a new event
+	return true;
+}
+
+
+bool CNTV2Ntv42DriverInterface::GetInterruptCount (const INTERRUPT_ENUMS eInterrupt, ULWord & outCount)
+{
+	if (IsRemote())
+		return false;
+	NTV2_ASSERT( (_hDevice != INVALID_HANDLE_VALUE) && (_hDevice != 0) );
+	ntv42_ioctl_event_status_t eventStatus;
+	memset(&eventStatus, 0, sizeof(eventStatus));
+	if (!InterruptToNtv42Event(eInterrupt, eventStatus.type, eventStatus.index))
+		{LDIFAIL("Interrupt " << DEC(eInterrupt) << " has no ntv42 event");	return false;}
+	AJADebug::StatTimerStart(AJA_DebugStat_GetInterruptCount);
+	const int result (ioctl(int(_hDevice), IOCTL_NTV42_EVENT_STATUS, &eventStatus));
+	AJADebug::StatTimerStop(AJA_DebugStat_GetInterruptCount);
+	if (result)
+		{LDIFAIL("IOCTL_NTV42_EVENT_STATUS failed: " << strerror(errno));	return false;}
+	outCount = ULWord(eventStatus.count);
+	return true;
+}
+
+
+bool CNTV2Ntv42DriverInterface::WaitForInterrupt (INTERRUPT_ENUMS eInterrupt, ULWord timeOutMs)
+{
+	if (IsRemote())
+		return CNTV2LinuxDriverInterface::WaitForInterrupt(eInterrupt, timeOutMs);
+	NTV2_ASSERT( (_hDevice != INVALID_HANDLE_VALUE) && (_hDevice != 0) );
+	ntv42_ioctl_event_wait_t eventWait;
+	memset(&eventWait, 0, sizeof(eventWait));
+	if (!InterruptToNtv42Event(eInterrupt, eventWait.type, eventWait.index))
+		{LDIFAIL("Interrupt " << DEC(eInterrupt) << " has no ntv42 event");	return false;}
+	eventWait.timeout_ms = timeOutMs > 0x7FFFFFFF ? -1 : int32_t(timeOutMs);
+	//	Wait past the last event this instance saw, so events that fire between calls aren't missed.
+	//	The first wait (or one without NTV42_CAP_EVENT_SEQ) waits for the next event...
+	ULWord64 & lastCount (_ntv42EventCounts[eInterrupt]);
+	if ((_ntv42Capabilities & NTV42_CAP_EVENT_SEQ)  &&  lastCount)
+	{
+		eventWait.flags = NTV42_EVENT_WAIT_SEQUENCE;
+		eventWait.count = lastCount;
+	}
+
+	AJADebug::StatTimerStart(AJA_DebugStat_WaitForInterruptOthers);
+	const int result (ioctl(int(_hDevice), IOCTL_NTV42_EVENT_WAIT, &eventWait));
+	AJADebug::StatTimerStop(AJA_DebugStat_WaitForInterruptOthers);
+	if (result)
+	{
+		if (errno != ETIME)
+			LDIFAIL("IOCTL_NTV42_EVENT_WAIT failed: " << strerror(errno));
+		return false;
+	}
+	lastCount = eventWait.count;
+	BumpEventCount (eInterrupt);
+	return true;
+}
+
+
+/////////////////////////////////////////////////////////////////////////////
+// DMA
+/////////////////////////////////////////////////////////////////////////////
+
+ULWord CNTV2Ntv42DriverInterface::GetDeviceFrameBytes (void)
+{
+	if (::NTV2DeviceCanReportFrameSize(_boardID))
+	{
+		static const ULWord frameSizes[] = {2, 4, 8, 16};	//	'00'=2MB	'01'=4MB	'10'=8MB	'11'=16MB
+		ULWord frameSizeNdx(0);
+		ReadRegister (kRegCh1Control, frameSizeNdx, kK2RegMaskFrameSize, kK2RegShiftFrameSize);
+		return frameSizes[frameSizeNdx & 3] * 1024 * 1024;
+	}
+	ULWord fg(0), val1(0), val2(0);
+	ReadRegister (kRegGlobalControl, fg, kRegMaskGeometry, kRegShiftGeometry);
+	ReadRegister (kRegCh1Control, val1, kRegMaskFrameFormat, kRegShiftFrameFormat);
+	ReadRegister (kRegCh1Control, val2, kRegMaskFrameFormatHiBit, kRegShiftFrameFormatHiBit);
+	return ::NTV2DeviceGetFrameBufferSize(_boardID, NTV2FrameGeometry(fg), NTV2PixelFormat((val1 & 0x0F) | ((val2 & 0x1) << 4)));
+}
+
+
+bool CNTV2Ntv42DriverInterface::DmaTransfer (const NTV2DMAEngine	inDMAEngine,
+											const bool			inIsRead,
+											const ULWord		inFrameNumber,
+											ULWord *			pFrameBuffer,
+											const ULWord		inCardOffsetBytes,
+											const ULWord		inTotalByteCount,
+											const bool			inSynchronous)
+{
+	return DmaTransfer (inDMAEngine, inIsRead, inFrameNumber, pFrameBuffer, inCardOffsetBytes, inTotalByteCount,
+						1, inTotalByteCount, inTotalByteCount, inSynchronous);
+}
+
+
+bool CNTV2Ntv42DriverInterface::DmaTransfer (const NTV2DMAEngine	inDMAEngine,
+											const bool			inIsRead,
+											const ULWord		inFrameNumber,
+											ULWord *			pFrameBuffer,
+											const ULWord		inCardOffsetBytes,
+											const ULWord		inTotalByteCount,
+											const ULWord		inNumSegments,
+											const ULWord		inHostPitchPerSeg,
+											const ULWord		inCardPitchPerSeg,
+											const bool			inSynchronous)
+{
+	(void) inSynchronous;	//	Asynchronous requests are performed synchronously
+	if (IsRemote())
+		return CNTV2LinuxDriverInterface::DmaTransfer (inDMAEngine, inIsRead, inFrameNumber, pFrameBuffer, inCardOffsetBytes,
+														inTotalByteCount, inNumSegments, inHostPitchPerSeg, inCardPitchPerSeg, inSynchronous);
+	if (!(_ntv42Capabilities & NTV42_CAP_DMA)  ||  !_ntv42DMAEngines)
+		{LDIFAIL("ntv42 device has no DMA engines");	return false;}
+	if (!pFrameBuffer  ||  !inTotalByteCount  ||  !inNumSegments)
+		return false;
+
+	ULWord engine (inDMAEngine >= NTV2_DMA1  &&  inDMAEngine <= NTV2_DMA4  ?  ULWord(inDMAEngine - NTV2_DMA1)  :  0);
+	if (engine >= _ntv42DMAEngines)
+		engine = 0;
+	const ULWord64 deviceOffset (ULWord64(inFrameNumber) * GetDeviceFrameBytes() + inCardOffsetBytes);
+	return TransferSegments (inIsRead, engine, reinterpret_cast<UByte*>(pFrameBuffer), deviceOffset, inTotalByteCount,
+							inNumSegments, inHostPitchPerSeg, inCardPitchPerSeg);
+}
+
+
+bool CNTV2Ntv42DriverInterface::TransferSegments (const bool inIsRead, const ULWord inEngine, UByte * pHostBuffer, const ULWord64 inDeviceOffset,
+												const ULWord inSegmentBytes, const ULWord inNumSegments, const ULWord inHostPitch, const ULWord inCardPitch)
+{
+	const uint32_t direction (inIsRead ? NTV42_DIRECTION_FROM_DEVICE : NTV42_DIRECTION_TO_DEVICE);
+	if (inNumSegments > 1  &&  (_ntv42Capabilities & NTV42_CAP_DMA_VECTOR))
+	{	//	Up to NTV42_DMA_SEGMENT_MAX segments per ioctl...
+		vector<ntv42_ioctl_dma_segment_t> segments;
+		for (ULWord segNdx(0);  segNdx < inNumSegments;  )
+		{
+			const ULWord numSegs (inNumSegments - segNdx < NTV42_DMA_SEGMENT_MAX  ?  inNumSegments - segNdx  :  NTV42_DMA_SEGMENT_MAX);
+			segments.resize(numSegs);
+			for (ULWord ndx(0);  ndx < numSegs;  ndx++)
+			{
+				segments[ndx].host_addr		= uint64_t(uintptr_t(pHostBuffer + ULWord64(segNdx + ndx) * inHostPitch));
+				segments[ndx].device_addr	= inDeviceOffset + ULWord64(segNdx + ndx) * inCardPitch;
+				segments[ndx].bytes			= inSegmentBytes;
+			}
+			ntv42_ioctl_dma_vector_t dmaVector;
+			memset(&dmaVector, 0, sizeof(dmaVector));
+			dmaVector.engine		= inEngine;
+			dmaVector.direction		= direction;
+			dmaVector.segments_ptr	= uint64_t(uintptr_t(&segments[0]));
+			dmaVector.segment_count	= numSegs;
+			if (ioctl(int(_hDevice), IOCTL_NTV42_DMA_VECTOR, &dmaVector)  ||  dmaVector.status)
+			{
+				LDIFAIL("IOCTL_NTV42_DMA_VECTOR failed: eng=" << DEC(inEngine) << " segs=" << DEC(numSegs) << " bytes/seg=" << DEC(inSegmentBytes)
+						<< " status=" << DEC(dmaVector.status) << ": " << strerror(errno));
+				return false;
+			}
+			segNdx += numSegs;
+		}
+		return true;
+	}
+
+	for (ULWord segNdx(0);  segNdx < inNumSegments;  segNdx++)
+	{
+		ntv42_ioctl_dma_transfer_t dmaTransfer;
+		memset(&dmaTransfer, 0, sizeof(dmaTransfer));
+		dmaTransfer.engine		= inEngine;
+		dmaTransfer.direction	= direction;
+		dmaTransfer.host_addr	= uint64_t(uintptr_t(pHostBuffer + ULWord64(segNdx) * inHostPitch));
+		dmaTransfer.device_addr	= inDeviceOffset + ULWord64(segNdx) * inCardPitch;
+		dmaTransfer.bytes		= inSegmentBytes;
+		dmaTransfer.timeout_ms	= -1;
+		if (ioctl(int(_hDevice), IOCTL_NTV42_DMA_TRANSFER, &dmaTransfer)  ||  dmaTransfer.status)
+		{
+			LDIFAIL("IOCTL_NTV42_DMA_TRANSFER failed: eng=" << DEC(inEngine) << " devAddr=" << HEX16(dmaTransfer.device_addr)
+					<< " bytes=" << DEC(inSegmentBytes) << " status=" << DEC(dmaTransfer.status) << ": " << strerror(errno));
+			return false;
+		}
+	}
+	return true;
+}
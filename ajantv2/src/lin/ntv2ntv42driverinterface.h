@@ -0,0 +1,113 @@
+/* SPDX-License-Identifier: MIT */
+/**
+	@file		ntv2ntv42driverinterface.h
+	@brief		Declares the CNTV2Ntv42DriverInterface class.
+	@copyright	(C) 2026 AJA Video Systems, Inc.
+**/
+#ifndef NTV2NTV42DRIVERINTERFACE_H
+#define NTV2NTV42DRIVERINTERFACE_H
+
+#include "ntv2linuxdriverinterface.h"
+#include "ajabase/system/lock.h"
+
+/**
+	@brief		Linux implementation of CNTV2DriverInterface that talks to devices through the ntv42 ioctl interface
+				(see driver/ntv42ioctl.h), such as the ntv42dummy test driver or the NTV2 driver built with AJA_NTV42.
+				CNTV2Card derives from this class instead of CNTV2LinuxDriverInterface when the SDK is built with
+				NTV2_NTV42_DRIVER_INTERFACE defined (i.e. with the AJANTV2_NTV42_DRIVER_INTERFACE CMake option).
+	@details	Device index numbers count the /dev/ntv42dummyN nodes first, then the /dev/ajantv2N nodes.
+				Nodes that don't answer IOCTL_NTV42_VERSION are skipped.
+				-	Registers are read and written through the BAR0 register window. Masked writes, and the writes
+					of CNTV2Card::WriteRegisters, are submitted as immediate register batches, which the driver
+					executes atomically (older drivers get a user-space read-modify-write).
+				-	Virtual registers are answered by the NTV2 driver on /dev/ajantv2N nodes. Other devices have no
+					virtual registers, so they're emulated (per instance) in host memory.
+				-	DMA uses IOCTL_NTV42_DMA_TRANSFER, or IOCTL_NTV42_DMA_VECTOR for segmented transfers. Frame
+					numbers are converted to device memory offsets using the current frame buffer size.
+				-	WaitForInterrupt waits for the corresponding ntv42 event (output and input vertical interrupts,
+					and audio wraps). If the driver supports sequence waits (NTV42_CAP_EVENT_SEQ), each wait is
+					for the first event after the one the previous wait returned, so no event is missed between calls.
+				-	AutoCirculate and other driver messages are only available on /dev/ajantv2N nodes.
+**/
+class CNTV2Ntv42DriverInterface : public CNTV2LinuxDriverInterface
+{
+	public:
+							CNTV2Ntv42DriverInterface();
+		AJA_VIRTUAL			~CNTV2Ntv42DriverInterface();
+
+		AJA_VIRTUAL bool	WriteRegister (const ULWord inRegNum, const ULWord inValue, const ULWord inMask = 0xFFFFFFFF, const ULWord inShift = 0);
+		AJA_VIRTUAL bool	ReadRegister (const ULWord inRegNum,  ULWord & outValue,  const ULWord inMask = 0xFFFFFFFF, const ULWord inShift = 0);
+
+		AJA_VIRTUAL bool	DmaTransfer (const NTV2DMAEngine	inDMAEngine,
+										const bool				inIsRead,
+										const ULWord			inFrameNumber,
+										ULWord *				pFrameBuffer,
+										const ULWord			inCardOffsetBytes,
+										const ULWord			inTotalByteCount,
+										const bool				inSynchronous = true);
+
+		AJA_VIRTUAL bool	DmaTransfer (const NTV2DMAEngine	inDMAEngine,
+										const bool				inIsRead,
+										const ULWord			inFrameNumber,
+										ULWord *				pFrameBuffer,
+										const ULWord			inCardOffsetBytes,
+										const ULWord			inTotalByteCount,
+										const ULWord			inNumSegments,
+										const ULWord			inHostPitchPerSeg,
+										const ULWord			inCardPitchPerSeg,
+										const bool				inSynchronous = true);
+
+		using CNTV2LinuxDriverInterface::DmaTransfer;	//	Keep the P2P DmaTransfer visible
+
+		AJA_VIRTUAL bool	ConfigureInterrupt (const bool bEnable, const INTERRUPT_ENUMS eInterruptType);
+		AJA_VIRTUAL bool	GetInterruptCount (const INTERRUPT_ENUMS eInterrupt, ULWord & outCount);
+		AJA_VIRTUAL bool	WaitForInterrupt (INTERRUPT_ENUMS eInterrupt, ULWord timeOutMs = 68);
+
+		AJA_VIRTUAL bool	AutoCirculate (AUTOCIRCULATE_DATA & autoCircData);
+		AJA_VIRTUAL bool	NTV2Message (NTV2_HEADER * pInOutMessage);
+
+		/**
+			@return		The ntv42 ioctl interface version of the open device (zero if not open).
+		**/
+		AJA_VIRTUAL inline ULWord	GetNtv42Version (void) const		{return _ntv42Version;}
+
+		/**
+			@return		The ntv42 capabilities (NTV42_CAP_* bits) of the open device (zero if not open).
+		**/
+		AJA_VIRTUAL inline ULWord	GetNtv42Capabilities (void) const	{return _ntv42Capabilities;}
+
+		/**
+			@return		True if the open device node is an NTV2 driver node (/dev/ajantv2N), which also answers
+						the NTV2 driver ioctls;  otherwise false (e.g. ntv42dummy).
+		**/
+		AJA_VIRTUAL inline bool		IsNtv2DriverNode (void) const		{return _ntv2DriverNode;}
+
+#if !defined(NTV2_NULL_DEVICE)
+	protected:	//	PRIVATE METHODS
+		AJA_VIRTUAL bool	OpenLocalPhysical (const UWord inDeviceIndex);	///< @brief Opens the local/physical device connection.
+		AJA_VIRTUAL bool	CloseLocalPhysical	(void);
+#endif	//	!defined(NTV2_NULL_DEVICE)
+
+	protected:
+		AJA_VIRTUAL bool	ReadRegisterWindow (const ULWord inRegNum, ULWord * pOutValues, const ULWord inCount);			///< @brief	Reads consecutive BAR0 registers.
+		AJA_VIRTUAL bool	WriteRegisterWindow (const ULWord inRegNum, const ULWord * pInValues, const ULWord inCount);	///< @brief	Writes consecutive BAR0 registers.
+		AJA_VIRTUAL bool	SubmitRegisterBatch (const NTV2RegInfo * pInRegInfos, const ULWord inCount);	///< @brief	Atomically writes up to NTV42_REGBATCH_MAX_ENTRIES BAR0 registers.
+		AJA_VIRTUAL bool	HandleGetRegisters (NTV2GetRegisters & inOutMessage);	///< @brief	Implements NTV2GetRegisters, reading runs of consecutive registers at once.
+		AJA_VIRTUAL bool	HandleSetRegisters (NTV2SetRegisters & inOutMessage);	///< @brief	Implements NTV2SetRegisters using register batches.
+		AJA_VIRTUAL ULWord	GetDeviceFrameBytes (void);	///< @return	The current frame buffer size, in bytes, for converting frame numbers to device memory offsets.
+		AJA_VIRTUAL bool	TransferSegments (const bool inIsRead, const ULWord inEngine, UByte * pHostBuffer, const ULWord64 inDeviceOffset,
+											const ULWord inSegmentBytes, const ULWord inNumSegments, const ULWord inHostPitch, const ULWord inCardPitch);
+		AJA_VIRTUAL bool	IsEmulatedRegister (const ULWord inRegNum) const;	///< @return	True if the register is emulated in host memory.
+
+	protected:	//	INSTANCE DATA
+		ULWord					_ntv42Version;		///< @brief	ntv42 ioctl interface version
+		ULWord					_ntv42Capabilities;	///< @brief	NTV42_CAP_* bits
+		ULWord					_ntv42DMAEngines;	///< @brief	Number of DMA engines
+		ULWord64				_ntv42BAR0Size;		///< @brief	Size of the BAR0 register window, in bytes
+		bool					_ntv2DriverNode;	///< @brief	True if /dev/ajantv2N (answers NTV2 ioctls)
+		ULWord64				_ntv42EventCounts[eNumInterruptTypes];	///< @brief	Per-interrupt event count returned by the last wait (0 if none)
+		NTV2RegisterValueMap	_emulatedRegs;		///< @brief	Emulated virtual register values
+		mutable AJALock			_emulatedRegsLock;	///< @brief	Guards _emulatedRegs (and serializes read-modify-writes)
+};	//	CNTV2Ntv42DriverInterface
+
+#endif	//	NTV2NTV42DRIVERINTERFACE_H
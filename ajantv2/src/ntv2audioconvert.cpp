@@ -0,0 +1,511 @@
+/* SPDX-License-Identifier: MIT */
+/**
+	@file		ntv2audioconvert.cpp
+	@brief		Implements the NTV2AudioConverter class.
+	@copyright	(C) 2026 AJA Video Systems, Inc.
+**/
+
+#include "ntv2audioconvert.h"
+#include <vector>
+#include <string.h>
+#include <math.h>
+#if defined(__SSE2__)
+	#include <emmintrin.h>
+	#define	NTV2_AUDIOCONVERT_SSE2	1
+#endif	//	__SSE2__
+
+using namespace std;
+
+static const float	kInt32ToFloat	(1.0f / 2147483648.0f);
+static const float	kFloatToInt32	(2147483648.0f);
+
+
+//////////////////////////////////////////////////////////////////////////////////////////////////////
+//	Sample kernels
+//
+//	Overloaded so the de-interleave/interleave kernels can be shared by the int32 and float planes.
+//////////////////////////////////////////////////////////////////////////////////////////////////////
+
+static inline void StoreSample (int32_t * pOut, const int32_t inValue)	{*pOut = inValue;}
+static inline void StoreSample (float * pOut, const int32_t inValue)	{*pOut = float(inValue) * kInt32ToFloat;}
+
+static inline int32_t LoadSample (const int32_t * pIn)	{return *pIn;}
+static inline int32_t LoadSample (const float * pIn)
+{	//	Same comparisons as _mm_max_ps and _mm_min_ps, so NaN becomes -1.0
+	float value (*pIn);
+	value = value > -1.0f  ?  value  :  -1.0f;
+	value = value < 1.0f  ?  value  :  1.0f;
+	value *= kFloatToInt32;
+	return value >= kFloatToInt32  ?  int32_t(0x7FFFFFFF)  :  int32_t(::lrintf(value));
+}
+
+static inline ULWord NextRandom (ULWord & inOutState)
+{	//	xorshift32
+	inOutState ^= inOutState << 13;
+	inOutState ^= inOutState >> 17;
+	inOutState ^= inOutState << 5;
+	return inOutState;
+}
+
+#if defined(NTV2_AUDIOCONVERT_SSE2)
+	static inline void StoreVector (int32_t * pOut, const __m128i inValues)
+	{
+		_mm_storeu_si128 (reinterpret_cast<__m128i*>(pOut), inValues);
+	}
+	static inline void StoreVector (float * pOut, const __m128i inValues)
+	{
+		_mm_storeu_ps (pOut, _mm_mul_ps(_mm_cvtepi32_ps(inValues), _mm_set1_ps(kInt32ToFloat)));
+	}
+
+	static inline __m128i LoadVector (const int32_t * pIn)
+	{
+		return _mm_loadu_si128 (reinterpret_cast<const __m128i*>(pIn));
+	}
+	static inline __m128i LoadVector (const float * pIn)
+	{
+		const __m128	scale	(_mm_set1_ps(kFloatToInt32));
+		const __m128	value	(_mm_mul_ps(_mm_min_ps(_mm_max_ps(_mm_loadu_ps(pIn), _mm_set1_ps(-1.0f)), _mm_set1_ps(1.0f)), scale));
+		const __m128i	isMax	(_mm_castps_si128(_mm_cmpge_ps(value, scale)));	//	+1.0 overflows to 0x80000000
+		return _mm_or_si128 (_mm_andnot_si128(isMax, _mm_cvtps_epi32(value)), _mm_and_si128(isMax, _mm_set1_epi32(0x7FFFFFFF)));
+	}
+
+	static inline __m128i NextRandom (__m128i & inOutState)
+	{	//	Four xorshift32 generators, one per lane
+		inOutState = _mm_xor_si128 (inOutState, _mm_slli_epi32(inOutState, 13));
+		inOutState = _mm_xor_si128 (inOutState, _mm_srli_epi32(inOutState, 17));
+		inOutState = _mm_xor_si128 (inOutState, _mm_slli_epi32(inOutState, 5));
+		return inOutState;
+	}
+
+	//	Transposes a 4x4 block of 32-bit values
+	static inline void Transpose4x4 (__m128i & r0, __m128i & r1, __m128i & r2, __m128i & r3)
+	{
+		const __m128i	t0	(_mm_unpacklo_epi32(r0, r1));
+		const __m128i	t1	(_mm_unpacklo_epi32(r2, r3));
+		const __m128i	t2	(_mm_unpackhi_epi32(r0, r1));
+		const __m128i	t3	(_mm_unpackhi_epi32(r2, r3));
+		r0 = _mm_unpacklo_epi64(t0, t1);
+		r1 = _mm_unpackhi_epi64(t0, t1);
+		r2 = _mm_unpacklo_epi64(t2, t3);
+		r3 = _mm_unpackhi_epi64(t2, t3);
+	}
+#endif	//	NTV2_AUDIOCONVERT_SSE2
+
+
+//////////////////////////////////////////////////////////////////////////////////////////////////////
+//	De-interleave & interleave kernels
+//////////////////////////////////////////////////////////////////////////////////////////////////////
+
+template <typename PlaneType>
+static void DeinterleaveKernel (const int32_t * pIn, const ULWord inNumChannels, PlaneType * const * pOutPlanes, const ULWord inNumFrames, const bool inUseSIMD)
+{
+	ULWord	frame(0);
+#if defined(NTV2_AUDIOCONVERT_SSE2)
+	if (inUseSIMD  &&  inNumChannels == 2)
+		for (;  frame + 4 <= inNumFrames;  frame += 4)
+		{	//	L0 R0 L1 R1 | L2 R2 L3 R3  =>  L0 L1 L2 L3 | R0 R1 R2 R3
+			const int32_t *	pFrames	(pIn + frame * 2);
+			const __m128i	a	(_mm_shuffle_epi32(LoadVector(pFrames),		_MM_SHUFFLE(3,1,2,0)));
+			const __m128i	b	(_mm_shuffle_epi32(LoadVector(pFrames + 4),	_MM_SHUFFLE(3,1,2,0)));
+			StoreVector (pOutPlanes[0] + frame, _mm_unpacklo_epi64(a, b));
+			StoreVector (pOutPlanes[1] + frame, _mm_unpackhi_epi64(a, b));
+		}
+	else if (inUseSIMD  &&  inNumChannels >= 4)
+		for (;  frame + 4 <= inNumFrames;  frame += 4)
+		{
+			const int32_t *	pFrames	(pIn + frame * inNumChannels);
+			ULWord	chan(0);
+			for (;  chan + 4 <= inNumChannels;  chan += 4)
+			{
+				__m128i	r0 (LoadVector(pFrames + chan)),						r1 (LoadVector(pFrames + inNumChannels + chan));
+				__m128i	r2 (LoadVector(pFrames + 2 * inNumChannels + chan)),	r3 (LoadVector(pFrames + 3 * inNumChannels + chan));
+				Transpose4x4 (r0, r1, r2, r3);
+				StoreVector (pOutPlanes[chan] + frame, r0);
+				StoreVector (pOutPlanes[chan + 1] + frame, r1);
+				StoreVector (pOutPlanes[chan + 2] + frame, r2);
+				StoreVector (pOutPlanes[chan + 3] + frame, r3);
+			}
+			for (;  chan < inNumChannels;  chan++)
+				for (ULWord ndx(0);  ndx < 4;  ndx++)
+					StoreSample (pOutPlanes[chan] + frame + ndx, pFrames[ndx * inNumChannels + chan]);
+		}
+#else
+	(void) inUseSIMD;
+#endif	//	NTV2_AUDIOCONVERT_SSE2
+	for (;  frame < inNumFrames;  frame++)
+	{
+		const int32_t *	pFrame	(pIn + frame * inNumChannels);
+		for (ULWord chan(0);  chan < inNumChannels;  chan++)
+			StoreSample (pOutPlanes[chan] + frame, pFrame[chan]);
+	}
+}
+
+template <typename PlaneType>
+static void InterleaveKernel (const PlaneType * const * pInPlanes, const ULWord inNumChannels, int32_t * pOut, const ULWord inNumFrames, const bool inUseSIMD)
+{
+	ULWord	frame(0);
+#if defined(NTV2_AUDIOCONVERT_SSE2)
+	if (inUseSIMD  &&  inNumChannels == 2)
+		for (;  frame + 4 <= inNumFrames;  frame += 4)
+		{	//	L0 L1 L2 L3 | R0 R1 R2 R3  =>  L0 R0 L1 R1 | L2 R2 L3 R3
+			const __m128i	left	(LoadVector(pInPlanes[0] + frame));
+			const __m128i	right	(LoadVector(pInPlanes[1] + frame));
+			StoreVector (pOut + frame * 2,		_mm_unpacklo_epi32(left, right));
+			StoreVector (pOut + frame * 2 + 4,	_mm_unpackhi_epi32(left, right));
+		}
+	else if (inUseSIMD  &&  inNumChannels >= 4)
+		for (;  frame + 4 <= inNumFrames;  frame += 4)
+		{
+			int32_t *	pFrames	(pOut + frame * inNumChannels);
+			ULWord	chan(0);
+			for (;  chan + 4 <= inNumChannels;  chan += 4)
+			{
+				__m128i	r0 (LoadVector(pInPlanes[chan] + frame)),		r1 (LoadVector(pInPlanes[chan + 1] + frame));
+				__m128i	r2 (LoadVector(pInPlanes[chan + 2] + frame)),	r3 (LoadVector(pInPlanes[chan + 3] + frame));
+				Transpose4x4 (r0, r1, r2, r3);
+				StoreVector (pFrames + chan, r0);
+				StoreVector (pFrames + inNumChannels + chan, r1);
+				StoreVector (pFrames + 2 * inNumChannels + chan, r2);
+				StoreVector (pFrames + 3 * inNumChannels + chan, r3);
+			}
+			for (;  chan < inNumChannels;  chan++)
+				for (ULWord ndx(0);  ndx < 4;  ndx++)
+					pFrames[ndx * inNumChannels + chan] = LoadSample(pInPlanes[chan] + frame + ndx);
+		}
+#else
+	(void) inUseSIMD;
+#endif	//	NTV2_AUDIOCONVERT_SSE2
+	for (;  frame < inNumFrames;  frame++)
+	{
+		int32_t *	pFrame	(pOut + frame * inNumChannels);
+		for (ULWord chan(0);  chan < inNumChannels;  chan++)
+			pFrame[chan] = LoadSample(pInPlanes[chan] + frame);
+	}
+}
+
+template <typename PlaneType>
+static bool ArePlanesValid (PlaneType * const * pPlanes, const ULWord inNumChannels)
+{
+	if (!pPlanes  ||  !inNumChannels  ||  inNumChannels > NTV2AudioConverter::kMaxChannels)
+		return false;
+	for (ULWord chan(0);  chan < inNumChannels;  chan++)
+		if (!pPlanes[chan])
+			return false;
+	return true;
+}
+
+
+//////////////////////////////////////////////////////////////////////////////////////////////////////
+//	Channel map runs
+//
+//	A channel map is reduced to runs of consecutive channels, so each run is one block copy per frame.
+//////////////////////////////////////////////////////////////////////////////////////////////////////
+
+typedef struct ChannelRun
+{
+	ULWord	fFrom;		///< @brief	First source channel (only used if fMapped)
+	ULWord	fTo;		///< @brief	First destination channel (only used if fMapped, or when gathering)
+	ULWord	fCount;		///< @brief	Number of channels
+	bool	fMapped;	///< @brief	False for silence (gather) or discard (scatter)
+} ChannelRun;
+
+typedef vector<ChannelRun>	ChannelRuns;
+
+//	Builds runs from a map of "inMapSize" entries, each of which must be negative or less than "inLimit".
+//	For gather, the map is indexed by destination channel;  for scatter, by source channel.
+static bool MakeChannelRuns (const int * pInMap, const ULWord inMapSize, const ULWord inLimit, const bool inIsGather, ChannelRuns & outRuns)
+{
+	outRuns.clear();
+	for (ULWord ndx(0);  ndx < inMapSize;  ndx++)
+	{
+		const int entry (pInMap[ndx]);
+		if (entry >= 0  &&  ULWord(entry) >= inLimit)
+			return false;
+		if (!outRuns.empty())
+		{
+			ChannelRun & run (outRuns.back());
+			const int prev (pInMap[ndx - 1]);
+			if ((entry < 0  &&  prev < 0)  ||  (entry >= 0  &&  prev >= 0  &&  entry == prev + 1))
+				{run.fCount++;  continue;}
+		}
+		ChannelRun run;
+		run.fFrom	= inIsGather ? ULWord(entry) : ndx;
+		run.fTo		= inIsGather ? ndx : ULWord(entry);
+		run.fCount	= 1;
+		run.fMapped	= entry >= 0;
+		outRuns.push_back(run);
+	}
+	return true;
+}
+
+
+//////////////////////////////////////////////////////////////////////////////////////////////////////
+//	NTV2AudioConverter
+//////////////////////////////////////////////////////////////////////////////////////////////////////
+
+bool NTV2AudioConverter::IsSIMDAvailable (void)
+{
+#if defined(NTV2_AUDIOCONVERT_SSE2)
+	return true;
+#else
+	return false;
+#endif
+}
+
+NTV2AudioConverter::NTV2AudioConverter ()
+	:	mDither		(NTV2_AUDIO_DITHER_TRIANGULAR),
+		mUseSIMD	(true)
+{
+	setDitherSeed(1);
+}
+
+NTV2AudioConverter & NTV2AudioConverter::setDither (const NTV2AudioDither inDither)
+{
+	if (NTV2_IS_VALID_AUDIO_DITHER(inDither))
+		mDither = inDither;
+	return *this;
+}
+
+NTV2AudioConverter & NTV2AudioConverter::setDitherSeed (const ULWord inSeed)
+{
+	for (ULWord lane(0);  lane < 4;  lane++)
+	{
+		ULWord state ((inSeed + lane) * 0x9E3779B9);	//	Spread the seeds
+		state ^= state >> 16;
+		mDitherState[lane] = state ? state : 0x6D2B79F5;	//	xorshift state must be non-zero
+	}
+	return *this;
+}
+
+bool NTV2AudioConverter::Deinterleave (const int32_t * pInFrames, const ULWord inNumChannels, int32_t * const * pOutPlanes, const ULWord inNumFrames)
+{
+	if (!pInFrames  ||  !ArePlanesValid(pOutPlanes, inNumChannels))
+		return false;
+	DeinterleaveKernel (pInFrames, inNumChannels, pOutPlanes, inNumFrames, mUseSIMD);
+	return true;
+}
+
+bool NTV2AudioConverter::DeinterleaveToFloat (const int32_t * pInFrames, const ULWord inNumChannels, float * const * pOutPlanes, const ULWord inNumFrames)
+{
+	if (!pInFrames  ||  !ArePlanesValid(pOutPlanes, inNumChannels))
+		return false;
+	DeinterleaveKernel (pInFrames, inNumChannels, pOutPlanes, inNumFrames, mUseSIMD);
+	return true;
+}
+
+bool NTV2AudioConverter::Interleave (const int32_t * const * pInPlanes, const ULWord inNumChannels, int32_t * pOutFrames, const ULWord inNumFrames)
+{
+	if (!pOutFrames  ||  !ArePlanesValid(pInPlanes, inNumChannels))
+		return false;
+	InterleaveKernel (pInPlanes, inNumChannels, pOutFrames, inNumFrames, mUseSIMD);
+	return true;
+}
+
+bool NTV2AudioConverter::InterleaveFromFloat (const float * const * pInPlanes, const ULWord inNumChannels, int32_t * pOutFrames, const ULWord inNumFrames)
+{
+	if (!pOutFrames  ||  !ArePlanesValid(pInPlanes, inNumChannels))
+		return false;
+	InterleaveKernel (pInPlanes, inNumChannels, pOutFrames, inNumFrames, mUseSIMD);
+	return true;
+}
+
+bool NTV2AudioConverter::Int32ToFloat (const int32_t * pInSamples, float * pOutSamples, const ULWord inNumSamples)
+{
+	if (!pInSamples  ||  !pOutSamples)
+		return false;
+	ULWord	ndx(0);
+#if defined(NTV2_AUDIOCONVERT_SSE2)
+	if (mUseSIMD)
+		for (;  ndx + 4 <= inNumSamples;  ndx += 4)
+			StoreVector (pOutSamples + ndx, LoadVector(pInSamples + ndx));
+#endif	//	NTV2_AUDIOCONVERT_SSE2
+	for (;  ndx < inNumSamples;  ndx++)
+		StoreSample (pOutSamples + ndx, pInSamples[ndx]);
+	return true;
+}
+
+bool NTV2AudioConverter::FloatToInt32 (const float * pInSamples, int32_t * pOutSamples, const ULWord inNumSamples)
+{
+	if (!pInSamples  ||  !pOutSamples)
+		return false;
+	ULWord	ndx(0);
+#if defined(NTV2_AUDIOCONVERT_SSE2)
+	if (mUseSIMD)
+		for (;  ndx + 4 <= inNumSamples;  ndx += 4)
+			StoreVector (pOutSamples + ndx, LoadVector(pInSamples + ndx));
+#endif	//	NTV2_AUDIOCONVERT_SSE2
+	for (;  ndx < inNumSamples;  ndx++)
+		pOutSamples[ndx] = LoadSample(pInSamples + ndx);
+	return true;
+}
+
+bool NTV2AudioConverter::Int32ToInt16 (const int32_t * pInSamples, int16_t * pOutSamples, const ULWord inNumSamples)
+{
+	return Requantize (pInSamples, pOutSamples, inNumSamples, 16);
+}
+
+bool NTV2AudioConverter::Int32ToInt24 (const int32_t * pInSamples, UByte * pOutSamples, const ULWord inNumSamples)
+{
+	return Requantize (pInSamples, pOutSamples, inNumSamples, 8);
+}
+
+//	Drops the "inShift" LS bits of each sample:  result = round((sample + dither) / 2^inShift), saturated.
+//	To stay within 32 bits, the sample is split into its high part and its (unsigned) low part, and only
+//	the low part is rounded:  result = (sample >> inShift) + ((low + half + dither) >> inShift).
+bool NTV2AudioConverter::Requantize (const int32_t * pInSamples, void * pOutSamples, const ULWord inNumSamples, const ULWord inShift)
+{
+	if (!pInSamples  ||  !pOutSamples)
+		return false;
+	int16_t *		pOut16	(inShift == 16 ? reinterpret_cast<int16_t*>(pOutSamples) : AJA_NULL);
+	UByte *			pOut24	(inShift == 16 ? AJA_NULL : reinterpret_cast<UByte*>(pOutSamples));
+	const int32_t	lowMask	((1 << inShift) - 1),  half (1 << (inShift - 1));
+	const int32_t	maxOut	((1 << (31 - inShift)) - 1),  minOut (-maxOut - 1);
+	const int32_t	ditherBias (mDither == NTV2_AUDIO_DITHER_TRIANGULAR  ?  (1 << inShift)  :  half);
+	const int		randomShift (int(32 - inShift));
+	ULWord	ndx(0);
+
+#if defined(NTV2_AUDIOCONVERT_SSE2)
+	if (mUseSIMD  &&  inNumSamples >= 4)
+	{
+		__m128i	state (_mm_loadu_si128(reinterpret_cast<const __m128i*>(mDitherState)));
+		const __m128i	vLowMask (_mm_set1_epi32(lowMask)),  vHalf (_mm_set1_epi32(half)),  vBias (_mm_set1_epi32(ditherBias));
+		const __m128i	vMax (_mm_set1_epi32(maxOut)),  vMin (_mm_set1_epi32(minOut)),  vShift (_mm_cvtsi32_si128(int(inShift)));
+		const __m128i	vRandomShift (_mm_cvtsi32_si128(randomShift));
+		for (;  ndx + 4 <= inNumSamples;  ndx += 4)
+		{
+			const __m128i	samples	(_mm_loadu_si128(reinterpret_cast<const __m128i*>(pInSamples + ndx)));
+			__m128i			low		(_mm_add_epi32(_mm_and_si128(samples, vLowMask), vHalf));
+			if (mDither != NTV2_AUDIO_DITHER_NONE)
+			{
+				__m128i noise (_mm_srl_epi32(NextRandom(state), vRandomShift));
+				if (mDither == NTV2_AUDIO_DITHER_TRIANGULAR)
+					noise = _mm_add_epi32(noise, _mm_srl_epi32(NextRandom(state), vRandomShift));
+				low = _mm_add_epi32(low, _mm_sub_epi32(noise, vBias));
+			}
+			__m128i	result (_mm_add_epi32(_mm_sra_epi32(samples, vShift), _mm_sra_epi32(low, vShift)));
+			__m128i	over (_mm_cmpgt_epi32(result, vMax)),  under (_mm_cmplt_epi32(result, vMin));
+			result = _mm_or_si128(_mm_andnot_si128(over, result), _mm_and_si128(over, vMax));
+			result = _mm_or_si128(_mm_andnot_si128(under, result), _mm_and_si128(under, vMin));
+			if (pOut16)
+				_mm_storel_epi64 (reinterpret_cast<__m128i*>(pOut16 + ndx), _mm_packs_epi32(result, result));
+			else
+			{
+				int32_t	values[4];
+				_mm_storeu_si128 (reinterpret_cast<__m128i*>(values), result);
+				for (ULWord lane(0);  lane < 4;  lane++)
+				{
+					UByte * pOut (pOut24 + (ndx + lane) * 3);
+					pOut[0] = UByte(values[lane]);  pOut[1] = UByte(values[lane] >> 8);  pOut[2] = UByte(values[lane] >> 16);
+				}
+			}
+		}
+		_mm_storeu_si128 (reinterpret_cast<__m128i*>(mDitherState), state);
+	}
+#endif	//	NTV2_AUDIOCONVERT_SSE2
+
+	for (;  ndx < inNumSamples;  ndx++)
+	{
+		const int32_t	sample	(pInSamples[ndx]);
+		int32_t			low		((sample & lowMask) + half);
+		if (mDither != NTV2_AUDIO_DITHER_NONE)
+		{
+			ULWord & state (mDitherState[ndx & 3]);
+			int32_t noise (int32_t(NextRandom(state) >> randomShift));
+			if (mDither == NTV2_AUDIO_DITHER_TRIANGULAR)
+				noise += int32_t(NextRandom(state) >> randomShift);
+			low += noise - ditherBias;
+		}
+		int32_t	result ((sample >> inShift) + (low >> inShift));
+		result = result > maxOut  ?  maxOut  :  (result < minOut  ?  minOut  :  result);
+		if (pOut16)
+			pOut16[ndx] = int16_t(result);
+		else
+		{
+			UByte * pOut (pOut24 + ndx * 3);
+			pOut[0] = UByte(result);  pOut[1] = UByte(result >> 8);  pOut[2] = UByte(result >> 16);
+		}
+	}
+	return true;
+}
+
+bool NTV2AudioConverter::Int16ToInt32 (const int16_t * pInSamples, int32_t * pOutSamples, const ULWord inNumSamples)
+{
+	if (!pInSamples  ||  !pOutSamples)
+		return false;
+	ULWord	ndx(0);
+#if defined(NTV2_AUDIOCONVERT_SSE2)
+	if (mUseSIMD)
+	{
+		const __m128i	zero (_mm_setzero_si128());
+		for (;  ndx + 8 <= inNumSamples;  ndx += 8)
+		{	//	Interleaving zeroes below each 16-bit sample shifts it into the MS 16 bits
+			const __m128i	samples (_mm_loadu_si128(reinterpret_cast<const __m128i*>(pInSamples + ndx)));
+			_mm_storeu_si128 (reinterpret_cast<__m128i*>(pOutSamples + ndx),		_mm_unpacklo_epi16(zero, samples));
+			_mm_storeu_si128 (reinterpret_cast<__m128i*>(pOutSamples + ndx + 4),	_mm_unpackhi_epi16(zero, samples));
+		}
+	}
+#endif	//	NTV2_AUDIOCONVERT_SSE2
+	for (;  ndx < inNumSamples;  ndx++)
+		pOutSamples[ndx] = int32_t(ULWord(UWord(pInSamples[ndx])) << 16);
+	return true;
+}
+
+bool NTV2AudioConverter::Int24ToInt32 (const UByte * pInSamples, int32_t * pOutSamples, const ULWord inNumSamples)
+{
+	if (!pInSamples  ||  !pOutSamples)
+		return false;
+	for (ULWord ndx(0);  ndx < inNumSamples;  ndx++)
+	{
+		const UByte * pIn (pInSamples + ndx * 3);
+		pOutSamples[ndx] = int32_t((ULWord(pIn[0]) << 8)  |  (ULWord(pIn[1]) << 16)  |  (ULWord(pIn[2]) << 24));
+	}
+	return true;
+}
+
+bool NTV2AudioConverter::RemapChannels (const int32_t * pInFrames, const ULWord inNumInChannels, int32_t * pOutFrames,
+										const ULWord inNumOutChannels, const int * pInMap, const ULWord inNumFrames)
+{
+	if (!pInFrames  ||  !pOutFrames  ||  !pInMap)
+		return false;
+	if (!inNumInChannels  ||  inNumInChannels > kMaxChannels  ||  !inNumOutChannels  ||  inNumOutChannels > kMaxChannels)
+		return false;
+	ChannelRuns runs;
+	if (!MakeChannelRuns (pInMap, inNumOutChannels, inNumInChannels, /*gather*/true, runs))
+		return false;
+
+	if (runs.size() == 1  &&  runs.front().fMapped  &&  runs.front().fFrom == 0  &&  inNumInChannels == inNumOutChannels)
+		{::memcpy(pOutFrames, pInFrames, size_t(inNumFrames) * inNumInChannels * sizeof(int32_t));  return true;}	//	Identity
+	for (ULWord frame(0);  frame < inNumFrames;  frame++)
+	{
+		const int32_t *	pIn		(pInFrames + frame * inNumInChannels);
+		int32_t *		pOut	(pOutFrames + frame * inNumOutChannels);
+		for (ChannelRuns::const_iterator it(runs.begin());  it != runs.end();  ++it)
+			if (it->fMapped)
+				::memcpy(pOut + it->fTo, pIn + it->fFrom, it->fCount * sizeof(int32_t));
+			else
+				::memset(pOut + it->fTo, 0, it->fCount * sizeof(int32_t));
+	}
+	return true;
+}
+
+bool NTV2AudioConverter::ScatterChannels (const int32_t * pInFrames, const ULWord inNumInChannels, int32_t * pOutFrames,
+										const ULWord inNumOutChannels, const int * pInMap, const ULWord inNumFrames)
+{
+	if (!pInFrames  ||  !pOutFrames  ||  !pInMap)
+		return false;
+	if (!inNumInChannels  ||  inNumInChannels > kMaxChannels  ||  !inNumOutChannels  ||  inNumOutChannels > kMaxChannels)
+		return false;
+	ChannelRuns runs;
+	if (!MakeChannelRuns (pInMap, inNumInChannels, inNumOutChannels, /*gather*/false, runs))
+		return false;
+
+	for (ULWord frame(0);  frame < inNumFrames;  frame++)
+	{
+		const int32_t *	pIn		(pInFrames + frame * inNumInChannels);
+		int32_t *		pOut	(pOutFrames + frame * inNumOutChannels);
+		for (ChannelRuns::const_iterator it(runs.begin());  it != runs.end();  ++it)
+			if (it->fMapped)
+				::memcpy(pOut + it->fTo, pIn + it->fFrom, it->fCount * sizeof(int32_t));
+	}
+	return true;
+}
@@ -0,0 +1,187 @@
+/* SPDX-License-Identifier: MIT */
+/**
+	@file		ntv2audiostreamreader.cpp
+	@brief		Implements the NTV2AudioStreamReader class.
+	@copyright	(C) 2026 AJA Video Systems, Inc.
+**/
+
+#include "ntv2audiostreamreader.h"
+#include "ntv2card.h"
+#include "ntv2utils.h"
+#include "ajabase/system/debug.h"
+
+using namespace std;
+
+#define ASRFAIL(__x__)		AJA_sERROR	(AJA_DebugUnit_AudioGeneric,	" " << HEX0N(uint64_t(this),16) << "::" << AJAFUNC << ": " << __x__)
+#define ASRWARN(__x__)		AJA_sWARNING(AJA_DebugUnit_AudioGeneric,	" " << HEX0N(uint64_t(this),16) << "::" << AJAFUNC << ": " << __x__)
+#define ASRNOTE(__x__)		AJA_sNOTICE	(AJA_DebugUnit_AudioGeneric,	" " << HEX0N(uint64_t(this),16) << "::" << AJAFUNC << ": " << __x__)
+#define ASRDBG(__x__)		AJA_sDEBUG	(AJA_DebugUnit_AudioGeneric,	" " << HEX0N(uint64_t(this),16) << "::" << AJAFUNC << ": " << __x__)
+
+
+NTV2AudioStreamReader::NTV2AudioStreamReader (CNTV2Card & inDevice)
+	:	mDevice				(inDevice),
+		mAudioSystem		(NTV2_AUDIOSYSTEM_INVALID),
+		mRunning			(false),
+		mMaxLatencyBlocks	(0),
+		mNumChannels		(0),
+		mFrameBytes			(0),
+		mBlockBytes			(0),
+		mNumBlocks			(0),
+		mCaptureOffset		(0),
+		mDeviceRingBytes	(0),
+		mDevicePos			(0),
+		mLeftoverBytes		(0),
+		mBlocksFilled		(0),
+		mBlocksReleased		(0)
+{
+}
+
+NTV2AudioStreamReader::~NTV2AudioStreamReader ()
+{
+	Stop();
+}
+
+bool NTV2AudioStreamReader::Start (const NTV2AudioSystem inAudioSystem, const ULWord inSamplesPerBlock, const ULWord inNumBlocks)
+{
+	Stop();
+	if (!NTV2_IS_VALID_AUDIO_SYSTEM(inAudioSystem))
+		{ASRFAIL("Invalid audio system " << DEC(inAudioSystem));  return false;}
+	if (!inSamplesPerBlock  ||  inNumBlocks < 2)
+		{ASRFAIL("Bad block configuration: " << DEC(inSamplesPerBlock) << " samples/block, " << DEC(inNumBlocks) << " blocks");  return false;}
+
+	ULWord numChannels(0), wrapAddress(0), readOffset(0), lastIn(0);
+	if (!mDevice.GetNumberAudioChannels(numChannels, inAudioSystem)  ||  !numChannels)
+		{ASRFAIL("GetNumberAudioChannels failed for " << ::NTV2AudioSystemToString(inAudioSystem, true));  return false;}
+	if (!mDevice.GetAudioWrapAddress(wrapAddress, inAudioSystem)  ||  !mDevice.GetAudioReadOffset(readOffset, inAudioSystem))
+		{ASRFAIL("Can't determine capture buffer geometry for " << ::NTV2AudioSystemToString(inAudioSystem, true));  return false;}
+
+	//	Blocks must fit comfortably within the device ring...
+	const ULWord frameBytes (numChannels * 4);
+	const uint64_t blockBytes (uint64_t(inSamplesPerBlock) * frameBytes);
+	if (wrapAddress % frameBytes)
+		{ASRFAIL("Capture ring size " << xHEX0N(wrapAddress,8) << " isn't a multiple of the " << DEC(frameBytes) << "-byte sample frame");  return false;}
+	if (blockBytes > wrapAddress / 2)
+		{ASRFAIL(DEC(blockBytes) << "-byte block exceeds half of the " << DEC(wrapAddress) << "-byte capture ring");  return false;}
+	if (!mHostRing.Allocate(size_t(blockBytes * inNumBlocks), /*pageAligned*/true))
+		{ASRFAIL("Failed to allocate " << DEC(blockBytes * inNumBlocks) << "-byte host ring");  return false;}
+
+	//	Start at the current Write Head...
+	if (!mDevice.ReadAudioLastIn(lastIn, inAudioSystem))
+		{ASRFAIL("ReadAudioLastIn failed for " << ::NTV2AudioSystemToString(inAudioSystem, true));  mHostRing.Deallocate();  return false;}
+
+	mAudioSystem		= inAudioSystem;
+	mNumChannels		= numChannels;
+	mFrameBytes			= frameBytes;
+	mBlockBytes			= ULWord(blockBytes);
+	mNumBlocks			= inNumBlocks;
+	mCaptureOffset		= readOffset;
+	mDeviceRingBytes	= wrapAddress;
+	mDevicePos			= (lastIn % mDeviceRingBytes) / mFrameBytes * mFrameBytes;
+	mLeftoverBytes		= 0;
+	mBlocksFilled		= 0;
+	mBlocksReleased		= 0;
+	mStats				= Stats();
+	mRunning			= true;
+	ASRNOTE("Started " << ::NTV2AudioSystemToString(mAudioSystem, true) << ": " << DEC(mNumChannels) << " chls, "
+			<< DEC(mNumBlocks) << " x " << DEC(mBlockBytes) << "-byte blocks, write head at " << xHEX0N(mDevicePos,8));
+	return true;
+}
+
+void NTV2AudioStreamReader::Stop (void)
+{
+	if (mRunning)
+		ASRNOTE("Stopped " << ::NTV2AudioSystemToString(mAudioSystem, true) << ": " << DEC(mStats.fBlocksRead) << " blocks read, "
+				<< DEC(mStats.fDeviceOverruns) << " device overrun(s), " << DEC(mStats.fLatencySkips) << " latency skip(s), "
+				<< DEC(mStats.fHostOverruns) << " host overrun(s)");
+	mRunning = false;
+	mBlocksFilled = mBlocksReleased = 0;
+	mHostRing.Deallocate();
+}
+
+bool NTV2AudioStreamReader::Poll (void)
+{
+	if (!mRunning)
+		return false;
+
+	ULWord lastIn(0);
+	if (!mDevice.ReadAudioLastIn(lastIn, mAudioSystem))
+		{ASRFAIL("ReadAudioLastIn failed for " << ::NTV2AudioSystemToString(mAudioSystem, true));  return false;}
+	const ULWord writePos ((lastIn % mDeviceRingBytes) / mFrameBytes * mFrameBytes);
+	ULWord backlog ((writePos + mDeviceRingBytes - mDevicePos) % mDeviceRingBytes);
+
+	//	The backlog can only shrink if the device lapped me. It's also unsafe to read audio that's
+	//	within one block of being overwritten...
+	if (backlog < mLeftoverBytes  ||  backlog > mDeviceRingBytes - mBlockBytes)
+	{
+		mStats.fDeviceOverruns++;
+		ASRWARN(::NTV2AudioSystemToString(mAudioSystem, true) << " overrun: read pos " << xHEX0N(mDevicePos,8) << ", write pos "
+				<< xHEX0N(writePos,8) << " -- resyncing");
+		mDevicePos = writePos;
+		mLeftoverBytes = 0;
+		return true;
+	}
+	if (backlog > mStats.fMaxBacklogBytes)
+		mStats.fMaxBacklogBytes = backlog;
+
+	//	Enforce latency limit...
+	const uint64_t maxLatencyBytes (uint64_t(mMaxLatencyBlocks) * mBlockBytes);
+	if (mMaxLatencyBlocks  &&  backlog > maxLatencyBytes)
+	{
+		const ULWord numSkipped (ULWord((backlog - maxLatencyBytes + mBlockBytes - 1) / mBlockBytes));
+		mDevicePos = (mDevicePos + numSkipped * mBlockBytes) % mDeviceRingBytes;
+		backlog -= numSkipped * mBlockBytes;
+		mStats.fLatencySkips += numSkipped;
+		ASRDBG(::NTV2AudioSystemToString(mAudioSystem, true) << ": skipped " << DEC(numSkipped) << " block(s)");
+	}
+
+	//	Transfer complete blocks...
+	while (backlog >= mBlockBytes)
+	{
+		if (GetNumReadyBlocks() >= mNumBlocks)
+			mStats.fHostOverruns++;	//	Host ring full -- drop it
+		else
+		{
+			UByte * pBlock (reinterpret_cast<UByte*>(mHostRing.GetHostAddress(ULWord(mBlocksFilled % mNumBlocks) * mBlockBytes)));
+			if (!TransferBlock(pBlock))
+				{mLeftoverBytes = backlog;  return false;}
+			mBlocksFilled++;
+			mStats.fBlocksRead++;
+		}
+		mDevicePos = (mDevicePos + mBlockBytes) % mDeviceRingBytes;
+		backlog -= mBlockBytes;
+	}
+	mLeftoverBytes = backlog;
+	return true;
+}
+
+bool NTV2AudioStreamReader::TransferBlock (UByte * pOutBlock)
+{
+	//	Split the transfer if the block straddles the end of the device ring...
+	const ULWord preWrapBytes (mDevicePos + mBlockBytes > mDeviceRingBytes  ?  mDeviceRingBytes - mDevicePos  :  mBlockBytes);
+	if (!mDevice.DMAReadAudio(mAudioSystem, reinterpret_cast<ULWord*>(pOutBlock), mCaptureOffset + mDevicePos, preWrapBytes))
+		{ASRFAIL("DMAReadAudio failed for " << ::NTV2AudioSystemToString(mAudioSystem, true) << " offset " << xHEX0N(mDevicePos,8));  return false;}
+	mStats.fDMATransfers++;
+	if (preWrapBytes == mBlockBytes)
+		return true;
+
+	if (!mDevice.DMAReadAudio(mAudioSystem, reinterpret_cast<ULWord*>(pOutBlock + preWrapBytes), mCaptureOffset, mBlockBytes - preWrapBytes))
+		{ASRFAIL("DMAReadAudio failed for " << ::NTV2AudioSystemToString(mAudioSystem, true) << " offset 0");  return false;}
+	mStats.fDMATransfers++;
+	mStats.fWrapSplits++;
+	return true;
+}
+
+bool NTV2AudioStreamReader::AcquireBlock (NTV2Buffer & outBlock)
+{
+	if (!mRunning  ||  !GetNumReadyBlocks())
+		return false;
+	return outBlock.Set(mHostRing.GetHostAddress(ULWord(mBlocksReleased % mNumBlocks) * mBlockBytes), mBlockBytes);
+}
+
+bool NTV2AudioStreamReader::ReleaseBlock (void)
+{
+	if (!mRunning  ||  !GetNumReadyBlocks())
+		return false;
+	mBlocksReleased++;
+	return true;
+}
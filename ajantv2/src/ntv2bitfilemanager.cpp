@@ -9,11 +9,19 @@
 #include "ntv2utils.h"
 #include "ajabase/system/debug.h"
 #include "ajabase/system/file_io.h"
+#include "ajabase/common/common.h"
 #include <iostream>
+#include <sstream>
+#include <cstdio>
 #include <sys/stat.h>
 #include <assert.h>
 #if defined (AJALinux) || defined (AJAMac)
 	#include <arpa/inet.h>
+	#include <fcntl.h>
+	#include <unistd.h>
+	#include <sys/mman.h>
+#elif defined (MSWindows)
+	#include <windows.h>
 #endif
 #include <map>
 
@@ -26,7 +34,35 @@ using namespace std;
 #define BFMDBG(__x__)		AJA_sDEBUG	(AJA_DebugUnit_Firmware,	AJAFUNC << ": " << __x__)
 
 
+static const string	sCatalogFileName	(".ntv2bitfilecatalog");
+static const string	sCatalogSignature	("NTV2BitfileCatalog\t2");
+
+//	A file's size, modification time (in nanoseconds) and inode, which together tell if it changed since it was cataloged or mapped...
+static void GetFileIdentity (const struct stat & info, uint64_t & outSize, int64_t & outModTime, uint64_t & outInode)
+{
+	outSize = uint64_t(info.st_size);
+#if defined (AJAMac)
+	outModTime = int64_t(info.st_mtimespec.tv_sec) * 1000000000LL + int64_t(info.st_mtimespec.tv_nsec);
+#elif defined (AJALinux)
+	outModTime = int64_t(info.st_mtim.tv_sec) * 1000000000LL + int64_t(info.st_mtim.tv_nsec);
+#else
+	outModTime = int64_t(info.st_mtime) * 1000000000LL;
+#endif
+	outInode = uint64_t(info.st_ino);	//	Always 0 on Windows
+}
+
+static bool GetFileIdentity (const string & inPath, uint64_t & outSize, int64_t & outModTime, uint64_t & outInode)
+{
+	struct stat info;
+	if (::stat(inPath.c_str(), &info) != 0)
+		return false;
+	GetFileIdentity(info, outSize, outModTime, outInode);
+	return true;
+}
+
+
 CNTV2BitfileManager::CNTV2BitfileManager()
+	:	_useCatalog	(false)
 {
 }
 
@@ -35,51 +71,89 @@ CNTV2BitfileManager::~CNTV2BitfileManager()
 	Clear();
 }
 
+string CNTV2BitfileManager::GetCatalogFileName (void)
+{
+	return sCatalogFileName;
+}
+
 bool CNTV2BitfileManager::AddFile (const string & inBitfilePath)
 {
 	AJAFileIO Fio;
-	CNTV2Bitfile Bitfile;
-	NTV2BitfileInfo Info;
+	uint64_t fileSize(0), inode(0);
+	int64_t modTime(0);
 
 	//	Open bitfile...
-	if (!Fio.FileExists(inBitfilePath))
+	if (!Fio.FileExists(inBitfilePath)  ||  !GetFileIdentity(inBitfilePath, fileSize, modTime, inode))
 		{BFMFAIL("Bitfile path '" << inBitfilePath << "' not found");  return false;}
-	if (!Bitfile.Open(inBitfilePath))
-		{BFMFAIL("Bitfile '" << inBitfilePath << "' failed to open");  return false;}
-
-	// get bitfile information
-	Info.bitfilePath	= inBitfilePath;
-	Info.designName		= Bitfile.GetDesignName();
-	Info.designID		= Bitfile.GetDesignID();
-	Info.designVersion	= Bitfile.GetDesignVersion();
-	Info.bitfileID		= Bitfile.GetBitfileID();
-	Info.bitfileVersion = Bitfile.GetBitfileVersion();
-	if (Bitfile.IsTandem())
-		Info.bitfileFlags = NTV2_BITFILE_FLAG_TANDEM;
-	else if (Bitfile.IsClear())
-		Info.bitfileFlags = NTV2_BITFILE_FLAG_CLEAR;
-	else if (Bitfile.IsPartial())
-		Info.bitfileFlags = NTV2_BITFILE_FLAG_PARTIAL;
+
+	CatalogEntry entry;
+	CatalogMapConstIter catIter (_catalog.find(inBitfilePath));
+	if (catIter != _catalog.end()  &&  catIter->second.fileSize == fileSize  &&  catIter->second.modTime == modTime
+		&&  catIter->second.inode == inode)
+	{	//	Unchanged since cataloged -- no need to open it...
+		entry = catIter->second;
+		_stats.fCatalogHits++;
+		if (!entry.usable)
+			{BFMDBG("Bitfile '" << inBitfilePath << "' skipped, cataloged as unusable");  return false;}
+	}
 	else
-		Info.bitfileFlags = 0;
-	Info.deviceID		= Bitfile.GetDeviceID();
-
-	//	Check for reconfigurable bitfile...
-	if ((Info.designID == 0) || (Info.designID > 0xfe))
-		{BFMFAIL("Invalid design ID " << xHEX0N(Info.designID,8) << " for bitfile '" << inBitfilePath << "'");  return false;}
-	if (Info.designVersion > 0xfe)
-		{BFMFAIL("Invalid design version " << xHEX0N(Info.designVersion,8) << " for bitfile '" << inBitfilePath << "'");  return false;}
-	if ((Info.bitfileID > 0xfe))
-		{BFMFAIL("Invalid bitfile ID " << xHEX0N(Info.bitfileID,8) << " for bitfile '" << inBitfilePath << "'");  return false;}
-	if (Info.bitfileVersion > 0xfe)
-		{BFMFAIL("Invalid bitfile version " << xHEX0N(Info.bitfileVersion,8) << " for bitfile '" << inBitfilePath << "'");  return false;}
-	if (Info.bitfileFlags == 0)
-		{BFMFAIL("No flags set for bitfile '" << inBitfilePath << "'");  return false;}
-	if (Info.deviceID == 0)
-		{BFMFAIL("Device ID is zero for bitfile '" << inBitfilePath << "'");  return false;}
+	{
+		CNTV2Bitfile Bitfile;
+		CatalogEntry & newEntry (_catalog[inBitfilePath]);
+		NTV2BitfileInfo & Info (newEntry.info);
+		newEntry = CatalogEntry();
+		newEntry.fileSize = fileSize;
+		newEntry.modTime = modTime;
+		newEntry.inode = inode;
+		_stats.fHeadersParsed++;
+		if (!Bitfile.Open(inBitfilePath))
+			{BFMFAIL("Bitfile '" << inBitfilePath << "' failed to open");  return false;}
+
+		// get bitfile information
+		Info.bitfilePath	= inBitfilePath;
+		Info.designName		= Bitfile.GetDesignName();
+		Info.designID		= Bitfile.GetDesignID();
+		Info.designVersion	= Bitfile.GetDesignVersion();
+		Info.bitfileID		= Bitfile.GetBitfileID();
+		Info.bitfileVersion = Bitfile.GetBitfileVersion();
+		if (Bitfile.IsTandem())
+			Info.bitfileFlags = NTV2_BITFILE_FLAG_TANDEM;
+		else if (Bitfile.IsClear())
+			Info.bitfileFlags = NTV2_BITFILE_FLAG_CLEAR;
+		else if (Bitfile.IsPartial())
+			Info.bitfileFlags = NTV2_BITFILE_FLAG_PARTIAL;
+		else
+			Info.bitfileFlags = 0;
+		Info.deviceID		= Bitfile.GetDeviceID();
+		newEntry.programOffset	= ULWord(Bitfile.GetProgramStreamOffset());
+		newEntry.programBytes	= ULWord(Bitfile.GetProgramStreamLength());
+
+		//	Check for reconfigurable bitfile...
+		if ((Info.designID == 0) || (Info.designID > 0xfe))
+			{BFMFAIL("Invalid design ID " << xHEX0N(Info.designID,8) << " for bitfile '" << inBitfilePath << "'");  return false;}
+		if (Info.designVersion > 0xfe)
+			{BFMFAIL("Invalid design version " << xHEX0N(Info.designVersion,8) << " for bitfile '" << inBitfilePath << "'");  return false;}
+		if ((Info.bitfileID > 0xfe))
+			{BFMFAIL("Invalid bitfile ID " << xHEX0N(Info.bitfileID,8) << " for bitfile '" << inBitfilePath << "'");  return false;}
+		if (Info.bitfileVersion > 0xfe)
+			{BFMFAIL("Invalid bitfile version " << xHEX0N(Info.bitfileVersion,8) << " for bitfile '" << inBitfilePath << "'");  return false;}
+		if (Info.bitfileFlags == 0)
+			{BFMFAIL("No flags set for bitfile '" << inBitfilePath << "'");  return false;}
+		if (Info.deviceID == 0)
+			{BFMFAIL("Device ID is zero for bitfile '" << inBitfilePath << "'");  return false;}
+		newEntry.usable = true;
+		entry = newEntry;
+	}
 
 	//	Add to list...
-	_bitfileList.push_back(Info);
+	BitstreamCache cache;
+	cache.fileSize		= entry.fileSize;
+	cache.modTime		= entry.modTime;
+	cache.inode			= entry.inode;
+	cache.programOffset	= entry.programOffset;
+	cache.programBytes	= entry.programBytes;
+	_bitfileList.push_back(entry.info);
+	_cacheList.push_back(cache);
 	BFMNOTE("Bitfile '" << inBitfilePath << "' successfully added to bitfile manager");
 	return true;
 }
@@ -97,12 +171,100 @@ bool CNTV2BitfileManager::AddDirectory (const string & inDirectory)
 	if (AJA_FAILURE(Fio.ReadDirectory(inDirectory, "*.bit", fileContainer)))
 		{BFMFAIL("ReadDirectory '" << inDirectory << "' failed");  return false;}
 
+	//	Load catalog...
+	const bool hasCatalog (_useCatalog  &&  LoadCatalog(inDirectory));
+
 	// add bitfiles
 	const size_t origNum(_bitfileList.size());
+	const ULWord origParsed(_stats.fHeadersParsed);
 	for (NTV2StringListConstIter fcIter(fileContainer.begin());	 fcIter != fileContainer.end();	 ++fcIter)
 		AddFile(*fcIter);
 	BFMNOTE(DEC(_bitfileList.size() - origNum) << " bitfile(s) added from directory '" << inDirectory << "'");
 
+	//	Update catalog if any bitfiles were added, changed or removed...
+	if (_useCatalog)
+	{
+		bool stale (!hasCatalog  ||  _stats.fHeadersParsed != origParsed);
+		const string dirPrefix (inDirectory + "/");
+		const NTV2StringSet dirFiles (fileContainer.begin(), fileContainer.end());
+		for (CatalogMap::iterator it(_catalog.begin());  it != _catalog.end();  )
+			if (it->first.find(dirPrefix) == 0  &&  it->first.find('/', dirPrefix.length()) == string::npos
+				&&  dirFiles.find(it->first) == dirFiles.end())
+					{_catalog.erase(it++);  stale = true;}	//	No longer in directory
+			else
+				++it;
+		if (stale)
+			SaveCatalog(inDirectory);
+	}
+	return true;
+}
+
+bool CNTV2BitfileManager::LoadCatalog (const string & inDirectory)
+{
+	ifstream ifs ((inDirectory + "/" + sCatalogFileName).c_str());
+	string line;
+	if (!ifs.good()  ||  !getline(ifs, line)  ||  line != sCatalogSignature)
+		return false;	//	No catalog, or unrecognized format
+
+	size_t numEntries(0);
+	while (getline(ifs, line))
+	{
+		const NTV2StringList fields (aja::split(line, '\t'));
+		if (fields.size() != 14)
+			{BFMWARN("Bad entry '" << line << "' in '" << inDirectory << "' catalog");  continue;}
+		CatalogEntry entry;
+		ULWord usable(0), deviceID(0);
+		uint64_t fileSize(0), inode(0);
+		int64_t modTime(0);
+		istringstream iss (fields.at(0) + " " + fields.at(1) + " " + fields.at(2) + " " + fields.at(3) + " " + fields.at(4) + " " + fields.at(5)
+							+ " " + fields.at(6) + " " + fields.at(7) + " " + fields.at(8) + " " + fields.at(9) + " " + fields.at(10) + " " + fields.at(11));
+		iss >> usable >> fileSize >> modTime >> inode >> entry.programOffset >> entry.programBytes >> entry.info.designID >> entry.info.designVersion
+			>> entry.info.bitfileID >> entry.info.bitfileVersion >> entry.info.bitfileFlags >> deviceID;
+		if (iss.fail())
+			{BFMWARN("Bad entry '" << line << "' in '" << inDirectory << "' catalog");  continue;}
+		entry.usable			= usable ? true : false;
+		entry.fileSize			= fileSize;
+		entry.modTime			= modTime;
+		entry.inode				= inode;
+		entry.info.deviceID		= NTV2DeviceID(deviceID);
+		entry.info.designName	= fields.at(12);
+		entry.info.bitfilePath	= inDirectory + "/" + fields.at(13);
+		_catalog[entry.info.bitfilePath] = entry;
+		numEntries++;
+	}
+	BFMDBG(DEC(numEntries) << " entries loaded from '" << inDirectory << "' catalog");
+	return true;
+}
+
+bool CNTV2BitfileManager::SaveCatalog (const string & inDirectory)
+{
+	const string dirPrefix (inDirectory + "/");
+	const string catalogPath (dirPrefix + sCatalogFileName), tempPath (catalogPath + ".tmp");
+	{
+		ofstream ofs (tempPath.c_str(), ios::out | ios::trunc);
+		if (!ofs.good())
+			{BFMDBG("Can't write '" << tempPath << "'");  return false;}
+		ofs << sCatalogSignature << endl;
+		for (CatalogMapConstIter it(_catalog.begin());  it != _catalog.end();  ++it)
+		{
+			if (it->first.find(dirPrefix) != 0  ||  it->first.find('/', dirPrefix.length()) != string::npos)
+				continue;	//	Not in this directory
+			const CatalogEntry & entry (it->second);
+			ofs << (entry.usable ? 1 : 0) << "\t" << entry.fileSize << "\t" << entry.modTime << "\t" << entry.inode << "\t" << entry.programOffset
+				<< "\t" << entry.programBytes << "\t" << entry.info.designID << "\t" << entry.info.designVersion << "\t" << entry.info.bitfileID
+				<< "\t" << entry.info.bitfileVersion << "\t" << entry.info.bitfileFlags << "\t" << ULWord(entry.info.deviceID)
+				<< "\t" << entry.info.designName << "\t" << it->first.substr(dirPrefix.length()) << endl;
+		}
+		if (!ofs.good())
+			{BFMDBG("Failed writing '" << tempPath << "'");  ofs.close();  ::remove(tempPath.c_str());  return false;}
+	}
+#if defined (MSWindows)
+	::remove(catalogPath.c_str());	//	Windows won't rename over an existing file
+#endif
+	if (::rename(tempPath.c_str(), catalogPath.c_str()) != 0)
+		{BFMDBG("Can't rename '" << tempPath << "' to '" << catalogPath << "'");  ::remove(tempPath.c_str());  return false;}
+	_stats.fCatalogsWritten++;
+	BFMDBG("Catalog '" << catalogPath << "' written");
 	return true;
 }
 
@@ -110,8 +272,13 @@ void CNTV2BitfileManager::Clear (void)
 {
 	if (!_bitfileList.empty()  ||  !_bitstreamList.empty())
 		BFMNOTE(DEC(_bitfileList.size()) << " bitfile(s), " << DEC(_bitstreamList.size()) << " cached bitstream(s) cleared");
+	for (size_t ndx(0);  ndx < _cacheList.size();  ndx++)
+		UnmapBitfile(ndx);
 	_bitfileList.clear();
 	_bitstreamList.clear();
+	_cacheList.clear();
+	_catalog.clear();
+	_stats = Stats();
 }
 
 size_t CNTV2BitfileManager::GetNumBitfiles (void)
@@ -126,6 +293,45 @@ bool CNTV2BitfileManager::GetBitStream (NTV2Buffer & outBitstream,
 										const ULWord inBitfileID,
 										const ULWord inBitfileVersion,
 										const ULWord inBitfileFlags)
+{
+	size_t ndx(0);
+	if (!FindBitstream(ndx, inDesignID, inDesignVersion, inBitfileID, inBitfileVersion, inBitfileFlags))
+		return false;
+
+	if (IsCachedAddress(outBitstream.GetHostPointer()))
+		outBitstream.Set(AJA_NULL, 0);	//	Never copy into one of my own bitstreams (e.g. a read-only mapped view)
+	const BitstreamCache & cache (_cacheList.at(ndx));
+	if (cache.mapAddress)
+		outBitstream = NTV2Buffer(reinterpret_cast<const UByte*>(cache.mapAddress) + cache.programOffset, cache.programBytes);
+	else
+		outBitstream = _bitstreamList[ndx];
+	return true;
+}
+
+bool CNTV2BitfileManager::GetBitStreamView (NTV2Buffer & outView,
+											const ULWord inDesignID,
+											const ULWord inDesignVersion,
+											const ULWord inBitfileID,
+											const ULWord inBitfileVersion,
+											const ULWord inBitfileFlags)
+{
+	size_t ndx(0);
+	if (!FindBitstream(ndx, inDesignID, inDesignVersion, inBitfileID, inBitfileVersion, inBitfileFlags))
+		return false;
+
+	const BitstreamCache & cache (_cacheList.at(ndx));
+	if (cache.mapAddress)
+		return outView.Set(reinterpret_cast<const UByte*>(cache.mapAddress) + cache.programOffset, cache.programBytes);
+	const NTV2Buffer & bitstream (_bitstreamList[ndx]);
+	return outView.Set(bitstream.GetHostPointer(), bitstream.GetByteCount());
+}
+
+bool CNTV2BitfileManager::FindBitstream (size_t & outIndex,
+										const ULWord inDesignID,
+										const ULWord inDesignVersion,
+										const ULWord inBitfileID,
+										const ULWord inBitfileVersion,
+										const ULWord inBitfileFlags)
 {
 	size_t numBitfiles (GetNumBitfiles());
 	size_t maxNdx (numBitfiles);
@@ -163,17 +369,36 @@ bool CNTV2BitfileManager::GetBitStream (NTV2Buffer & outBitstream,
 				<< " bitfileID=" << xHEX0N(inBitfileID,8) << " bitfileVers=" << xHEX0N(inBitfileVersion,8));
 		return false;
 	}
-
-	outBitstream = _bitstreamList[ndx];
+	outIndex = ndx;
 	return true;
 }
 
 bool CNTV2BitfileManager::ReadBitstream (const size_t inIndex)
 {
 	//	Already in cache?
+	BitstreamCache & cache (_cacheList.at(inIndex));
+	if (cache.mapAddress)
+	{	//	Mapped -- but if the file changed since, the mapping may no longer be safe to touch...
+		uint64_t fileSize(0), inode(0);
+		int64_t modTime(0);
+		if (GetFileIdentity(_bitfileList.at(inIndex).bitfilePath, fileSize, modTime, inode)
+			&&  fileSize == cache.fileSize  &&  modTime == cache.modTime  &&  inode == cache.inode)
+				return true;	//	Yes, mapped, and unchanged
+		BFMWARN("Bitfile '" << _bitfileList.at(inIndex).bitfilePath << "' changed since it was mapped -- mapping dropped");
+		UnmapBitfile(inIndex);
+		_stats.fMappingsDropped++;
+	}
 	if ((inIndex < _bitstreamList.size())  &&  !_bitstreamList.at(inIndex).IsNULL())
 		return true;	//	Yes
 
+	//	Try mapping it...
+	if (MapBitfile(inIndex))
+	{
+		_stats.fBitstreamsMapped++;
+		BFMDBG("Mapped " << DEC(_cacheList.at(inIndex).programBytes) << "-byte bitstream for '" << _bitfileList.at(inIndex).bitfilePath << "' at index " << DEC(inIndex));
+		return true;
+	}
+
 	//	Open bitfile to get bitstream...
 	CNTV2Bitfile Bitfile;
 	if (!Bitfile.Open(_bitfileList.at(inIndex).bitfilePath))
@@ -188,6 +413,90 @@ bool CNTV2BitfileManager::ReadBitstream (const size_t inIndex)
 		_bitstreamList.resize(inIndex + 1);
 
 	_bitstreamList[inIndex] = Bitstream;
+	_stats.fBitstreamsRead++;
 	BFMDBG("Cached " << DEC(Bitstream.GetByteCount()) << "-byte bitstream for '" << _bitfileList.at(inIndex).bitfilePath << "' at index " << DEC(inIndex));
 	return true;
 }
+
+bool CNTV2BitfileManager::MapBitfile (const size_t inIndex)
+{
+	BitstreamCache & cache (_cacheList.at(inIndex));
+	const string & path (_bitfileList.at(inIndex).bitfilePath);
+	if (!cache.programBytes  ||  uint64_t(cache.programOffset) + cache.programBytes > cache.fileSize)
+		return false;	//	Bad bitstream offset/size
+#if defined (AJALinux) || defined (AJAMac)
+	const int fd (::open(path.c_str(), O_RDONLY));
+	if (fd < 0)
+		{BFMWARN("Can't open '" << path << "'");  return false;}
+	struct stat info;
+	void * pMap (MAP_FAILED);
+	uint64_t fileSize(0), inode(0);
+	int64_t modTime(0);
+	if (::fstat(fd, &info) == 0)
+		GetFileIdentity(info, fileSize, modTime, inode);
+	if (fileSize == cache.fileSize  &&  modTime == cache.modTime  &&  inode == cache.inode)
+		pMap = ::mmap(AJA_NULL, size_t(cache.fileSize), PROT_READ, MAP_PRIVATE, fd, 0);
+	::close(fd);
+	if (pMap == MAP_FAILED)
+		{BFMWARN("Can't map '" << path << "'");  return false;}
+	cache.mapAddress = pMap;
+	cache.mapBytes = size_t(cache.fileSize);
+	return true;
+#elif defined (MSWindows)
+	HANDLE hFile (::CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ, AJA_NULL, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, AJA_NULL));
+	if (hFile == INVALID_HANDLE_VALUE)
+		{BFMWARN("Can't open '" << path << "'");  return false;}
+	LARGE_INTEGER fileSize;
+	HANDLE hMap (AJA_NULL);
+	if (::GetFileSizeEx(hFile, &fileSize)  &&  uint64_t(fileSize.QuadPart) == cache.fileSize)
+		hMap = ::CreateFileMappingA(hFile, AJA_NULL, PAGE_READONLY, 0, 0, AJA_NULL);
+	::CloseHandle(hFile);
+	void * pMap (hMap ? ::MapViewOfFile(hMap, FILE_MAP_READ, 0, 0, 0) : AJA_NULL);
+	if (!pMap)
+	{
+		if (hMap)
+			::CloseHandle(hMap);
+		BFMWARN("Can't map '" << path << "'");
+		return false;
+	}
+	cache.mapAddress = pMap;
+	cache.mapHandle = hMap;
+	cache.mapBytes = size_t(cache.fileSize);
+	return true;
+#else
+	(void) path;
+	return false;	//	Not supported -- ReadBitstream will read it instead
+#endif
+}
+
+void CNTV2BitfileManager::UnmapBitfile (const size_t inIndex)
+{
+	BitstreamCache & cache (_cacheList.at(inIndex));
+#if defined (AJALinux) || defined (AJAMac)
+	if (cache.mapAddress)
+		::munmap(cache.mapAddress, cache.mapBytes);
+#elif defined (MSWindows)
+	if (cache.mapAddress)
+		::UnmapViewOfFile(cache.mapAddress);
+	if (cache.mapHandle)
+		::CloseHandle(HANDLE(cache.mapHandle));
+#endif
+	cache.mapAddress = cache.mapHandle = AJA_NULL;
+	cache.mapBytes = 0;
+}
+
+bool CNTV2BitfileManager::IsCachedAddress (const void * pInAddress) const
+{
+	const UByte * pAddr (reinterpret_cast<const UByte*>(pInAddress));
+	if (!pAddr)
+		return false;
+	for (BitstreamCacheList::const_iterator it(_cacheList.begin());  it != _cacheList.end();  ++it)
+		if (it->mapAddress  &&  pAddr >= reinterpret_cast<const UByte*>(it->mapAddress)
+			&&  pAddr < reinterpret_cast<const UByte*>(it->mapAddress) + it->mapBytes)
+				return true;
+	for (NTV2BitstreamListConstIter it(_bitstreamList.begin());  it != _bitstreamList.end();  ++it)
+		if (!it->IsNULL()  &&  pAddr >= reinterpret_cast<const UByte*>(it->GetHostPointer())
+			&&  pAddr < reinterpret_cast<const UByte*>(it->GetHostPointer()) + it->GetByteCount())
+				return true;
+	return false;
+}
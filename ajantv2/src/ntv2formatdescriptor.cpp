@@ -859,6 +859,7 @@ NTV2FormatDescriptor::NTV2FormatDescriptor (const NTV2FrameSize &	inFrameSize,
 	//	mLinePitch[0]:	# bytes per line
 	//	linePitch:	# 32-bit words per line -- shadows mLinePitch[0] / sizeof(ULWord)
 	mPixelFormat = inPixelFormat;
+	mNumPlanes = 1;	//	FinalizePlanar (below) fixes this for planar formats
 	switch (mPixelFormat)
 	{
 		case NTV2_FBF_8BIT_YCBCR:
@@ -872,7 +873,13 @@ NTV2FormatDescriptor::NTV2FormatDescriptor (const NTV2FrameSize &	inFrameSize,
 		case NTV2_FBF_ABGR:
 		case NTV2_FBF_10BIT_RGB:
 		case NTV2_FBF_10BIT_DPX:
-		case NTV2_FBF_10BIT_DPX_LE:				mLinePitch[0] = 4*numPixels;	linePitch = mLinePitch[0]/4;	break;
+		case NTV2_FBF_10BIT_DPX_LE:
+		case NTV2_FBF_10BIT_RGB_PACKED:
+		case NTV2_FBF_10BIT_YCBCRA:				mLinePitch[0] = 4*numPixels;	linePitch = mLinePitch[0]/4;	break;
+
+		case NTV2_FBF_10BIT_ARGB:				mLinePitch[0] = 5*numPixels;	linePitch = mLinePitch[0]/4;	break;
+
+		case NTV2_FBF_16BIT_ARGB:				mLinePitch[0] = 8*numPixels;	linePitch = mLinePitch[0]/4;	break;
 
 		case NTV2_FBF_24BIT_RGB:
 		case NTV2_FBF_24BIT_BGR:				mLinePitch[0] = 3*numPixels;	linePitch = mLinePitch[0]/4;	break;
@@ -890,6 +897,9 @@ NTV2FormatDescriptor::NTV2FormatDescriptor (const NTV2FrameSize &	inFrameSize,
 		case NTV2_FBF_10BIT_YCBCR_420PL2:
 		case NTV2_FBF_10BIT_YCBCR_422PL2:		linePitch = 5*numPixels/16;	break;
 
+		case NTV2_FBF_8BIT_YCBCR_420PL2:
+		case NTV2_FBF_8BIT_YCBCR_422PL2:		linePitch = numPixels/4;	break;
+
 		default:	mLinePitch[0] = 0;	linePitch = 0;	break;	//	unsupported
 	}
 	mNumBitsLuma	= gBitsPerComponent[mPixelFormat][0];
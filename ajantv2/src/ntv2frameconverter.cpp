@@ -0,0 +1,1005 @@
+/* SPDX-License-Identifier: MIT */
+/**
+	@file		ntv2frameconverter.cpp
+	@brief		Implements the NTV2FrameConverter class.
+	@copyright	(C) 2026 AJA Video Systems, Inc.
+**/
+
+#include "ntv2frameconverter.h"
+#include "ntv2parallel.h"
+#include "ntv2transcode.h"
+#include "ntv2hostcsc.h"
+#include "ntv2endian.h"
+#include "ajabase/system/systemtime.h"
+#include <string.h>
+#if defined(__SSE2__)
+	#include <emmintrin.h>
+	#define	NTV2_FRAMECONV_SSE2	1
+#endif	//	__SSE2__
+
+using namespace std;
+
+#define	FC_COMPS	4	//	Intermediate components per pixel:  [0]=Y/G  [1]=Cb/B  [2]=Cr/R  [3]=A
+#define	FC_OPAQUE	0xFFFF
+
+
+//////////////////////////////////////////////////////////////////////////////////////////////////////
+//	Component scaling -- the intermediate holds 16-bit, left-justified component values
+//////////////////////////////////////////////////////////////////////////////////////////////////////
+
+template <unsigned B> static inline UWord Up (const ULWord inValue)
+{
+	return UWord(inValue << (16 - B));
+}
+
+template <unsigned B> static inline ULWord Dn (const UWord inValue)
+{
+	const ULWord result ((ULWord(inValue) + (1UL << (15 - B))) >> (16 - B));
+	return result > ((1UL << B) - 1) ? ((1UL << B) - 1) : result;
+}
+
+template <> inline ULWord Dn<16> (const UWord inValue)
+{
+	return inValue;
+}
+
+static inline ULWord RoundUp (const ULWord inValue, const ULWord inMultiple)
+{
+	return (inValue + inMultiple - 1) / inMultiple * inMultiple;
+}
+
+//	4:2:2 sample pair <==> two intermediate pixels
+static inline void Put422 (UWord * pOut, const UWord inCb, const UWord inY0, const UWord inCr, const UWord inY1)
+{
+	pOut[0] = inY0;  pOut[1] = inCb;  pOut[2] = inCr;  pOut[3] = FC_OPAQUE;
+	pOut[4] = inY1;  pOut[5] = inCb;  pOut[6] = inCr;  pOut[7] = FC_OPAQUE;
+}
+
+static inline void Get422 (const UWord * pIn, UWord & outCb, UWord & outY0, UWord & outCr, UWord & outY1)
+{
+	outY0 = pIn[0];
+	outY1 = pIn[4];
+	outCb = UWord((ULWord(pIn[1]) + ULWord(pIn[5]) + 1) >> 1);
+	outCr = UWord((ULWord(pIn[2]) + ULWord(pIn[6]) + 1) >> 1);
+}
+
+
+//////////////////////////////////////////////////////////////////////////////////////////////////////
+//	Unpackers & packers
+//	-	"inFirstPixel" is always a multiple of the format's packing group size
+//	-	"inNumPixels" is always a multiple of the format's packing group size
+//	-	Packers skip chroma planes whose pointer is NULL (odd rows of 4:2:0 rasters)
+//////////////////////////////////////////////////////////////////////////////////////////////////////
+
+typedef void (*UnpackFunc) (const UByte * const * pInPlanes, const ULWord inFirstPixel, const ULWord inNumPixels, UWord * pOutTile);
+typedef void (*PackFunc) (const UWord * pInTile, UByte * const * pOutPlanes, const ULWord inFirstPixel, const ULWord inNumPixels);
+
+
+//	v210 and 10-bit YCbCr DPX:  6 pixels per 4 words
+template <bool DPX> static inline ULWord V210Word (const ULWord inWord)
+{
+	return DPX ? (ULWord(NTV2EndianSwap32(inWord)) >> 2) : inWord;
+}
+
+template <bool DPX> static void Unpack_v210 (const UByte * const * pPlanes, const ULWord inFirstPixel, const ULWord inNumPixels, UWord * pOut)
+{
+	const ULWord *	pSrc (reinterpret_cast<const ULWord*>(pPlanes[0]) + inFirstPixel / 6 * 4);
+	for (ULWord px(0);  px < inNumPixels;  px += 6, pSrc += 4, pOut += 6 * FC_COMPS)
+	{
+		const ULWord w0(V210Word<DPX>(pSrc[0])), w1(V210Word<DPX>(pSrc[1])), w2(V210Word<DPX>(pSrc[2])), w3(V210Word<DPX>(pSrc[3]));
+		Put422 (pOut,		Up<10>(w0 & 0x3FF),			Up<10>((w0 >> 10) & 0x3FF),	Up<10>((w0 >> 20) & 0x3FF),	Up<10>(w1 & 0x3FF));
+		Put422 (pOut + 8,	Up<10>((w1 >> 10) & 0x3FF),	Up<10>((w1 >> 20) & 0x3FF),	Up<10>(w2 & 0x3FF),			Up<10>((w2 >> 10) & 0x3FF));
+		Put422 (pOut + 16,	Up<10>((w2 >> 20) & 0x3FF),	Up<10>(w3 & 0x3FF),			Up<10>((w3 >> 10) & 0x3FF),	Up<10>((w3 >> 20) & 0x3FF));
+	}
+}
+
+template <bool DPX> static void Pack_v210 (const UWord * pIn, UByte * const * pPlanes, const ULWord inFirstPixel, const ULWord inNumPixels)
+{
+	ULWord *	pDst (reinterpret_cast<ULWord*>(pPlanes[0]) + inFirstPixel / 6 * 4);
+	UWord		s[12];
+	for (ULWord px(0);  px < inNumPixels;  px += 6, pIn += 6 * FC_COMPS, pDst += 4)
+	{
+		Get422 (pIn,		s[0], s[1], s[2],  s[3]);
+		Get422 (pIn + 8,	s[4], s[5], s[6],  s[7]);
+		Get422 (pIn + 16,	s[8], s[9], s[10], s[11]);
+		for (unsigned w(0);  w < 4;  w++)
+		{
+			const ULWord word (Dn<10>(s[3*w]) | (Dn<10>(s[3*w+1]) << 10) | (Dn<10>(s[3*w+2]) << 20));
+			pDst[w] = DPX ? ULWord(NTV2EndianSwap32(word << 2)) : word;
+		}
+	}
+}
+
+
+//	8-bit packed 4:2:2 ('2vuy' and YUY2)
+template <unsigned CB, unsigned Y0, unsigned CR, unsigned Y1> static void Unpack_422_8 (const UByte * const * pPlanes, const ULWord inFirstPixel, const ULWord inNumPixels, UWord * pOut)
+{
+	const UByte *	pSrc (pPlanes[0] + inFirstPixel * 2);
+	for (ULWord px(0);  px < inNumPixels;  px += 2, pSrc += 4, pOut += 2 * FC_COMPS)
+		Put422 (pOut, Up<8>(pSrc[CB]), Up<8>(pSrc[Y0]), Up<8>(pSrc[CR]), Up<8>(pSrc[Y1]));
+}
+
+template <unsigned CB, unsigned Y0, unsigned CR, unsigned Y1> static void Pack_422_8 (const UWord * pIn, UByte * const * pPlanes, const ULWord inFirstPixel, const ULWord inNumPixels)
+{
+	UByte *	pDst (pPlanes[0] + inFirstPixel * 2);
+	UWord	cb, y0, cr, y1;
+	for (ULWord px(0);  px < inNumPixels;  px += 2, pIn += 2 * FC_COMPS, pDst += 4)
+	{
+		Get422 (pIn, cb, y0, cr, y1);
+		pDst[CB] = UByte(Dn<8>(cb));  pDst[Y0] = UByte(Dn<8>(y0));  pDst[CR] = UByte(Dn<8>(cr));  pDst[Y1] = UByte(Dn<8>(y1));
+	}
+}
+
+
+//	10-bit YCbCrA:  Y 0-9, Cb (even pixels) or Cr (odd pixels) 10-19, A 20-29
+static void Unpack_YCbCrA (const UByte * const * pPlanes, const ULWord inFirstPixel, const ULWord inNumPixels, UWord * pOut)
+{
+	const ULWord *	pSrc (reinterpret_cast<const ULWord*>(pPlanes[0]) + inFirstPixel);
+	for (ULWord px(0);  px < inNumPixels;  px += 2, pSrc += 2, pOut += 2 * FC_COMPS)
+	{
+		Put422 (pOut, Up<10>((pSrc[0] >> 10) & 0x3FF), Up<10>(pSrc[0] & 0x3FF), Up<10>((pSrc[1] >> 10) & 0x3FF), Up<10>(pSrc[1] & 0x3FF));
+		pOut[3] = Up<10>((pSrc[0] >> 20) & 0x3FF);
+		pOut[7] = Up<10>((pSrc[1] >> 20) & 0x3FF);
+	}
+}
+
+static void Pack_YCbCrA (const UWord * pIn, UByte * const * pPlanes, const ULWord inFirstPixel, const ULWord inNumPixels)
+{
+	ULWord *	pDst (reinterpret_cast<ULWord*>(pPlanes[0]) + inFirstPixel);
+	UWord		cb, y0, cr, y1;
+	for (ULWord px(0);  px < inNumPixels;  px += 2, pIn += 2 * FC_COMPS, pDst += 2)
+	{
+		Get422 (pIn, cb, y0, cr, y1);
+		pDst[0] = Dn<10>(y0) | (Dn<10>(cb) << 10) | (Dn<10>(pIn[3]) << 20);
+		pDst[1] = Dn<10>(y1) | (Dn<10>(cr) << 10) | (Dn<10>(pIn[7]) << 20);
+	}
+}
+
+
+//	3-plane 4:2:2 & 4:2:0 (8-bit samples, or 10-bit samples in 16-bit LE containers)
+template <typename T, unsigned B> static void Unpack_PL3 (const UByte * const * pPlanes, const ULWord inFirstPixel, const ULWord inNumPixels, UWord * pOut)
+{
+	const T *	pY	(reinterpret_cast<const T*>(pPlanes[0]) + inFirstPixel);
+	const T *	pCb	(reinterpret_cast<const T*>(pPlanes[1]) + inFirstPixel / 2);
+	const T *	pCr	(reinterpret_cast<const T*>(pPlanes[2]) + inFirstPixel / 2);
+	for (ULWord px(0);  px < inNumPixels;  px += 2, pY += 2, pOut += 2 * FC_COMPS)
+		Put422 (pOut, Up<B>(*pCb++), Up<B>(pY[0]), Up<B>(*pCr++), Up<B>(pY[1]));
+}
+
+template <typename T, unsigned B> static void Pack_PL3 (const UWord * pIn, UByte * const * pPlanes, const ULWord inFirstPixel, const ULWord inNumPixels)
+{
+	T *		pY	(reinterpret_cast<T*>(pPlanes[0]) + inFirstPixel);
+	T *		pCb	(pPlanes[1] ? reinterpret_cast<T*>(pPlanes[1]) + inFirstPixel / 2 : AJA_NULL);
+	T *		pCr	(pPlanes[2] ? reinterpret_cast<T*>(pPlanes[2]) + inFirstPixel / 2 : AJA_NULL);
+	UWord	cb, y0, cr, y1;
+	for (ULWord px(0);  px < inNumPixels;  px += 2, pY += 2, pIn += 2 * FC_COMPS)
+	{
+		Get422 (pIn, cb, y0, cr, y1);
+		pY[0] = T(Dn<B>(y0));  pY[1] = T(Dn<B>(y1));
+		if (pCb)
+			{*pCb++ = T(Dn<B>(cb));  *pCr++ = T(Dn<B>(cr));}
+	}
+}
+
+
+//	2-plane 8-bit 4:2:2 & 4:2:0 (NV16/NV12-style interleaved CbCr plane)
+static void Unpack_PL2_8 (const UByte * const * pPlanes, const ULWord inFirstPixel, const ULWord inNumPixels, UWord * pOut)
+{
+	const UByte *	pY	(pPlanes[0] + inFirstPixel);
+	const UByte *	pC	(pPlanes[1] + inFirstPixel);
+	for (ULWord px(0);  px < inNumPixels;  px += 2, pY += 2, pC += 2, pOut += 2 * FC_COMPS)
+		Put422 (pOut, Up<8>(pC[0]), Up<8>(pY[0]), Up<8>(pC[1]), Up<8>(pY[1]));
+}
+
+static void Pack_PL2_8 (const UWord * pIn, UByte * const * pPlanes, const ULWord inFirstPixel, const ULWord inNumPixels)
+{
+	UByte *	pY	(pPlanes[0] + inFirstPixel);
+	UByte *	pC	(pPlanes[1] ? pPlanes[1] + inFirstPixel : AJA_NULL);
+	UWord	cb, y0, cr, y1;
+	for (ULWord px(0);  px < inNumPixels;  px += 2, pY += 2, pIn += 2 * FC_COMPS)
+	{
+		Get422 (pIn, cb, y0, cr, y1);
+		pY[0] = UByte(Dn<8>(y0));  pY[1] = UByte(Dn<8>(y1));
+		if (pC)
+			{pC[0] = UByte(Dn<8>(cb));  pC[1] = UByte(Dn<8>(cr));  pC += 2;}
+	}
+}
+
+
+//	2-plane 10-bit 4:2:2 & 4:2:0:  tightly-packed 10-bit samples, 4 samples per 5 bytes (LS bits first)
+static inline void Get10x4 (const UByte * pIn, ULWord * pOutSamples)
+{
+	const ULWord64 v (ULWord64(pIn[0]) | (ULWord64(pIn[1]) << 8) | (ULWord64(pIn[2]) << 16) | (ULWord64(pIn[3]) << 24) | (ULWord64(pIn[4]) << 32));
+	pOutSamples[0] = ULWord(v) & 0x3FF;  pOutSamples[1] = ULWord(v >> 10) & 0x3FF;
+	pOutSamples[2] = ULWord(v >> 20) & 0x3FF;  pOutSamples[3] = ULWord(v >> 30) & 0x3FF;
+}
+
+static inline void Put10x4 (const ULWord * pInSamples, UByte * pOut)
+{
+	const ULWord64 v (ULWord64(pInSamples[0]) | (ULWord64(pInSamples[1]) << 10) | (ULWord64(pInSamples[2]) << 20) | (ULWord64(pInSamples[3]) << 30));
+	pOut[0] = UByte(v);  pOut[1] = UByte(v >> 8);  pOut[2] = UByte(v >> 16);  pOut[3] = UByte(v >> 24);  pOut[4] = UByte(v >> 32);
+}
+
+static void Unpack_PL2_10 (const UByte * const * pPlanes, const ULWord inFirstPixel, const ULWord inNumPixels, UWord * pOut)
+{
+	const UByte *	pY	(pPlanes[0] + inFirstPixel / 4 * 5);
+	const UByte *	pC	(pPlanes[1] + inFirstPixel / 4 * 5);
+	ULWord			y[4], c[4];
+	for (ULWord px(0);  px < inNumPixels;  px += 4, pY += 5, pC += 5, pOut += 4 * FC_COMPS)
+	{
+		Get10x4 (pY, y);  Get10x4 (pC, c);
+		Put422 (pOut,		Up<10>(c[0]), Up<10>(y[0]), Up<10>(c[1]), Up<10>(y[1]));
+		Put422 (pOut + 8,	Up<10>(c[2]), Up<10>(y[2]), Up<10>(c[3]), Up<10>(y[3]));
+	}
+}
+
+static void Pack_PL2_10 (const UWord * pIn, UByte * const * pPlanes, const ULWord inFirstPixel, const ULWord inNumPixels)
+{
+	UByte *	pY	(pPlanes[0] + inFirstPixel / 4 * 5);
+	UByte *	pC	(pPlanes[1] ? pPlanes[1] + inFirstPixel / 4 * 5 : AJA_NULL);
+	ULWord	y[4], c[4];
+	UWord	cb, y0, cr, y1;
+	for (ULWord px(0);  px < inNumPixels;  px += 4, pY += 5, pIn += 4 * FC_COMPS)
+	{
+		Get422 (pIn, cb, y0, cr, y1);
+		y[0] = Dn<10>(y0);  y[1] = Dn<10>(y1);  c[0] = Dn<10>(cb);  c[1] = Dn<10>(cr);
+		Get422 (pIn + 8, cb, y0, cr, y1);
+		y[2] = Dn<10>(y0);  y[3] = Dn<10>(y1);  c[2] = Dn<10>(cb);  c[3] = Dn<10>(cr);
+		Put10x4 (y, pY);
+		if (pC)
+			{Put10x4 (c, pC);  pC += 5;}
+	}
+}
+
+
+//	8-bit RGB byte orders (kA < 0 means no alpha)
+template <NTV2PixelFormat F> struct RGB8Layout;
+template <> struct RGB8Layout<NTV2_FBF_ARGB>		{enum {kBytes = 4, kR = 2, kG = 1, kB = 0, kA = 3};};
+template <> struct RGB8Layout<NTV2_FBF_RGBA>		{enum {kBytes = 4, kR = 1, kG = 2, kB = 3, kA = 0};};
+template <> struct RGB8Layout<NTV2_FBF_ABGR>		{enum {kBytes = 4, kR = 0, kG = 1, kB = 2, kA = 3};};
+template <> struct RGB8Layout<NTV2_FBF_24BIT_RGB>	{enum {kBytes = 3, kR = 0, kG = 1, kB = 2, kA = -1};};
+template <> struct RGB8Layout<NTV2_FBF_24BIT_BGR>	{enum {kBytes = 3, kR = 2, kG = 1, kB = 0, kA = -1};};
+
+template <NTV2PixelFormat F> static void Unpack_RGB8 (const UByte * const * pPlanes, const ULWord inFirstPixel, const ULWord inNumPixels, UWord * pOut)
+{
+	typedef RGB8Layout<F>	L;
+	const UByte *	pSrc (pPlanes[0] + inFirstPixel * L::kBytes);
+	for (ULWord px(0);  px < inNumPixels;  px++, pSrc += L::kBytes, pOut += FC_COMPS)
+	{
+		pOut[0] = Up<8>(pSrc[L::kG]);  pOut[1] = Up<8>(pSrc[L::kB]);  pOut[2] = Up<8>(pSrc[L::kR]);
+		pOut[3] = L::kA < 0 ? UWord(FC_OPAQUE) : Up<8>(pSrc[L::kA < 0 ? 0 : L::kA]);
+	}
+}
+
+template <NTV2PixelFormat F> static void Pack_RGB8 (const UWord * pIn, UByte * const * pPlanes, const ULWord inFirstPixel, const ULWord inNumPixels)
+{
+	typedef RGB8Layout<F>	L;
+	UByte *	pDst (pPlanes[0] + inFirstPixel * L::kBytes);
+	for (ULWord px(0);  px < inNumPixels;  px++, pDst += L::kBytes, pIn += FC_COMPS)
+	{
+		pDst[L::kG] = UByte(Dn<8>(pIn[0]));  pDst[L::kB] = UByte(Dn<8>(pIn[1]));  pDst[L::kR] = UByte(Dn<8>(pIn[2]));
+		if (L::kA >= 0)
+			pDst[L::kA < 0 ? 0 : L::kA] = UByte(Dn<8>(pIn[3]));
+	}
+}
+
+
+//	10-bit RGB:  R 0-9, G 10-19, B 20-29, A 30-31
+static void Unpack_RGB10 (const UByte * const * pPlanes, const ULWord inFirstPixel, const ULWord inNumPixels, UWord * pOut)
+{
+	const ULWord *	pSrc (reinterpret_cast<const ULWord*>(pPlanes[0]) + inFirstPixel);
+	for (ULWord px(0);  px < inNumPixels;  px++, pSrc++, pOut += FC_COMPS)
+	{
+		const ULWord v (*pSrc);
+		pOut[0] = Up<10>((v >> 10) & 0x3FF);  pOut[1] = Up<10>((v >> 20) & 0x3FF);  pOut[2] = Up<10>(v & 0x3FF);
+		pOut[3] = UWord(((v >> 30) & 0x3) * 0x5555);	//	Scale 2-bit alpha to full range
+	}
+}
+
+static void Pack_RGB10 (const UWord * pIn, UByte * const * pPlanes, const ULWord inFirstPixel, const ULWord inNumPixels)
+{
+	ULWord *	pDst (reinterpret_cast<ULWord*>(pPlanes[0]) + inFirstPixel);
+	for (ULWord px(0);  px < inNumPixels;  px++, pDst++, pIn += FC_COMPS)
+		*pDst = Dn<10>(pIn[2]) | (Dn<10>(pIn[0]) << 10) | (Dn<10>(pIn[1]) << 20) | (((ULWord(pIn[3]) * 3 + 0x7FFF) / 0xFFFF) << 30);
+}
+
+
+//	10-bit RGB DPX:  R<<22 | G<<12 | B<<2, big-endian (or little-endian)
+template <bool BE> static void Unpack_DPX (const UByte * const * pPlanes, const ULWord inFirstPixel, const ULWord inNumPixels, UWord * pOut)
+{
+	const ULWord *	pSrc (reinterpret_cast<const ULWord*>(pPlanes[0]) + inFirstPixel);
+	for (ULWord px(0);  px < inNumPixels;  px++, pSrc++, pOut += FC_COMPS)
+	{
+		const ULWord v (BE ? ULWord(NTV2EndianSwap32(*pSrc)) : *pSrc);
+		pOut[0] = Up<10>((v >> 12) & 0x3FF);  pOut[1] = Up<10>((v >> 2) & 0x3FF);  pOut[2] = Up<10>((v >> 22) & 0x3FF);
+		pOut[3] = FC_OPAQUE;
+	}
+}
+
+template <bool BE> static void Pack_DPX (const UWord * pIn, UByte * const * pPlanes, const ULWord inFirstPixel, const ULWord inNumPixels)
+{
+	ULWord *	pDst (reinterpret_cast<ULWord*>(pPlanes[0]) + inFirstPixel);
+	for (ULWord px(0);  px < inNumPixels;  px++, pDst++, pIn += FC_COMPS)
+	{
+		const ULWord v ((Dn<10>(pIn[2]) << 22) | (Dn<10>(pIn[0]) << 12) | (Dn<10>(pIn[1]) << 2));
+		*pDst = BE ? ULWord(NTV2EndianSwap32(v)) : v;
+	}
+}
+
+
+//	10-bit packed RGB:  MS 8 bits of B/G/R in bytes 0/1/2, LS 2 bits of B/G/R in bits 24-25/26-27/28-29
+static void Unpack_RGB10Packed (const UByte * const * pPlanes, const ULWord inFirstPixel, const ULWord inNumPixels, UWord * pOut)
+{
+	const ULWord *	pSrc (reinterpret_cast<const ULWord*>(pPlanes[0]) + inFirstPixel);
+	for (ULWord px(0);  px < inNumPixels;  px++, pSrc++, pOut += FC_COMPS)
+	{
+		const ULWord v (*pSrc);
+		pOut[0] = Up<10>((((v >>  8) & 0xFF) << 2) | ((v >> 26) & 0x3));
+		pOut[1] = Up<10>((((v      ) & 0xFF) << 2) | ((v >> 24) & 0x3));
+		pOut[2] = Up<10>((((v >> 16) & 0xFF) << 2) | ((v >> 28) & 0x3));
+		pOut[3] = FC_OPAQUE;
+	}
+}
+
+static void Pack_RGB10Packed (const UWord * pIn, UByte * const * pPlanes, const ULWord inFirstPixel, const ULWord inNumPixels)
+{
+	ULWord *	pDst (reinterpret_cast<ULWord*>(pPlanes[0]) + inFirstPixel);
+	for (ULWord px(0);  px < inNumPixels;  px++, pDst++, pIn += FC_COMPS)
+	{
+		const ULWord g (Dn<10>(pIn[0])), b (Dn<10>(pIn[1])), r (Dn<10>(pIn[2]));
+		*pDst = (b >> 2) | ((g >> 2) << 8) | ((r >> 2) << 16) | ((b & 0x3) << 24) | ((g & 0x3) << 26) | ((r & 0x3) << 28);
+	}
+}
+
+
+//	10-bit ARGB:  5 bytes per pixel, B 0-9, G 10-19, R 20-29, A 30-39 (LS bits first)
+static void Unpack_ARGB10 (const UByte * const * pPlanes, const ULWord inFirstPixel, const ULWord inNumPixels, UWord * pOut)
+{
+	const UByte *	pSrc (pPlanes[0] + inFirstPixel * 5);
+	ULWord			s[4];
+	for (ULWord px(0);  px < inNumPixels;  px++, pSrc += 5, pOut += FC_COMPS)
+	{
+		Get10x4 (pSrc, s);
+		pOut[0] = Up<10>(s[1]);  pOut[1] = Up<10>(s[0]);  pOut[2] = Up<10>(s[2]);  pOut[3] = Up<10>(s[3]);
+	}
+}
+
+static void Pack_ARGB10 (const UWord * pIn, UByte * const * pPlanes, const ULWord inFirstPixel, const ULWord inNumPixels)
+{
+	UByte *	pDst (pPlanes[0] + inFirstPixel * 5);
+	ULWord	s[4];
+	for (ULWord px(0);  px < inNumPixels;  px++, pDst += 5, pIn += FC_COMPS)
+	{
+		s[0] = Dn<10>(pIn[1]);  s[1] = Dn<10>(pIn[0]);  s[2] = Dn<10>(pIn[2]);  s[3] = Dn<10>(pIn[3]);
+		Put10x4 (s, pDst);
+	}
+}
+
+
+//	48-bit RGB (R, G, B) and 64-bit ARGB (B, G, R, A) -- 16-bit little-endian components
+static void Unpack_RGB48 (const UByte * const * pPlanes, const ULWord inFirstPixel, const ULWord inNumPixels, UWord * pOut)
+{
+	const UWord *	pSrc (reinterpret_cast<const UWord*>(pPlanes[0]) + inFirstPixel * 3);
+	for (ULWord px(0);  px < inNumPixels;  px++, pSrc += 3, pOut += FC_COMPS)
+		{pOut[0] = pSrc[1];  pOut[1] = pSrc[2];  pOut[2] = pSrc[0];  pOut[3] = FC_OPAQUE;}
+}
+
+static void Pack_RGB48 (const UWord * pIn, UByte * const * pPlanes, const ULWord inFirstPixel, const ULWord inNumPixels)
+{
+	UWord *	pDst (reinterpret_cast<UWord*>(pPlanes[0]) + inFirstPixel * 3);
+	for (ULWord px(0);  px < inNumPixels;  px++, pDst += 3, pIn += FC_COMPS)
+		{pDst[0] = pIn[2];  pDst[1] = pIn[0];  pDst[2] = pIn[1];}
+}
+
+static void Unpack_ARGB16 (const UByte * const * pPlanes, const ULWord inFirstPixel, const ULWord inNumPixels, UWord * pOut)
+{
+	const UWord *	pSrc (reinterpret_cast<const UWord*>(pPlanes[0]) + inFirstPixel * 4);
+	for (ULWord px(0);  px < inNumPixels;  px++, pSrc += 4, pOut += FC_COMPS)
+		{pOut[0] = pSrc[1];  pOut[1] = pSrc[0];  pOut[2] = pSrc[2];  pOut[3] = pSrc[3];}
+}
+
+static void Pack_ARGB16 (const UWord * pIn, UByte * const * pPlanes, const ULWord inFirstPixel, const ULWord inNumPixels)
+{
+	UWord *	pDst (reinterpret_cast<UWord*>(pPlanes[0]) + inFirstPixel * 4);
+	for (ULWord px(0);  px < inNumPixels;  px++, pDst += 4, pIn += FC_COMPS)
+		{pDst[0] = pIn[1];  pDst[1] = pIn[0];  pDst[2] = pIn[2];  pDst[3] = pIn[3];}
+}
+
+
+//	12-bit packed RGB:  2 pixels per 9 bytes, big-endian bit order R0 G0 B0 R1 G1 B1
+static void Unpack_RGB12Packed (const UByte * const * pPlanes, const ULWord inFirstPixel, const ULWord inNumPixels, UWord * pOut)
+{
+	const UByte *	p (pPlanes[0] + inFirstPixel / 2 * 9);
+	for (ULWord px(0);  px < inNumPixels;  px += 2, p += 9, pOut += 2 * FC_COMPS)
+	{
+		pOut[2] = Up<12>((ULWord(p[0]) << 4) | (p[1] >> 4));
+		pOut[0] = Up<12>((ULWord(p[1] & 0xF) << 8) | p[2]);
+		pOut[1] = Up<12>((ULWord(p[3]) << 4) | (p[4] >> 4));
+		pOut[6] = Up<12>((ULWord(p[4] & 0xF) << 8) | p[5]);
+		pOut[4] = Up<12>((ULWord(p[6]) << 4) | (p[7] >> 4));
+		pOut[5] = Up<12>((ULWord(p[7] & 0xF) << 8) | p[8]);
+		pOut[3] = pOut[7] = FC_OPAQUE;
+	}
+}
+
+static void Pack_RGB12Packed (const UWord * pIn, UByte * const * pPlanes, const ULWord inFirstPixel, const ULWord inNumPixels)
+{
+	UByte *	p (pPlanes[0] + inFirstPixel / 2 * 9);
+	for (ULWord px(0);  px < inNumPixels;  px += 2, p += 9, pIn += 2 * FC_COMPS)
+	{
+		const ULWord r0 (Dn<12>(pIn[2])), g0 (Dn<12>(pIn[0])), b0 (Dn<12>(pIn[1]));
+		const ULWord r1 (Dn<12>(pIn[6])), g1 (Dn<12>(pIn[4])), b1 (Dn<12>(pIn[5]));
+		p[0] = UByte(r0 >> 4);  p[1] = UByte(((r0 & 0xF) << 4) | (g0 >> 8));  p[2] = UByte(g0);
+		p[3] = UByte(b0 >> 4);  p[4] = UByte(((b0 & 0xF) << 4) | (r1 >> 8));  p[5] = UByte(r1);
+		p[6] = UByte(g1 >> 4);  p[7] = UByte(((g1 & 0xF) << 4) | (b1 >> 8));  p[8] = UByte(b1);
+	}
+}
+
+
+//////////////////////////////////////////////////////////////////////////////////////////////////////
+//	Pixel format table
+//////////////////////////////////////////////////////////////////////////////////////////////////////
+
+typedef struct FrameConvFormatInfo
+{
+	NTV2PixelFormat	fFormat;		///< @brief	The pixel format
+	bool			fIsYUV;			///< @brief	YCbCr (or RGB)?
+	ULWord			fGroupPixels;	///< @brief	Pixels per packing group
+	ULWord			fGroupBytes;	///< @brief	Bytes per packing group in plane 0
+	ULWord			fChromaVRatio;	///< @brief	2 for 4:2:0, otherwise 1
+	UnpackFunc		fUnpack;		///< @brief	Unpacks to the intermediate
+	PackFunc		fPack;			///< @brief	Packs from the intermediate
+} FrameConvFormatInfo;
+
+static const FrameConvFormatInfo sFormatInfos[] =
+{
+	{NTV2_FBF_10BIT_YCBCR,				true,	6,	16,	1,	Unpack_v210<false>,				Pack_v210<false>},
+	{NTV2_FBF_8BIT_YCBCR,				true,	2,	4,	1,	Unpack_422_8<0,1,2,3>,			Pack_422_8<0,1,2,3>},
+	{NTV2_FBF_ARGB,						false,	1,	4,	1,	Unpack_RGB8<NTV2_FBF_ARGB>,		Pack_RGB8<NTV2_FBF_ARGB>},
+	{NTV2_FBF_RGBA,						false,	1,	4,	1,	Unpack_RGB8<NTV2_FBF_RGBA>,		Pack_RGB8<NTV2_FBF_RGBA>},
+	{NTV2_FBF_10BIT_RGB,				false,	1,	4,	1,	Unpack_RGB10,					Pack_RGB10},
+	{NTV2_FBF_8BIT_YCBCR_YUY2,			true,	2,	4,	1,	Unpack_422_8<1,0,3,2>,			Pack_422_8<1,0,3,2>},
+	{NTV2_FBF_ABGR,						false,	1,	4,	1,	Unpack_RGB8<NTV2_FBF_ABGR>,		Pack_RGB8<NTV2_FBF_ABGR>},
+	{NTV2_FBF_10BIT_DPX,				false,	1,	4,	1,	Unpack_DPX<true>,				Pack_DPX<true>},
+	{NTV2_FBF_10BIT_YCBCR_DPX,			true,	6,	16,	1,	Unpack_v210<true>,				Pack_v210<true>},
+	{NTV2_FBF_8BIT_YCBCR_420PL3,		true,	2,	2,	2,	Unpack_PL3<UByte,8>,			Pack_PL3<UByte,8>},
+	{NTV2_FBF_24BIT_RGB,				false,	1,	3,	1,	Unpack_RGB8<NTV2_FBF_24BIT_RGB>,	Pack_RGB8<NTV2_FBF_24BIT_RGB>},
+	{NTV2_FBF_24BIT_BGR,				false,	1,	3,	1,	Unpack_RGB8<NTV2_FBF_24BIT_BGR>,	Pack_RGB8<NTV2_FBF_24BIT_BGR>},
+	{NTV2_FBF_10BIT_YCBCRA,				true,	2,	8,	1,	Unpack_YCbCrA,					Pack_YCbCrA},
+	{NTV2_FBF_10BIT_DPX_LE,				false,	1,	4,	1,	Unpack_DPX<false>,				Pack_DPX<false>},
+	{NTV2_FBF_48BIT_RGB,				false,	1,	6,	1,	Unpack_RGB48,					Pack_RGB48},
+	{NTV2_FBF_12BIT_RGB_PACKED,			false,	2,	9,	1,	Unpack_RGB12Packed,				Pack_RGB12Packed},
+	{NTV2_FBF_10BIT_RGB_PACKED,			false,	1,	4,	1,	Unpack_RGB10Packed,				Pack_RGB10Packed},
+	{NTV2_FBF_10BIT_ARGB,				false,	1,	5,	1,	Unpack_ARGB10,					Pack_ARGB10},
+	{NTV2_FBF_16BIT_ARGB,				false,	1,	8,	1,	Unpack_ARGB16,					Pack_ARGB16},
+	{NTV2_FBF_8BIT_YCBCR_422PL3,		true,	2,	2,	1,	Unpack_PL3<UByte,8>,			Pack_PL3<UByte,8>},
+	{NTV2_FBF_10BIT_YCBCR_420PL3_LE,	true,	2,	4,	2,	Unpack_PL3<UWord,10>,			Pack_PL3<UWord,10>},
+	{NTV2_FBF_10BIT_YCBCR_422PL3_LE,	true,	2,	4,	1,	Unpack_PL3<UWord,10>,			Pack_PL3<UWord,10>},
+	{NTV2_FBF_10BIT_YCBCR_420PL2,		true,	4,	5,	2,	Unpack_PL2_10,					Pack_PL2_10},
+	{NTV2_FBF_10BIT_YCBCR_422PL2,		true,	4,	5,	1,	Unpack_PL2_10,					Pack_PL2_10},
+	{NTV2_FBF_8BIT_YCBCR_420PL2,		true,	2,	2,	2,	Unpack_PL2_8,					Pack_PL2_8},
+	{NTV2_FBF_8BIT_YCBCR_422PL2,		true,	2,	2,	1,	Unpack_PL2_8,					Pack_PL2_8}
+};
+
+static const FrameConvFormatInfo * GetFormatInfo (const NTV2PixelFormat inFormat)
+{
+	for (size_t ndx(0);  ndx < sizeof(sFormatInfos) / sizeof(sFormatInfos[0]);  ndx++)
+		if (sFormatInfos[ndx].fFormat == inFormat)
+			return &sFormatInfos[ndx];
+	return AJA_NULL;
+}
+
+
+//////////////////////////////////////////////////////////////////////////////////////////////////////
+//	Fast paths -- direct line converters
+//////////////////////////////////////////////////////////////////////////////////////////////////////
+
+typedef void (*LineFunc) (const void * pInSrc, void * pOutDst, const ULWord inNumPixels);
+
+template <NTV2PixelFormat S, NTV2PixelFormat D> static void Fast_RGB8 (const void * pInSrc, void * pOutDst, const ULWord inNumPixels)
+{
+	typedef RGB8Layout<S>	SL;
+	typedef RGB8Layout<D>	DL;
+	const UByte *	pSrc (reinterpret_cast<const UByte*>(pInSrc));
+	UByte *			pDst (reinterpret_cast<UByte*>(pOutDst));
+	for (ULWord px(0);  px < inNumPixels;  px++, pSrc += SL::kBytes, pDst += DL::kBytes)
+	{
+		pDst[DL::kR] = pSrc[SL::kR];  pDst[DL::kG] = pSrc[SL::kG];  pDst[DL::kB] = pSrc[SL::kB];
+		if (DL::kA >= 0)
+			pDst[DL::kA < 0 ? 0 : DL::kA] = SL::kA < 0 ? UByte(0xFF) : pSrc[SL::kA < 0 ? 0 : SL::kA];
+	}
+}
+
+static void Fast_2vuy_to_v210 (const void * pInSrc, void * pOutDst, const ULWord inNumPixels)
+{
+	ConvertLine_2vuy_to_v210 (reinterpret_cast<const UByte*>(pInSrc), reinterpret_cast<ULWord*>(pOutDst), inNumPixels);
+}
+
+static void Fast_v210_to_2vuy (const void * pInSrc, void * pOutDst, const ULWord inNumPixels)
+{
+	ConvertLine_v210_to_2vuy (reinterpret_cast<const ULWord*>(pInSrc), reinterpret_cast<UByte*>(pOutDst), inNumPixels);
+}
+
+//	'2vuy' <==> YUY2 is the same byte swap in either direction
+static void Fast_Swap422_8 (const void * pInSrc, void * pOutDst, const ULWord inNumPixels)
+{
+	const UWord *	pSrc (reinterpret_cast<const UWord*>(pInSrc));
+	UWord *			pDst (reinterpret_cast<UWord*>(pOutDst));
+	ULWord			ndx (0);
+#if defined(NTV2_FRAMECONV_SSE2)
+	for (;  ndx + 8 <= inNumPixels;  ndx += 8)
+	{
+		const __m128i	v (_mm_loadu_si128(reinterpret_cast<const __m128i*>(pSrc + ndx)));
+		_mm_storeu_si128 (reinterpret_cast<__m128i*>(pDst + ndx), _mm_or_si128(_mm_slli_epi16(v, 8), _mm_srli_epi16(v, 8)));
+	}
+#endif	//	NTV2_FRAMECONV_SSE2
+	for (;  ndx < inNumPixels;  ndx++)
+		pDst[ndx] = UWord(NTV2EndianSwap16(pSrc[ndx]));
+}
+
+static void Fast_ABGR_to_10bitRGB (const void * pInSrc, void * pOutDst, const ULWord inNumPixels)
+{
+	ConvertLine_8bitABGR_to_10bitABGR (reinterpret_cast<const UByte*>(pInSrc), reinterpret_cast<ULWord*>(pOutDst), inNumPixels);
+}
+
+static void Fast_ABGR_to_10bitDPX (const void * pInSrc, void * pOutDst, const ULWord inNumPixels)
+{
+	ConvertLine_8bitABGR_to_10bitRGBDPX (reinterpret_cast<const UByte*>(pInSrc), reinterpret_cast<ULWord*>(pOutDst), inNumPixels);
+}
+
+static void Fast_ABGR_to_10bitDPXLE (const void * pInSrc, void * pOutDst, const ULWord inNumPixels)
+{
+	ConvertLine_8bitABGR_to_10bitRGBDPXLE (reinterpret_cast<const UByte*>(pInSrc), reinterpret_cast<ULWord*>(pOutDst), inNumPixels);
+}
+
+static void Fast_ABGR_to_24bitRGB (const void * pInSrc, void * pOutDst, const ULWord inNumPixels)
+{
+	ConvertLine_8bitABGR_to_24bitRGB (reinterpret_cast<const UByte*>(pInSrc), reinterpret_cast<UByte*>(pOutDst), inNumPixels);
+}
+
+static void Fast_ABGR_to_24bitBGR (const void * pInSrc, void * pOutDst, const ULWord inNumPixels)
+{
+	ConvertLine_8bitABGR_to_24bitBGR (reinterpret_cast<const UByte*>(pInSrc), reinterpret_cast<UByte*>(pOutDst), inNumPixels);
+}
+
+#define	FC_RGB8_PAIR(__s__,__d__)	if (inSrc == __s__ && inDst == __d__)	return Fast_RGB8<__s__,__d__>;
+
+static LineFunc GetFastLineFunc (const NTV2PixelFormat inSrc, const NTV2PixelFormat inDst)
+{
+	if (inSrc == NTV2_FBF_8BIT_YCBCR)
+	{
+		if (inDst == NTV2_FBF_10BIT_YCBCR)		return Fast_2vuy_to_v210;
+		if (inDst == NTV2_FBF_8BIT_YCBCR_YUY2)	return Fast_Swap422_8;
+	}
+	if (inSrc == NTV2_FBF_10BIT_YCBCR  &&  inDst == NTV2_FBF_8BIT_YCBCR)		return Fast_v210_to_2vuy;
+	if (inSrc == NTV2_FBF_8BIT_YCBCR_YUY2  &&  inDst == NTV2_FBF_8BIT_YCBCR)	return Fast_Swap422_8;
+	if (inSrc == NTV2_FBF_ABGR)
+	{
+		if (inDst == NTV2_FBF_10BIT_RGB)		return Fast_ABGR_to_10bitRGB;
+		if (inDst == NTV2_FBF_10BIT_DPX)		return Fast_ABGR_to_10bitDPX;
+		if (inDst == NTV2_FBF_10BIT_DPX_LE)		return Fast_ABGR_to_10bitDPXLE;
+		if (inDst == NTV2_FBF_24BIT_RGB)		return Fast_ABGR_to_24bitRGB;
+		if (inDst == NTV2_FBF_24BIT_BGR)		return Fast_ABGR_to_24bitBGR;
+	}
+	FC_RGB8_PAIR(NTV2_FBF_ARGB,			NTV2_FBF_RGBA)
+	FC_RGB8_PAIR(NTV2_FBF_ARGB,			NTV2_FBF_ABGR)
+	FC_RGB8_PAIR(NTV2_FBF_ARGB,			NTV2_FBF_24BIT_RGB)
+	FC_RGB8_PAIR(NTV2_FBF_ARGB,			NTV2_FBF_24BIT_BGR)
+	FC_RGB8_PAIR(NTV2_FBF_RGBA,			NTV2_FBF_ARGB)
+	FC_RGB8_PAIR(NTV2_FBF_RGBA,			NTV2_FBF_ABGR)
+	FC_RGB8_PAIR(NTV2_FBF_RGBA,			NTV2_FBF_24BIT_RGB)
+	FC_RGB8_PAIR(NTV2_FBF_RGBA,			NTV2_FBF_24BIT_BGR)
+	FC_RGB8_PAIR(NTV2_FBF_ABGR,			NTV2_FBF_ARGB)
+	FC_RGB8_PAIR(NTV2_FBF_ABGR,			NTV2_FBF_RGBA)
+	FC_RGB8_PAIR(NTV2_FBF_24BIT_RGB,	NTV2_FBF_ARGB)
+	FC_RGB8_PAIR(NTV2_FBF_24BIT_RGB,	NTV2_FBF_RGBA)
+	FC_RGB8_PAIR(NTV2_FBF_24BIT_RGB,	NTV2_FBF_ABGR)
+	FC_RGB8_PAIR(NTV2_FBF_24BIT_RGB,	NTV2_FBF_24BIT_BGR)
+	FC_RGB8_PAIR(NTV2_FBF_24BIT_BGR,	NTV2_FBF_ARGB)
+	FC_RGB8_PAIR(NTV2_FBF_24BIT_BGR,	NTV2_FBF_RGBA)
+	FC_RGB8_PAIR(NTV2_FBF_24BIT_BGR,	NTV2_FBF_ABGR)
+	FC_RGB8_PAIR(NTV2_FBF_24BIT_BGR,	NTV2_FBF_24BIT_RGB)
+	return AJA_NULL;
+}
+
+//	Row-pair fast paths, for 4:2:0 destinations (the chroma of each row pair is averaged into one chroma row)
+typedef void (*PairFunc) (const void * pInSrc0, const void * pInSrc1, void * pOutY0, void * pOutY1, void * pOutC, const ULWord inNumPixels);
+
+//	8-bit packed 4:2:2 ('2vuy' if LUMA is 1, YUY2 if LUMA is 0) => 8-bit 2-plane 4:2:0 (NV12)
+template <unsigned LUMA> static void Fast_422_8_to_PL2_8 (const void * pInSrc0, const void * pInSrc1, void * pOutY0, void * pOutY1, void * pOutC, const ULWord inNumPixels)
+{
+	const UByte *	pSrc0 (reinterpret_cast<const UByte*>(pInSrc0));
+	const UByte *	pSrc1 (reinterpret_cast<const UByte*>(pInSrc1));
+	UByte *			pY0 (reinterpret_cast<UByte*>(pOutY0));
+	UByte *			pY1 (reinterpret_cast<UByte*>(pOutY1));
+	UByte *			pC (reinterpret_cast<UByte*>(pOutC));
+	const ULWord	numPixels (RoundUp(inNumPixels, 2));
+	ULWord			px (0);
+#if defined(NTV2_FRAMECONV_SSE2)
+	const __m128i	lowBytes (_mm_set1_epi16(0x00FF));
+	for (;  px + 16 <= numPixels;  px += 16)
+	{	//	16 pixels (32 bytes) from each row per iteration
+		const __m128i	a0 (_mm_loadu_si128(reinterpret_cast<const __m128i*>(pSrc0 + px * 2)));
+		const __m128i	b0 (_mm_loadu_si128(reinterpret_cast<const __m128i*>(pSrc0 + px * 2 + 16)));
+		const __m128i	a1 (_mm_loadu_si128(reinterpret_cast<const __m128i*>(pSrc1 + px * 2)));
+		const __m128i	b1 (_mm_loadu_si128(reinterpret_cast<const __m128i*>(pSrc1 + px * 2 + 16)));
+		__m128i	y0, y1, c0, c1;
+		if (LUMA)
+		{
+			y0 = _mm_packus_epi16(_mm_srli_epi16(a0, 8), _mm_srli_epi16(b0, 8));
+			y1 = _mm_packus_epi16(_mm_srli_epi16(a1, 8), _mm_srli_epi16(b1, 8));
+			c0 = _mm_packus_epi16(_mm_and_si128(a0, lowBytes), _mm_and_si128(b0, lowBytes));
+			c1 = _mm_packus_epi16(_mm_and_si128(a1, lowBytes), _mm_and_si128(b1, lowBytes));
+		}
+		else
+		{
+			y0 = _mm_packus_epi16(_mm_and_si128(a0, lowBytes), _mm_and_si128(b0, lowBytes));
+			y1 = _mm_packus_epi16(_mm_and_si128(a1, lowBytes), _mm_and_si128(b1, lowBytes));
+			c0 = _mm_packus_epi16(_mm_srli_epi16(a0, 8), _mm_srli_epi16(b0, 8));
+			c1 = _mm_packus_epi16(_mm_srli_epi16(a1, 8), _mm_srli_epi16(b1, 8));
+		}
+		_mm_storeu_si128 (reinterpret_cast<__m128i*>(pY0 + px), y0);
+		_mm_storeu_si128 (reinterpret_cast<__m128i*>(pY1 + px), y1);
+		_mm_storeu_si128 (reinterpret_cast<__m128i*>(pC + px), _mm_avg_epu8(c0, c1));	//	(c0 + c1 + 1) >> 1
+	}
+#endif	//	NTV2_FRAMECONV_SSE2
+	for (;  px < numPixels;  px++)
+	{
+		pY0[px] = pSrc0[px * 2 + LUMA];
+		pY1[px] = pSrc1[px * 2 + LUMA];
+		pC[px] = UByte((ULWord(pSrc0[px * 2 + 1 - LUMA]) + ULWord(pSrc1[px * 2 + 1 - LUMA]) + 1) >> 1);
+	}
+}
+
+static PairFunc GetFastPairFunc (const NTV2PixelFormat inSrc, const NTV2PixelFormat inDst)
+{
+	if (inDst == NTV2_FBF_8BIT_YCBCR_420PL2)
+	{
+		if (inSrc == NTV2_FBF_8BIT_YCBCR)		return Fast_422_8_to_PL2_8<1>;
+		if (inSrc == NTV2_FBF_8BIT_YCBCR_YUY2)	return Fast_422_8_to_PL2_8<0>;
+	}
+	return AJA_NULL;
+}
+
+
+//////////////////////////////////////////////////////////////////////////////////////////////////////
+//	Frame conversion job
+//////////////////////////////////////////////////////////////////////////////////////////////////////
+
+typedef struct FrameConvJob
+{
+	const FrameConvFormatInfo *	fSrcInfo;
+	const FrameConvFormatInfo *	fDstInfo;
+	const NTV2FormatDescriptor *	fSrcDesc;
+	const NTV2FormatDescriptor *	fDstDesc;
+	const UByte *				fSrcBase;
+	UByte *						fDstBase;
+	ULWord						fSrcFirstRow;	///< @brief	Source row that maps to row 0
+	ULWord						fDstFirstRow;	///< @brief	Destination row that maps to row 0
+	ULWord						fWidth;			///< @brief	Pixels per row
+	LineFunc					fFastLine;		///< @brief	Fast path line converter, if any
+	PairFunc					fFastPair;		///< @brief	Fast path row pair converter, if any
+	bool						fCopy;			///< @brief	Same pixel format?
+	bool						fUseCSC;		///< @brief	Need YCbCr <==> RGB?
+	NTV2HostCSC					fCSC;			///< @brief	YCbCr <==> RGB matrix (16-bit intermediate)
+	UWord *						fScratch;		///< @brief	2 tiles per worker
+} FrameConvJob;
+
+static void GetSrcPlanes (const FrameConvJob & inJob, const ULWord inRow, const UByte ** pOutPlanes)
+{
+	const ULWord row (inJob.fSrcFirstRow + inRow);
+	for (UWord plane(0);  plane < 3;  plane++)
+		pOutPlanes[plane] = plane < inJob.fSrcDesc->GetNumPlanes()
+							? reinterpret_cast<const UByte*>(inJob.fSrcDesc->GetRowAddress(inJob.fSrcBase, row / inJob.fSrcDesc->GetVerticalSampleRatio(plane), plane))
+							: AJA_NULL;
+}
+
+static void GetDstPlanes (const FrameConvJob & inJob, const ULWord inRow, const bool inWithChroma, UByte ** pOutPlanes)
+{
+	const ULWord row (inJob.fDstFirstRow + inRow);
+	for (UWord plane(0);  plane < 3;  plane++)
+		pOutPlanes[plane] = plane < inJob.fDstDesc->GetNumPlanes()  &&  (plane == 0 || inWithChroma)
+							? reinterpret_cast<UByte*>(inJob.fDstDesc->GetWriteableRowAddress(inJob.fDstBase, row / inJob.fDstDesc->GetVerticalSampleRatio(plane), plane))
+							: AJA_NULL;
+}
+
+//	Unpacks one tile of a row, replicating the last pixel into any padding the destination packer needs
+static void UnpackTile (const FrameConvJob & inJob, const UByte * const * pPlanes, const ULWord inX, const ULWord inNumPixels, UWord * pTile)
+{
+	const ULWord	srcPixels (RoundUp(inNumPixels, inJob.fSrcInfo->fGroupPixels));
+	const ULWord	dstPixels (RoundUp(inNumPixels, inJob.fDstInfo->fGroupPixels));
+	inJob.fSrcInfo->fUnpack (pPlanes, inX, srcPixels, pTile);
+	for (ULWord px(inNumPixels);  px < dstPixels;  px++)
+		::memcpy (pTile + px * FC_COMPS, pTile + (inNumPixels - 1) * FC_COMPS, FC_COMPS * sizeof(UWord));
+	if (inJob.fUseCSC)
+		inJob.fCSC.ConvertLine (pTile, pTile, inNumPixels, 16);
+}
+
+static void ConvertRowRange (void * pInContext, const ULWord inWorkerIndex, const ULWord inFirstRow, const ULWord inNumRows)
+{
+	const FrameConvJob &	job (*reinterpret_cast<const FrameConvJob*>(pInContext));
+	const ULWord			lastRow (inFirstRow + inNumRows);
+	const UByte *			pSrcPlanes[3];
+	UByte *					pDstPlanes[3];
+
+	if (job.fCopy)
+	{
+		for (ULWord row(inFirstRow);  row < lastRow;  row++)
+			for (UWord plane(0);  plane < job.fDstDesc->GetNumPlanes();  plane++)
+			{
+				const ULWord vRatio (job.fDstDesc->GetVerticalSampleRatio(plane));
+				if ((job.fDstFirstRow + row) % vRatio)
+					continue;	//	Chroma row already copied
+				const ULWord srcBPR (job.fSrcDesc->GetBytesPerRow(plane)),  dstBPR (job.fDstDesc->GetBytesPerRow(plane));
+				::memcpy (job.fDstDesc->GetWriteableRowAddress(job.fDstBase, (job.fDstFirstRow + row) / vRatio, plane),
+						  job.fSrcDesc->GetRowAddress(job.fSrcBase, (job.fSrcFirstRow + row) / vRatio, plane),
+						  srcBPR < dstBPR ? srcBPR : dstBPR);
+			}
+		return;
+	}
+
+	if (job.fFastLine)
+	{
+		for (ULWord row(inFirstRow);  row < lastRow;  row++)
+			job.fFastLine (job.fSrcDesc->GetRowAddress(job.fSrcBase, job.fSrcFirstRow + row),
+							job.fDstDesc->GetWriteableRowAddress(job.fDstBase, job.fDstFirstRow + row),
+							job.fWidth);
+		return;
+	}
+
+	if (job.fFastPair)
+	{	//	Row pairs share one chroma row (an unpaired last row is paired with itself)
+		for (ULWord row(inFirstRow);  row < lastRow;  row += 2)
+		{
+			const ULWord	dstRow (job.fDstFirstRow + row),  nextRow (row + 1 < lastRow ? row + 1 : row);
+			job.fFastPair (job.fSrcDesc->GetRowAddress(job.fSrcBase, job.fSrcFirstRow + row),
+							job.fSrcDesc->GetRowAddress(job.fSrcBase, job.fSrcFirstRow + nextRow),
+							job.fDstDesc->GetWriteableRowAddress(job.fDstBase, dstRow, 0),
+							job.fDstDesc->GetWriteableRowAddress(job.fDstBase, job.fDstFirstRow + nextRow, 0),
+							job.fDstDesc->GetWriteableRowAddress(job.fDstBase, dstRow / 2, 1),
+							job.fWidth);
+		}
+		return;
+	}
+
+	UWord *	pTile0 (job.fScratch + inWorkerIndex * 2 * NTV2FrameConverter::kTilePixels * FC_COMPS);
+	UWord *	pTile1 (pTile0 + NTV2FrameConverter::kTilePixels * FC_COMPS);
+	const ULWord	rowStep (job.fDstInfo->fChromaVRatio);	//	4:2:0 output converts row pairs
+	for (ULWord row(inFirstRow);  row < lastRow;  row += rowStep)
+	{
+		const bool	pair (rowStep == 2  &&  row + 1 < lastRow);
+		for (ULWord x(0);  x < job.fWidth;  x += NTV2FrameConverter::kTilePixels)
+		{
+			const ULWord	numPixels (job.fWidth - x < NTV2FrameConverter::kTilePixels ? job.fWidth - x : NTV2FrameConverter::kTilePixels);
+			const ULWord	dstPixels (RoundUp(numPixels, job.fDstInfo->fGroupPixels));
+			GetSrcPlanes (job, row, pSrcPlanes);
+			UnpackTile (job, pSrcPlanes, x, numPixels, pTile0);
+			if (pair)
+			{
+				GetSrcPlanes (job, row + 1, pSrcPlanes);
+				UnpackTile (job, pSrcPlanes, x, numPixels, pTile1);
+				for (ULWord px(0);  px < dstPixels;  px++)
+				{	//	Vertical chroma average
+					UWord * p0 (pTile0 + px * FC_COMPS),  * p1 (pTile1 + px * FC_COMPS);
+					p0[1] = UWord((ULWord(p0[1]) + ULWord(p1[1]) + 1) >> 1);
+					p0[2] = UWord((ULWord(p0[2]) + ULWord(p1[2]) + 1) >> 1);
+				}
+			}
+			GetDstPlanes (job, row, true, pDstPlanes);
+			job.fDstInfo->fPack (pTile0, pDstPlanes, x, dstPixels);
+			if (pair)
+			{
+				GetDstPlanes (job, row + 1, false, pDstPlanes);
+				job.fDstInfo->fPack (pTile1, pDstPlanes, x, dstPixels);
+			}
+		}
+	}
+}	//	ConvertRowRange
+
+
+//////////////////////////////////////////////////////////////////////////////////////////////////////
+//	NTV2FrameConverter
+//////////////////////////////////////////////////////////////////////////////////////////////////////
+
+bool NTV2FrameConverter::IsSupportedPixelFormat (const NTV2PixelFormat inPixelFormat)
+{
+	return GetFormatInfo(inPixelFormat) != AJA_NULL;
+}
+
+NTV2PixelFormats NTV2FrameConverter::GetSupportedPixelFormats (void)
+{
+	NTV2PixelFormats	result;
+	for (size_t ndx(0);  ndx < sizeof(sFormatInfos) / sizeof(sFormatInfos[0]);  ndx++)
+		result.insert(sFormatInfos[ndx].fFormat);
+	return result;
+}
+
+bool NTV2FrameConverter::CanConvert (const NTV2PixelFormat inSrcPixelFormat, const NTV2PixelFormat inDstPixelFormat)
+{
+	return IsSupportedPixelFormat(inSrcPixelFormat)  &&  IsSupportedPixelFormat(inDstPixelFormat);
+}
+
+bool NTV2FrameConverter::HasFastPath (const NTV2PixelFormat inSrcPixelFormat, const NTV2PixelFormat inDstPixelFormat)
+{
+	if (!CanConvert(inSrcPixelFormat, inDstPixelFormat))
+		return false;
+	return inSrcPixelFormat == inDstPixelFormat  ||  GetFastLineFunc(inSrcPixelFormat, inDstPixelFormat) != AJA_NULL
+			||  GetFastPairFunc(inSrcPixelFormat, inDstPixelFormat) != AJA_NULL;
+}
+
+ULWord NTV2FrameConverter::GetPixelGroupSize (const NTV2PixelFormat inPixelFormat)
+{
+	const FrameConvFormatInfo *	pInfo (GetFormatInfo(inPixelFormat));
+	return pInfo ? pInfo->fGroupPixels : 0;
+}
+
+//	Validates a row span for UnpackPixels/PackPixels, returning its pixel format info
+static const FrameConvFormatInfo * GetSpanInfo (const NTV2FormatDescriptor & inDesc, const ULWord inRow, const ULWord inFirstPixel, const ULWord inNumPixels)
+{
+	const FrameConvFormatInfo *	pInfo (GetFormatInfo(inDesc.GetPixelFormat()));
+	if (!pInfo  ||  !inNumPixels)
+		return AJA_NULL;
+	if (inFirstPixel % pInfo->fGroupPixels  ||  inNumPixels % pInfo->fGroupPixels)
+		return AJA_NULL;	//	Must be whole packing groups
+	if (inRow >= inDesc.GetFullRasterHeight())
+		return AJA_NULL;	//	Bad row
+	if ((inFirstPixel + inNumPixels) / pInfo->fGroupPixels * pInfo->fGroupBytes > inDesc.GetBytesPerRow(0))
+		return AJA_NULL;	//	Span exceeds row
+	return pInfo;
+}
+
+bool NTV2FrameConverter::UnpackPixels (const void * pInRaster, const NTV2FormatDescriptor & inDesc, const ULWord inRow,
+										const ULWord inFirstPixel, const ULWord inNumPixels, UWord * pOutPixels)
+{
+	const FrameConvFormatInfo *	pInfo (GetSpanInfo(inDesc, inRow, inFirstPixel, inNumPixels));
+	if (!pInfo  ||  !pInRaster  ||  !pOutPixels)
+		return false;
+	const UByte *	pPlanes[3];
+	for (UWord plane(0);  plane < 3;  plane++)
+		pPlanes[plane] = plane < inDesc.GetNumPlanes()
+						? reinterpret_cast<const UByte*>(inDesc.GetRowAddress(pInRaster, inRow / inDesc.GetVerticalSampleRatio(plane), plane))
+						: AJA_NULL;
+	pInfo->fUnpack (pPlanes, inFirstPixel, inNumPixels, pOutPixels);
+	return true;
+}
+
+bool NTV2FrameConverter::PackPixels (const UWord * pInPixels, void * pOutRaster, const NTV2FormatDescriptor & inDesc,
+										const ULWord inRow, const ULWord inFirstPixel, const ULWord inNumPixels)
+{
+	const FrameConvFormatInfo *	pInfo (GetSpanInfo(inDesc, inRow, inFirstPixel, inNumPixels));
+	if (!pInfo  ||  !pOutRaster  ||  !pInPixels)
+		return false;
+	UByte *	pPlanes[3];
+	for (UWord plane(0);  plane < 3;  plane++)
+	{
+		const ULWord	vRatio (inDesc.GetVerticalSampleRatio(plane));
+		pPlanes[plane] = plane < inDesc.GetNumPlanes()  &&  (plane == 0 || inRow % vRatio == 0)
+						? reinterpret_cast<UByte*>(inDesc.GetWriteableRowAddress(pOutRaster, inRow / vRatio, plane))
+						: AJA_NULL;
+	}
+	pInfo->fPack (pInPixels, pPlanes, inFirstPixel, inNumPixels);
+	return true;
+}
+
+
+NTV2FrameConverter::NTV2FrameConverter ()
+	:	mMaxThreads		(0),
+		mSMPTERange		(false),
+		mStandard		(NTV2_HOSTCSC_AUTO),
+		mUseFastPaths	(true)
+{
+}
+
+bool NTV2FrameConverter::ConvertFrame (const NTV2Buffer & inSrcBuffer, const NTV2FormatDescriptor & inSrcDesc,
+										NTV2Buffer & inDstBuffer, const NTV2FormatDescriptor & inDstDesc)
+{
+	const uint64_t	startMicrosecs (AJATime::GetSystemMicroseconds());
+	//	Don't use IsValid -- it rejects formats whose component bit depths aren't tabulated (e.g. 16BIT_ARGB)
+	if (!inSrcDesc.GetRasterWidth()  ||  !inSrcDesc.GetVisibleRasterHeight()  ||  !inSrcDesc.GetBytesPerRow(0))
+		return false;
+	if (!inDstDesc.GetRasterWidth()  ||  !inDstDesc.GetVisibleRasterHeight()  ||  !inDstDesc.GetBytesPerRow(0))
+		return false;
+	if (inSrcBuffer.IsNULL()  ||  inDstBuffer.IsNULL())
+		return false;
+	if (inSrcBuffer.GetByteCount() < inSrcDesc.GetTotalBytes()  ||  inDstBuffer.GetByteCount() < inDstDesc.GetTotalBytes())
+		return false;	//	Buffers too small
+	if (inSrcDesc.GetRasterWidth() != inDstDesc.GetRasterWidth())
+		return false;	//	Width mismatch
+	if (inSrcDesc.GetVisibleRasterHeight() != inDstDesc.GetVisibleRasterHeight())
+		return false;	//	Height mismatch
+
+	FrameConvJob	job;
+	job.fSrcInfo = GetFormatInfo(inSrcDesc.GetPixelFormat());
+	job.fDstInfo = GetFormatInfo(inDstDesc.GetPixelFormat());
+	if (!job.fSrcInfo  ||  !job.fDstInfo)
+		return false;	//	Unsupported pixel format
+	job.fSrcDesc = &inSrcDesc;
+	job.fDstDesc = &inDstDesc;
+	job.fSrcBase = reinterpret_cast<const UByte*>(inSrcBuffer.GetHostPointer());
+	job.fDstBase = reinterpret_cast<UByte*>(inDstBuffer.GetHostPointer());
+	job.fSrcFirstRow = inSrcDesc.GetFirstActiveLine();
+	job.fDstFirstRow = inDstDesc.GetFirstActiveLine();
+	job.fWidth = inSrcDesc.GetRasterWidth();
+	job.fCopy = mUseFastPaths  &&  job.fSrcInfo == job.fDstInfo;
+	job.fFastLine = mUseFastPaths ? GetFastLineFunc(job.fSrcInfo->fFormat, job.fDstInfo->fFormat) : AJA_NULL;
+	job.fFastPair = mUseFastPaths ? GetFastPairFunc(job.fSrcInfo->fFormat, job.fDstInfo->fFormat) : AJA_NULL;
+	job.fUseCSC = job.fSrcInfo->fIsYUV != job.fDstInfo->fIsYUV;
+	job.fScratch = AJA_NULL;
+	if (job.fUseCSC)
+		job.fCSC.SetMatrix(CNTV2CSCMatrix(NTV2HostCSC::GetMatrixType(job.fSrcInfo->fIsYUV, mStandard, mSMPTERange, job.fWidth)));
+
+	//	The generic path works in whole packing groups, which must fit in each row...
+	if (!job.fCopy  &&  !job.fFastLine  &&  !job.fFastPair)
+	{
+		if (RoundUp(job.fWidth, job.fSrcInfo->fGroupPixels) / job.fSrcInfo->fGroupPixels * job.fSrcInfo->fGroupBytes > inSrcDesc.GetBytesPerRow(0))
+			return false;
+		if (RoundUp(job.fWidth, job.fDstInfo->fGroupPixels) / job.fDstInfo->fGroupPixels * job.fDstInfo->fGroupBytes > inDstDesc.GetBytesPerRow(0))
+			return false;
+	}
+
+	const ULWord	maxWorkers	(mMaxThreads  &&  mMaxThreads < NTV2ParallelRowsMaxWorkers() ? mMaxThreads : NTV2ParallelRowsMaxWorkers());
+	const size_t	scratchSize	(size_t(maxWorkers) * 2 * kTilePixels * FC_COMPS);
+	if (!job.fCopy  &&  !job.fFastLine  &&  !job.fFastPair)
+	{
+		if (mScratch.size() < scratchSize)
+			mScratch.resize(scratchSize);
+		job.fScratch = &mScratch[0];
+	}
+
+	const ULWord	numRows		(inSrcDesc.GetVisibleRasterHeight());
+	const ULWord	rowAlign	(job.fDstInfo->fChromaVRatio > job.fSrcInfo->fChromaVRatio ? job.fDstInfo->fChromaVRatio : job.fSrcInfo->fChromaVRatio);
+	mStats.fNumWorkers = NTV2ParallelRows (numRows, ConvertRowRange, &job, maxWorkers, rowAlign);
+	mStats.fNumRows = numRows;
+	mStats.fFastPath = job.fCopy || job.fFastLine || job.fFastPair;
+	mStats.fMicroseconds = AJATime::GetSystemMicroseconds() - startMicrosecs;
+	return true;
+}	//	ConvertFrame
+
+
+bool NTV2FrameConverter::ConvertLine (const void * pInSrcLine, const NTV2PixelFormat inSrcPixelFormat,
+										void * pOutDstLine, const NTV2PixelFormat inDstPixelFormat,
+										const ULWord inNumPixels)
+{
+	if (!pInSrcLine  ||  !pOutDstLine  ||  !inNumPixels)
+		return false;
+	if (NTV2_IS_FBF_PLANAR(inSrcPixelFormat)  ||  NTV2_IS_FBF_PLANAR(inDstPixelFormat))
+		return false;	//	Planar formats need ConvertFrame
+	const FrameConvFormatInfo *	pSrcInfo (GetFormatInfo(inSrcPixelFormat));
+	const FrameConvFormatInfo *	pDstInfo (GetFormatInfo(inDstPixelFormat));
+	if (!pSrcInfo  ||  !pDstInfo)
+		return false;
+
+	if (mUseFastPaths)
+	{
+		if (pSrcInfo == pDstInfo)
+		{
+			::memcpy (pOutDstLine, pInSrcLine, RoundUp(inNumPixels, pSrcInfo->fGroupPixels) / pSrcInfo->fGroupPixels * pSrcInfo->fGroupBytes);
+			return true;
+		}
+		LineFunc	pFastLine (GetFastLineFunc(inSrcPixelFormat, inDstPixelFormat));
+		if (pFastLine)
+		{
+			pFastLine (pInSrcLine, pOutDstLine, inNumPixels);
+			return true;
+		}
+	}
+	if (inNumPixels % pSrcInfo->fGroupPixels  ||  inNumPixels % pDstInfo->fGroupPixels)
+		return false;	//	Generic path needs whole packing groups
+
+	FrameConvJob	job;
+	job.fSrcInfo = pSrcInfo;
+	job.fDstInfo = pDstInfo;
+	job.fUseCSC = pSrcInfo->fIsYUV != pDstInfo->fIsYUV;
+	if (job.fUseCSC)
+		job.fCSC.SetMatrix(CNTV2CSCMatrix(NTV2HostCSC::GetMatrixType(pSrcInfo->fIsYUV, mStandard, mSMPTERange, inNumPixels)));
+	vector<UWord>	tile (kTilePixels * FC_COMPS);
+	const UByte *	pSrcPlanes[3] = {reinterpret_cast<const UByte*>(pInSrcLine), AJA_NULL, AJA_NULL};
+	UByte *			pDstPlanes[3] = {reinterpret_cast<UByte*>(pOutDstLine), AJA_NULL, AJA_NULL};
+	for (ULWord x(0);  x < inNumPixels;  x += kTilePixels)
+	{
+		const ULWord	numPixels (inNumPixels - x < kTilePixels ? inNumPixels - x : kTilePixels);
+		UnpackTile (job, pSrcPlanes, x, numPixels, &tile[0]);
+		pDstInfo->fPack (&tile[0], pDstPlanes, x, numPixels);
+	}
+	return true;
+}	//	ConvertLine
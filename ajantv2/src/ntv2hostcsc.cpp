@@ -0,0 +1,253 @@
+/* SPDX-License-Identifier: MIT */
+/**
+	@file		ntv2hostcsc.cpp
+	@brief		Implements the NTV2HostCSC class.
+	@copyright	(C) 2026 AJA Video Systems, Inc.
+**/
+
+#include "ntv2hostcsc.h"
+#if defined(__SSE2__)
+	#include <emmintrin.h>
+	#define	NTV2_HOSTCSC_SSE2	1
+#endif	//	__SSE2__
+
+#define	HCSC_COMPS			4		///< @brief	Components per pixel
+#define	HCSC_FRAC_BITS		21		///< @brief	Kernel coefficient fraction bits
+#define	HCSC_LO_BITS		8		///< @brief	Fraction bits carried by the low coefficient half
+#define	HCSC_HI_FRAC_BITS	(HCSC_FRAC_BITS - HCSC_LO_BITS)
+#define	HCSC_MAX_DEPTH		14		///< @brief	Deepest samples the kernel handles directly
+
+static const double kTwo24th (double(1 << 24));
+
+
+NTV2ColorSpaceMatrixType NTV2HostCSC::GetMatrixType (const bool inYCbCrToRGB, const NTV2HostCSCStandard inStandard,
+													const bool inSMPTERange, const ULWord inRasterWidth)
+{
+	NTV2HostCSCStandard	standard (inStandard);
+	if (standard == NTV2_HOSTCSC_AUTO)
+		standard = inRasterWidth  &&  inRasterWidth < 1280  ?  NTV2_HOSTCSC_REC601  :  NTV2_HOSTCSC_REC709;
+	switch (standard)
+	{
+		case NTV2_HOSTCSC_REC601:
+			if (inYCbCrToRGB)
+				return inSMPTERange ? NTV2_YCbCr_to_GBRSMPTE_Rec601_Matrix : NTV2_YCbCr_to_GBRFull_Rec601_Matrix;
+			return inSMPTERange ? NTV2_GBRSMPTE_to_YCbCr_Rec601_Matrix : NTV2_GBRFull_to_YCbCr_Rec601_Matrix;
+
+		case NTV2_HOSTCSC_REC2020:
+			if (inYCbCrToRGB)
+				return inSMPTERange ? NTV2_YCbCr_to_GBRSMPTE_Rec2020_Matrix : NTV2_YCbCr_to_GBRFull_Rec2020_Matrix;
+			return inSMPTERange ? NTV2_GBRSMPTE_to_YCbCr_Rec2020_Matrix : NTV2_GBRFull_to_YCbCr_Rec2020_Matrix;
+
+		default:
+			break;
+	}
+	if (inYCbCrToRGB)
+		return inSMPTERange ? NTV2_YCbCr_to_GBRSMPTE_Rec709_Matrix : NTV2_YCbCr_to_GBRFull_Rec709_Matrix;
+	return inSMPTERange ? NTV2_GBRSMPTE_to_YCbCr_Rec709_Matrix : NTV2_GBRFull_to_YCbCr_Rec709_Matrix;
+}
+
+
+bool NTV2HostCSC::IsSIMDAvailable (void)
+{
+#if defined(NTV2_HOSTCSC_SSE2)
+	return true;
+#else
+	return false;
+#endif
+}
+
+
+NTV2HostCSC::NTV2HostCSC (const NTV2ColorSpaceMatrixType inPreset)
+	:	mUseSIMD	(true)
+{
+	SetMatrix(CNTV2CSCMatrix(inPreset));
+}
+
+NTV2HostCSC::NTV2HostCSC (const CNTV2CSCMatrix & inMatrix)
+	:	mUseSIMD	(true)
+{
+	SetMatrix(inMatrix);
+}
+
+NTV2HostCSC::NTV2HostCSC (const CNTV2EnhancedCSC & inEnhancedCSC)
+	:	mUseSIMD	(true)
+{
+	SetMatrix(inEnhancedCSC.Matrix());
+}
+
+
+void NTV2HostCSC::SetMatrix (const CNTV2CSCMatrix & inMatrix)
+{
+	for (int ndx(0);  ndx < 9;  ndx++)
+	{	//	Quantize exactly as CNTV2EnhancedCSC::SendToHardware does (truncate to 8.24), then drop to 8.21
+		const LWord	hwCoeff (LWord(inMatrix.GetCoefficient(NTV2CSCCoeffIndex(ndx)) * kTwo24th));
+		mCoeff[ndx] = hwCoeff >> (24 - HCSC_FRAC_BITS);
+	}
+	//	CNTV2CSCMatrix offsets are left-justified in 15 bits plus sign, so double them
+	for (int ndx(0);  ndx < 6;  ndx++)
+		mOffset16[ndx] = LWord(inMatrix.GetOffset(NTV2CSCOffsetIndex(ndx))) * 2;
+}
+
+
+//	Splits an 8.21 coefficient into a signed high part (8.13) and an unsigned low part (the remaining 8 bits)
+static inline LWord CoeffHi (const LWord inCoeff)	{return inCoeff >> HCSC_LO_BITS;}
+static inline LWord CoeffLo (const LWord inCoeff)	{return inCoeff & ((1 << HCSC_LO_BITS) - 1);}
+
+//	The vectorized kernel needs each high coefficient to fit in 16 bits, and each row's sum of products to fit in 32 bits
+//	(with headroom) given pre-offset-adjusted inputs of up to 15 bits plus sign
+static bool FitsSIMD (const LWord * pInCoeff)
+{
+	for (int row(0);  row < 3;  row++)
+	{
+		int64_t	sumHi(0);
+		for (int col(0);  col < 3;  col++)
+		{
+			const LWord hi (CoeffHi(pInCoeff[row * 3 + col]));
+			if (hi > 32767  ||  hi < -32768)
+				return false;
+			sumHi += hi < 0 ? -hi : hi;
+		}
+		if (sumHi * (1 << 15) >= (int64_t(1) << 30))
+			return false;
+	}
+	return true;
+}
+
+
+typedef struct HostCSCParams
+{
+	LWord	fHi[9];			///< @brief	High coefficient parts
+	LWord	fLo[9];			///< @brief	Low coefficient parts
+	LWord	fPre[3];		///< @brief	Pre-offsets, at kernel bit depth
+	LWord	fPost[3];		///< @brief	Post-offsets, at kernel bit depth
+	LWord	fMax;			///< @brief	Largest output value, at kernel bit depth
+	UWord	fShift;			///< @brief	Input right shift (and output left shift) to reach kernel bit depth
+} HostCSCParams;
+
+
+static void ConvertScalar (const HostCSCParams & inP, const UWord * pIn, UWord * pOut, const ULWord inNumPixels)
+{
+	const int64_t	half (int64_t(1) << (HCSC_HI_FRAC_BITS - 1));
+	for (ULWord px(0);  px < inNumPixels;  px++, pIn += HCSC_COMPS, pOut += HCSC_COMPS)
+	{
+		const int64_t	in[3] = {	int64_t(pIn[0] >> inP.fShift) - inP.fPre[0],
+									int64_t(pIn[1] >> inP.fShift) - inP.fPre[1],
+									int64_t(pIn[2] >> inP.fShift) - inP.fPre[2]};
+		const UWord		alpha (pIn[3]);
+		for (int row(0);  row < 3;  row++)
+		{
+			const LWord	*	hi (inP.fHi + row * 3);
+			const LWord	*	lo (inP.fLo + row * 3);
+			const int64_t	sumHi (hi[0] * in[0] + hi[1] * in[1] + hi[2] * in[2]);
+			const int64_t	sumLo (lo[0] * in[0] + lo[1] * in[1] + lo[2] * in[2]);
+			int64_t			result (((sumHi + (sumLo >> HCSC_LO_BITS) + half) >> HCSC_HI_FRAC_BITS) + inP.fPost[row]);
+			if (result < 0)
+				result = 0;
+			else if (result > inP.fMax)
+				result = inP.fMax;
+			pOut[row] = UWord(result << inP.fShift);
+		}
+		pOut[3] = alpha;
+	}
+}
+
+
+#if defined(NTV2_HOSTCSC_SSE2)
+//	Sums adjacent 32-bit lanes of two _mm_madd_epi16 results, yielding one 32-bit result per pixel
+static inline __m128i SumPairs (const __m128i inP01, const __m128i inP23)
+{
+	const __m128 a (_mm_castsi128_ps(inP01)),  b (_mm_castsi128_ps(inP23));
+	return _mm_add_epi32 (_mm_castps_si128(_mm_shuffle_ps(a, b, _MM_SHUFFLE(2,0,2,0))),
+						  _mm_castps_si128(_mm_shuffle_ps(a, b, _MM_SHUFFLE(3,1,3,1))));
+}
+
+//	Returns one output component (4 pixels, 32 bits each), before clamping
+static inline __m128i MatrixRow (const __m128i inX01, const __m128i inX23, const __m128i inHi, const __m128i inLo,
+								const __m128i inHalf, const __m128i inPost)
+{
+	const __m128i	sumHi (SumPairs(_mm_madd_epi16(inX01, inHi), _mm_madd_epi16(inX23, inHi)));
+	const __m128i	sumLo (SumPairs(_mm_madd_epi16(inX01, inLo), _mm_madd_epi16(inX23, inLo)));
+	__m128i			result (_mm_add_epi32(_mm_add_epi32(sumHi, _mm_srai_epi32(sumLo, HCSC_LO_BITS)), inHalf));
+	return _mm_add_epi32 (_mm_srai_epi32(result, HCSC_HI_FRAC_BITS), inPost);
+}
+
+//	Processes four pixels per iteration;  returns the number of pixels converted
+static ULWord ConvertSSE2 (const HostCSCParams & inP, const UWord * pIn, UWord * pOut, const ULWord inNumPixels)
+{
+	__m128i	hi[3], lo[3], post[3];
+	for (int row(0);  row < 3;  row++)
+	{
+		const LWord	*h (inP.fHi + row * 3),  *l (inP.fLo + row * 3);
+		hi[row]		= _mm_setr_epi16 (short(h[0]), short(h[1]), short(h[2]), 0, short(h[0]), short(h[1]), short(h[2]), 0);
+		lo[row]		= _mm_setr_epi16 (short(l[0]), short(l[1]), short(l[2]), 0, short(l[0]), short(l[1]), short(l[2]), 0);
+		post[row]	= _mm_set1_epi32 (inP.fPost[row]);
+	}
+	const __m128i	pre			(_mm_setr_epi16 (short(inP.fPre[0]), short(inP.fPre[1]), short(inP.fPre[2]), 0,
+												 short(inP.fPre[0]), short(inP.fPre[1]), short(inP.fPre[2]), 0));
+	const __m128i	half		(_mm_set1_epi32 (1 << (HCSC_HI_FRAC_BITS - 1)));
+	const __m128i	zero		(_mm_setzero_si128());
+	const __m128i	maxVal		(_mm_set1_epi16 (short(inP.fMax)));
+	const __m128i	alphaMask	(_mm_setr_epi16 (0, 0, 0, -1, 0, 0, 0, -1));
+	const __m128i	shift		(_mm_cvtsi32_si128 (inP.fShift));
+
+	const ULWord	numQuads (inNumPixels / 4);
+	for (ULWord quad(0);  quad < numQuads;  quad++, pIn += 4 * HCSC_COMPS, pOut += 4 * HCSC_COMPS)
+	{
+		const __m128i	p01	(_mm_loadu_si128(reinterpret_cast<const __m128i*>(pIn)));
+		const __m128i	p23	(_mm_loadu_si128(reinterpret_cast<const __m128i*>(pIn + 8)));
+		const __m128i	x01	(_mm_sub_epi16(_mm_srl_epi16(p01, shift), pre));
+		const __m128i	x23	(_mm_sub_epi16(_mm_srl_epi16(p23, shift), pre));
+
+		const __m128i	rA	(MatrixRow(x01, x23, hi[0], lo[0], half, post[0]));
+		const __m128i	rB	(MatrixRow(x01, x23, hi[1], lo[1], half, post[1]));
+		const __m128i	rC	(MatrixRow(x01, x23, hi[2], lo[2], half, post[2]));
+
+		//	Pack to 16 bits and clamp:  AB = A0 A1 A2 A3 B0 B1 B2 B3,  C = C0 C1 C2 C3 0 0 0 0
+		const __m128i	ab	(_mm_min_epi16(_mm_max_epi16(_mm_packs_epi32(rA, rB), zero), maxVal));
+		const __m128i	c	(_mm_min_epi16(_mm_max_epi16(_mm_packs_epi32(rC, zero), zero), maxVal));
+
+		//	Re-interleave:  A0 B0 C0 0 A1 B1 C1 0 ...
+		const __m128i	abi	(_mm_unpacklo_epi16(ab, _mm_srli_si128(ab, 8)));
+		const __m128i	c0	(_mm_unpacklo_epi16(c, zero));
+		const __m128i	o01	(_mm_sll_epi16(_mm_unpacklo_epi32(abi, c0), shift));
+		const __m128i	o23	(_mm_sll_epi16(_mm_unpackhi_epi32(abi, c0), shift));
+
+		_mm_storeu_si128 (reinterpret_cast<__m128i*>(pOut),		_mm_or_si128(o01, _mm_and_si128(p01, alphaMask)));
+		_mm_storeu_si128 (reinterpret_cast<__m128i*>(pOut + 8),	_mm_or_si128(o23, _mm_and_si128(p23, alphaMask)));
+	}
+	return numQuads * 4;
+}
+#endif	//	NTV2_HOSTCSC_SSE2
+
+
+bool NTV2HostCSC::ConvertLine (const UWord * pInLine, UWord * pOutLine, const ULWord inNumPixels, const UWord inBitDepth) const
+{
+	if (!pInLine  ||  !pOutLine)
+		return false;
+	if (inBitDepth < 8  ||  inBitDepth > 16)
+		return false;
+
+	const UWord		depth (inBitDepth > HCSC_MAX_DEPTH ? UWord(HCSC_MAX_DEPTH) : inBitDepth);
+	HostCSCParams	params;
+	for (int ndx(0);  ndx < 9;  ndx++)
+	{
+		params.fHi[ndx] = CoeffHi(mCoeff[ndx]);
+		params.fLo[ndx] = CoeffLo(mCoeff[ndx]);
+	}
+	for (int ndx(0);  ndx < 3;  ndx++)
+	{
+		params.fPre[ndx]	= mOffset16[NTV2CSCOffsetIndex_Pre0 + ndx] >> (16 - depth);
+		params.fPost[ndx]	= mOffset16[NTV2CSCOffsetIndex_PostA + ndx] >> (16 - depth);
+	}
+	params.fMax		= (1 << depth) - 1;
+	params.fShift	= UWord(inBitDepth - depth);
+
+	ULWord	done(0);
+#if defined(NTV2_HOSTCSC_SSE2)
+	if (mUseSIMD  &&  FitsSIMD(mCoeff))
+		done = ConvertSSE2 (params, pInLine, pOutLine, inNumPixels);
+#endif	//	NTV2_HOSTCSC_SSE2
+	if (done < inNumPixels)
+		ConvertScalar (params, pInLine + done * HCSC_COMPS, pOutLine + done * HCSC_COMPS, inNumPixels - done);
+	return true;
+}
@@ -91,7 +91,8 @@ CNTV2KonaFlashProgram::CNTV2KonaFlashProgram (CNTV2Card & card)
 //		_mcsStep			(0),
 		_failSafePadding	(0),
 		_spiFlash			(AJA_NULL),
-		_hasExtendedCommandSupport	(false)
+		_hasExtendedCommandSupport	(false),
+		_batchMode			(false)
 {
 	SetBoard();
 }
@@ -534,37 +535,46 @@ string CNTV2KonaFlashProgram::Program(bool fullVerify)
 
 	EraseBlock(_flashID);
 
-	SetFlashBlockIDBank(_flashID);
-
-	uint32_t* bitFilePtr = _bitFileBuffer;
-	uint32_t twoFixtysixBlockSizeCount ((_bitFileSize + 256) / 256);
-	uint32_t percentComplete(0);
-	_card.WriteRegister(kVRegFlashState, kProgramStateProgramFlash);
-	_card.WriteRegister(kVRegFlashSize, twoFixtysixBlockSizeCount);
-	for (uint32_t count(0);  count < twoFixtysixBlockSizeCount;  count++, baseAddress += 256, bitFilePtr += 64)
+	if (_batchMode)
+	{	//	Program & verify one sector at a time...
+		const string errMsg (ProgramBatched());
+		if (!errMsg.empty())
+			return errMsg;
+	}
+	else
 	{
-		if (_card.features().GetSPIFlashVersion() >= 5  &&  baseAddress == _bankSize)
+		SetFlashBlockIDBank(_flashID);
+
+		uint32_t* bitFilePtr = _bitFileBuffer;
+		uint32_t twoFixtysixBlockSizeCount ((_bitFileSize + 256) / 256);
+		uint32_t percentComplete(0);
+		_card.WriteRegister(kVRegFlashState, kProgramStateProgramFlash);
+		_card.WriteRegister(kVRegFlashSize, twoFixtysixBlockSizeCount);
+		for (uint32_t count(0);  count < twoFixtysixBlockSizeCount;  count++, baseAddress += 256, bitFilePtr += 64)
 		{
-			baseAddress = 0;
-			SetBankSelect(_flashID == FAILSAFE_FLASHBLOCK ? BANK_3 : BANK_1);
-		}
-		FastProgramFlash256(baseAddress, bitFilePtr);
-		percentComplete = (count*100)/twoFixtysixBlockSizeCount;
+			if (_card.features().GetSPIFlashVersion() >= 5  &&  baseAddress == _bankSize)
+			{
+				baseAddress = 0;
+				SetBankSelect(_flashID == FAILSAFE_FLASHBLOCK ? BANK_3 : BANK_1);
+			}
+			FastProgramFlash256(baseAddress, bitFilePtr);
+			percentComplete = (count*100)/twoFixtysixBlockSizeCount;
 
-		_card.WriteRegister(kVRegFlashStatus, count);
+			_card.WriteRegister(kVRegFlashStatus, count);
+			if (!_bQuiet)
+				cout << "Program status: " << DEC(percentComplete) << "%  \r" << flush;
+		}
 		if (!_bQuiet)
-			cout << "Program status: " << DEC(percentComplete) << "%  \r" << flush;
-	}
-	if (!_bQuiet)
-		cout << "Program status: 100%				   " << endl;
+			cout << "Program status: 100%				   " << endl;
 
-	SetBankSelect(BANK_0);
-	if (!VerifyFlash(_flashID, fullVerify))
-	{
 		SetBankSelect(BANK_0);
-		return "Program Didn't Verify";
+		if (!VerifyFlash(_flashID, fullVerify))
+		{
+			SetBankSelect(BANK_0);
+			return "Program Didn't Verify";
+		}
 	}
-	
+
 	// Protect Device
 	WriteCommand(WRITEENABLE_COMMAND);
 	WaitForFlashNOTBusy();
@@ -610,6 +620,134 @@ bool CNTV2KonaFlashProgram::FastProgramFlash256(uint32_t address, uint32_t* buff
 	return true;
 }
 
+bool CNTV2KonaFlashProgram::BatchProgramFlash256 (const uint32_t address, const uint32_t * buffer)
+{
+	if (!buffer)
+		return false;
+	NTV2RegisterWrites regWrites;
+	regWrites.reserve(66);
+	for (uint32_t count(0);  count < 64;  count++)
+		regWrites.push_back(NTV2RegInfo(kRegXenaxFlashDIN, buffer[count]));
+	regWrites.push_back(NTV2RegInfo(kRegXenaxFlashAddress, address));
+	regWrites.push_back(NTV2RegInfo(kRegXenaxFlashControlStatus, PAGEPROGRAM_COMMAND));
+
+	WriteCommand(WRITEENABLE_COMMAND);
+	WaitForFlashNOTBusy();
+	if (!_card.WriteRegisters(regWrites))
+		return false;
+	return WaitForFlashNOTBusy();
+}
+
+bool CNTV2KonaFlashProgram::BatchReadFlash (const uint32_t address, uint32_t * pOutWords, const uint32_t numWords)
+{
+	if (!pOutWords)
+		return false;
+	//	The SPI controller has one DOUT register, so each word needs its own READFAST command.
+	//	The address & command go out in one call. DOUT must be read on its own, since the drivers'
+	//	GETREGS handlers (and CNTV2DriverInterface::ReadRegisters) won't read it...
+	NTV2RegisterWrites regWrites(2);
+	regWrites[1] = NTV2RegInfo(kRegXenaxFlashControlStatus, READFAST_COMMAND);
+	for (uint32_t count(0);  count < numWords;  count++)
+	{
+		regWrites[0] = NTV2RegInfo(kRegXenaxFlashAddress, address + count * 4);
+		if (!_card.WriteRegisters(regWrites))
+			return false;
+		WaitForFlashNOTBusy();
+		if (!_card.ReadRegister(kRegXenaxFlashDOUT, pOutWords[count]))
+			return false;
+	}
+	return true;
+}
+
+bool CNTV2KonaFlashProgram::GetPaddedBitFile (NTV2Buffer & outImage) const
+{	//	Whole pages, padded with erased (0xFF) bytes...
+	const ULWord numBytes ((_bitFileSize + 255) / 256 * 256);
+	if (!_bitFileBuffer  ||  !numBytes)
+		return false;
+	if (!outImage.Allocate(numBytes))
+		return false;
+	outImage.Fill(UByte(0xFF));
+	return outImage.CopyFrom(_bitFileBuffer, 0, 0, min(ULWord(_bitFileSize), _bitFileBuffer.GetByteCount()));
+}
+
+uint32_t CNTV2KonaFlashProgram::BatchAddressForOffset (const FlashBlockID blockID, const uint32_t offset, int & ioBank)
+{	//	On SPI v5+ devices, the part of a block past the bank size lives in the next bank up...
+	const bool upperBank (_card.features().GetSPIFlashVersion() >= 5  &&  _bankSize  &&  offset >= _bankSize);
+	if (ioBank != int(upperBank))
+	{
+		if (upperBank)
+			SetBankSelect(blockID == FAILSAFE_FLASHBLOCK ? BANK_3 : BANK_1);
+		else
+			SetFlashBlockIDBank(blockID);
+		ioBank = int(upperBank);
+	}
+	return GetBaseAddressForProgramming(blockID) + (upperBank ? offset - _bankSize : offset);
+}
+
+string CNTV2KonaFlashProgram::ProgramBatched (void)
+{
+	static const uint32_t kMaxRetries (2);	//	Times to re-erase & re-program a sector that doesn't verify
+	NTV2Buffer image;
+	if (!GetPaddedBitFile(image))
+		return "Bitfile not open";
+	if (!_sectorSize)
+		return "Device not recognized";
+
+	const uint32_t numBytes (image.GetByteCount());
+	NTV2Buffer readBack (_sectorSize);
+	uint32_t percentComplete(0), numRetries(0);
+	int bank(-1);
+	_card.WriteRegister(kVRegFlashState, kProgramStateProgramFlash);
+	_card.WriteRegister(kVRegFlashSize, numBytes / 256);
+	for (uint32_t offset(0);  offset < numBytes;  offset += _sectorSize)
+	{
+		const uint32_t address (BatchAddressForOffset(_flashID, offset, bank));
+		const uint32_t sectorBytes (min(_sectorSize, numBytes - offset));
+		const NTV2Buffer source (image.GetHostAddress(offset), sectorBytes);
+		const NTV2Buffer flash (readBack.GetHostPointer(), sectorBytes);
+		const uint64_t sourceHash (source.GetHash64());
+		for (uint32_t attempt(0);  ;  attempt++)
+		{
+			bool ok (true);
+			for (uint32_t page(0);  ok  &&  page < sectorBytes;  page += 256)
+				ok = BatchProgramFlash256(address + page, reinterpret_cast<const uint32_t*>(source.GetHostAddress(page)));
+			if (ok)
+				ok = BatchReadFlash(address, reinterpret_cast<uint32_t*>(flash.GetHostPointer()), sectorBytes / 4);
+			if (!ok)
+				{SetBankSelect(BANK_0);  KFPERR("Flash access failed for sector at offset " << xHEX0N(offset,8));  return "Program Failed";}
+			if (flash.GetHash64() == sourceHash)
+				break;	//	Verified
+
+			ULWord badOffset(0);
+			source.NextDifference(flash, badOffset);
+			badOffset &= ~ULWord(3);
+			const uint32_t expected (*reinterpret_cast<const uint32_t*>(source.GetHostAddress(badOffset)));
+			const uint32_t actual (*reinterpret_cast<const uint32_t*>(flash.GetHostAddress(badOffset)));
+			if (attempt >= kMaxRetries)
+			{
+				KFPERR("Offset " << xHEX0N(offset + badOffset,8) << " E(" << xHEX0N(expected,8) << "),R(" << xHEX0N(actual,8) << ") after "
+						<< DEC(attempt) << " retries");
+				SetBankSelect(BANK_0);
+				return "Program Didn't Verify";
+			}
+			KFPWARN("Offset " << xHEX0N(offset + badOffset,8) << " E(" << xHEX0N(expected,8) << "),R(" << xHEX0N(actual,8)
+					<< ") -- re-programming sector at address " << xHEX0N(address,8));
+			EraseSector(address);
+			numRetries++;
+		}
+		_card.WriteRegister(kVRegFlashStatus, (offset + sectorBytes) / 256);
+		percentComplete = uint32_t(uint64_t(offset + sectorBytes) * 100 / numBytes);
+		if (!_bQuiet)
+			cout << "Program/verify status: " << DEC(percentComplete) << "%  \r" << flush;
+	}
+	if (!_bQuiet)
+		cout << "Program/verify status: 100%				   " << endl;
+	if (numRetries)
+		KFPNOTE(DEC(numRetries) << " sector(s) had to be re-programmed");
+	SetBankSelect(BANK_0);
+	return "";
+}
+
 uint32_t CNTV2KonaFlashProgram::ReadDeviceID()
 {
 	uint32_t deviceID = 0;
@@ -695,6 +833,9 @@ bool CNTV2KonaFlashProgram::EraseChip (UWord chip)
 
 bool CNTV2KonaFlashProgram::VerifyFlash (FlashBlockID flashID, bool fullVerify)
 {
+	if (_batchMode)
+		return VerifyFlashBatched(flashID);
+
 	uint32_t errorCount = 0;
 	uint32_t baseAddress = GetBaseAddressForProgramming(flashID);
 	uint32_t* bitFilePtr = _bitFileBuffer;
@@ -752,6 +893,53 @@ bool CNTV2KonaFlashProgram::VerifyFlash (FlashBlockID flashID, bool fullVerify)
 	return true;
 }
 
+bool CNTV2KonaFlashProgram::VerifyFlashBatched (const FlashBlockID flashID)
+{
+	NTV2Buffer image;
+	if (!GetPaddedBitFile(image)  ||  !_sectorSize)
+		return false;
+
+	const uint32_t numBytes (image.GetByteCount());
+	NTV2Buffer readBack (_sectorSize);
+	uint32_t errorCount(0), percentComplete(0);
+	int bank(-1);
+	_card.WriteRegister(kVRegFlashState, kProgramStateVerifyFlash);
+	_card.WriteRegister(kVRegFlashSize, numBytes / 4);
+	for (uint32_t offset(0);  offset < numBytes  &&  !errorCount;  offset += _sectorSize)
+	{
+		const uint32_t sectorBytes (min(_sectorSize, numBytes - offset));
+		const NTV2Buffer source (image.GetHostAddress(offset), sectorBytes);
+		const NTV2Buffer flash (readBack.GetHostPointer(), sectorBytes);
+		if (!BatchReadFlash(BatchAddressForOffset(flashID, offset, bank), reinterpret_cast<uint32_t*>(flash.GetHostPointer()), sectorBytes / 4))
+			{cerr << "Error reading sector at offset " << xHEX0N(offset,8) << endl;  errorCount++;}
+		else if (flash.GetHash64() != source.GetHash64())
+		{
+			ULWord badOffset(0);
+			source.NextDifference(flash, badOffset);
+			badOffset &= ~ULWord(3);
+			cerr << "Error " << DEC((offset + badOffset) / 4) << " E(" << HEX0N(*reinterpret_cast<const uint32_t*>(source.GetHostAddress(badOffset)),8)
+				<< "),R(" << HEX0N(*reinterpret_cast<const uint32_t*>(flash.GetHostAddress(badOffset)),8) << ")" << endl;
+			errorCount++;
+		}
+		_card.WriteRegister(kVRegFlashStatus, (offset + sectorBytes) / 4);
+		percentComplete = uint32_t(uint64_t(offset) * 100 / numBytes);
+		if (!_bQuiet)
+			cout << "Program verify: " << DEC(percentComplete) << "%\r" << flush;
+	}
+
+	SetBankSelect(BANK_0);
+
+	if (errorCount)
+	{
+		if (!_bQuiet)
+			cout << "Program verify failed: " << DEC(percentComplete) << "%" << endl;
+		return false;
+	}
+	if (!_bQuiet)
+		cout << "Program verify: 100%					 " << endl;
+	return true;
+}
+
 bool CNTV2KonaFlashProgram::ReadFlash (NTV2Buffer & outBuffer, const FlashBlockID inFlashID, CNTV2FlashProgress & inFlashProgress)
 {
 	uint32_t baseAddress(GetBaseAddressForProgramming(inFlashID));
@@ -766,6 +954,31 @@ bool CNTV2KonaFlashProgram::ReadFlash (NTV2Buffer & outBuffer, const FlashBlockI
 
 	size_t lastPercent(0), percent(0);
 	inFlashProgress.UpdatePercentage(lastPercent);
+	if (_batchMode)
+	{	//	Read up to a sector's worth of words at a time...
+		const uint32_t chunkDWords (_sectorSize ? _sectorSize / 4 : 64);
+		int bank(-1);
+		_card.WriteRegister(kVRegFlashState, kProgramStateVerifyFlash);
+		_card.WriteRegister(kVRegFlashSize, numDWords);
+		KFPDBUG("About to read " << xHEX0N(numDWords*4,8) << "(" << DEC(numDWords*4) << ") bytes from '" << FlashBlockIDToString(inFlashID, /*compact*/true) << "' address " << xHEX0N(baseAddress,8));
+		for (uint32_t dword(0);	 dword < numDWords;	 )
+		{
+			const uint32_t numWords (min(chunkDWords, numDWords - dword));
+			if (!BatchReadFlash(BatchAddressForOffset(inFlashID, dword * 4, bank), reinterpret_cast<uint32_t*>(outBuffer.GetHostAddress(dword * 4)), numWords))
+				{SetBankSelect(BANK_0);	 KFPERR("Failed reading " << DEC(numWords) << " dword(s) at dword " << DEC(dword));  return false;}
+			dword += numWords;
+			_card.WriteRegister(kVRegFlashStatus, dword);
+			percent = dword * 100 / numDWords;
+			if (percent != lastPercent)
+				if (!inFlashProgress.UpdatePercentage(percent))
+					{SetBankSelect(BANK_0);	 KFPERR("Cancelled at " << DEC(percent) << "% dword=" << DEC(dword));  return false;}
+			lastPercent = percent;
+		}
+		SetBankSelect(BANK_0);
+		inFlashProgress.UpdatePercentage(100);
+		KFPNOTE("Successfully read " << xHEX0N(numDWords*4,8) << "(" << DEC(numDWords*4) << ") bytes from '" << FlashBlockIDToString(inFlashID, /*compact*/true) << "' address " << xHEX0N(baseAddress,8));
+		return true;
+	}
 	switch (_flashID)
 	{
 		default:
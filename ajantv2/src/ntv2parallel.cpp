@@ -0,0 +1,164 @@
+/* SPDX-License-Identifier: MIT */
+/**
+	@file		ntv2parallel.cpp
+	@brief		Implements the NTV2ParallelRows function.
+	@copyright	(C) 2026 AJA Video Systems, Inc.
+**/
+
+#include "ntv2parallel.h"
+#if defined(NTV2_USE_CPLUSPLUS11)
+	#include <thread>
+	#include <mutex>
+	#include <condition_variable>
+	#include <vector>
+#endif	//	NTV2_USE_CPLUSPLUS11
+
+static const ULWord	kMaxRowWorkers	(32);	//	Hard cap on pool size
+
+
+#if defined(NTV2_USE_CPLUSPLUS11)
+/**
+	@brief	A fixed-size pool of worker threads that each process one band of rows per job.
+			The calling thread always handles band zero, so the pool has one fewer thread than
+			the maximum number of workers.
+**/
+class RowWorkerPool
+{
+	public:
+		static RowWorkerPool &	Get (void)
+		{
+			static RowWorkerPool	sPool;
+			return sPool;
+		}
+
+		inline ULWord	MaxWorkers (void) const		{return ULWord(mThreads.size()) + 1;}
+
+		ULWord	Run (const ULWord inNumRows, NTV2RowRangeFunc inFunc, void * pInContext, const ULWord inNumWorkers, const ULWord inRowAlignment)
+		{
+			std::unique_lock<std::mutex> jobLock(mJobMutex, std::try_to_lock);
+			if (!jobLock.owns_lock())
+			{	//	Pool is busy serving another caller -- do it all here rather than wait
+				inFunc(pInContext, 0, 0, inNumRows);
+				return 1;
+			}
+
+			//	Compute band boundaries...
+			const ULWord	numBlocks	((inNumRows + inRowAlignment - 1) / inRowAlignment);
+			const ULWord	numBands	(inNumWorkers < numBlocks ? inNumWorkers : numBlocks);
+			const ULWord	blocksPer	(numBlocks / numBands),  extra (numBlocks % numBands);
+			mBandFirst.resize(numBands+1);
+			for (ULWord band(0), block(0);  band < numBands;  band++)
+			{
+				mBandFirst[band] = block * inRowAlignment;
+				block += blocksPer + (band < extra ? 1 : 0);
+			}
+			mBandFirst[numBands] = inNumRows;
+
+			{	//	Publish the job...
+				std::lock_guard<std::mutex> lock(mMutex);
+				mFunc = inFunc;  mContext = pInContext;  mNumBands = numBands;
+				mPending = numBands - 1;
+				mGeneration++;
+			}
+			mWorkCV.notify_all();
+
+			//	Band zero runs in the caller's thread...
+			inFunc(pInContext, 0, mBandFirst[0], mBandFirst[1] - mBandFirst[0]);
+
+			std::unique_lock<std::mutex> lock(mMutex);
+			mDoneCV.wait(lock, [this]{return mPending == 0;});
+			return numBands;
+		}
+
+	private:
+		RowWorkerPool ()
+			:	mFunc(AJA_NULL), mContext(AJA_NULL), mNumBands(0), mPending(0), mGeneration(0), mQuit(false)
+		{
+			ULWord numThreads (std::thread::hardware_concurrency());
+			if (numThreads > kMaxRowWorkers)
+				numThreads = kMaxRowWorkers;
+			for (ULWord ndx(1);  ndx < numThreads;  ndx++)
+				mThreads.push_back(std::thread(&RowWorkerPool::Worker, this, ndx));
+		}
+
+		~RowWorkerPool ()
+		{
+			{
+				std::lock_guard<std::mutex> lock(mMutex);
+				mQuit = true;
+			}
+			mWorkCV.notify_all();
+			for (size_t ndx(0);  ndx < mThreads.size();  ndx++)
+				if (mThreads[ndx].joinable())
+					mThreads[ndx].join();
+		}
+
+		void Worker (const ULWord inWorkerIndex)
+		{
+			uint64_t	lastGeneration(0);
+			while (true)
+			{
+				NTV2RowRangeFunc	func(AJA_NULL);
+				void *				pContext(AJA_NULL);
+				{
+					std::unique_lock<std::mutex> lock(mMutex);
+					mWorkCV.wait(lock, [&]{return mQuit || mGeneration != lastGeneration;});
+					if (mQuit)
+						return;
+					lastGeneration = mGeneration;
+					if (inWorkerIndex >= mNumBands)
+						continue;	//	Not needed for this job
+					func = mFunc;  pContext = mContext;
+				}
+				func(pContext, inWorkerIndex, mBandFirst[inWorkerIndex], mBandFirst[inWorkerIndex+1] - mBandFirst[inWorkerIndex]);
+				{
+					std::lock_guard<std::mutex> lock(mMutex);
+					if (--mPending == 0)
+						mDoneCV.notify_one();
+				}
+			}
+		}
+
+	private:
+		std::vector<std::thread>	mThreads;		///< @brief	My worker threads
+		std::mutex					mJobMutex;		///< @brief	Serializes callers
+		std::mutex					mMutex;			///< @brief	Guards job state
+		std::condition_variable		mWorkCV;		///< @brief	Signals new job (or quit)
+		std::condition_variable		mDoneCV;		///< @brief	Signals job completion
+		std::vector<ULWord>			mBandFirst;		///< @brief	First row of each band (plus end)
+		NTV2RowRangeFunc			mFunc;			///< @brief	Current job's function
+		void *						mContext;		///< @brief	Current job's context
+		ULWord						mNumBands;		///< @brief	Current job's band count
+		ULWord						mPending;		///< @brief	Bands not yet finished by worker threads
+		uint64_t					mGeneration;	///< @brief	Incremented per job
+		bool						mQuit;			///< @brief	True when shutting down
+};	//	RowWorkerPool
+#endif	//	NTV2_USE_CPLUSPLUS11
+
+
+ULWord NTV2ParallelRowsMaxWorkers (void)
+{
+#if defined(NTV2_USE_CPLUSPLUS11)
+	return RowWorkerPool::Get().MaxWorkers();
+#else
+	return 1;
+#endif
+}
+
+
+ULWord NTV2ParallelRows (const ULWord inNumRows, NTV2RowRangeFunc inFunc, void * pInContext, const ULWord inMaxWorkers, const ULWord inRowAlignment)
+{
+	if (!inNumRows || !inFunc)
+		return 0;
+#if defined(NTV2_USE_CPLUSPLUS11)
+	ULWord	numWorkers (NTV2ParallelRowsMaxWorkers());
+	if (inMaxWorkers  &&  inMaxWorkers < numWorkers)
+		numWorkers = inMaxWorkers;
+	if (numWorkers > 1)
+		return RowWorkerPool::Get().Run(inNumRows, inFunc, pInContext, numWorkers, inRowAlignment ? inRowAlignment : 1);
+#else
+	(void) inMaxWorkers;  (void) inRowAlignment;
+#endif	//	NTV2_USE_CPLUSPLUS11
+	inFunc(pInContext, 0, 0, inNumRows);
+	return 1;
+}
@@ -0,0 +1,383 @@
+/* SPDX-License-Identifier: MIT */
+/**
+	@file		ntv2previewcompositor.cpp
+	@brief		Implements the NTV2PreviewCompositor class.
+	@copyright	(C) 2026 AJA Video Systems, Inc.
+**/
+
+#include "ntv2previewcompositor.h"
+#include "ntv2frameconverter.h"
+#include "ntv2parallel.h"
+#include "ajabase/system/systemtime.h"
+#if defined(__SSE2__)
+	#include <emmintrin.h>
+	#define	NTV2_COMPOSITOR_SSE2	1
+#endif	//	__SSE2__
+
+using namespace std;
+
+static inline ULWord RoundUp (const ULWord inValue, const ULWord inMultiple)
+{
+	return (inValue + inMultiple - 1) / inMultiple * inMultiple;
+}
+
+
+//////////////////////////////////////////////////////////////////////////////////////////////////////
+//	Row kernels
+//
+//	Rows are in NTV2FrameConverter's intermediate form:  four 16-bit components per pixel.
+//////////////////////////////////////////////////////////////////////////////////////////////////////
+
+//	pOut = (pA + pB + 1) / 2, component-wise
+static void AverageRows (const UWord * pA, const UWord * pB, UWord * pOut, const ULWord inNumWords, const bool inUseSIMD)
+{
+	ULWord	ndx(0);
+#if defined(NTV2_COMPOSITOR_SSE2)
+	if (inUseSIMD)
+		for (;  ndx + 8 <= inNumWords;  ndx += 8)
+			_mm_storeu_si128 (reinterpret_cast<__m128i*>(pOut + ndx),
+								_mm_avg_epu16 (_mm_loadu_si128(reinterpret_cast<const __m128i*>(pA + ndx)),
+												_mm_loadu_si128(reinterpret_cast<const __m128i*>(pB + ndx))));
+#else
+	(void) inUseSIMD;
+#endif	//	NTV2_COMPOSITOR_SSE2
+	for (;  ndx < inNumWords;  ndx++)
+		pOut[ndx] = UWord((ULWord(pA[ndx]) + ULWord(pB[ndx]) + 1) >> 1);
+}
+
+//	Box-filters one row down (or nearest-neighbors it up) to the tile width. The SSE2 and scalar loops do
+//	the same single-precision arithmetic, so they produce identical results.
+static void ReduceRow (const UWord * pIn, const NTV2PreviewCompositor::Tile & inTile, const ULWord inNumOut, UWord * pOut, const bool inUseSIMD)
+{
+	const ULWord *	pFirst	(&inTile.fSpanFirst[0]);
+	const ULWord *	pCount	(&inTile.fSpanCount[0]);
+	const float *	pRecip	(&inTile.fSpanRecip[0]);
+#if defined(NTV2_COMPOSITOR_SSE2)
+	if (inUseSIMD)
+	{
+		const __m128i	zero	(_mm_setzero_si128());
+		const __m128i	bias	(_mm_set1_epi32(0x8000));
+		const __m128	half	(_mm_set1_ps(0.5f));
+		for (ULWord x(0);  x < inNumOut;  x += 2)
+		{	//	Two output pixels per iteration
+			__m128i	result[2];
+			for (ULWord n(0);  n < 2;  n++)
+			{
+				const ULWord	ndx (x + n < inNumOut ? x + n : inNumOut - 1);
+				const UWord *	pSrc (pIn + size_t(pFirst[ndx]) * 4);
+				__m128i			acc (zero);
+				for (ULWord i(0);  i < pCount[ndx];  i++, pSrc += 4)
+					acc = _mm_add_epi32 (acc, _mm_unpacklo_epi16(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(pSrc)), zero));
+				const __m128	avg (_mm_add_ps(_mm_mul_ps(_mm_cvtepi32_ps(acc), _mm_set1_ps(pRecip[ndx])), half));
+				result[n] = _mm_sub_epi32 (_mm_cvttps_epi32(avg), bias);	//	Signed, for _mm_packs_epi32
+			}
+			const __m128i	packed (_mm_xor_si128(_mm_packs_epi32(result[0], result[1]), _mm_set1_epi16(short(0x8000))));
+			if (x + 1 < inNumOut)
+				_mm_storeu_si128 (reinterpret_cast<__m128i*>(pOut + size_t(x) * 4), packed);
+			else
+				_mm_storel_epi64 (reinterpret_cast<__m128i*>(pOut + size_t(x) * 4), packed);
+		}
+		return;
+	}
+#else
+	(void) inUseSIMD;
+#endif	//	NTV2_COMPOSITOR_SSE2
+	for (ULWord x(0);  x < inNumOut;  x++)
+	{
+		const UWord *	pSrc (pIn + size_t(pFirst[x]) * 4);
+		ULWord			acc[4] = {0, 0, 0, 0};
+		for (ULWord i(0);  i < pCount[x];  i++, pSrc += 4)
+			for (ULWord c(0);  c < 4;  c++)
+				acc[c] += pSrc[c];
+		for (ULWord c(0);  c < 4;  c++)
+			pOut[size_t(x) * 4 + c] = UWord(float(LWord(acc[c])) * pRecip[x] + 0.5f);
+	}
+}
+
+//	Computes which source pixels feed each tile pixel
+static void BuildSpans (NTV2PreviewCompositor::Tile & inTile, const ULWord inSrcWidth, const ULWord inTileWidth)
+{
+	if (inTile.fSpanWidth == inSrcWidth  &&  inTile.fTileWidth == inTileWidth)
+		return;
+	inTile.fSpanFirst.resize(inTileWidth);
+	inTile.fSpanCount.resize(inTileWidth);
+	inTile.fSpanRecip.resize(inTileWidth);
+	for (ULWord x(0);  x < inTileWidth;  x++)
+	{
+		ULWord	first	(ULWord(uint64_t(x) * inSrcWidth / inTileWidth));
+		ULWord	end		(ULWord(uint64_t(x + 1) * inSrcWidth / inTileWidth));
+		if (first >= inSrcWidth)
+			first = inSrcWidth - 1;
+		if (end <= first)
+			end = first + 1;	//	Enlarging:  nearest neighbor
+		inTile.fSpanFirst[x] = first;
+		inTile.fSpanCount[x] = end - first;
+		inTile.fSpanRecip[x] = 1.0f / float(end - first);
+	}
+	inTile.fSpanWidth = inSrcWidth;
+	inTile.fTileWidth = inTileWidth;
+}
+
+
+//////////////////////////////////////////////////////////////////////////////////////////////////////
+//	Composite job
+//////////////////////////////////////////////////////////////////////////////////////////////////////
+
+typedef struct CompositeJob
+{
+	NTV2PreviewCompositor::Tile *	fTiles;
+	UWord							fNumColumns;
+	ULWord							fTileWidth;
+	ULWord							fTileHeight;
+	const NTV2FormatDescriptor *	fMosaicDesc;
+	UByte *							fMosaicBase;
+	size_t							fSrcWords;		///< @brief	Words per source row buffer
+	size_t							fWorkerWords;	///< @brief	Scratch words per worker
+	UWord *							fScratch;
+	bool							fUseSIMD;
+} CompositeJob;
+
+static void CompositeRowRange (void * pInContext, const ULWord inWorkerIndex, const ULWord inFirstRow, const ULWord inNumRows)
+{
+	const CompositeJob &	job		(*reinterpret_cast<const CompositeJob*>(pInContext));
+	UWord *					pRowA	(job.fScratch + inWorkerIndex * job.fWorkerWords);
+	UWord *					pRowB	(pRowA + job.fSrcWords);
+	UWord *					pOut	(pRowB + job.fSrcWords);
+	const ULWord			firstMosaicRow	(job.fMosaicDesc->GetFirstActiveLine());
+
+	for (ULWord row(inFirstRow);  row < inFirstRow + inNumRows;  row++)
+	{
+		const ULWord	tileRow	(row / job.fTileHeight),  y (row % job.fTileHeight);
+		for (UWord col(0);  col < job.fNumColumns;  col++)
+		{
+			const NTV2PreviewCompositor::Tile &	tile (job.fTiles[tileRow * job.fNumColumns + col]);
+			if (tile.fRender)
+			{
+				const NTV2FormatDescriptor &	desc		(tile.fDesc);
+				const ULWord					srcHeight	(desc.GetVisibleRasterHeight());
+				const ULWord					srcPixels	(RoundUp(desc.GetRasterWidth(), NTV2FrameConverter::GetPixelGroupSize(desc.GetPixelFormat())));
+				//	Average the first row of the span with the one halfway through it...
+				const ULWord	first	(ULWord(uint64_t(y) * srcHeight / job.fTileHeight));
+				ULWord			end		(ULWord(uint64_t(y + 1) * srcHeight / job.fTileHeight));
+				if (end <= first)
+					end = first + 1;
+				const ULWord	second	(first + (end - first) / 2);
+				NTV2FrameConverter::UnpackPixels (tile.fFrame, desc, first + desc.GetFirstActiveLine(), 0, srcPixels, pRowA);
+				if (second != first)
+				{
+					NTV2FrameConverter::UnpackPixels (tile.fFrame, desc, second + desc.GetFirstActiveLine(), 0, srcPixels, pRowB);
+					AverageRows (pRowA, pRowB, pRowA, srcPixels * 4, job.fUseSIMD);
+				}
+				ReduceRow (pRowA, tile, job.fTileWidth, pOut, job.fUseSIMD);
+				if (tile.fIsYUV)
+					tile.fCSC.ConvertLine (pOut, pOut, job.fTileWidth, 16);
+			}
+			else if (tile.fNeedsClear)
+				for (ULWord x(0);  x < job.fTileWidth;  x++)
+				{	//	Opaque black
+					pOut[4 * x] = pOut[4 * x + 1] = pOut[4 * x + 2] = 0;
+					pOut[4 * x + 3] = 0xFFFF;
+				}
+			else
+				continue;	//	Leave this tile alone
+			NTV2FrameConverter::PackPixels (pOut, job.fMosaicBase, *job.fMosaicDesc, row + firstMosaicRow,
+											col * job.fTileWidth, job.fTileWidth);
+		}
+	}
+}
+
+
+//////////////////////////////////////////////////////////////////////////////////////////////////////
+//	NTV2PreviewCompositor
+//////////////////////////////////////////////////////////////////////////////////////////////////////
+
+bool NTV2PreviewCompositor::IsSupportedMosaicFormat (const NTV2PixelFormat inPixelFormat)
+{
+	return inPixelFormat == NTV2_FBF_RGBA  ||  inPixelFormat == NTV2_FBF_ARGB  ||  inPixelFormat == NTV2_FBF_ABGR;
+}
+
+bool NTV2PreviewCompositor::IsSupportedTileFormat (const NTV2PixelFormat inPixelFormat)
+{
+	return NTV2FrameConverter::IsSupportedPixelFormat(inPixelFormat);
+}
+
+
+NTV2PreviewCompositor::NTV2PreviewCompositor ()
+	:	mMaxThreads		(0),
+		mUseSIMD		(true),
+		mTimeBudget		(0),
+		mNumColumns		(0),
+		mNumRows		(0)
+{
+}
+
+
+bool NTV2PreviewCompositor::SetLayout (const UWord inNumColumns, const UWord inNumRows)
+{
+	if (!inNumColumns  ||  !inNumRows  ||  ULWord(inNumColumns) * inNumRows > kMaxTiles)
+		return false;
+	mNumColumns = inNumColumns;
+	mNumRows = inNumRows;
+	mTiles.clear();
+	mTiles.resize(size_t(inNumColumns) * inNumRows);
+	Invalidate();
+	return true;
+}
+
+
+bool NTV2PreviewCompositor::SetTileFrame (const UWord inTileIndex, const NTV2Buffer & inFrame, const NTV2FormatDescriptor & inDesc)
+{
+	if (inTileIndex >= mTiles.size())
+		return false;
+	if (!IsSupportedTileFormat(inDesc.GetPixelFormat()))
+		return false;
+	if (!inDesc.GetRasterWidth()  ||  !inDesc.GetVisibleRasterHeight()  ||  !inDesc.GetBytesPerRow())
+		return false;
+	if (inFrame.IsNULL()  ||  inFrame.GetByteCount() < inDesc.GetTotalBytes())
+		return false;
+
+	Tile &	tile (mTiles[inTileIndex]);
+	if (tile.fDesc.GetPixelFormat() != inDesc.GetPixelFormat()  ||  tile.fDesc.GetRasterWidth() != inDesc.GetRasterWidth()
+		||  tile.fDesc.GetBytesPerRow() != inDesc.GetBytesPerRow())
+	{	//	New geometry:  make sure whole rows (rounded up to whole packing groups) can be unpacked...
+		vector<UWord>	row (size_t(RoundUp(inDesc.GetRasterWidth(), NTV2FrameConverter::GetPixelGroupSize(inDesc.GetPixelFormat()))) * 4);
+		if (!NTV2FrameConverter::UnpackPixels (inFrame.GetHostPointer(), inDesc, inDesc.GetFirstActiveLine(), 0, ULWord(row.size() / 4), &row[0]))
+			return false;
+		tile.fIsYUV = !NTV2_IS_FBF_RGB(inDesc.GetPixelFormat());
+		if (tile.fIsYUV)
+			tile.fCSC.SetMatrix(CNTV2CSCMatrix(NTV2HostCSC::GetMatrixType(true, NTV2_HOSTCSC_AUTO, false, inDesc.GetRasterWidth())));
+	}
+	tile.fFrame = reinterpret_cast<const UByte*>(inFrame.GetHostPointer());
+	tile.fDesc = inDesc;
+	tile.fPending++;
+	return true;
+}
+
+
+bool NTV2PreviewCompositor::ClearTile (const UWord inTileIndex)
+{
+	if (inTileIndex >= mTiles.size())
+		return false;
+	Tile &	tile (mTiles[inTileIndex]);
+	tile.fFrame = AJA_NULL;
+	tile.fPending = 0;
+	tile.fNeedsClear = true;
+	return true;
+}
+
+
+void NTV2PreviewCompositor::Invalidate (void)
+{
+	for (size_t ndx(0);  ndx < mTiles.size();  ndx++)
+		if (mTiles[ndx].fFrame)
+			mTiles[ndx].fPending = mTiles[ndx].fInterval;	//	Render it regardless of its interval
+		else
+			mTiles[ndx].fNeedsClear = true;
+	mMosaicDesc = NTV2FormatDescriptor();
+}
+
+
+NTV2PreviewCompositor & NTV2PreviewCompositor::setTileInterval (const UWord inTileIndex, const ULWord inInterval)
+{
+	if (inTileIndex < mTiles.size()  &&  inInterval  &&  inInterval <= kMaxInterval)
+		mTiles[inTileIndex].fInterval = inInterval;
+	return *this;
+}
+
+ULWord NTV2PreviewCompositor::getTileInterval (const UWord inTileIndex) const
+{
+	return inTileIndex < mTiles.size() ? mTiles[inTileIndex].fInterval : 0;
+}
+
+
+bool NTV2PreviewCompositor::Composite (NTV2Buffer & inMosaic, const NTV2FormatDescriptor & inMosaicDesc)
+{
+	const uint64_t	startMicrosecs (AJATime::GetSystemMicroseconds());
+	if (mTiles.empty())
+		return false;	//	No layout
+	if (!IsSupportedMosaicFormat(inMosaicDesc.GetPixelFormat()))
+		return false;
+	const ULWord	tileWidth	(inMosaicDesc.GetRasterWidth() / mNumColumns);
+	const ULWord	tileHeight	(inMosaicDesc.GetVisibleRasterHeight() / mNumRows);
+	if (!tileWidth  ||  !tileHeight  ||  inMosaicDesc.GetBytesPerRow() < inMosaicDesc.GetRasterWidth() * 4)
+		return false;
+	if (inMosaic.IsNULL()  ||  inMosaic.GetByteCount() < inMosaicDesc.GetTotalBytes())
+		return false;	//	Mosaic too small
+
+	//	A different mosaic geometry means everything must be redrawn...
+	if (mMosaicDesc.GetPixelFormat() != inMosaicDesc.GetPixelFormat()  ||  mMosaicDesc.GetRasterWidth() != inMosaicDesc.GetRasterWidth()
+		||  mMosaicDesc.GetFullRasterHeight() != inMosaicDesc.GetFullRasterHeight()  ||  mMosaicDesc.GetBytesPerRow() != inMosaicDesc.GetBytesPerRow())
+			Invalidate();
+	mMosaicDesc = inMosaicDesc;
+
+	//	Decide which tiles to render...
+	Stats	stats;
+	ULWord	maxSrcPixels (0),  costliest (0);
+	for (size_t ndx(0);  ndx < mTiles.size();  ndx++)
+	{
+		Tile &	tile (mTiles[ndx]);
+		tile.fRender = tile.fFrame  &&  tile.fPending >= tile.fInterval;
+		if (tile.fRender)
+		{
+			const ULWord	srcPixels (RoundUp(tile.fDesc.GetRasterWidth(), NTV2FrameConverter::GetPixelGroupSize(tile.fDesc.GetPixelFormat())));
+			BuildSpans (tile, tile.fDesc.GetRasterWidth(), tileWidth);
+			maxSrcPixels = srcPixels > maxSrcPixels ? srcPixels : maxSrcPixels;
+			stats.fSourcePixels += uint64_t(srcPixels) * (tile.fDesc.GetVisibleRasterHeight() < 2 * tileHeight ? tile.fDesc.GetVisibleRasterHeight() : 2 * tileHeight);
+			stats.fTilesRendered++;
+		}
+		else if (tile.fNeedsClear)
+			stats.fTilesCleared++;
+		if (!tile.fRender  &&  tile.fPending)
+			stats.fTilesSkipped++;
+		if (tile.fFrame  &&  uint64_t(tile.fDesc.GetRasterWidth()) * tile.fDesc.GetVisibleRasterHeight() / tile.fInterval
+							> uint64_t(mTiles[costliest].fDesc.GetRasterWidth()) * mTiles[costliest].fDesc.GetVisibleRasterHeight() / mTiles[costliest].fInterval)
+			costliest = ULWord(ndx);
+	}
+
+	const ULWord	maxWorkers	(mMaxThreads  &&  mMaxThreads < NTV2ParallelRowsMaxWorkers() ? mMaxThreads : NTV2ParallelRowsMaxWorkers());
+	CompositeJob	job;
+	job.fTiles			= &mTiles[0];
+	job.fNumColumns		= mNumColumns;
+	job.fTileWidth		= tileWidth;
+	job.fTileHeight		= tileHeight;
+	job.fMosaicDesc		= &inMosaicDesc;
+	job.fMosaicBase		= reinterpret_cast<UByte*>(inMosaic.GetHostPointer());
+	job.fSrcWords		= size_t(RoundUp(maxSrcPixels > tileWidth ? maxSrcPixels : tileWidth, 8)) * 4;
+	job.fWorkerWords	= 2 * job.fSrcWords + size_t(RoundUp(tileWidth, 8)) * 4;
+	job.fUseSIMD		= mUseSIMD;
+	if (mScratch.size() < job.fWorkerWords * maxWorkers)
+		mScratch.resize(job.fWorkerWords * maxWorkers);
+	job.fScratch		= &mScratch[0];
+	if (stats.fTilesRendered  ||  stats.fTilesCleared)
+		stats.fNumWorkers = NTV2ParallelRows (tileHeight * mNumRows, CompositeRowRange, &job, maxWorkers);
+
+	for (size_t ndx(0);  ndx < mTiles.size();  ndx++)
+	{
+		Tile &	tile (mTiles[ndx]);
+		if (tile.fRender)
+			tile.fPending = 0;
+		tile.fNeedsClear = tile.fRender = false;
+	}
+	stats.fMicroseconds = AJATime::GetSystemMicroseconds() - startMicrosecs;
+
+	//	Adapt the tile update intervals to the time budget...
+	if (mTimeBudget  &&  stats.fTilesRendered)
+	{
+		if (stats.fMicroseconds > mTimeBudget)
+		{	//	Over budget:  update the costliest tile half as often
+			if (mTiles[costliest].fFrame  &&  mTiles[costliest].fInterval * 2 <= kMaxInterval)
+				mTiles[costliest].fInterval *= 2;
+		}
+		else if (stats.fMicroseconds < mTimeBudget / 2)
+		{	//	Well under budget:  update the least frequently updated tile twice as often
+			size_t	slowest (0);
+			for (size_t ndx(1);  ndx < mTiles.size();  ndx++)
+				if (mTiles[ndx].fInterval > mTiles[slowest].fInterval)
+					slowest = ndx;
+			if (mTiles[slowest].fInterval > 1)
+				mTiles[slowest].fInterval /= 2;
+		}
+	}
+	mStats = stats;
+	return true;
+}
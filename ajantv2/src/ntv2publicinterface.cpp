@@ -21,9 +21,27 @@
 #include <algorithm>	//	For set_difference
 #include <iterator>		//	For std::inserter
 #include "ntv2rp188.h"
+#include "ntv2parallel.h"
 #if !defined(MSWindows)
 	#include <unistd.h>
 #endif
+#if defined(NTV2_USE_CPLUSPLUS11)
+	#include <atomic>
+#endif	//	NTV2_USE_CPLUSPLUS11
+#if defined(__SSE2__) || defined(_M_X64)
+	#include <emmintrin.h>
+	#define	NTV2_BUFFER_SSE2	1
+	#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+		#include <immintrin.h>
+		#define	NTV2_BUFFER_AVX2	1
+		#define	NTV2_AVX2_FUNC		__attribute__((target("avx2")))
+	#elif defined(_MSC_VER)
+		#include <immintrin.h>
+		#include <intrin.h>
+		#define	NTV2_BUFFER_AVX2	1
+		#define	NTV2_AVX2_FUNC
+	#endif
+#endif	//	__SSE2__ || _M_X64
 using namespace std;
 
 //#define NTV2BUFFER_NO_MEMCMP
@@ -1791,42 +1809,520 @@ NTV2Buffer::~NTV2Buffer ()
 }
 
 
-bool NTV2Buffer::ByteSwap64 (void)
+/////////// NTV2Buffer Bulk Operations
+
+//	Bulk operations pick the best kernel for the host CPU at run-time:  AVX2 if the CPU supports it,
+//	otherwise SSE2 (always available on x86_64), otherwise portable 64-bit-word loops.
+enum {kBufferSIMDNone, kBufferSIMDSSE2, kBufferSIMDAVX2};
+
+static bool				gBufferUseSIMD			(true);
+static size_t			gBufferParallelThreshold(8 * 1024 * 1024);
+static const size_t		kBufferBlockSize		(64 * 1024);	//	Unit of work handed to NTV2ParallelRows
+static const size_t		kBufferHashBlockSize	(1024 * 1024);	//	GetHash64 block size (changing it changes the hash)
+
+static int DetectBufferSIMDLevel (void)
 {
-	uint64_t *	pU64s(reinterpret_cast<uint64_t*>(GetHostPointer()));
-	const size_t loopCount(GetByteCount() / sizeof(uint64_t));
-	if (IsNULL())
+#if defined(NTV2_BUFFER_AVX2) && defined(__GNUC__)
+	__builtin_cpu_init();
+	if (__builtin_cpu_supports("avx2"))
+		return kBufferSIMDAVX2;
+#elif defined(NTV2_BUFFER_AVX2) && defined(_MSC_VER)
+	int info[4];
+	__cpuid(info, 0);
+	if (info[0] >= 7)
+	{
+		__cpuid(info, 1);
+		const bool osUsesXSave ((info[2] & (1 << 27)) != 0),  hasAVX ((info[2] & (1 << 28)) != 0);
+		if (osUsesXSave  &&  hasAVX  &&  (_xgetbv(0) & 6) == 6)	//	OS saves YMM state?
+		{
+			__cpuidex(info, 7, 0);
+			if (info[1] & (1 << 5))
+				return kBufferSIMDAVX2;
+		}
+	}
+#endif
+#if defined(NTV2_BUFFER_SSE2)
+	return kBufferSIMDSSE2;
+#else
+	return kBufferSIMDNone;
+#endif
+}
+
+static inline int BufferSIMDLevel (void)
+{
+	static const int sHostLevel (DetectBufferSIMDLevel());
+	return gBufferUseSIMD ? sHostLevel : kBufferSIMDNone;
+}
+
+static inline ULWord LowestSetBit (const ULWord inMask)	//	inMask must be non-zero
+{
+#if defined(__GNUC__)
+	return ULWord(__builtin_ctz(inMask));
+#else
+	ULWord result(0);
+	while (!(inMask & (1UL << result)))
+		result++;
+	return result;
+#endif
+}
+
+//	Calls inFunc for every kBufferBlockSize (or inBlockSize) block, spreading them across threads if the buffer is big enough
+static ULWord ForEachBufferBlock (const size_t inByteCount, const size_t inBlockSize, NTV2RowRangeFunc inFunc, void * pInContext)
+{
+	const ULWord numBlocks (ULWord((inByteCount + inBlockSize - 1) / inBlockSize));
+	if (!numBlocks)
+		return 0;
+	if (numBlocks < 2  ||  !gBufferParallelThreshold  ||  inByteCount < gBufferParallelThreshold)
+		{inFunc(pInContext, 0, 0, numBlocks);  return 1;}
+	return ::NTV2ParallelRows (numBlocks, inFunc, pInContext);
+}
+
+
+//	FirstDifference:  returns the offset of the first byte that differs, or inByteCount if none do
+static size_t FirstDifferenceScalar (const UByte * pA, const UByte * pB, const size_t inByteCount)
+{
+	size_t ndx(0);
+	for (;  ndx + 8 <= inByteCount;  ndx += 8)
+	{
+		uint64_t a, b;
+		::memcpy(&a, pA + ndx, 8);
+		::memcpy(&b, pB + ndx, 8);
+		if (a != b)
+			break;
+	}
+	for (;  ndx < inByteCount;  ndx++)
+		if (pA[ndx] != pB[ndx])
+			break;
+	return ndx;
+}
+
+#if defined(NTV2_BUFFER_SSE2)
+static size_t FirstDifferenceSSE2 (const UByte * pA, const UByte * pB, const size_t inByteCount)
+{
+	size_t ndx(0);
+	for (;  ndx + 64 <= inByteCount;  ndx += 64)
+	{	//	Check 64 bytes per pass, then find the differing byte 16 at a time below
+		const __m128i eq0 (_mm_cmpeq_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i*>(pA + ndx)),		_mm_loadu_si128(reinterpret_cast<const __m128i*>(pB + ndx))));
+		const __m128i eq1 (_mm_cmpeq_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i*>(pA + ndx + 16)),	_mm_loadu_si128(reinterpret_cast<const __m128i*>(pB + ndx + 16))));
+		const __m128i eq2 (_mm_cmpeq_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i*>(pA + ndx + 32)),	_mm_loadu_si128(reinterpret_cast<const __m128i*>(pB + ndx + 32))));
+		const __m128i eq3 (_mm_cmpeq_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i*>(pA + ndx + 48)),	_mm_loadu_si128(reinterpret_cast<const __m128i*>(pB + ndx + 48))));
+		if (_mm_movemask_epi8(_mm_and_si128(_mm_and_si128(eq0, eq1), _mm_and_si128(eq2, eq3))) != 0xFFFF)
+			break;
+	}
+	for (;  ndx + 16 <= inByteCount;  ndx += 16)
+	{
+		const int eqMask (_mm_movemask_epi8(_mm_cmpeq_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i*>(pA + ndx)),
+															_mm_loadu_si128(reinterpret_cast<const __m128i*>(pB + ndx)))));
+		if (eqMask != 0xFFFF)
+			return ndx + LowestSetBit(ULWord(~eqMask) & 0xFFFF);
+	}
+	return ndx + FirstDifferenceScalar(pA + ndx, pB + ndx, inByteCount - ndx);
+}
+#endif	//	NTV2_BUFFER_SSE2
+
+#if defined(NTV2_BUFFER_AVX2)
+NTV2_AVX2_FUNC static size_t FirstDifferenceAVX2 (const UByte * pA, const UByte * pB, const size_t inByteCount)
+{
+	size_t ndx(0);
+	for (;  ndx + 64 <= inByteCount;  ndx += 64)
+	{
+		const __m256i eq0 (_mm256_cmpeq_epi8(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(pA + ndx)),		_mm256_loadu_si256(reinterpret_cast<const __m256i*>(pB + ndx))));
+		const __m256i eq1 (_mm256_cmpeq_epi8(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(pA + ndx + 32)),	_mm256_loadu_si256(reinterpret_cast<const __m256i*>(pB + ndx + 32))));
+		if (ULWord(_mm256_movemask_epi8(_mm256_and_si256(eq0, eq1))) != 0xFFFFFFFF)
+			break;
+	}
+	for (;  ndx + 32 <= inByteCount;  ndx += 32)
+	{
+		const ULWord eqMask (ULWord(_mm256_movemask_epi8(_mm256_cmpeq_epi8(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(pA + ndx)),
+																			_mm256_loadu_si256(reinterpret_cast<const __m256i*>(pB + ndx))))));
+		if (eqMask != 0xFFFFFFFF)
+			return ndx + LowestSetBit(~eqMask);
+	}
+	return ndx + FirstDifferenceScalar(pA + ndx, pB + ndx, inByteCount - ndx);
+}
+#endif	//	NTV2_BUFFER_AVX2
+
+static size_t FirstDifference (const UByte * pA, const UByte * pB, const size_t inByteCount)
+{
+	switch (BufferSIMDLevel())
+	{
+	#if defined(NTV2_BUFFER_AVX2)
+		case kBufferSIMDAVX2:	return FirstDifferenceAVX2(pA, pB, inByteCount);
+	#endif
+	#if defined(NTV2_BUFFER_SSE2)
+		case kBufferSIMDSSE2:	return FirstDifferenceSSE2(pA, pB, inByteCount);
+	#endif
+		default:				break;
+	}
+	return FirstDifferenceScalar(pA, pB, inByteCount);
+}
+
+typedef struct BufferCompareJob
+{
+	const UByte *	pA;
+	const UByte *	pB;
+	size_t			byteCount;
+#if defined(NTV2_USE_CPLUSPLUS11)
+	std::atomic<size_t>	firstDiff;	//	Lowest differing offset found so far (byteCount if none)
+#else
+	size_t				firstDiff;
+#endif
+} BufferCompareJob;
+
+static void CompareBufferBlocks (void * pInContext, const ULWord inWorkerIndex, const ULWord inFirstBlock, const ULWord inNumBlocks)
+{	(void) inWorkerIndex;
+	BufferCompareJob &	job (*reinterpret_cast<BufferCompareJob*>(pInContext));
+	const size_t		endOffset (std::min(size_t(inFirstBlock + inNumBlocks) * kBufferBlockSize, job.byteCount));
+	for (size_t offset(size_t(inFirstBlock) * kBufferBlockSize);  offset < endOffset;  offset += kBufferBlockSize)
+	{
+		size_t found (job.firstDiff);
+		if (found <= offset)
+			return;	//	Another worker already found an earlier difference
+		const size_t	blockBytes (std::min(kBufferBlockSize, endOffset - offset));
+		const size_t	diff (FirstDifference(job.pA + offset, job.pB + offset, blockBytes));
+		if (diff < blockBytes)
+		{	//	Record it if it's the earliest so far
+		#if defined(NTV2_USE_CPLUSPLUS11)
+			while (offset + diff < found  &&  !job.firstDiff.compare_exchange_weak(found, offset + diff))
+				;
+		#else
+			if (offset + diff < found)
+				job.firstDiff = offset + diff;
+		#endif
+			return;
+		}
+	}
+}
+
+//	Returns the offset of the first differing byte, or inByteCount if none
+static size_t FindFirstDifference (const UByte * pA, const UByte * pB, const size_t inByteCount)
+{
+	BufferCompareJob	job;
+	job.pA = pA;  job.pB = pB;  job.byteCount = inByteCount;  job.firstDiff = inByteCount;
+	ForEachBufferBlock (inByteCount, kBufferBlockSize, CompareBufferBlocks, &job);
+	return job.firstDiff;
+}
+
+
+//	Fill:  writes the 8-byte pattern (the value repeated) starting at 8-byte-aligned offsets from the buffer start
+static void FillScalar (UByte * pDst, const size_t inByteCount, const uint64_t inPattern)
+{
+	size_t ndx(0);
+	for (;  ndx + 8 <= inByteCount;  ndx += 8)
+		::memcpy(pDst + ndx, &inPattern, 8);
+	::memcpy(pDst + ndx, &inPattern, inByteCount - ndx);
+}
+
+#if defined(NTV2_BUFFER_SSE2)
+static void FillSSE2 (UByte * pDst, const size_t inByteCount, const uint64_t inPattern)
+{
+	const __m128i	pattern (_mm_set1_epi64x(LWord64(inPattern)));
+	size_t ndx(0);
+	for (;  ndx + 64 <= inByteCount;  ndx += 64)
+	{
+		_mm_storeu_si128(reinterpret_cast<__m128i*>(pDst + ndx), pattern);
+		_mm_storeu_si128(reinterpret_cast<__m128i*>(pDst + ndx + 16), pattern);
+		_mm_storeu_si128(reinterpret_cast<__m128i*>(pDst + ndx + 32), pattern);
+		_mm_storeu_si128(reinterpret_cast<__m128i*>(pDst + ndx + 48), pattern);
+	}
+	for (;  ndx + 16 <= inByteCount;  ndx += 16)
+		_mm_storeu_si128(reinterpret_cast<__m128i*>(pDst + ndx), pattern);
+	FillScalar(pDst + ndx, inByteCount - ndx, inPattern);
+}
+#endif	//	NTV2_BUFFER_SSE2
+
+#if defined(NTV2_BUFFER_AVX2)
+NTV2_AVX2_FUNC static void FillAVX2 (UByte * pDst, const size_t inByteCount, const uint64_t inPattern)
+{
+	const __m256i	pattern (_mm256_set1_epi64x(LWord64(inPattern)));
+	size_t ndx(0);
+	for (;  ndx + 128 <= inByteCount;  ndx += 128)
+	{
+		_mm256_storeu_si256(reinterpret_cast<__m256i*>(pDst + ndx), pattern);
+		_mm256_storeu_si256(reinterpret_cast<__m256i*>(pDst + ndx + 32), pattern);
+		_mm256_storeu_si256(reinterpret_cast<__m256i*>(pDst + ndx + 64), pattern);
+		_mm256_storeu_si256(reinterpret_cast<__m256i*>(pDst + ndx + 96), pattern);
+	}
+	for (;  ndx + 32 <= inByteCount;  ndx += 32)
+		_mm256_storeu_si256(reinterpret_cast<__m256i*>(pDst + ndx), pattern);
+	FillScalar(pDst + ndx, inByteCount - ndx, inPattern);
+}
+#endif	//	NTV2_BUFFER_AVX2
+
+typedef struct BufferFillJob
+{
+	UByte *		pDst;
+	size_t		byteCount;
+	uint64_t	pattern;
+	int			simdLevel;
+} BufferFillJob;
+
+static void FillBufferBlocks (void * pInContext, const ULWord inWorkerIndex, const ULWord inFirstBlock, const ULWord inNumBlocks)
+{	(void) inWorkerIndex;
+	const BufferFillJob &	job (*reinterpret_cast<const BufferFillJob*>(pInContext));
+	const size_t			offset (size_t(inFirstBlock) * kBufferBlockSize);
+	const size_t			bytes (std::min(size_t(inFirstBlock + inNumBlocks) * kBufferBlockSize, job.byteCount) - offset);
+	switch (job.simdLevel)
+	{
+	#if defined(NTV2_BUFFER_AVX2)
+		case kBufferSIMDAVX2:	FillAVX2(job.pDst + offset, bytes, job.pattern);	break;
+	#endif
+	#if defined(NTV2_BUFFER_SSE2)
+		case kBufferSIMDSSE2:	FillSSE2(job.pDst + offset, bytes, job.pattern);	break;
+	#endif
+		default:				FillScalar(job.pDst + offset, bytes, job.pattern);	break;
+	}
+}
+
+
+//	ByteSwap:  swaps each 2, 4 or 8-byte word in place
+static void ByteSwapScalar (UByte * pData, const size_t inByteCount, const size_t inWordSize)
+{
+	switch (inWordSize)
+	{
+		case 2:	{UWord *	pU16s(reinterpret_cast<UWord*>(pData));
+				for (size_t ndx(0);  ndx < inByteCount / 2;  ndx++)
+					pU16s[ndx] = NTV2EndianSwap16(pU16s[ndx]);
+				break;}
+		case 4:	{ULWord *	pU32s(reinterpret_cast<ULWord*>(pData));
+				for (size_t ndx(0);  ndx < inByteCount / 4;  ndx++)
+					pU32s[ndx] = NTV2EndianSwap32(pU32s[ndx]);
+				break;}
+		case 8:	{ULWord64 *	pU64s(reinterpret_cast<ULWord64*>(pData));
+				for (size_t ndx(0);  ndx < inByteCount / 8;  ndx++)
+					pU64s[ndx] = NTV2EndianSwap64(pU64s[ndx]);
+				break;}
+		default:	break;
+	}
+}
+
+#if defined(NTV2_BUFFER_SSE2)
+static void ByteSwapSSE2 (UByte * pData, const size_t inByteCount, const size_t inWordSize)
+{	//	SSE2 has no byte shuffle, so swap the 16-bit words within each 32/64-bit word, then the bytes within each 16-bit word
+	size_t ndx(0);
+	for (;  ndx + 16 <= inByteCount;  ndx += 16)
+	{
+		__m128i	v (_mm_loadu_si128(reinterpret_cast<const __m128i*>(pData + ndx)));
+		if (inWordSize == 4)
+			v = _mm_shufflehi_epi16(_mm_shufflelo_epi16(v, _MM_SHUFFLE(2,3,0,1)), _MM_SHUFFLE(2,3,0,1));
+		else if (inWordSize == 8)
+			v = _mm_shufflehi_epi16(_mm_shufflelo_epi16(v, _MM_SHUFFLE(0,1,2,3)), _MM_SHUFFLE(0,1,2,3));
+		v = _mm_or_si128(_mm_slli_epi16(v, 8), _mm_srli_epi16(v, 8));
+		_mm_storeu_si128(reinterpret_cast<__m128i*>(pData + ndx), v);
+	}
+	ByteSwapScalar(pData + ndx, inByteCount - ndx, inWordSize);
+}
+#endif	//	NTV2_BUFFER_SSE2
+
+#if defined(NTV2_BUFFER_AVX2)
+NTV2_AVX2_FUNC static void ByteSwapAVX2 (UByte * pData, const size_t inByteCount, const size_t inWordSize)
+{
+	const __m128i	shuffle128 (inWordSize == 2	? _mm_setr_epi8(1,0, 3,2, 5,4, 7,6, 9,8, 11,10, 13,12, 15,14)
+								:	inWordSize == 4	? _mm_setr_epi8(3,2,1,0, 7,6,5,4, 11,10,9,8, 15,14,13,12)
+													: _mm_setr_epi8(7,6,5,4,3,2,1,0, 15,14,13,12,11,10,9,8));
+	const __m256i	shuffle (_mm256_broadcastsi128_si256(shuffle128));
+	size_t ndx(0);
+	for (;  ndx + 64 <= inByteCount;  ndx += 64)
+	{
+		const __m256i	v0 (_mm256_loadu_si256(reinterpret_cast<const __m256i*>(pData + ndx)));
+		const __m256i	v1 (_mm256_loadu_si256(reinterpret_cast<const __m256i*>(pData + ndx + 32)));
+		_mm256_storeu_si256(reinterpret_cast<__m256i*>(pData + ndx), _mm256_shuffle_epi8(v0, shuffle));
+		_mm256_storeu_si256(reinterpret_cast<__m256i*>(pData + ndx + 32), _mm256_shuffle_epi8(v1, shuffle));
+	}
+	for (;  ndx + 32 <= inByteCount;  ndx += 32)
+		_mm256_storeu_si256(reinterpret_cast<__m256i*>(pData + ndx),
+							_mm256_shuffle_epi8(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(pData + ndx)), shuffle));
+	ByteSwapScalar(pData + ndx, inByteCount - ndx, inWordSize);
+}
+#endif	//	NTV2_BUFFER_AVX2
+
+typedef struct BufferSwapJob
+{
+	UByte *		pData;
+	size_t		byteCount;	//	Multiple of wordSize
+	size_t		wordSize;
+	int			simdLevel;
+} BufferSwapJob;
+
+static void ByteSwapBufferBlocks (void * pInContext, const ULWord inWorkerIndex, const ULWord inFirstBlock, const ULWord inNumBlocks)
+{	(void) inWorkerIndex;
+	const BufferSwapJob &	job (*reinterpret_cast<const BufferSwapJob*>(pInContext));
+	const size_t			offset (size_t(inFirstBlock) * kBufferBlockSize);
+	const size_t			bytes (std::min(size_t(inFirstBlock + inNumBlocks) * kBufferBlockSize, job.byteCount) - offset);
+	switch (job.simdLevel)
+	{
+	#if defined(NTV2_BUFFER_AVX2)
+		case kBufferSIMDAVX2:	ByteSwapAVX2(job.pData + offset, bytes, job.wordSize);		break;
+	#endif
+	#if defined(NTV2_BUFFER_SSE2)
+		case kBufferSIMDSSE2:	ByteSwapSSE2(job.pData + offset, bytes, job.wordSize);		break;
+	#endif
+		default:				ByteSwapScalar(job.pData + offset, bytes, job.wordSize);	break;
+	}
+}
+
+static bool ByteSwapBuffer (NTV2Buffer & inBuffer, const size_t inWordSize)
+{
+	if (inBuffer.IsNULL())
 		return false;
-	for (size_t ndx(0);	 ndx < loopCount;  ndx++)
-		pU64s[ndx] = NTV2EndianSwap64(pU64s[ndx]);
+	BufferSwapJob	job;
+	job.pData = inBuffer;
+	job.byteCount = inBuffer.GetByteCount() / inWordSize * inWordSize;
+	job.wordSize = inWordSize;
+	job.simdLevel = BufferSIMDLevel();
+	ForEachBufferBlock (job.byteCount, kBufferBlockSize, ByteSwapBufferBlocks, &job);
 	return true;
 }
 
 
+//	XXH64 (see https://github.com/Cyan4973/xxHash), used by GetHash64
+static const uint64_t	kXXPrime1 (0x9E3779B185EBCA87ULL),	kXXPrime2 (0xC2B2AE3D27D4EB4FULL),	kXXPrime3 (0x165667B19E3779F9ULL),
+						kXXPrime4 (0x85EBCA77C2B2AE63ULL),	kXXPrime5 (0x27D4EB2F165667C5ULL);
+
+static inline uint64_t XXRotL (const uint64_t inValue, const int inBits)	{return (inValue << inBits) | (inValue >> (64 - inBits));}
+static inline uint64_t XXRead64 (const UByte * pIn)	{uint64_t v;  ::memcpy(&v, pIn, 8);  return NTV2EndianSwap64LtoH(v);}
+static inline uint64_t XXRead32 (const UByte * pIn)	{uint32_t v;  ::memcpy(&v, pIn, 4);  return NTV2EndianSwap32LtoH(v);}
+static inline uint64_t XXRound (uint64_t inAcc, const uint64_t inInput)	{inAcc += inInput * kXXPrime2;  return XXRotL(inAcc, 31) * kXXPrime1;}
+static inline uint64_t XXMerge (uint64_t inAcc, const uint64_t inVal)	{inAcc ^= XXRound(0, inVal);  return inAcc * kXXPrime1 + kXXPrime4;}
+
+static uint64_t XXHash64 (const UByte * pIn, const size_t inByteCount, const uint64_t inSeed)
+{
+	const UByte * const	pEnd (pIn + inByteCount);
+	uint64_t			h;
+	if (inByteCount >= 32)
+	{
+		uint64_t v1 (inSeed + kXXPrime1 + kXXPrime2),  v2 (inSeed + kXXPrime2),  v3 (inSeed),  v4 (inSeed - kXXPrime1);
+		const UByte * const	pLimit (pEnd - 32);
+		do
+		{
+			v1 = XXRound(v1, XXRead64(pIn));		v2 = XXRound(v2, XXRead64(pIn + 8));
+			v3 = XXRound(v3, XXRead64(pIn + 16));	v4 = XXRound(v4, XXRead64(pIn + 24));
+			pIn += 32;
+		} while (pIn <= pLimit);
+		h = XXRotL(v1, 1) + XXRotL(v2, 7) + XXRotL(v3, 12) + XXRotL(v4, 18);
+		h = XXMerge(h, v1);  h = XXMerge(h, v2);  h = XXMerge(h, v3);  h = XXMerge(h, v4);
+	}
+	else
+		h = inSeed + kXXPrime5;
+	h += uint64_t(inByteCount);
+	for (;  pIn + 8 <= pEnd;  pIn += 8)
+		h = XXRotL(h ^ XXRound(0, XXRead64(pIn)), 27) * kXXPrime1 + kXXPrime4;
+	if (pIn + 4 <= pEnd)
+		{h = XXRotL(h ^ (XXRead32(pIn) * kXXPrime1), 23) * kXXPrime2 + kXXPrime3;  pIn += 4;}
+	for (;  pIn < pEnd;  pIn++)
+		h = XXRotL(h ^ (*pIn * kXXPrime5), 11) * kXXPrime1;
+	h ^= h >> 33;  h *= kXXPrime2;
+	h ^= h >> 29;  h *= kXXPrime3;
+	h ^= h >> 32;
+	return h;
+}
+
+typedef struct BufferHashJob
+{
+	const UByte *	pData;
+	size_t			byteCount;
+	uint64_t		seed;
+	UByte *			pBlockHashes;	//	Little-endian 64-bit hash of each kBufferHashBlockSize block
+} BufferHashJob;
+
+static void HashBufferBlocks (void * pInContext, const ULWord inWorkerIndex, const ULWord inFirstBlock, const ULWord inNumBlocks)
+{	(void) inWorkerIndex;
+	const BufferHashJob &	job (*reinterpret_cast<const BufferHashJob*>(pInContext));
+	for (ULWord block(inFirstBlock);  block < inFirstBlock + inNumBlocks;  block++)
+	{
+		const size_t	offset (size_t(block) * kBufferHashBlockSize);
+		const uint64_t	hash (NTV2EndianSwap64HtoL(XXHash64(job.pData + offset, std::min(kBufferHashBlockSize, job.byteCount - offset), job.seed)));
+		::memcpy(job.pBlockHashes + size_t(block) * 8, &hash, 8);
+	}
+}
+
+
+bool NTV2Buffer::ByteSwap64 (void)
+{
+	return ByteSwapBuffer(*this, 8);
+}
+
+
 bool NTV2Buffer::ByteSwap32 (void)
 {
-	uint32_t *	pU32s(reinterpret_cast<uint32_t*>(GetHostPointer()));
-	const size_t loopCount(GetByteCount() / sizeof(uint32_t));
-	if (IsNULL())
-		return false;
-	for (size_t ndx(0);	 ndx < loopCount;  ndx++)
-		pU32s[ndx] = NTV2EndianSwap32(pU32s[ndx]);
-	return true;
+	return ByteSwapBuffer(*this, 4);
 }
 
 
 bool NTV2Buffer::ByteSwap16 (void)
 {
-	uint16_t *	pU16s(reinterpret_cast<uint16_t*>(GetHostPointer()));
-	const size_t loopCount(GetByteCount() / sizeof(uint16_t));
-	if (IsNULL())
+	return ByteSwapBuffer(*this, 2);
+}
+
+
+bool NTV2Buffer::FillPattern (const void * pInValue, const size_t inValueSize)
+{
+	if (IsNULL()  ||  !pInValue)
+		return false;
+	if (inValueSize != 1  &&  inValueSize != 2  &&  inValueSize != 4  &&  inValueSize != 8)
+		return false;
+	BufferFillJob	job;
+	job.pDst = *this;
+	job.byteCount = GetByteCount() / inValueSize * inValueSize;
+	if (!job.byteCount)
 		return false;
-	for (size_t ndx(0);	 ndx < loopCount;  ndx++)
-		pU16s[ndx] = NTV2EndianSwap16(pU16s[ndx]);
+	UByte * pPattern (reinterpret_cast<UByte*>(&job.pattern));
+	for (size_t ndx(0);  ndx < 8;  ndx += inValueSize)
+		::memcpy(pPattern + ndx, pInValue, inValueSize);	//	Replicate the value into all 8 pattern bytes
+	job.simdLevel = BufferSIMDLevel();
+	ForEachBufferBlock (job.byteCount, kBufferBlockSize, FillBufferBlocks, &job);
 	return true;
 }
 
 
+uint64_t NTV2Buffer::GetHash64 (const uint64_t inSeed) const
+{
+	if (IsNULL())
+		return 0;
+	const UByte *	pData (*this);
+	if (GetByteCount() <= kBufferHashBlockSize)
+		return XXHash64(pData, GetByteCount(), inSeed);
+
+	//	Hash each block, then hash the block hashes...
+	const size_t	numBlocks ((GetByteCount() + kBufferHashBlockSize - 1) / kBufferHashBlockSize);
+	std::vector<UByte>	blockHashes (numBlocks * 8);
+	BufferHashJob	job;
+	job.pData = pData;  job.byteCount = GetByteCount();  job.seed = inSeed;  job.pBlockHashes = &blockHashes[0];
+	ForEachBufferBlock (job.byteCount, kBufferHashBlockSize, HashBufferBlocks, &job);
+	return XXHash64(&blockHashes[0], blockHashes.size(), inSeed);
+}
+
+
+void NTV2Buffer::SetUseSIMD (const bool inUseSIMD)
+{
+	gBufferUseSIMD = inUseSIMD;
+}
+
+
+string NTV2Buffer::SIMDInstructionSet (void)
+{
+	switch (BufferSIMDLevel())
+	{
+		case kBufferSIMDAVX2:	return "AVX2";
+		case kBufferSIMDSSE2:	return "SSE2";
+		default:				break;
+	}
+	return "scalar";
+}
+
+
+size_t NTV2Buffer::ParallelThreshold (void)
+{
+	return gBufferParallelThreshold;
+}
+
+
+void NTV2Buffer::SetParallelThreshold (const size_t inByteCount)
+{
+	gBufferParallelThreshold = inByteCount;
+}
+
+
 bool NTV2Buffer::Set (const void * pInUserPointer, const size_t inByteCount)
 {
 	if (uint64_t(inByteCount) >= 0x0000000100000000)	//	inByteCount >= 4GB?
@@ -2101,7 +2597,7 @@ bool NTV2Buffer::IsContentEqual (const NTV2Buffer & inBuffer, const ULWord inByt
 	pByte1 += inByteOffset;
 	pByte2 += inByteOffset;
 	#if !defined(NTV2BUFFER_NO_MEMCMP)
-	return ::memcmp (pByte1, pByte2, byteCount) == 0;
+	return FindFirstDifference (pByte1, pByte2, byteCount) == byteCount;
 	#else	//	NTV2BUFFER_NO_MEMCMP
 		ULWord offset(inByteOffset);
 		while (byteCount)
@@ -2140,14 +2636,8 @@ bool NTV2Buffer::NextDifference (const NTV2Buffer & inBuffer, ULWord & byteOffse
 
 	const UByte * pByte1 (*this);
 	const UByte * pByte2 (inBuffer);
-	while (totalBytesToCompare)
-	{
-		if (pByte1[byteOffset] != pByte2[byteOffset])
-			return true;
-		totalBytesToCompare--;
-		byteOffset++;
-	}
-	byteOffset = 0xFFFFFFFF;
+	const size_t diff (FindFirstDifference (pByte1 + byteOffset, pByte2 + byteOffset, totalBytesToCompare));
+	byteOffset = diff < totalBytesToCompare ? byteOffset + ULWord(diff) : 0xFFFFFFFF;
 	return true;
 }
 
@@ -0,0 +1,537 @@
+/* SPDX-License-Identifier: MIT */
+/**
+	@file		ntv2rasterlayout.cpp
+	@brief		Implements the full-frame, quadrant and two-sample-interleave raster layout conversions.
+	@copyright	(C) 2026 AJA Video Systems, Inc.
+**/
+
+#include "ntv2rasterlayout.h"
+#include "ntv2parallel.h"
+#include "ntv2endian.h"
+#include <string.h>
+#include <vector>
+#if defined(__SSE2__)
+	#include <emmintrin.h>
+	#define	NTV2_RASTERLAYOUT_SSE2	1
+#endif	//	__SSE2__
+
+using namespace std;
+
+
+//////////////////////////////////////////////////////////////////////////////////////////////////////
+//	Pixel pair kernels
+//
+//	A "unit" is two adjacent sample pairs of a full row. Splitting sends the first (even) pair to one
+//	half row and the second (odd) pair to the other;  merging does the reverse.
+//////////////////////////////////////////////////////////////////////////////////////////////////////
+
+typedef void (*SplitFunc) (const UByte * pInRow, UByte * pOutEven, UByte * pOutOdd, const ULWord inNumUnits);
+typedef void (*MergeFunc) (const UByte * pInEven, const UByte * pInOdd, UByte * pOutRow, const ULWord inNumUnits);
+
+template <size_t PB> static void SplitPairs (const UByte * pIn, UByte * pEven, UByte * pOdd, const ULWord inNumUnits)
+{
+	for (ULWord unit(0);  unit < inNumUnits;  unit++, pIn += 2 * PB, pEven += PB, pOdd += PB)
+	{
+		::memcpy (pEven, pIn, PB);
+		::memcpy (pOdd, pIn + PB, PB);
+	}
+}
+
+template <size_t PB> static void MergePairs (const UByte * pEven, const UByte * pOdd, UByte * pOut, const ULWord inNumUnits)
+{
+	for (ULWord unit(0);  unit < inNumUnits;  unit++, pOut += 2 * PB, pEven += PB, pOdd += PB)
+	{
+		::memcpy (pOut, pEven, PB);
+		::memcpy (pOut + PB, pOdd, PB);
+	}
+}
+
+//	4-byte pairs (8-bit 4:2:2)
+static void Split4 (const UByte * pIn, UByte * pEven, UByte * pOdd, const ULWord inNumUnits)
+{
+	ULWord	unit(0);
+#if defined(NTV2_RASTERLAYOUT_SSE2)
+	for (;  unit + 4 <= inNumUnits;  unit += 4, pIn += 32, pEven += 16, pOdd += 16)
+	{	//	p0 p1 p2 p3 | p4 p5 p6 p7  ==>  p0 p2 p1 p3 | p4 p6 p5 p7  ==>  p0 p2 p4 p6 | p1 p3 p5 p7
+		const __m128i	a (_mm_shuffle_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i*>(pIn)),		_MM_SHUFFLE(3,1,2,0)));
+		const __m128i	b (_mm_shuffle_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i*>(pIn + 16)),	_MM_SHUFFLE(3,1,2,0)));
+		_mm_storeu_si128 (reinterpret_cast<__m128i*>(pEven),	_mm_unpacklo_epi64(a, b));
+		_mm_storeu_si128 (reinterpret_cast<__m128i*>(pOdd),		_mm_unpackhi_epi64(a, b));
+	}
+#endif	//	NTV2_RASTERLAYOUT_SSE2
+	SplitPairs<4> (pIn, pEven, pOdd, inNumUnits - unit);
+}
+
+static void Merge4 (const UByte * pEven, const UByte * pOdd, UByte * pOut, const ULWord inNumUnits)
+{
+	ULWord	unit(0);
+#if defined(NTV2_RASTERLAYOUT_SSE2)
+	for (;  unit + 4 <= inNumUnits;  unit += 4, pOut += 32, pEven += 16, pOdd += 16)
+	{
+		const __m128i	e (_mm_loadu_si128(reinterpret_cast<const __m128i*>(pEven)));
+		const __m128i	o (_mm_loadu_si128(reinterpret_cast<const __m128i*>(pOdd)));
+		_mm_storeu_si128 (reinterpret_cast<__m128i*>(pOut),			_mm_unpacklo_epi32(e, o));
+		_mm_storeu_si128 (reinterpret_cast<__m128i*>(pOut + 16),	_mm_unpackhi_epi32(e, o));
+	}
+#endif	//	NTV2_RASTERLAYOUT_SSE2
+	MergePairs<4> (pEven, pOdd, pOut, inNumUnits - unit);
+}
+
+//	8-byte pairs (8-bit RGBA, 10-bit RGB, etc.)
+static void Split8 (const UByte * pIn, UByte * pEven, UByte * pOdd, const ULWord inNumUnits)
+{
+	ULWord	unit(0);
+#if defined(NTV2_RASTERLAYOUT_SSE2)
+	for (;  unit + 2 <= inNumUnits;  unit += 2, pIn += 32, pEven += 16, pOdd += 16)
+	{
+		const __m128i	a (_mm_loadu_si128(reinterpret_cast<const __m128i*>(pIn)));
+		const __m128i	b (_mm_loadu_si128(reinterpret_cast<const __m128i*>(pIn + 16)));
+		_mm_storeu_si128 (reinterpret_cast<__m128i*>(pEven),	_mm_unpacklo_epi64(a, b));
+		_mm_storeu_si128 (reinterpret_cast<__m128i*>(pOdd),		_mm_unpackhi_epi64(a, b));
+	}
+#endif	//	NTV2_RASTERLAYOUT_SSE2
+	SplitPairs<8> (pIn, pEven, pOdd, inNumUnits - unit);
+}
+
+static void Merge8 (const UByte * pEven, const UByte * pOdd, UByte * pOut, const ULWord inNumUnits)
+{
+	ULWord	unit(0);
+#if defined(NTV2_RASTERLAYOUT_SSE2)
+	for (;  unit + 2 <= inNumUnits;  unit += 2, pOut += 32, pEven += 16, pOdd += 16)
+	{
+		const __m128i	e (_mm_loadu_si128(reinterpret_cast<const __m128i*>(pEven)));
+		const __m128i	o (_mm_loadu_si128(reinterpret_cast<const __m128i*>(pOdd)));
+		_mm_storeu_si128 (reinterpret_cast<__m128i*>(pOut),			_mm_unpacklo_epi64(e, o));
+		_mm_storeu_si128 (reinterpret_cast<__m128i*>(pOut + 16),	_mm_unpackhi_epi64(e, o));
+	}
+#endif	//	NTV2_RASTERLAYOUT_SSE2
+	MergePairs<8> (pEven, pOdd, pOut, inNumUnits - unit);
+}
+
+//	'v210' and 10-bit YCbCr DPX:  a unit is 12 pixels (8 words), whose 3 even and 3 odd pairs each fill one 6-pixel group
+template <bool DPX> static inline void UnpackV210Words (const UByte * pIn, const ULWord inNumWords, UWord * pOut)
+{
+	for (ULWord ndx(0);  ndx < inNumWords;  ndx++, pIn += 4, pOut += 3)
+	{
+		ULWord	word(0);
+		::memcpy (&word, pIn, 4);
+		if (DPX)
+			word = ULWord(NTV2EndianSwap32(word)) >> 2;
+		pOut[0] = UWord(word & 0x3FF);  pOut[1] = UWord((word >> 10) & 0x3FF);  pOut[2] = UWord((word >> 20) & 0x3FF);
+	}
+}
+
+template <bool DPX> static inline void PackV210Words (const UWord * pIn, const ULWord inNumWords, UByte * pOut)
+{
+	for (ULWord ndx(0);  ndx < inNumWords;  ndx++, pIn += 3, pOut += 4)
+	{
+		ULWord	word (ULWord(pIn[0]) | (ULWord(pIn[1]) << 10) | (ULWord(pIn[2]) << 20));
+		if (DPX)
+			word = ULWord(NTV2EndianSwap32(word << 2));
+		::memcpy (pOut, &word, 4);
+	}
+}
+
+template <bool DPX> static void SplitV210 (const UByte * pIn, UByte * pEven, UByte * pOdd, const ULWord inNumUnits)
+{
+	UWord	comps[24], even[12], odd[12];
+	for (ULWord unit(0);  unit < inNumUnits;  unit++, pIn += 32, pEven += 16, pOdd += 16)
+	{
+		UnpackV210Words<DPX> (pIn, 8, comps);
+		for (unsigned pair(0);  pair < 3;  pair++)
+		{	//	Each pair is Cb Y Cr Y
+			::memcpy (even + pair * 4,	comps + pair * 8,		4 * sizeof(UWord));
+			::memcpy (odd + pair * 4,	comps + pair * 8 + 4,	4 * sizeof(UWord));
+		}
+		PackV210Words<DPX> (even, 4, pEven);
+		PackV210Words<DPX> (odd, 4, pOdd);
+	}
+}
+
+template <bool DPX> static void MergeV210 (const UByte * pEven, const UByte * pOdd, UByte * pOut, const ULWord inNumUnits)
+{
+	UWord	comps[24], even[12], odd[12];
+	for (ULWord unit(0);  unit < inNumUnits;  unit++, pOut += 32, pEven += 16, pOdd += 16)
+	{
+		UnpackV210Words<DPX> (pEven, 4, even);
+		UnpackV210Words<DPX> (pOdd, 4, odd);
+		for (unsigned pair(0);  pair < 3;  pair++)
+		{
+			::memcpy (comps + pair * 8,		even + pair * 4,	4 * sizeof(UWord));
+			::memcpy (comps + pair * 8 + 4,	odd + pair * 4,		4 * sizeof(UWord));
+		}
+		PackV210Words<DPX> (comps, 8, pOut);
+	}
+}
+
+typedef struct TSIKernel
+{
+	ULWord		fHalfUnitBytes;	///< @brief	Bytes each unit contributes to each half row
+	SplitFunc	fSplit;
+	MergeFunc	fMerge;
+} TSIKernel;
+
+static bool GetTSIKernel (const NTV2PixelFormat inPixelFormat, TSIKernel & outKernel)
+{
+	switch (inPixelFormat)
+	{
+		case NTV2_FBF_8BIT_YCBCR:
+		case NTV2_FBF_8BIT_YCBCR_YUY2:
+			outKernel.fHalfUnitBytes = 4;	outKernel.fSplit = Split4;				outKernel.fMerge = Merge4;				return true;
+		case NTV2_FBF_ARGB:
+		case NTV2_FBF_RGBA:
+		case NTV2_FBF_ABGR:
+		case NTV2_FBF_10BIT_RGB:
+		case NTV2_FBF_10BIT_DPX:
+		case NTV2_FBF_10BIT_DPX_LE:
+		case NTV2_FBF_10BIT_YCBCRA:
+		case NTV2_FBF_10BIT_RGB_PACKED:
+			outKernel.fHalfUnitBytes = 8;	outKernel.fSplit = Split8;				outKernel.fMerge = Merge8;				return true;
+		case NTV2_FBF_24BIT_RGB:
+		case NTV2_FBF_24BIT_BGR:
+			outKernel.fHalfUnitBytes = 6;	outKernel.fSplit = SplitPairs<6>;		outKernel.fMerge = MergePairs<6>;		return true;
+		case NTV2_FBF_12BIT_RGB_PACKED:
+			outKernel.fHalfUnitBytes = 9;	outKernel.fSplit = SplitPairs<9>;		outKernel.fMerge = MergePairs<9>;		return true;
+		case NTV2_FBF_10BIT_ARGB:
+			outKernel.fHalfUnitBytes = 10;	outKernel.fSplit = SplitPairs<10>;		outKernel.fMerge = MergePairs<10>;		return true;
+		case NTV2_FBF_48BIT_RGB:
+			outKernel.fHalfUnitBytes = 12;	outKernel.fSplit = SplitPairs<12>;		outKernel.fMerge = MergePairs<12>;		return true;
+		case NTV2_FBF_16BIT_ARGB:
+			outKernel.fHalfUnitBytes = 16;	outKernel.fSplit = SplitPairs<16>;		outKernel.fMerge = MergePairs<16>;		return true;
+		case NTV2_FBF_10BIT_YCBCR:
+			outKernel.fHalfUnitBytes = 16;	outKernel.fSplit = SplitV210<false>;	outKernel.fMerge = MergeV210<false>;	return true;
+		case NTV2_FBF_10BIT_YCBCR_DPX:
+			outKernel.fHalfUnitBytes = 16;	outKernel.fSplit = SplitV210<true>;		outKernel.fMerge = MergeV210<true>;		return true;
+		default:
+			break;
+	}
+	return false;
+}
+
+
+//////////////////////////////////////////////////////////////////////////////////////////////////////
+//	Layout geometry
+//////////////////////////////////////////////////////////////////////////////////////////////////////
+
+typedef struct LayoutGeometry
+{
+	ULWord		fRowBytes;		///< @brief	Bytes per full row
+	ULWord		fHalfBytes;		///< @brief	Bytes per half row (i.e. per sub-image row)
+	ULWord		fNumRows;		///< @brief	Full raster rows
+	ULWord		fSubRows;		///< @brief	Sub-image rows
+	ULWord		fNumUnits;		///< @brief	TSI units per full row
+	TSIKernel	fTSI;			///< @brief	TSI kernel (if TSI needed)
+} LayoutGeometry;
+
+static bool InitGeometry (LayoutGeometry & outGeom, const ULWord inRowBytes, const ULWord inNumRows,
+						const NTV2PixelFormat inPixelFormat, const bool inNeedTSI)
+{
+	if (!inRowBytes  ||  !inNumRows  ||  (inRowBytes & 1)  ||  (inNumRows & 1))
+		return false;
+	outGeom.fRowBytes	= inRowBytes;
+	outGeom.fHalfBytes	= inRowBytes / 2;
+	outGeom.fNumRows	= inNumRows;
+	outGeom.fSubRows	= inNumRows / 2;
+	outGeom.fNumUnits	= 0;
+	outGeom.fTSI.fHalfUnitBytes = 0;  outGeom.fTSI.fSplit = AJA_NULL;  outGeom.fTSI.fMerge = AJA_NULL;
+	if (!inNeedTSI)
+		return true;
+	if (!GetTSIKernel(inPixelFormat, outGeom.fTSI))
+		return false;	//	Pixel pairs aren't byte-addressable
+	if (outGeom.fHalfBytes % outGeom.fTSI.fHalfUnitBytes)
+		return false;	//	Half row must hold a whole number of units
+	outGeom.fNumUnits = outGeom.fHalfBytes / outGeom.fTSI.fHalfUnitBytes;
+	return true;
+}
+
+//	Returns the "slot" (half-row index) that holds half "inHalf" (0=left/even, 1=right/odd) of full row "inRow"
+static inline ULWord HalfRowSlot (const LayoutGeometry & inGeom, const NTV2RasterLayout inLayout, const ULWord inRow, const ULWord inHalf)
+{
+	switch (inLayout)
+	{
+		case NTV2_RASTER_LAYOUT_QUADRANTS:
+		{
+			const bool	lower (inRow >= inGeom.fSubRows);
+			return ((lower ? 2 : 0) + inHalf) * inGeom.fSubRows  +  (lower ? inRow - inGeom.fSubRows : inRow);
+		}
+		case NTV2_RASTER_LAYOUT_TSI:
+			return ((inRow & 1) * 2 + inHalf) * inGeom.fSubRows  +  inRow / 2;
+		default:
+			break;
+	}
+	return inRow * 2 + inHalf;
+}
+
+static inline ULWord HalfRowOffset (const LayoutGeometry & inGeom, const NTV2RasterLayout inLayout, const ULWord inRow, const ULWord inHalf)
+{
+	return HalfRowSlot(inGeom, inLayout, inRow, inHalf) * inGeom.fHalfBytes;
+}
+
+static ULWord GetNumWorkers (const ULWord inMaxWorkers)
+{
+	const ULWord	maxWorkers (NTV2ParallelRowsMaxWorkers());
+	return inMaxWorkers  &&  inMaxWorkers < maxWorkers  ?  inMaxWorkers  :  maxWorkers;
+}
+
+
+//////////////////////////////////////////////////////////////////////////////////////////////////////
+//	Out-of-place conversion
+//////////////////////////////////////////////////////////////////////////////////////////////////////
+
+typedef struct LayoutJob
+{
+	const LayoutGeometry *	fGeom;
+	const UByte *			fSrc;
+	UByte *					fDst;
+	NTV2RasterLayout		fSrcLayout;
+	NTV2RasterLayout		fDstLayout;
+	UByte *					fScratch;		///< @brief	One full row per worker
+} LayoutJob;
+
+//	Gathers full row "inRow" from the given layout
+static void ReadRow (const LayoutGeometry & inGeom, const NTV2RasterLayout inLayout, const UByte * pInBase, const ULWord inRow, UByte * pOutRow)
+{
+	const UByte	*pLeft (pInBase + HalfRowOffset(inGeom, inLayout, inRow, 0)),  *pRight (pInBase + HalfRowOffset(inGeom, inLayout, inRow, 1));
+	if (inLayout == NTV2_RASTER_LAYOUT_TSI)
+		inGeom.fTSI.fMerge (pLeft, pRight, pOutRow, inGeom.fNumUnits);
+	else
+	{
+		::memcpy (pOutRow, pLeft, inGeom.fHalfBytes);
+		::memcpy (pOutRow + inGeom.fHalfBytes, pRight, inGeom.fHalfBytes);
+	}
+}
+
+//	Scatters full row "inRow" into the given layout
+static void WriteRow (const LayoutGeometry & inGeom, const NTV2RasterLayout inLayout, const UByte * pInRow, UByte * pOutBase, const ULWord inRow)
+{
+	UByte	*pLeft (pOutBase + HalfRowOffset(inGeom, inLayout, inRow, 0)),  *pRight (pOutBase + HalfRowOffset(inGeom, inLayout, inRow, 1));
+	if (inLayout == NTV2_RASTER_LAYOUT_TSI)
+		inGeom.fTSI.fSplit (pInRow, pLeft, pRight, inGeom.fNumUnits);
+	else
+	{
+		::memcpy (pLeft, pInRow, inGeom.fHalfBytes);
+		::memcpy (pRight, pInRow + inGeom.fHalfBytes, inGeom.fHalfBytes);
+	}
+}
+
+static void ConvertRowRange (void * pInContext, const ULWord inWorkerIndex, const ULWord inFirstRow, const ULWord inNumRows)
+{
+	const LayoutJob &		job (*reinterpret_cast<const LayoutJob*>(pInContext));
+	const LayoutGeometry &	geom (*job.fGeom);
+	for (ULWord row(inFirstRow);  row < inFirstRow + inNumRows;  row++)
+	{
+		if (job.fSrcLayout == job.fDstLayout)
+			::memcpy (job.fDst + row * geom.fRowBytes,  job.fSrc + row * geom.fRowBytes,  geom.fRowBytes);	//	Layout-agnostic copy
+		else if (job.fSrcLayout == NTV2_RASTER_LAYOUT_FULL)
+			WriteRow (geom, job.fDstLayout, job.fSrc + row * geom.fRowBytes, job.fDst, row);
+		else if (job.fDstLayout == NTV2_RASTER_LAYOUT_FULL)
+			ReadRow (geom, job.fSrcLayout, job.fSrc, row, job.fDst + row * geom.fRowBytes);
+		else
+		{	//	Quadrants <==> TSI:  go through one full row of scratch
+			UByte *	pRow (job.fScratch + size_t(inWorkerIndex) * geom.fRowBytes);
+			ReadRow (geom, job.fSrcLayout, job.fSrc, row, pRow);
+			WriteRow (geom, job.fDstLayout, pRow, job.fDst, row);
+		}
+	}
+}
+
+
+bool NTV2ConvertRasterLayout (const UByte * pInSrc, const NTV2RasterLayout inSrcLayout,
+								UByte * pOutDst, const NTV2RasterLayout inDstLayout,
+								const ULWord inRowBytes, const ULWord inNumRows,
+								const NTV2PixelFormat inPixelFormat, const ULWord inMaxWorkers)
+{
+	if (!pInSrc  ||  !pOutDst)
+		return false;
+	if (!NTV2_IS_VALID_RASTER_LAYOUT(inSrcLayout)  ||  !NTV2_IS_VALID_RASTER_LAYOUT(inDstLayout))
+		return false;
+	LayoutGeometry	geom;
+	const bool		needTSI (inSrcLayout != inDstLayout  &&  (inSrcLayout == NTV2_RASTER_LAYOUT_TSI  ||  inDstLayout == NTV2_RASTER_LAYOUT_TSI));
+	if (!InitGeometry (geom, inRowBytes, inNumRows, inPixelFormat, needTSI))
+		return false;
+
+	const ULWord	numWorkers (GetNumWorkers(inMaxWorkers));
+	vector<UByte>	scratch;
+	LayoutJob		job;
+	job.fGeom = &geom;
+	job.fSrc = pInSrc;
+	job.fDst = pOutDst;
+	job.fSrcLayout = inSrcLayout;
+	job.fDstLayout = inDstLayout;
+	job.fScratch = AJA_NULL;
+	if (inSrcLayout != inDstLayout  &&  inSrcLayout != NTV2_RASTER_LAYOUT_FULL  &&  inDstLayout != NTV2_RASTER_LAYOUT_FULL)
+	{
+		scratch.resize(size_t(numWorkers) * inRowBytes);
+		job.fScratch = &scratch[0];
+	}
+	NTV2ParallelRows (inNumRows, ConvertRowRange, &job, numWorkers);
+	return true;
+}
+
+
+static bool CheckBuffer (const NTV2Buffer & inBuffer, const NTV2FormatDescriptor & inFullDesc)
+{
+	if (inFullDesc.IsPlanar()  ||  inFullDesc.IsVANC())
+		return false;
+	if (inBuffer.IsNULL())
+		return false;
+	return inBuffer.GetByteCount() >= size_t(inFullDesc.GetBytesPerRow()) * inFullDesc.GetFullRasterHeight();
+}
+
+
+bool NTV2RasterLayoutIsSupported (const NTV2FormatDescriptor & inFullDesc, const NTV2RasterLayout inLayout)
+{
+	if (inFullDesc.IsPlanar()  ||  inFullDesc.IsVANC()  ||  !NTV2_IS_VALID_RASTER_LAYOUT(inLayout))
+		return false;
+	LayoutGeometry	geom;
+	return InitGeometry (geom, inFullDesc.GetBytesPerRow(), inFullDesc.GetFullRasterHeight(), inFullDesc.GetPixelFormat(),
+						inLayout == NTV2_RASTER_LAYOUT_TSI);
+}
+
+
+bool NTV2ConvertRasterLayout (const NTV2Buffer & inSrcBuffer, const NTV2RasterLayout inSrcLayout,
+								NTV2Buffer & inDstBuffer, const NTV2RasterLayout inDstLayout,
+								const NTV2FormatDescriptor & inFullDesc, const ULWord inMaxWorkers)
+{
+	if (!CheckBuffer(inSrcBuffer, inFullDesc)  ||  !CheckBuffer(inDstBuffer, inFullDesc))
+		return false;
+	return NTV2ConvertRasterLayout (reinterpret_cast<const UByte*>(inSrcBuffer.GetHostPointer()), inSrcLayout,
+									reinterpret_cast<UByte*>(inDstBuffer.GetHostPointer()), inDstLayout,
+									inFullDesc.GetBytesPerRow(), inFullDesc.GetFullRasterHeight(),
+									inFullDesc.GetPixelFormat(), inMaxWorkers);
+}
+
+
+//////////////////////////////////////////////////////////////////////////////////////////////////////
+//	In-place conversion
+//////////////////////////////////////////////////////////////////////////////////////////////////////
+
+typedef struct PermuteJob
+{
+	const LayoutGeometry *	fGeom;
+	UByte *					fBase;
+	const vector<ULWord> *	fSrcSlot;		///< @brief	For each slot, the slot whose content it receives
+	const vector<ULWord> *	fLeaders;		///< @brief	One slot from each non-trivial cycle
+	UByte *					fScratch;		///< @brief	One full row per worker
+	bool					fSplit;			///< @brief	For the row pass:  split (true) or merge (false) pairs
+} PermuteJob;
+
+static void PermuteCycleRange (void * pInContext, const ULWord inWorkerIndex, const ULWord inFirstCycle, const ULWord inNumCycles)
+{
+	const PermuteJob &		job (*reinterpret_cast<const PermuteJob*>(pInContext));
+	const ULWord			halfBytes (job.fGeom->fHalfBytes);
+	const vector<ULWord> &	srcSlot (*job.fSrcSlot);
+	UByte *					pTemp (job.fScratch + size_t(inWorkerIndex) * job.fGeom->fRowBytes);
+	for (ULWord cycle(inFirstCycle);  cycle < inFirstCycle + inNumCycles;  cycle++)
+	{
+		const ULWord	leader ((*job.fLeaders)[cycle]);
+		::memcpy (pTemp, job.fBase + size_t(leader) * halfBytes, halfBytes);
+		for (ULWord slot(leader);  ;  )
+		{
+			const ULWord	from (srcSlot[slot]);
+			UByte *			pSlot (job.fBase + size_t(slot) * halfBytes);
+			if (from == leader)
+			{
+				::memcpy (pSlot, pTemp, halfBytes);
+				break;
+			}
+			::memcpy (pSlot, job.fBase + size_t(from) * halfBytes, halfBytes);
+			slot = from;
+		}
+	}
+}
+
+//	Moves every half row from its position in one layout to its position in another
+static void PermuteHalfRows (const LayoutGeometry & inGeom, UByte * pBase, const NTV2RasterLayout inFrom, const NTV2RasterLayout inTo,
+							UByte * pScratch, const ULWord inNumWorkers)
+{
+	const ULWord	numSlots (inGeom.fNumRows * 2);
+	vector<ULWord>	srcSlot (numSlots);
+	for (ULWord row(0);  row < inGeom.fNumRows;  row++)
+		for (ULWord half(0);  half < 2;  half++)
+			srcSlot[HalfRowSlot(inGeom, inTo, row, half)] = HalfRowSlot(inGeom, inFrom, row, half);
+
+	vector<bool>	visited (numSlots, false);
+	vector<ULWord>	leaders;
+	for (ULWord slot(0);  slot < numSlots;  slot++)
+	{
+		if (visited[slot])
+			continue;
+		for (ULWord ndx(slot);  !visited[ndx];  ndx = srcSlot[ndx])
+			visited[ndx] = true;
+		if (srcSlot[slot] != slot)
+			leaders.push_back(slot);
+	}
+	if (leaders.empty())
+		return;
+
+	PermuteJob	job;
+	job.fGeom = &inGeom;  job.fBase = pBase;  job.fSrcSlot = &srcSlot;  job.fLeaders = &leaders;
+	job.fScratch = pScratch;  job.fSplit = false;
+	NTV2ParallelRows (ULWord(leaders.size()), PermuteCycleRange, &job, inNumWorkers);
+}
+
+static void SplitMergeRowRange (void * pInContext, const ULWord inWorkerIndex, const ULWord inFirstRow, const ULWord inNumRows)
+{
+	const PermuteJob &		job (*reinterpret_cast<const PermuteJob*>(pInContext));
+	const LayoutGeometry &	geom (*job.fGeom);
+	UByte *					pTemp (job.fScratch + size_t(inWorkerIndex) * geom.fRowBytes);
+	for (ULWord row(inFirstRow);  row < inFirstRow + inNumRows;  row++)
+	{
+		UByte *	pRow (job.fBase + size_t(row) * geom.fRowBytes);
+		::memcpy (pTemp, pRow, geom.fRowBytes);
+		if (job.fSplit)
+			geom.fTSI.fSplit (pTemp, pRow, pRow + geom.fHalfBytes, geom.fNumUnits);
+		else
+			geom.fTSI.fMerge (pTemp, pTemp + geom.fHalfBytes, pRow, geom.fNumUnits);
+	}
+}
+
+//	Splits (or merges) the sample pairs of every full row, leaving the even pairs in the left half
+static void SplitMergeRows (const LayoutGeometry & inGeom, UByte * pBase, const bool inSplit, UByte * pScratch, const ULWord inNumWorkers)
+{
+	PermuteJob	job;
+	job.fGeom = &inGeom;  job.fBase = pBase;  job.fSrcSlot = AJA_NULL;  job.fLeaders = AJA_NULL;
+	job.fScratch = pScratch;  job.fSplit = inSplit;
+	NTV2ParallelRows (inGeom.fNumRows, SplitMergeRowRange, &job, inNumWorkers);
+}
+
+
+bool NTV2ConvertRasterLayoutInPlace (NTV2Buffer & inOutBuffer, const NTV2RasterLayout inFromLayout,
+									const NTV2RasterLayout inToLayout, const NTV2FormatDescriptor & inFullDesc,
+									const ULWord inMaxWorkers)
+{
+	if (!CheckBuffer(inOutBuffer, inFullDesc))
+		return false;
+	if (!NTV2_IS_VALID_RASTER_LAYOUT(inFromLayout)  ||  !NTV2_IS_VALID_RASTER_LAYOUT(inToLayout))
+		return false;
+	if (inFromLayout == inToLayout)
+		return true;
+	LayoutGeometry	geom;
+	if (!InitGeometry (geom, inFullDesc.GetBytesPerRow(), inFullDesc.GetFullRasterHeight(), inFullDesc.GetPixelFormat(),
+						inFromLayout == NTV2_RASTER_LAYOUT_TSI  ||  inToLayout == NTV2_RASTER_LAYOUT_TSI))
+		return false;
+
+	const ULWord	numWorkers (GetNumWorkers(inMaxWorkers));
+	vector<UByte>	scratch (size_t(numWorkers) * geom.fRowBytes);
+	UByte *			pBase (reinterpret_cast<UByte*>(inOutBuffer.GetHostPointer()));
+	NTV2RasterLayout	layout (inFromLayout);
+
+	//	TSI sub-image rows hold split pairs -- gather them into full rows, then merge the pairs...
+	if (layout == NTV2_RASTER_LAYOUT_TSI)
+	{
+		PermuteHalfRows (geom, pBase, NTV2_RASTER_LAYOUT_TSI, NTV2_RASTER_LAYOUT_FULL, &scratch[0], numWorkers);
+		SplitMergeRows (geom, pBase, false, &scratch[0], numWorkers);
+		layout = NTV2_RASTER_LAYOUT_FULL;
+	}
+	if (inToLayout == NTV2_RASTER_LAYOUT_TSI)
+	{	//	Split the pairs of each full row, then scatter the half rows into the sub-images...
+		if (layout != NTV2_RASTER_LAYOUT_FULL)
+			PermuteHalfRows (geom, pBase, layout, NTV2_RASTER_LAYOUT_FULL, &scratch[0], numWorkers);
+		SplitMergeRows (geom, pBase, true, &scratch[0], numWorkers);
+		PermuteHalfRows (geom, pBase, NTV2_RASTER_LAYOUT_FULL, NTV2_RASTER_LAYOUT_TSI, &scratch[0], numWorkers);
+	}
+	else if (layout != inToLayout)
+		PermuteHalfRows (geom, pBase, layout, inToLayout, &scratch[0], numWorkers);
+	return true;
+}
@@ -20,9 +20,10 @@
 #include <sstream>
 #include <iterator>
 #include <iomanip>
-#include <map>
+#include <vector>
 #include <math.h>
 #include <ctype.h>	//	for isprint()
+#include <string.h>	//	for memset(), strlen()
 #if !defined(AJA_WINDOWS)
 #include <unistd.h>
 #endif
@@ -48,6 +49,76 @@ static const string gChlClasses[]	=	{	kRegClass_Channel1, kRegClass_Channel2, kR
 static const string sSpace(" ");
 static const string sNull;
 
+//	Every register class, in one static table. A class's index in this table is its bit in the register's class mask.
+static const char * const	sRegClassNames[]	=	{	"kRegClass_AES",		"kRegClass_Analog",		"kRegClass_Anc",		"kRegClass_Audio",
+														"kRegClass_Aux",		"kRegClass_Channel1",	"kRegClass_Channel2",	"kRegClass_Channel3",
+														"kRegClass_Channel4",	"kRegClass_Channel5",	"kRegClass_Channel6",	"kRegClass_Channel7",
+														"kRegClass_Channel8",	"kRegClass_CSC",		"kRegClass_DMA",		"kRegClass_HDMI",
+														"kRegClass_HDR",		"kRegClass_Input",		"kRegClass_Info",		"kRegClass_Interrupt",
+														"kRegClass_IP",			"kRegClass_LUT",		"kRegClass_Mixer",		"kRegClass_Output",
+														"kRegClass_ReadOnly",	"kRegClass_Routing",	"kRegClass_SDIError",	"kRegClass_Serial",
+														"kRegClass_Timecode",	"kRegClass_Timing",		"kRegClass_Video",		"kRegClass_Virtual",
+														"kRegClass_VPID",		"kRegClass_WriteOnly",	"kRegClass_XptROM",		"kRegClass_NTV4FrameStore"	};
+static const size_t			kNumRegClasses		(sizeof(sRegClassNames) / sizeof(sRegClassNames[0]));
+static const size_t			kRegClassPrefixLen	(10);			//	Length of "kRegClass_" prefix
+static const size_t			kRegClassIndexSize	(128);			//	Class name hash table size (power of 2, > 2x kNumRegClasses)
+static const uint8_t		kNoRegClass			(0xFF);			//	Empty class name hash table slot
+static const uint32_t		kNoRegName			(0xFFFFFFFF);	//	RegInfo::fNameOffset of an unnamed register
+static const uint8_t		kNoInputXpt			(0xFF);			//	RegInfo::fInputXpts entry of an unused mask index
+static const uint32_t		kNoXptRegInfo		(0xFFFFFFFF);	//	Input crosspoint that's not in any crosspoint select group
+
+//	Register & class names are plain ASCII, so case folding needn't involve the C locale.
+static inline char LowerASCII (const char inChar)
+{
+	return (inChar >= 'A'  &&  inChar <= 'Z') ? char(inChar - 'A' + 'a') : inChar;
+}
+
+//	FNV-1a hash of the given characters, optionally folded to lower case.
+static inline uint32_t HashChars (const char * pChars, const size_t inLength, const bool inFoldCase)
+{
+	uint32_t	hash(2166136261U);
+	for (size_t ndx(0);  ndx < inLength;  ndx++)
+		hash = (hash ^ uint8_t(inFoldCase ? LowerASCII(pChars[ndx]) : pChars[ndx])) * 16777619U;
+	return hash;
+}
+
+//	Appends the decimal digits of the given value to the given string, zero-padded to the given width.
+//	Used instead of ostringstream to synthesize register names, as it's much cheaper.
+static inline string & AppendDecimal (string & outStr, const ULWord inValue, const size_t inMinDigits = 1)
+{
+	char	digits[16];
+	size_t	numDigits(0);
+	for (ULWord value(inValue);  value  ||  numDigits < inMinDigits;  value /= 10)
+		digits[numDigits++] = char('0' + value % 10);
+	while (numDigits)
+		outStr.push_back(digits[--numDigits]);
+	return outStr;
+}
+
+//	Reg num hash. Multiplying by an odd number is a bijection on the low bits, so consecutive reg nums never collide.
+static inline uint32_t HashRegNum (const uint32_t inRegNum)
+{
+	return inRegNum * 2654435761U;
+}
+
+//	Returns true if the given characters match, ignoring case.
+static inline bool SameIgnoringCase (const char * pChars1, const char * pChars2, const size_t inLength)
+{
+	for (size_t ndx(0);  ndx < inLength;  ndx++)
+		if (LowerASCII(pChars1[ndx]) != LowerASCII(pChars2[ndx]))
+			return false;
+	return true;
+}
+
+//	Returns true if the given characters match the given lower-case characters, ignoring case.
+static inline bool MatchesLower (const char * pChars, const char * pLowerChars, const size_t inLength)
+{
+	for (size_t ndx(0);  ndx < inLength;  ndx++)
+		if (LowerASCII(pChars[ndx]) != pLowerChars[ndx])
+			return false;
+	return true;
+}
+
 typedef enum
 {
 	regNTV4FS_FIRST,
@@ -131,6 +202,21 @@ private:
 		AJAAutoLock lock(&mGuardMutex);
 		AJAAtomic::Increment(&gInstanceTally);
 		AJAAtomic::Increment(&gLivingInstances);
+		::memset(mRegClassIndex, kNoRegClass, sizeof(mRegClassIndex));
+		for (size_t classNdx(0);  classNdx < kNumRegClasses;  classNdx++)
+		{
+			const char *	pName	(sRegClassNames[classNdx]);
+			uint32_t		slot	(HashChars(pName, ::strlen(pName), false));
+			while (mRegClassIndex[slot & (kRegClassIndexSize-1)] != kNoRegClass)
+				slot++;
+			mRegClassIndex[slot & (kRegClassIndexSize-1)] = uint8_t(classNdx);
+		}
+		for (size_t xptNdx(0);  xptNdx < sizeof(mInputXptRegInfo) / sizeof(mInputXptRegInfo[0]);  xptNdx++)
+			mInputXptRegInfo[xptNdx] = kNoXptRegInfo;
+		mRegInfos.reserve(4096);
+		mRegNumIndex.resize(8192, 0);
+		mRegNames.reserve(96 * 1024);
+		mNamedRegs.reserve(4096);
 		//	Name "Classic" registers using NTV2RegisterNameString...
 		for (ULWord regNum (0);	 regNum < kRegNumRegisters;	 regNum++)
 			DefineRegName (regNum,	::NTV2RegisterNameString(regNum));
@@ -155,15 +241,13 @@ private:
 		SetupNTV4FrameStoreRegs();	//	NTV4 FrameStores
 		SetupLPRegs();
 		SetupVRegs();			//	Virtuals
+		BuildIndexes();			//	Name & class indexes
 		REiNOTE(DEC(gLivingInstances) << " extant, " << DEC(gInstanceTally) << " total");
 		if (LOGGING_MAPPINGS)
 		{
-			REiDBG("RegsToStrsMap=" << mRegNumToStringMap.size()
-					<< " RegsToDecodersMap=" << mRegNumToDecoderMap.size()
-					<< " ClassToRegsMMap=" << mRegClassToRegNumMMap.size()
-					<< " StrToRegsMMap=" << mStringToRegNumMMap.size()
-					<< " InpXptsToXptRegInfoMap=" << mInputXpt2XptRegNumMaskIndexMap.size()
-					<< " XptRegInfoToInpXptsMap=" << mXptRegNumMaskIndex2InputXptMap.size()
+			REiDBG("Regs=" << mRegInfos.size()
+					<< " NamedRegs=" << mNamedRegs.size()
+					<< " NameBytes=" << mRegNames.size()
 					<< " RegClasses=" << mAllRegClasses.size());
 		}
 	}	//	constructor
@@ -189,35 +273,115 @@ private:
 		}
 	} mDefaultRegDecoder;
 
-	void DefineRegName(const uint32_t regNumber, const string & regName)
+	//	Everything I know about one register.
+	typedef uint64_t	RegClassMask;
+	typedef struct RegInfo
+	{
+		uint32_t		fRegNum;		//	Register number
+		uint32_t		fNameOffset;	//	Offset of my name in mRegNames, or kNoRegName
+		const Decoder *	fDecoder;		//	My decoder, or NULL
+		RegClassMask	fClasses;		//	Bit N is set if I'm in class sRegClassNames[N]
+		uint8_t			fInputXpts[4];	//	Crosspoint select group regs:  input xpt for each mask index, or kNoInputXpt
+	} RegInfo;
+
+	//	Returns the index of the given register's RegInfo in mRegInfos, or -1 if it has none.
+	inline int FindRegInfo (const uint32_t inRegNum) const
+	{
+		const uint32_t	mask(uint32_t(mRegNumIndex.size()) - 1);
+		for (uint32_t slot(HashRegNum(inRegNum) & mask);  mRegNumIndex[slot];  slot = (slot + 1) & mask)
+			if (mRegInfos[mRegNumIndex[slot] - 1].fRegNum == inRegNum)
+				return int(mRegNumIndex[slot] - 1);
+		return -1;
+	}
+
+	//	Returns the index of the given register's RegInfo in mRegInfos, adding one if necessary.
+	uint32_t RegInfoFor (const uint32_t inRegNum)
+	{
+		const int	existing(FindRegInfo(inRegNum));
+		if (existing >= 0)
+			return uint32_t(existing);
+		if (2 * (mRegInfos.size() + 1) > mRegNumIndex.size())
+		{	//	Keep the load factor under 1/2...
+			mRegNumIndex.assign(mRegNumIndex.size() * 2, 0);
+			for (uint32_t ndx(0);  ndx < uint32_t(mRegInfos.size());  ndx++)
+				AddToRegNumIndex(ndx);
+		}
+		RegInfo	info;
+		info.fRegNum = inRegNum;
+		info.fNameOffset = kNoRegName;
+		info.fDecoder = AJA_NULL;
+		info.fClasses = 0;
+		::memset(info.fInputXpts, kNoInputXpt, sizeof(info.fInputXpts));
+		mRegInfos.push_back(info);
+		AddToRegNumIndex(uint32_t(mRegInfos.size() - 1));
+		return uint32_t(mRegInfos.size() - 1);
+	}
+
+	inline void AddToRegNumIndex (const uint32_t inInfoNdx)
 	{
-		if (!regName.empty())
+		const uint32_t	mask(uint32_t(mRegNumIndex.size()) - 1);
+		uint32_t		slot(HashRegNum(mRegInfos[inInfoNdx].fRegNum) & mask);
+		while (mRegNumIndex[slot])
+			slot = (slot + 1) & mask;
+		mRegNumIndex[slot] = inInfoNdx + 1;
+	}
+
+	//	Returns the index of the given class in sRegClassNames, or -1 if it's not a known class.
+	inline int RegClassIndex (const string & inClassName) const
+	{
+		for (uint32_t slot(HashChars(inClassName.data(), inClassName.length(), false));  ;  slot++)
 		{
-			AJAAutoLock lock(&mGuardMutex);
-			if (mRegNumToStringMap.find(regNumber) == mRegNumToStringMap.end())
-			{
-				mRegNumToStringMap.insert (RegNumToStringPair(regNumber, regName));
-				string lowerCaseRegName(regName);
-				mStringToRegNumMMap.insert (StringToRegNumPair(aja::lower(lowerCaseRegName), regNumber));
-			}
+			const uint8_t	classNdx (mRegClassIndex[slot & (kRegClassIndexSize-1)]);
+			if (classNdx == kNoRegClass)
+				return -1;
+			if (inClassName == sRegClassNames[classNdx])
+				return int(classNdx);
 		}
 	}
+
+	inline const char * RegName (const RegInfo & inInfo) const
+	{
+		return inInfo.fNameOffset == kNoRegName ? AJA_NULL : mRegNames.c_str() + inInfo.fNameOffset;
+	}
+
+	void DefineRegName(const uint32_t regNumber, const char * pRegName, const size_t inLength)
+	{
+		if (!inLength)
+			return;
+		const uint32_t	infoNdx(RegInfoFor(regNumber));
+		if (mRegInfos[infoNdx].fNameOffset != kNoRegName)
+			return;	//	Already named
+		mRegInfos[infoNdx].fNameOffset = uint32_t(mRegNames.size());
+		mRegNames.append(pRegName, inLength);
+		mRegNames.push_back('\0');
+		mNamedRegs.push_back(infoNdx);
+	}
+	inline void DefineRegName(const uint32_t regNumber, const char * pRegName)
+	{
+		DefineRegName (regNumber, pRegName, pRegName ? ::strlen(pRegName) : 0);
+	}
+	inline void DefineRegName(const uint32_t regNumber, const string & regName)
+	{
+		DefineRegName (regNumber, regName.data(), regName.length());
+	}
 	inline void DefineRegDecoder(const uint32_t inRegNum, const Decoder & dec)
 	{
-		AJAAutoLock lock(&mGuardMutex);
-		mRegNumToDecoderMap.insert (RegNumToDecoderPair(inRegNum, &dec));
+		RegInfo & info (mRegInfos[RegInfoFor(inRegNum)]);
+		if (!info.fDecoder)
+			info.fDecoder = &dec;
 	}
 	inline void DefineRegClass (const uint32_t inRegNum, const string & className)
 	{
 		if (!className.empty())
 		{
-			AJAAutoLock lock(&mGuardMutex);
-			mRegClassToRegNumMMap.insert(StringToRegNumPair(className, inRegNum));
+			const int	classNdx (RegClassIndex(className));
+			NTV2_ASSERT (classNdx >= 0  &&  "Register class missing from sRegClassNames");
+			if (classNdx >= 0)
+				mRegInfos[RegInfoFor(inRegNum)].fClasses |= RegClassMask(1) << classNdx;
 		}
 	}
 	void DefineRegReadWrite(const uint32_t inRegNum, const int rdWrt)
 	{
-		AJAAutoLock lock(&mGuardMutex);
 		if (rdWrt == READONLY)
 		{
 			NTV2_ASSERT (!IsRegisterWriteOnly(inRegNum));
@@ -238,20 +402,65 @@ private:
 		DefineRegClass (inRegNum, className2);
 		DefineRegClass (inRegNum, className3);
 	}
+	void DefineXptMapping(const uint32_t inRegNum, const uint32_t inMaskIndex, const NTV2InputXptID inInputXpt)
+	{
+		if (inInputXpt == NTV2_INPUT_CROSSPOINT_INVALID  ||  ULWord(inInputXpt) >= ULWord(kNoInputXpt)
+			||  ULWord(inInputXpt) >= sizeof(mInputXptRegInfo) / sizeof(mInputXptRegInfo[0]))
+				return;
+		RegInfo & info (mRegInfos[RegInfoFor(inRegNum)]);
+		if (info.fInputXpts[inMaskIndex] == kNoInputXpt)
+			info.fInputXpts[inMaskIndex] = uint8_t(inInputXpt);
+		if (mInputXptRegInfo[inInputXpt] == kNoXptRegInfo)
+			mInputXptRegInfo[inInputXpt] = (inRegNum << 2) | inMaskIndex;
+	}
 	void DefineXptReg(const uint32_t inRegNum, const NTV2InputXptID xpt0, const NTV2InputXptID xpt1, const NTV2InputXptID xpt2, const NTV2InputXptID xpt3)
 	{
 		DefineRegister (inRegNum, sNull,	mDecodeXptGroupReg, READWRITE,	kRegClass_Routing,	kRegClass_NULL, kRegClass_NULL);
 		const NTV2InputCrosspointID indexes [4] = {xpt0, xpt1, xpt2, xpt3};
-		for (int ndx(0);  ndx < 4;	ndx++)
-		{
-			if (indexes[ndx] == NTV2_INPUT_CROSSPOINT_INVALID)
-				continue;
-			const XptRegNumAndMaskIndex regNumAndNdx(inRegNum, ndx);
-			if (mXptRegNumMaskIndex2InputXptMap.find(regNumAndNdx) == mXptRegNumMaskIndex2InputXptMap.end())
-				mXptRegNumMaskIndex2InputXptMap [regNumAndNdx] = indexes[ndx];
-			if (mInputXpt2XptRegNumMaskIndexMap.find(indexes[ndx]) == mInputXpt2XptRegNumMaskIndexMap.end())
-				mInputXpt2XptRegNumMaskIndexMap[indexes[ndx]] = regNumAndNdx;
-		}
+		for (uint32_t ndx(0);  ndx < 4;	ndx++)
+			DefineXptMapping (inRegNum, ndx, indexes[ndx]);
+	}
+
+	//	Called once all registers are defined:  builds the name index, and the per-class register lists.
+	void BuildIndexes (void)
+	{
+		size_t	nameIndexSize(1024);
+		while (nameIndexSize < 2 * mNamedRegs.size())
+			nameIndexSize *= 2;
+		mRegNameIndex.assign(nameIndexSize, 0);
+		const uint32_t	mask(uint32_t(nameIndexSize) - 1);
+		for (size_t ndx(0);  ndx < mNamedRegs.size();  ndx++)
+		{	//	When several registers have the same name, the first one named wins...
+			const char *	pName	(RegName(mRegInfos[mNamedRegs[ndx]]));
+			const size_t	nameLen	(::strlen(pName));
+			uint32_t		slot	(HashChars(pName, nameLen, true) & mask);
+			bool			dupe	(false);
+			for ( ;  mRegNameIndex[slot] && !dupe;  slot = (slot + 1) & mask)
+			{
+				const char * pOther (RegName(mRegInfos[mRegNameIndex[slot] - 1]));
+				dupe = ::strlen(pOther) == nameLen  &&  SameIgnoringCase(pOther, pName, nameLen);
+			}
+			if (!dupe)
+				mRegNameIndex[slot] = mNamedRegs[ndx] + 1;
+		}
+
+		size_t	classCounts[kNumRegClasses] = {0};
+		for (size_t ndx(0);  ndx < mRegInfos.size();  ndx++)
+			for (size_t classNdx(0);  mRegInfos[ndx].fClasses >> classNdx;  classNdx++)
+				if (mRegInfos[ndx].fClasses & (RegClassMask(1) << classNdx))
+					classCounts[classNdx]++;
+		for (size_t classNdx(0);  classNdx < kNumRegClasses;  classNdx++)
+			mClassRegs[classNdx].reserve(classCounts[classNdx]);
+		for (size_t ndx(0);  ndx < mRegInfos.size();  ndx++)
+			for (size_t classNdx(0);  mRegInfos[ndx].fClasses >> classNdx;  classNdx++)
+				if (mRegInfos[ndx].fClasses & (RegClassMask(1) << classNdx))
+					mClassRegs[classNdx].push_back(mRegInfos[ndx].fRegNum);
+		for (size_t classNdx(0);  classNdx < kNumRegClasses;  classNdx++)
+			if (!mClassRegs[classNdx].empty())
+			{
+				std::sort(mClassRegs[classNdx].begin(), mClassRegs[classNdx].end());
+				mAllRegClasses.insert(sRegClassNames[classNdx]);
+			}
 	}
 
 	void SetupBasicRegs(void)
@@ -645,13 +854,7 @@ private:
 		DefineXptReg	(kRegXptSelectGroup4,	NTV2_XptMixer1FGVidInput,		NTV2_XptMixer1FGKeyInput,		NTV2_XptMixer1BGVidInput,		NTV2_XptMixer1BGKeyInput);
 		DefineXptReg	(kRegXptSelectGroup5,	NTV2_XptFrameBuffer2Input,		NTV2_XptLUT2Input,				NTV2_XptCSC2VidInput,			NTV2_XptCSC2KeyInput);
 		DefineXptReg	(kRegXptSelectGroup6,	NTV2_XptWaterMarker1Input,		NTV2_XptIICT1Input,				NTV2_XptHDMIOutInput,			NTV2_XptOEInput);
-		{	//	An additional input Xpt for kRegXptSelectGroup6 in mask index 2...
-			const XptRegNumAndMaskIndex regNumAndNdx (kRegXptSelectGroup6, 2);
-			if (mXptRegNumMaskIndex2InputXptMap.find (regNumAndNdx) == mXptRegNumMaskIndex2InputXptMap.end())
-				mXptRegNumMaskIndex2InputXptMap [regNumAndNdx] = NTV2_XptHDMIOutQ1Input;
-			if (mInputXpt2XptRegNumMaskIndexMap.find (NTV2_XptHDMIOutQ1Input) == mInputXpt2XptRegNumMaskIndexMap.end())
-				mInputXpt2XptRegNumMaskIndexMap[NTV2_XptHDMIOutQ1Input] = regNumAndNdx;
-		}
+		DefineXptMapping(kRegXptSelectGroup6,	2,	NTV2_XptHDMIOutQ1Input);	//	An additional input Xpt for kRegXptSelectGroup6 in mask index 2
 		DefineXptReg	(kRegXptSelectGroup7,	NTV2_XptWaterMarker2Input,		NTV2_INPUT_CROSSPOINT_INVALID,	NTV2_XptDualLinkOut2Input,		NTV2_INPUT_CROSSPOINT_INVALID);
 		DefineXptReg	(kRegXptSelectGroup8,	NTV2_XptSDIOut3Input,			NTV2_XptSDIOut4Input,			NTV2_XptSDIOut5Input,			NTV2_INPUT_CROSSPOINT_INVALID);
 		DefineXptReg	(kRegXptSelectGroup9,	NTV2_XptMixer2FGVidInput,		NTV2_XptMixer2FGKeyInput,		NTV2_XptMixer2BGVidInput,		NTV2_XptMixer2BGKeyInput);
@@ -685,21 +888,27 @@ private:
 
 		//	Expose the CanConnect ROM registers:
 		for (ULWord regNum(kRegFirstValidXptROMRegister);  regNum < ULWord(kRegInvalidValidXptROMRegister);	 regNum++)
-		{	ostringstream regName;	//	used to synthesize reg name
+		{	string regName;	//	used to synthesize reg name
 			const ULWord rawInputXpt	((regNum - ULWord(kRegFirstValidXptROMRegister)) / 4UL + ULWord(NTV2_FIRST_INPUT_CROSSPOINT));
 			const ULWord ndx			((regNum - ULWord(kRegFirstValidXptROMRegister)) % 4UL);
 			const NTV2InputXptID inputXpt	(NTV2InputXptID(rawInputXpt+0));
 			if (NTV2_IS_VALID_InputCrosspointID(inputXpt))
 			{
-				string inputXptEnumName (::NTV2InputCrosspointIDToString(inputXpt,false));	//	e.g. "NTV2_XptFrameBuffer1Input"
+				const string inputXptEnumName (::NTV2InputCrosspointIDToString(inputXpt,false));	//	e.g. "NTV2_XptFrameBuffer1Input"
+				regName = "kRegXptValid";
 				if (inputXptEnumName.empty())
-					regName << "kRegXptValid" << DEC0N(rawInputXpt,3) << "N" << DEC(ndx);
+					AppendDecimal(regName, rawInputXpt, 3) += "N";
+				else if (inputXptEnumName.compare(0, 8, "NTV2_Xpt") == 0)
+					regName.append(inputXptEnumName, 8, string::npos);
 				else
-					regName << "kRegXptValid" << aja::replace(inputXptEnumName, "NTV2_Xpt", "") << DEC(ndx);
+					regName += inputXptEnumName;
+				AppendDecimal(regName, ndx);
 			}
 			else
-				regName << "kRegXptValue" << HEX0N(regNum,4);
-			DefineRegister (regNum, regName.str(),	mDecodeXptValidReg, READONLY,	kRegClass_XptROM, kRegClass_NULL, kRegClass_NULL);
+			{	ostringstream oss;  oss << "kRegXptValue" << HEX0N(regNum,4);
+				regName = oss.str();
+			}
+			DefineRegister (regNum, regName,	mDecodeXptValidReg, READONLY,	kRegClass_XptROM, kRegClass_NULL, kRegClass_NULL);
 		}
 	}	//	SetupXptSelect
 	
@@ -735,13 +944,15 @@ private:
 			for (ULWord reg(regAncExtControl);	reg < regAncExt_LAST;  reg++)
 			{
 				if (AncExtRegNames[reg].empty())	continue;
-				ostringstream	oss;	oss << "Extract " << (offsetNdx+1) << " " << AncExtRegNames[reg];
-				DefineRegName (AncExtPerChlRegBase[offsetNdx] + reg,	oss.str());
+				string	regName ("Extract ");
+				AppendDecimal(regName, offsetNdx+1) += " ";
+				DefineRegName (AncExtPerChlRegBase[offsetNdx] + reg,	regName + AncExtRegNames[reg]);
 			}
 			for (ULWord reg(regAncInsFieldBytes);  reg < regAncIns_LAST;  reg++)
 			{
-				ostringstream	oss;	oss << "Insert " << (offsetNdx+1) << " " << AncInsRegNames[reg];
-				DefineRegName (AncInsPerChlRegBase[offsetNdx] + reg,	oss.str());
+				string	regName ("Insert ");
+				AppendDecimal(regName, offsetNdx+1) += " ";
+				DefineRegName (AncInsPerChlRegBase[offsetNdx] + reg,	regName + AncInsRegNames[reg]);
 			}
 		}
 		for (ULWord ndx (0);  ndx < 8;	ndx++)
@@ -820,8 +1031,9 @@ private:
 			for (ULWord reg(regAuxExtControl);	reg < regAuxExt_LAST;  reg++)
 			{
 				if (AuxExtRegNames[reg].empty())	continue;
-				ostringstream	oss;	oss << "Extract " << (offsetNdx+1) << " " << AuxExtRegNames[reg];
-				DefineRegName (AuxExtPerChlRegBase[offsetNdx] + reg,	oss.str());
+				string	regName ("Extract ");
+				AppendDecimal(regName, offsetNdx+1) += " ";
+				DefineRegName (AuxExtPerChlRegBase[offsetNdx] + reg,	regName + AuxExtRegNames[reg]);
 			}
 			// for (ULWord reg(regAncInsFieldBytes);  reg < regAncIns_LAST;  reg++)
 			// {
@@ -1110,8 +1322,8 @@ private:
 		for (ULWord chan (0);  chan < 8;  chan++)
 			for (UWord ndx(0);	ndx < 6;  ndx++)
 			{
-				ostringstream	ossName;	ossName << "kRegRXSDI" << DEC(chan+1) << suffixes[ndx];
-				const string &	regName		(ossName.str());
+				string			regName		("kRegRXSDI");
+				AppendDecimal(regName, chan+1) += suffixes[ndx];
 				const uint32_t	regNum		(baseNum[chan] + ndx);
 				const int		perm		(perms[ndx]);
 				if (ndx == 0)
@@ -1137,8 +1349,8 @@ private:
 		AJAAutoLock lock(&mGuardMutex);
 		for (unsigned num(0);  num < 8;	 num++)
 		{
-			ostringstream ossRegName;  ossRegName << "kRegEnhancedCSC" << (num+1);
-			const string & chanClass (sChan[num]);					const string rootName	 (ossRegName.str());
+			string rootName ("kRegEnhancedCSC");					AppendDecimal(rootName, num+1);
+			const string & chanClass (sChan[num]);
 			const string modeName	 (rootName + "Mode");			const string inOff01Name (rootName + "InOffset0_1");			const string inOff2Name	 (rootName + "InOffset2");
 			const string coeffA0Name (rootName + "CoeffA0");		const string coeffA1Name (rootName + "CoeffA1");				const string coeffA2Name (rootName + "CoeffA2");
 			const string coeffB0Name (rootName + "CoeffB0");		const string coeffB1Name (rootName + "CoeffB1");				const string coeffB2Name (rootName + "CoeffB2");
@@ -1191,11 +1403,11 @@ private:
 		const ULWord REDreg(kColorCorrectionLUTOffset_Red/4), GRNreg(kColorCorrectionLUTOffset_Green/4), BLUreg(kColorCorrectionLUTOffset_Blue/4);
 		for (ULWord ndx(0);	 ndx < 512;	 ndx++)
 		{
-			ostringstream regNameR, regNameG, regNameB;
-			regNameR << "kRegLUTRed" << DEC0N(ndx,3);  regNameG << "kRegLUTGreen" << DEC0N(ndx,3);	regNameB << "kRegLUTBlue" << DEC0N(ndx,3);
-			DefineRegister (REDreg + ndx, regNameR.str(), mLUTDecoder,	READWRITE,	kRegClass_LUT,	kRegClass_NULL, kRegClass_NULL);
-			DefineRegister (GRNreg + ndx, regNameG.str(), mLUTDecoder,	READWRITE,	kRegClass_LUT,	kRegClass_NULL, kRegClass_NULL);
-			DefineRegister (BLUreg + ndx, regNameB.str(), mLUTDecoder,	READWRITE,	kRegClass_LUT,	kRegClass_NULL, kRegClass_NULL);
+			string regNameR ("kRegLUTRed"), regNameG ("kRegLUTGreen"), regNameB ("kRegLUTBlue");
+			AppendDecimal(regNameR, ndx, 3);  AppendDecimal(regNameG, ndx, 3);  AppendDecimal(regNameB, ndx, 3);
+			DefineRegister (REDreg + ndx, regNameR, mLUTDecoder,	READWRITE,	kRegClass_LUT,	kRegClass_NULL, kRegClass_NULL);
+			DefineRegister (GRNreg + ndx, regNameG, mLUTDecoder,	READWRITE,	kRegClass_LUT,	kRegClass_NULL, kRegClass_NULL);
+			DefineRegister (BLUreg + ndx, regNameB, mLUTDecoder,	READWRITE,	kRegClass_LUT,	kRegClass_NULL, kRegClass_NULL);
 		}
 #endif
 	}	//	SetupCSCRegs
@@ -1226,7 +1438,7 @@ private:
 		{
 			for (ULWord regNdx(0);  regNdx < ULWord(regNTV4FS_LAST);  regNdx++)
 			{
-				ostringstream regName;  regName << "kRegNTV4FS" << DEC(fsNdx+1) << "_";
+				string regName ("kRegNTV4FS");  AppendDecimal(regName, fsNdx+1) += "_";
 				const ULWord registerNumber (kNTV4FrameStoreFirstRegNum  +  fsNdx * kNumNTV4FrameStoreRegisters  +  regNdx);
 				switch (NTV4FrameStoreRegs(regNdx))
 				{
@@ -1253,16 +1465,16 @@ private:
 					case regNTV4FS_RasterOffsetBlue:
 					case regNTV4FS_RasterOffsetRed:
 					case regNTV4FS_RasterOffsetAlpha:
-						regName << sNTV4FrameStoreRegNames[regNdx];
-						DefineRegister(registerNumber, regName.str(), mDecodeNTV4FSReg, READWRITE, kRegClass_NTV4FrameStore, gChlClasses[fsNdx], kRegClass_NULL);
+						regName += sNTV4FrameStoreRegNames[regNdx];
+						DefineRegister(registerNumber, regName, mDecodeNTV4FSReg, READWRITE, kRegClass_NTV4FrameStore, gChlClasses[fsNdx], kRegClass_NULL);
 						break;
 					case regNTV4FS_InputSourceSelect:
-						regName << "InputSourceSelect";
-						DefineRegister(registerNumber, regName.str(), mDecodeNTV4FSReg, READWRITE, kRegClass_NTV4FrameStore, gChlClasses[fsNdx], kRegClass_NULL);
+						regName += "InputSourceSelect";
+						DefineRegister(registerNumber, regName, mDecodeNTV4FSReg, READWRITE, kRegClass_NTV4FrameStore, gChlClasses[fsNdx], kRegClass_NULL);
 						break;
 					default:
-						regName << DEC(regNdx);
-						DefineRegister(registerNumber, regName.str(), mDefaultRegDecoder, READWRITE, kRegClass_NTV4FrameStore, gChlClasses[fsNdx], kRegClass_NULL);
+						AppendDecimal(regName, regNdx);
+						DefineRegister(registerNumber, regName, mDefaultRegDecoder, READWRITE, kRegClass_NTV4FrameStore, gChlClasses[fsNdx], kRegClass_NULL);
 						break;
 				}
 			}	//	for each FrameStore register
@@ -1916,19 +2128,15 @@ private:
 		DEF_REGNAME	(kVRegLastAJA);
 		DEF_REGNAME	(kVRegFirstOEM);
 
+		const string	virtualClass (kRegClass_Virtual);
 		for (ULWord ndx(1);  ndx < 1024;  ndx++)	//	<== Start at 1, kVRegDriverVersion already done
 		{
-			ostringstream oss;	oss << "VIRTUALREG_START+" << ndx;
-			const string	regName (oss.str());
 			const ULWord	regNum	(VIRTUALREG_START + ndx);
-			if (mRegNumToStringMap.find(regNum) == mRegNumToStringMap.end())
-			{
-				mRegNumToStringMap.insert (RegNumToStringPair(regNum, regName));
-				mStringToRegNumMMap.insert (StringToRegNumPair(ToLower(regName), regNum));
-			}
+			string			regName ("VIRTUALREG_START+");
+			DefineRegName (regNum, AppendDecimal(regName, ndx));	//	Unless it's already named
 			DefineRegDecoder (regNum, mDefaultRegDecoder);
 			DefineRegReadWrite (regNum, READWRITE);
-			DefineRegClass (regNum, kRegClass_Virtual);
+			DefineRegClass (regNum, virtualClass);
 		}
 		DefineRegClass (kVRegAudioOutputToneSelect, kRegClass_Audio);
 		DefineRegClass (kVRegMonAncField1Offset, kRegClass_Anc);
@@ -1958,12 +2166,13 @@ public:
 		return oss;
 	}
 
+	//	NOTE:	All of my tables are built by my constructor and never change afterward, so lookups needn't lock.
+
 	string RegNameToString (const uint32_t inRegNum) const
 	{
-		AJAAutoLock lock(&mGuardMutex);
-		RegNumToStringMap::const_iterator	iter	(mRegNumToStringMap.find (inRegNum));
-		if (iter != mRegNumToStringMap.end())
-			return iter->second;
+		const int	infoNdx (FindRegInfo(inRegNum));
+		if (infoNdx >= 0  &&  mRegInfos[size_t(infoNdx)].fNameOffset != kNoRegName)
+			return RegName(mRegInfos[size_t(infoNdx)]);
 
 		ostringstream	oss;	oss << "Reg ";
 		if (inRegNum <= kRegNumRegisters)
@@ -1977,24 +2186,17 @@ public:
 	
 	string RegValueToString (const uint32_t inRegNum, const uint32_t inRegValue, const NTV2DeviceID inDeviceID) const
 	{
-		AJAAutoLock lock(&mGuardMutex);
-		RegNumToDecoderMap::const_iterator iter(mRegNumToDecoderMap.find(inRegNum));
-		ostringstream oss;
-		if (iter != mRegNumToDecoderMap.end()  &&  iter->second)
-		{
-			const Decoder * pDecoder (iter->second);
-			oss << (*pDecoder)(inRegNum, inRegValue, inDeviceID);
-		}
-		return oss.str();
+		const int	infoNdx (FindRegInfo(inRegNum));
+		if (infoNdx >= 0  &&  mRegInfos[size_t(infoNdx)].fDecoder)
+			return (*mRegInfos[size_t(infoNdx)].fDecoder)(inRegNum, inRegValue, inDeviceID);
+		return string();
 	}
 	
 	bool	IsRegInClass (const uint32_t inRegNum, const string & inClassName) const
 	{
-		AJAAutoLock lock(&mGuardMutex);
-		for (RegClassToRegNumConstIter	it(mRegClassToRegNumMMap.find(inClassName));  it != mRegClassToRegNumMMap.end() && it->first == inClassName;  ++it)
-			if (it->second == inRegNum)
-				return true;
-		return false;
+		const int	classNdx (RegClassIndex(inClassName));
+		const int	infoNdx (classNdx >= 0 ? FindRegInfo(inRegNum) : -1);
+		return infoNdx >= 0  &&  (mRegInfos[size_t(infoNdx)].fClasses & (RegClassMask(1) << classNdx));
 	}
 	
 	inline bool		IsRegisterWriteOnly (const uint32_t inRegNum) const		{return IsRegInClass (inRegNum, kRegClass_WriteOnly);}
@@ -2002,38 +2204,46 @@ public:
 
 	NTV2StringSet	GetAllRegisterClasses (void) const
 	{
-		AJAAutoLock lock(&mGuardMutex);
-		if (mAllRegClasses.empty())
-			for (RegClassToRegNumConstIter it(mRegClassToRegNumMMap.begin());  it != mRegClassToRegNumMMap.end();  ++it)
-				if (mAllRegClasses.find(it->first) == mAllRegClasses.end())
-					mAllRegClasses.insert(it->first);
 		return mAllRegClasses;
 	}
 
 	NTV2StringSet	GetRegisterClasses (const uint32_t inRegNum, const bool inRemovePrefix) const
 	{
-		AJAAutoLock lock(&mGuardMutex);
 		NTV2StringSet	result;
-		NTV2StringSet	allClasses	(GetAllRegisterClasses());
-		for (NTV2StringSetConstIter it(allClasses.begin());  it != allClasses.end();  ++it)
-			if (IsRegInClass (inRegNum, *it))
-			{
-				string str(*it);
-				if (inRemovePrefix)
-					str.erase(0, 10);	//	Remove "kRegClass_" prefix
-				if (result.find(str) == result.end())
-					result.insert(str);
-			}
+		const int		infoNdx (FindRegInfo(inRegNum));
+		if (infoNdx >= 0)
+			for (size_t classNdx(0);  classNdx < kNumRegClasses;  classNdx++)
+				if (mRegInfos[size_t(infoNdx)].fClasses & (RegClassMask(1) << classNdx))
+					result.insert(sRegClassNames[classNdx] + (inRemovePrefix ? kRegClassPrefixLen : 0));
 		return result;
 	}
 
 	NTV2RegNumSet	GetRegistersForClass (const string & inClassName) const
 	{
-		AJAAutoLock lock(&mGuardMutex);
 		NTV2RegNumSet	result;
-		for (RegClassToRegNumConstIter it(mRegClassToRegNumMMap.find(inClassName));  it != mRegClassToRegNumMMap.end() && it->first == inClassName;  ++it)
-			if (result.find(it->second) == result.end())
-				result.insert(it->second);
+		AddRegistersInClass (result, inClassName);
+		return result;
+	}
+
+	//	Adds the registers in the given class to the given set, but only those that are also in at least one
+	//	of the classes in the given mask (by default, all classes).
+	void	AddRegistersInClass (NTV2RegNumSet & outRegNums, const string & inClassName, const RegClassMask inAlsoInAnyOf = ~RegClassMask(0)) const
+	{
+		const int	classNdx (RegClassIndex(inClassName));
+		if (classNdx < 0)
+			return;
+		const vector<uint32_t> &	regNums	(mClassRegs[classNdx]);
+		for (size_t ndx(0);  ndx < regNums.size();  ndx++)
+			if (mRegInfos[size_t(FindRegInfo(regNums[ndx]))].fClasses & inAlsoInAnyOf)
+				outRegNums.insert(outRegNums.end(), regNums[ndx]);	//	regNums is sorted, so hint the end
+	}
+
+	//	Returns the class mask for the first inNumChannels channels (kRegClass_Channel1, kRegClass_Channel2, ...).
+	inline RegClassMask	ChannelClassMask (const UWord inNumChannels) const
+	{
+		RegClassMask	result(0);
+		for (UWord num(0);  num < inNumChannels  &&  num < sizeof(gChlClasses) / sizeof(gChlClasses[0]);  num++)
+			result |= RegClassMask(1) << RegClassIndex(gChlClasses[num]);
 		return result;
 	}
 
@@ -2043,44 +2253,27 @@ public:
 		const uint32_t		maxRegNum	(::NTV2DeviceGetMaxRegisterNumber(inDeviceID));
 
 		for (uint32_t regNum (0);  regNum <= maxRegNum;	 regNum++)
-			result.insert(regNum);
-
-		AJAAutoLock lock(&mGuardMutex);
+			result.insert(result.end(), regNum);
 
 		if (::NTV2DeviceCanDoCustomAnc(inDeviceID))
 		{
-			const NTV2RegNumSet ancRegs			(GetRegistersForClass(kRegClass_Anc));
 			const UWord			numVideoInputs (::NTV2DeviceGetNumVideoInputs(inDeviceID));
 			const UWord			numVideoOutputs (::NTV2DeviceGetNumVideoOutputs(inDeviceID));
 			const UWord			numSpigots(numVideoInputs > numVideoOutputs ? numVideoInputs : numVideoOutputs);
-			NTV2RegNumSet		allChanRegs;	//	For just those channels it supports
-			for (UWord num(0);	num < numSpigots;	num++)
-			{
-				const NTV2RegNumSet chRegs (GetRegistersForClass(gChlClasses[num]));
-				allChanRegs.insert(chRegs.begin(), chRegs.end());
-			}
-			std::set_intersection (ancRegs.begin(), ancRegs.end(),	allChanRegs.begin(), allChanRegs.end(),	 std::inserter(result, result.begin()));
+			AddRegistersInClass (result, kRegClass_Anc, ChannelClassMask(numSpigots));	//	For just those channels it supports
 		}
 
 		if (::NTV2DeviceCanDoCustomAux(inDeviceID))
 		{
-			const NTV2RegNumSet auxRegs			(GetRegistersForClass(kRegClass_Aux));
 			const UWord			numVideoInputs (::NTV2DeviceGetNumHDMIVideoInputs(inDeviceID));
 			const UWord			numVideoOutputs (::NTV2DeviceGetNumHDMIVideoOutputs(inDeviceID));
 			const UWord			numSpigots(numVideoInputs > numVideoOutputs ? numVideoInputs : numVideoOutputs);
-			NTV2RegNumSet		allChanRegs;	//	For just those channels it supports
-			for (UWord num(0);	num < numSpigots;	num++)
-			{
-				const NTV2RegNumSet chRegs (GetRegistersForClass(gChlClasses[num]));
-				allChanRegs.insert(chRegs.begin(), chRegs.end());
-			}
-			std::set_intersection (auxRegs.begin(), auxRegs.end(),	allChanRegs.begin(), allChanRegs.end(),	 std::inserter(result, result.begin()));
+			AddRegistersInClass (result, kRegClass_Aux, ChannelClassMask(numSpigots));	//	For just those channels it supports
 		}
 
 		if (::NTV2DeviceCanDoSDIErrorChecks(inDeviceID))
 		{
-			const NTV2RegNumSet sdiErrRegs	(GetRegistersForClass(kRegClass_SDIError));
-			result.insert(sdiErrRegs.begin(), sdiErrRegs.end());
+			AddRegistersInClass (result, kRegClass_SDIError);
 		}
 
 		if (::NTV2DeviceCanDoAudioMixer(inDeviceID))
@@ -2097,21 +2290,13 @@ public:
 
 		if (::NTV2DeviceCanDoEnhancedCSC(inDeviceID))
 		{
-			const NTV2RegNumSet ecscRegs	(GetRegistersForClass(kRegClass_CSC));
 			const UWord			numCSCs		(::NTV2DeviceGetNumCSCs(inDeviceID));
-			NTV2RegNumSet		allChanRegs;	//	For just those CSCs it supports
-			for (UWord num(0);	num < numCSCs;	num++)
-			{
-				const NTV2RegNumSet chRegs (GetRegistersForClass(gChlClasses[num]));
-				allChanRegs.insert(chRegs.begin(), chRegs.end());
-			}
-			std::set_intersection (ecscRegs.begin(), ecscRegs.end(),  allChanRegs.begin(), allChanRegs.end(),  std::inserter(result, result.begin()));
+			AddRegistersInClass (result, kRegClass_CSC, ChannelClassMask(numCSCs));	//	For just those CSCs it supports
 		}
 
 		if (::NTV2DeviceGetNumLUTs(inDeviceID))
 		{
-			const NTV2RegNumSet LUTRegs (GetRegistersForClass(kRegClass_LUT));
-			result.insert(LUTRegs.begin(), LUTRegs.end());
+			AddRegistersInClass (result, kRegClass_LUT);
 		}
 
 		if (::NTV2DeviceGetNumHDMIVideoInputs(inDeviceID) > 1)	//	KonaHDMI
@@ -2147,15 +2332,8 @@ public:
 
 		if (::NTV2DeviceHasNTV4FrameStores(inDeviceID))
 		{
-			const NTV2RegNumSet ntv4FSRegs (GetRegistersForClass(kRegClass_NTV4FrameStore));
 			const UWord numFrameStores (::NTV2DeviceGetNumFrameStores(inDeviceID));
-			NTV2RegNumSet chanRegs;	//	Just the supported NTV4 FrameStores
-			for (UWord num(0);  num < numFrameStores;  num++)
-			{
-				const NTV2RegNumSet chRegs (GetRegistersForClass(gChlClasses[num]));
-				chanRegs.insert(chRegs.begin(), chRegs.end());
-			}
-			std::set_intersection (ntv4FSRegs.begin(), ntv4FSRegs.end(),  chanRegs.begin(), chanRegs.end(),  std::inserter(result, result.begin()));
+			AddRegistersInClass (result, kRegClass_NTV4FrameStore, ChannelClassMask(numFrameStores));	//	Just the supported NTV4 FrameStores
 		}
 
 		if (::NTV2DeviceCanDoIDSwitch(inDeviceID))
@@ -2220,14 +2398,12 @@ public:
 
 		if (inOtherRegsToInclude & kIncludeOtherRegs_VRegs)
 		{
-			const NTV2RegNumSet vRegs	(GetRegistersForClass(kRegClass_Virtual));
-			result.insert(vRegs.begin(), vRegs.end());
+			AddRegistersInClass (result, kRegClass_Virtual);
 		}
 
 		if (inOtherRegsToInclude & kIncludeOtherRegs_XptROM)
 		{
-			const NTV2RegNumSet xptMapRegs	(GetRegistersForClass(kRegClass_XptROM));
-			result.insert(xptMapRegs.begin(), xptMapRegs.end());
+			AddRegistersInClass (result, kRegClass_XptROM);
 		}
 		return result;
 	}
@@ -2238,105 +2414,114 @@ public:
 		NTV2RegNumSet	result;
 		string			nameStr(inName);
 		const size_t	nameStrLen(aja::lower(nameStr).length());
-		StringToRegNumConstIter it;
-		AJAAutoLock lock(&mGuardMutex);
 		if (inMatchStyle == EXACTMATCH)
 		{
-			it = mStringToRegNumMMap.find(nameStr);
-			if (it != mStringToRegNumMMap.end())
-				result.insert(it->second);
+			const uint32_t	mask(uint32_t(mRegNameIndex.size()) - 1);
+			for (uint32_t slot(HashChars(nameStr.data(), nameStrLen, true) & mask);  mRegNameIndex[slot];  slot = (slot + 1) & mask)
+			{
+				const RegInfo &	info	(mRegInfos[mRegNameIndex[slot] - 1]);
+				const char *	pName	(RegName(info));
+				if (::strlen(pName) == nameStrLen  &&  MatchesLower(pName, nameStr.data(), nameStrLen))
+					{result.insert(info.fRegNum);	break;}
+			}
 			return result;
 		}
 		//	Inexact match...
-		for (it = mStringToRegNumMMap.begin();	it != mStringToRegNumMMap.end();  ++it)
+		for (size_t ndx(0);  ndx < mNamedRegs.size();  ndx++)
 		{
-			const size_t pos(it->first.find(nameStr));
-			if (pos == string::npos)
+			const RegInfo &	info	(mRegInfos[mNamedRegs[ndx]]);
+			const char *	pName	(RegName(info));
+			const size_t	len		(::strlen(pName));
+			if (len < nameStrLen)
 				continue;
+			bool	matched (false);
 			switch (inMatchStyle)
 			{
-				case CONTAINS:		result.insert(it->second);					break;
-				case STARTSWITH:	if (pos == 0)
-										{result.insert(it->second);}
-									break;
-				case ENDSWITH:		if (pos+nameStrLen == it->first.length())
-										{result.insert(it->second);}
+				case CONTAINS:		for (size_t pos(0);  pos + nameStrLen <= len  &&  !matched;  pos++)
+										matched = MatchesLower(pName + pos, nameStr.data(), nameStrLen);
 									break;
+				case STARTSWITH:	matched = MatchesLower(pName, nameStr.data(), nameStrLen);					break;
+				case ENDSWITH:		matched = MatchesLower(pName + len - nameStrLen, nameStr.data(), nameStrLen);	break;
 				default:			break;
 			}
+			if (matched)
+				result.insert(info.fRegNum);
 		}
 		return result;
 	}
 
 	bool		GetXptRegNumAndMaskIndex (const NTV2InputCrosspointID inInputXpt, uint32_t & outXptRegNum, uint32_t & outMaskIndex) const
 	{
-		AJAAutoLock lock(&mGuardMutex);
 		outXptRegNum = 0xFFFFFFFF;
 		outMaskIndex = 0xFFFFFFFF;
-		InputXpt2XptRegNumMaskIndexMapConstIter iter	(mInputXpt2XptRegNumMaskIndexMap.find (inInputXpt));
-		if (iter == mInputXpt2XptRegNumMaskIndexMap.end())
+		if (ULWord(inInputXpt) >= sizeof(mInputXptRegInfo) / sizeof(mInputXptRegInfo[0]))
 			return false;
-		outXptRegNum = iter->second.first;
-		outMaskIndex = iter->second.second;
+		const uint32_t	xptRegInfo (mInputXptRegInfo[inInputXpt]);
+		if (xptRegInfo == kNoXptRegInfo)
+			return false;
+		outXptRegNum = xptRegInfo >> 2;
+		outMaskIndex = xptRegInfo & 3;
 		return true;
 	}
 
 	NTV2InputCrosspointID	GetInputCrosspointID (const uint32_t inXptRegNum, const uint32_t inMaskIndex) const
 	{
-		AJAAutoLock lock(&mGuardMutex);
-		const XptRegNumAndMaskIndex				key		(inXptRegNum, inMaskIndex);
-		XptRegNumMaskIndex2InputXptMapConstIter iter	(mXptRegNumMaskIndex2InputXptMap.find (key));
-		if (iter != mXptRegNumMaskIndex2InputXptMap.end())
-			return iter->second;
+		const int	infoNdx (inMaskIndex < 4 ? FindRegInfo(inXptRegNum) : -1);
+		if (infoNdx >= 0  &&  mRegInfos[size_t(infoNdx)].fInputXpts[inMaskIndex] != kNoInputXpt)
+			return NTV2InputCrosspointID(mRegInfos[size_t(infoNdx)].fInputXpts[inMaskIndex]);
 		return NTV2_INPUT_CROSSPOINT_INVALID;
 	}
 
 	ostream &	Print (ostream & inOutStream) const
 	{
-		AJAAutoLock lock(&mGuardMutex);
 		static const string		sLineBreak	(96, '=');
 		static const uint32_t	sMasks[4]	=	{0x000000FF, 0x0000FF00, 0x00FF0000, 0xFF000000};
-		
-		inOutStream << endl << sLineBreak << endl << "RegisterExpert:  Dump of RegNumToStringMap:  " << mRegNumToStringMap.size() << " mappings:" << endl << sLineBreak << endl;
-		for (RegNumToStringMap::const_iterator it (mRegNumToStringMap.begin());	 it != mRegNumToStringMap.end();  ++it)
-			inOutStream << "reg " << setw(5) << it->first << "(" << HEX0N(it->first,8) << dec << ")	 =>	 '" << it->second << "'" << endl;
-		
-		inOutStream << endl << sLineBreak << endl << "RegisterExpert:  Dump of RegNumToDecoderMap:	" << mRegNumToDecoderMap.size() << " mappings:" << endl << sLineBreak << endl;
-		for (RegNumToDecoderMap::const_iterator it (mRegNumToDecoderMap.begin());  it != mRegNumToDecoderMap.end();	 ++it)
-			inOutStream << "reg " << setw(5) << it->first << "(" << HEX0N(it->first,8) << dec << ")	 =>	 " << (it->second == &mDefaultRegDecoder ? "(default decoder)" : "Custom Decoder") << endl;
-		
-		inOutStream << endl << sLineBreak << endl << "RegisterExpert:  Dump of RegClassToRegNumMMap:  " << mRegClassToRegNumMMap.size() << " mappings:" << endl << sLineBreak << endl;
-		for (RegClassToRegNumMMap::const_iterator it (mRegClassToRegNumMMap.begin());  it != mRegClassToRegNumMMap.end();  ++it)
-			inOutStream << setw(32) << it->first << "  =>  reg " << setw(5) << it->second << "(" << HEX0N(it->second,8) << dec << ") " << RegNameToString(it->second) << endl;
-		
-		inOutStream << endl << sLineBreak << endl << "RegisterExpert:  Dump of StringToRegNumMMap:	" << mStringToRegNumMMap.size() << " mappings:" << endl << sLineBreak << endl;
-		for (StringToRegNumMMap::const_iterator it (mStringToRegNumMMap.begin());  it != mStringToRegNumMMap.end();	 ++it)
-			inOutStream << setw(32) << it->first << "  =>  reg " << setw(5) << it->second << "(" << HEX0N(it->second,8) << dec << ") " << RegNameToString(it->second) << endl;
-		
-		inOutStream << endl << sLineBreak << endl << "RegisterExpert:  Dump of InputXpt2XptRegNumMaskIndexMap:	" << mInputXpt2XptRegNumMaskIndexMap.size() << " mappings:" << endl << sLineBreak << endl;
-		for (InputXpt2XptRegNumMaskIndexMap::const_iterator it (mInputXpt2XptRegNumMaskIndexMap.begin());  it != mInputXpt2XptRegNumMaskIndexMap.end();	 ++it)
-			inOutStream << setw(32) << ::NTV2InputCrosspointIDToString(it->first) << "(" << HEX0N(it->first,2)
-			<< ")  =>  reg " << setw(3) << it->second.first << "(" << HEX0N(it->second.first,3) << dec << "|" << setw(20) << RegNameToString(it->second.first)
-			<< ") mask " << it->second.second << "(" << HEX0N(sMasks[it->second.second],8) << ")" << endl;
-		
-		inOutStream << endl << sLineBreak << endl << "RegisterExpert:  Dump of XptRegNumMaskIndex2InputXptMap:	" << mXptRegNumMaskIndex2InputXptMap.size() << " mappings:" << endl << sLineBreak << endl;
-		for (XptRegNumMaskIndex2InputXptMap::const_iterator it (mXptRegNumMaskIndex2InputXptMap.begin());  it != mXptRegNumMaskIndex2InputXptMap.end();	 ++it)
-			inOutStream << "reg " << setw(3) << it->first.first << "(" << HEX0N(it->first.first,4) << "|" << setw(20) << RegNameToString(it->first.first)
-			<< ") mask " << it->first.second << "(" << HEX0N(sMasks[it->first.second],8) << ")	=>	"
-			<< setw(27) << ::NTV2InputCrosspointIDToString(it->second) << "(" << HEX0N(it->second,2) << ")" << endl;
+		vector<uint32_t>	regNums;
+		for (size_t ndx(0);  ndx < mRegInfos.size();  ndx++)
+			regNums.push_back(mRegInfos[ndx].fRegNum);
+		std::sort(regNums.begin(), regNums.end());
+
+		inOutStream << endl << sLineBreak << endl << "RegisterExpert:  Dump of register names:  " << mNamedRegs.size() << " mappings:" << endl << sLineBreak << endl;
+		for (size_t ndx(0);  ndx < regNums.size();  ndx++)
+		{	const RegInfo & info (mRegInfos[size_t(FindRegInfo(regNums[ndx]))]);
+			if (info.fNameOffset != kNoRegName)
+				inOutStream << "reg " << setw(5) << info.fRegNum << "(" << HEX0N(info.fRegNum,8) << dec << ")	 =>	 '" << RegName(info) << "'" << endl;
+		}
+
+		inOutStream << endl << sLineBreak << endl << "RegisterExpert:  Dump of register decoders:" << endl << sLineBreak << endl;
+		for (size_t ndx(0);  ndx < regNums.size();  ndx++)
+		{	const RegInfo & info (mRegInfos[size_t(FindRegInfo(regNums[ndx]))]);
+			if (info.fDecoder)
+				inOutStream << "reg " << setw(5) << info.fRegNum << "(" << HEX0N(info.fRegNum,8) << dec << ")	 =>	 " << (info.fDecoder == &mDefaultRegDecoder ? "(default decoder)" : "Custom Decoder") << endl;
+		}
+
+		inOutStream << endl << sLineBreak << endl << "RegisterExpert:  Dump of register classes:  " << mAllRegClasses.size() << " classes:" << endl << sLineBreak << endl;
+		for (size_t classNdx(0);  classNdx < kNumRegClasses;  classNdx++)
+			for (size_t ndx(0);  ndx < mClassRegs[classNdx].size();  ndx++)
+				inOutStream << setw(32) << sRegClassNames[classNdx] << "  =>  reg " << setw(5) << mClassRegs[classNdx][ndx] << "(" << HEX0N(mClassRegs[classNdx][ndx],8) << dec << ") " << RegNameToString(mClassRegs[classNdx][ndx]) << endl;
+
+		inOutStream << endl << sLineBreak << endl << "RegisterExpert:  Dump of input crosspoint select group registers:" << endl << sLineBreak << endl;
+		for (size_t xpt(0);  xpt < sizeof(mInputXptRegInfo) / sizeof(mInputXptRegInfo[0]);  xpt++)
+			if (mInputXptRegInfo[xpt] != kNoXptRegInfo)
+			{	const uint32_t regNum (mInputXptRegInfo[xpt] >> 2), maskNdx (mInputXptRegInfo[xpt] & 3);
+				inOutStream << setw(32) << ::NTV2InputCrosspointIDToString(NTV2InputCrosspointID(xpt)) << "(" << HEX0N(xpt,2)
+				<< ")  =>  reg " << setw(3) << regNum << "(" << HEX0N(regNum,3) << dec << "|" << setw(20) << RegNameToString(regNum)
+				<< ") mask " << maskNdx << "(" << HEX0N(sMasks[maskNdx],8) << ")" << endl;
+			}
+
+		inOutStream << endl << sLineBreak << endl << "RegisterExpert:  Dump of crosspoint select group register input crosspoints:" << endl << sLineBreak << endl;
+		for (size_t ndx(0);  ndx < regNums.size();  ndx++)
+		{	const RegInfo & info (mRegInfos[size_t(FindRegInfo(regNums[ndx]))]);
+			for (uint32_t maskNdx(0);  maskNdx < 4;  maskNdx++)
+				if (info.fInputXpts[maskNdx] != kNoInputXpt)
+					inOutStream << "reg " << setw(3) << info.fRegNum << "(" << HEX0N(info.fRegNum,4) << "|" << setw(20) << RegNameToString(info.fRegNum)
+					<< ") mask " << maskNdx << "(" << HEX0N(sMasks[maskNdx],8) << ")	=>	"
+					<< setw(27) << ::NTV2InputCrosspointIDToString(NTV2InputCrosspointID(info.fInputXpts[maskNdx])) << "(" << HEX0N(uint32_t(info.fInputXpts[maskNdx]),2) << ")" << endl;
+		}
 		return inOutStream;
 	}
 
 private:
-	typedef std::map<uint32_t, string>	RegNumToStringMap;
-	typedef std::pair<uint32_t, string> RegNumToStringPair;
-
-	static string ToLower (const string & inStr)
-	{
-		string	result (inStr);
-		std::transform (result.begin (), result.end (), result.begin (), ::tolower);
-		return result;
-	}
 
 	struct DecodeGlobalControlReg : public Decoder
 	{
@@ -4753,28 +4938,17 @@ private:
 	static const int	ENDSWITH	=	2;
 	static const int	EXACTMATCH	=	3;
 
-	typedef map <uint32_t, const Decoder *>		RegNumToDecoderMap;
-	typedef pair <uint32_t, const Decoder *>	RegNumToDecoderPair;
-	typedef multimap <string, uint32_t>			RegClassToRegNumMMap, StringToRegNumMMap;
-	typedef pair <string, uint32_t>				StringToRegNumPair;
-	typedef RegClassToRegNumMMap::const_iterator	RegClassToRegNumConstIter;
-	typedef StringToRegNumMMap::const_iterator	StringToRegNumConstIter;
-
-	typedef pair <uint32_t, uint32_t>							XptRegNumAndMaskIndex;	//	First: register number;	 second: mask index (0=0x000000FF, 1=0x0000FF00, 2=0x00FF0000, 3=0xFF000000)
-	typedef map <NTV2InputCrosspointID, XptRegNumAndMaskIndex>	InputXpt2XptRegNumMaskIndexMap;
-	typedef map <XptRegNumAndMaskIndex, NTV2InputCrosspointID>	XptRegNumMaskIndex2InputXptMap;
-	typedef InputXpt2XptRegNumMaskIndexMap::const_iterator		InputXpt2XptRegNumMaskIndexMapConstIter;
-	typedef XptRegNumMaskIndex2InputXptMap::const_iterator		XptRegNumMaskIndex2InputXptMapConstIter;
-
 private:	//	INSTANCE DATA
 	mutable AJALock			mGuardMutex;
-	RegNumToStringMap		mRegNumToStringMap;
-	RegNumToDecoderMap		mRegNumToDecoderMap;
-	RegClassToRegNumMMap	mRegClassToRegNumMMap;
-	StringToRegNumMMap		mStringToRegNumMMap;
-	mutable NTV2StringSet	mAllRegClasses; //	Mutable -- caches results from 'const' method GetAllRegisterClasses
-	InputXpt2XptRegNumMaskIndexMap		mInputXpt2XptRegNumMaskIndexMap;
-	XptRegNumMaskIndex2InputXptMap		mXptRegNumMaskIndex2InputXptMap;
+	vector<RegInfo>			mRegInfos;			//	One per register, in the order they were first defined
+	vector<uint32_t>		mRegNumIndex;		//	Open-addressed reg num hash table:  mRegInfos index + 1 (zero if empty)
+	string					mRegNames;			//	Every register name, each followed by a NUL
+	vector<uint32_t>		mNamedRegs;			//	mRegInfos indexes of named registers, in the order they were named
+	vector<uint32_t>		mRegNameIndex;		//	Open-addressed lower-case reg name hash table:  mRegInfos index + 1 (zero if empty)
+	uint8_t					mRegClassIndex[kRegClassIndexSize];	//	Open-addressed class name hash table:  sRegClassNames index (kNoRegClass if empty)
+	vector<uint32_t>		mClassRegs[kNumRegClasses];			//	Sorted reg nums in each class
+	NTV2StringSet			mAllRegClasses;		//	Names of non-empty classes
+	uint32_t				mInputXptRegInfo[NTV2_LAST_INPUT_CROSSPOINT + 1];	//	Crosspoint select group reg num (<< 2) and mask index, or kNoXptRegInfo
 	
 };	//	RegisterExpert
 
@@ -300,6 +300,20 @@ bool CNTV2Card::ApplySignalRoute (const NTV2XptConnections & inConnections, cons
 	return failures == 0;
 }
 
+bool CNTV2Card::ApplySignalRouteChanges (const NTV2XptConnections & inConnections, const bool inReplace)
+{
+	NTV2XptConnections	current;
+	NTV2RegisterWrites	regWrites;
+	if (!GetConnections(current))
+		{ROUTEFAIL(GetDisplayName() << ": GetConnections failed");  return false;}
+	if (!CNTV2SignalRouter::GetChangedRegisterWrites (current, inConnections, regWrites, inReplace))
+		{ROUTEFAIL(GetDisplayName() << ": GetChangedRegisterWrites failed");  return false;}
+	if (regWrites.empty())
+		{ROUTEDBG(GetDisplayName() << ": Routing unchanged");  return true;}
+	ROUTEINFO(GetDisplayName() << ": Writing " << DEC(regWrites.size()) << " routing register(s)");
+	return WriteRegisters(regWrites);
+}
+
 bool CNTV2Card::RemoveConnections (const NTV2XptConnections & inConnections)
 {
 	unsigned failures(0);
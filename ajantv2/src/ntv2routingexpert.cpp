@@ -6,8 +6,12 @@
 **/
 
 #include "ntv2routingexpert.h"
+#include "ntv2utils.h"
+#include "ntv2devicefeatures.hh"
 #include "ajabase/system/debug.h"
 #include "ajabase/common/common.h"
+#include <algorithm>
+#include <string.h>
 
 // Logging helpers
 #define	HEX16(__x__)		"0x" << std::hex << std::setw(16) << std::setfill('0') << uint64_t(__x__)  << std::dec
@@ -26,6 +30,37 @@
 static uint32_t				gInstanceTally(0);
 static uint32_t				gLivingInstances(0);
 
+//	gInputXptFlags bits
+static const uint8_t		kXptFlagRGBOnly		(0x01);
+static const uint8_t		kXptFlagYUVOnly		(0x02);
+static const uint8_t		kXptFlagKey			(0x04);
+
+//	DeviceRouteGraph fInputInfo/fOutputInfo bits
+static const uint8_t		kRouteXptPresent	(0x01);		//	Crosspoint exists on the device
+static const uint8_t		kRouteXptNeedsRGB	(0x02);		//	Input only accepts RGB signals
+static const uint8_t		kRouteXptNeedsYUV	(0x04);		//	Input only accepts YCbCr signals
+static const uint8_t		kRouteXptFrameStore	(0x08);		//	Crosspoint belongs to a FrameStore
+static const size_t			kRouteXptTableSize	(size_t(NTV2_LAST_OUTPUT_CROSSPOINT) + 1);
+
+static inline bool IsRGBOutputXpt (const NTV2OutputXptID inOutputXpt)
+{	//	Every RGB output crosspoint has bit 7 set (e.g. NTV2_XptFrameBuffer1RGB == NTV2_XptFrameBuffer1YUV | 0x80)
+	return (ULWord(inOutputXpt) & 0x80) ? true : false;
+}
+
+static inline bool InputAcceptsOutput (const uint8_t inInputInfo, const NTV2OutputXptID inOutputXpt)
+{
+	if (inInputInfo & kRouteXptNeedsRGB)
+		return IsRGBOutputXpt(inOutputXpt);
+	if (inInputInfo & kRouteXptNeedsYUV)
+		return !IsRGBOutputXpt(inOutputXpt);
+	return true;
+}
+
+static inline uint32_t RouteKey (const NTV2OutputXptID inOutputXpt, const NTV2InputXptID inInputXpt, const uint8_t inInputInfo)
+{
+	return (uint32_t(inOutputXpt) & 0xFF)  |  ((uint32_t(inInputXpt) & 0xFF) << 8)  |  (uint32_t(inInputInfo) << 16);
+}
+
 RoutingExpertPtr RoutingExpert::GetInstance(const bool inCreateIfNecessary)
 {
 	AJAAutoLock		locker(&gRoutingExpertLock);
@@ -57,6 +92,7 @@ RoutingExpert::RoutingExpert()
 	InitOutputXpt2WidgetIDs();
 	InitWidgetIDToChannels();
 	InitWidgetIDToWidgetTypes();
+	InitInputXptFlags();
 	AJAAtomic::Increment(&gInstanceTally);
 	AJAAtomic::Increment(&gLivingInstances);
 	SRiNOTE(DEC(gLivingInstances) << " extant, " << DEC(gInstanceTally) << " total");
@@ -112,23 +148,16 @@ NTV2WidgetType				RoutingExpert::WidgetIDToType (const NTV2WidgetID inWidgetID)
 {
 	AJAAutoLock lock(&gLock);
 	NTV2_ASSERT(!gWidget2Types.empty());
-	for (Widget2TypesConstIter iter = gWidget2Types.begin(); iter != gWidget2Types.end(); iter++) {
-		if (iter->first == inWidgetID) {
-			return iter->second;
-		}
-	}
-	return NTV2WidgetType_Invalid;
+	Widget2TypesConstIter iter(gWidget2Types.find(inWidgetID));
+	return iter != gWidget2Types.end() ? iter->second : NTV2WidgetType_Invalid;
 }
 
 NTV2Channel			RoutingExpert::WidgetIDToChannel(const NTV2WidgetID inWidgetID)
 {
 	AJAAutoLock lock(&gLock);
 	NTV2_ASSERT(!gWidget2Channels.empty());
-	for (Widget2ChannelsConstIter iter = gWidget2Channels.begin(); iter != gWidget2Channels.end(); iter++) {
-		if (iter->first == inWidgetID)
-			return iter->second;
-	}
-	return NTV2_CHANNEL_INVALID;
+	Widget2ChannelsConstIter iter(gWidget2Channels.find(inWidgetID));
+	return iter != gWidget2Channels.end() ? iter->second : NTV2_CHANNEL_INVALID;
 }
 
 NTV2WidgetID		RoutingExpert::WidgetIDFromTypeAndChannel(const NTV2WidgetType inWidgetType, const NTV2Channel inChannel)
@@ -205,23 +234,23 @@ bool				RoutingExpert::IsOutputXptValid (const NTV2OutputXptID inOutputXpt) cons
 
 bool				RoutingExpert::IsRGBOnlyInputXpt (const NTV2InputXptID inInputXpt) const
 {
-	AJAAutoLock	lock(&gLock);
-	NTV2_ASSERT(!gRGBOnlyInputXpts.empty());
-	return gRGBOnlyInputXpts.find(inInputXpt) != gRGBOnlyInputXpts.end();
+	//	gInputXptFlags is immutable after construction, so no lock is needed
+	NTV2_ASSERT(!gInputXptFlags.empty());
+	return NTV2_IS_VALID_InputCrosspointID(inInputXpt)  &&  (gInputXptFlags[inInputXpt] & kXptFlagRGBOnly);
 }
 
 bool				RoutingExpert::IsYUVOnlyInputXpt (const NTV2InputXptID inInputXpt) const
 {
-	AJAAutoLock	lock(&gLock);
-	NTV2_ASSERT(!gYUVOnlyInputXpts.empty());
-	return gYUVOnlyInputXpts.find(inInputXpt) != gYUVOnlyInputXpts.end();
+	//	gInputXptFlags is immutable after construction, so no lock is needed
+	NTV2_ASSERT(!gInputXptFlags.empty());
+	return NTV2_IS_VALID_InputCrosspointID(inInputXpt)  &&  (gInputXptFlags[inInputXpt] & kXptFlagYUVOnly);
 }
 
 bool				RoutingExpert::IsKeyInputXpt (const NTV2InputXptID inInputXpt) const
 {
-	AJAAutoLock	lock(&gLock);
-	NTV2_ASSERT(!gKeyInputXpts.empty());
-	return gKeyInputXpts.find(inInputXpt) != gKeyInputXpts.end();
+	//	gInputXptFlags is immutable after construction, so no lock is needed
+	NTV2_ASSERT(!gInputXptFlags.empty());
+	return NTV2_IS_VALID_InputCrosspointID(inInputXpt)  &&  (gInputXptFlags[inInputXpt] & kXptFlagKey);
 }
 
 bool				RoutingExpert::IsSDIWidget(const NTV2WidgetType inWidgetType) const
@@ -301,6 +330,189 @@ bool				RoutingExpert::IsHDMIOutWidget(const NTV2WidgetType inWidgetType) const
 	return gHDMIOutWidgetTypes.find(inWidgetType) != gHDMIOutWidgetTypes.end();
 }
 
+bool				RoutingExpert::GetDeviceInputXpts (const NTV2DeviceID inDeviceID, NTV2InputXptIDSet & outInputs)
+{
+	AJAAutoLock lock(&gLock);
+	outInputs = GetDeviceRouteGraph(inDeviceID).fInputXpts;
+	return !outInputs.empty();
+}
+
+bool				RoutingExpert::GetDeviceOutputXpts (const NTV2DeviceID inDeviceID, NTV2OutputXptIDSet & outOutputs)
+{
+	AJAAutoLock lock(&gLock);
+	outOutputs = GetDeviceRouteGraph(inDeviceID).fOutputXpts;
+	return !outOutputs.empty();
+}
+
+RoutingExpert::DeviceRouteGraph &	RoutingExpert::GetDeviceRouteGraph (const NTV2DeviceID inDeviceID)
+{	//	Caller must hold gLock
+	DeviceRouteGraphs::iterator it(gDeviceRouteGraphs.find(inDeviceID));
+	if (it != gDeviceRouteGraphs.end())
+		return it->second;
+
+	DeviceRouteGraph & graph (gDeviceRouteGraphs[inDeviceID]);
+	graph.fInputInfo.resize(kRouteXptTableSize, 0);
+	graph.fOutputInfo.resize(kRouteXptTableSize, 0);
+	graph.fInputChannel.resize(kRouteXptTableSize, NTV2_CHANNEL_INVALID);
+	graph.fOutputChannel.resize(kRouteXptTableSize, NTV2_CHANNEL_INVALID);
+
+	//	FrameStore DS2 crosspoints only exist on devices with 425 muxes or 8K (e.g. not on IP25G)...
+	const bool hasFrameStoreDS2 (::NTV2DeviceCanDo425Mux(inDeviceID)  ||  ::NTV2DeviceCanDo8KVideo(inDeviceID));
+	std::vector<RouteConverter> dualLinkOuts;
+	for (NTV2WidgetID widgetID(NTV2WidgetID(NTV2_WIDGET_FIRST));  NTV2_IS_VALID_WIDGET(widgetID);  widgetID = NTV2WidgetID(widgetID+1))
+	{
+		if (!::NTV2DeviceCanDoWidget(inDeviceID, widgetID))
+			continue;
+		const NTV2WidgetType	wgtType		(WidgetIDToType(widgetID));
+		const bool				isFrameStore(wgtType == NTV2WidgetType_FrameStore);
+		const bool				needsYUV	(IsSDIOutWidget(wgtType)  ||  wgtType == NTV2WidgetType_AnalogOut
+												||  wgtType == NTV2WidgetType_AnalogCompositeOut);
+		RouteConverter converter;
+		converter.fWidgetID = widgetID;
+		converter.fChannel = WidgetIDToChannel(widgetID);
+		converter.fInputXpt = NTV2_INPUT_CROSSPOINT_INVALID;
+
+		for (Widget2InputXptsConstIter iter(gWidget2InputXpts.find(widgetID));  iter != gWidget2InputXpts.end()  &&  iter->first == widgetID;  ++iter)
+		{
+			const NTV2InputXptID inputXpt(iter->second);
+			if (isFrameStore  &&  !hasFrameStoreDS2)
+				if (::NTV2InputCrosspointIDToString(inputXpt, false).find("DS2") != std::string::npos)
+					continue;
+			graph.fInputXpts.insert(inputXpt);
+			if (!NTV2_IS_VALID_InputCrosspointID(inputXpt))
+				continue;
+			uint8_t info (kRouteXptPresent);
+			if (gInputXptFlags[inputXpt] & kXptFlagRGBOnly)
+				info |= kRouteXptNeedsRGB;
+			else if ((gInputXptFlags[inputXpt] & kXptFlagYUVOnly)  ||  needsYUV)
+				info |= kRouteXptNeedsYUV;
+			if (isFrameStore)
+				info |= kRouteXptFrameStore;
+			graph.fInputInfo[inputXpt] = info;
+			graph.fInputChannel[inputXpt] = converter.fChannel;
+			if (!(gInputXptFlags[inputXpt] & kXptFlagKey))
+				converter.fInputXpt = inputXpt;
+		}
+
+		for (Widget2OutputXptsConstIter iter(gWidget2OutputXpts.find(widgetID));  iter != gWidget2OutputXpts.end()  &&  iter->first == widgetID;  ++iter)
+		{
+			const NTV2OutputXptID outputXpt(iter->second);
+			if (isFrameStore  &&  !hasFrameStoreDS2)
+				if (::NTV2OutputCrosspointIDToString(outputXpt, false).find("DS2") != std::string::npos)
+					continue;
+			graph.fOutputXpts.insert(outputXpt);
+			if (outputXpt == NTV2_XptBlack  ||  ULWord(outputXpt) >= kRouteXptTableSize)
+				continue;
+			graph.fOutputInfo[outputXpt] = isFrameStore ? kRouteXptPresent | kRouteXptFrameStore : kRouteXptPresent;
+			graph.fOutputChannel[outputXpt] = converter.fChannel;
+			if (wgtType != NTV2WidgetType_CSC  ||  outputXpt != ::GetCSCOutputXptFromChannel(converter.fChannel, true/*key*/))
+				converter.fOutputXpts.push_back(outputXpt);
+		}
+
+		//	Only CSCs and dual-link outputs pass a signal through unaltered (apart from its color space/packing)...
+		if (converter.fInputXpt == NTV2_INPUT_CROSSPOINT_INVALID  ||  converter.fOutputXpts.empty())
+			continue;
+		std::sort(converter.fOutputXpts.begin(), converter.fOutputXpts.end());
+		if (wgtType == NTV2WidgetType_CSC)
+			graph.fConverters.push_back(converter);
+		else if (wgtType == NTV2WidgetType_DualLinkV1Out  ||  wgtType == NTV2WidgetType_DualLinkV2Out)
+			dualLinkOuts.push_back(converter);
+	}	//	for each widget
+	graph.fConverters.insert(graph.fConverters.end(), dualLinkOuts.begin(), dualLinkOuts.end());
+	SRiDBG(::NTV2DeviceIDToString(inDeviceID) << ": " << DEC(graph.fInputXpts.size()) << " input(s), " << DEC(graph.fOutputXpts.size())
+			<< " output(s), " << DEC(graph.fConverters.size()) << " converter(s)");
+	return graph;
+}
+
+bool				RoutingExpert::FindRoute (const NTV2DeviceID inDeviceID, const NTV2OutputXptID inOutputXpt,
+												const NTV2InputXptID inInputXpt, const NTV2PixelFormat inPixelFormat,
+												NTV2XptConnections & outConnections)
+{
+	outConnections.clear();
+	if (!NTV2_IS_VALID_InputCrosspointID(inInputXpt)  ||  inOutputXpt == NTV2_XptBlack  ||  ULWord(inOutputXpt) >= kRouteXptTableSize)
+		return false;
+
+	AJAAutoLock lock(&gLock);
+	DeviceRouteGraph & graph (GetDeviceRouteGraph(inDeviceID));
+	NTV2OutputXptID	fromXpt	(inOutputXpt);
+	uint8_t			toInfo	(graph.fInputInfo[inInputXpt]);
+
+	//	FrameStores carry whatever color space their pixel format dictates...
+	if (NTV2_IS_VALID_FRAME_BUFFER_FORMAT(inPixelFormat))
+	{
+		const bool isRGB (NTV2_IS_FBF_RGB(inPixelFormat));
+		if (graph.fOutputInfo[fromXpt] & kRouteXptFrameStore)
+			fromXpt = NTV2OutputXptID(isRGB ? (ULWord(fromXpt) | 0x80) : (ULWord(fromXpt) & 0x7F));
+		if (toInfo & kRouteXptFrameStore)
+			toInfo = uint8_t((toInfo & ~(kRouteXptNeedsRGB | kRouteXptNeedsYUV))  |  (isRGB ? kRouteXptNeedsRGB : kRouteXptNeedsYUV));
+	}
+	if (!(graph.fOutputInfo[fromXpt] & kRouteXptPresent)  ||  !(toInfo & kRouteXptPresent))
+		return false;	//	Device doesn't have one or both crosspoints
+
+	const uint32_t key (RouteKey(fromXpt, inInputXpt, toInfo));
+	std::map<uint32_t, NTV2XptConnections>::const_iterator pCached(graph.fRoutes.find(key));
+	if (pCached != graph.fRoutes.end())
+		{outConnections = pCached->second;  return !outConnections.empty();}
+
+	//	Prefer converters on the same channel as the destination (or else the source) widget...
+	NTV2Channel preferredChannel (graph.fInputChannel[inInputXpt]);
+	if (!NTV2_IS_VALID_CHANNEL(preferredChannel))
+		preferredChannel = graph.fOutputChannel[fromXpt];
+	std::vector<const RouteConverter *> converters;
+	converters.reserve(graph.fConverters.size());
+	for (size_t pass(0);  pass < 2;  pass++)
+		for (size_t ndx(0);  ndx < graph.fConverters.size();  ndx++)
+			if ((graph.fConverters[ndx].fChannel == preferredChannel) == (pass == 0))
+				if (graph.fConverters[ndx].fInputXpt != inInputXpt)		//	Never pass through the destination itself
+					converters.push_back(&graph.fConverters[ndx]);
+
+	//	Breadth-first search over output crosspoints, so the first route found has the fewest hops...
+	uint8_t			visited		[kRouteXptTableSize];
+	uint8_t			viaOutput	[kRouteXptTableSize];	//	Output xpt that fed the converter that produced this one
+	uint8_t			viaInput	[kRouteXptTableSize];	//	Converter input xpt that produced this one
+	uint8_t			queue		[kRouteXptTableSize];
+	size_t			head(0), tail(0);
+	bool			found(false);
+	::memset(visited, 0, sizeof(visited));
+	visited[fromXpt] = 1;
+	queue[tail++] = uint8_t(fromXpt);
+	NTV2OutputXptID lastXpt (fromXpt);
+	while (head < tail)
+	{
+		const NTV2OutputXptID xpt (NTV2OutputXptID(queue[head++]));
+		if (InputAcceptsOutput(toInfo, xpt))
+			{lastXpt = xpt;  found = true;  break;}
+		for (size_t ndx(0);  ndx < converters.size();  ndx++)
+		{
+			const RouteConverter & converter (*converters[ndx]);
+			if (!InputAcceptsOutput(graph.fInputInfo[converter.fInputXpt], xpt))
+				continue;
+			for (size_t outNdx(0);  outNdx < converter.fOutputXpts.size();  outNdx++)
+			{
+				const NTV2OutputXptID outputXpt (converter.fOutputXpts[outNdx]);
+				if (visited[outputXpt])
+					continue;
+				visited[outputXpt] = 1;
+				viaOutput[outputXpt] = uint8_t(xpt);
+				viaInput[outputXpt] = uint8_t(converter.fInputXpt);
+				queue[tail++] = uint8_t(outputXpt);
+			}
+		}
+	}	//	while queue not empty
+
+	NTV2XptConnections & route (graph.fRoutes[key]);	//	Failures are cached too
+	if (found)
+	{
+		route.insert(NTV2XptConnection(inInputXpt, lastXpt));
+		for (NTV2OutputXptID xpt(lastXpt);  xpt != fromXpt;  xpt = NTV2OutputXptID(viaOutput[xpt]))
+			route.insert(NTV2XptConnection(NTV2InputXptID(viaInput[xpt]), NTV2OutputXptID(viaOutput[xpt])));
+	}
+	SRiDBG(::NTV2DeviceIDToString(inDeviceID) << ": " << ::NTV2OutputCrosspointIDToString(fromXpt) << " => "
+			<< ::NTV2InputCrosspointIDToString(inInputXpt) << ": " << (found ? "" : "no route ") << route);
+	outConnections = route;
+	return found;
+}
+
 
 #define NTV2SR_ASSIGN_BOTH(enumToStrMap, strToEnumMap, inEnum, inNameStr)		\
 	{																			\
@@ -1522,3 +1734,18 @@ void RoutingExpert::InitWidgetIDToWidgetTypes(void)
 	gAnalogWidgetTypes.insert(NTV2WidgetType_AnalogOut);
 	gAnalogWidgetTypes.insert(NTV2WidgetType_AnalogCompositeOut);
 }
+
+void RoutingExpert::InitInputXptFlags(void)
+{
+	//	gInputXptFlags	--	flat copy of gRGBOnlyInputXpts, gYUVOnlyInputXpts & gKeyInputXpts
+	gInputXptFlags.resize(size_t(NTV2_LAST_INPUT_CROSSPOINT) + 1, 0);
+	for (NTV2InputXptIDSetConstIter it(gRGBOnlyInputXpts.begin());  it != gRGBOnlyInputXpts.end();  ++it)
+		if (NTV2_IS_VALID_InputCrosspointID(*it))
+			gInputXptFlags[*it] |= kXptFlagRGBOnly;
+	for (NTV2InputXptIDSetConstIter it(gYUVOnlyInputXpts.begin());  it != gYUVOnlyInputXpts.end();  ++it)
+		if (NTV2_IS_VALID_InputCrosspointID(*it))
+			gInputXptFlags[*it] |= kXptFlagYUVOnly;
+	for (NTV2InputXptIDSetConstIter it(gKeyInputXpts.begin());  it != gKeyInputXpts.end();  ++it)
+		if (NTV2_IS_VALID_InputCrosspointID(*it))
+			gInputXptFlags[*it] |= kXptFlagKey;
+}
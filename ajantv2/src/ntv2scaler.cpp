@@ -0,0 +1,482 @@
+/* SPDX-License-Identifier: MIT */
+/**
+	@file		ntv2scaler.cpp
+	@brief		Implements the NTV2Scaler class.
+	@copyright	(C) 2026 AJA Video Systems, Inc.
+**/
+
+#include "ntv2scaler.h"
+#include "ntv2parallel.h"
+#include "ajabase/system/systemtime.h"
+#include <math.h>
+#if defined(__SSE2__)
+	#include <emmintrin.h>
+	#define	NTV2_SCALER_SSE2	1
+#endif	//	__SSE2__
+
+using namespace std;
+
+#define	SCALER_COEFF_BITS	14		///< @brief	Filter coefficient fraction bits
+#define	SCALER_MAX_PLANES	4
+
+static inline ULWord RoundUp (const ULWord inValue, const ULWord inMultiple)
+{
+	return (inValue + inMultiple - 1) / inMultiple * inMultiple;
+}
+
+
+//////////////////////////////////////////////////////////////////////////////////////////////////////
+//	Pixel formats
+//
+//	Each row is read into (and written from) separate component planes of Word samples, one row at a
+//	time:  Y, Cb, Cr for 4:2:2 formats (chroma planes are half width), or the four byte lanes of 8-bit
+//	RGBA/ARGB/ABGR.
+//////////////////////////////////////////////////////////////////////////////////////////////////////
+
+typedef void (*RowUnpackFunc) (const UByte * pInRow, const ULWord inNumPixels, Word * const * pOutPlanes);
+typedef void (*RowPackFunc) (const Word * const * pInPlanes, const ULWord inNumPixels, UByte * pOutRow);
+
+//	8-bit 4:2:2:  '2vuy' is Cb Y0 Cr Y1,  YUY2 is Y0 Cb Y1 Cr
+template <int Y0, int CB, int Y1, int CR> static void Unpack8Bit422 (const UByte * pIn, const ULWord inNumPixels, Word * const * pOut)
+{
+	Word	*pY (pOut[0]),  *pCb (pOut[1]),  *pCr (pOut[2]);
+	for (ULWord pair(0);  pair < inNumPixels / 2;  pair++, pIn += 4)
+	{
+		pY[2 * pair] = pIn[Y0];  pY[2 * pair + 1] = pIn[Y1];  pCb[pair] = pIn[CB];  pCr[pair] = pIn[CR];
+	}
+}
+
+template <int Y0, int CB, int Y1, int CR> static void Pack8Bit422 (const Word * const * pIn, const ULWord inNumPixels, UByte * pOut)
+{
+	const Word	*pY (pIn[0]),  *pCb (pIn[1]),  *pCr (pIn[2]);
+	for (ULWord pair(0);  pair < inNumPixels / 2;  pair++, pOut += 4)
+	{
+		pOut[Y0] = UByte(pY[2 * pair]);  pOut[Y1] = UByte(pY[2 * pair + 1]);  pOut[CB] = UByte(pCb[pair]);  pOut[CR] = UByte(pCr[pair]);
+	}
+}
+
+//	'v210':  6 pixels per 4 little-endian words
+static void UnpackV210 (const UByte * pIn, const ULWord inNumPixels, Word * const * pOut)
+{
+	const ULWord *	pWords (reinterpret_cast<const ULWord*>(pIn));
+	Word			*pY (pOut[0]),  *pCb (pOut[1]),  *pCr (pOut[2]);
+	for (ULWord group(0);  group < inNumPixels / 6;  group++, pWords += 4, pY += 6, pCb += 3, pCr += 3)
+	{
+		const ULWord	w0 (pWords[0]),  w1 (pWords[1]),  w2 (pWords[2]),  w3 (pWords[3]);
+		pCb[0] = Word(w0 & 0x3FF);			pY[0] = Word((w0 >> 10) & 0x3FF);	pCr[0] = Word((w0 >> 20) & 0x3FF);
+		pY[1] = Word(w1 & 0x3FF);			pCb[1] = Word((w1 >> 10) & 0x3FF);	pY[2] = Word((w1 >> 20) & 0x3FF);
+		pCr[1] = Word(w2 & 0x3FF);			pY[3] = Word((w2 >> 10) & 0x3FF);	pCb[2] = Word((w2 >> 20) & 0x3FF);
+		pY[4] = Word(w3 & 0x3FF);			pCr[2] = Word((w3 >> 10) & 0x3FF);	pY[5] = Word((w3 >> 20) & 0x3FF);
+	}
+}
+
+static void PackV210 (const Word * const * pIn, const ULWord inNumPixels, UByte * pOut)
+{
+	ULWord *		pWords (reinterpret_cast<ULWord*>(pOut));
+	const Word		*pY (pIn[0]),  *pCb (pIn[1]),  *pCr (pIn[2]);
+	for (ULWord group(0);  group < inNumPixels / 6;  group++, pWords += 4, pY += 6, pCb += 3, pCr += 3)
+	{
+		pWords[0] = ULWord(pCb[0]) | (ULWord(pY[0]) << 10) | (ULWord(pCr[0]) << 20);
+		pWords[1] = ULWord(pY[1]) | (ULWord(pCb[1]) << 10) | (ULWord(pY[2]) << 20);
+		pWords[2] = ULWord(pCr[1]) | (ULWord(pY[3]) << 10) | (ULWord(pCb[2]) << 20);
+		pWords[3] = ULWord(pY[4]) | (ULWord(pCr[2]) << 10) | (ULWord(pY[5]) << 20);
+	}
+}
+
+//	8-bit 4:4:4:4 (any component order)
+static void Unpack8Bit4444 (const UByte * pIn, const ULWord inNumPixels, Word * const * pOut)
+{
+	for (ULWord px(0);  px < inNumPixels;  px++, pIn += 4)
+		for (unsigned lane(0);  lane < 4;  lane++)
+			pOut[lane][px] = pIn[lane];
+}
+
+static void Pack8Bit4444 (const Word * const * pIn, const ULWord inNumPixels, UByte * pOut)
+{
+	for (ULWord px(0);  px < inNumPixels;  px++, pOut += 4)
+		for (unsigned lane(0);  lane < 4;  lane++)
+			pOut[lane] = UByte(pIn[lane][px]);
+}
+
+typedef struct ScalerFormat
+{
+	NTV2PixelFormat	fFormat;
+	UWord			fNumPlanes;		///< @brief	Number of component planes
+	bool			fIs422;			///< @brief	Planes 1 & 2 are half width?
+	UWord			fBitDepth;		///< @brief	Bits per component
+	ULWord			fGroupPixels;	///< @brief	Pixels per packing group
+	ULWord			fGroupBytes;	///< @brief	Bytes per packing group
+	RowUnpackFunc	fUnpack;
+	RowPackFunc		fPack;
+} ScalerFormat;
+
+static const ScalerFormat sScalerFormats[] =
+{
+	{NTV2_FBF_8BIT_YCBCR,		3,	true,	8,	2,	4,	Unpack8Bit422<1,0,3,2>,	Pack8Bit422<1,0,3,2>},
+	{NTV2_FBF_8BIT_YCBCR_YUY2,	3,	true,	8,	2,	4,	Unpack8Bit422<0,1,2,3>,	Pack8Bit422<0,1,2,3>},
+	{NTV2_FBF_10BIT_YCBCR,		3,	true,	10,	6,	16,	UnpackV210,				PackV210},
+	{NTV2_FBF_RGBA,				4,	false,	8,	1,	4,	Unpack8Bit4444,			Pack8Bit4444},
+	{NTV2_FBF_ARGB,				4,	false,	8,	1,	4,	Unpack8Bit4444,			Pack8Bit4444},
+	{NTV2_FBF_ABGR,				4,	false,	8,	1,	4,	Unpack8Bit4444,			Pack8Bit4444}
+};
+
+static const ScalerFormat * GetScalerFormat (const NTV2PixelFormat inPixelFormat)
+{
+	for (size_t ndx(0);  ndx < sizeof(sScalerFormats) / sizeof(sScalerFormats[0]);  ndx++)
+		if (sScalerFormats[ndx].fFormat == inPixelFormat)
+			return &sScalerFormats[ndx];
+	return AJA_NULL;
+}
+
+static inline ULWord PlaneWidth (const ScalerFormat & inFormat, const UWord inPlane, const ULWord inWidth)
+{
+	return inFormat.fIs422  &&  inPlane  ?  inWidth / 2  :  inWidth;
+}
+
+//	Horizontal results keep this many extra fraction bits, so the vertical pass works at 14-bit precision
+static inline int ExtraBits (const ScalerFormat & inFormat)		{return 14 - inFormat.fBitDepth;}
+
+
+//////////////////////////////////////////////////////////////////////////////////////////////////////
+//	Filter tables
+//////////////////////////////////////////////////////////////////////////////////////////////////////
+
+//	Catmull-Rom cubic
+static double CubicKernel (const double inX)
+{
+	const double	x (inX < 0.0 ? -inX : inX);
+	if (x < 1.0)
+		return (1.5 * x - 2.5) * x * x + 1.0;
+	if (x < 2.0)
+		return ((-0.5 * x + 2.5) * x - 4.0) * x + 2.0;
+	return 0.0;
+}
+
+/**
+	@brief	Computes one axis of a polyphase filter.
+	@param[out]	outFilter		Receives the filter.
+	@param[in]	inDstN			Number of destination samples.
+	@param[in]	inRatio			Source-to-destination ratio of the full-resolution axis.
+	@param[in]	inCoSited		True for 4:2:2 chroma, whose samples are co-sited with even luma samples.
+	@param[in]	inTapMultiple	Number of taps is rounded up to a multiple of this (padded with zero coefficients).
+**/
+static void BuildFilter (NTV2Scaler::Filter & outFilter, const ULWord inDstN, const double inRatio,
+						const bool inCoSited, const ULWord inTapMultiple)
+{
+	const double	scale	(inRatio > 1.0 ? inRatio : 1.0);	//	Stretch kernel when reducing
+	const double	support	(2.0 * scale);
+	const ULWord	taps	(RoundUp(ULWord(ceil(2.0 * support)), inTapMultiple));
+	vector<double>	weights (taps);
+	outFilter.fNumTaps = taps;
+	outFilter.fFirst.resize(inDstN);
+	outFilter.fCoeffs.assign(size_t(inDstN) * taps, 0);
+	for (ULWord ndx(0);  ndx < inDstN;  ndx++)
+	{
+		const double	center	(inCoSited  ?  ((2.0 * ndx + 0.5) * inRatio - 0.5) / 2.0  :  (ndx + 0.5) * inRatio - 0.5);
+		const LWord		first	(LWord(floor(center - support)) + 1);
+		double			sum		(0.0);
+		for (ULWord tap(0);  tap < taps;  tap++)
+			sum += weights[tap] = CubicKernel((double(first + LWord(tap)) - center) / scale);
+
+		//	Quantize, then put any rounding residue into the largest coefficient so they sum to exactly 1.0
+		Word *	pCoeffs	(&outFilter.fCoeffs[size_t(ndx) * taps]);
+		LWord	total(0);
+		ULWord	biggest(0);
+		for (ULWord tap(0);  tap < taps;  tap++)
+		{
+			pCoeffs[tap] = Word(floor(weights[tap] / sum * double(1 << SCALER_COEFF_BITS) + 0.5));
+			total += pCoeffs[tap];
+			if (pCoeffs[tap] > pCoeffs[biggest])
+				biggest = tap;
+		}
+		pCoeffs[biggest] = Word(pCoeffs[biggest] + (1 << SCALER_COEFF_BITS) - total);
+		outFilter.fFirst[ndx] = first;
+	}
+}
+
+
+//////////////////////////////////////////////////////////////////////////////////////////////////////
+//	Filter loops
+//////////////////////////////////////////////////////////////////////////////////////////////////////
+
+//	Horizontal:  "pInSrc" points to source sample zero of an edge-padded row
+static void HorzFilter (const Word * pInSrc, const NTV2Scaler::Filter & inFilter, const ULWord inNumOut, const int inShift,
+						Word * pOutDst, const bool inUseSIMD)
+{
+	const ULWord	taps	(inFilter.fNumTaps);
+	const LWord		round	(LWord(1) << (inShift - 1));
+	const Word *	pCoeffs	(&inFilter.fCoeffs[0]);
+#if defined(NTV2_SCALER_SSE2)
+	if (inUseSIMD  &&  (taps % 8) == 0)
+	{
+		for (ULWord ndx(0);  ndx < inNumOut;  ndx++, pCoeffs += taps)
+		{
+			const Word *	pSrc (pInSrc + inFilter.fFirst[ndx]);
+			__m128i			acc	(_mm_setzero_si128());
+			for (ULWord tap(0);  tap < taps;  tap += 8)
+				acc = _mm_add_epi32 (acc, _mm_madd_epi16(_mm_loadu_si128(reinterpret_cast<const __m128i*>(pSrc + tap)),
+														 _mm_loadu_si128(reinterpret_cast<const __m128i*>(pCoeffs + tap))));
+			acc = _mm_add_epi32 (acc, _mm_shuffle_epi32(acc, _MM_SHUFFLE(1,0,3,2)));
+			acc = _mm_add_epi32 (acc, _mm_shuffle_epi32(acc, _MM_SHUFFLE(2,3,0,1)));
+			pOutDst[ndx] = Word((_mm_cvtsi128_si32(acc) + round) >> inShift);
+		}
+		return;
+	}
+#else
+	(void) inUseSIMD;
+#endif	//	NTV2_SCALER_SSE2
+	for (ULWord ndx(0);  ndx < inNumOut;  ndx++, pCoeffs += taps)
+	{
+		const Word *	pSrc (pInSrc + inFilter.fFirst[ndx]);
+		LWord			sum(0);
+		for (ULWord tap(0);  tap < taps;  tap++)
+			sum += LWord(pSrc[tap]) * LWord(pCoeffs[tap]);
+		pOutDst[ndx] = Word((sum + round) >> inShift);
+	}
+}
+
+//	Vertical:  combines "inNumTaps" horizontally-filtered rows into one output row, clamping to [0, inMax]
+static void VertFilter (const Word * const * pInRows, const Word * pInCoeffs, const ULWord inNumTaps, const ULWord inNumOut,
+						const int inShift, const Word inMax, Word * pOutDst, const bool inUseSIMD)
+{
+	const LWord	round (LWord(1) << (inShift - 1));
+	ULWord		ndx(0);
+#if defined(NTV2_SCALER_SSE2)
+	if (inUseSIMD)
+	{
+		const __m128i	vRound	(_mm_set1_epi32(round));
+		const __m128i	vMax	(_mm_set1_epi16(inMax));
+		const __m128i	vZero	(_mm_setzero_si128());
+		for (;  ndx + 8 <= inNumOut;  ndx += 8)
+		{
+			__m128i	accLo (vRound),  accHi (vRound);
+			for (ULWord tap(0);  tap < inNumTaps;  tap += 2)
+			{	//	Interleave two rows, and multiply-add each pair by its two coefficients
+				const bool		pair	(tap + 1 < inNumTaps);
+				const __m128i	a		(_mm_loadu_si128(reinterpret_cast<const __m128i*>(pInRows[tap] + ndx)));
+				const __m128i	b		(pair ? _mm_loadu_si128(reinterpret_cast<const __m128i*>(pInRows[tap+1] + ndx)) : vZero);
+				const __m128i	coeffs	(_mm_set1_epi32(LWord(ULWord(UWord(pInCoeffs[tap])) | (pair ? ULWord(UWord(pInCoeffs[tap+1])) << 16 : 0))));
+				accLo = _mm_add_epi32 (accLo, _mm_madd_epi16(_mm_unpacklo_epi16(a, b), coeffs));
+				accHi = _mm_add_epi32 (accHi, _mm_madd_epi16(_mm_unpackhi_epi16(a, b), coeffs));
+			}
+			const __m128i	result (_mm_packs_epi32(_mm_srai_epi32(accLo, inShift), _mm_srai_epi32(accHi, inShift)));
+			_mm_storeu_si128 (reinterpret_cast<__m128i*>(pOutDst + ndx), _mm_min_epi16(_mm_max_epi16(result, vZero), vMax));
+		}
+	}
+#else
+	(void) inUseSIMD;
+#endif	//	NTV2_SCALER_SSE2
+	for (;  ndx < inNumOut;  ndx++)
+	{
+		LWord	sum (round);
+		for (ULWord tap(0);  tap < inNumTaps;  tap++)
+			sum += LWord(pInRows[tap][ndx]) * LWord(pInCoeffs[tap]);
+		sum >>= inShift;
+		pOutDst[ndx] = Word(sum < 0 ? 0 : (sum > inMax ? inMax : sum));
+	}
+}
+
+
+//////////////////////////////////////////////////////////////////////////////////////////////////////
+//	Scale job
+//////////////////////////////////////////////////////////////////////////////////////////////////////
+
+typedef struct ScaleJob
+{
+	const ScalerFormat *			fFormat;
+	const NTV2Scaler::Filter *		fHorz;			///< @brief	[0] full-width planes, [1] 4:2:2 chroma planes
+	const NTV2Scaler::Filter *		fVert;
+	const NTV2FormatDescriptor *	fSrcDesc;
+	const NTV2FormatDescriptor *	fDstDesc;
+	const UByte *					fSrcBase;
+	UByte *							fDstBase;
+	ULWord							fSrcWidth;
+	ULWord							fSrcHeight;
+	ULWord							fDstWidth;
+	ULWord							fPad;			///< @brief	Edge padding on each side of each source plane
+	ULWord							fSrcStride;		///< @brief	Words per padded source plane
+	ULWord							fDstStride;		///< @brief	Words per destination plane row
+	size_t							fWorkerWords;	///< @brief	Scratch words per worker
+	Word *							fScratch;
+	LWord *							fCachedRows;	///< @brief	fVert->fNumTaps per worker
+	bool							fUseSIMD;
+} ScaleJob;
+
+static size_t ScratchWordsPerWorker (const ULWord inNumPlanes, const ULWord inSrcStride, const ULWord inDstStride, const ULWord inVertTaps)
+{	//	Padded source planes, cached horizontally-filtered rows, output planes
+	return size_t(inNumPlanes) * (inSrcStride + size_t(inVertTaps) * inDstStride + inDstStride);
+}
+
+//	Reads source row "inRow" and filters it horizontally into cache slot "pOutSlot" (fNumPlanes rows of fDstStride words)
+static void LoadSourceRow (const ScaleJob & inJob, Word * pInSrcPlanes, const ULWord inRow, Word * pOutSlot)
+{
+	const ScalerFormat &	fmt		(*inJob.fFormat);
+	const UByte *			pSrcRow	(reinterpret_cast<const UByte*>(inJob.fSrcDesc->GetRowAddress(inJob.fSrcBase, inRow + inJob.fSrcDesc->GetFirstActiveLine())));
+	Word *					planes[SCALER_MAX_PLANES];
+	for (UWord plane(0);  plane < fmt.fNumPlanes;  plane++)
+		planes[plane] = pInSrcPlanes + size_t(plane) * inJob.fSrcStride + inJob.fPad;
+	fmt.fUnpack (pSrcRow, RoundUp(inJob.fSrcWidth, fmt.fGroupPixels), planes);
+
+	for (UWord plane(0);  plane < fmt.fNumPlanes;  plane++)
+	{
+		const ULWord	width	(PlaneWidth(fmt, plane, inJob.fSrcWidth));
+		Word *			pPlane	(planes[plane]);
+		for (ULWord ndx(1);  ndx <= inJob.fPad;  ndx++)
+		{	//	Replicate edges
+			pPlane[-LWord(ndx)] = pPlane[0];
+			pPlane[width - 1 + ndx] = pPlane[width - 1];
+		}
+		const NTV2Scaler::Filter &	filter (inJob.fHorz[fmt.fIs422 && plane ? 1 : 0]);
+		HorzFilter (pPlane, filter, PlaneWidth(fmt, plane, inJob.fDstWidth), SCALER_COEFF_BITS - ExtraBits(fmt),
+					pOutSlot + size_t(plane) * inJob.fDstStride, inJob.fUseSIMD);
+	}
+}
+
+static void ScaleRowRange (void * pInContext, const ULWord inWorkerIndex, const ULWord inFirstRow, const ULWord inNumRows)
+{
+	const ScaleJob &			job			(*reinterpret_cast<const ScaleJob*>(pInContext));
+	const ScalerFormat &		fmt			(*job.fFormat);
+	const NTV2Scaler::Filter &	vert		(*job.fVert);
+	const ULWord				vTaps		(vert.fNumTaps);
+	const ULWord				numPlanes	(fmt.fNumPlanes);
+	Word *						pSrcPlanes	(job.fScratch + inWorkerIndex * job.fWorkerWords);
+	Word *						pCache		(pSrcPlanes + size_t(numPlanes) * job.fSrcStride);
+	Word *						pOutPlanes	(pCache + size_t(vTaps) * numPlanes * job.fDstStride);
+	LWord *						pCachedRows	(job.fCachedRows + size_t(inWorkerIndex) * vTaps);
+	const Word					maxValue	(Word((1 << fmt.fBitDepth) - 1));
+	const ULWord				packPixels	(RoundUp(job.fDstWidth, fmt.fGroupPixels));
+	vector<const Word*>			rows		(size_t(numPlanes) * vTaps);
+
+	for (ULWord slot(0);  slot < vTaps;  slot++)
+		pCachedRows[slot] = -1;
+	for (ULWord row(inFirstRow);  row < inFirstRow + inNumRows;  row++)
+	{
+		//	Make sure every source row this output row needs has been filtered horizontally...
+		for (ULWord tap(0);  tap < vTaps;  tap++)
+		{
+			LWord	srcRow (vert.fFirst[row] + LWord(tap));
+			srcRow = srcRow < 0 ? 0 : (srcRow >= LWord(job.fSrcHeight) ? LWord(job.fSrcHeight) - 1 : srcRow);
+			const ULWord	slot	(ULWord(srcRow) % vTaps);
+			Word *			pSlot	(pCache + size_t(slot) * numPlanes * job.fDstStride);
+			if (pCachedRows[slot] != srcRow)
+			{
+				LoadSourceRow (job, pSrcPlanes, ULWord(srcRow), pSlot);
+				pCachedRows[slot] = srcRow;
+			}
+			for (ULWord plane(0);  plane < numPlanes;  plane++)
+				rows[plane * vTaps + tap] = pSlot + size_t(plane) * job.fDstStride;
+		}
+
+		//	Filter vertically, then pack...
+		Word *	outPlanes[SCALER_MAX_PLANES];
+		for (UWord plane(0);  plane < numPlanes;  plane++)
+		{
+			const ULWord	width		(PlaneWidth(fmt, plane, job.fDstWidth));
+			const ULWord	packWidth	(PlaneWidth(fmt, plane, packPixels));
+			outPlanes[plane] = pOutPlanes + size_t(plane) * job.fDstStride;
+			VertFilter (&rows[plane * vTaps], &vert.fCoeffs[size_t(row) * vTaps], vTaps, width,
+						SCALER_COEFF_BITS + ExtraBits(fmt), maxValue, outPlanes[plane], job.fUseSIMD);
+			for (ULWord ndx(width);  ndx < packWidth;  ndx++)
+				outPlanes[plane][ndx] = outPlanes[plane][width - 1];	//	Fill out the last packing group
+		}
+		fmt.fPack (outPlanes, packPixels,
+					reinterpret_cast<UByte*>(job.fDstDesc->GetWriteableRowAddress(job.fDstBase, row + job.fDstDesc->GetFirstActiveLine())));
+	}
+}
+
+
+//////////////////////////////////////////////////////////////////////////////////////////////////////
+//	NTV2Scaler
+//////////////////////////////////////////////////////////////////////////////////////////////////////
+
+bool NTV2Scaler::IsSupportedPixelFormat (const NTV2PixelFormat inPixelFormat)
+{
+	return GetScalerFormat(inPixelFormat) != AJA_NULL;
+}
+
+
+NTV2Scaler::NTV2Scaler ()
+	:	mMaxThreads		(0),
+		mUseSIMD		(true),
+		mPixelFormat	(NTV2_FBF_INVALID),
+		mSrcWidth		(0),
+		mSrcHeight		(0),
+		mDstWidth		(0),
+		mDstHeight		(0)
+{
+}
+
+
+bool NTV2Scaler::PrepareTables (const NTV2FormatDescriptor & inSrcDesc, const NTV2FormatDescriptor & inDstDesc)
+{
+	const ULWord	srcWidth (inSrcDesc.GetRasterWidth()),  srcHeight (inSrcDesc.GetVisibleRasterHeight());
+	const ULWord	dstWidth (inDstDesc.GetRasterWidth()),  dstHeight (inDstDesc.GetVisibleRasterHeight());
+	if (mPixelFormat == inSrcDesc.GetPixelFormat()  &&  mSrcWidth == srcWidth  &&  mSrcHeight == srcHeight
+		&&  mDstWidth == dstWidth  &&  mDstHeight == dstHeight)
+			return false;	//	Tables still valid
+
+	const double	hRatio (double(srcWidth) / double(dstWidth));
+	BuildFilter (mHorz[0], dstWidth, hRatio, false, 8);
+	BuildFilter (mHorz[1], dstWidth / 2, hRatio, true, 8);
+	BuildFilter (mVert, dstHeight, double(srcHeight) / double(dstHeight), false, 1);
+	mPixelFormat = inSrcDesc.GetPixelFormat();
+	mSrcWidth = srcWidth;  mSrcHeight = srcHeight;  mDstWidth = dstWidth;  mDstHeight = dstHeight;
+	return true;
+}
+
+
+bool NTV2Scaler::ScaleFrame (const NTV2Buffer & inSrcBuffer, const NTV2FormatDescriptor & inSrcDesc,
+							NTV2Buffer & inDstBuffer, const NTV2FormatDescriptor & inDstDesc)
+{
+	const uint64_t	startMicrosecs (AJATime::GetSystemMicroseconds());
+	const ScalerFormat *	pFormat (GetScalerFormat(inSrcDesc.GetPixelFormat()));
+	if (!pFormat  ||  inDstDesc.GetPixelFormat() != inSrcDesc.GetPixelFormat())
+		return false;	//	Unsupported, or pixel format mismatch
+	if (!inSrcDesc.GetRasterWidth()  ||  !inSrcDesc.GetVisibleRasterHeight()  ||  !inSrcDesc.GetBytesPerRow())
+		return false;
+	if (!inDstDesc.GetRasterWidth()  ||  !inDstDesc.GetVisibleRasterHeight()  ||  !inDstDesc.GetBytesPerRow())
+		return false;
+	if (pFormat->fIs422  &&  ((inSrcDesc.GetRasterWidth() & 1)  ||  (inDstDesc.GetRasterWidth() & 1)))
+		return false;	//	4:2:2 needs even widths
+	if (RoundUp(inSrcDesc.GetRasterWidth(), pFormat->fGroupPixels) / pFormat->fGroupPixels * pFormat->fGroupBytes > inSrcDesc.GetBytesPerRow()
+		||  RoundUp(inDstDesc.GetRasterWidth(), pFormat->fGroupPixels) / pFormat->fGroupPixels * pFormat->fGroupBytes > inDstDesc.GetBytesPerRow())
+			return false;	//	Rows must hold whole packing groups
+	if (inSrcBuffer.IsNULL()  ||  inDstBuffer.IsNULL())
+		return false;
+	if (inSrcBuffer.GetByteCount() < inSrcDesc.GetTotalBytes()  ||  inDstBuffer.GetByteCount() < inDstDesc.GetTotalBytes())
+		return false;	//	Buffers too small
+
+	const bool		rebuilt		(PrepareTables(inSrcDesc, inDstDesc));
+	const ULWord	maxWorkers	(mMaxThreads  &&  mMaxThreads < NTV2ParallelRowsMaxWorkers() ? mMaxThreads : NTV2ParallelRowsMaxWorkers());
+	const ULWord	hTaps		(mHorz[0].fNumTaps > mHorz[1].fNumTaps ? mHorz[0].fNumTaps : mHorz[1].fNumTaps);
+
+	ScaleJob	job;
+	job.fFormat		= pFormat;
+	job.fHorz		= mHorz;
+	job.fVert		= &mVert;
+	job.fSrcDesc	= &inSrcDesc;
+	job.fDstDesc	= &inDstDesc;
+	job.fSrcBase	= reinterpret_cast<const UByte*>(inSrcBuffer.GetHostPointer());
+	job.fDstBase	= reinterpret_cast<UByte*>(inDstBuffer.GetHostPointer());
+	job.fSrcWidth	= mSrcWidth;
+	job.fSrcHeight	= mSrcHeight;
+	job.fDstWidth	= mDstWidth;
+	job.fPad		= hTaps + 8;
+	job.fSrcStride	= RoundUp(mSrcWidth, 24) + 2 * job.fPad;
+	job.fDstStride	= RoundUp(mDstWidth, 24) + 8;
+	job.fUseSIMD	= mUseSIMD;
+	job.fWorkerWords = ScratchWordsPerWorker(pFormat->fNumPlanes, job.fSrcStride, job.fDstStride, mVert.fNumTaps);
+	if (mScratch.size() < job.fWorkerWords * maxWorkers)
+		mScratch.resize(job.fWorkerWords * maxWorkers);
+	if (mCachedRows.size() < size_t(mVert.fNumTaps) * maxWorkers)
+		mCachedRows.resize(size_t(mVert.fNumTaps) * maxWorkers);
+	job.fScratch	= &mScratch[0];
+	job.fCachedRows	= &mCachedRows[0];
+
+	mStats.fNumWorkers		= NTV2ParallelRows (mDstHeight, ScaleRowRange, &job, maxWorkers);
+	mStats.fHorzTaps		= hTaps;
+	mStats.fVertTaps		= mVert.fNumTaps;
+	mStats.fTablesRebuilt	= rebuilt;
+	mStats.fMicroseconds	= AJATime::GetSystemMicroseconds() - startMicrosecs;
+	return true;
+}
@@ -427,25 +427,8 @@ bool CNTV2SignalRouter::GetWidgetInputs (const NTV2WidgetID inWidgetID, NTV2Inpu
 bool CNTV2SignalRouter::GetAllWidgetInputs (const NTV2DeviceID inDeviceID, NTV2InputXptIDSet & outInputs)		//	STATIC
 {
 	outInputs.clear();
-	NTV2WidgetIDSet widgetIDs;
-	if (!GetWidgetIDs (inDeviceID, widgetIDs))
-		return false;	//	Fail
-
-	for (NTV2WidgetIDSetConstIter iter(widgetIDs.begin());	iter != widgetIDs.end ();  ++iter)
-	{
-		NTV2InputXptIDSet inputs;
-		CNTV2SignalRouter::GetWidgetInputs (*iter, inputs);
-		for (NTV2InputXptIDSetConstIter it(inputs.begin());  it != inputs.end();  ++it)
-		{
-			if (WidgetIDToType(*iter) == NTV2WidgetType_FrameStore)
-				if (!::NTV2DeviceCanDo425Mux(inDeviceID))
-					if (!::NTV2DeviceCanDo8KVideo(inDeviceID))
-						if (::NTV2InputCrosspointIDToString(*it, false).find("DS2") != string::npos)	//	is DS2 input?
-							continue;	//	do not include FrameStore DS2 inputs for IP25G
-			outInputs.insert(*it);
-		}
-	}
-	return true;
+	RoutingExpertPtr	pExpert(RoutingExpert::GetInstance());
+	return pExpert ? pExpert->GetDeviceInputXpts(inDeviceID, outInputs) : false;	//	Cached per device
 }
 
 
@@ -476,25 +459,8 @@ bool CNTV2SignalRouter::GetWidgetOutputs (const NTV2WidgetID inWidgetID, NTV2Out
 bool CNTV2SignalRouter::GetAllWidgetOutputs (const NTV2DeviceID inDeviceID, NTV2OutputXptIDSet & outOutputs)	//	STATIC
 {
 	outOutputs.clear();
-	NTV2WidgetIDSet widgetIDs;
-	if (!GetWidgetIDs (inDeviceID, widgetIDs))
-		return false;	//	Fail
-
-	for (NTV2WidgetIDSetConstIter iter(widgetIDs.begin());	iter != widgetIDs.end ();  ++iter)
-	{
-		NTV2OutputXptIDSet outputs;
-		CNTV2SignalRouter::GetWidgetOutputs (*iter, outputs);
-		for (NTV2OutputXptIDSetConstIter it(outputs.begin());  it != outputs.end();  ++it)
-		{
-			if (WidgetIDToType(*iter) == NTV2WidgetType_FrameStore)
-				if (!::NTV2DeviceCanDo425Mux(inDeviceID))
-					if (!::NTV2DeviceCanDo8KVideo(inDeviceID))
-						if (::NTV2OutputCrosspointIDToString(*it, false).find("DS2") != string::npos)	//	is DS2 output?
-							continue;	//	do not include FrameStore DS2 outputs for IP25G
-			outOutputs.insert(*it);
-		}
-	}
-	return true;
+	RoutingExpertPtr	pExpert(RoutingExpert::GetInstance());
+	return pExpert ? pExpert->GetDeviceOutputXpts(inDeviceID, outOutputs) : false;	//	Cached per device
 }
 
 bool CNTV2SignalRouter::IsRGBOnlyInputXpt (const NTV2InputXptID inInputXpt)
@@ -674,6 +640,71 @@ bool CNTV2SignalRouter::CompareConnections (const NTV2XptConnections & inLHS,
 }
 
 
+bool CNTV2SignalRouter::GetChangedRegisterWrites (const NTV2XptConnections & inCurrent,
+												const NTV2XptConnections & inTarget,
+												NTV2RegisterWrites & outRegWrites,
+												const bool inReplace)	//	STATIC
+{
+	outRegWrites.clear();
+
+	//	Both maps are sorted by input xpt, so walk them in step...
+	NTV2XptConnections			changes;
+	NTV2XptConnectionsConstIter	cur(inCurrent.begin()), tgt(inTarget.begin());
+	while (cur != inCurrent.end()  ||  tgt != inTarget.end())
+	{
+		if (tgt == inTarget.end()  ||  (cur != inCurrent.end()  &&  cur->first < tgt->first))
+		{	//	Connected now, but not in target
+			if (inReplace  &&  cur->second != NTV2_XptBlack)
+				changes.insert(NTV2XptConnection(cur->first, NTV2_XptBlack));
+			++cur;
+		}
+		else if (cur == inCurrent.end()  ||  tgt->first < cur->first)
+		{	//	In target, but not connected now
+			if (tgt->second != NTV2_XptBlack)
+				changes.insert(*tgt);
+			++tgt;
+		}
+		else
+		{	//	In both
+			if (cur->second != tgt->second)
+				changes.insert(*tgt);
+			++cur;	++tgt;
+		}
+	}
+
+	//	Coalesce the changes into one masked write per crosspoint select register...
+	for (NTV2XptConnectionsConstIter it(changes.begin());  it != changes.end();  ++it)
+	{
+		uint32_t regNum(0), ndx(999);
+		if (!CNTV2RegisterExpert::GetCrosspointSelectGroupRegisterInfo (it->first, regNum, ndx)	||	!regNum	 ||	 ndx > 3)
+			{outRegWrites.clear();  return false;}
+		const ULWord value (ULWord(it->second) << sSignalRouterRegShifts[ndx]);
+		NTV2RegisterWrites::iterator pWrite(outRegWrites.begin());
+		while (pWrite != outRegWrites.end()  &&  pWrite->registerNumber != regNum)
+			++pWrite;
+		if (pWrite == outRegWrites.end())
+			outRegWrites.push_back(NTV2RegInfo(regNum, value, sSignalRouterRegMasks[ndx], 0));
+		else
+		{
+			pWrite->registerValue |= value;
+			pWrite->registerMask |= sSignalRouterRegMasks[ndx];
+		}
+	}
+	SRDBG(DEC(changes.size()) << " change(s) in " << DEC(outRegWrites.size()) << " register(s): " << changes);
+	return true;
+}
+
+
+bool CNTV2SignalRouter::FindRoute (const NTV2DeviceID inDeviceID, const NTV2OutputXptID inOutputXpt,
+									const NTV2InputXptID inInputXpt, const NTV2PixelFormat inPixelFormat,
+									NTV2XptConnections & outConnections)	//	STATIC
+{
+	outConnections.clear();
+	RoutingExpertPtr	pExpert(RoutingExpert::GetInstance());
+	return pExpert ? pExpert->FindRoute(inDeviceID, inOutputXpt, inInputXpt, inPixelFormat, outConnections) : false;
+}
+
+
 bool CNTV2SignalRouter::CreateFromString (const string & inString, NTV2XptConnections & outConnections) //	STATIC
 {
 	NTV2StringList	lines;
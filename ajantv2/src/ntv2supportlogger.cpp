@@ -10,9 +10,12 @@
 #include "ntv2konaflashprogram.h"
 #include "ntv2registerexpert.h"
 #include "ntv2rp188.h"
+#include "ntv2parallel.h"
 #include "ajabase/common/common.h"
 #include "ajabase/persistence/persistence.h"
+#include "ajabase/system/atomic.h"
 #include "ajabase/system/info.h"
+#include "ajabase/system/systemtime.h"
 #include <algorithm>
 #include <sstream>
 #include <vector>
@@ -295,14 +298,16 @@ AJAExport ostream & operator << (ostream & outStream, const CNTV2SupportLogger &
 CNTV2SupportLogger::CNTV2SupportLogger (CNTV2Card & card, NTV2SupportLoggerSections sections)
 	:	mDevice		(card),
 		mDispose	(false),
-		mSections	(sections)
+		mSections	(sections),
+		mUseSnapshot(false)
 {
 }
 
 CNTV2SupportLogger::CNTV2SupportLogger (UWord cardIndex, NTV2SupportLoggerSections sections)
 	:	mDevice		(*(new CNTV2Card(cardIndex))),
 		mDispose	(true),
-		mSections	(sections)
+		mSections	(sections),
+		mUseSnapshot(false)
 {
 }
 
@@ -408,15 +413,20 @@ string CNTV2SupportLogger::ToString (void) const
 	if (!mHeaderStr.empty())
 		oss << mHeaderStr;
 
-	// Go ahead and show info even if the device is not open
-	LoggerSectionToFunctionMacro(NTV2_SupportLoggerSectionInfo, "Info", FetchInfoLog)
-
-	if (mDevice.IsOpen())
+	if (mUseSnapshot  &&  mDevice.IsOpen()  &&  !mDevice.IsRemote())
+		oss << SnapshotToString();
+	else
 	{
-		LoggerSectionToFunctionMacro(NTV2_SupportLoggerSectionAutoCirculate, "AutoCirculate", FetchAutoCirculateLog)
-		LoggerSectionToFunctionMacro(NTV2_SupportLoggerSectionAudio, "Audio", FetchAudioLog)
-		LoggerSectionToFunctionMacro(NTV2_SupportLoggerSectionRouting, "Routing", FetchRoutingLog)
-		LoggerSectionToFunctionMacro(NTV2_SupportLoggerSectionRegisters, "Regs", FetchRegisterLog)
+		// Go ahead and show info even if the device is not open
+		LoggerSectionToFunctionMacro(NTV2_SupportLoggerSectionInfo, "Info", FetchInfoLog)
+
+		if (mDevice.IsOpen())
+		{
+			LoggerSectionToFunctionMacro(NTV2_SupportLoggerSectionAutoCirculate, "AutoCirculate", FetchAutoCirculateLog)
+			LoggerSectionToFunctionMacro(NTV2_SupportLoggerSectionAudio, "Audio", FetchAudioLog)
+			LoggerSectionToFunctionMacro(NTV2_SupportLoggerSectionRouting, "Routing", FetchRoutingLog)
+			LoggerSectionToFunctionMacro(NTV2_SupportLoggerSectionRegisters, "Regs", FetchRegisterLog)
+		}
 	}
 
 	if (!mFooterStr.empty())
@@ -608,23 +618,36 @@ void CNTV2SupportLogger::FetchInfoLog (ostringstream & oss) const
 }	//	FetchInfoLog
 
 
-void CNTV2SupportLogger::FetchRegisterLog (ostringstream & oss) const
+static NTV2RegisterReads getLogRegisters (CNTV2Card & device)
 {
-	NTV2RegisterReads	regs;
-	const NTV2DeviceID	deviceID	(mDevice.GetDeviceID());
-	const int			options		(mDevice.IsSupported(kDeviceHasXptConnectROM) ? kIncludeOtherRegs_XptROM : kIncludeOtherRegs_None);
-	static const string sDashes		(96, '-');
+	const int	options	(device.IsSupported(kDeviceHasXptConnectROM) ? kIncludeOtherRegs_XptROM : kIncludeOtherRegs_None);
+	return ::FromRegNumSet (CNTV2RegisterExpert::GetRegistersForDevice (device.GetDeviceID(), options | kIncludeOtherRegs_VRegs));
+}
 
-	NTV2RegNumSet deviceRegs (CNTV2RegisterExpert::GetRegistersForDevice (deviceID, options | kIncludeOtherRegs_VRegs));
-	oss << endl << deviceRegs.size() << " Device Registers " << sDashes << endl << endl;
-	regs = ::FromRegNumSet (deviceRegs);
-	if (!mDevice.ReadRegisters (regs))
+static void printRegisterLogHeader (ostringstream & oss, const size_t inNumRegs, const bool inReadOK)
+{
+	static const string sDashes		(96, '-');
+	oss << endl << inNumRegs << " Device Registers " << sDashes << endl << endl;
+	if (!inReadOK)
 		oss << "## NOTE:  Driver failed to return one or more registers (those will be zero)" << endl;
-	for (NTV2RegisterReadsConstIter it (regs.begin());	it != regs.end();  ++it)
+}
+
+static void printRegisterLogRange (ostringstream & oss, const NTV2RegisterReads & inRegs, const size_t inFirst, const size_t inCount, const NTV2DeviceID inDeviceID)
+{
+	for (size_t ndx(inFirst);  ndx < inFirst + inCount  &&  ndx < inRegs.size();  ndx++)
 	{
 		oss << endl;
-		it->PrintLog(oss, deviceID);
+		inRegs[ndx].PrintLog(oss, inDeviceID);
 	}
+}
+
+void CNTV2SupportLogger::FetchRegisterLog (ostringstream & oss) const
+{
+	NTV2RegisterReads	regs		(getLogRegisters(mDevice));
+	const NTV2DeviceID	deviceID	(mDevice.GetDeviceID());
+	const bool			readOK		(mDevice.ReadRegisters (regs));
+	printRegisterLogHeader (oss, regs.size(), readOK);
+	printRegisterLogRange (oss, regs, 0, regs.size(), deviceID);
 }	//	FetchRegisterLog
 
 
@@ -891,6 +914,251 @@ void CNTV2SupportLogger::FetchRoutingLog (ostringstream & oss) const
 **/
 }
 
+
+/**
+	@brief	A CNTV2Card that answers register reads, AutoCirculate status and frame stamp queries, and bitfile info
+			queries from a snapshot taken from another (open, local) device, so the log sections can be rendered
+			without any further driver traffic. Writes, VBI waits and other driver messages all fail (or return
+			immediately). Registers that aren't in the snapshot are read from the real device, and counted.
+	@note	Only the input timecodes are kept from each frame stamp, since that's all the log uses.
+**/
+class SupportLogSnapshotCard : public CNTV2Card
+{
+	public:
+		explicit	SupportLogSnapshotCard (CNTV2Card & inDevice)
+			:	mDevice(inDevice), mRegsOK(false), mHaveBitfileInfo(false), mNumQueries(0), mNumLateReads(0)
+		{
+			::memset(&mBitfileInfo, 0, sizeof(mBitfileInfo));
+		}
+		virtual		~SupportLogSnapshotCard ()	{_boardOpened = false;}	//	Nothing to close
+
+		/**
+			@brief		Reads everything needed to render the given sections from the real device.
+			@param[in]	inSections			Specifies the sections to be rendered.
+			@param[out]	outHoldMicroseconds	Receives the time spent querying the device, in microseconds.
+			@return		True if successful;  otherwise false.
+		**/
+		bool	Take (const NTV2SupportLoggerSections inSections, uint64_t & outHoldMicroseconds)
+		{
+			_boardOpened = false;
+			outHoldMicroseconds = 0;
+			if (!mDevice.IsOpen())
+				return false;
+			_boardID = mDevice.GetDeviceID();
+			_boardNumber = mDevice.GetIndexNumber();
+			mRegs = getLogRegisters(mDevice);
+
+			//	All registers in one bulk read (the registers section needs them all anyway)...
+			const uint64_t startTime (AJATime::GetSystemMicroseconds());
+			mRegsOK = mDevice.ReadRegisters(mRegs);
+			mNumQueries = 1;
+
+			//	AutoCirculate status (the Audio section looks for the channel that's circulating audio)...
+			const NTV2Channel numChannels (NTV2Channel(::NTV2DeviceGetNumVideoChannels(_boardID)));
+			if (inSections & (NTV2_SupportLoggerSectionAutoCirculate | NTV2_SupportLoggerSectionAudio))
+				for (NTV2Channel chan(NTV2_CHANNEL1);  chan < numChannels;  chan = NTV2Channel(chan+1))
+				{
+					AUTOCIRCULATE_STATUS acStatus;
+					mNumQueries++;
+					if (!mDevice.AutoCirculateGetStatus(chan, acStatus))
+						continue;
+					mACStatus.insert(ChannelToACStatusPair(chan, acStatus));
+					if (acStatus.IsStopped()  ||  !(inSections & NTV2_SupportLoggerSectionAutoCirculate))
+						continue;
+					for (uint16_t frameNum(acStatus.GetStartFrame());  frameNum <= acStatus.GetEndFrame();  frameNum++)
+					{
+						FRAME_STAMP			frameStamp;
+						NTV2TimeCodeList	timecodes;
+						mNumQueries++;
+						if (mDevice.AutoCirculateGetFrameStamp(chan, frameNum, frameStamp))
+							if (frameStamp.GetInputTimeCodes(timecodes))
+								mFrameTCs[frameStampKey(chan, frameNum)] = timecodes;
+					}
+				}
+
+			if (inSections & NTV2_SupportLoggerSectionInfo)
+			{
+				mBitfileInfo.whichFPGA = eFPGAVideoProc;
+				mHaveBitfileInfo = mDevice.DriverGetBitFileInformation(mBitfileInfo, NTV2_VideoProcBitFile);
+				mNumQueries++;
+			}
+			outHoldMicroseconds = AJATime::GetSystemMicroseconds() - startTime;
+			_boardOpened = true;
+			return true;
+		}
+
+		inline const NTV2RegisterReads &	Registers (void) const		{return mRegs;}
+		inline bool							RegistersOK (void) const	{return mRegsOK;}
+		inline ULWord						NumQueries (void) const		{return mNumQueries;}
+		inline ULWord						NumLateReads (void) const	{return mNumLateReads;}
+
+		using CNTV2Card::ReadRegister;
+		virtual bool	ReadRegister (const ULWord inRegNum, ULWord & outValue, const ULWord inMask = 0xFFFFFFFF, const ULWord inShift = 0)
+		{
+			NTV2RegisterReadsConstIter it (std::lower_bound(mRegs.begin(), mRegs.end(), NTV2RegInfo(inRegNum), RegNumLess));
+			if (it == mRegs.end()  ||  it->registerNumber != inRegNum)
+			{	//	Not in the snapshot -- ask the device...
+				AJAAtomic::Increment(&mNumLateReads);
+				return mDevice.ReadRegister(inRegNum, outValue, inMask, inShift);
+			}
+			outValue = it->registerValue;
+			if (inRegNum < VIRTUALREG_START  &&  inShift < 32)
+				outValue = (outValue & inMask) >> inShift;
+			return true;
+		}
+		virtual bool	ReadRegisters (NTV2RegisterReads & inOutValues)
+		{
+			bool result (true);
+			for (NTV2RegisterReadsIter it (inOutValues.begin());  it != inOutValues.end();  ++it)
+				if (!ReadRegister(it->registerNumber, it->registerValue))
+					result = false;
+			return result;
+		}
+		virtual bool	WriteRegister (const ULWord, const ULWord, const ULWord = 0xFFFFFFFF, const ULWord = 0)	{return false;}
+		virtual bool	NTV2Message (NTV2_HEADER *)												{return false;}
+		virtual bool	WaitForInputVerticalInterrupt (const NTV2Channel = NTV2_CHANNEL1, UWord = 1)	{return true;}
+		virtual bool	WaitForOutputVerticalInterrupt (const NTV2Channel = NTV2_CHANNEL1, UWord = 1)	{return true;}
+		virtual bool	AutoCirculateGetStatus (const NTV2Channel inChannel, AUTOCIRCULATE_STATUS & outStatus)
+		{
+			ChannelToACStatusConstIter it (mACStatus.find(inChannel));
+			if (it == mACStatus.end())
+				return false;
+			outStatus = it->second;
+			return true;
+		}
+		virtual bool	AutoCirculateGetFrameStamp (const NTV2Channel inChannel, const ULWord inFrameNumber, FRAME_STAMP & outFrameInfo)
+		{
+			map<ULWord,NTV2TimeCodeList>::const_iterator it (mFrameTCs.find(frameStampKey(inChannel, inFrameNumber)));
+			if (it == mFrameTCs.end())
+				return false;
+			for (size_t ndx(0);  ndx < it->second.size();  ndx++)
+				outFrameInfo.SetInputTimecode(NTV2TCIndex(ndx), it->second[ndx]);
+			return true;
+		}
+		virtual bool	DriverGetBitFileInformation (BITFILE_INFO_STRUCT & outBitFileInfo, const NTV2BitFileType inBitFileType = NTV2_VideoProcBitFile)
+		{
+			if (!mHaveBitfileInfo  ||  inBitFileType != NTV2_VideoProcBitFile)
+				return false;
+			outBitFileInfo = mBitfileInfo;
+			return true;
+		}
+
+	private:
+		static inline ULWord	frameStampKey (const NTV2Channel inChannel, const ULWord inFrameNumber)	{return (ULWord(inChannel) << 16) | (inFrameNumber & 0xFFFF);}
+		static inline bool		RegNumLess (const NTV2RegInfo & inLHS, const NTV2RegInfo & inRHS)		{return inLHS.registerNumber < inRHS.registerNumber;}
+
+		CNTV2Card &						mDevice;			///< @brief	The real device
+		NTV2RegisterReads				mRegs;				///< @brief	Register snapshot, sorted by register number
+		bool							mRegsOK;			///< @brief	True if the bulk read succeeded
+		ChannelToACStatus				mACStatus;			///< @brief	Per-channel AutoCirculate status
+		map<ULWord,NTV2TimeCodeList>	mFrameTCs;			///< @brief	Per-channel, per-frame input timecodes
+		BITFILE_INFO_STRUCT				mBitfileInfo;		///< @brief	Video processor bitfile info
+		bool							mHaveBitfileInfo;	///< @brief	True if mBitfileInfo is valid
+		ULWord							mNumQueries;		///< @brief	Device queries made by Take
+		uint32_t volatile				mNumLateReads;		///< @brief	Reads that missed the snapshot
+};	//	SupportLogSnapshotCard
+
+
+//	One unit of snapshot rendering work:  a whole section, or a band of the registers section...
+typedef struct SnapshotJob
+{
+	uint32_t	fSection;	///< @brief	Section to render
+	size_t		fFirstReg;	///< @brief	For the registers section, the first register in the band
+	size_t		fNumRegs;	///< @brief	For the registers section, the number of registers in the band
+	string		fText;		///< @brief	Rendered text
+	SnapshotJob (const uint32_t inSection, const size_t inFirstReg = 0, const size_t inNumRegs = 0)
+		:	fSection(inSection), fFirstReg(inFirstReg), fNumRegs(inNumRegs)	{}
+} SnapshotJob;
+
+typedef struct SnapshotJobs
+{
+	const CNTV2SupportLogger *		fRenderer;	///< @brief	Logger that renders from the snapshot
+	const SupportLogSnapshotCard *	fSnapshot;	///< @brief	The snapshot
+	vector<SnapshotJob>				fJobs;		///< @brief	The work to be done
+} SnapshotJobs;
+
+void CNTV2SupportLogger::RenderSnapshotJobs (void * pInContext, const ULWord inWorkerIndex, const ULWord inFirstJob, const ULWord inNumJobs)	//	STATIC
+{	(void) inWorkerIndex;
+	SnapshotJobs & ctx (*reinterpret_cast<SnapshotJobs*>(pInContext));
+	for (ULWord ndx(inFirstJob);  ndx < inFirstJob + inNumJobs;  ndx++)
+	{
+		SnapshotJob &	job (ctx.fJobs.at(ndx));
+		ostringstream	oss;
+		switch (job.fSection)
+		{
+			case NTV2_SupportLoggerSectionInfo:				ctx.fRenderer->FetchInfoLog(oss);			break;
+			case NTV2_SupportLoggerSectionAutoCirculate:	ctx.fRenderer->FetchAutoCirculateLog(oss);	break;
+			case NTV2_SupportLoggerSectionAudio:			ctx.fRenderer->FetchAudioLog(oss);			break;
+			case NTV2_SupportLoggerSectionRouting:			ctx.fRenderer->FetchRoutingLog(oss);		break;
+			case NTV2_SupportLoggerSectionRegisters:		printRegisterLogRange(oss, ctx.fSnapshot->Registers(), job.fFirstReg, job.fNumRegs,
+																					ctx.fRenderer->mDevice.GetDeviceID());
+															break;
+			default:										break;
+		}
+		job.fText = oss.str();
+	}
+}
+
+string CNTV2SupportLogger::SnapshotToString (void) const
+{
+	static const uint32_t	sSections[]	= {NTV2_SupportLoggerSectionInfo, NTV2_SupportLoggerSectionAutoCirculate, NTV2_SupportLoggerSectionAudio,
+											NTV2_SupportLoggerSectionRouting, NTV2_SupportLoggerSectionRegisters};
+	static const char *		sNames[]	= {"Info", "AutoCirculate", "Audio", "Routing", "Regs"};
+	static const size_t		kMinRegsPerJob	(64);
+	mSnapshotStats = SnapshotStats();
+
+	//	Take the snapshot -- this is the only time the device is held...
+	SupportLogSnapshotCard	snapshot (mDevice);
+	const bool	tookSnapshot (snapshot.Take(mSections, mSnapshotStats.fHoldMicroseconds));
+	mSnapshotStats.fNumQueries = snapshot.NumQueries();
+	mSnapshotStats.fNumRegisters = ULWord(snapshot.Registers().size());
+	if (!tookSnapshot)
+		return string();
+
+	//	Render every section from the snapshot, spreading the registers section across workers...
+	const uint64_t	startTime (AJATime::GetSystemMicroseconds());
+	const CNTV2SupportLogger	renderer (snapshot, mSections);
+	SnapshotJobs	ctx;
+	ctx.fRenderer = &renderer;
+	ctx.fSnapshot = &snapshot;
+	for (size_t ndx(0);  ndx < sizeof(sSections) / sizeof(sSections[0]);  ndx++)
+		if (mSections & sSections[ndx])
+		{
+			if (sSections[ndx] != NTV2_SupportLoggerSectionRegisters)
+				{ctx.fJobs.push_back(SnapshotJob(sSections[ndx]));  continue;}
+			const size_t numRegs (snapshot.Registers().size());
+			const size_t numBands (std::max(size_t(1), std::min(size_t(::NTV2ParallelRowsMaxWorkers()), numRegs / kMinRegsPerJob)));
+			for (size_t band(0);  band < numBands;  band++)
+			{
+				const size_t first (numRegs * band / numBands),  last (numRegs * (band + 1) / numBands);
+				ctx.fJobs.push_back(SnapshotJob(sSections[ndx], first, last - first));
+			}
+		}
+	mSnapshotStats.fNumWorkers = ::NTV2ParallelRows (ULWord(ctx.fJobs.size()), RenderSnapshotJobs, &ctx);
+
+	//	Stitch the sections together, in the usual order...
+	ostringstream oss;
+	for (size_t ndx(0);  ndx < sizeof(sSections) / sizeof(sSections[0]);  ndx++)
+	{
+		const uint32_t section (sSections[ndx]);
+		if (!(mSections & section))
+			continue;
+		makeHeader(oss, sNames[ndx]);
+		if (mPrependMap.find(section) != mPrependMap.end())
+			oss << mPrependMap.at(section);
+		if (section == NTV2_SupportLoggerSectionRegisters)
+			printRegisterLogHeader(oss, snapshot.Registers().size(), snapshot.RegistersOK());
+		for (size_t jobNdx(0);  jobNdx < ctx.fJobs.size();  jobNdx++)
+			if (ctx.fJobs[jobNdx].fSection == section)
+				oss << ctx.fJobs[jobNdx].fText;
+		if (mAppendMap.find(section) != mAppendMap.end())
+			oss << mAppendMap.at(section);
+	}
+	mSnapshotStats.fNumLateReads = snapshot.NumLateReads();
+	mSnapshotStats.fRenderMicroseconds = AJATime::GetSystemMicroseconds() - startTime;
+	return oss.str();
+}	//	SnapshotToString
+
 struct registerToLoadString
 {
 	NTV2RegisterNumber registerNum;
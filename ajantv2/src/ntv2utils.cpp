@@ -13,6 +13,8 @@
 #include "ntv2endian.h"
 #include "ntv2debug.h"
 #include "ntv2transcode.h"
+#include "ntv2parallel.h"
+#include "ntv2rasterlayout.h"
 #include "ntv2version.h"
 #include "ntv2devicefeatures.h"	//	Required for NTV2DeviceCanDoVideoFormat
 #include "ajabase/system/lock.h"
@@ -451,6 +453,10 @@ void StackQuadrants(uint8_t* pSrc, uint32_t srcWidth, uint32_t srcHeight, uint32
 					 uint8_t* pDst)
 {
 	(void) srcWidth;
+	//	Row-parallel fast path (needs even row bytes)...
+	if (NTV2ConvertRasterLayout (pSrc, NTV2_RASTER_LAYOUT_FULL, pDst, NTV2_RASTER_LAYOUT_QUADRANTS, srcRowBytes, srcHeight & ~1U))
+		return;
+
 	uint32_t dstSample;
 	uint32_t srcSample;
 	uint32_t copyRowBytes = srcRowBytes/2;
@@ -486,11 +492,28 @@ void StackQuadrants(uint8_t* pSrc, uint32_t srcWidth, uint32_t srcHeight, uint32
 	}
 }
 
+// Strided row copy, spread across threads
+typedef struct QuadrantCopyJob
+{
+	const uint8_t *	fSrc;
+	uint8_t *		fDst;
+	ULWord			fSrcRowBytes;
+	ULWord			fDstRowBytes;
+	ULWord			fCopyBytes;
+} QuadrantCopyJob;
+
+static void CopyQuadrantRows (void * pInContext, const ULWord inWorkerIndex, const ULWord inFirstRow, const ULWord inNumRows)
+{
+	(void) inWorkerIndex;
+	const QuadrantCopyJob & job (*reinterpret_cast<const QuadrantCopyJob*>(pInContext));
+	for (ULWord row(inFirstRow);  row < inFirstRow + inNumRows;  row++)
+		memcpy(job.fDst + size_t(row) * job.fDstRowBytes, job.fSrc + size_t(row) * job.fSrcRowBytes, job.fCopyBytes);
+}
+
 // Copy a quater-sized quadrant from a source buffer to a destination buffer
 // quad13Offset is almost always zero, but can be used for Quadrants 1, 3 for special offset frame buffers. (e.g. 4096x1080 10Bit YCbCr frame buffers)
 void CopyFromQuadrant(uint8_t* srcBuffer, uint32_t srcHeight, uint32_t srcRowBytes, uint32_t srcQuadrant, uint8_t* dstBuffer, uint32_t quad13Offset)
 {
-	ULWord dstSample = 0;
 	ULWord srcSample = 0;
 	ULWord dstHeight = srcHeight / 2;
 	ULWord dstRowBytes = srcRowBytes / 2;
@@ -505,13 +528,8 @@ void CopyFromQuadrant(uint8_t* srcBuffer, uint32_t srcHeight, uint32_t srcRowByt
 	case 3: srcSample = srcRowBytes*dstHeight + dstRowBytes - quad13Offset; break;	// quadrant 3, lower right
 	}
 
-	// for each row
-	for (ULWord i=0; i<dstHeight; i++)
-	{
-		memcpy(&dstBuffer[dstSample], &srcBuffer[srcSample], dstRowBytes);
-		dstSample += dstRowBytes;
-		srcSample += srcRowBytes;
-	}
+	QuadrantCopyJob job = {&srcBuffer[srcSample], dstBuffer, srcRowBytes, dstRowBytes, dstRowBytes};
+	NTV2ParallelRows (dstHeight, CopyQuadrantRows, &job);
 }
 
 // Copy a source buffer to a quadrant of a 4x-sized destination buffer
@@ -519,7 +537,6 @@ void CopyFromQuadrant(uint8_t* srcBuffer, uint32_t srcHeight, uint32_t srcRowByt
 void CopyToQuadrant(uint8_t* srcBuffer, uint32_t srcHeight, uint32_t srcRowBytes, uint32_t dstQuadrant, uint8_t* dstBuffer, uint32_t quad13Offset)
 {
 	ULWord dstSample = 0;
-	ULWord srcSample = 0;
 	ULWord dstRowBytes = srcRowBytes * 2;
 
 	// calculate starting point for destination of copy, based on destination quadrant
@@ -532,13 +549,8 @@ void CopyToQuadrant(uint8_t* srcBuffer, uint32_t srcHeight, uint32_t srcRowBytes
 	case 3: dstSample = dstRowBytes*srcHeight + srcRowBytes - quad13Offset; break;	// quadrant 3, lower right
 	}
 
-	// for each row
-	for (ULWord i=0; i<srcHeight; i++)
-	{
-		memcpy(&dstBuffer[dstSample], &srcBuffer[srcSample], srcRowBytes);
-		dstSample += dstRowBytes;
-		srcSample += srcRowBytes;
-	}
+	QuadrantCopyJob job = {srcBuffer, &dstBuffer[dstSample], srcRowBytes, dstRowBytes, srcRowBytes};
+	NTV2ParallelRows (srcHeight, CopyQuadrantRows, &job);
 }
 //////////////////////////////////////////////////////
 //	END SECTION MOVED FROM 'videoutilities.cpp'
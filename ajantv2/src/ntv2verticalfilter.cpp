@@ -1,12 +1,19 @@
 /* SPDX-License-Identifier: MIT */
 /**
 	@file		ntv2verticalfilter.cpp
-	@brief		Implementations of the VerticalFilterLine and FieldInterpolateLine functions.
+	@brief		Implementations of the VerticalFilterLine and FieldInterpolateLine functions, and the NTV2Deinterlacer class.
 	@copyright	(C) 2004-2022 AJA Video Systems, Inc.
 **/
 
 #include "ntv2verticalfilter.h"
+#include "ntv2parallel.h"
 #include <memory.h>
+#if defined(__SSE2__)
+	#include <emmintrin.h>
+	#define	NTV2_DEINTERLACE_SSE2	1
+#endif	//	__SSE2__
+
+using namespace std;
 
 
 static inline RGBAlphaPixel VerticalFilterPixel (RGBAlphaPixel * pTop,
@@ -69,3 +76,386 @@ void FieldInterpolateLine (	RGBAlphaPixel *	topLine,
 		destLine++;
 	}
 }
+
+
+
+//////////////////////////////////////////////////////////////////////////////////////////////////////
+//	NTV2Deinterlacer sample kernels
+//
+//	Each kernel processes "inNumSamples" consecutive component samples, either bytes (8-bit formats)
+//	or UWords ('v210' samples). The SSE2 and scalar versions produce identical results.
+//////////////////////////////////////////////////////////////////////////////////////////////////////
+
+template <typename T> static void InterpolateSamples (const T * pA, const T * pB, T * pOut, const ULWord inNumSamples, ULWord ndx)
+{
+	for (;  ndx < inNumSamples;  ndx++)
+		pOut[ndx] = T((ULWord(pA[ndx]) + ULWord(pB[ndx]) + 1) >> 1);
+}
+
+template <typename T> static void BlendSamples (const T * pA, const T * pB, const T * pC, T * pOut, const ULWord inNumSamples, ULWord ndx)
+{
+	for (;  ndx < inNumSamples;  ndx++)
+		pOut[ndx] = T((ULWord(pA[ndx]) + 2 * ULWord(pB[ndx]) + ULWord(pC[ndx]) + 2) >> 2);
+}
+
+template <typename T> static inline ULWord AbsDiff (const T inA, const T inB)	{return inA > inB ? ULWord(inA - inB) : ULWord(inB - inA);}
+
+template <typename T> static void MotionAdaptSamples (const T * pA, const T * pB, const T * pC, const T * pPrevA, const T * pPrevB, const T * pPrevC,
+														const ULWord inThreshold, T * pOut, const ULWord inNumSamples, ULWord ndx)
+{
+	for (;  ndx < inNumSamples;  ndx++)
+	{
+		ULWord	motion (AbsDiff(pB[ndx], pPrevB[ndx]));
+		const ULWord	motionA (AbsDiff(pA[ndx], pPrevA[ndx])),  motionC (AbsDiff(pC[ndx], pPrevC[ndx]));
+		motion = motionA > motion ? motionA : motion;
+		motion = motionC > motion ? motionC : motion;
+		pOut[ndx] = motion > inThreshold  ?  T((ULWord(pA[ndx]) + ULWord(pC[ndx]) + 1) >> 1)  :  pB[ndx];
+	}
+}
+
+#if defined(NTV2_DEINTERLACE_SSE2)
+	#define	LOADU(__p__)		_mm_loadu_si128(reinterpret_cast<const __m128i*>(__p__))
+	#define	STOREU(__p__,__v__)	_mm_storeu_si128(reinterpret_cast<__m128i*>(__p__), (__v__))
+
+	static void Interpolate8 (const UByte * pA, const UByte * pB, UByte * pOut, const ULWord inNumSamples)
+	{
+		ULWord	ndx(0);
+		for (;  ndx + 16 <= inNumSamples;  ndx += 16)
+			STOREU(pOut + ndx, _mm_avg_epu8(LOADU(pA + ndx), LOADU(pB + ndx)));
+		InterpolateSamples (pA, pB, pOut, inNumSamples, ndx);
+	}
+
+	static void Interpolate16 (const UWord * pA, const UWord * pB, UWord * pOut, const ULWord inNumSamples)
+	{
+		ULWord	ndx(0);
+		for (;  ndx + 8 <= inNumSamples;  ndx += 8)
+			STOREU(pOut + ndx, _mm_avg_epu16(LOADU(pA + ndx), LOADU(pB + ndx)));
+		InterpolateSamples (pA, pB, pOut, inNumSamples, ndx);
+	}
+
+	static inline __m128i Blend16x8 (const __m128i inA, const __m128i inB, const __m128i inC)
+	{	//	(a + 2b + c + 2) >> 2, for 16-bit lanes no larger than 0x3FFF
+		return _mm_srli_epi16(_mm_add_epi16(_mm_add_epi16(inA, inC), _mm_add_epi16(_mm_add_epi16(inB, inB), _mm_set1_epi16(2))), 2);
+	}
+
+	static void Blend8 (const UByte * pA, const UByte * pB, const UByte * pC, UByte * pOut, const ULWord inNumSamples)
+	{
+		const __m128i	zero (_mm_setzero_si128());
+		ULWord			ndx(0);
+		for (;  ndx + 16 <= inNumSamples;  ndx += 16)
+		{
+			const __m128i	a (LOADU(pA + ndx)),  b (LOADU(pB + ndx)),  c (LOADU(pC + ndx));
+			const __m128i	lo (Blend16x8(_mm_unpacklo_epi8(a, zero), _mm_unpacklo_epi8(b, zero), _mm_unpacklo_epi8(c, zero)));
+			const __m128i	hi (Blend16x8(_mm_unpackhi_epi8(a, zero), _mm_unpackhi_epi8(b, zero), _mm_unpackhi_epi8(c, zero)));
+			STOREU(pOut + ndx, _mm_packus_epi16(lo, hi));
+		}
+		BlendSamples (pA, pB, pC, pOut, inNumSamples, ndx);
+	}
+
+	static void Blend16 (const UWord * pA, const UWord * pB, const UWord * pC, UWord * pOut, const ULWord inNumSamples)
+	{
+		ULWord	ndx(0);
+		for (;  ndx + 8 <= inNumSamples;  ndx += 8)
+			STOREU(pOut + ndx, Blend16x8(LOADU(pA + ndx), LOADU(pB + ndx), LOADU(pC + ndx)));
+		BlendSamples (pA, pB, pC, pOut, inNumSamples, ndx);
+	}
+
+	static void MotionAdapt8 (const UByte * pA, const UByte * pB, const UByte * pC, const UByte * pPrevA, const UByte * pPrevB, const UByte * pPrevC,
+								const ULWord inThreshold, UByte * pOut, const ULWord inNumSamples)
+	{
+		const __m128i	zero (_mm_setzero_si128()),  threshold (_mm_set1_epi8(char(inThreshold > 255 ? 255 : inThreshold)));
+		ULWord			ndx(0);
+		for (;  ndx + 16 <= inNumSamples;  ndx += 16)
+		{
+			const __m128i	a (LOADU(pA + ndx)),  b (LOADU(pB + ndx)),  c (LOADU(pC + ndx));
+			const __m128i	pa (LOADU(pPrevA + ndx)),  pb (LOADU(pPrevB + ndx)),  pc (LOADU(pPrevC + ndx));
+			__m128i			motion (_mm_or_si128(_mm_subs_epu8(b, pb), _mm_subs_epu8(pb, b)));
+			motion = _mm_max_epu8(motion, _mm_or_si128(_mm_subs_epu8(a, pa), _mm_subs_epu8(pa, a)));
+			motion = _mm_max_epu8(motion, _mm_or_si128(_mm_subs_epu8(c, pc), _mm_subs_epu8(pc, c)));
+			const __m128i	still (_mm_cmpeq_epi8(_mm_subs_epu8(motion, threshold), zero));	//	0xFF where motion <= threshold
+			STOREU(pOut + ndx, _mm_or_si128(_mm_and_si128(still, b), _mm_andnot_si128(still, _mm_avg_epu8(a, c))));
+		}
+		MotionAdaptSamples (pA, pB, pC, pPrevA, pPrevB, pPrevC, inThreshold, pOut, inNumSamples, ndx);
+	}
+
+	static void MotionAdapt16 (const UWord * pA, const UWord * pB, const UWord * pC, const UWord * pPrevA, const UWord * pPrevB, const UWord * pPrevC,
+								const ULWord inThreshold, UWord * pOut, const ULWord inNumSamples)
+	{
+		const __m128i	zero (_mm_setzero_si128()),  threshold (_mm_set1_epi16(short(inThreshold > 0x7FFF ? 0x7FFF : inThreshold)));
+		ULWord			ndx(0);
+		for (;  ndx + 8 <= inNumSamples;  ndx += 8)
+		{
+			const __m128i	a (LOADU(pA + ndx)),  b (LOADU(pB + ndx)),  c (LOADU(pC + ndx));
+			const __m128i	pa (LOADU(pPrevA + ndx)),  pb (LOADU(pPrevB + ndx)),  pc (LOADU(pPrevC + ndx));
+			__m128i			motion (_mm_or_si128(_mm_subs_epu16(b, pb), _mm_subs_epu16(pb, b)));
+			motion = _mm_max_epi16(motion, _mm_or_si128(_mm_subs_epu16(a, pa), _mm_subs_epu16(pa, a)));	//	10-bit samples, so signed max is OK
+			motion = _mm_max_epi16(motion, _mm_or_si128(_mm_subs_epu16(c, pc), _mm_subs_epu16(pc, c)));
+			const __m128i	still (_mm_cmpeq_epi16(_mm_subs_epu16(motion, threshold), zero));
+			STOREU(pOut + ndx, _mm_or_si128(_mm_and_si128(still, b), _mm_andnot_si128(still, _mm_avg_epu16(a, c))));
+		}
+		MotionAdaptSamples (pA, pB, pC, pPrevA, pPrevB, pPrevC, inThreshold, pOut, inNumSamples, ndx);
+	}
+#endif	//	NTV2_DEINTERLACE_SSE2
+
+template <typename T> static void Interpolate (const T * pA, const T * pB, T * pOut, const ULWord inNumSamples, const bool inUseSIMD)
+{
+#if defined(NTV2_DEINTERLACE_SSE2)
+	if (inUseSIMD)
+		{sizeof(T) == 1 ? Interpolate8 (reinterpret_cast<const UByte*>(pA), reinterpret_cast<const UByte*>(pB), reinterpret_cast<UByte*>(pOut), inNumSamples)
+						: Interpolate16 (reinterpret_cast<const UWord*>(pA), reinterpret_cast<const UWord*>(pB), reinterpret_cast<UWord*>(pOut), inNumSamples);  return;}
+#else
+	(void) inUseSIMD;
+#endif	//	NTV2_DEINTERLACE_SSE2
+	InterpolateSamples (pA, pB, pOut, inNumSamples, 0);
+}
+
+template <typename T> static void Blend (const T * pA, const T * pB, const T * pC, T * pOut, const ULWord inNumSamples, const bool inUseSIMD)
+{
+#if defined(NTV2_DEINTERLACE_SSE2)
+	if (inUseSIMD)
+		{sizeof(T) == 1 ? Blend8 (reinterpret_cast<const UByte*>(pA), reinterpret_cast<const UByte*>(pB), reinterpret_cast<const UByte*>(pC), reinterpret_cast<UByte*>(pOut), inNumSamples)
+						: Blend16 (reinterpret_cast<const UWord*>(pA), reinterpret_cast<const UWord*>(pB), reinterpret_cast<const UWord*>(pC), reinterpret_cast<UWord*>(pOut), inNumSamples);  return;}
+#else
+	(void) inUseSIMD;
+#endif	//	NTV2_DEINTERLACE_SSE2
+	BlendSamples (pA, pB, pC, pOut, inNumSamples, 0);
+}
+
+template <typename T> static void MotionAdapt (const T * const * pInRows, const ULWord inThreshold, T * pOut, const ULWord inNumSamples, const bool inUseSIMD)
+{	//	pInRows:  above, current, below, previous above, previous current, previous below
+#if defined(NTV2_DEINTERLACE_SSE2)
+	if (inUseSIMD)
+	{
+		if (sizeof(T) == 1)
+			MotionAdapt8 (reinterpret_cast<const UByte*>(pInRows[0]), reinterpret_cast<const UByte*>(pInRows[1]), reinterpret_cast<const UByte*>(pInRows[2]),
+							reinterpret_cast<const UByte*>(pInRows[3]), reinterpret_cast<const UByte*>(pInRows[4]), reinterpret_cast<const UByte*>(pInRows[5]),
+							inThreshold, reinterpret_cast<UByte*>(pOut), inNumSamples);
+		else
+			MotionAdapt16 (reinterpret_cast<const UWord*>(pInRows[0]), reinterpret_cast<const UWord*>(pInRows[1]), reinterpret_cast<const UWord*>(pInRows[2]),
+							reinterpret_cast<const UWord*>(pInRows[3]), reinterpret_cast<const UWord*>(pInRows[4]), reinterpret_cast<const UWord*>(pInRows[5]),
+							inThreshold, reinterpret_cast<UWord*>(pOut), inNumSamples);
+		return;
+	}
+#else
+	(void) inUseSIMD;
+#endif	//	NTV2_DEINTERLACE_SSE2
+	MotionAdaptSamples (pInRows[0], pInRows[1], pInRows[2], pInRows[3], pInRows[4], pInRows[5], inThreshold, pOut, inNumSamples, 0);
+}
+
+
+//////////////////////////////////////////////////////////////////////////////////////////////////////
+//	NTV2Deinterlacer row job
+//////////////////////////////////////////////////////////////////////////////////////////////////////
+
+typedef struct DeinterlaceJob
+{
+	NTV2DeinterlaceMode	fMode;
+	const UByte *		fSrc;			///< @brief	First visible source row
+	UByte *				fDst;			///< @brief	First visible destination row
+	const UByte *		fPrev;			///< @brief	Previous source frame's visible rows, or NULL
+	UByte *				fStore;			///< @brief	Receives this source frame's visible rows, or NULL
+	ULWord				fRowBytes;
+	ULWord				fNumRows;
+	ULWord				fKeepParity;	///< @brief	Rows with this parity belong to the kept field
+	ULWord				fThreshold;		///< @brief	Motion threshold, in sample units
+	bool				fIsV210;
+	UWord *				fScratch;		///< @brief	'v210' only:  7 sample rows per worker
+	bool				fUseSIMD;
+} DeinterlaceJob;
+
+static void UnpackV210Samples (const UByte * pInRow, const ULWord inNumWords, UWord * pOutSamples)
+{
+	const ULWord *	pWords (reinterpret_cast<const ULWord*>(pInRow));
+	for (ULWord ndx(0);  ndx < inNumWords;  ndx++, pOutSamples += 3)
+	{
+		pOutSamples[0] = UWord(pWords[ndx] & 0x3FF);
+		pOutSamples[1] = UWord((pWords[ndx] >> 10) & 0x3FF);
+		pOutSamples[2] = UWord((pWords[ndx] >> 20) & 0x3FF);
+	}
+}
+
+static void PackV210Samples (const UWord * pInSamples, const ULWord inNumWords, UByte * pOutRow)
+{
+	ULWord *	pWords (reinterpret_cast<ULWord*>(pOutRow));
+	for (ULWord ndx(0);  ndx < inNumWords;  ndx++, pInSamples += 3)
+		pWords[ndx] = ULWord(pInSamples[0]) | (ULWord(pInSamples[1]) << 10) | (ULWord(pInSamples[2]) << 20);
+}
+
+template <typename T> static void DeinterlaceRow (const DeinterlaceJob & inJob, const T * const * pInRows, const bool inMissing, T * pOutRow, const ULWord inNumSamples)
+{	//	pInRows:  above, current, below (edge-replicated), then the previous frame's above, current and below (or NULL)
+	if (inJob.fMode == NTV2_DEINTERLACE_BLEND)
+		Blend (pInRows[0], pInRows[1], pInRows[2], pOutRow, inNumSamples, inJob.fUseSIMD);
+	else if (!inMissing)
+	{
+		if (pOutRow != pInRows[1])
+			::memcpy (pOutRow, pInRows[1], inNumSamples * sizeof(T));
+	}
+	else if (inJob.fMode == NTV2_DEINTERLACE_MOTION_ADAPTIVE  &&  pInRows[3])
+		MotionAdapt (pInRows, inJob.fThreshold, pOutRow, inNumSamples, inJob.fUseSIMD);
+	else
+		Interpolate (pInRows[0], pInRows[2], pOutRow, inNumSamples, inJob.fUseSIMD);
+}
+
+static void DeinterlaceRowRange (void * pInContext, const ULWord inWorkerIndex, const ULWord inFirstRow, const ULWord inNumRows)
+{
+	const DeinterlaceJob &	job			(*reinterpret_cast<const DeinterlaceJob*>(pInContext));
+	const ULWord			rowBytes	(job.fRowBytes),  lastRow (job.fNumRows - 1);
+	const ULWord			numWords	(rowBytes / 4),  numSamples (numWords * 3);
+	UWord *					pScratch	(job.fScratch  ?  job.fScratch + size_t(inWorkerIndex) * 7 * numSamples  :  AJA_NULL);
+	for (ULWord row(inFirstRow);  row < inFirstRow + inNumRows;  row++)
+	{
+		const bool		missing	((row & 1) != job.fKeepParity);
+		//	Missing-field rows interpolate between the kept rows above & below (mirrored at the edges);
+		//	blended rows replicate the edge rows...
+		const bool		mirror	(missing  &&  job.fMode != NTV2_DEINTERLACE_BLEND);
+		const ULWord	above	(row  ?  row - 1  :  (mirror ? 1 : 0));
+		const ULWord	below	(row < lastRow  ?  row + 1  :  (mirror ? row - 1 : row));
+		const ULWord	srcRows[3] = {above, row, below};
+		const UByte *	rows[6] = {AJA_NULL, AJA_NULL, AJA_NULL, AJA_NULL, AJA_NULL, AJA_NULL};
+		for (unsigned ndx(0);  ndx < 3;  ndx++)
+		{
+			rows[ndx] = job.fSrc + size_t(srcRows[ndx]) * rowBytes;
+			if (job.fPrev)
+				rows[3 + ndx] = job.fPrev + size_t(srcRows[ndx]) * rowBytes;
+		}
+		if (job.fStore)	//	Save this row for the next frame before it's (possibly) overwritten
+			::memcpy (job.fStore + size_t(row) * rowBytes, rows[1], rowBytes);
+		UByte *	pDstRow	(job.fDst + size_t(row) * rowBytes);
+
+		if (!job.fIsV210)
+		{
+			DeinterlaceRow (job, rows, missing, pDstRow, rowBytes);
+			continue;
+		}
+		//	'v210':  unpack the needed rows to 10-bit samples, process, then repack...
+		if (!missing  &&  job.fMode != NTV2_DEINTERLACE_BLEND)
+		{
+			if (pDstRow != rows[1])
+				::memcpy (pDstRow, rows[1], rowBytes);
+			continue;
+		}
+		const UWord *	samples[6] = {AJA_NULL, AJA_NULL, AJA_NULL, AJA_NULL, AJA_NULL, AJA_NULL};
+		for (unsigned ndx(0);  ndx < 6;  ndx++)
+			if (rows[ndx])
+			{
+				UnpackV210Samples (rows[ndx], numWords, pScratch + ndx * numSamples);
+				samples[ndx] = pScratch + ndx * numSamples;
+			}
+		DeinterlaceRow (job, samples, missing, pScratch + 6 * numSamples, numSamples);
+		PackV210Samples (pScratch + 6 * numSamples, numWords, pDstRow);
+	}
+}
+
+
+//////////////////////////////////////////////////////////////////////////////////////////////////////
+//	NTV2Deinterlacer
+//////////////////////////////////////////////////////////////////////////////////////////////////////
+
+bool NTV2Deinterlacer::IsSupportedPixelFormat (const NTV2PixelFormat inPixelFormat)
+{
+	switch (inPixelFormat)
+	{
+		case NTV2_FBF_8BIT_YCBCR:
+		case NTV2_FBF_8BIT_YCBCR_YUY2:
+		case NTV2_FBF_10BIT_YCBCR:
+		case NTV2_FBF_RGBA:
+		case NTV2_FBF_ARGB:
+		case NTV2_FBF_ABGR:		return true;
+		default:				break;
+	}
+	return false;
+}
+
+
+NTV2Deinterlacer::NTV2Deinterlacer (const NTV2DeinterlaceMode inMode)
+	:	mMode			(inMode),
+		mField			(NTV2_FIELD0),
+		mThreshold		(10),
+		mMaxThreads		(0),
+		mUseSIMD		(true),
+		mHistoryNdx		(0),
+		mHasHistory		(false),
+		mPerf			("NTV2Deinterlacer", AJATimerPrecisionMicroseconds)
+{
+}
+
+
+void NTV2Deinterlacer::Reset (void)
+{
+	mHasHistory = false;
+}
+
+
+bool NTV2Deinterlacer::DeinterlaceFrame (const NTV2Buffer & inSrcBuffer, NTV2Buffer & inDstBuffer, const NTV2FormatDescriptor & inDesc)
+{
+	if (!NTV2_IS_VALID_DEINTERLACE_MODE(mMode)  ||  !NTV2_IS_VALID_FIELD(mField))
+		return false;
+	if (!IsSupportedPixelFormat(inDesc.GetPixelFormat())  ||  inDesc.GetVisibleRasterHeight() < 2  ||  !inDesc.GetBytesPerRow())
+		return false;
+	if (inSrcBuffer.IsNULL()  ||  inDstBuffer.IsNULL())
+		return false;
+	if (inSrcBuffer.GetByteCount() < inDesc.GetTotalBytes()  ||  inDstBuffer.GetByteCount() < inDesc.GetTotalBytes())
+		return false;
+
+	mPerf.Start();
+	const ULWord	rowBytes	(inDesc.GetBytesPerRow());
+	const ULWord	numRows		(inDesc.GetVisibleRasterHeight());
+	const bool		isV210		(inDesc.GetPixelFormat() == NTV2_FBF_10BIT_YCBCR);
+	const bool		inPlace		(inSrcBuffer.GetHostPointer() == inDstBuffer.GetHostPointer());
+	const ULWord	maxWorkers	(mMaxThreads  &&  mMaxThreads < NTV2ParallelRowsMaxWorkers() ? mMaxThreads : NTV2ParallelRowsMaxWorkers());
+	const size_t	firstOffset	(size_t(inDesc.GetFirstActiveLine()) * rowBytes);
+
+	DeinterlaceJob	job;
+	job.fMode		= mMode;
+	job.fSrc		= reinterpret_cast<const UByte*>(inSrcBuffer.GetHostPointer()) + firstOffset;
+	job.fDst		= reinterpret_cast<UByte*>(inDstBuffer.GetHostPointer()) + firstOffset;
+	job.fPrev		= AJA_NULL;
+	job.fStore		= AJA_NULL;
+	job.fRowBytes	= rowBytes;
+	job.fNumRows	= numRows;
+	job.fKeepParity	= mField == NTV2_FIELD0 ? 0 : 1;
+	job.fThreshold	= isV210 ? ULWord(mThreshold) << 2 : ULWord(mThreshold);
+	job.fIsV210		= isV210;
+	job.fScratch	= AJA_NULL;
+	job.fUseSIMD	= mUseSIMD;
+
+	if (mMode == NTV2_DEINTERLACE_BLEND  &&  inPlace)
+	{	//	Every row reads its neighbors, so blend from a copy
+		if (mSrcCopy.GetByteCount() < size_t(numRows) * rowBytes  &&  !mSrcCopy.Allocate(size_t(numRows) * rowBytes))
+			{mPerf.Stop();  return false;}
+		::memcpy (mSrcCopy.GetHostPointer(), job.fSrc, size_t(numRows) * rowBytes);
+		job.fSrc = reinterpret_cast<const UByte*>(mSrcCopy.GetHostPointer());
+	}
+	if (mMode == NTV2_DEINTERLACE_MOTION_ADAPTIVE)
+	{	//	Double-buffered history:  read the previous frame from one buffer, while saving this one to the other
+		if (!(mHistoryDesc == inDesc)  ||  mHistoryDesc.GetPixelFormat() != inDesc.GetPixelFormat()
+			||  mHistory[0].GetByteCount() < size_t(numRows) * rowBytes  ||  mHistory[1].GetByteCount() < size_t(numRows) * rowBytes)
+		{
+			mHasHistory = false;
+			if (!mHistory[0].Allocate(size_t(numRows) * rowBytes)  ||  !mHistory[1].Allocate(size_t(numRows) * rowBytes))
+				{mHistoryDesc = NTV2FormatDescriptor();  mPerf.Stop();  return false;}
+			mHistoryDesc = inDesc;
+		}
+		if (mHasHistory)
+			job.fPrev = reinterpret_cast<const UByte*>(mHistory[mHistoryNdx].GetHostPointer());
+		job.fStore = reinterpret_cast<UByte*>(mHistory[mHistoryNdx ^ 1].GetHostPointer());
+	}
+	else
+		mHasHistory = false;	//	History would be stale
+	if (isV210)
+	{
+		const size_t	scratchWords (size_t(maxWorkers) * 7 * (rowBytes / 4) * 3);
+		if (mScratch.size() < scratchWords)
+			mScratch.resize(scratchWords);
+		job.fScratch = &mScratch[0];
+	}
+
+	NTV2ParallelRows (numRows, DeinterlaceRowRange, &job, maxWorkers);
+	if (job.fStore)
+	{
+		mHistoryNdx ^= 1;
+		mHasHistory = true;
+	}
+	mPerf.Stop();
+	return true;
+}
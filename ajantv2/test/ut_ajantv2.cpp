@@ -11,23 +11,51 @@
 // ie xcode 6, 7
 #define DOCTEST_THREAD_LOCAL
 #include "doctest.h"
+#include "ntv2audioconvert.h"
+#include "ntv2audiodefines.h"
+#include "ntv2audiostreamreader.h"
 #include "ntv2bitfile.h"
+#include "ntv2bitfilemanager.h"
 #include "ntv2card.h"
 #include "ntv2debug.h"
 #include "ntv2endian.h"
+#include "ntv2frameconverter.h"
+#include "ntv2hostcsc.h"
+#include "ntv2konaflashprogram.h"
+#include "ntv2parallel.h"
+#include "ntv2previewcompositor.h"
+#include "ntv2rasterlayout.h"
+#include "ntv2registerexpert.h"
+#include "ntv2resample.h"
+#include "ntv2scaler.h"
 #include "ntv2signalrouter.h"
+#include "ntv2supportlogger.h"
 #include "ntv2routingexpert.h"
 #include "ntv2transcode.h"
+#include "ntv2verticalfilter.h"
 #include "ntv2utils.h"
 #include "ntv2vpid.h"
 #include "ntv2version.h"
 #include "ntv2testpatterngen.h"
+#include "ntv2timecodeburner.h"
+#include "ntv2rp188.h"
 #include "ajabase/system/debug.h"
+#include "ajabase/system/file_io.h"
 #include "ajabase/common/common.h"
+#include "ajabase/common/timecodeburn.h"
+#include "ajabase/system/systemtime.h"
 #include <vector>
 #include <algorithm>
 #include <iomanip>
 #include <iterator>    //      For std::inserter
+#include <fstream>
+#include <limits>
+#if defined(AJALinux) || defined(AJAMac)
+	#include <stdlib.h>
+	#include <unistd.h>
+	#include <fcntl.h>
+	#include <sys/stat.h>
+#endif
 
 using namespace std;
 
@@ -39,6 +67,23 @@ static bool gVerboseOutput = false;
 #define	LOGINFO(__x__)	AJA_sREPORT(AJA_DebugUnit_Testing, AJA_DebugSeverity_Info,		AJAFUNC << ":  " << __x__)
 #define	LOGDBG(__x__)	AJA_sREPORT(AJA_DebugUnit_Testing, AJA_DebugSeverity_Debug,		AJAFUNC << ":  " << __x__)
 
+//	Steps the given seed through a 32-bit LCG, so that test data is pseudo-random but reproducible
+static inline ULWord NextPseudoRandom (ULWord & inOutSeed)	{inOutSeed = inOutSeed * 1664525 + 1013904223;  return inOutSeed;}
+
+//	Fills the buffer with pseudo-random bytes. For 10-bit YCbCr pixel formats, the unused bits of each word are cleared.
+static void FillPseudoRandom (NTV2Buffer & inBuffer, ULWord inSeed, const NTV2PixelFormat inPixelFormat = NTV2_FBF_INVALID)
+{
+	UByte * p (reinterpret_cast<UByte*>(inBuffer.GetHostPointer()));
+	for (ULWord ndx(0);  ndx < inBuffer.GetByteCount();  ndx++)
+		p[ndx] = UByte(NextPseudoRandom(inSeed) >> 24);
+	if (inPixelFormat == NTV2_FBF_10BIT_YCBCR  ||  inPixelFormat == NTV2_FBF_10BIT_YCBCR_DPX)
+	{
+		ULWord * pWords (reinterpret_cast<ULWord*>(inBuffer.GetHostPointer()));
+		for (ULWord ndx(0);  ndx < inBuffer.GetByteCount() / 4;  ndx++)
+			pWords[ndx] &= inPixelFormat == NTV2_FBF_10BIT_YCBCR ? 0x3FFFFFFF : NTV2EndianSwap32(0xFFFFFFFC);
+	}
+}
+
 #if 0
 template
 void filename_marker() {} //this is used to easily just around in a GUI with a symbols list
@@ -3393,6 +3438,144 @@ TEST_SUITE("NTV2Buffer" * doctest::description("NTV2Buffer tests"))
 	{
 		NTV2Buffer orig;
 	}	//	hugesizes
+
+	TEST_CASE("bulk_ops")
+	{	//	Every kernel (AVX2/SSE2/scalar, serial/parallel) must match the obvious byte loops
+		static const ULWord sSizes[] = {1, 2, 7, 8, 31, 63, 64, 65, 100, 4097, 3*65536+13, 5*1024*1024+3};
+		const size_t	origThreshold (NTV2Buffer::ParallelThreshold());
+		for (int simd(1);  simd >= 0;  simd--)
+			for (int parallel(0);  parallel < 2;  parallel++)
+			{
+				NTV2Buffer::SetUseSIMD(simd != 0);
+				NTV2Buffer::SetParallelThreshold(parallel ? 1 : 0);
+				INFO("SIMD=" << NTV2Buffer::SIMDInstructionSet() << " parallel=" << parallel);
+				for (size_t sz(0);  sz < sizeof(sSizes) / sizeof(sSizes[0]);  sz++)
+				{
+					const ULWord	byteCount (sSizes[sz]);
+					INFO("byteCount=" << byteCount);
+					NTV2Buffer	a(byteCount), b(byteCount);
+					FillPseudoRandom(a, byteCount);
+					CHECK(b.SetFrom(a));
+
+					//	IsContentEqual & NextDifference
+					CHECK(a.IsContentEqual(b));
+					ULWord offset(0);
+					CHECK(a.NextDifference(b, offset));
+					CHECK_EQ(offset, 0xFFFFFFFF);
+					std::vector<ULWord> diffs;
+					diffs.push_back(byteCount - 1);
+					if (byteCount > 70)
+						{diffs.push_back(byteCount / 2);  diffs.push_back(byteCount / 2 + 1);  diffs.push_back(33);}
+					std::sort(diffs.begin(), diffs.end());
+					for (size_t ndx(0);  ndx < diffs.size();  ndx++)
+						b.U8(int(diffs[ndx])) ^= 0x10;
+					CHECK_FALSE(a.IsContentEqual(b));
+					CHECK(a.IsContentEqual(b, 0, diffs.front()));
+					CHECK_FALSE(a.IsContentEqual(b, 0, diffs.front() + 1));
+					std::vector<ULWord> found;
+					for (offset = 0;  a.NextDifference(b, offset) && offset != 0xFFFFFFFF;  offset++)
+						found.push_back(offset);
+					CHECK(found == diffs);
+
+					//	ByteSwap
+					static const size_t sWordSizes[] = {2, 4, 8};
+					for (size_t ws(0);  ws < 3;  ws++)
+					{
+						const size_t wordSize (sWordSizes[ws]);
+						CHECK(b.SetFrom(a));
+						CHECK((wordSize == 2 ? b.ByteSwap16() : (wordSize == 4 ? b.ByteSwap32() : b.ByteSwap64())));
+						bool same(true);
+						const size_t swapped (byteCount / wordSize * wordSize);
+						for (size_t ndx(0);  ndx < byteCount;  ndx++)
+						{
+							const size_t word (ndx / wordSize * wordSize);
+							const UByte expected (ndx < swapped ? a.U8(int(word + wordSize - 1 - (ndx - word))) : a.U8(int(ndx)));
+							if (b.U8(int(ndx)) != expected)
+								same = false;
+						}
+						CHECK(same);
+					}
+
+					//	Fill
+					CHECK(b.SetFrom(a));
+					CHECK(b.Fill(UByte(0x5A)));
+					bool filled(true);
+					for (ULWord ndx(0);  ndx < byteCount;  ndx++)
+						if (b.U8(int(ndx)) != 0x5A)
+							filled = false;
+					CHECK(filled);
+					if (byteCount >= 8)
+					{
+						static const ULWord64	sValue (0x0123456789ABCDEFULL);
+						CHECK(b.SetFrom(a));
+						CHECK(b.Fill(ULWord(0xBAADF00D)));
+						const ULWord * pU32s (b);
+						bool ok(true);
+						for (ULWord ndx(0);  ndx < byteCount / 4;  ndx++)
+							if (pU32s[ndx] != 0xBAADF00D)
+								ok = false;
+						for (ULWord ndx(byteCount / 4 * 4);  ndx < byteCount;  ndx++)
+							if (b.U8(int(ndx)) != a.U8(int(ndx)))
+								ok = false;	//	Trailing bytes untouched
+						CHECK(ok);
+						CHECK(b.Fill(UWord(0xCAFE)));
+						CHECK_EQ(reinterpret_cast<const UWord*>(b.GetHostPointer())[byteCount / 2 - 1], 0xCAFE);
+						CHECK(b.Fill(sValue));
+						CHECK_EQ(reinterpret_cast<const ULWord64*>(b.GetHostPointer())[byteCount / 8 - 1], sValue);
+					}
+
+					//	GetHash64 must not depend on SIMD or threading
+					const uint64_t hash (a.GetHash64());
+					NTV2Buffer::SetUseSIMD(false);
+					NTV2Buffer::SetParallelThreshold(0);
+					CHECK_EQ(a.GetHash64(), hash);
+					NTV2Buffer::SetUseSIMD(simd != 0);
+					NTV2Buffer::SetParallelThreshold(parallel ? 1 : 0);
+					CHECK(a.GetHash64(1) != hash);
+					a.U8(int(byteCount / 3)) ^= 0x01;
+					CHECK(a.GetHash64() != hash);
+				}	//	for each size
+			}
+		NTV2Buffer::SetUseSIMD(true);
+		NTV2Buffer::SetParallelThreshold(origThreshold);
+
+		//	Known XXH64 values (buffers up to 1MB are plain XXH64)
+		const std::string abc("abc"),  spam("Nobody inspects the spammish repetition");
+		CHECK_EQ(NTV2Buffer(abc.data(), abc.length()).GetHash64(), 0x44BC2CF5AD770999ULL);
+		CHECK_EQ(NTV2Buffer(spam.data(), spam.length()).GetHash64(), 0xFBCEA83C8A378BF1ULL);
+		CHECK_EQ(NTV2Buffer().GetHash64(), 0);
+		CHECK_FALSE(NTV2Buffer().Fill(ULWord(0)));
+		CHECK_FALSE(NTV2Buffer(3).Fill(ULWord(0)));
+	}	//	bulk_ops
+
+	TEST_CASE("bulk_ops_performance")
+	{	//	8K 'v210' frame
+		NTV2Buffer	a(7680 * 4320 * 8 / 3),  b(a.GetByteCount());
+		FillPseudoRandom(a, 1);
+		b.SetFrom(a);
+		for (int simd(1);  simd >= 0;  simd--)
+		{
+			NTV2Buffer::SetUseSIMD(simd != 0);
+			uint64_t	compareUS(0), fillUS(0), swapUS(0), hashUS(0);
+			for (int pass(0);  pass < 5;  pass++)
+			{
+				uint64_t t0 (AJATime::GetSystemMicroseconds());
+				CHECK(a.IsContentEqual(b));
+				uint64_t t1 (AJATime::GetSystemMicroseconds());	compareUS += t1 - t0;
+				CHECK(b.Fill(ULWord(0x12345678)));
+				t0 = AJATime::GetSystemMicroseconds();			fillUS += t0 - t1;
+				CHECK(b.ByteSwap32());
+				t1 = AJATime::GetSystemMicroseconds();			swapUS += t1 - t0;
+				CHECK(a.GetHash64() != 0);
+				t0 = AJATime::GetSystemMicroseconds();			hashUS += t0 - t1;
+				b.SetFrom(a);
+			}
+			if (gVerboseOutput)
+				cout	<< "8K v210 " << NTV2Buffer::SIMDInstructionSet() << ": IsContentEqual " << compareUS / 5 << "us, Fill " << fillUS / 5
+						<< "us, ByteSwap32 " << swapUS / 5 << "us, GetHash64 " << hashUS / 5 << "us" << endl;
+		}
+		NTV2Buffer::SetUseSIMD(true);
+	}	//	bulk_ops_performance
 } //NTV2Buffer
 
 
@@ -3856,6 +4039,177 @@ TEST_SUITE("signal router" * doctest::description("CNTV2SignalRouter & RoutingEx
 		NTV2PossibleConnections conns;
 		CHECK(CNTV2SignalRouter::CreateFromString ("", conns));
 	}   //  TEST_CASE("CNTV2SignalRouter::CreateFromString")
+	TEST_CASE("CNTV2SignalRouter::GetAllWidgetInputs/Outputs")
+	{
+		//	The per-device cache must match what the widget tables say...
+		const NTV2DeviceID deviceIDs[] = {DEVICE_ID_KONA4, DEVICE_ID_KONA5, DEVICE_ID_IO4K, DEVICE_ID_KONA1};
+		for (size_t ndx(0);  ndx < sizeof(deviceIDs) / sizeof(NTV2DeviceID);  ndx++)
+		{
+			NTV2WidgetIDSet widgetIDs;
+			NTV2InputXptIDSet expectedInputs, inputs;
+			NTV2OutputXptIDSet expectedOutputs, outputs;
+			CHECK(CNTV2SignalRouter::GetWidgetIDs(deviceIDs[ndx], widgetIDs));
+			for (NTV2WidgetIDSetConstIter it(widgetIDs.begin());  it != widgetIDs.end();  ++it)
+			{
+				NTV2InputXptIDSet wgtInputs;
+				NTV2OutputXptIDSet wgtOutputs;
+				CNTV2SignalRouter::GetWidgetInputs(*it, wgtInputs);
+				CNTV2SignalRouter::GetWidgetOutputs(*it, wgtOutputs);
+				const bool skipDS2 (CNTV2SignalRouter::WidgetIDToType(*it) == NTV2WidgetType_FrameStore
+									&& !::NTV2DeviceCanDo425Mux(deviceIDs[ndx])  &&  !::NTV2DeviceCanDo8KVideo(deviceIDs[ndx]));
+				for (NTV2InputXptIDSetConstIter i(wgtInputs.begin());  i != wgtInputs.end();  ++i)
+					if (!skipDS2  ||  ::NTV2InputCrosspointIDToString(*i, false).find("DS2") == string::npos)
+						expectedInputs.insert(*i);
+				for (NTV2OutputXptIDSetConstIter o(wgtOutputs.begin());  o != wgtOutputs.end();  ++o)
+					if (!skipDS2  ||  ::NTV2OutputCrosspointIDToString(*o, false).find("DS2") == string::npos)
+						expectedOutputs.insert(*o);
+			}
+			CHECK(CNTV2SignalRouter::GetAllWidgetInputs(deviceIDs[ndx], inputs));
+			CHECK(CNTV2SignalRouter::GetAllWidgetOutputs(deviceIDs[ndx], outputs));
+			CHECK(inputs == expectedInputs);
+			CHECK(outputs == expectedOutputs);
+		}
+	}   //  TEST_CASE("CNTV2SignalRouter::GetAllWidgetInputs/Outputs")
+	TEST_CASE("CNTV2SignalRouter::FindRoute")
+	{
+		NTV2XptConnections route, expected;
+
+		//	YUV playout needs no converter...
+		CHECK(CNTV2SignalRouter::FindRoute(DEVICE_ID_KONA4, NTV2_XptFrameBuffer1YUV, NTV2_XptSDIOut1Input, NTV2_FBF_10BIT_YCBCR, route));
+		expected.clear();
+		expected[NTV2_XptSDIOut1Input] = NTV2_XptFrameBuffer1YUV;
+		CHECK(route == expected);
+
+		//	RGB playout goes through the same-channel CSC, whichever FrameStore xpt was asked for...
+		CHECK(CNTV2SignalRouter::FindRoute(DEVICE_ID_KONA4, NTV2_XptFrameBuffer3YUV, NTV2_XptSDIOut3Input, NTV2_FBF_ARGB, route));
+		expected.clear();
+		expected[NTV2_XptSDIOut3Input] = NTV2_XptCSC3VidYUV;
+		expected[NTV2_XptCSC3VidInput] = NTV2_XptFrameBuffer3RGB;
+		CHECK(route == expected);
+
+		//	RGB capture...
+		CHECK(CNTV2SignalRouter::FindRoute(DEVICE_ID_KONA4, NTV2_XptSDIIn2, NTV2_XptFrameBuffer2Input, NTV2_FBF_10BIT_DPX, route));
+		expected.clear();
+		expected[NTV2_XptFrameBuffer2Input] = NTV2_XptCSC2VidRGB;
+		expected[NTV2_XptCSC2VidInput] = NTV2_XptSDIIn2;
+		CHECK(route == expected);
+
+		//	RGB-only inputs...
+		CHECK(CNTV2SignalRouter::FindRoute(DEVICE_ID_KONA4, NTV2_XptSDIIn1, NTV2_XptDualLinkOut1Input, NTV2_FBF_INVALID, route));
+		expected.clear();
+		expected[NTV2_XptDualLinkOut1Input] = NTV2_XptCSC1VidRGB;
+		expected[NTV2_XptCSC1VidInput] = NTV2_XptSDIIn1;
+		CHECK(route == expected);
+
+		//	Repeat queries come from the cache, and give the same answer...
+		NTV2XptConnections again;
+		CHECK(CNTV2SignalRouter::FindRoute(DEVICE_ID_KONA4, NTV2_XptSDIIn1, NTV2_XptDualLinkOut1Input, NTV2_FBF_INVALID, again));
+		CHECK(again == route);
+
+		//	Crosspoints the device doesn't have...
+		CHECK_FALSE(CNTV2SignalRouter::FindRoute(DEVICE_ID_KONA1, NTV2_XptFrameBuffer8YUV, NTV2_XptSDIOut1Input, NTV2_FBF_INVALID, route));
+		CHECK(route.empty());
+		CHECK_FALSE(CNTV2SignalRouter::FindRoute(DEVICE_ID_KONA4, NTV2_XptBlack, NTV2_XptSDIOut1Input, NTV2_FBF_INVALID, route));
+		CHECK_FALSE(CNTV2SignalRouter::FindRoute(DEVICE_ID_KONA4, NTV2_XptSDIIn1, NTV2_INPUT_CROSSPOINT_INVALID, NTV2_FBF_INVALID, route));
+
+		//	Every route found must only use connections the device has, and respect RGB/YUV-only inputs...
+		NTV2InputXptIDSet inputs;
+		NTV2OutputXptIDSet outputs;
+		CHECK(CNTV2SignalRouter::GetAllWidgetInputs(DEVICE_ID_KONA4, inputs));
+		CHECK(CNTV2SignalRouter::GetAllWidgetOutputs(DEVICE_ID_KONA4, outputs));
+		const NTV2OutputXptID sources[] = {NTV2_XptSDIIn1, NTV2_XptFrameBuffer1YUV, NTV2_XptFrameBuffer4RGB, NTV2_XptHDMIIn1};
+		unsigned numRoutes(0);
+		const uint64_t startTime (AJATime::GetSystemMicroseconds());
+		for (size_t ndx(0);  ndx < sizeof(sources) / sizeof(NTV2OutputXptID);  ndx++)
+			for (NTV2InputXptIDSetConstIter it(inputs.begin());  it != inputs.end();  ++it)
+				if (CNTV2SignalRouter::FindRoute(DEVICE_ID_KONA4, sources[ndx], *it, NTV2_FBF_INVALID, route))
+				{
+					numRoutes++;
+					CHECK(route.find(*it) != route.end());
+					for (NTV2XptConnectionsConstIter c(route.begin());  c != route.end();  ++c)
+					{
+						CHECK(inputs.find(c->first) != inputs.end());
+						CHECK(outputs.find(c->second) != outputs.end());
+						if (CNTV2SignalRouter::IsRGBOnlyInputXpt(c->first))
+							CHECK((c->second & 0x80) != 0);
+						if (CNTV2SignalRouter::IsYUVOnlyInputXpt(c->first))
+							CHECK((c->second & 0x80) == 0);
+					}
+				}
+		const uint64_t elapsed (AJATime::GetSystemMicroseconds() - startTime);
+		CHECK(numRoutes > 100);
+		const uint64_t startTime2 (AJATime::GetSystemMicroseconds());
+		for (size_t ndx(0);  ndx < sizeof(sources) / sizeof(NTV2OutputXptID);  ndx++)
+			for (NTV2InputXptIDSetConstIter it(inputs.begin());  it != inputs.end();  ++it)
+				CNTV2SignalRouter::FindRoute(DEVICE_ID_KONA4, sources[ndx], *it, NTV2_FBF_INVALID, route);
+		const uint64_t elapsed2 (AJATime::GetSystemMicroseconds() - startTime2);
+		if (gVerboseOutput)
+			cout << "FindRoute: " << numRoutes << " of " << inputs.size() * sizeof(sources) / sizeof(NTV2OutputXptID)
+				<< " routed, " << elapsed << "us solving, " << elapsed2 << "us cached" << endl;
+	}   //  TEST_CASE("CNTV2SignalRouter::FindRoute")
+	TEST_CASE("CNTV2SignalRouter::GetChangedRegisterWrites")
+	{
+		NTV2XptConnections current, target;
+		current[NTV2_XptFrameBuffer1Input]	= NTV2_XptSDIIn1;
+		current[NTV2_XptSDIOut1Input]		= NTV2_XptFrameBuffer1YUV;
+		current[NTV2_XptCSC1VidInput]		= NTV2_XptFrameBuffer1RGB;
+		current[NTV2_XptSDIOut2Input]		= NTV2_XptFrameBuffer2YUV;
+		target[NTV2_XptFrameBuffer1Input]	= NTV2_XptSDIIn1;		//	unchanged
+		target[NTV2_XptSDIOut1Input]		= NTV2_XptCSC1VidYUV;	//	changed
+		target[NTV2_XptSDIOut3Input]		= NTV2_XptFrameBuffer1YUV;	//	new
+		target[NTV2_XptSDIOut2Input]		= NTV2_XptBlack;		//	explicit disconnect
+		//	CSC1VidInput absent -- disconnected only when replacing
+
+		//	Nothing to do...
+		NTV2RegisterWrites regWrites;
+		CHECK(CNTV2SignalRouter::GetChangedRegisterWrites(current, current, regWrites));
+		CHECK(regWrites.empty());
+
+		NTV2InputXptIDSet inputs;
+		NTV2RegisterReads routingRegs;
+		CHECK(CNTV2SignalRouter::GetAllWidgetInputs(DEVICE_ID_KONA4, inputs));
+		CHECK(CNTV2SignalRouter::GetAllRoutingRegInfos(inputs, routingRegs));
+		for (int replace(0);  replace < 2;  replace++)
+		{
+			//	Load simulated routing registers from 'current'...
+			CNTV2SignalRouter router;
+			NTV2RegisterWrites initialWrites;
+			CHECK(router.ResetFrom(current));
+			CHECK(router.GetRegisterWrites(initialWrites));
+			NTV2RegisterReads regs(routingRegs);
+			for (size_t r(0);  r < regs.size();  r++)
+				regs[r].registerValue = 0;
+			NTV2RegisterWrites allWrites(initialWrites);
+			CHECK(CNTV2SignalRouter::GetChangedRegisterWrites(current, target, regWrites, replace ? true : false));
+			allWrites.insert(allWrites.end(), regWrites.begin(), regWrites.end());
+			for (size_t w(0);  w < allWrites.size();  w++)
+				for (size_t r(0);  r < regs.size();  r++)
+					if (regs[r].registerNumber == allWrites[w].registerNumber)
+						regs[r].registerValue = (regs[r].registerValue & ~allWrites[w].registerMask)
+												| ((allWrites[w].registerValue << allWrites[w].registerShift) & allWrites[w].registerMask);
+
+			//	Only registers holding changed inputs are written, each just once...
+			std::set<ULWord> changedRegs;
+			const NTV2InputXptID changedInputs[] = {NTV2_XptSDIOut1Input, NTV2_XptSDIOut3Input, NTV2_XptSDIOut2Input, NTV2_XptCSC1VidInput};
+			for (size_t ndx(0);  ndx < (replace ? 4U : 3U);  ndx++)
+			{
+				uint32_t regNum(0), maskNdx(0);
+				CHECK(CNTV2RegisterExpert::GetCrosspointSelectGroupRegisterInfo(changedInputs[ndx], regNum, maskNdx));
+				changedRegs.insert(regNum);
+			}
+			CHECK(regWrites.size() == changedRegs.size());
+			for (size_t w(0);  w < regWrites.size();  w++)
+				CHECK(changedRegs.find(regWrites[w].registerNumber) != changedRegs.end());
+
+			//	The resulting routing must be the target (plus CSC1 when not replacing)...
+			NTV2XptConnections result, expected(target);
+			expected.erase(NTV2_XptSDIOut2Input);
+			if (!replace)
+				expected[NTV2_XptCSC1VidInput] = NTV2_XptFrameBuffer1RGB;
+			CHECK(CNTV2SignalRouter::GetConnectionsFromRegs(inputs, regs, result));
+			CHECK(result == expected);
+		}
+	}   //  TEST_CASE("CNTV2SignalRouter::GetChangedRegisterWrites")
 }   //  TEST_SUITE("signal router")
 
 
@@ -3960,6 +4314,1064 @@ TEST_SUITE("TestPatternGen" * doctest::description("NTV2TestPatternGen tests"))
 }	//	TEST_SUITE("TestPatternGen")
 
 
+TEST_SUITE("NTV2FrameConverter" * doctest::description("NTV2FrameConverter tests"))
+{
+	//	Makes a '2vuy' raster whose chroma is constant across row pairs, so that it survives 4:2:0
+	static void Make2vuyRaster (const NTV2FormatDesc & inFD, NTV2Buffer & outBuffer)
+	{
+		outBuffer.Allocate(inFD.GetTotalBytes());
+		FillPseudoRandom (outBuffer, 1);
+		for (ULWord row(0);  row < inFD.GetVisibleRasterHeight();  row += 2)
+		{
+			UByte * pRow0 (reinterpret_cast<UByte*>(inFD.GetWriteableRowAddress(outBuffer.GetHostPointer(), row + inFD.GetFirstActiveLine())));
+			UByte * pRow1 (pRow0 + inFD.GetBytesPerRow());
+			for (ULWord ndx(0);  ndx < inFD.GetRasterWidth() * 2;  ndx += 2)
+			{
+				if (pRow0[ndx+1] < 16)	pRow0[ndx+1] = 16;	//	Keep luma in range...
+				if (pRow0[ndx+1] > 235)	pRow0[ndx+1] = 235;
+				if (pRow1[ndx+1] < 16)	pRow1[ndx+1] = 16;
+				if (pRow1[ndx+1] > 235)	pRow1[ndx+1] = 235;
+				pRow1[ndx] = pRow0[ndx];					//	...and chroma the same on both rows
+			}
+		}
+	}
+
+	TEST_CASE("Capabilities")
+	{
+		const NTV2PixelFormats pfs (NTV2FrameConverter::GetSupportedPixelFormats());
+		CHECK_EQ(pfs.size(), 26);
+		CHECK_FALSE(NTV2FrameConverter::IsSupportedPixelFormat(NTV2_FBF_PRORES_DVCPRO));
+		CHECK_FALSE(NTV2FrameConverter::IsSupportedPixelFormat(NTV2_FBF_10BIT_RAW_RGB));
+		CHECK_FALSE(NTV2FrameConverter::CanConvert(NTV2_FBF_8BIT_DVCPRO, NTV2_FBF_8BIT_YCBCR));
+		CHECK(NTV2FrameConverter::CanConvert(NTV2_FBF_10BIT_YCBCR_420PL2, NTV2_FBF_12BIT_RGB_PACKED));
+		CHECK(NTV2FrameConverter::HasFastPath(NTV2_FBF_8BIT_YCBCR, NTV2_FBF_10BIT_YCBCR));
+		CHECK(NTV2FrameConverter::HasFastPath(NTV2_FBF_24BIT_BGR, NTV2_FBF_RGBA));
+		CHECK(NTV2FrameConverter::HasFastPath(NTV2_FBF_10BIT_DPX, NTV2_FBF_10BIT_DPX));
+		CHECK_FALSE(NTV2FrameConverter::HasFastPath(NTV2_FBF_10BIT_YCBCR, NTV2_FBF_ABGR));
+		CHECK(NTV2FrameConverter::HasFastPath(NTV2_FBF_8BIT_YCBCR, NTV2_FBF_8BIT_YCBCR_420PL2));
+		CHECK_FALSE(NTV2FrameConverter::HasFastPath(NTV2_FBF_8BIT_YCBCR, NTV2_FBF_8BIT_YCBCR_422PL2));
+
+		NTV2FrameConverter	conv;
+		const NTV2FormatDesc	fd1080 (NTV2_STANDARD_1080p, NTV2_FBF_8BIT_YCBCR),  fd720 (NTV2_STANDARD_720, NTV2_FBF_8BIT_YCBCR);
+		NTV2Buffer	src(fd1080.GetTotalBytes()),  dst(fd720.GetTotalBytes()),  tiny(16);
+		CHECK_FALSE(conv.ConvertFrame(src, fd1080, dst, fd720));	//	Raster size mismatch
+		CHECK_FALSE(conv.ConvertFrame(tiny, fd1080, src, fd1080));	//	Buffer too small
+		CHECK_FALSE(conv.ConvertLine(src.GetHostPointer(), NTV2_FBF_8BIT_YCBCR_420PL3, dst.GetHostPointer(), NTV2_FBF_8BIT_YCBCR, 1920));	//	Planar
+	}	//	TEST_CASE("Capabilities")
+
+	TEST_CASE("YCbCr Round Trip")
+	{	//	8-bit YCbCr => every YCbCr format => 8-bit YCbCr must be lossless
+		const NTV2FormatDesc	fd2vuy (NTV2_STANDARD_1080p, NTV2_FBF_8BIT_YCBCR);
+		NTV2Buffer	src, mid, dst(fd2vuy.GetTotalBytes());
+		Make2vuyRaster (fd2vuy, src);
+		const NTV2PixelFormats pfs (NTV2FrameConverter::GetSupportedPixelFormats());
+		for (NTV2PixelFormatsConstIter it(pfs.begin());  it != pfs.end();  ++it)
+		{
+			const NTV2FormatDesc	fdMid (NTV2_STANDARD_1080p, *it);
+			if (!fdMid.IsValid()  ||  NTV2_IS_FBF_RGB(*it))
+				continue;
+			NTV2FrameConverter	conv;
+			mid.Allocate(fdMid.GetTotalBytes());
+			dst.Fill(UByte(0));
+			INFO("Pixel format: " << ::NTV2FrameBufferFormatToString(*it));
+			CHECK(conv.ConvertFrame(src, fd2vuy, mid, fdMid));
+			CHECK(conv.ConvertFrame(mid, fdMid, dst, fd2vuy));
+			CHECK(src.IsContentEqual(dst));
+		}
+	}	//	TEST_CASE("YCbCr Round Trip")
+
+	TEST_CASE("RGB Round Trip")
+	{	//	8-bit opaque RGB => every RGB format => 8-bit RGB must be lossless
+		const NTV2FormatDesc	fdABGR (NTV2_STANDARD_720, NTV2_FBF_ABGR);
+		NTV2Buffer	src(fdABGR.GetTotalBytes()), mid, dst(fdABGR.GetTotalBytes());
+		FillPseudoRandom (src, 2);
+		for (ULWord ndx(3);  ndx < src.GetByteCount();  ndx += 4)
+			src.U8(int(ndx)) = 0xFF;
+		const NTV2PixelFormats pfs (NTV2FrameConverter::GetSupportedPixelFormats());
+		for (NTV2PixelFormatsConstIter it(pfs.begin());  it != pfs.end();  ++it)
+		{
+			if (!NTV2_IS_FBF_RGB(*it))
+				continue;
+			const NTV2FormatDesc	fdMid (NTV2_STANDARD_720, *it);
+			NTV2FrameConverter	conv;
+			mid.Allocate(fdMid.GetTotalBytes());
+			dst.Fill(UByte(0));
+			INFO("Pixel format: " << ::NTV2FrameBufferFormatToString(*it));
+			CHECK(conv.ConvertFrame(src, fdABGR, mid, fdMid));
+			CHECK(conv.setUseFastPaths(false).ConvertFrame(mid, fdMid, dst, fdABGR));
+			CHECK(src.IsContentEqual(dst));
+		}
+	}	//	TEST_CASE("RGB Round Trip")
+
+	TEST_CASE("Fast Paths Match Generic Path")
+	{
+		static const NTV2PixelFormat pairs[][2] = {	{NTV2_FBF_8BIT_YCBCR,	NTV2_FBF_10BIT_YCBCR},	{NTV2_FBF_8BIT_YCBCR,	NTV2_FBF_8BIT_YCBCR_YUY2},
+													{NTV2_FBF_8BIT_YCBCR_YUY2,	NTV2_FBF_8BIT_YCBCR},	{NTV2_FBF_ABGR,	NTV2_FBF_10BIT_RGB},
+													{NTV2_FBF_ABGR,	NTV2_FBF_10BIT_DPX},	{NTV2_FBF_ABGR,	NTV2_FBF_10BIT_DPX_LE},
+													{NTV2_FBF_ABGR,	NTV2_FBF_24BIT_RGB},	{NTV2_FBF_ABGR,	NTV2_FBF_24BIT_BGR},
+													{NTV2_FBF_ARGB,	NTV2_FBF_RGBA},			{NTV2_FBF_RGBA,	NTV2_FBF_24BIT_BGR},
+													{NTV2_FBF_24BIT_RGB,	NTV2_FBF_ARGB},	{NTV2_FBF_24BIT_BGR,	NTV2_FBF_ABGR},
+													{NTV2_FBF_8BIT_YCBCR,	NTV2_FBF_8BIT_YCBCR_420PL2},	{NTV2_FBF_8BIT_YCBCR_YUY2,	NTV2_FBF_8BIT_YCBCR_420PL2}};
+		for (size_t ndx(0);  ndx < sizeof(pairs) / sizeof(pairs[0]);  ndx++)
+		{
+			const NTV2FormatDesc	fdSrc (NTV2_STANDARD_1080p, pairs[ndx][0]),  fdDst (NTV2_STANDARD_1080p, pairs[ndx][1]);
+			NTV2Buffer	src, fast(fdDst.GetTotalBytes()), slow(fdDst.GetTotalBytes());
+			if (NTV2_IS_FBF_RGB(pairs[ndx][0]))
+			{
+				src.Allocate(fdSrc.GetTotalBytes());
+				FillPseudoRandom (src, ULWord(ndx));
+				if (fdSrc.GetBytesPerRow() == fdSrc.GetRasterWidth() * 4)	//	Opaque
+					for (ULWord px(0);  px < src.GetByteCount() / 4;  px++)
+						src.U8(int(px * 4 + (pairs[ndx][0] == NTV2_FBF_RGBA ? 0 : 3))) = 0xFF;
+			}
+			else
+				Make2vuyRaster (fdSrc, src);
+			INFO(::NTV2FrameBufferFormatToString(pairs[ndx][0]) << " => " << ::NTV2FrameBufferFormatToString(pairs[ndx][1]));
+			NTV2FrameConverter	conv;
+			CHECK(conv.ConvertFrame(src, fdSrc, fast, fdDst));
+			CHECK(conv.getLastStats().fFastPath);
+			CHECK(conv.setUseFastPaths(false).ConvertFrame(src, fdSrc, slow, fdDst));
+			CHECK_FALSE(conv.getLastStats().fFastPath);
+			CHECK(fast.IsContentEqual(slow));
+		}
+	}	//	TEST_CASE("Fast Paths Match Generic Path")
+
+	TEST_CASE("YCbCr To RGB Levels")
+	{	//	Black & white 2vuy => full & SMPTE range RGB
+		UByte	line2vuy[8] = {0x80, 16, 0x80, 16,  0x80, 235, 0x80, 235},  lineABGR[16];
+		NTV2FrameConverter	conv;
+		CHECK(conv.ConvertLine(line2vuy, NTV2_FBF_8BIT_YCBCR, lineABGR, NTV2_FBF_ABGR, 4));
+		CHECK_EQ(lineABGR[0], 0);		CHECK_EQ(lineABGR[1], 0);		CHECK_EQ(lineABGR[2], 0);		CHECK_EQ(lineABGR[3], 255);
+		CHECK_EQ(lineABGR[8], 255);		CHECK_EQ(lineABGR[9], 255);		CHECK_EQ(lineABGR[10], 255);
+		CHECK(conv.setUseSMPTERange(true).ConvertLine(line2vuy, NTV2_FBF_8BIT_YCBCR, lineABGR, NTV2_FBF_ABGR, 4));
+		CHECK_EQ(lineABGR[0], 16);		CHECK_EQ(lineABGR[1], 16);		CHECK_EQ(lineABGR[2], 16);
+		CHECK_EQ(lineABGR[8], 235);		CHECK_EQ(lineABGR[9], 235);		CHECK_EQ(lineABGR[10], 235);
+		CHECK(conv.ConvertLine(lineABGR, NTV2_FBF_ABGR, line2vuy, NTV2_FBF_8BIT_YCBCR, 4));
+		CHECK_EQ(line2vuy[1], 16);		CHECK_EQ(line2vuy[5], 235);		CHECK_EQ(line2vuy[0], 0x80);	CHECK_EQ(line2vuy[2], 0x80);
+	}	//	TEST_CASE("YCbCr To RGB Levels")
+
+	TEST_CASE("Threaded Matches ConvertLine")
+	{	//	The threaded fast path must match the existing line transcoder, and the worker count mustn't change the result
+		const NTV2FormatDesc	fdV210 (NTV2_STANDARD_1080p, NTV2_FBF_10BIT_YCBCR),  fd2vuy (NTV2_STANDARD_1080p, NTV2_FBF_8BIT_YCBCR),  fdABGR (NTV2_STANDARD_1080p, NTV2_FBF_ABGR);
+		NTV2Buffer	v210(fdV210.GetTotalBytes()), ref2vuy(fd2vuy.GetTotalBytes()), out2vuy(fd2vuy.GetTotalBytes()), outABGR(fdABGR.GetTotalBytes()), oneABGR(fdABGR.GetTotalBytes());
+		FillPseudoRandom (v210, 3);
+		for (ULWord row(0);  row < fdV210.GetRasterHeight();  row++)
+			::ConvertLine_v210_to_2vuy (reinterpret_cast<const ULWord*>(fdV210.GetRowAddress(v210.GetHostPointer(), row)),
+										reinterpret_cast<UByte*>(fd2vuy.GetWriteableRowAddress(ref2vuy.GetHostPointer(), row)), fdV210.GetRasterWidth());
+		NTV2FrameConverter	conv;
+		CHECK(conv.ConvertFrame(v210, fdV210, out2vuy, fd2vuy));
+		CHECK(out2vuy.IsContentEqual(ref2vuy));
+		CHECK(conv.ConvertFrame(v210, fdV210, outABGR, fdABGR));
+		CHECK(conv.setMaxThreads(1).ConvertFrame(v210, fdV210, oneABGR, fdABGR));
+		CHECK_EQ(conv.getLastStats().fNumWorkers, 1);
+		CHECK(outABGR.IsContentEqual(oneABGR));
+	}	//	TEST_CASE("Threaded Matches ConvertLine")
+
+	TEST_CASE("Performance" * doctest::skip())
+	{	//	Compare threaded frame conversion against the existing single-threaded line transcoder
+		const NTV2FormatDesc	fdV210 (NTV2_STANDARD_3840x2160p, NTV2_FBF_10BIT_YCBCR),  fd2vuy (NTV2_STANDARD_3840x2160p, NTV2_FBF_8BIT_YCBCR),  fdABGR (NTV2_STANDARD_3840x2160p, NTV2_FBF_ABGR);
+		NTV2Buffer	v210(fdV210.GetTotalBytes()), ref2vuy(fd2vuy.GetTotalBytes()), out2vuy(fd2vuy.GetTotalBytes()), outABGR(fdABGR.GetTotalBytes()), oneABGR(fdABGR.GetTotalBytes());
+		FillPseudoRandom (v210, 3);
+		uint64_t	startUS (AJATime::GetSystemMicroseconds());
+		for (ULWord row(0);  row < fdV210.GetRasterHeight();  row++)
+			::ConvertLine_v210_to_2vuy (reinterpret_cast<const ULWord*>(fdV210.GetRowAddress(v210.GetHostPointer(), row)),
+										reinterpret_cast<UByte*>(fd2vuy.GetWriteableRowAddress(ref2vuy.GetHostPointer(), row)), fdV210.GetRasterWidth());
+		const uint64_t	lineUS (AJATime::GetSystemMicroseconds() - startUS);
+
+		NTV2FrameConverter	conv;
+		CHECK(conv.ConvertFrame(v210, fdV210, out2vuy, fd2vuy));
+		CHECK(out2vuy.IsContentEqual(ref2vuy));
+		const NTV2FrameConverter::Stats	fastStats (conv.getLastStats());
+		CHECK(conv.ConvertFrame(v210, fdV210, outABGR, fdABGR));
+		const NTV2FrameConverter::Stats	genStats (conv.getLastStats());
+		CHECK(conv.setMaxThreads(1).ConvertFrame(v210, fdV210, oneABGR, fdABGR));
+		CHECK_EQ(conv.getLastStats().fNumWorkers, 1);
+		CHECK(outABGR.IsContentEqual(oneABGR));
+		if (gVerboseOutput)
+			cout	<< "UHD v210=>2vuy: ConvertLine " << lineUS << "us, NTV2FrameConverter " << fastStats.fMicroseconds << "us ("
+					<< fastStats.fNumWorkers << " workers);  v210=>ABGR: " << genStats.fMicroseconds << "us (" << genStats.fNumWorkers
+					<< " workers), " << conv.getLastStats().fMicroseconds << "us (1 worker)" << endl;
+	}	//	TEST_CASE("Performance")
+}	//	TEST_SUITE("NTV2FrameConverter")
+
+TEST_SUITE("NTV2HostCSC" * doctest::description("NTV2HostCSC tests"))
+{
+	static const NTV2ColorSpaceMatrixType	sHostCSCPresets[] = {
+		NTV2_GBRFull_to_YCbCr_Rec709_Matrix,	NTV2_GBRFull_to_YCbCr_Rec601_Matrix,	NTV2_GBRFull_to_YCbCr_Rec2020_Matrix,
+		NTV2_GBRSMPTE_to_YCbCr_Rec709_Matrix,	NTV2_GBRSMPTE_to_YCbCr_Rec601_Matrix,	NTV2_GBRSMPTE_to_YCbCr_Rec2020_Matrix,
+		NTV2_YCbCr_to_GBRFull_Rec709_Matrix,	NTV2_YCbCr_to_GBRFull_Rec601_Matrix,	NTV2_YCbCr_to_GBRFull_Rec2020_Matrix,
+		NTV2_YCbCr_to_GBRSMPTE_Rec709_Matrix,	NTV2_YCbCr_to_GBRSMPTE_Rec601_Matrix,	NTV2_YCbCr_to_GBRSMPTE_Rec2020_Matrix};
+
+	static void FillPixels (vector<UWord> & outPixels, const ULWord inNumPixels, const UWord inBitDepth, ULWord inSeed)
+	{
+		outPixels.resize(inNumPixels * 4);
+		for (size_t ndx(0);  ndx < outPixels.size();  ndx++)
+			outPixels[ndx] = UWord((NextPseudoRandom(inSeed) >> 8) & ((1 << inBitDepth) - 1));
+	}
+
+	//	Models the hardware:  8.24 truncated coefficients, exact arithmetic, rounded and clamped result
+	static UWord HardwareModel (const CNTV2CSCMatrix & inMatrix, const UWord * pInPixel, const int inRow, const UWord inBitDepth)
+	{
+		const double	scale (double(1 << inBitDepth) / 65536.0);
+		double			result (double(inMatrix.GetOffset(NTV2CSCOffsetIndex(NTV2CSCOffsetIndex_PostA + inRow))) * 2.0 * scale);
+		for (int col(0);  col < 3;  col++)
+		{
+			const double	coeff (double(LWord(inMatrix.GetCoefficient(NTV2CSCCoeffIndex(inRow * 3 + col)) * double(1 << 24))) / double(1 << 24));
+			const double	pre (double(inMatrix.GetOffset(NTV2CSCOffsetIndex(NTV2CSCOffsetIndex_Pre0 + col))) * 2.0 * scale);
+			result += coeff * (double(pInPixel[col]) - pre);
+		}
+		result = floor(result + 0.5);
+		const double	maxVal (double((1 << inBitDepth) - 1));
+		return UWord(result < 0.0 ? 0.0 : (result > maxVal ? maxVal : result));
+	}
+
+	TEST_CASE("Matrix Selection")
+	{
+		CHECK_EQ(NTV2HostCSC::GetMatrixType(true, NTV2_HOSTCSC_AUTO, false, 720), NTV2_YCbCr_to_GBRFull_Rec601_Matrix);
+		CHECK_EQ(NTV2HostCSC::GetMatrixType(true, NTV2_HOSTCSC_AUTO, false, 1920), NTV2_YCbCr_to_GBRFull_Rec709_Matrix);
+		CHECK_EQ(NTV2HostCSC::GetMatrixType(false, NTV2_HOSTCSC_REC2020, true), NTV2_GBRSMPTE_to_YCbCr_Rec2020_Matrix);
+		CHECK_EQ(NTV2HostCSC::GetMatrixType(true, NTV2_HOSTCSC_REC2020, false), NTV2_YCbCr_to_GBRFull_Rec2020_Matrix);
+		CHECK_EQ(NTV2HostCSC::GetMatrixType(false, NTV2_HOSTCSC_REC601, false), NTV2_GBRFull_to_YCbCr_Rec601_Matrix);
+
+		//	Enhanced CSC and preset construction must quantize identically...
+		CNTV2EnhancedCSC	enhCSC;
+		enhCSC.Matrix().InitMatrix(NTV2_YCbCr_to_GBRSMPTE_Rec2020_Matrix);
+		const NTV2HostCSC	fromEnh (enhCSC),  fromPreset (NTV2_YCbCr_to_GBRSMPTE_Rec2020_Matrix);
+		for (int ndx(0);  ndx < 9;  ndx++)
+			CHECK_EQ(fromEnh.GetFixedCoefficient(NTV2CSCCoeffIndex(ndx)), fromPreset.GetFixedCoefficient(NTV2CSCCoeffIndex(ndx)));
+		for (int ndx(0);  ndx < 6;  ndx++)
+			CHECK_EQ(fromEnh.GetOffset16(NTV2CSCOffsetIndex(ndx)), fromPreset.GetOffset16(NTV2CSCOffsetIndex(ndx)));
+
+		//	Bad parameters...
+		UWord	pixel[4] = {0, 0, 0, 0};
+		CHECK_FALSE(fromPreset.ConvertLine(AJA_NULL, pixel, 1, 10));
+		CHECK_FALSE(fromPreset.ConvertLine(pixel, pixel, 1, 7));
+		CHECK_FALSE(fromPreset.ConvertLine(pixel, pixel, 1, 17));
+	}	//	TEST_CASE("Matrix Selection")
+
+	TEST_CASE("Matches Hardware Model")
+	{	//	SIMD and scalar kernels must agree exactly, and be within 1 LSB of the hardware model
+		static const UWord	sDepths[] = {8, 10, 12};
+		const ULWord		numPixels (1023);	//	Not a multiple of 4, to exercise the scalar tail
+		for (size_t m(0);  m < sizeof(sHostCSCPresets) / sizeof(sHostCSCPresets[0]);  m++)
+			for (size_t d(0);  d < sizeof(sDepths) / sizeof(sDepths[0]);  d++)
+			{
+				const CNTV2CSCMatrix	matrix (sHostCSCPresets[m]);
+				NTV2HostCSC				csc (matrix);
+				const UWord				depth (sDepths[d]);
+				vector<UWord>			in, outSIMD(numPixels * 4), outScalar(numPixels * 4);
+				FillPixels (in, numPixels, depth, ULWord(m * 16 + d + 1));
+				CHECK(csc.setUseSIMD(true).ConvertLine(&in[0], &outSIMD[0], numPixels, depth));
+				CHECK(csc.setUseSIMD(false).ConvertLine(&in[0], &outScalar[0], numPixels, depth));
+				CHECK(outSIMD == outScalar);
+				int	maxDiff(0);
+				for (ULWord px(0);  px < numPixels;  px++)
+				{
+					for (int row(0);  row < 3;  row++)
+					{
+						const int diff (int(outSIMD[px * 4 + row]) - int(HardwareModel(matrix, &in[px * 4], row, depth)));
+						if ((diff < 0 ? -diff : diff) > maxDiff)
+							maxDiff = diff < 0 ? -diff : diff;
+					}
+					CHECK_EQ(outSIMD[px * 4 + 3], in[px * 4 + 3]);	//	Alpha passes through
+				}
+				CHECK_LE(maxDiff, 1);
+			}
+
+		//	In-place conversion must match out-of-place...
+		NTV2HostCSC		csc (NTV2_YCbCr_to_GBRFull_Rec709_Matrix);
+		vector<UWord>	in, out(64 * 4);
+		FillPixels (in, 64, 10, 77);
+		CHECK(csc.ConvertLine(&in[0], &out[0], 64, 10));
+		CHECK(csc.ConvertLine(&in[0], &in[0], 64, 10));
+		CHECK(in == out);
+
+		//	16-bit samples are processed at 14-bit precision (two LS bits ignored on input, zero on output)...
+		FillPixels (in, 64, 16, 99);
+		CHECK(csc.ConvertLine(&in[0], &out[0], 64, 16));
+		const CNTV2CSCMatrix	matrix (NTV2_YCbCr_to_GBRFull_Rec709_Matrix);
+		for (ULWord px(0);  px < 64;  px++)
+			for (int row(0);  row < 3;  row++)
+			{
+				const UWord	truncated[4] = {UWord(in[px*4] & ~3), UWord(in[px*4+1] & ~3), UWord(in[px*4+2] & ~3), 0};
+				const int diff (int(out[px * 4 + row]) - int(HardwareModel(matrix, truncated, row, 16)));
+				CHECK_LE((diff < 0 ? -diff : diff), 6);
+				CHECK_EQ(out[px * 4 + row] & 3, 0);
+			}
+	}	//	TEST_CASE("Matches Hardware Model")
+
+	TEST_CASE("Performance" * doctest::skip())
+	{	//	Compare the vectorized kernel against the scalar kernel on a UHD frame's worth of 10-bit pixels
+		const ULWord	width (3840),  height (2160);
+		NTV2HostCSC		csc (NTV2_YCbCr_to_GBRFull_Rec2020_Matrix);
+		vector<UWord>	in, out(width * 4);
+		FillPixels (in, width, 10, 5);
+		uint64_t	startUS (AJATime::GetSystemMicroseconds());
+		for (ULWord row(0);  row < height;  row++)
+			csc.setUseSIMD(false).ConvertLine(&in[0], &out[0], width, 10);
+		const uint64_t	scalarUS (AJATime::GetSystemMicroseconds() - startUS);
+		startUS = AJATime::GetSystemMicroseconds();
+		for (ULWord row(0);  row < height;  row++)
+			csc.setUseSIMD(true).ConvertLine(&in[0], &out[0], width, 10);
+		const uint64_t	simdUS (AJATime::GetSystemMicroseconds() - startUS);
+		if (gVerboseOutput)
+			cout	<< "UHD 10-bit YCbCr=>RGB Rec2020: scalar " << scalarUS << "us, "
+					<< (NTV2HostCSC::IsSIMDAvailable() ? "SIMD " : "SIMD (unavailable) ") << simdUS << "us" << endl;
+	}	//	TEST_CASE("Performance")
+}	//	TEST_SUITE("NTV2HostCSC")
+
+TEST_SUITE("NTV2RasterLayout" * doctest::description("NTV2RasterLayout tests"))
+{
+	TEST_CASE("Layout Semantics")
+	{	//	Tag each ABGR pixel with its coordinates, then check where each one lands
+		const NTV2FormatDesc	fd (NTV2_STANDARD_3840x2160p, NTV2_FBF_ABGR);
+		const ULWord			width (fd.GetRasterWidth()),  height (fd.GetFullRasterHeight()),  subW (width / 2),  subH (height / 2);
+		NTV2Buffer	full (fd.GetTotalBytes()),  quads (fd.GetTotalBytes()),  tsi (fd.GetTotalBytes());
+		ULWord *	pFull (reinterpret_cast<ULWord*>(full.GetHostPointer()));
+		for (ULWord y(0);  y < height;  y++)
+			for (ULWord x(0);  x < width;  x++)
+				pFull[y * width + x] = (y << 16) | x;
+		CHECK(NTV2RasterLayoutIsSupported(fd, NTV2_RASTER_LAYOUT_TSI));
+		CHECK(NTV2ConvertRasterLayout(full, NTV2_RASTER_LAYOUT_FULL, quads, NTV2_RASTER_LAYOUT_QUADRANTS, fd));
+		CHECK(NTV2ConvertRasterLayout(full, NTV2_RASTER_LAYOUT_FULL, tsi, NTV2_RASTER_LAYOUT_TSI, fd));
+		const ULWord *	pQuads (reinterpret_cast<const ULWord*>(quads.GetHostPointer()));
+		const ULWord *	pTSI (reinterpret_cast<const ULWord*>(tsi.GetHostPointer()));
+		ULWord	quadErrs(0), tsiErrs(0);
+		for (ULWord sub(0);  sub < 4;  sub++)
+			for (ULWord r(0);  r < subH;  r++)
+				for (ULWord i(0);  i < subW;  i++)
+				{
+					const ULWord	qx (i + (sub & 1) * subW),  qy (r + (sub >> 1) * subH);
+					const ULWord	tx ((i / 2) * 4 + (sub & 1) * 2 + (i & 1)),  ty (r * 2 + (sub >> 1));
+					if (pQuads[(sub * subH + r) * subW + i] != ((qy << 16) | qx))	quadErrs++;
+					if (pTSI[(sub * subH + r) * subW + i] != ((ty << 16) | tx))		tsiErrs++;
+				}
+		CHECK_EQ(quadErrs, 0);
+		CHECK_EQ(tsiErrs, 0);
+
+		//	StackQuadrants must agree...
+		NTV2Buffer	stacked (fd.GetTotalBytes());
+		::StackQuadrants (reinterpret_cast<uint8_t*>(full.GetHostPointer()), width, height, fd.GetBytesPerRow(), reinterpret_cast<uint8_t*>(stacked.GetHostPointer()));
+		CHECK(stacked.IsContentEqual(quads));
+
+		//	CopyFromQuadrant/CopyToQuadrant must agree...
+		NTV2Buffer	quadrant (fd.GetTotalBytes() / 4),  rebuilt (fd.GetTotalBytes());
+		for (ULWord quad(0);  quad < 4;  quad++)
+		{
+			::CopyFromQuadrant (reinterpret_cast<uint8_t*>(full.GetHostPointer()), height, fd.GetBytesPerRow(), quad, reinterpret_cast<uint8_t*>(quadrant.GetHostPointer()));
+			CHECK_EQ(::memcmp(quadrant.GetHostPointer(), pQuads + quad * subW * subH, quadrant.GetByteCount()), 0);
+			::CopyToQuadrant (reinterpret_cast<uint8_t*>(quadrant.GetHostPointer()), subH, fd.GetBytesPerRow() / 2, quad, reinterpret_cast<uint8_t*>(rebuilt.GetHostPointer()));
+		}
+		CHECK(rebuilt.IsContentEqual(full));
+	}	//	TEST_CASE("Layout Semantics")
+
+	TEST_CASE("Round Trips")
+	{	//	Every layout pair, out-of-place and in-place, for all TSI-capable packed formats
+		static const NTV2PixelFormat	sFormats[] = {	NTV2_FBF_10BIT_YCBCR, NTV2_FBF_8BIT_YCBCR, NTV2_FBF_ARGB, NTV2_FBF_RGBA, NTV2_FBF_10BIT_RGB,
+														NTV2_FBF_8BIT_YCBCR_YUY2, NTV2_FBF_ABGR, NTV2_FBF_10BIT_DPX, NTV2_FBF_10BIT_YCBCR_DPX,
+														NTV2_FBF_24BIT_RGB, NTV2_FBF_24BIT_BGR, NTV2_FBF_10BIT_YCBCRA, NTV2_FBF_10BIT_DPX_LE,
+														NTV2_FBF_48BIT_RGB, NTV2_FBF_12BIT_RGB_PACKED, NTV2_FBF_10BIT_RGB_PACKED,
+														NTV2_FBF_10BIT_ARGB, NTV2_FBF_16BIT_ARGB};
+		static const NTV2Standard		sStandards[] = {NTV2_STANDARD_3840x2160p, NTV2_STANDARD_4096x2160p};
+		for (size_t f(0);  f < sizeof(sFormats) / sizeof(sFormats[0]);  f++)
+			for (size_t s(0);  s < sizeof(sStandards) / sizeof(sStandards[0]);  s++)
+			{
+				const NTV2FormatDesc	fd (sStandards[s], sFormats[f]);
+				INFO(::NTV2FrameBufferFormatToString(sFormats[f], true) << " " << ::NTV2StandardToString(sStandards[s]));
+				REQUIRE(NTV2RasterLayoutIsSupported(fd, NTV2_RASTER_LAYOUT_TSI));
+				NTV2Buffer	full (fd.GetTotalBytes());
+				FillPseudoRandom (full, ULWord(f * 8 + s + 1), sFormats[f]);
+				for (int from(NTV2_RASTER_LAYOUT_FULL);  from < NTV2_RASTER_LAYOUT_INVALID;  from++)
+					for (int to(NTV2_RASTER_LAYOUT_FULL);  to < NTV2_RASTER_LAYOUT_INVALID;  to++)
+					{
+						NTV2Buffer	src (fd.GetTotalBytes()),  dst (fd.GetTotalBytes()),  back (fd.GetTotalBytes());
+						CHECK(NTV2ConvertRasterLayout(full, NTV2_RASTER_LAYOUT_FULL, src, NTV2RasterLayout(from), fd));
+						CHECK(NTV2ConvertRasterLayout(src, NTV2RasterLayout(from), dst, NTV2RasterLayout(to), fd));
+						CHECK(NTV2ConvertRasterLayout(dst, NTV2RasterLayout(to), back, NTV2_RASTER_LAYOUT_FULL, fd));
+						CHECK(back.IsContentEqual(full));
+						CHECK(NTV2ConvertRasterLayoutInPlace(src, NTV2RasterLayout(from), NTV2RasterLayout(to), fd));
+						CHECK(src.IsContentEqual(dst));
+					}
+			}
+		//	Planar formats can't be split into quadrants or TSI...
+		CHECK_FALSE(NTV2RasterLayoutIsSupported(NTV2FormatDesc(NTV2_STANDARD_3840x2160p, NTV2_FBF_8BIT_YCBCR_420PL2), NTV2_RASTER_LAYOUT_QUADRANTS));
+	}	//	TEST_CASE("Round Trips")
+
+	TEST_CASE("v210 TSI")
+	{	//	Splitting 'v210' pairs must match splitting the equivalent '2vuy' raster
+		const NTV2FormatDesc	fdV210 (NTV2_STANDARD_3840x2160p, NTV2_FBF_10BIT_YCBCR),  fd2vuy (NTV2_STANDARD_3840x2160p, NTV2_FBF_8BIT_YCBCR);
+		NTV2Buffer	v210 (fdV210.GetTotalBytes()),  v210TSI (fdV210.GetTotalBytes()),  yuv (fd2vuy.GetTotalBytes()),  yuvTSI (fd2vuy.GetTotalBytes());
+		FillPseudoRandom (v210, 42, NTV2_FBF_10BIT_YCBCR);
+		for (ULWord row(0);  row < fdV210.GetFullRasterHeight();  row++)
+			::ConvertLine_v210_to_2vuy (reinterpret_cast<const ULWord*>(fdV210.GetRowAddress(v210.GetHostPointer(), row)),
+										reinterpret_cast<UByte*>(fd2vuy.GetWriteableRowAddress(yuv.GetHostPointer(), row)), fdV210.GetRasterWidth());
+		CHECK(NTV2ConvertRasterLayout(v210, NTV2_RASTER_LAYOUT_FULL, v210TSI, NTV2_RASTER_LAYOUT_TSI, fdV210));
+		CHECK(NTV2ConvertRasterLayout(yuv, NTV2_RASTER_LAYOUT_FULL, yuvTSI, NTV2_RASTER_LAYOUT_TSI, fd2vuy));
+		vector<UByte>	line (fdV210.GetRasterWidth());
+		ULWord			mismatches(0);
+		const ULWord	subRows (fdV210.GetFullRasterHeight() * 2),  subWidth (fdV210.GetRasterWidth() / 2);
+		for (ULWord subRow(0);  subRow < subRows;  subRow++)	//	All four sub-images' rows, in order
+		{
+			::ConvertLine_v210_to_2vuy (reinterpret_cast<const ULWord*>(reinterpret_cast<const UByte*>(v210TSI.GetHostPointer()) + subRow * fdV210.GetBytesPerRow() / 2),
+										&line[0], subWidth);
+			if (::memcmp(&line[0], reinterpret_cast<const UByte*>(yuvTSI.GetHostPointer()) + subRow * fd2vuy.GetBytesPerRow() / 2, subWidth * 2))
+				mismatches++;
+		}
+		CHECK_EQ(mismatches, 0);
+	}	//	TEST_CASE("v210 TSI")
+
+	TEST_CASE("8K")
+	{	//	8K splits four ways into UHD sub-images
+		const NTV2FormatDesc	fd8K (NTV2_STANDARD_7680, NTV2_FBF_10BIT_YCBCR),  fdUHD (NTV2_STANDARD_3840x2160p, NTV2_FBF_10BIT_YCBCR);
+		NTV2Buffer	full (fd8K.GetTotalBytes()),  quads (fd8K.GetTotalBytes()),  tsi (fd8K.GetTotalBytes());
+		FillPseudoRandom (full, 8, NTV2_FBF_10BIT_YCBCR);
+		CHECK_EQ(fd8K.GetBytesPerRow(), fdUHD.GetBytesPerRow() * 2);
+		CHECK(NTV2ConvertRasterLayout(full, NTV2_RASTER_LAYOUT_FULL, quads, NTV2_RASTER_LAYOUT_QUADRANTS, fd8K));
+		CHECK(NTV2ConvertRasterLayout(quads, NTV2_RASTER_LAYOUT_QUADRANTS, tsi, NTV2_RASTER_LAYOUT_TSI, fd8K));
+		uint64_t	startUS (AJATime::GetSystemMicroseconds());
+		CHECK(NTV2ConvertRasterLayoutInPlace(tsi, NTV2_RASTER_LAYOUT_TSI, NTV2_RASTER_LAYOUT_FULL, fd8K));
+		const uint64_t	inPlaceUS (AJATime::GetSystemMicroseconds() - startUS);
+		CHECK(tsi.IsContentEqual(full));
+		//	Lower-right UHD quadrant is the lower-right quarter of the 8K raster...
+		const UByte *	pQuad3 (reinterpret_cast<const UByte*>(quads.GetHostPointer()) + 3 * fdUHD.GetTotalBytes());
+		for (ULWord row(0);  row < 2;  row++)
+			CHECK_EQ(::memcmp(pQuad3 + row * fdUHD.GetBytesPerRow(),
+							reinterpret_cast<const UByte*>(fd8K.GetRowAddress(full.GetHostPointer(), fdUHD.GetFullRasterHeight() + row)) + fdUHD.GetBytesPerRow(),
+							fdUHD.GetBytesPerRow()), 0);
+		if (gVerboseOutput)
+			cout << "8K v210 TSI=>full in place: " << inPlaceUS << "us" << endl;
+	}	//	TEST_CASE("8K")
+
+	TEST_CASE("Performance" * doctest::skip())
+	{	//	Compare against the original single-threaded, line-by-line quadrant copy
+		const NTV2FormatDesc	fd (NTV2_STANDARD_3840x2160p, NTV2_FBF_8BIT_YCBCR);
+		const ULWord			rowBytes (fd.GetBytesPerRow()),  halfBytes (rowBytes / 2),  subRows (fd.GetFullRasterHeight() / 2);
+		NTV2Buffer	full (fd.GetTotalBytes()),  ref (fd.GetTotalBytes()),  quads (fd.GetTotalBytes()),  tsi (fd.GetTotalBytes());
+		FillPseudoRandom (full, 3, NTV2_FBF_8BIT_YCBCR);
+		const UByte *	pSrc (reinterpret_cast<const UByte*>(full.GetHostPointer()));
+		UByte *			pRef (reinterpret_cast<UByte*>(ref.GetHostPointer()));
+		uint64_t	startUS (AJATime::GetSystemMicroseconds());
+		for (ULWord quad(0);  quad < 4;  quad++)
+			for (ULWord row(0);  row < subRows;  row++)
+				::memcpy (pRef + (quad * subRows + row) * halfBytes,
+						pSrc + ((quad >> 1) * subRows + row) * rowBytes + (quad & 1) * halfBytes, halfBytes);
+		const uint64_t	serialUS (AJATime::GetSystemMicroseconds() - startUS);
+		startUS = AJATime::GetSystemMicroseconds();
+		CHECK(NTV2ConvertRasterLayout(full, NTV2_RASTER_LAYOUT_FULL, quads, NTV2_RASTER_LAYOUT_QUADRANTS, fd));
+		const uint64_t	quadUS (AJATime::GetSystemMicroseconds() - startUS);
+		CHECK(quads.IsContentEqual(ref));
+		startUS = AJATime::GetSystemMicroseconds();
+		CHECK(NTV2ConvertRasterLayout(full, NTV2_RASTER_LAYOUT_FULL, tsi, NTV2_RASTER_LAYOUT_TSI, fd));
+		const uint64_t	tsiUS (AJATime::GetSystemMicroseconds() - startUS);
+		if (gVerboseOutput)
+			cout	<< "UHD 2vuy: serial quadrants " << serialUS << "us, parallel quadrants " << quadUS << "us, parallel TSI "
+					<< tsiUS << "us (" << NTV2ParallelRowsMaxWorkers() << " workers)" << endl;
+	}	//	TEST_CASE("Performance")
+}	//	TEST_SUITE("NTV2RasterLayout")
+
+TEST_SUITE("NTV2Scaler" * doctest::description("NTV2Scaler tests"))
+{
+	static void FillConstant (NTV2Buffer & inBuffer, const NTV2PixelFormat inPixelFormat)
+	{	//	Same value in every pixel
+		ULWord * pWords (reinterpret_cast<ULWord*>(inBuffer.GetHostPointer()));
+		for (ULWord ndx(0);  ndx < inBuffer.GetByteCount() / 4;  ndx++)
+			pWords[ndx] = inPixelFormat == NTV2_FBF_10BIT_YCBCR ? 0x1E0781E0 : 0x80408040;	//	All components 0x1E0, or Y=0x80 Cb=Cr=0x40
+	}
+
+	TEST_CASE("Identity")
+	{	//	Same-size scaling is exact
+		static const NTV2PixelFormat	sFormats[] = {NTV2_FBF_8BIT_YCBCR, NTV2_FBF_8BIT_YCBCR_YUY2, NTV2_FBF_10BIT_YCBCR, NTV2_FBF_RGBA, NTV2_FBF_ABGR};
+		for (size_t f(0);  f < sizeof(sFormats) / sizeof(sFormats[0]);  f++)
+		{
+			CHECK(NTV2Scaler::IsSupportedPixelFormat(sFormats[f]));
+			const NTV2FormatDesc	fd (NTV2_STANDARD_1080p, sFormats[f]);
+			NTV2Buffer				src (fd.GetTotalBytes()),  dst (fd.GetTotalBytes());
+			FillPseudoRandom (src, ULWord(f + 1), sFormats[f]);
+			NTV2Scaler	scaler;
+			INFO(::NTV2FrameBufferFormatToString(sFormats[f], true));
+			CHECK(scaler.ScaleFrame(src, fd, dst, fd));
+			CHECK(dst.IsContentEqual(src));
+			CHECK(scaler.getLastStats().fTablesRebuilt);
+			CHECK(scaler.setUseSIMD(false).ScaleFrame(src, fd, dst, fd));
+			CHECK(dst.IsContentEqual(src));
+			CHECK_FALSE(scaler.getLastStats().fTablesRebuilt);	//	Same geometry reuses the tables
+		}
+		CHECK_FALSE(NTV2Scaler::IsSupportedPixelFormat(NTV2_FBF_10BIT_RGB));
+
+		//	Bad parameters...
+		NTV2Scaler				scaler;
+		const NTV2FormatDesc	fdHD (NTV2_STANDARD_1080p, NTV2_FBF_8BIT_YCBCR),  fdRGB (NTV2_STANDARD_1080p, NTV2_FBF_RGBA);
+		NTV2Buffer				src (fdRGB.GetTotalBytes()),  dst (fdRGB.GetTotalBytes()),  small (fdHD.GetTotalBytes() / 2);
+		CHECK_FALSE(scaler.ScaleFrame(src, fdHD, dst, fdRGB));		//	Pixel format mismatch
+		CHECK_FALSE(scaler.ScaleFrame(src, fdHD, small, fdHD));	//	Destination too small
+		CHECK_FALSE(scaler.ScaleFrame(src, NTV2FormatDesc(NTV2_STANDARD_1080p, NTV2_FBF_10BIT_RGB), dst, NTV2FormatDesc(NTV2_STANDARD_1080p, NTV2_FBF_10BIT_RGB)));
+	}	//	TEST_CASE("Identity")
+
+	TEST_CASE("Flat Fields")
+	{	//	Flat fields stay flat, and SIMD matches scalar, for reductions and enlargements
+		static const NTV2PixelFormat	sFormats[] = {NTV2_FBF_8BIT_YCBCR, NTV2_FBF_10BIT_YCBCR, NTV2_FBF_RGBA};
+		const NTV2FrameSize	sizes[][2] = {	{NTV2FrameSize(7680, 4320), NTV2FrameSize(1920, 1080)},
+											{NTV2FrameSize(3840, 2160), NTV2FrameSize(960, 540)},
+											{NTV2FrameSize(1920, 1080), NTV2FrameSize(3840, 2160)}};
+		for (size_t f(0);  f < sizeof(sFormats) / sizeof(sFormats[0]);  f++)
+			for (size_t s(0);  s < sizeof(sizes) / sizeof(sizes[0]);  s++)
+			{
+				const NTV2FormatDesc	fdSrc (sizes[s][0], sFormats[f]),  fdDst (sizes[s][1], sFormats[f]);
+				INFO(::NTV2FrameBufferFormatToString(sFormats[f], true) << " " << fdSrc.GetRasterWidth() << "=>" << fdDst.GetRasterWidth());
+				NTV2Buffer	src (fdSrc.GetTotalBytes()),  flat (fdDst.GetTotalBytes()),  expected (fdDst.GetTotalBytes());
+				FillConstant (src, sFormats[f]);
+				FillConstant (expected, sFormats[f]);
+				NTV2Scaler	scaler;
+				REQUIRE(scaler.ScaleFrame(src, fdSrc, flat, fdDst));
+				CHECK(flat.IsContentEqual(expected));
+
+				NTV2Buffer	simd (fdDst.GetTotalBytes()),  scalar (fdDst.GetTotalBytes());
+				FillPseudoRandom (src, ULWord(s * 4 + f + 1), sFormats[f]);
+				CHECK(scaler.setUseSIMD(true).ScaleFrame(src, fdSrc, simd, fdDst));
+				CHECK(scaler.setUseSIMD(false).setMaxThreads(1).ScaleFrame(src, fdSrc, scalar, fdDst));
+				CHECK(simd.IsContentEqual(scalar));
+			}
+	}	//	TEST_CASE("Flat Fields")
+
+	TEST_CASE("Gradient")
+	{	//	Halving a horizontal RGBA ramp averages neighboring pixels
+		const NTV2FormatDesc	fdSrc (NTV2FrameSize(1024, 16), NTV2_FBF_RGBA),  fdDst (NTV2FrameSize(512, 8), NTV2_FBF_RGBA);
+		NTV2Buffer	src (fdSrc.GetTotalBytes()),  dst (fdDst.GetTotalBytes());
+		UByte *		pSrc (reinterpret_cast<UByte*>(src.GetHostPointer()));
+		for (ULWord y(0);  y < 16;  y++)
+			for (ULWord x(0);  x < 1024;  x++)
+				for (ULWord c(0);  c < 4;  c++)
+					pSrc[(y * 1024 + x) * 4 + c] = UByte(c == 3 ? 255 : x / 4);
+		NTV2Scaler	scaler;
+		REQUIRE(scaler.ScaleFrame(src, fdSrc, dst, fdDst));
+		const UByte *	pDst (reinterpret_cast<const UByte*>(dst.GetHostPointer()));
+		int	maxDiff(0);
+		for (ULWord y(0);  y < 8;  y++)
+			for (ULWord x(4);  x < 508;  x++)	//	Ignore the edges
+			{
+				const int	diff (int(pDst[(y * 512 + x) * 4]) - int((2 * x + 0.5) / 4));
+				maxDiff = diff < 0 ? (-diff > maxDiff ? -diff : maxDiff) : (diff > maxDiff ? diff : maxDiff);
+				CHECK_EQ(pDst[(y * 512 + x) * 4 + 3], 255);
+			}
+		CHECK_LE(maxDiff, 1);
+	}	//	TEST_CASE("Gradient")
+
+	TEST_CASE("Performance" * doctest::skip())
+	{	//	Compare against the original line resampler, and the scalar filter loops
+		const NTV2FormatDesc	fdSrc (NTV2_STANDARD_3840x2160p, NTV2_FBF_RGBA),  fdDst (NTV2FrameSize(960, 540), NTV2_FBF_RGBA);
+		NTV2Buffer	src (fdSrc.GetTotalBytes()),  dst (fdDst.GetTotalBytes()),  tmp (fdDst.GetRasterWidth() * fdSrc.GetVisibleRasterHeight() * 4);
+		FillPseudoRandom (src, 7, NTV2_FBF_RGBA);
+		const RGBAlphaPixel *	pSrc (reinterpret_cast<const RGBAlphaPixel*>(src.GetHostPointer()));
+		RGBAlphaPixel *			pTmp (reinterpret_cast<RGBAlphaPixel*>(tmp.GetHostPointer()));
+		vector<RGBAlphaPixel>	line (3840 + 3);	//	ReSampleLine needs 1 extra pixel before, and 2 after
+		uint64_t	startUS (AJATime::GetSystemMicroseconds());
+		for (ULWord row(0);  row < fdSrc.GetVisibleRasterHeight();  row += 4)	//	Horizontal only, and only every 4th row
+		{
+			::memcpy (&line[1], pSrc + row * 3840, 3840 * sizeof(RGBAlphaPixel));
+			::ReSampleLine (&line[1], pTmp + row / 4 * 960, 0, 3840, 3840, 960);
+		}
+		const uint64_t	resampleUS (AJATime::GetSystemMicroseconds() - startUS);
+		NTV2Scaler	scaler;
+		CHECK(scaler.ScaleFrame(src, fdSrc, dst, fdDst));
+		const uint64_t	firstUS (scaler.getLastStats().fMicroseconds);
+		CHECK(scaler.ScaleFrame(src, fdSrc, dst, fdDst));
+		const uint64_t	simdUS (scaler.getLastStats().fMicroseconds);
+		CHECK(scaler.setUseSIMD(false).ScaleFrame(src, fdSrc, dst, fdDst));
+		const uint64_t	scalarUS (scaler.getLastStats().fMicroseconds);
+		if (gVerboseOutput)
+			cout	<< "UHD=>960x540 RGBA: ReSampleLine (1/4 rows, horz only) " << resampleUS << "us, NTV2Scaler first " << firstUS
+					<< "us, SIMD " << simdUS << "us, scalar " << scalarUS << "us, " << scaler.getLastStats().fHorzTaps << "x"
+					<< scaler.getLastStats().fVertTaps << " taps, " << scaler.getLastStats().fNumWorkers << " workers" << endl;
+	}	//	TEST_CASE("Performance")
+}	//	TEST_SUITE("NTV2Scaler")
+
+TEST_SUITE("NTV2PreviewCompositor" * doctest::description("NTV2PreviewCompositor tests"))
+{
+	static ULWord MosaicPixel (const NTV2Buffer & inMosaic, const NTV2FormatDesc & inDesc, const ULWord inX, const ULWord inY)
+	{
+		return reinterpret_cast<const ULWord*>(inDesc.GetRowAddress(inMosaic.GetHostPointer(), inY))[inX];
+	}
+
+	TEST_CASE("Flat Tiles")
+	{	//	Flat sources produce flat tiles that match NTV2FrameConverter's conversion of the same pixel
+		const NTV2FormatDesc	fdMosaic (NTV2FrameSize(640, 360), NTV2_FBF_RGBA);
+		const NTV2FormatDesc	fdSrc[4] = {NTV2FormatDesc(NTV2_STANDARD_1080p, NTV2_FBF_8BIT_YCBCR),
+											NTV2FormatDesc(NTV2_STANDARD_3840x2160p, NTV2_FBF_10BIT_YCBCR),
+											NTV2FormatDesc(NTV2_STANDARD_720, NTV2_FBF_RGBA),
+											NTV2FormatDesc(NTV2FrameSize(160, 90), NTV2_FBF_8BIT_YCBCR_YUY2)};	//	Enlarged
+		const ULWord			sWords[4] = {0xEB80EB80, 0x1E0781E0, 0xFF336699, 0x40604060};
+		NTV2Buffer	mosaic (fdMosaic.GetTotalBytes()),  src[4];
+		NTV2PreviewCompositor	compositor;
+		CHECK_FALSE(compositor.Composite(mosaic, fdMosaic));	//	No layout
+		CHECK_FALSE(compositor.SetLayout(0, 2));
+		CHECK_FALSE(compositor.SetLayout(9, 9));
+		CHECK(compositor.SetLayout(2, 2));
+		CHECK_EQ(compositor.getNumTiles(), 4);
+		for (UWord tile(0);  tile < 4;  tile++)
+		{
+			src[tile].Allocate(fdSrc[tile].GetTotalBytes());
+			ULWord * pWords (reinterpret_cast<ULWord*>(src[tile].GetHostPointer()));
+			for (ULWord ndx(0);  ndx < src[tile].GetByteCount() / 4;  ndx++)
+				pWords[ndx] = sWords[tile];
+			CHECK(compositor.SetTileFrame(tile, src[tile], fdSrc[tile]));
+		}
+		CHECK_FALSE(compositor.SetTileFrame(4, src[0], fdSrc[0]));		//	No such tile
+		CHECK_FALSE(compositor.SetTileFrame(0, src[3], fdSrc[0]));		//	Frame too small
+		CHECK_FALSE(compositor.Composite(mosaic, NTV2FormatDesc(NTV2FrameSize(640, 360), NTV2_FBF_8BIT_YCBCR)));	//	Not RGB
+
+		CHECK(compositor.Composite(mosaic, fdMosaic));
+		CHECK_EQ(compositor.getLastStats().fTilesRendered, 4);
+		CHECK_EQ(compositor.getLastStats().fTilesCleared, 0);
+		NTV2FrameConverter	converter;
+		converter.setUseFastPaths(false);	//	Some fast paths truncate
+		for (UWord tile(0);  tile < 4;  tile++)
+		{
+			ULWord	expected[12];
+			converter.setMatrixStandard(fdSrc[tile].GetRasterWidth() < 1280 ? NTV2_HOSTCSC_REC601 : NTV2_HOSTCSC_REC709);	//	Same as the source frame
+			CHECK(converter.ConvertLine(src[tile].GetHostPointer(), fdSrc[tile].GetPixelFormat(), expected, NTV2_FBF_RGBA, 12));
+			const ULWord	x0 ((tile % 2) * 320),  y0 ((tile / 2) * 180);
+			INFO("tile " << tile << " " << ::NTV2FrameBufferFormatToString(fdSrc[tile].GetPixelFormat(), true));
+			for (ULWord y(y0);  y < y0 + 180;  y += 7)
+				for (ULWord x(x0);  x < x0 + 320;  x += 3)
+					if (MosaicPixel(mosaic, fdMosaic, x, y) != expected[0])
+						{CHECK_EQ(MosaicPixel(mosaic, fdMosaic, x, y), expected[0]);  x = x0 + 320;  y = y0 + 180;}
+		}
+
+		//	Cleared tiles go black, and are the only tiles touched...
+		CHECK(compositor.ClearTile(1));
+		CHECK(compositor.Composite(mosaic, fdMosaic));
+		CHECK_EQ(compositor.getLastStats().fTilesRendered, 0);
+		CHECK_EQ(compositor.getLastStats().fTilesCleared, 1);
+		const UWord		blackPixel[4] = {0, 0, 0, 0xFFFF};
+		ULWord			black (0);
+		CHECK(NTV2FrameConverter::PackPixels(blackPixel, &black, NTV2FormatDesc(NTV2FrameSize(1, 1), NTV2_FBF_RGBA), 0, 0, 1));
+		CHECK_EQ(MosaicPixel(mosaic, fdMosaic, 400, 10), black);
+		CHECK_NE(MosaicPixel(mosaic, fdMosaic, 10, 10), black);
+		CHECK(compositor.Composite(mosaic, fdMosaic));
+		CHECK_EQ(compositor.getLastStats().fTilesCleared, 0);
+		CHECK_EQ(compositor.getLastStats().fNumWorkers, 0);	//	Nothing to do
+
+		//	Another mosaic geometry redraws everything...
+		const NTV2FormatDesc	fdSmall (NTV2FrameSize(320, 180), NTV2_FBF_ABGR);
+		NTV2Buffer				small (fdSmall.GetTotalBytes());
+		CHECK(compositor.Composite(small, fdSmall));
+		CHECK_EQ(compositor.getLastStats().fTilesRendered, 3);
+		CHECK_EQ(compositor.getLastStats().fTilesCleared, 1);
+	}	//	TEST_CASE("Flat Tiles")
+
+	TEST_CASE("Box Filter")
+	{	//	A 2:1 reduction averages each 2x2 block
+		const NTV2FormatDesc	fdSrc (NTV2FrameSize(64, 32), NTV2_FBF_RGBA),  fdMosaic (NTV2FrameSize(32, 16), NTV2_FBF_RGBA);
+		NTV2Buffer				src (fdSrc.GetTotalBytes()),  mosaic (fdMosaic.GetTotalBytes());
+		FillPseudoRandom (src, 7, NTV2_FBF_RGBA);
+		NTV2PreviewCompositor	compositor;
+		CHECK(compositor.SetLayout(1, 1));
+		CHECK(compositor.SetTileFrame(0, src, fdSrc));
+		CHECK(compositor.Composite(mosaic, fdMosaic));
+		const UByte *	pSrc (reinterpret_cast<const UByte*>(src.GetHostPointer()));
+		const UByte *	pDst (reinterpret_cast<const UByte*>(mosaic.GetHostPointer()));
+		int	maxDiff (0);
+		for (ULWord y(0);  y < 16;  y++)
+			for (ULWord x(0);  x < 32;  x++)
+				for (ULWord c(0);  c < 3;  c++)
+				{
+					const ULWord	rowBytes (fdSrc.GetBytesPerRow());
+					const int		sum (pSrc[2*y*rowBytes + 8*x + c] + pSrc[2*y*rowBytes + 8*x + 4 + c]
+										+ pSrc[(2*y+1)*rowBytes + 8*x + c] + pSrc[(2*y+1)*rowBytes + 8*x + 4 + c]);
+					const int		diff (int(pDst[y * fdMosaic.GetBytesPerRow() + 4*x + c]) - (sum + 2) / 4);
+					maxDiff = diff < 0 ? (-diff > maxDiff ? -diff : maxDiff) : (diff > maxDiff ? diff : maxDiff);
+				}
+		CHECK_LE(maxDiff, 1);
+	}	//	TEST_CASE("Box Filter")
+
+	TEST_CASE("SIMD Matches Scalar")
+	{
+		static const NTV2PixelFormat	sFormats[] = {NTV2_FBF_8BIT_YCBCR, NTV2_FBF_10BIT_YCBCR, NTV2_FBF_ABGR, NTV2_FBF_8BIT_YCBCR_420PL2};
+		const NTV2FormatDesc	fdMosaic (NTV2FrameSize(1282, 722), NTV2_FBF_ARGB);	//	Odd tile sizes
+		NTV2Buffer				mosaic1 (fdMosaic.GetTotalBytes()),  mosaic2 (fdMosaic.GetTotalBytes()),  src[4];
+		NTV2PreviewCompositor	compositor;
+		CHECK(compositor.SetLayout(2, 2));
+		for (UWord tile(0);  tile < 4;  tile++)
+		{
+			const NTV2FormatDesc	fd (tile == 1 ? NTV2_STANDARD_3840x2160p : NTV2_STANDARD_1080p, sFormats[tile]);
+			src[tile].Allocate(fd.GetTotalBytes());
+			FillPseudoRandom (src[tile], ULWord(tile + 1), sFormats[tile]);
+			CHECK(compositor.SetTileFrame(tile, src[tile], fd));
+		}
+		CHECK(compositor.Composite(mosaic1, fdMosaic));
+		compositor.setUseSIMD(false).Invalidate();
+		CHECK(compositor.Composite(mosaic2, fdMosaic));
+		CHECK_EQ(compositor.getLastStats().fTilesRendered, 4);
+		CHECK(mosaic1.IsContentEqual(mosaic2));
+	}	//	TEST_CASE("SIMD Matches Scalar")
+
+	TEST_CASE("Tile Intervals")
+	{
+		const NTV2FormatDesc	fdSrc (NTV2_STANDARD_1080p, NTV2_FBF_8BIT_YCBCR),  fdMosaic (NTV2FrameSize(640, 360), NTV2_FBF_RGBA);
+		NTV2Buffer				src (fdSrc.GetTotalBytes()),  mosaic (fdMosaic.GetTotalBytes());
+		FillPseudoRandom (src, 3, NTV2_FBF_8BIT_YCBCR);
+		NTV2PreviewCompositor	compositor;
+		CHECK(compositor.SetLayout(2, 1));
+		compositor.setTileInterval(0, 3).setTileInterval(1, 0);
+		CHECK_EQ(compositor.getTileInterval(0), 3);
+		CHECK_EQ(compositor.getTileInterval(1), 1);		//	Zero ignored
+		CHECK_EQ(compositor.getTileInterval(2), 0);		//	No such tile
+		ULWord	rendered[2] = {0, 0};
+		for (ULWord frame(0);  frame < 9;  frame++)
+		{
+			CHECK(compositor.SetTileFrame(0, src, fdSrc));
+			CHECK(compositor.SetTileFrame(1, src, fdSrc));
+			CHECK(compositor.Composite(mosaic, fdMosaic));
+			rendered[0] += compositor.getLastStats().fTilesRendered;
+			if (frame)
+				CHECK_EQ(compositor.getLastStats().fTilesSkipped + compositor.getLastStats().fTilesRendered, 2);
+		}
+		CHECK_EQ(rendered[0], 9 + 3);	//	Tile 1 every frame, tile 0 on frames 0 (to fill the new mosaic), 3 and 6
+
+		//	An impossible time budget slows the tiles down, up to kMaxInterval...
+		compositor.setTimeBudget(1);
+		for (ULWord frame(0);  frame < 20;  frame++)
+		{
+			CHECK(compositor.SetTileFrame(0, src, fdSrc));
+			CHECK(compositor.SetTileFrame(1, src, fdSrc));
+			CHECK(compositor.Composite(mosaic, fdMosaic));
+		}
+		CHECK_GT(compositor.getTileInterval(1), 1);
+		CHECK_LE(compositor.getTileInterval(0), ULWord(NTV2PreviewCompositor::kMaxInterval));
+		//	...and a generous one speeds them back up...
+		compositor.setTimeBudget(10000000);
+		for (ULWord frame(0);  frame < 200;  frame++)
+		{
+			CHECK(compositor.SetTileFrame(0, src, fdSrc));
+			CHECK(compositor.SetTileFrame(1, src, fdSrc));
+			CHECK(compositor.Composite(mosaic, fdMosaic));
+		}
+		CHECK_EQ(compositor.getTileInterval(0), 1);
+		CHECK_EQ(compositor.getTileInterval(1), 1);
+	}	//	TEST_CASE("Tile Intervals")
+
+	TEST_CASE("Performance" * doctest::skip())
+	{	//	Four HD inputs into an HD preview mosaic
+		const NTV2FormatDesc	fdSrc (NTV2_STANDARD_1080p, NTV2_FBF_10BIT_YCBCR),  fdMosaic (NTV2_STANDARD_1080p, NTV2_FBF_RGBA);
+		NTV2Buffer				src (fdSrc.GetTotalBytes()),  mosaic (fdMosaic.GetTotalBytes()),  full (fdMosaic.GetTotalBytes());
+		FillPseudoRandom (src, 5, NTV2_FBF_10BIT_YCBCR);
+		NTV2PreviewCompositor	compositor;
+		CHECK(compositor.SetLayout(2, 2));
+		uint64_t	compositeUS (0);
+		for (ULWord frame(0);  frame < 10;  frame++)
+		{
+			for (UWord tile(0);  tile < 4;  tile++)
+				CHECK(compositor.SetTileFrame(tile, src, fdSrc));
+			CHECK(compositor.Composite(mosaic, fdMosaic));
+			compositeUS += compositor.getLastStats().fMicroseconds;
+		}
+		//	Compare with converting each full frame to RGBA (what each preview used to do)...
+		NTV2FrameConverter	converter;
+		uint64_t	convertUS (0);
+		for (ULWord frame(0);  frame < 10;  frame++)
+			for (UWord tile(0);  tile < 4;  tile++)
+			{
+				CHECK(converter.ConvertFrame(src, fdSrc, full, fdMosaic));
+				convertUS += converter.getLastStats().fMicroseconds;
+			}
+		if (gVerboseOutput)
+			cout << "NTV2PreviewCompositor: 4x 1080p 'v210' to 1080p RGBA mosaic: " << DEC(compositeUS / 10) << "us/frame ("
+				<< DEC(compositor.getLastStats().fNumWorkers) << " workers), vs " << DEC(convertUS / 10) << "us to convert 4 full frames" << endl;
+	}	//	TEST_CASE("Performance")
+}	//	TEST_SUITE("NTV2PreviewCompositor")
+
+TEST_SUITE("NTV2Deinterlacer" * doctest::description("NTV2Deinterlacer tests"))
+{
+	TEST_CASE("Bob & Blend")
+	{	//	Check 8-bit results against the field interpolation/vertical filter definitions
+		const NTV2FormatDesc	fd (NTV2_STANDARD_1080, NTV2_FBF_8BIT_YCBCR);
+		const ULWord			rowBytes (fd.GetBytesPerRow()),  numRows (fd.GetVisibleRasterHeight());
+		NTV2Buffer				src (fd.GetTotalBytes()),  dst (fd.GetTotalBytes());
+		FillPseudoRandom (src, 1, NTV2_FBF_8BIT_YCBCR);
+		const UByte *	pSrc (reinterpret_cast<const UByte*>(src.GetHostPointer()));
+		const UByte *	pDst (reinterpret_cast<const UByte*>(dst.GetHostPointer()));
+		NTV2Deinterlacer	deinterlacer (NTV2_DEINTERLACE_BOB);
+		for (int field(NTV2_FIELD0);  field <= NTV2_FIELD1;  field++)
+		{
+			CHECK(deinterlacer.setField(NTV2FieldID(field)).DeinterlaceFrame(src, dst, fd));
+			ULWord	errors(0);
+			for (ULWord row(0);  row < numRows;  row++)
+				for (ULWord ndx(0);  ndx < rowBytes;  ndx++)
+				{
+					const ULWord	above (row ? row - 1 : 1),  below (row + 1 < numRows ? row + 1 : row - 1);
+					const UByte		expected ((row & 1) == ULWord(field)  ?  pSrc[row * rowBytes + ndx]
+												:  UByte((pSrc[above * rowBytes + ndx] + pSrc[below * rowBytes + ndx] + 1) / 2));
+					if (pDst[row * rowBytes + ndx] != expected)
+						errors++;
+				}
+			CHECK_EQ(errors, 0);
+		}
+
+		CHECK(deinterlacer.setMode(NTV2_DEINTERLACE_BLEND).DeinterlaceFrame(src, dst, fd));
+		ULWord	errors(0);
+		for (ULWord row(0);  row < numRows;  row++)
+			for (ULWord ndx(0);  ndx < rowBytes;  ndx++)
+			{
+				const ULWord	above (row ? row - 1 : 0),  below (row + 1 < numRows ? row + 1 : row);
+				if (pDst[row * rowBytes + ndx] != UByte((pSrc[above * rowBytes + ndx] + 2 * pSrc[row * rowBytes + ndx] + pSrc[below * rowBytes + ndx] + 2) / 4))
+					errors++;
+			}
+		CHECK_EQ(errors, 0);
+
+		//	Bad parameters...
+		NTV2Buffer	small (fd.GetTotalBytes() / 2);
+		CHECK_FALSE(deinterlacer.DeinterlaceFrame(src, small, fd));
+		CHECK_FALSE(deinterlacer.DeinterlaceFrame(src, dst, NTV2FormatDesc(NTV2_STANDARD_1080, NTV2_FBF_10BIT_RGB)));
+		CHECK_FALSE(deinterlacer.setMode(NTV2_DEINTERLACE_INVALID).DeinterlaceFrame(src, dst, fd));
+		CHECK_FALSE(NTV2Deinterlacer::IsSupportedPixelFormat(NTV2_FBF_48BIT_RGB));
+	}	//	TEST_CASE("Bob & Blend")
+
+	TEST_CASE("SIMD & In-Place")
+	{	//	SIMD must match scalar, and in-place must match out-of-place, for every mode and format
+		static const NTV2PixelFormat	sFormats[] = {NTV2_FBF_8BIT_YCBCR, NTV2_FBF_8BIT_YCBCR_YUY2, NTV2_FBF_10BIT_YCBCR, NTV2_FBF_RGBA, NTV2_FBF_ARGB, NTV2_FBF_ABGR};
+		for (size_t f(0);  f < sizeof(sFormats) / sizeof(sFormats[0]);  f++)
+			for (int mode(NTV2_DEINTERLACE_BOB);  mode < NTV2_DEINTERLACE_INVALID;  mode++)
+			{
+				INFO(::NTV2FrameBufferFormatToString(sFormats[f], true) << " mode " << mode);
+				const NTV2FormatDesc	fd (NTV2_STANDARD_525, sFormats[f]);
+				NTV2Buffer				prev (fd.GetTotalBytes()),  src (fd.GetTotalBytes()),  simd (fd.GetTotalBytes()),  scalar (fd.GetTotalBytes());
+				FillPseudoRandom (prev, ULWord(f * 8 + mode + 1), sFormats[f]);
+				src.CopyFrom(prev, 0, 0, prev.GetByteCount());
+				UByte *	pSrc (reinterpret_cast<UByte*>(src.GetHostPointer()));
+				for (ULWord ndx(0);  ndx < src.GetByteCount() / 2;  ndx += 7)	//	Change part of the frame
+					pSrc[ndx] = UByte(pSrc[ndx] ^ 0x55);
+				if (sFormats[f] == NTV2_FBF_10BIT_YCBCR)
+					for (ULWord ndx(3);  ndx < src.GetByteCount();  ndx += 4)
+						pSrc[ndx] &= 0x3F;
+				const NTV2DeinterlaceMode	dm (static_cast<NTV2DeinterlaceMode>(mode));
+				NTV2Deinterlacer	withSIMD (dm),  withoutSIMD (dm),  inPlace (dm);
+				withoutSIMD.setUseSIMD(false).setMaxThreads(1);
+				NTV2Buffer			scratch (fd.GetTotalBytes());
+				CHECK(withSIMD.DeinterlaceFrame(prev, scratch, fd));
+				CHECK(withoutSIMD.DeinterlaceFrame(prev, scratch, fd));
+				CHECK(inPlace.DeinterlaceFrame(prev, scratch, fd));
+				CHECK(withSIMD.DeinterlaceFrame(src, simd, fd));
+				CHECK(withoutSIMD.DeinterlaceFrame(src, scalar, fd));
+				CHECK(simd.IsContentEqual(scalar));
+				CHECK(inPlace.DeinterlaceFrame(src, src, fd));
+				CHECK(src.IsContentEqual(simd));
+			}
+	}	//	TEST_CASE("SIMD & In-Place")
+
+	TEST_CASE("Motion Adaptive")
+	{	//	Still areas are woven, moving areas are bobbed
+		const NTV2FormatDesc	fd (NTV2_STANDARD_1080, NTV2_FBF_RGBA);
+		const ULWord			rowBytes (fd.GetBytesPerRow()),  numRows (fd.GetVisibleRasterHeight());
+		NTV2Buffer				frame (fd.GetTotalBytes()),  dst (fd.GetTotalBytes()),  bobbed (fd.GetTotalBytes());
+		FillPseudoRandom (frame, 5, NTV2_FBF_RGBA);
+		NTV2Deinterlacer	deinterlacer,  bob (NTV2_DEINTERLACE_BOB);
+		CHECK_EQ(deinterlacer.getMode(), NTV2_DEINTERLACE_MOTION_ADAPTIVE);
+		CHECK(deinterlacer.DeinterlaceFrame(frame, dst, fd));
+		CHECK(bob.DeinterlaceFrame(frame, bobbed, fd));
+		CHECK(dst.IsContentEqual(bobbed));				//	No history:  bob
+		CHECK(deinterlacer.DeinterlaceFrame(frame, dst, fd));
+		CHECK(dst.IsContentEqual(frame));				//	No motion:  weave
+
+		//	Move a block in the top half...
+		UByte *	pFrame (reinterpret_cast<UByte*>(frame.GetHostPointer()));
+		for (ULWord row(100);  row < 200;  row++)
+			for (ULWord ndx(400);  ndx < 800;  ndx++)
+				pFrame[row * rowBytes + ndx] = UByte(pFrame[row * rowBytes + ndx] + 128);
+		CHECK(deinterlacer.DeinterlaceFrame(frame, dst, fd));
+		CHECK(bob.DeinterlaceFrame(frame, bobbed, fd));
+		const UByte *	pDst (reinterpret_cast<const UByte*>(dst.GetHostPointer()));
+		const UByte *	pBob (reinterpret_cast<const UByte*>(bobbed.GetHostPointer()));
+		CHECK_EQ(::memcmp(pDst + 120 * rowBytes + 400, pBob + 120 * rowBytes + 400, 400), 0);	//	Moving
+		CHECK_EQ(::memcmp(pDst + 121 * rowBytes + 400, pBob + 121 * rowBytes + 400, 400), 0);
+		CHECK_EQ(::memcmp(pDst + 101 * rowBytes, pFrame + 101 * rowBytes, 400), 0);				//	Still
+		CHECK_EQ(::memcmp(pDst + 500 * rowBytes, pFrame + 500 * rowBytes, rowBytes * (numRows - 500)), 0);
+
+		//	Reset forgets the history...
+		deinterlacer.Reset();
+		CHECK(deinterlacer.DeinterlaceFrame(frame, dst, fd));
+		CHECK(dst.IsContentEqual(bobbed));
+		CHECK_EQ(deinterlacer.getPerformance().Entries(), 4);
+	}	//	TEST_CASE("Motion Adaptive")
+
+	TEST_CASE("Performance" * doctest::skip())
+	{	//	Per-frame cost of each mode on 1080i 'v210' and 2vuy, SIMD vs. scalar
+		static const NTV2PixelFormat	sFormats[] = {NTV2_FBF_10BIT_YCBCR, NTV2_FBF_8BIT_YCBCR};
+		static const char *				sModes[] = {"bob", "blend", "motion-adaptive"};
+		for (size_t f(0);  f < sizeof(sFormats) / sizeof(sFormats[0]);  f++)
+		{
+			const NTV2FormatDesc	fd (NTV2_STANDARD_1080, sFormats[f]);
+			NTV2Buffer				src (fd.GetTotalBytes()),  dst (fd.GetTotalBytes());
+			FillPseudoRandom (src, 9, sFormats[f]);
+			for (int mode(NTV2_DEINTERLACE_BOB);  mode < NTV2_DEINTERLACE_INVALID;  mode++)
+				for (int simd(1);  simd >= 0;  simd--)
+				{
+					NTV2Deinterlacer	deinterlacer (static_cast<NTV2DeinterlaceMode>(mode));
+					deinterlacer.setUseSIMD(simd != 0);
+					for (int frame(0);  frame < 10;  frame++)
+						CHECK(deinterlacer.DeinterlaceFrame(src, dst, fd));
+					AJAPerformance &	perf (deinterlacer.getPerformance());
+					CHECK_EQ(perf.Entries(), 10);
+					if (gVerboseOutput)
+						cout	<< "1080i " << ::NTV2FrameBufferFormatToString(sFormats[f], true) << " " << sModes[mode] << (simd ? " SIMD: " : " scalar: ")
+								<< "mean " << perf.Mean() << "us, min " << perf.MinTime() << "us, max " << perf.MaxTime() << "us" << endl;
+				}
+		}
+	}	//	TEST_CASE("Performance")
+}	//	TEST_SUITE("NTV2Deinterlacer")
+
+
+TEST_SUITE("NTV2TimeCodeBurner" * doctest::description("NTV2TimeCodeBurner tests"))
+{
+	TEST_CASE("Matches AJATimeCodeBurn")
+	{	//	With an opaque box, the burn-in must be identical to the original renderer's
+		static const NTV2PixelFormat	sFormats[] = {NTV2_FBF_8BIT_YCBCR, NTV2_FBF_10BIT_YCBCR};
+		static const AJA_PixelFormat	sAJAFormats[] = {AJA_PixelFormat_YCbCr8, AJA_PixelFormat_YCbCr10};
+		for (size_t f(0);  f < sizeof(sFormats) / sizeof(sFormats[0]);  f++)
+		{
+			const NTV2FormatDesc	fd (NTV2_STANDARD_1080, sFormats[f]);
+			NTV2Buffer				expected (fd.GetTotalBytes()),  actual (fd.GetTotalBytes());
+			expected.Fill(ULWord(0));  actual.Fill(ULWord(0));
+			AJATimeCodeBurn			oldBurner;
+			REQUIRE(oldBurner.RenderTimeCodeFont(sAJAFormats[f], fd.GetRasterWidth(), fd.GetVisibleRasterHeight()));
+			CHECK(oldBurner.BurnTimeCode(expected.GetHostPointer(), "01:23:45;67", 80));
+			NTV2TimeCodeBurner		burner;
+			CHECK(burner.BurnTimeCode(actual, fd, "01:23:45;67", 80));
+			CHECK(burner.getLastStats().fAtlasRebuilt);
+			CHECK_EQ(burner.getLastStats().fNumChars, 11);
+			CHECK_EQ(burner.getLastStats().fBoxY, 864);
+			CHECK(actual.IsContentEqual(expected));
+			CHECK(burner.BurnTimeCode(actual, fd, "01:23:45;67", 80));
+			CHECK_FALSE(burner.getLastStats().fAtlasRebuilt);
+		}
+	}	//	TEST_CASE("Matches AJATimeCodeBurn")
+
+	TEST_CASE("Every Pixel Format")
+	{	//	Only the box may change, and the same digits must look the same wherever they are in the box
+		const NTV2PixelFormats	formats (NTV2FrameConverter::GetSupportedPixelFormats());
+		for (NTV2PixelFormatsConstIter it(formats.begin());  it != formats.end();  ++it)
+		{
+			const NTV2FormatDesc	fd (NTV2_STANDARD_1080, *it);
+			REQUIRE(fd.GetTotalBytes());
+			CHECK(NTV2TimeCodeBurner::IsSupportedPixelFormat(*it));
+			NTV2Buffer			original (fd.GetTotalBytes()),  frame (fd.GetTotalBytes());
+			FillPseudoRandom (original, 3);
+			CHECK(frame.CopyFrom(original, 0, 0, ULWord(original.GetByteCount())));
+			NTV2TimeCodeBurner	burner;
+			CHECK(burner.BurnTimeCode(frame, fd, "12:34:56:78", 50));
+			const NTV2TimeCodeBurner::Stats	stats (burner.getLastStats());
+			CHECK_EQ(stats.fBoxHeight, 108);
+			CHECK_EQ(stats.fBoxWidth, 11 * 72);
+			CHECK_EQ(stats.fBoxY, 540);
+			const ULWord	rowBytes (fd.GetBytesPerRow(0)),  boxTop (stats.fBoxY * rowBytes),  boxEnd (boxTop + stats.fBoxHeight * rowBytes);
+			const UByte *	pOrig (reinterpret_cast<const UByte*>(original.GetHostPointer()));
+			const UByte *	pFrame (reinterpret_cast<const UByte*>(frame.GetHostPointer()));
+			CHECK_EQ(::memcmp(pOrig, pFrame, boxTop), 0);											//	Luma above box untouched
+			CHECK_EQ(::memcmp(pOrig + boxEnd, pFrame + boxEnd, fd.GetTotalRasterBytes(0) - boxEnd), 0);	//	Luma below box untouched
+			CHECK(::memcmp(pOrig + boxTop, pFrame + boxTop, boxEnd - boxTop) != 0);					//	Box changed
+
+			//	The opaque box hides the picture, so '1' and '5' burned into two different frames must match...
+			vector<UWord>	pixels1 (stats.fBoxWidth * 4),  pixels2 (stats.fBoxWidth * 4);
+			NTV2Buffer		other (fd.GetTotalBytes());
+			FillPseudoRandom (other, 4);
+			CHECK(burner.BurnTimeCode(other, fd, "12:34:56:78", 50));
+			const ULWord	row (fd.GetFirstActiveLine() + stats.fBoxY + 30);
+			CHECK(NTV2FrameConverter::UnpackPixels(frame.GetHostPointer(), fd, row, stats.fBoxX, stats.fBoxWidth, &pixels1[0]));
+			CHECK(NTV2FrameConverter::UnpackPixels(other.GetHostPointer(), fd, row, stats.fBoxX, stats.fBoxWidth, &pixels2[0]));
+			if (!NTV2_IS_FBF_PLANAR(*it)  ||  fd.GetVerticalSampleRatio(1) == 1)	//	4:2:0 chroma rows are shared with rows outside the glyphs
+				CHECK(pixels1 == pixels2);
+		}
+		NTV2TimeCodeBurner	burner;
+		NTV2Buffer			frame (NTV2FormatDesc(NTV2_STANDARD_1080, NTV2_FBF_8BIT_YCBCR).GetTotalBytes());
+		CHECK_FALSE(burner.BurnTimeCode(frame, NTV2FormatDesc(NTV2_STANDARD_1080, NTV2_FBF_PRORES_DVCPRO), "00:00:00:00"));
+		CHECK_FALSE(burner.BurnTimeCode(frame, NTV2FormatDesc(NTV2_STANDARD_1080, NTV2_FBF_8BIT_YCBCR), "00:00:00:00:00:00:00"));
+	}	//	TEST_CASE("Every Pixel Format")
+
+	TEST_CASE("SIMD & Box Opacity")
+	{	//	The SSE2 blend must match the scalar blend, and a transparent box must leave the background alone
+		static const NTV2PixelFormat	sFormats[] = {NTV2_FBF_10BIT_YCBCR, NTV2_FBF_ABGR, NTV2_FBF_12BIT_RGB_PACKED, NTV2_FBF_10BIT_DPX};
+		for (size_t f(0);  f < sizeof(sFormats) / sizeof(sFormats[0]);  f++)
+		{
+			const NTV2FormatDesc	fd (NTV2_STANDARD_720, sFormats[f]);
+			NTV2Buffer				simd (fd.GetTotalBytes()),  scalar (fd.GetTotalBytes());
+			FillPseudoRandom (simd, 5);
+			CHECK(scalar.CopyFrom(simd, 0, 0, ULWord(simd.GetByteCount())));
+			NTV2TimeCodeBurner	burnerSIMD, burnerScalar;
+			burnerSIMD.setBoxOpacity(0.5);
+			burnerScalar.setBoxOpacity(0.5).setUseSIMD(false);
+			CHECK(burnerSIMD.BurnTimeCode(simd, fd, "23:59:59;29*"));
+			CHECK(burnerScalar.BurnTimeCode(scalar, fd, "23:59:59;29*"));
+			CHECK_EQ(burnerSIMD.getLastStats().fNumChars, 12);
+			CHECK(simd.IsContentEqual(scalar));
+		}
+		//	Blank glyphs in a transparent box don't change anything...
+		const NTV2FormatDesc	fd (NTV2_STANDARD_1080, NTV2_FBF_ARGB);
+		NTV2Buffer				frame (fd.GetTotalBytes()),  original (fd.GetTotalBytes());
+		FillPseudoRandom (frame, 6);
+		CHECK(original.CopyFrom(frame, 0, 0, ULWord(frame.GetByteCount())));
+		NTV2TimeCodeBurner	burner;
+		CHECK(burner.setBoxOpacity(0.0).BurnTimeCode(frame, fd, "           "));
+		CHECK(frame.IsContentEqual(original));
+	}	//	TEST_CASE("SIMD & Box Opacity")
+
+	TEST_CASE("CRP188 BurnTC")
+	{	//	CRP188::BurnTC now uses NTV2TimeCodeBurner, so it supports every pixel format
+		const NTV2FormatDesc	fd (NTV2_STANDARD_1080, NTV2_FBF_10BIT_RGB_PACKED);
+		NTV2Buffer				frame (fd.GetTotalBytes()),  expected (fd.GetTotalBytes());
+		CRP188	rp188 (7, 6, 5, 4, kTCFormat30fpsDF);
+		CHECK(rp188.InitBurnIn(NTV2_FBF_10BIT_RGB_PACKED, NTV2FrameSize(1920, 1080)));
+		CHECK(rp188.BurnTC(reinterpret_cast<char*>(frame.GetHostPointer()), int(fd.GetBytesPerRow()), kTCBurnTimecode));
+		NTV2TimeCodeBurner	burner;
+		CHECK(burner.BurnTimeCode(expected, fd, "04:05:06;07"));
+		CHECK(frame.IsContentEqual(expected));
+		CHECK_FALSE(rp188.BurnTC(reinterpret_cast<char*>(frame.GetHostPointer()), 1234, kTCBurnTimecode));
+
+		//	Padded rows -- rowBytes becomes the line pitch...
+		const ULWord	rowBytes (fd.GetBytesPerRow()),  paddedRowBytes (rowBytes + 256);
+		NTV2Buffer		padded (paddedRowBytes * fd.GetFullRasterHeight());
+		padded.Fill(UByte(0xA5));
+		for (ULWord row(0);  row < fd.GetFullRasterHeight();  row++)
+			::memset(padded.GetHostAddress(row * paddedRowBytes), 0, rowBytes);
+		CHECK(rp188.BurnTC(reinterpret_cast<char*>(padded.GetHostPointer()), int(paddedRowBytes), kTCBurnTimecode));
+		bool	rowsMatch (true),  paddingIntact (true);
+		for (ULWord row(0);  row < fd.GetFullRasterHeight();  row++)
+		{
+			const UByte *	pRow (reinterpret_cast<const UByte*>(padded.GetHostAddress(row * paddedRowBytes)));
+			if (::memcmp(pRow, expected.GetHostAddress(row * rowBytes), rowBytes))
+				rowsMatch = false;
+			for (ULWord ndx(rowBytes);  ndx < paddedRowBytes;  ndx++)
+				if (pRow[ndx] != 0xA5)
+					paddingIntact = false;
+		}
+		CHECK(rowsMatch);
+		CHECK(paddingIntact);
+	}	//	TEST_CASE("CRP188 BurnTC")
+
+	TEST_CASE("Performance" * doctest::skip())
+	{	//	The cost is flat:  changing one digit costs the same as changing all of them
+		const NTV2FormatDesc	fd (NTV2_STANDARD_1080, NTV2_FBF_10BIT_YCBCR);
+		NTV2Buffer				frame (fd.GetTotalBytes());
+		FillPseudoRandom (frame, 7);
+		for (int simd(1);  simd >= 0;  simd--)
+		{
+			NTV2TimeCodeBurner	burner;
+			burner.setUseSIMD(simd != 0);
+			CHECK(burner.Prepare(fd));
+			uint64_t	oneDigit(0), allDigits(0);
+			for (ULWord count(0);  count < 100;  count++)
+			{
+				CHECK(burner.BurnTimeCode(frame, fd, count & 1 ? "01:00:00:01" : "01:00:00:00"));
+				oneDigit += burner.getLastStats().fMicroseconds;
+				CHECK(burner.BurnTimeCode(frame, fd, count & 1 ? "11:11:11:11" : "00:00:00:00"));
+				allDigits += burner.getLastStats().fMicroseconds;
+			}
+			if (gVerboseOutput)
+				cout	<< "1080 v210 burn-in" << (simd ? " SIMD: " : " scalar: ") << "1 digit changing " << oneDigit / 100
+						<< "us, 11 digits changing " << allDigits / 100 << "us" << endl;
+		}
+	}	//	TEST_CASE("Performance")
+}	//	TEST_SUITE("NTV2TimeCodeBurner")
+
+
 void autocircmarker() {}
 TEST_SUITE("AutoCirculate" * doctest::description("AutoCirculate tests"))
 {
@@ -4430,6 +5842,102 @@ TEST_SUITE("NTV2RegInfo" * doctest::description("NTV2RegInfo tests"))
 }	//	TEST_SUITE("NTV2RegInfo")
 
 
+TEST_SUITE("NTV2RegisterExpert" * doctest::description("CNTV2RegisterExpert tests"))
+{
+	TEST_CASE("Lookups")
+	{
+		CHECK_EQ(CNTV2RegisterExpert::GetDisplayName(kRegGlobalControl), string("kRegGlobalControl"));
+		CHECK_EQ(CNTV2RegisterExpert::GetDisplayName(kRegRXSDI3CRCErrorCount), string("kRegRXSDI3CRCErrorCount"));
+		CHECK_EQ(CNTV2RegisterExpert::GetDisplayName(VIRTUALREG_START + 1023), string("VIRTUALREG_START+1023"));
+		CHECK_EQ(CNTV2RegisterExpert::GetDisplayName(0x00012345), string("Reg 0x00012345"));
+		CHECK_FALSE(CNTV2RegisterExpert::GetDisplayValue(kRegGlobalControl, 0, DEVICE_ID_KONA5).empty());
+		CHECK(CNTV2RegisterExpert::GetDisplayValue(0x00012345, 0, DEVICE_ID_KONA5).empty());
+
+		//	Names match regardless of case...
+		NTV2RegNumSet	regs (CNTV2RegisterExpert::GetRegistersWithName("KREGGLOBALCONTROL"));
+		CHECK_EQ(regs.size(), 1);
+		CHECK(regs.find(kRegGlobalControl) != regs.end());
+		CHECK(CNTV2RegisterExpert::GetRegistersWithName("kRegNoSuchRegister").empty());
+		regs = CNTV2RegisterExpert::GetRegistersWithName("kregxptselectgroup", 1/*STARTSWITH*/);
+		CHECK(regs.size() > 30);
+		for (NTV2RegNumSetConstIter it(regs.begin());  it != regs.end();  ++it)
+			CHECK_EQ(CNTV2RegisterExpert::GetDisplayName(*it).find("kRegXptSelectGroup"), 0);
+		regs = CNTV2RegisterExpert::GetRegistersWithName("CRCErrorCount", 2/*ENDSWITH*/);
+		CHECK(regs.find(kRegRXSDI1CRCErrorCount) != regs.end());
+		CHECK(regs.find(kRegRXSDI8CRCErrorCount) != regs.end());
+		regs = CNTV2RegisterExpert::GetRegistersWithName("sdi5crc", 0/*CONTAINS*/);
+		CHECK_EQ(regs.size(), 1);
+		CHECK(regs.find(kRegRXSDI5CRCErrorCount) != regs.end());
+
+		//	Classes...
+		const NTV2StringSet	allClasses (CNTV2RegisterExpert::GetAllRegisterClasses());
+		CHECK(allClasses.find(kRegClass_Audio) != allClasses.end());
+		CHECK(allClasses.find(kRegClass_Virtual) != allClasses.end());
+		CHECK(allClasses.find(kRegClass_NULL) == allClasses.end());
+		CHECK(CNTV2RegisterExpert::IsRegisterInClass(kRegAud1Control, kRegClass_Audio));
+		CHECK_FALSE(CNTV2RegisterExpert::IsRegisterInClass(kRegAud1Control, kRegClass_VPID));
+		CHECK_FALSE(CNTV2RegisterExpert::IsRegisterInClass(kRegAud1Control, "kRegClass_Bogus"));
+		CHECK(CNTV2RegisterExpert::IsRegisterInClass(kRegRXSDIFreeRunningClockLow, kRegClass_ReadOnly));
+		NTV2StringSet	classes (CNTV2RegisterExpert::GetRegisterClasses(kRegAud1Control, true));
+		CHECK(classes.find("Audio") != classes.end());
+		classes = CNTV2RegisterExpert::GetRegisterClasses(kRegAud1Control, false);
+		CHECK(classes.find(kRegClass_Audio) != classes.end());
+		for (NTV2StringSetConstIter it(allClasses.begin());  it != allClasses.end();  ++it)
+		{	//	Every class member must be in its class...
+			const NTV2RegNumSet	classRegs (CNTV2RegisterExpert::GetRegistersForClass(*it));
+			CHECK_FALSE(classRegs.empty());
+			for (NTV2RegNumSetConstIter regIt(classRegs.begin());  regIt != classRegs.end();  ++regIt)
+				if (!CNTV2RegisterExpert::IsRegisterInClass(*regIt, *it))
+					{CHECK(CNTV2RegisterExpert::IsRegisterInClass(*regIt, *it));  break;}
+		}
+		regs = CNTV2RegisterExpert::GetRegistersForChannel(NTV2_CHANNEL3);
+		CHECK(regs.find(kRegCh3Control) != regs.end());
+		CHECK(regs.find(kRegCh4Control) == regs.end());
+		regs = CNTV2RegisterExpert::GetRegistersForDevice(DEVICE_ID_KONA5, kIncludeOtherRegs_VRegs);
+		CHECK(regs.find(kRegGlobalControl) != regs.end());
+		CHECK(regs.find(VIRTUALREG_START + 1000) != regs.end());
+		CHECK(regs.find(kRegAud1Control) != regs.end());
+
+		//	Crosspoint select groups...
+		uint32_t regNum(0), maskNdx(0);
+		CHECK(CNTV2RegisterExpert::GetCrosspointSelectGroupRegisterInfo(NTV2_XptFrameBuffer1Input, regNum, maskNdx));
+		CHECK_EQ(regNum, kRegXptSelectGroup2);
+		CHECK_EQ(maskNdx, 0);
+		CHECK(CNTV2RegisterExpert::GetCrosspointSelectGroupRegisterInfo(NTV2_XptHDMIOutQ1Input, regNum, maskNdx));
+		CHECK_EQ(regNum, kRegXptSelectGroup6);
+		CHECK_EQ(maskNdx, 2);
+		CHECK_EQ(CNTV2RegisterExpert::GetInputCrosspointID(kRegXptSelectGroup2, 1), NTV2_XptFrameSync1Input);
+		CHECK_EQ(CNTV2RegisterExpert::GetInputCrosspointID(kRegXptSelectGroup2, 4), NTV2_INPUT_CROSSPOINT_INVALID);
+		CHECK_EQ(CNTV2RegisterExpert::GetInputCrosspointID(kRegGlobalControl, 0), NTV2_INPUT_CROSSPOINT_INVALID);
+		for (NTV2InputXptID xpt(NTV2_FIRST_INPUT_CROSSPOINT);  xpt <= NTV2_LAST_INPUT_CROSSPOINT;  xpt = NTV2InputXptID(xpt+1))
+			if (xpt != NTV2_XptHDMIOutQ1Input  &&  CNTV2RegisterExpert::GetCrosspointSelectGroupRegisterInfo(xpt, regNum, maskNdx))
+				CHECK_EQ(CNTV2RegisterExpert::GetInputCrosspointID(regNum, maskNdx), xpt);
+	}	//	TEST_CASE("Lookups")
+
+	TEST_CASE("Performance" * doctest::skip())
+	{
+		CNTV2RegisterExpert::Deallocate();
+		uint64_t	t0 (AJATime::GetSystemMicroseconds());
+		CHECK(CNTV2RegisterExpert::Allocate());
+		uint64_t	t1 (AJATime::GetSystemMicroseconds());
+		size_t		total(0);
+		for (int n(0);  n < 1000;  n++)
+			total += CNTV2RegisterExpert::GetRegistersWithName("kRegAud1Control").size();
+		uint64_t	t2 (AJATime::GetSystemMicroseconds());
+		for (int n(0);  n < 1000;  n++)
+			total += CNTV2RegisterExpert::IsRegisterInClass(kRegAud1Control, kRegClass_Audio) ? 1 : 0;
+		uint64_t	t3 (AJATime::GetSystemMicroseconds());
+		for (int n(0);  n < 100;  n++)
+			total += CNTV2RegisterExpert::GetRegistersForDevice(DEVICE_ID_KONA5, kIncludeOtherRegs_VRegs).size() ? 1 : 0;
+		uint64_t	t4 (AJATime::GetSystemMicroseconds());
+		CHECK_EQ(total, 2100);
+		if (gVerboseOutput)
+			cout	<< "RegisterExpert: cold start " << (t1 - t0) << "us, GetRegistersWithName " << (t2 - t1) << "ns, IsRegisterInClass "
+					<< (t3 - t2) << "ns, GetRegistersForDevice " << (t4 - t3) * 10 << "ns" << endl;
+	}	//	TEST_CASE("Performance")
+}	//	TEST_SUITE("NTV2RegisterExpert")
+
+
 TEST_SUITE("DeviceCapabilities" * doctest::description("DeviceCapabilities tests"))
 {
 	TEST_CASE("NTV2BoolParamID")
@@ -4549,6 +6057,967 @@ TEST_SUITE("DeviceCapabilities" * doctest::description("DeviceCapabilities tests
 	}	//	TEST_CASE("NTV2EnumsID")
 }	//	TEST_SUITE("DeviceCapabilities")
 
+//	A CNTV2Card that's "open" without a driver, whose register reads are served by the readReg hook.
+//	Counts each driver call it would have made in mNumCalls (subclasses count the other calls they override).
+class RegisterSimCard : public CNTV2Card
+{
+	public:
+		RegisterSimCard (const NTV2DeviceID inDeviceID) : mNumCalls(0)
+		{
+			_boardID = inDeviceID;
+			_boardOpened = true;
+		}
+		virtual ~RegisterSimCard ()	{_boardOpened = false;}
+		using CNTV2Card::ReadRegister;
+		virtual bool ReadRegister (const ULWord inRegNum, ULWord & outValue, const ULWord inMask = 0xFFFFFFFF, const ULWord inShift = 0)
+		{
+			mNumCalls++;
+			outValue = readReg(inRegNum);
+			if (inShift < 32)
+				outValue = (outValue & inMask) >> inShift;
+			return true;
+		}
+		ULWord	mNumCalls;
+
+	protected:
+		virtual ULWord readReg (const ULWord inRegNum) = 0;	//	Returns the register's unmasked value
+};	//	RegisterSimCard
+
+//	Serves register reads from memory, counting each driver call it would have made...
+class SupportLogFakeCard : public RegisterSimCard
+{
+	public:
+		SupportLogFakeCard (const NTV2DeviceID inDeviceID) : RegisterSimCard(inDeviceID), mNumVBIWaits(0)
+		{
+			const NTV2RegNumSet regs (CNTV2RegisterExpert::GetRegistersForDevice(inDeviceID, kIncludeOtherRegs_VRegs));
+			for (NTV2RegNumSetConstIter it(regs.begin());  it != regs.end();  ++it)
+				mRegs[*it] = *it < VIRTUALREG_START ? (*it * 0x9E3779B1) & 0x0000FFFF : 0;	//	Arbitrary, but repeatable
+			mRegs[kRegBoardID] = inDeviceID;
+		}
+		virtual bool ReadRegisters (NTV2RegisterReads & inOutValues)
+		{
+			mNumCalls++;
+			for (NTV2RegisterReadsIter it(inOutValues.begin());  it != inOutValues.end();  ++it)
+				it->registerValue = readReg(it->registerNumber);
+			return true;
+		}
+		virtual bool WaitForInputVerticalInterrupt (const NTV2Channel = NTV2_CHANNEL1, UWord = 1)	{mNumVBIWaits++;  return true;}
+		virtual bool WaitForOutputVerticalInterrupt (const NTV2Channel = NTV2_CHANNEL1, UWord = 1)	{mNumVBIWaits++;  return true;}
+		map<ULWord,ULWord>	mRegs;
+		ULWord				mNumVBIWaits;
+
+	protected:
+		virtual ULWord readReg (const ULWord inRegNum)
+		{
+			map<ULWord,ULWord>::const_iterator it(mRegs.find(inRegNum));
+			return it != mRegs.end() ? it->second : 0;
+		}
+};	//	SupportLogFakeCard
+
+static string supportLogSections (const string & inLog)
+{	//	Everything after the "Generated:" timestamps...
+	const string::size_type pos (inLog.find("===="));
+	return pos == string::npos ? string() : inLog.substr(pos);
+}
+
+TEST_SUITE("CNTV2SupportLogger" * doctest::description("CNTV2SupportLogger tests"))
+{
+	TEST_CASE("Snapshot")
+	{
+		//	The Info section includes host info that changes from call to call, so leave it out...
+		const NTV2SupportLoggerSections sections (NTV2SupportLoggerSections(NTV2_SupportLoggerSectionAutoCirculate | NTV2_SupportLoggerSectionAudio
+																			| NTV2_SupportLoggerSectionRouting | NTV2_SupportLoggerSectionRegisters));
+		SupportLogFakeCard card (DEVICE_ID_KONA5);
+		REQUIRE(card.IsOpen());
+		CNTV2SupportLogger logger (card, sections);
+		CHECK_FALSE(logger.getUseSnapshot());
+
+		//	Classic mode...
+		uint64_t startTime (AJATime::GetSystemMicroseconds());
+		const string classicLog (supportLogSections(logger.ToString()));
+		const uint64_t classicMicroseconds (AJATime::GetSystemMicroseconds() - startTime);
+		const ULWord classicReadCalls (card.mNumCalls);
+		CHECK(card.mNumVBIWaits > 0);
+		CHECK_FALSE(classicLog.empty());
+
+		//	Snapshot mode must produce exactly the same text...
+		card.mNumCalls = card.mNumVBIWaits = 0;
+		logger.setUseSnapshot(true);
+		startTime = AJATime::GetSystemMicroseconds();
+		const string snapshotLog (supportLogSections(logger.ToString()));
+		const uint64_t snapshotMicroseconds (AJATime::GetSystemMicroseconds() - startTime);
+		CHECK_EQ(snapshotLog, classicLog);
+		CHECK_EQ(card.mNumVBIWaits, 0);
+
+		//	...with far less driver traffic...
+		const CNTV2SupportLogger::SnapshotStats & stats (logger.getLastSnapshotStats());
+		CHECK_EQ(stats.fNumRegisters, ULWord(CNTV2RegisterExpert::GetRegistersForDevice(DEVICE_ID_KONA5, kIncludeOtherRegs_VRegs | kIncludeOtherRegs_XptROM).size()));
+		CHECK(stats.fNumWorkers >= 1);
+		CHECK(stats.fNumQueries > 0);
+		CHECK(card.mNumCalls < classicReadCalls / 10);
+		if (gVerboseOutput)
+			cout << "SupportLogger:  classic " << classicMicroseconds << "us, " << classicReadCalls << " read calls;  snapshot "
+				<< snapshotMicroseconds << "us, " << card.mNumCalls << " read calls, held " << stats.fHoldMicroseconds << "us, rendered "
+				<< stats.fRenderMicroseconds << "us, " << stats.fNumWorkers << " workers, " << stats.fNumLateReads << " late reads" << endl;
+
+		//	Prepended/appended text lands in the same place in both modes...
+		logger.PrependToSection(NTV2_SupportLoggerSectionRegisters, "PREPENDED\n");
+		logger.AppendToSection(NTV2_SupportLoggerSectionAudio, "APPENDED\n");
+		const string snapshotLog2 (supportLogSections(logger.ToString()));
+		logger.setUseSnapshot(false);
+		CHECK_EQ(snapshotLog2, supportLogSections(logger.ToString()));
+		CHECK(snapshotLog2.find("PREPENDED") != string::npos);
+	}	//	TEST_CASE("Snapshot")
+}	//	TEST_SUITE("CNTV2SupportLogger")
+
+//	Memory-backed Micron MT25QL512 (64MB) behind the Xena2 SPI flash controller registers...
+class FlashSimCard : public RegisterSimCard
+{
+	public:
+		static const ULWord	kFlashID		= 0x0020ba20;
+		static const ULWord	kFlashBytes		= 64 * 1024 * 1024;
+		static const ULWord	kBankBytes		= 16 * 1024 * 1024;
+		static const ULWord	kSectorBytes	= 64 * 1024;
+
+		FlashSimCard (const NTV2DeviceID inDeviceID = DEVICE_ID_KONA5)
+			:	RegisterSimCard(inDeviceID), mFlash(kFlashBytes / 4, 0xFFFFFFFF), mAddress(0), mDOUT(0), mPendingDOUT(0), mBank(0), mBusyCount(0),
+				mNumReads(0), mWriteEnabled(false), mDOUTPending(false), mReadBusy(false), mFailAddress(0xFFFFFFFF), mFailCount(0),
+				mNumPagePrograms(0), mNumSectorErases(0)
+		{
+			mRegs[kRegBoardID] = inDeviceID;
+		}
+		virtual bool ReadRegisters (NTV2RegisterReads & inOutValues)
+		{
+			mNumCalls++;
+			for (NTV2RegisterReadsIter it(inOutValues.begin());  it != inOutValues.end();  ++it)
+				it->registerValue = it->registerNumber == kRegXenaxFlashDOUT ? 0 : readReg(it->registerNumber);	//	Like the drivers' GETREGS
+			return true;
+		}
+		virtual bool WriteRegister (const ULWord inRegNum, const ULWord inValue, const ULWord inMask = 0xFFFFFFFF, const ULWord inShift = 0)
+		{
+			mNumCalls++;
+			writeReg(inRegNum, inValue, inMask, inShift);
+			return true;
+		}
+		virtual bool WriteRegisters (const NTV2RegisterWrites & inRegWrites)
+		{
+			mNumCalls++;
+			for (NTV2RegisterWritesConstIter it(inRegWrites.begin());  it != inRegWrites.end();  ++it)
+				writeReg(it->registerNumber, it->registerValue, it->registerMask, it->registerShift);
+			return true;
+		}
+		bool Matches (const NTV2Buffer & inImage, const ULWord inFlashOffset, const ULWord inImageOffset, const ULWord inByteCount) const
+		{
+			return inFlashOffset + inByteCount <= kFlashBytes  &&  inImageOffset + inByteCount <= inImage.GetByteCount()
+					&& ::memcmp(&mFlash[inFlashOffset / 4], inImage.GetHostAddress(inImageOffset), inByteCount) == 0;
+		}
+
+	private:
+		virtual ULWord readReg (const ULWord inRegNum)
+		{
+			switch (inRegNum)
+			{
+				case kRegXenaxFlashControlStatus:
+					if (mBusyCount)
+						{mBusyCount--;  return BIT(8);}
+					if (mDOUTPending)
+						{mDOUT = mPendingDOUT;  mDOUTPending = false;}
+					return 0;
+				case kRegXenaxFlashDOUT:
+					return mDOUT;
+				default:
+				{
+					map<ULWord,ULWord>::const_iterator it(mRegs.find(inRegNum));
+					return it != mRegs.end() ? it->second : 0;
+				}
+			}
+		}
+		void writeReg (const ULWord inRegNum, const ULWord inValue, const ULWord inMask, const ULWord inShift)
+		{
+			switch (inRegNum)
+			{
+				case kRegXenaxFlashAddress:			mAddress = inValue;						break;
+				case kRegXenaxFlashDIN:				mPage.push_back(inValue);				break;
+				case kRegXenaxFlashControlStatus:	command(inValue & 0xFF);  mPage.clear();	break;
+				default:							mRegs[inRegNum] = (mRegs[inRegNum] & ~inMask) | ((inValue << inShift) & inMask);	break;
+			}
+		}
+		void command (const ULWord inCommand)
+		{
+			const ULWord offset ((mBank * kBankBytes + (mAddress & (kBankBytes - 1))) & (kFlashBytes - 1));
+			switch (inCommand)
+			{
+				case WRITEENABLE_COMMAND:
+					mWriteEnabled = true;
+					return;
+				case PAGEPROGRAM_COMMAND:
+					if (mWriteEnabled)
+					{
+						mNumPagePrograms++;
+						for (ULWord ndx(0);  ndx < ULWord(mPage.size())  &&  ndx < 64;  ndx++)
+						{
+							const ULWord wordOffset ((offset & ~ULWord(0xFF)) | ((offset + ndx * 4) & 0xFF));
+							if (wordOffset == mFailAddress  &&  mFailCount)
+								{mFailCount--;  continue;}	//	Injected fault:  this word doesn't program
+							mFlash[wordOffset / 4] &= mPage[ndx];
+						}
+						mBusyCount = 2;
+					}
+					break;
+				case SECTORERASE_COMMAND:
+					if (mWriteEnabled)
+					{
+						mNumSectorErases++;
+						std::fill(mFlash.begin() + (offset & ~(kSectorBytes - 1)) / 4, mFlash.begin() + ((offset & ~(kSectorBytes - 1)) + kSectorBytes) / 4, 0xFFFFFFFF);
+						mBusyCount = 2;
+					}
+					break;
+				case READFAST_COMMAND:
+					mPendingDOUT = mFlash[offset / 4];
+					if (mReadBusy  &&  (mNumReads++ % 7) == 0)
+						{mDOUT = 0xDEADBEEF;  mDOUTPending = true;  mBusyCount = 1;}	//	DOUT isn't valid until the read finishes
+					else
+						mDOUT = mPendingDOUT;
+					return;
+				case READID_COMMAND:
+					mDOUT = kFlashID;
+					return;
+				case EXTENDEDADDRESS_COMMAND:
+				case BANKSELECT_COMMAND:
+					mBank = mAddress & 3;
+					break;
+				case READEXTENDEDADDRESS_COMMAND:
+				case READBANKSELECT_COMMAND:
+					mDOUT = mBank;
+					return;
+				default:
+					break;
+			}
+			mWriteEnabled = false;
+		}
+
+	public:
+		vector<ULWord>		mFlash;				///< @brief	Flash contents
+		vector<ULWord>		mPage;				///< @brief	DIN words since last command
+		map<ULWord,ULWord>	mRegs;				///< @brief	All other registers
+		ULWord				mAddress, mDOUT, mPendingDOUT, mBank, mBusyCount, mNumReads;
+		bool				mWriteEnabled, mDOUTPending;
+		bool				mReadBusy;			///< @brief	If true, some reads report busy, and DOUT isn't valid until they finish
+		ULWord				mFailAddress;		///< @brief	Flash offset of a word that won't program...
+		ULWord				mFailCount;			///< @brief	...this many times
+		ULWord				mNumPagePrograms, mNumSectorErases;
+};	//	FlashSimCard
+
+class FlashSimProgrammer : public CNTV2KonaFlashProgram
+{
+	public:
+		FlashSimProgrammer (CNTV2Card & inCard) : CNTV2KonaFlashProgram(inCard)	{SetQuietMode();}
+		bool SetImage (const NTV2Buffer & inImage, const FlashBlockID inBlockID = MAIN_FLASHBLOCK)
+		{	//	Same as SetBitFile, but without the file or header
+			_flashID = inBlockID;
+			_bitFileSize = inImage.GetByteCount();
+			return _bitFileBuffer.Allocate(_bitFileSize + 512)  &&  _bitFileBuffer.Fill(ULWord(0xFFFFFFFF))
+					&&  _bitFileBuffer.CopyFrom(inImage, 0, 0, _bitFileSize);
+		}
+};	//	FlashSimProgrammer
+
+static NTV2Buffer flashTestImage (const ULWord inByteCount)
+{
+	NTV2Buffer result(inByteCount);
+	ULWord seed(0x13579BDF);
+	for (ULWord ndx(0);  ndx < inByteCount / 4;  ndx++)
+		result.U32(int(ndx)) = NextPseudoRandom(seed);
+	return result;
+}
+
+TEST_SUITE("CNTV2KonaFlashProgram" * doctest::description("CNTV2KonaFlashProgram tests"))
+{
+	TEST_CASE("Batched vs Legacy")
+	{
+		const NTV2Buffer image (flashTestImage(1024 * 1024 + 1000));	//	Not a whole number of pages
+		FlashSimCard legacyCard, batchCard;
+		FlashSimProgrammer legacy(legacyCard), batched(batchCard);
+		REQUIRE(legacy.SetImage(image));
+		REQUIRE(batched.SetImage(image));
+		CHECK_FALSE(batched.IsBatchMode());
+		batched.SetBatchMode();
+		CHECK(batched.IsBatchMode());
+		batchCard.mReadBusy = legacyCard.mReadBusy = true;
+
+		legacyCard.mNumCalls = batchCard.mNumCalls = 0;
+		uint64_t startTime (AJATime::GetSystemMicroseconds());
+		CHECK_EQ(legacy.Program(/*fullVerify*/true), string());
+		const uint64_t legacyTime (AJATime::GetSystemMicroseconds() - startTime);
+		startTime = AJATime::GetSystemMicroseconds();
+		CHECK_EQ(batched.Program(), string());
+		const uint64_t batchTime (AJATime::GetSystemMicroseconds() - startTime);
+		CHECK(legacyCard.Matches(image, 0, 0, image.GetByteCount()));
+		CHECK(batchCard.Matches(image, 0, 0, image.GetByteCount()));
+		CHECK_EQ(batchCard.mBank, ULWord(0));	//	Left in bank 0
+		CHECK_LT(batchCard.mNumCalls, legacyCard.mNumCalls);
+		if (gVerboseOutput)
+			cout << "Program 1MB with full verify:  legacy " << DEC(legacyCard.mNumCalls) << " driver calls " << DEC(legacyTime) << "us,  batched "
+				<< DEC(batchCard.mNumCalls) << " driver calls " << DEC(batchTime) << "us" << endl;
+
+		//	VerifyFlash
+		CHECK(batched.VerifyFlash(MAIN_FLASHBLOCK));
+		batchCard.mFlash[1000] ^= 0x00010000;
+		CHECK_FALSE(batched.VerifyFlash(MAIN_FLASHBLOCK));
+		CHECK(legacy.VerifyFlash(MAIN_FLASHBLOCK, /*fullVerify*/true));	//	Legacy card wasn't touched
+	}	//	TEST_CASE("Batched vs Legacy")
+
+	TEST_CASE("Sector Retry")
+	{
+		const NTV2Buffer image (flashTestImage(512 * 1024));
+		FlashSimCard card;
+		FlashSimProgrammer flasher(card);
+		REQUIRE(flasher.SetImage(image));
+		flasher.SetBatchMode();
+		const ULWord numSectors (FlashSimCard::kFlashBytes / FlashSimCard::kSectorBytes / 2);	//	EraseBlock erases all of Main
+
+		//	A word that doesn't program the first time...
+		card.mFailAddress = 3 * FlashSimCard::kSectorBytes + 0x1234;
+		card.mFailCount = 1;
+		CHECK_EQ(flasher.Program(), string());
+		CHECK(card.Matches(image, 0, 0, image.GetByteCount()));
+		CHECK_EQ(card.mNumSectorErases, numSectors + 1);	//	One sector was re-programmed
+		CHECK_EQ(card.mNumPagePrograms, image.GetByteCount() / 256 + FlashSimCard::kSectorBytes / 256);
+
+		//	A word that never programs...
+		card.mNumSectorErases = 0;
+		card.mFailCount = 100;
+		CHECK_EQ(flasher.Program(), string("Program Didn't Verify"));
+		CHECK_EQ(card.mNumSectorErases, numSectors + 2);	//	Two retries, then gave up
+		CHECK_EQ(card.mBank, ULWord(0));
+	}	//	TEST_CASE("Sector Retry")
+
+	TEST_CASE("ReadFlash")
+	{
+		const NTV2Buffer image (flashTestImage(128 * 1024 + 256));
+		FlashSimCard card;
+		FlashSimProgrammer flasher(card);
+		REQUIRE(flasher.SetImage(image));
+		CHECK_EQ(flasher.Program(), string());
+		card.mReadBusy = true;
+
+		NTV2Buffer legacyRead, batchRead;
+		ULWord legacyCalls(card.mNumCalls);
+		CHECK(flasher.ReadFlash(legacyRead, MAIN_FLASHBLOCK));
+		legacyCalls = card.mNumCalls - legacyCalls;
+		flasher.SetBatchMode();
+		ULWord batchCalls(card.mNumCalls);
+		CHECK(flasher.ReadFlash(batchRead, MAIN_FLASHBLOCK));
+		batchCalls = card.mNumCalls - batchCalls;
+		CHECK(legacyRead.IsContentEqual(batchRead));
+		REQUIRE(batchRead.GetByteCount() >= image.GetByteCount());
+		CHECK(::memcmp(batchRead.GetHostPointer(), image.GetHostPointer(), image.GetByteCount()) == 0);
+		CHECK_LT(batchCalls, legacyCalls);
+	}	//	TEST_CASE("ReadFlash")
+
+	TEST_CASE("Bank Crossing")
+	{	//	Main spans banks 0 & 1 on SPI v5 devices...
+		const NTV2Buffer image (flashTestImage(FlashSimCard::kBankBytes + 2 * FlashSimCard::kSectorBytes + 100));
+		FlashSimCard card;
+		FlashSimProgrammer flasher(card);
+		REQUIRE(flasher.SetImage(image));
+		flasher.SetBatchMode();
+		CHECK_EQ(flasher.Program(), string());
+		CHECK(card.Matches(image, 0, 0, image.GetByteCount()));
+		CHECK_EQ(card.mBank, ULWord(0));
+
+		NTV2Buffer readBack;
+		CHECK(flasher.ReadFlash(readBack, MAIN_FLASHBLOCK));
+		REQUIRE(readBack.GetByteCount() >= image.GetByteCount());
+		CHECK(::memcmp(readBack.GetHostPointer(), image.GetHostPointer(), image.GetByteCount()) == 0);
+	}	//	TEST_CASE("Bank Crossing")
+}	//	TEST_SUITE("CNTV2KonaFlashProgram")
+
+TEST_SUITE("NTV2AudioConverter" * doctest::description("NTV2AudioConverter tests"))
+{
+	static void FillSamples (vector<int32_t> & outSamples, const size_t inNumSamples, ULWord inSeed, const ULWord inMask = 0xFFFFFFFF)
+	{
+		outSamples.resize(inNumSamples);
+		for (size_t ndx(0);  ndx < inNumSamples;  ndx++)
+			outSamples[ndx] = int32_t(NextPseudoRandom(inSeed) & inMask);
+	}
+
+	template <typename T> static vector<T*> PlanePointers (vector<T> & inPlanes, const ULWord inNumChannels, const ULWord inNumFrames)
+	{
+		inPlanes.assign(size_t(inNumChannels) * inNumFrames, T(0));
+		vector<T*> result;
+		for (ULWord chan(0);  chan < inNumChannels;  chan++)
+			result.push_back(&inPlanes[size_t(chan) * inNumFrames]);
+		return result;
+	}
+
+	TEST_CASE("Deinterleave")
+	{
+		static const ULWord kChannelCounts[] = {1, 2, 3, 4, 6, 8, 16, 64, 0};
+		const ULWord numFrames (1023);	//	Not a multiple of 4, to exercise the scalar tail
+		NTV2AudioConverter converter;
+		for (const ULWord * pNumChannels(kChannelCounts);  *pNumChannels;  pNumChannels++)
+		{
+			const ULWord numChannels (*pNumChannels);
+			vector<int32_t> frames, planes, roundTrip(size_t(numChannels) * numFrames);
+			vector<float> floatPlanes, floatScalar;
+			FillSamples (frames, size_t(numChannels) * numFrames, numChannels, 0xFFFFFF00);	//	24-bit audio
+			vector<int32_t*> pPlanes (PlanePointers(planes, numChannels, numFrames));
+			vector<float*> pFloatPlanes (PlanePointers(floatPlanes, numChannels, numFrames));
+			vector<float*> pFloatScalar (PlanePointers(floatScalar, numChannels, numFrames));
+			for (int simd(1);  simd >= 0;  simd--)
+			{
+				INFO("channels=" << numChannels << " simd=" << simd);
+				converter.setUseSIMD(simd != 0);
+				REQUIRE(converter.Deinterleave(&frames[0], numChannels, &pPlanes[0], numFrames));
+				bool ok(true);
+				for (ULWord chan(0);  chan < numChannels;  chan++)
+					for (ULWord frame(0);  frame < numFrames;  frame++)
+						ok = ok  &&  pPlanes[chan][frame] == frames[size_t(frame) * numChannels + chan];
+				CHECK(ok);
+				REQUIRE(converter.Interleave(&pPlanes[0], numChannels, &roundTrip[0], numFrames));
+				CHECK(roundTrip == frames);
+
+				REQUIRE(converter.DeinterleaveToFloat(&frames[0], numChannels, simd ? &pFloatPlanes[0] : &pFloatScalar[0], numFrames));
+				roundTrip.assign(roundTrip.size(), 0);
+				REQUIRE(converter.InterleaveFromFloat(simd ? &pFloatPlanes[0] : &pFloatScalar[0], numChannels, &roundTrip[0], numFrames));
+				CHECK(roundTrip == frames);	//	24-bit audio is exact in float
+			}
+			CHECK(floatPlanes == floatScalar);
+			CHECK_EQ(floatPlanes[0], float(frames[0]) / 2147483648.0f);
+		}
+		vector<int32_t*> noPlanes(2, AJA_NULL);
+		int32_t sample(0);
+		CHECK_FALSE(converter.Deinterleave(&sample, 2, &noPlanes[0], 1));
+		CHECK_FALSE(converter.Deinterleave(&sample, 0, &noPlanes[0], 1));
+	}	//	TEST_CASE("Deinterleave")
+
+	TEST_CASE("Conversions")
+	{
+		NTV2AudioConverter converter;
+		const float		floats[8]	= {0.0f, 0.5f, -0.5f, 1.0f, -1.0f, 2.0f, -3.0f, std::numeric_limits<float>::quiet_NaN()};
+		const int32_t	expected[8]	= {0, 0x40000000, -0x40000000, 0x7FFFFFFF, int32_t(0x80000000), 0x7FFFFFFF, int32_t(0x80000000), int32_t(0x80000000)};
+		for (int simd(1);  simd >= 0;  simd--)
+		{
+			INFO("simd=" << simd);
+			converter.setUseSIMD(simd != 0).setDither(NTV2_AUDIO_DITHER_NONE);
+			int32_t ints[8];
+			REQUIRE(converter.FloatToInt32(floats, ints, 8));
+			for (int ndx(0);  ndx < 8;  ndx++)
+				CHECK_EQ(ints[ndx], expected[ndx]);
+			float back[8];
+			REQUIRE(converter.Int32ToFloat(ints, back, 8));
+			CHECK_EQ(back[1], 0.5f);
+			CHECK_EQ(back[4], -1.0f);
+
+			//	Round to nearest, saturate...
+			const int32_t	samples[5]	= {0x12348000, 0x12347FFF, 0x7FFF8000, int32_t(0x80000000), -0x00018000};
+			const int16_t	shorts[5]	= {0x1235, 0x1234, 0x7FFF, int16_t(-0x8000), -1};
+			int16_t			out16[5];
+			REQUIRE(converter.Int32ToInt16(samples, out16, 5));
+			for (int ndx(0);  ndx < 5;  ndx++)
+				CHECK_EQ(out16[ndx], shorts[ndx]);
+			int32_t			in16[5];
+			REQUIRE(converter.Int16ToInt32(out16, in16, 5));
+			CHECK_EQ(in16[0], 0x12350000);
+			CHECK_EQ(in16[3], int32_t(0x80000000));
+
+			const int32_t	samples24[4] = {0x123456FF, 0x12345680, 0x7FFFFFC0, -0x100};
+			UByte			out24[12];
+			REQUIRE(converter.Int32ToInt24(samples24, out24, 4));
+			CHECK_EQ(out24[0], 0x57);	CHECK_EQ(out24[1], 0x34);	CHECK_EQ(out24[2], 0x12);
+			CHECK_EQ(out24[3], 0x57);
+			CHECK_EQ(out24[6], 0xFF);	CHECK_EQ(out24[7], 0xFF);	CHECK_EQ(out24[8], 0x7F);
+			CHECK_EQ(out24[9], 0xFF);	CHECK_EQ(out24[10], 0xFF);	CHECK_EQ(out24[11], 0xFF);
+			int32_t			in24[4];
+			REQUIRE(converter.Int24ToInt32(out24, in24, 4));
+			CHECK_EQ(in24[0], 0x12345700);
+			CHECK_EQ(in24[3], -0x100);
+		}
+
+		//	SIMD and scalar produce identical results, dither included...
+		const ULWord numSamples (4099);
+		vector<int32_t> samples;
+		FillSamples (samples, numSamples, 7);
+		vector<float> floatsIn(numSamples), floatSIMD(numSamples), floatScalar(numSamples);
+		for (ULWord ndx(0);  ndx < numSamples;  ndx++)
+			floatsIn[ndx] = float(samples[ndx]) / 1073741824.0f;	//	±2.0, so some clip
+		vector<int32_t> intSIMD(numSamples), intScalar(numSamples);
+		CHECK(converter.setUseSIMD(true).FloatToInt32(&floatsIn[0], &intSIMD[0], numSamples));
+		CHECK(converter.setUseSIMD(false).FloatToInt32(&floatsIn[0], &intScalar[0], numSamples));
+		CHECK(intSIMD == intScalar);
+		CHECK(converter.setUseSIMD(true).Int32ToFloat(&samples[0], &floatSIMD[0], numSamples));
+		CHECK(converter.setUseSIMD(false).Int32ToFloat(&samples[0], &floatScalar[0], numSamples));
+		CHECK(floatSIMD == floatScalar);
+		for (int dither(NTV2_AUDIO_DITHER_NONE);  dither < NTV2_AUDIO_DITHER_INVALID;  dither++)
+		{
+			INFO("dither=" << dither);
+			vector<int16_t> shortSIMD(numSamples), shortScalar(numSamples), shortPlain(numSamples);
+			vector<UByte> bytesSIMD(numSamples * 3), bytesScalar(numSamples * 3);
+			converter.setDither(NTV2AudioDither(dither));
+			for (int simd(1);  simd >= 0;  simd--)
+			{	//	The 24-bit conversion continues the dither sequence where the 16-bit one left off
+				converter.setUseSIMD(simd != 0).setDitherSeed(99);
+				CHECK(converter.Int32ToInt16(&samples[0], simd ? &shortSIMD[0] : &shortScalar[0], numSamples));
+				CHECK(converter.Int32ToInt24(&samples[0], simd ? &bytesSIMD[0] : &bytesScalar[0], numSamples));
+			}
+			CHECK(shortSIMD == shortScalar);
+			CHECK(bytesSIMD == bytesScalar);
+			//	Dither changes each result by at most 1 LSB...
+			CHECK(converter.setDither(NTV2_AUDIO_DITHER_NONE).Int32ToInt16(&samples[0], &shortPlain[0], numSamples));
+			bool within1(true);
+			for (ULWord ndx(0);  ndx < numSamples;  ndx++)
+				within1 = within1  &&  abs(int(shortSIMD[ndx]) - int(shortPlain[ndx])) <= 1;
+			CHECK(within1);
+		}
+	}	//	TEST_CASE("Conversions")
+
+	TEST_CASE("Channel Maps")
+	{
+		NTV2AudioConverter converter;
+		const ULWord numFrames (100);
+		vector<int32_t> frames16, stereo(numFrames * 2), six(numFrames * 6);
+		FillSamples (frames16, numFrames * 16, 3);
+
+		const int pairMap[2] = {5, 4};	//	Swap channels 5 & 6 (zero-based 4 & 5)
+		REQUIRE(converter.RemapChannels(&frames16[0], 16, &stereo[0], 2, pairMap, numFrames));
+		CHECK_EQ(stereo[0], frames16[5]);
+		CHECK_EQ(stereo[1], frames16[4]);
+		CHECK_EQ(stereo[(numFrames - 1) * 2], frames16[(numFrames - 1) * 16 + 5]);
+
+		const int sixMap[6] = {0, 1, 2, 3, -1, 9};	//	Runs, silence, single
+		REQUIRE(converter.RemapChannels(&frames16[0], 16, &six[0], 6, sixMap, numFrames));
+		bool ok(true);
+		for (ULWord frame(0);  frame < numFrames;  frame++)
+			for (ULWord chan(0);  chan < 6;  chan++)
+				ok = ok  &&  six[frame * 6 + chan] == (sixMap[chan] < 0  ?  0  :  frames16[frame * 16 + ULWord(sixMap[chan])]);
+		CHECK(ok);
+
+		int identity[16];
+		for (int chan(0);  chan < 16;  chan++)
+			identity[chan] = chan;
+		vector<int32_t> copy16(numFrames * 16);
+		REQUIRE(converter.RemapChannels(&frames16[0], 16, &copy16[0], 16, identity, numFrames));
+		CHECK(copy16 == frames16);
+
+		const int badMap[2] = {0, 16};
+		CHECK_FALSE(converter.RemapChannels(&frames16[0], 16, &stereo[0], 2, badMap, numFrames));
+		CHECK_FALSE(converter.ScatterChannels(&stereo[0], 2, &copy16[0], 16, badMap, numFrames));
+
+		//	Scatter a stereo pair into channels 7 & 8, leaving the rest alone...
+		const int scatterMap[2] = {6, 7};
+		copy16 = frames16;
+		REQUIRE(converter.ScatterChannels(&stereo[0], 2, &copy16[0], 16, scatterMap, numFrames));
+		ok = true;
+		for (ULWord frame(0);  frame < numFrames;  frame++)
+			for (ULWord chan(0);  chan < 16;  chan++)
+				ok = ok  &&  copy16[frame * 16 + chan] == (chan == 6  ?  stereo[frame * 2]  :  (chan == 7  ?  stereo[frame * 2 + 1]  :  frames16[frame * 16 + chan]));
+		CHECK(ok);
+	}	//	TEST_CASE("Channel Maps")
+
+	TEST_CASE("Performance" * doctest::skip())
+	{	//	Per-kernel throughput on one second of 16-channel 48kHz audio, SIMD vs. scalar
+		const ULWord	numChannels (16),  numFrames (48000),  numSamples (numChannels * numFrames),  numPasses (20);
+		NTV2AudioConverter converter;
+		vector<int32_t> frames, planes, out(numSamples);
+		vector<float> floatPlanes, floats(numSamples);
+		vector<int16_t> shorts(numSamples);
+		vector<UByte> bytes(numSamples * 3);
+		FillSamples (frames, numSamples, 11);
+		vector<int32_t*> pPlanes (PlanePointers(planes, numChannels, numFrames));
+		vector<float*> pFloatPlanes (PlanePointers(floatPlanes, numChannels, numFrames));
+		const int map[16] = {1, 0, 3, 2, 5, 4, 7, 6, 9, 8, 11, 10, 13, 12, 15, 14};
+		static const char * kNames[] = {"Deinterleave", "DeinterleaveToFloat", "Interleave", "InterleaveFromFloat", "Int32ToFloat",
+										"FloatToInt32", "Int32ToInt16", "Int16ToInt32", "Int32ToInt24", "Int24ToInt32", "RemapChannels", AJA_NULL};
+		for (int kernel(0);  kNames[kernel];  kernel++)
+			for (int simd(1);  simd >= 0;  simd--)
+			{
+				converter.setUseSIMD(simd != 0);
+				AJAPerformance	perf (string(kNames[kernel]) + (simd ? "SIMD" : "Scalar"), AJATimerPrecisionMicroseconds);
+				for (ULWord pass(0);  pass < numPasses;  pass++)
+				{
+					perf.Start();
+					switch (kernel)
+					{
+						case 0:		converter.Deinterleave(&frames[0], numChannels, &pPlanes[0], numFrames);				break;
+						case 1:		converter.DeinterleaveToFloat(&frames[0], numChannels, &pFloatPlanes[0], numFrames);	break;
+						case 2:		converter.Interleave(&pPlanes[0], numChannels, &out[0], numFrames);						break;
+						case 3:		converter.InterleaveFromFloat(&pFloatPlanes[0], numChannels, &out[0], numFrames);		break;
+						case 4:		converter.Int32ToFloat(&frames[0], &floats[0], numSamples);								break;
+						case 5:		converter.FloatToInt32(&floats[0], &out[0], numSamples);								break;
+						case 6:		converter.Int32ToInt16(&frames[0], &shorts[0], numSamples);								break;
+						case 7:		converter.Int16ToInt32(&shorts[0], &out[0], numSamples);								break;
+						case 8:		converter.Int32ToInt24(&frames[0], &bytes[0], numSamples);								break;
+						case 9:		converter.Int24ToInt32(&bytes[0], &out[0], numSamples);									break;
+						default:	converter.RemapChannels(&frames[0], numChannels, &out[0], numChannels, map, numFrames);	break;
+					}
+					perf.Stop();
+				}
+				CHECK_EQ(perf.Entries(), numPasses);
+				if (gVerboseOutput)
+				{
+					perf.Report();
+					cout	<< kNames[kernel] << (simd ? " SIMD" : " scalar") << " 16ch x 48000: mean " << perf.Mean() << "us, min " << perf.MinTime()
+							<< "us, max " << perf.MaxTime() << "us, " << double(numSamples) / (perf.Mean() + 1.0) << " Msamples/s" << endl;
+				}
+			}
+	}	//	TEST_CASE("Performance")
+}	//	TEST_SUITE("NTV2AudioConverter")
+
+//	Simulates one Audio System's capture ring:  each 32-bit word written is the running word count
+class AudioSimCard : public RegisterSimCard
+{
+	public:
+		static const ULWord	kRingBytes		= NTV2_AUDIO_WRAPADDRESS_BIG;
+		static const ULWord	kCaptureOffset	= NTV2_AUDIO_READBUFFEROFFSET_BIG;
+
+		AudioSimCard ()
+			:	RegisterSimCard(DEVICE_ID_KONA5), mRing(kRingBytes / 4, 0), mWritePos(0), mNextWord(0), mNumDMAs(0), mNumBadDMAs(0)
+		{
+		}
+		virtual bool DMAReadAudio (const NTV2AudioSystem inAudioSystem, ULWord * pOutAudioBuffer, const ULWord inOffsetBytes, const ULWord inByteCount)
+		{
+			mNumDMAs++;
+			if (inAudioSystem != NTV2_AUDIOSYSTEM_1  ||  !pOutAudioBuffer  ||  inOffsetBytes < kCaptureOffset
+				||  inOffsetBytes - kCaptureOffset + inByteCount > kRingBytes  ||  (inOffsetBytes | inByteCount) & 3)
+					{mNumBadDMAs++;  return false;}	//	Must not cross the wrap address
+			::memcpy(pOutAudioBuffer, &mRing[(inOffsetBytes - kCaptureOffset) / 4], inByteCount);
+			return true;
+		}
+		void Capture (const ULWord inByteCount)
+		{
+			for (ULWord ndx(0);  ndx < inByteCount / 4;  ndx++)
+			{
+				mRing[mWritePos / 4] = mNextWord++;
+				mWritePos = (mWritePos + 4) % kRingBytes;
+			}
+		}
+
+	public:
+		vector<ULWord>	mRing;
+		ULWord			mWritePos, mNextWord, mNumDMAs, mNumBadDMAs;
+
+	protected:
+		virtual ULWord readReg (const ULWord inRegNum)
+		{
+			if (inRegNum == kRegAud1InputLastAddr)
+				return mWritePos;
+			if (inRegNum == kRegAud1Control)
+				return kRegMaskAudio16Channel | kK2RegMaskAudioBufferSize;	//	16 channels, 4MB buffer
+			return 0;
+		}
+};	//	AudioSimCard
+
+//	True if the block holds consecutive words starting with the given one
+static bool audioBlockIsSequential (const NTV2Buffer & inBlock, const ULWord inFirstWord)
+{
+	for (ULWord ndx(0);  ndx < inBlock.GetByteCount() / 4;  ndx++)
+		if (inBlock.U32(int(ndx)) != inFirstWord + ndx)
+			return false;
+	return true;
+}
+
+TEST_SUITE("NTV2AudioStreamReader" * doctest::description("NTV2AudioStreamReader tests"))
+{
+	TEST_CASE("Wrap")
+	{
+		AudioSimCard card;
+		const ULWord blockBytes (800 * 16 * 4);
+		card.mWritePos = AudioSimCard::kRingBytes - blockBytes - blockBytes / 2;	//	Second block straddles the wrap
+		NTV2AudioStreamReader reader(card);
+		CHECK_FALSE(reader.Poll());
+		CHECK_FALSE(reader.Start(NTV2_AUDIOSYSTEM_1, 800, 1));
+		REQUIRE(reader.Start(NTV2_AUDIOSYSTEM_1, 800, 8));
+		CHECK_EQ(reader.GetNumChannels(), ULWord(16));
+		CHECK_EQ(reader.GetBlockBytes(), blockBytes);
+
+		card.Capture(blockBytes * 3 + 100);
+		CHECK(reader.Poll());
+		CHECK_EQ(reader.GetNumReadyBlocks(), ULWord(3));
+		CHECK_EQ(reader.GetStats().fBlocksRead, uint64_t(3));
+		CHECK_EQ(reader.GetStats().fWrapSplits, ULWord(1));
+		CHECK_EQ(reader.GetStats().fDMATransfers, uint64_t(4));
+		CHECK_EQ(card.mNumBadDMAs, ULWord(0));
+
+		NTV2Buffer block, sameBlock;
+		for (ULWord ndx(0);  ndx < 3;  ndx++)
+		{
+			REQUIRE(reader.AcquireBlock(block));
+			CHECK_EQ(block.GetByteCount(), blockBytes);
+			CHECK(audioBlockIsSequential(block, ndx * blockBytes / 4));
+			REQUIRE(reader.AcquireBlock(sameBlock));
+			CHECK_EQ(sameBlock.GetHostPointer(), block.GetHostPointer());	//	Not copied, not advanced
+			CHECK(reader.ReleaseBlock());
+		}
+		CHECK_FALSE(reader.AcquireBlock(block));
+		CHECK_FALSE(reader.ReleaseBlock());
+
+		//	Leftover partial block is picked up by the next Poll...
+		card.Capture(blockBytes - 100);
+		CHECK(reader.Poll());
+		REQUIRE(reader.AcquireBlock(block));
+		CHECK(audioBlockIsSequential(block, 3 * blockBytes / 4));
+		CHECK(reader.ReleaseBlock());
+		CHECK_EQ(reader.GetStats().fDeviceOverruns, ULWord(0));
+		CHECK_EQ(reader.GetStats().fHostOverruns, ULWord(0));
+		reader.Stop();
+		CHECK_FALSE(reader.IsRunning());
+	}	//	TEST_CASE("Wrap")
+
+	TEST_CASE("Overruns")
+	{
+		AudioSimCard card;
+		const ULWord blockBytes (256 * 16 * 4), blockWords (blockBytes / 4);
+		NTV2AudioStreamReader reader(card);
+		REQUIRE(reader.Start(NTV2_AUDIOSYSTEM_1, 256, 4));
+
+		//	Host ring full -- newest blocks are dropped...
+		card.Capture(blockBytes * 6);
+		CHECK(reader.Poll());
+		CHECK_EQ(reader.GetNumReadyBlocks(), ULWord(4));
+		CHECK_EQ(reader.GetStats().fHostOverruns, ULWord(2));
+		NTV2Buffer block;
+		for (ULWord ndx(0);  ndx < 4;  ndx++)
+		{
+			REQUIRE(reader.AcquireBlock(block));
+			CHECK(audioBlockIsSequential(block, ndx * blockWords));
+			CHECK(reader.ReleaseBlock());
+		}
+
+		//	Latency limit -- oldest blocks are skipped...
+		reader.setMaxLatencyBlocks(2);
+		card.Capture(blockBytes * 5);
+		CHECK(reader.Poll());
+		CHECK_EQ(reader.GetStats().fLatencySkips, ULWord(3));
+		CHECK_EQ(reader.GetNumReadyBlocks(), ULWord(2));
+		REQUIRE(reader.AcquireBlock(block));
+		CHECK(audioBlockIsSequential(block, (6 + 3) * blockWords));
+		CHECK(reader.ReleaseBlock());
+		CHECK(reader.ReleaseBlock());
+
+		//	Device laps the reader -- resync to the write head...
+		reader.setMaxLatencyBlocks(0);
+		card.Capture(blockBytes + blockBytes / 2);
+		CHECK(reader.Poll());
+		CHECK(reader.ReleaseBlock());
+		card.Capture(AudioSimCard::kRingBytes - blockBytes / 4);	//	Write head lands just behind the read position
+		CHECK(reader.Poll());
+		CHECK_EQ(reader.GetStats().fDeviceOverruns, ULWord(1));
+		CHECK_EQ(reader.GetNumReadyBlocks(), ULWord(0));
+		const ULWord resyncWord (card.mNextWord);
+		card.Capture(blockBytes);
+		CHECK(reader.Poll());
+		REQUIRE(reader.AcquireBlock(block));
+		CHECK(audioBlockIsSequential(block, resyncWord));
+		CHECK_EQ(card.mNumBadDMAs, ULWord(0));
+	}	//	TEST_CASE("Overruns")
+}	//	TEST_SUITE("NTV2AudioStreamReader")
+
+#if defined(AJALinux) || defined(AJAMac)
+//	Writes a minimal reconfigurable bitfile:  header fields 'a' thru 'e', then a program stream that starts with the sync word
+static bool bitfileTestWrite (const string & inPath, const NTV2DeviceID inDeviceID, const ULWord inDesignVersion,
+								const ULWord inBitfileVersion, const string & inFlag, const ULWord inProgBytes, const UByte inFill)
+{
+	const ULWord userID ((CNTV2Bitfile::ConvertToDesignID(inDeviceID) << 24) | (inDesignVersion << 16)
+							| (CNTV2Bitfile::ConvertToBitfileID(inDeviceID) << 8) | inBitfileVersion);
+	ostringstream design;  design << "testdesign;" << inFlag << ";UserID=0X" << hex << uppercase << setw(8) << setfill('0') << userID;
+	const string fields[4] = {design.str(), string("xcku060-ffva1156-2-e"), string("2026/01/02"), string("12:34:56")};
+	vector<UByte> bytes;
+	static const UByte hdr13[13] = {0x00, 0x09, 0x0f, 0xf0, 0x0f, 0xf0, 0x0f, 0xf0, 0x0f, 0xf0, 0x00, 0x00, 0x01};
+	bytes.insert(bytes.end(), hdr13, hdr13 + 13);
+	for (int ndx(0);  ndx < 4;  ndx++)
+	{
+		const size_t len (fields[ndx].length() + 1);	//	Includes NUL
+		bytes.push_back(UByte('a' + ndx));  bytes.push_back(UByte(len >> 8));  bytes.push_back(UByte(len));
+		bytes.insert(bytes.end(), fields[ndx].begin(), fields[ndx].end());  bytes.push_back(0);
+	}
+	bytes.push_back('e');
+	for (int shift(24);  shift >= 0;  shift -= 8)
+		bytes.push_back(UByte(inProgBytes >> shift));
+	static const UByte sync[8] = {0xFF, 0xFF, 0xFF, 0xFF, 0xAA, 0x99, 0x55, 0x66};
+	bytes.insert(bytes.end(), sync, sync + 8);
+	bytes.resize(bytes.size() + inProgBytes - 8, inFill);
+	ofstream ofs (inPath.c_str(), ios::out | ios::binary | ios::trunc);
+	ofs.write(reinterpret_cast<const char*>(&bytes[0]), streamsize(bytes.size()));
+	return ofs.good();
+}
+
+TEST_SUITE("CNTV2BitfileManager" * doctest::description("CNTV2BitfileManager tests"))
+{
+	TEST_CASE("Catalog")
+	{
+		char dirTemplate[] = "/tmp/ut_ajantv2_bitfilesXXXXXX";
+		REQUIRE(::mkdtemp(dirTemplate));
+		const string dir(dirTemplate), catalogPath(dir + "/" + CNTV2BitfileManager::GetCatalogFileName());
+		const string clearPath(dir + "/clear.bit"), partialPath(dir + "/partial.bit"), junkPath(dir + "/junk.bit");
+		const ULWord designID(CNTV2Bitfile::ConvertToDesignID(DEVICE_ID_KONA5)), bitfileID(CNTV2Bitfile::ConvertToBitfileID(DEVICE_ID_KONA5));
+		REQUIRE(bitfileTestWrite(clearPath, DEVICE_ID_KONA5, 3, 5, "CLEAR=TRUE", 4096, 0x11));
+		REQUIRE(bitfileTestWrite(partialPath, DEVICE_ID_KONA5, 3, 5, "PARTIAL=TRUE", 8192, 0x22));
+		{	ofstream junk (junkPath.c_str());  junk << string(600, 'j');	}	//	Not a bitfile
+
+		{	//	Catalogs are off by default -- nothing is written into the directory...
+			CNTV2BitfileManager bitMan;
+			CHECK(bitMan.AddDirectory(dir));
+			CHECK_EQ(bitMan.GetNumBitfiles(), size_t(2));
+			CHECK_EQ(bitMan.GetStats().fCatalogsWritten, ULWord(0));
+			CHECK_FALSE(AJAFileIO::FileExists(catalogPath));
+		}
+		{	//	No catalog yet -- every header is parsed, and the catalog is written...
+			CNTV2BitfileManager bitMan;
+			bitMan.SetUseCatalog(true);
+			CHECK(bitMan.AddDirectory(dir));
+			CHECK_EQ(bitMan.GetNumBitfiles(), size_t(2));
+			CHECK_EQ(bitMan.GetStats().fHeadersParsed, ULWord(3));
+			CHECK_EQ(bitMan.GetStats().fCatalogHits, ULWord(0));
+			CHECK_EQ(bitMan.GetStats().fCatalogsWritten, ULWord(1));
+			CHECK(AJAFileIO::FileExists(catalogPath));
+		}
+		{	//	Nothing changed -- everything comes from the catalog, and it isn't rewritten...
+			CNTV2BitfileManager bitMan;
+			bitMan.SetUseCatalog(true);
+			CHECK(bitMan.AddDirectory(dir));
+			CHECK_EQ(bitMan.GetNumBitfiles(), size_t(2));
+			CHECK_EQ(bitMan.GetStats().fHeadersParsed, ULWord(0));
+			CHECK_EQ(bitMan.GetStats().fCatalogHits, ULWord(3));
+			CHECK_EQ(bitMan.GetStats().fCatalogsWritten, ULWord(0));
+			const NTV2BitfileInfoList & infoList (bitMan.GetBitfileInfoList());
+			bool foundPartial(false);
+			for (NTV2BitfileInfoList::const_iterator it(infoList.begin());  it != infoList.end();  ++it)
+				if (it->bitfilePath == partialPath)
+				{
+					foundPartial = true;
+					CHECK_EQ(it->designID, designID);
+					CHECK_EQ(it->designVersion, ULWord(3));
+					CHECK_EQ(it->bitfileID, bitfileID);
+					CHECK_EQ(it->bitfileVersion, ULWord(5));
+					CHECK_EQ(it->bitfileFlags, ULWord(NTV2_BITFILE_FLAG_PARTIAL));
+					CHECK_EQ(it->deviceID, DEVICE_ID_KONA5);
+					CHECK_EQ(it->designName, string("testdesign"));
+				}
+			CHECK(foundPartial);
+
+			//	Bitstreams are mapped once, then handed out as copies without further I/O...
+			NTV2Buffer bitstream;
+			CHECK(bitMan.GetBitStream(bitstream, designID, 3, bitfileID, 5, NTV2_BITFILE_FLAG_PARTIAL));
+			CHECK_EQ(bitMan.GetStats().fBitstreamsMapped, ULWord(1));
+			CHECK_EQ(bitMan.GetStats().fBitstreamsRead, ULWord(0));
+			CHECK(bitstream.IsAllocatedBySDK());
+			REQUIRE_EQ(bitstream.GetByteCount(), ULWord(8192));
+			CHECK_EQ(bitstream.U32(0), ULWord(0xFFFFFFFF));
+			CHECK_EQ(bitstream.U8(8191), UByte(0x22));
+			NTV2Buffer clearStream;
+			CHECK(bitMan.GetBitStream(clearStream, designID, 3, bitfileID, 0xff, NTV2_BITFILE_FLAG_CLEAR));
+			CHECK_EQ(clearStream.GetByteCount(), ULWord(4096));
+			CHECK_EQ(clearStream.U8(4095), UByte(0x11));
+			CHECK_EQ(bitMan.GetStats().fBitstreamsMapped, ULWord(2));
+
+			//	Views reference the cached bitstream, and are never written into by GetBitStream...
+			NTV2Buffer view, view2;
+			CHECK(bitMan.GetBitStreamView(view, designID, 3, bitfileID, 5, NTV2_BITFILE_FLAG_PARTIAL));
+			CHECK(bitMan.GetBitStreamView(view2, designID, 3, bitfileID, 5, NTV2_BITFILE_FLAG_PARTIAL));
+			CHECK(view.IsProvidedByClient());
+			CHECK_EQ(view.GetHostPointer(), view2.GetHostPointer());
+			CHECK(view.IsContentEqual(bitstream));
+			CHECK(bitMan.GetBitStream(view2, designID, 3, bitfileID, 0xff, NTV2_BITFILE_FLAG_CLEAR));
+			CHECK(view2.IsAllocatedBySDK());
+			CHECK(view2.IsContentEqual(clearStream));
+			CHECK(view.IsContentEqual(bitstream));
+			CHECK_EQ(bitMan.GetStats().fBitstreamsMapped, ULWord(2));
+
+			//	Client-allocated buffers get a copy...
+			NTV2Buffer clientBuffer(8192);
+			clientBuffer.Fill(UByte(0));
+			NTV2Buffer clientView(clientBuffer.GetHostPointer(), clientBuffer.GetByteCount());
+			CHECK(bitMan.GetBitStream(clientView, designID, 3, bitfileID, 5, NTV2_BITFILE_FLAG_PARTIAL));
+			CHECK_EQ(clientView.GetHostPointer(), clientBuffer.GetHostPointer());
+			CHECK(clientView.IsContentEqual(bitstream));
+
+			//	Replaced while mapped -- the stale mapping is dropped, and the new bitstream is read instead...
+			const string newPath(dir + "/partial.new");
+			REQUIRE(bitfileTestWrite(newPath, DEVICE_ID_KONA5, 3, 5, "PARTIAL=TRUE", 8192, 0x66));
+			REQUIRE_EQ(::rename(newPath.c_str(), partialPath.c_str()), 0);
+			CHECK(bitMan.GetBitStream(bitstream, designID, 3, bitfileID, 5, NTV2_BITFILE_FLAG_PARTIAL));
+			CHECK_EQ(bitMan.GetStats().fMappingsDropped, ULWord(1));
+			CHECK_EQ(bitMan.GetStats().fBitstreamsRead, ULWord(1));
+			REQUIRE_EQ(bitstream.GetByteCount(), ULWord(8192));
+			CHECK_EQ(bitstream.U8(8191), UByte(0x66));
+		}
+
+		//	Change one file -- only it gets parsed again...
+		REQUIRE(bitfileTestWrite(partialPath, DEVICE_ID_KONA5, 3, 6, "PARTIAL=TRUE", 12288, 0x33));
+		{
+			CNTV2BitfileManager bitMan;
+			bitMan.SetUseCatalog(true);
+			CHECK(bitMan.AddDirectory(dir));
+			CHECK_EQ(bitMan.GetStats().fHeadersParsed, ULWord(1));
+			CHECK_EQ(bitMan.GetStats().fCatalogHits, ULWord(2));
+			CHECK_EQ(bitMan.GetStats().fCatalogsWritten, ULWord(1));
+			NTV2Buffer bitstream;
+			CHECK(bitMan.GetBitStream(bitstream, designID, 3, bitfileID, 6, NTV2_BITFILE_FLAG_PARTIAL));
+			CHECK_EQ(bitstream.GetByteCount(), ULWord(12288));
+			CHECK_FALSE(bitMan.GetBitStream(bitstream, designID, 3, bitfileID, 5, NTV2_BITFILE_FLAG_PARTIAL));
+		}
+
+		//	Same size, same whole-second mtime -- the nanoseconds still give it away...
+		struct stat st;
+		REQUIRE_EQ(::stat(partialPath.c_str(), &st), 0);
+		REQUIRE(bitfileTestWrite(partialPath, DEVICE_ID_KONA5, 3, 7, "PARTIAL=TRUE", 12288, 0x44));
+		struct timespec times[2];
+		times[0].tv_sec = times[1].tv_sec = st.st_mtime;
+		times[0].tv_nsec = times[1].tv_nsec = 123456789;
+		REQUIRE_EQ(::utimensat(AT_FDCWD, partialPath.c_str(), times, 0), 0);
+		{
+			CNTV2BitfileManager bitMan;
+			bitMan.SetUseCatalog(true);
+			CHECK(bitMan.AddDirectory(dir));
+			CHECK_EQ(bitMan.GetStats().fHeadersParsed, ULWord(1));
+			CHECK_EQ(bitMan.GetStats().fCatalogHits, ULWord(2));
+			NTV2Buffer bitstream;
+			CHECK(bitMan.GetBitStream(bitstream, designID, 3, bitfileID, 7, NTV2_BITFILE_FLAG_PARTIAL));
+		}
+
+		//	Replaced by rename with identical size and mtime -- the inode gives it away...
+		const string tmpPath(dir + "/partial.tmp");
+		REQUIRE(bitfileTestWrite(tmpPath, DEVICE_ID_KONA5, 3, 8, "PARTIAL=TRUE", 12288, 0x55));
+		REQUIRE_EQ(::utimensat(AT_FDCWD, tmpPath.c_str(), times, 0), 0);
+		REQUIRE_EQ(::rename(tmpPath.c_str(), partialPath.c_str()), 0);
+		{
+			CNTV2BitfileManager bitMan;
+			bitMan.SetUseCatalog(true);
+			CHECK(bitMan.AddDirectory(dir));
+			CHECK_EQ(bitMan.GetStats().fHeadersParsed, ULWord(1));
+			CHECK_EQ(bitMan.GetStats().fCatalogHits, ULWord(2));
+			NTV2Buffer bitstream;
+			CHECK(bitMan.GetBitStream(bitstream, designID, 3, bitfileID, 8, NTV2_BITFILE_FLAG_PARTIAL));
+		}
+
+		//	Remove one file -- the catalog is pruned...
+		CHECK_EQ(::unlink(junkPath.c_str()), 0);
+		{
+			CNTV2BitfileManager bitMan;
+			bitMan.SetUseCatalog(true);
+			CHECK(bitMan.AddDirectory(dir));
+			CHECK_EQ(bitMan.GetStats().fHeadersParsed, ULWord(0));
+			CHECK_EQ(bitMan.GetStats().fCatalogHits, ULWord(2));
+			CHECK_EQ(bitMan.GetStats().fCatalogsWritten, ULWord(1));
+		}
+		{	//	Catalog disabled -- every header is parsed...
+			CNTV2BitfileManager bitMan;
+			bitMan.SetUseCatalog(false);
+			CHECK(bitMan.AddDirectory(dir));
+			CHECK_EQ(bitMan.GetNumBitfiles(), size_t(2));
+			CHECK_EQ(bitMan.GetStats().fHeadersParsed, ULWord(2));
+			CHECK_EQ(bitMan.GetStats().fCatalogHits, ULWord(0));
+			CHECK_EQ(bitMan.GetStats().fCatalogsWritten, ULWord(0));
+		}
+
+		::unlink(clearPath.c_str());
+		::unlink(partialPath.c_str());
+		::unlink(catalogPath.c_str());
+		CHECK_EQ(::rmdir(dir.c_str()), 0);
+	}	//	TEST_CASE("Catalog")
+}	//	TEST_SUITE("CNTV2BitfileManager")
+#endif	//	defined(AJALinux) || defined(AJAMac)
+
 #if 0
 TEST_SUITE("NTV2SWDevice" * doctest::description("NTV2SWDevice tests"))
 {
@@ -138,8 +138,8 @@ AJAStatus NTV2Burn::Init (void)
 	RouteInputSignal();
 	RouteOutputSignal();
 
-	//	Lastly, prepare my AJATimeCodeBurn instance...
-	mTCBurner.RenderTimeCodeFont (CNTV2DemoCommon::GetAJAPixelFormat (mConfig.fPixelFormat), mFormatDesc.numPixels, mFormatDesc.numLines);
+	//	Lastly, prepare my NTV2TimeCodeBurner instance...
+	mTCBurner.Prepare (mFormatDesc);
 	//	Ready to go...
 	if (mConfig.IsVerbose() || sShowConfig)
 	{	cerr << mConfig
@@ -803,9 +803,7 @@ void NTV2Burn::CaptureFrames (void)
 			}
 
 			//	While this NTV2FrameData's buffers are locked, "burn" timecode into the raster...
-			NTV2Buffer visibleRgn (mFormatDesc.GetTopVisibleRowAddress(pFrameData->VideoBuffer()),
-									mFormatDesc.GetVisibleRasterBytes());
-			mTCBurner.BurnTimeCode (visibleRgn, timeCodeString.c_str(), yPercent.Next());
+			mTCBurner.BurnTimeCode (pFrameData->VideoBuffer(), mFormatDesc, timeCodeString, yPercent.Next());
 
 			//	Signal that we're done "producing" this frame, making it available for future "consumption"...
 			mFrameDataRing.EndProduceNextBuffer();
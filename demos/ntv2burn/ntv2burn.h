@@ -11,10 +11,10 @@
 #include "ntv2card.h"
 #include "ntv2formatdescriptor.h"
 #include "ntv2democommon.h"
+#include "ntv2timecodeburner.h"
 #include "ajabase/common/types.h"
 #include "ajabase/common/circularbuffer.h"
 #include "ajabase/system/thread.h"
-#include "ajabase/common/timecodeburn.h"
 
 
 /**
@@ -154,7 +154,7 @@ class NTV2Burn
 		NTV2FormatDesc		mFormatDesc;		///< @brief	Describes raster images
 		NTV2TaskMode		mSavedTaskMode;		///< @brief	For restoring prior state
 		NTV2AudioSystem		mAudioSystem;		///< @brief	The audio system I'm using
-		AJATimeCodeBurn		mTCBurner;			///< @brief	My timecode burner
+		NTV2TimeCodeBurner	mTCBurner;			///< @brief	My timecode burner
 		NTV2TCIndexes		mTCOutputs;			///< @brief	My output timecode destinations
 		NTV2FrameDataArray	mHostBuffers;		///< @brief	My host buffers
 		CircularBuffer		mFrameDataRing;		///< @brief	AJACircularBuffer that controls frame data access by producer/consumer threads
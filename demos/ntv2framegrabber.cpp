@@ -472,11 +472,12 @@ void NTV2FrameGrabber::run (void)
 			mNTV2Card.AutoCirculateTransfer (mChannel, mTransferStruct);
 			if (!mFormatIsProgressive && mDeinterlace)
 			{
-				//	Eliminate field flicker by copying even lines to odd lines...
-				//	(a very lame de-interlace technique)
+				//	Eliminate field flicker (in place)...
 				if (currentImage->height() == int(mFrameDimensions.height())  &&  currentImage->width() == int(mFrameDimensions.width()))
-					for (ULWord line (0);  line < mFrameDimensions.height();  line += 2)
-						::memcpy (currentImage->scanLine (int(line) + 1),  currentImage->scanLine(int(line)),  mFrameDimensions.width() * 4);
+				{
+					NTV2Buffer	imageBuffer (currentImage->bits(), mTransferStruct.acVideoBuffer.GetByteCount());
+					mDeinterlacer.DeinterlaceFrame (imageBuffer, imageBuffer, NTV2FormatDescriptor(mFrameDimensions, mFrameBufferFormat));
+				}
 			}
 			GrabCaptions();
 			mTimeCode.clear ();
@@ -24,6 +24,7 @@
 #include "ntv2card.h"
 #include "ntv2enums.h"
 #include "ntv2rp188.h"
+#include "ntv2verticalfilter.h"
 #include "ajabase/common/types.h"
 #include "ajabase/system/process.h"
 #if defined (INCLUDE_AJACC)
@@ -192,6 +193,7 @@ class NTV2FrameGrabber : public QThread
 		ULWord						mNumAudioChannels;		///< @brief	Number of audio channels being captured on the AJA device
 		NTV2AudioSystem				mAudioSystem;			///< @brief	Audio subsystem to use
 
+		NTV2Deinterlacer			mDeinterlacer;			///< @brief	De-interlaces non-progressive video (motion-adaptive)
 		std::string					mTimeCode;				///< @brief	Currently displayed timecode
 		NTV2TCIndex					mTimeCodeSource;		///< @brief	Timecode source
 		#if defined (INCLUDE_AJACC)
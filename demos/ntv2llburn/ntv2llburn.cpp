@@ -152,8 +152,8 @@ AJAStatus NTV2LLBurn::Init (void)
 	if (NTV2_IS_ANALOG_TIMECODE_INDEX(mConfig.fTimecodeSource))
 		mDevice.SetLTCInputEnable(true);	//	Enable analog LTC input (some LTC inputs are shared with reference input)
 
-	//	Lastly, prepare my AJATimeCodeBurn instance...
-	mTCBurner.RenderTimeCodeFont (CNTV2DemoCommon::GetAJAPixelFormat (mConfig.fPixelFormat), mFormatDesc.numPixels, mFormatDesc.numLines);
+	//	Lastly, prepare my NTV2TimeCodeBurner instance...
+	mTCBurner.Prepare (mFormatDesc);
 	//	Ready to go...
 	if (mConfig.IsVerbose())
 	{	cerr << mConfig
@@ -785,7 +785,7 @@ void NTV2LLBurn::ProcessFrames (void)
 		}
 
 		//	"Burn" the timecode into the host buffer while we have full access to it...
-		mTCBurner.BurnTimeCode (reinterpret_cast <char *> (mpHostVideoBuffer.GetHostPointer()), timeCodeString.c_str(), yPercent.Next());
+		mTCBurner.BurnTimeCode (mpHostVideoBuffer, mFormatDesc, timeCodeString, yPercent.Next());
 
 		if (mConfig.WithAudio())
 		{
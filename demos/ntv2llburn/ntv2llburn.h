@@ -12,11 +12,11 @@
 #include "ntv2devicefeatures.h"
 #include "ntv2devicescanner.h"
 #include "ntv2democommon.h"
+#include "ntv2timecodeburner.h"
 #include "ntv2utils.h"
 #include "ajabase/common/types.h"
 #include "ajabase/common/videotypes.h"
 #include "ajabase/common/timecode.h"
-#include "ajabase/common/timecodeburn.h"
 #include "ajabase/system/thread.h"
 #include "ajabase/system/process.h"
 #include "ajabase/system/systemtime.h"
@@ -135,7 +135,7 @@ class NTV2LLBurn
 		NTV2TaskMode		mSavedTaskMode;			///< @brief	For restoring prior state
 		NTV2OutputDest		mOutputDest;			///< @brief	The desired output connector to use
 		NTV2AudioSystem		mAudioSystem;			///< @brief	The audio system I'm using
-		AJATimeCodeBurn		mTCBurner;				///< @brief	My timecode burner
+		NTV2TimeCodeBurner	mTCBurner;				///< @brief	My timecode burner
 
 		bool				mGlobalQuit;			///< @brief	Set "true" to gracefully stop
 		NTV2ChannelSet		mRP188Outputs;			///< @brief	SDI outputs into which I'll inject timecode
@@ -595,6 +595,7 @@ NTV2VCAM::~NTV2VCAM()
 	#if defined(AJALinux)
 	if (mLbDisplay > 0)
 	{
+		ReleaseV4L2Buffers();
 		close(mLbDisplay);
 		#if !defined(AJA_MISSING_DEV_V4L2LOOPBACK)
 		if (ioctl(mLbDevice, V4L2LOOPBACK_CTL_REMOVE, mLbDeviceNR) == -1)
@@ -630,11 +631,13 @@ NTV2VCAM::~NTV2VCAM()
 bool NTV2VCAM::Initialize (int argc, const char** argv)
 {
 	{	//	Parse command-line params...
-		int showVersion(0), useHDMI(0), inputChannel(0);
+		int showVersion(0), useHDMI(0), inputChannel(0), statsSeconds(0);
 		char * pAjaDevSpec = AJA_NULL;
 		char * pPixFormat = AJA_NULL;
 		char * pVideoDevice = AJA_NULL;
 		char * pAudioDevice = AJA_NULL;
+		char * pIOMode = AJA_NULL;
+		char * pV4L2Format = AJA_NULL;
 		const CNTV2DemoCommon::PoptOpts optionsTable[] =
 		{
 			{"version",		'v', POPT_ARG_NONE,		&showVersion,	0,	"NTV2 version",				AJA_NULL},
@@ -645,6 +648,9 @@ bool NTV2VCAM::Initialize (int argc, const char** argv)
 			{"vdev",		'i', POPT_ARG_STRING,	&pVideoDevice,	0,	"video device",				"/dev/video1"},
 			{"adev",		'u', POPT_ARG_STRING,	&pAudioDevice,	0,	"audio device",				"hw:Loopback,1,1"},
 			{"audiolinks",	'a', POPT_ARG_INT,		&mNumAudioLinks,0,	"multilink audio systems",	"0 for silence or 1-4"},
+			{"iomode",		'm', POPT_ARG_STRING,	&pIOMode,		0,	"V4L2 I/O method",			"mmap (default), userptr or write"},
+			{"v4l2format",	'f', POPT_ARG_STRING,	&pV4L2Format,	0,	"V4L2 pixel format",		"uyvy (default), yuyv or nv12"},
+			{"stats",		's', POPT_ARG_INT,		&statsSeconds,	0,	"report latency & CPU",		"every N seconds"},
 			POPT_AUTOHELP
 			POPT_TABLEEND
 		};
@@ -660,6 +666,23 @@ bool NTV2VCAM::Initialize (int argc, const char** argv)
 		mPixelFormatStr = pPixFormat ? pPixFormat : "2vuy";
 		mVideoDevice = pVideoDevice ? pVideoDevice : "";
 		mAudioDevice = pAudioDevice ? pAudioDevice : "";
+		mV4L2FormatStr = pV4L2Format ? pV4L2Format : "uyvy";
+		aja::lower(mV4L2FormatStr);
+		mStatsSeconds = statsSeconds > 0 ? ULWord(statsSeconds) : 0;
+		string ioModeStr (pIOMode ? pIOMode : "mmap");
+		aja::lower(ioModeStr);
+		if (ioModeStr == "mmap")
+			mIOMode = VCAM_IO_MMAP;
+		else if (ioModeStr == "userptr")
+			mIOMode = VCAM_IO_USERPTR;
+		else if (ioModeStr == "write")
+			mIOMode = VCAM_IO_WRITE;
+		else
+		{
+			cerr << "## ERROR: Invalid I/O method '" << ioModeStr << "' -- expected 'mmap', 'userptr' or 'write'" << endl;
+			mErrorCode = AJA_VW_INVALIDARGS;
+			return false;
+		}
 		if (showVersion)
 		{
 			cout << argv[0] << ", NTV2 SDK " << NTV2Version() << endl;
@@ -1064,16 +1087,8 @@ bool NTV2VCAM::Initialize()
 		return false;
 	}
 
-	struct v4l2_format lbFormat;
-	memset(&lbFormat, 0, sizeof(lbFormat));
-	lbFormat.type = V4L2_BUF_TYPE_VIDEO_OUTPUT;
-	lbFormat.fmt.pix.width = mFormatDesc.GetRasterWidth();
-	lbFormat.fmt.pix.height = mFormatDesc.GetRasterHeight();
-	lbFormat.fmt.pix.field = V4L2_FIELD_NONE;
-	lbFormat.fmt.pix.colorspace = V4L2_COLORSPACE_REC709;
-	lbFormat.fmt.pix.pixelformat = V4L2_PIX_FMT_UYVY;
-	if (ioctl(mLbDisplay, VIDIOC_S_FMT, &lbFormat) == -1)
-		cerr << "## ERROR (" << errno << "): cannot set video format on video loopback device" << endl;
+	if (!SetupV4L2Format())
+		return false;
 
 	struct v4l2_streamparm streamParm;
 	memset(&streamParm, 0, sizeof(streamParm));
@@ -1082,6 +1097,9 @@ bool NTV2VCAM::Initialize()
 	streamParm.parm.output.timeperframe.denominator = GetFps();
 	if (ioctl(mLbDisplay, VIDIOC_S_PARM, &streamParm) == -1)
 		cerr << "## ERROR (" << errno << "): cannot set frame rate on video loopback device" << endl;
+
+	if (!SetupV4L2Buffers())
+		return false;
 	#endif	//	AJALinux
 
 	bool retVal = false;
@@ -1204,11 +1222,28 @@ bool NTV2VCAM::Initialize()
 				return false;
 			if (acStatus.IsRunning() && acStatus.HasAvailableInputFrame())
 			{
+				const uint64_t startUS (AJATime::GetSystemMicroseconds());
+				const int bufferIndex (AcquireV4L2Buffer());
+				if (mIOMode != VCAM_IO_WRITE  &&  bufferIndex < 0)
+					{cerr << "## ERROR (" << errno << "): no V4L2 buffer available" << endl;  mErrorCode = AJA_VW_V4L2BUFFERSFAILED;  return false;}
+				if (mDirectDMA)
+					mAcTransfer.SetVideoBuffer(mV4L2Buffers.at(size_t(bufferIndex)), mV4L2Buffers.at(size_t(bufferIndex)).GetByteCount());
 				if (!mDevice.AutoCirculateTransfer(mInputChannel, mAcTransfer))
 					{cerr << "## ERROR: AC transfer failed" << endl;  mErrorCode = AJA_VW_ACTRANSFERFAILED;  return false;}
 
-				if (write(mLbDisplay, mVideoBuffer, mVideoBuffer.GetByteCount()) == -1)
-					cerr << "## ERROR (" << errno << "): write to video loopback device failed" << endl;
+				if (!DeliverFrame(bufferIndex))
+					cerr << "## ERROR (" << errno << "): failed to deliver frame to video loopback device" << endl;
+				else if (mStatsSeconds)
+				{	//	Latency:  VBI (when the frame started arriving) until it was handed to the loopback device...
+					const FRAME_STAMP & stamp (mAcTransfer.GetFrameInfo());
+					const uint64_t hostUS (AJATime::GetSystemMicroseconds() - startUS);
+					const uint64_t latencyUS (hostUS + (stamp.acCurrentTime > stamp.acFrameTime ? uint64_t(stamp.acCurrentTime - stamp.acFrameTime) / 10 : 0));
+					mStats.fLatencyUS += latencyUS;
+					if (latencyUS > mStats.fMaxLatencyUS)
+						mStats.fMaxLatencyUS = latencyUS;
+					if (++mStats.fFrames >= mStatsSeconds * ULWord(GetFps()))
+						ReportStats();
+				}
 
 				if (mAudioBuffer)
 				{
@@ -1623,6 +1658,242 @@ bool NTV2VCAM::GetInputRouting4K(NTV2XptConnections& conns, const bool isInputRG
 			i--;
 		return stoi(s.substr(i + 1));
 	}
+
+	//	Negotiates the V4L2 pixel format & geometry
+	bool NTV2VCAM::SetupV4L2Format (void)
+	{
+		static const struct {const char * fName;  uint32_t fFourCC;  NTV2PixelFormat fPixelFormat;} sFormats[] = {
+			{"uyvy",	V4L2_PIX_FMT_UYVY,	NTV2_FBF_8BIT_YCBCR},
+			{"yuyv",	V4L2_PIX_FMT_YUYV,	NTV2_FBF_8BIT_YCBCR_YUY2},
+			{"nv12",	V4L2_PIX_FMT_NV12,	NTV2_FBF_8BIT_YCBCR_420PL2}};
+		static const size_t sNumFormats (sizeof(sFormats) / sizeof(sFormats[0]));
+		size_t ndx(0);
+		while (ndx < sNumFormats  &&  mV4L2FormatStr != sFormats[ndx].fName)
+			ndx++;
+		if (ndx >= sNumFormats)
+		{
+			cerr << "## ERROR: Invalid V4L2 pixel format '" << mV4L2FormatStr << "' -- expected 'uyvy', 'yuyv' or 'nv12'" << endl;
+			mErrorCode = AJA_VW_V4L2FORMATFAILED;
+			return false;
+		}
+
+		struct v4l2_format lbFormat;
+		memset(&lbFormat, 0, sizeof(lbFormat));
+		lbFormat.type = V4L2_BUF_TYPE_VIDEO_OUTPUT;
+		lbFormat.fmt.pix.width = mFormatDesc.GetRasterWidth();
+		lbFormat.fmt.pix.height = mFormatDesc.GetVisibleRasterHeight();
+		lbFormat.fmt.pix.field = V4L2_FIELD_NONE;
+		lbFormat.fmt.pix.colorspace = V4L2_COLORSPACE_REC709;
+		lbFormat.fmt.pix.pixelformat = sFormats[ndx].fFourCC;
+		if (ioctl(mLbDisplay, VIDIOC_S_FMT, &lbFormat) == -1)
+			cerr << "## ERROR (" << errno << "): cannot set video format on video loopback device" << endl;
+		else if (ioctl(mLbDisplay, VIDIOC_G_FMT, &lbFormat) == -1)
+			cerr << "## ERROR (" << errno << "): cannot get video format of video loopback device" << endl;
+
+		//	The driver may have picked a different format -- accept any of the others I support...
+		if (lbFormat.fmt.pix.pixelformat != sFormats[ndx].fFourCC)
+			for (ndx = 0;  ndx < sNumFormats;  ndx++)
+				if (lbFormat.fmt.pix.pixelformat == sFormats[ndx].fFourCC)
+					{cerr << "## WARNING: Video loopback device chose pixel format '" << sFormats[ndx].fName << "'" << endl;  break;}
+		if (ndx >= sNumFormats)
+		{
+			cerr << "## ERROR: Video loopback device rejected all supported pixel formats" << endl;
+			mErrorCode = AJA_VW_V4L2FORMATFAILED;
+			return false;
+		}
+		mV4L2FourCC = sFormats[ndx].fFourCC;
+		mV4L2PixelFormat = sFormats[ndx].fPixelFormat;
+		mV4L2FormatDesc = NTV2FormatDescriptor(mVideoFormat, mV4L2PixelFormat);
+		mV4L2ImageSize = lbFormat.fmt.pix.sizeimage ? lbFormat.fmt.pix.sizeimage : mV4L2FormatDesc.GetTotalBytes();
+		if (lbFormat.fmt.pix.width != mV4L2FormatDesc.GetRasterWidth()
+			||  lbFormat.fmt.pix.height != mV4L2FormatDesc.GetVisibleRasterHeight()
+			||  (lbFormat.fmt.pix.bytesperline  &&  lbFormat.fmt.pix.bytesperline != mV4L2FormatDesc.GetBytesPerRow())
+			||  mV4L2ImageSize < mV4L2FormatDesc.GetTotalBytes())
+		{
+			cerr << "## ERROR: Video loopback device geometry " << lbFormat.fmt.pix.width << "x" << lbFormat.fmt.pix.height
+				<< " (" << lbFormat.fmt.pix.bytesperline << " bytes/row) doesn't match " << mV4L2FormatDesc.GetRasterWidth()
+				<< "x" << mV4L2FormatDesc.GetVisibleRasterHeight() << " (" << mV4L2FormatDesc.GetBytesPerRow() << " bytes/row)" << endl;
+			mErrorCode = AJA_VW_V4L2FORMATFAILED;
+			return false;
+		}
+		if (mV4L2PixelFormat != mPixelFormat  &&  !NTV2FrameConverter::CanConvert(mPixelFormat, mV4L2PixelFormat))
+		{
+			cerr << "## ERROR: Can't convert " << ::NTV2FrameBufferFormatToString(mPixelFormat) << " to V4L2 '" << mV4L2FormatStr << "'" << endl;
+			mErrorCode = AJA_VW_V4L2FORMATFAILED;
+			return false;
+		}
+		return true;
+	}	//	SetupV4L2Format
+
+	//	Sets up the V4L2 buffer queue (falling back to write() if the driver can't do the requested I/O method)
+	bool NTV2VCAM::SetupV4L2Buffers (void)
+	{
+		//	Frames can be DMA'd straight into the V4L2 buffers if they're mine, and no conversion is needed...
+		const bool sameFormat (mV4L2PixelFormat == mPixelFormat  &&  mV4L2FormatDesc.GetTotalBytes() == mFormatDesc.GetTotalRasterBytes());
+		if (mIOMode == VCAM_IO_WRITE)
+		{
+			if (!sameFormat)
+				mWriteBuffer.Allocate(mV4L2ImageSize);
+			return true;
+		}
+
+		struct v4l2_requestbuffers req;
+		memset(&req, 0, sizeof(req));
+		req.count = 4;
+		req.type = V4L2_BUF_TYPE_VIDEO_OUTPUT;
+		req.memory = mIOMode == VCAM_IO_MMAP ? V4L2_MEMORY_MMAP : V4L2_MEMORY_USERPTR;
+		if (ioctl(mLbDisplay, VIDIOC_REQBUFS, &req) == -1  ||  req.count < 2)
+		{
+			cerr << "## WARNING (" << errno << "): video loopback device can't do " << (mIOMode == VCAM_IO_MMAP ? "mmap" : "userptr")
+				<< " streaming -- using write() instead" << endl;
+			mIOMode = VCAM_IO_WRITE;
+			return SetupV4L2Buffers();
+		}
+
+		mV4L2Buffers.resize(req.count);
+		mV4L2Queued.assign(req.count, false);
+		for (ULWord ndx(0);  ndx < req.count;  ndx++)
+		{
+			if (mIOMode == VCAM_IO_MMAP)
+			{
+				struct v4l2_buffer buf;
+				memset(&buf, 0, sizeof(buf));
+				buf.type = V4L2_BUF_TYPE_VIDEO_OUTPUT;
+				buf.memory = V4L2_MEMORY_MMAP;
+				buf.index = ndx;
+				if (ioctl(mLbDisplay, VIDIOC_QUERYBUF, &buf) == -1)
+					{cerr << "## ERROR (" << errno << "): VIDIOC_QUERYBUF failed" << endl;  mErrorCode = AJA_VW_V4L2BUFFERSFAILED;  return false;}
+				void * pMapped (mmap(AJA_NULL, buf.length, PROT_READ | PROT_WRITE, MAP_SHARED, mLbDisplay, buf.m.offset));
+				if (pMapped == MAP_FAILED)
+					{cerr << "## ERROR (" << errno << "): mmap of V4L2 buffer " << ndx << " failed" << endl;  mErrorCode = AJA_VW_V4L2BUFFERSFAILED;  return false;}
+				mV4L2Buffers[ndx].Set(pMapped, buf.length);	//	Not owned -- unmapped in ReleaseV4L2Buffers
+			}
+			else
+			{
+				mV4L2Buffers[ndx].Allocate(mV4L2ImageSize, /*pageAligned*/true);
+				if (sameFormat)
+					mDevice.DMABufferLock(mV4L2Buffers[ndx], true);
+			}
+		}
+		mDirectDMA = mIOMode == VCAM_IO_USERPTR  &&  sameFormat;
+		cout << "## NOTE: Streaming to V4L2 using " << DEC(req.count) << " " << (mIOMode == VCAM_IO_MMAP ? "mmap" : "userptr")
+			<< " buffers, " << (mDirectDMA ? "DMA'd directly" : "converted from host buffer") << endl;
+		return true;
+	}	//	SetupV4L2Buffers
+
+	void NTV2VCAM::ReleaseV4L2Buffers (void)
+	{
+		if (mV4L2Streaming)
+		{
+			int type (V4L2_BUF_TYPE_VIDEO_OUTPUT);
+			ioctl(mLbDisplay, VIDIOC_STREAMOFF, &type);
+			mV4L2Streaming = false;
+		}
+		for (size_t ndx(0);  ndx < mV4L2Buffers.size();  ndx++)
+			if (mIOMode == VCAM_IO_MMAP)
+				munmap(mV4L2Buffers[ndx].GetHostPointer(), mV4L2Buffers[ndx].GetByteCount());
+			else if (mDirectDMA)
+				mDevice.DMABufferUnlock(mV4L2Buffers[ndx]);
+		mV4L2Buffers.clear();
+		mV4L2Queued.clear();
+		if (mIOMode != VCAM_IO_WRITE)
+		{	//	Free the driver's buffers
+			struct v4l2_requestbuffers req;
+			memset(&req, 0, sizeof(req));
+			req.type = V4L2_BUF_TYPE_VIDEO_OUTPUT;
+			req.memory = mIOMode == VCAM_IO_MMAP ? V4L2_MEMORY_MMAP : V4L2_MEMORY_USERPTR;
+			ioctl(mLbDisplay, VIDIOC_REQBUFS, &req);
+		}
+	}	//	ReleaseV4L2Buffers
+
+	//	Returns the index of a V4L2 buffer I can fill, waiting for the driver to hand one back if necessary
+	int NTV2VCAM::AcquireV4L2Buffer (void)
+	{
+		if (mIOMode == VCAM_IO_WRITE)
+			return -1;
+		for (size_t ndx(0);  ndx < mV4L2Queued.size();  ndx++)
+			if (!mV4L2Queued[ndx])
+				return int(ndx);	//	Never queued yet
+		struct v4l2_buffer buf;
+		memset(&buf, 0, sizeof(buf));
+		buf.type = V4L2_BUF_TYPE_VIDEO_OUTPUT;
+		buf.memory = mIOMode == VCAM_IO_MMAP ? V4L2_MEMORY_MMAP : V4L2_MEMORY_USERPTR;
+		if (ioctl(mLbDisplay, VIDIOC_DQBUF, &buf) == -1  ||  buf.index >= mV4L2Queued.size())
+			return -1;
+		mV4L2Queued[buf.index] = false;
+		return int(buf.index);
+	}	//	AcquireV4L2Buffer
+
+	//	Converts the captured frame (if it wasn't DMA'd directly) and hands it to the loopback device
+	bool NTV2VCAM::DeliverFrame (const int inBufferIndex)
+	{
+		const bool needsConversion (mV4L2PixelFormat != mPixelFormat  ||  mV4L2FormatDesc.GetTotalBytes() != mFormatDesc.GetTotalRasterBytes());
+		if (mIOMode == VCAM_IO_WRITE)
+		{
+			if (!needsConversion)
+				return write(mLbDisplay, mVideoBuffer, mVideoBuffer.GetByteCount()) != -1;
+			if (!mConverter.ConvertFrame(mVideoBuffer, mFormatDesc, mWriteBuffer, mV4L2FormatDesc))
+				return false;
+			mStats.fConvertUS += mConverter.getLastStats().fMicroseconds;
+			return write(mLbDisplay, mWriteBuffer, mWriteBuffer.GetByteCount()) != -1;
+		}
+		if (inBufferIndex < 0  ||  size_t(inBufferIndex) >= mV4L2Buffers.size())
+			return false;
+
+		NTV2Buffer & v4l2Buffer (mV4L2Buffers[size_t(inBufferIndex)]);
+		if (!mDirectDMA)
+		{
+			if (!mConverter.ConvertFrame(mVideoBuffer, mFormatDesc, v4l2Buffer, mV4L2FormatDesc))
+				return false;
+			mStats.fConvertUS += mConverter.getLastStats().fMicroseconds;
+		}
+
+		struct v4l2_buffer buf;
+		memset(&buf, 0, sizeof(buf));
+		buf.type = V4L2_BUF_TYPE_VIDEO_OUTPUT;
+		buf.index = ULWord(inBufferIndex);
+		buf.bytesused = mV4L2FormatDesc.GetTotalBytes();
+		buf.field = V4L2_FIELD_NONE;
+		if (mIOMode == VCAM_IO_MMAP)
+			buf.memory = V4L2_MEMORY_MMAP;
+		else
+		{
+			buf.memory = V4L2_MEMORY_USERPTR;
+			buf.m.userptr = reinterpret_cast<unsigned long>(v4l2Buffer.GetHostPointer());
+			buf.length = v4l2Buffer.GetByteCount();
+		}
+		if (ioctl(mLbDisplay, VIDIOC_QBUF, &buf) == -1)
+			return false;
+		mV4L2Queued[size_t(inBufferIndex)] = true;
+		if (!mV4L2Streaming)
+		{
+			int type (V4L2_BUF_TYPE_VIDEO_OUTPUT);
+			if (ioctl(mLbDisplay, VIDIOC_STREAMON, &type) == -1)
+				return false;
+			mV4L2Streaming = true;
+		}
+		return true;
+	}	//	DeliverFrame
+
+	void NTV2VCAM::ReportStats (void)
+	{
+		struct rusage usage;
+		if (getrusage(RUSAGE_THREAD, &usage) == 0)
+		{	//	CPU time is cumulative -- report the difference since last time
+			static uint64_t sLastCPUUS (0);
+			const uint64_t cpuUS (uint64_t(usage.ru_utime.tv_sec + usage.ru_stime.tv_sec) * 1000000
+									+ uint64_t(usage.ru_utime.tv_usec + usage.ru_stime.tv_usec));
+			mStats.fCPUUS = cpuUS - sLastCPUUS;
+			sLastCPUUS = cpuUS;
+		}
+		const uint64_t frames (mStats.fFrames ? mStats.fFrames : 1);
+		cout << "## STATS: " << DEC(mStats.fFrames) << " frames, latency avg " << DEC(mStats.fLatencyUS / frames)
+			<< "us max " << DEC(mStats.fMaxLatencyUS) << "us, convert " << DEC(mStats.fConvertUS / frames)
+			<< "us/frame, CPU " << DEC(mStats.fCPUUS / frames) << "us/frame ("
+			<< (mIOMode == VCAM_IO_WRITE ? "write" : (mIOMode == VCAM_IO_MMAP ? "mmap" : "userptr"))
+			<< (mDirectDMA ? ", direct DMA" : "") << ")" << endl;
+		mStats = VCamStats();
+	}	//	ReportStats
 #endif	//	AJALinux
 
 int NTV2VCAM::GetFps()
@@ -20,12 +20,16 @@
 #include <ntv2devicescanner.h>
 #include <ajabase/common/common.h>
 #include <ajabase/system/process.h>
+#include <ajabase/system/systemtime.h>
 #include "ntv2democommon.h"
+#include <ntv2frameconverter.h>
 
 #if defined(AJALinux)
 	//V4L headers
 	#include <linux/videodev2.h>
 	#include <sys/ioctl.h>
+	#include <sys/mman.h>
+	#include <sys/resource.h>
 	//ALSA headers
 	#include <alsa/asoundlib.h>
 #endif
@@ -97,6 +101,8 @@ using namespace std;
 #define AJA_VW_MISSINGARGS								45
 #define AJA_VW_GETPOINTERFAILED							46
 #define AJA_VW_SAMPLEBUFFERSIZEMISMATCH					47
+#define AJA_VW_V4L2FORMATFAILED							48
+#define AJA_VW_V4L2BUFFERSFAILED						49
 
 #if defined(AJA_WINDOWS)
 #define VCAM_FILTER_NAME_W L"AJA Virtual Webcam"
@@ -304,6 +310,29 @@ DEFINE_GUID(IID_IAjaFilterInterface,
 #endif	//	if defined(AJA_WINDOWS)
 
 #if defined(AJALinux)
+	/**
+		@brief	How video frames are handed to the V4L2 loopback device.
+	**/
+	typedef enum
+	{
+		VCAM_IO_WRITE,		///< @brief	write() each frame (the driver copies it)
+		VCAM_IO_MMAP,		///< @brief	Convert each frame into a driver-allocated (mmap'd) buffer, then queue it
+		VCAM_IO_USERPTR		///< @brief	Convert (or DMA) each frame into one of my own buffers, then queue it
+	} VCamIOMode;
+
+	/**
+		@brief	Per-frame timing, accumulated over each statistics interval.
+	**/
+	typedef struct VCamStats
+	{
+		ULWord		fFrames;			///< @brief	Frames delivered
+		uint64_t	fLatencyUS;			///< @brief	Total VBI-to-delivery latency, in microseconds
+		uint64_t	fMaxLatencyUS;		///< @brief	Worst VBI-to-delivery latency, in microseconds
+		uint64_t	fConvertUS;			///< @brief	Total conversion time, in microseconds
+		uint64_t	fCPUUS;				///< @brief	Total thread CPU time (user + system), in microseconds
+		inline VCamStats () : fFrames(0), fLatencyUS(0), fMaxLatencyUS(0), fConvertUS(0), fCPUUS(0)	{}
+	} VCamStats;
+
 	class NTV2VCAM
 	{
 		public:		//	PUBLIC INSTANCE METHODS
@@ -321,6 +350,12 @@ DEFINE_GUID(IID_IAjaFilterInterface,
 			bool	GetInputRouting4K(NTV2XptConnections& conns, const bool isInputRGB);
 #if defined(AJALinux)
 			int		ExtractNumber(const char* str);
+			bool	SetupV4L2Format (void);
+			bool	SetupV4L2Buffers (void);
+			void	ReleaseV4L2Buffers (void);
+			int		AcquireV4L2Buffer (void);
+			bool	DeliverFrame (const int inBufferIndex);
+			void	ReportStats (void);
 #endif	//	if defined(AJALinux)
 			int		GetFps();
 
@@ -365,6 +400,20 @@ DEFINE_GUID(IID_IAjaFilterInterface,
 	#endif
 			int							mLbDeviceNR			= -1;
 			int							mLbDisplay			= -1;
+			VCamIOMode					mIOMode				= VCAM_IO_MMAP;
+			string						mV4L2FormatStr;
+			uint32_t					mV4L2FourCC			= V4L2_PIX_FMT_UYVY;
+			NTV2PixelFormat				mV4L2PixelFormat	= NTV2_FBF_8BIT_YCBCR;	//	Host equivalent of mV4L2FourCC
+			NTV2FormatDesc				mV4L2FormatDesc;
+			ULWord						mV4L2ImageSize		= 0;
+			vector<NTV2Buffer>			mV4L2Buffers;		//	mmap'd or userptr buffers
+			vector<bool>				mV4L2Queued;		//	Which of mV4L2Buffers the driver has
+			bool						mV4L2Streaming		= false;
+			bool						mDirectDMA			= false;	//	DMA straight into mV4L2Buffers?
+			NTV2Buffer					mWriteBuffer;		//	Converted frame (VCAM_IO_WRITE only)
+			NTV2FrameConverter			mConverter;
+			ULWord						mStatsSeconds		= 0;		//	Report stats this often (0 = never)
+			VCamStats					mStats;
 #endif	//	if defined(AJALinux)
 #if defined(AJA_WINDOWS)
 			bool						mInitialized		= false;
@@ -126,6 +126,9 @@ typedef struct ntv2_module_private
 typedef struct _fileData
 {
 	DMA_PAGE_ROOT dmaRoot;
+#if defined(AJA_NTV42)
+	uint64_t ntv42EventAck;		// ntv42 event sequence acknowledged for poll()
+#endif
 } FILE_DATA, *PFILE_DATA;
 
 typedef enum
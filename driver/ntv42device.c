@@ -10,8 +10,12 @@
 #include <linux/string.h>
 #include <linux/ktime.h>
 #include <linux/sched.h>
+#include <linux/gfp.h>
+#include <linux/mm.h>
+#include <linux/workqueue.h>
 
 #include "ntv42device.h"
+#include "ntv42ioctl.h"
 #include "ntv42message.h"
 
 
@@ -55,9 +59,33 @@ int ntv42device_create(ntv42_device_t** device, void* host)
         return NTV42_RETURN_NO_RESOURCES;
 
     dev = ntv42_device + i;
+
+    /* Event page is shared read-only with clients, so it gets a page of its own */
+    BUILD_BUG_ON(sizeof(ntv42_event_page_t) > PAGE_SIZE);
+    BUILD_BUG_ON(NTV42_EVENT_SLOT_MAX > NTV42_EVENT_SLOT_COUNT);
+    BUILD_BUG_ON(NTV42_DMA_QUEUE_ENGINES != NTV42_DMA_ENGINE_MAX);
+    dev->event_page = (ntv42_event_page_t*)get_zeroed_page(GFP_KERNEL);
+    if (dev->event_page == NULL)
+        return NTV42_RETURN_NO_MEMORY;
+
+    /* Asynchronous DMA transfers run one at a time, in submission order */
+    dev->dma_queue = alloc_ordered_workqueue("ntv42dev%d_dma", 0, i);
+    if (dev->dma_queue == NULL) {
+        free_page((unsigned long)dev->event_page);
+        dev->event_page = NULL;
+        return NTV42_RETURN_NO_MEMORY;
+    }
+    spin_lock_init(&dev->dma_lock);
+    dev->event_page->magic = NTV42_EVENT_PAGE_MAGIC;
+    dev->event_page->version = NTV42_EVENT_PAGE_VERSION;
+    dev->event_page->slot_count = NTV42_EVENT_SLOT_MAX;
+
     dev->index = i;
     dev->host = host;
     dev->state = ntv42device_state_init;
+    spin_lock_init(&dev->event_lock);
+    for (i = 0; i < NTV42_EVENT_SLOT_MAX; i++)
+        init_waitqueue_head(&dev->event_slot_wait[i]);
     init_waitqueue_head(&dev->event_wait);
 
     ntv42_info("ntv42dev%d: create device\n", dev->index);
@@ -84,6 +112,14 @@ int ntv42device_release(ntv42_device_t* device)
 
     ntv42_info("ntv42dev%d: release device\n", device->index);
 
+    /* Drain asynchronous transfers */
+    if (device->dma_queue != NULL)
+        destroy_workqueue(device->dma_queue);
+
+    /* Existing client mappings hold their own page references */
+    if (device->event_page != NULL)
+        free_page((unsigned long)device->event_page);
+
     memset (device, 0, sizeof(ntv42_device_t));
     return NTV42_RETURN_SUCCESS;
 }
@@ -147,7 +183,8 @@ int ntv42device_message(ntv42_device_t* device, void* message, uint32_t size)
 }
 
 /**
- * Event slot layout (flat index into event_count/event_enabled arrays):
+ * Event slot layout (flat index into event_count/event_enabled arrays and the
+ * event page, see NTV42_EVENT_SLOT_* in ntv42ioctl.h):
  *   0-7:   output_vsync[0..7]   (type 0x0001)
  *   8-15:  input_vsync[0..7]    (type 0x0002)
  *   16:    reference[0]         (type 0x0003)
@@ -156,27 +193,30 @@ int ntv42device_message(ntv42_device_t* device, void* message, uint32_t size)
  *   33-40: audio_out_wrap[0..7] (type 0x0201)
  *   41-48: output_anc[0..7]     (type 0x0005)
  *   49-56: input_anc[0..7]      (type 0x0006)
+ *   57-60: dma_complete[0..3]   (type 0x0100)
  * Returns -1 if type/index combination is not mapped.
  */
 int ntv42device_event_slot(uint32_t type, uint32_t index)
 {
     switch (type) {
     case 0x0001: /* output_vsync */
-        return (index < NTV42_EVENT_MAX_OUTPUTS) ? (int)(0 + index) : -1;
+        return (index < NTV42_EVENT_MAX_OUTPUTS) ? (int)(NTV42_EVENT_SLOT_OUTPUT_VSYNC + index) : -1;
     case 0x0002: /* input_vsync */
-        return (index < NTV42_EVENT_MAX_INPUTS) ? (int)(8 + index) : -1;
+        return (index < NTV42_EVENT_MAX_INPUTS) ? (int)(NTV42_EVENT_SLOT_INPUT_VSYNC + index) : -1;
     case 0x0003: /* reference */
-        return (index == 0) ? 16 : -1;
+        return (index == 0) ? NTV42_EVENT_SLOT_REFERENCE : -1;
     case 0x0004: /* input_change */
-        return (index < NTV42_EVENT_MAX_INPUTS) ? (int)(17 + index) : -1;
+        return (index < NTV42_EVENT_MAX_INPUTS) ? (int)(NTV42_EVENT_SLOT_INPUT_CHANGE + index) : -1;
     case 0x0005: /* output_anc */
-        return (index < NTV42_EVENT_MAX_OUTPUTS) ? (int)(41 + index) : -1;
+        return (index < NTV42_EVENT_MAX_OUTPUTS) ? (int)(NTV42_EVENT_SLOT_OUTPUT_ANC + index) : -1;
     case 0x0006: /* input_anc */
-        return (index < NTV42_EVENT_MAX_INPUTS) ? (int)(49 + index) : -1;
+        return (index < NTV42_EVENT_MAX_INPUTS) ? (int)(NTV42_EVENT_SLOT_INPUT_ANC + index) : -1;
+    case 0x0100: /* dma_complete */
+        return (index < NTV42_DMA_ENGINE_MAX) ? (int)(NTV42_EVENT_SLOT_DMA_COMPLETE + index) : -1;
     case 0x0200: /* audio_in_wrap */
-        return (index < 8) ? (int)(25 + index) : -1;
+        return (index < 8) ? (int)(NTV42_EVENT_SLOT_AUDIO_IN_WRAP + index) : -1;
     case 0x0201: /* audio_out_wrap */
-        return (index < 8) ? (int)(33 + index) : -1;
+        return (index < 8) ? (int)(NTV42_EVENT_SLOT_AUDIO_OUT_WRAP + index) : -1;
     default:
         return -1;
     }
@@ -194,6 +234,14 @@ extern void ntv42_regbatch_check(ntv42_device_t *device, uint32_t event_type, ui
 
 int ntv42device_event(ntv42_device_t* device, uint32_t type, uint32_t index)
 {
+    return ntv42device_event_time(device, type, index, ktime_get_ns());
+}
+
+int ntv42device_event_time(ntv42_device_t* device, uint32_t type, uint32_t index, uint64_t timestamp)
+{
+    ntv42_event_page_t* page;
+    unsigned long flags;
+    bool enabled;
     int slot;
 
     if ((device == NULL) || (device->state == ntv42device_state_unknown))
@@ -206,16 +254,58 @@ int ntv42device_event(ntv42_device_t* device, uint32_t type, uint32_t index)
     /* Execute any register batches triggered by this event (Phase 4) */
     ntv42_regbatch_check(device, type, index);
 
-    /* Increment counter and record timestamp */
-    device->event_count[slot]++;
-    device->event_timestamp[slot] = ktime_get_ns();
+    /* Increment counter and record timestamp, and mirror them in the event page */
+    spin_lock_irqsave(&device->event_lock, flags);
+    enabled = device->event_enabled[slot];
+    WRITE_ONCE(device->event_count[slot], device->event_count[slot] + 1);
+    device->event_timestamp[slot] = timestamp;
+    if (enabled)
+        WRITE_ONCE(device->event_sequence, device->event_sequence + 1);
+
+    page = device->event_page;
+    if (page != NULL) {
+        WRITE_ONCE(page->lock, page->lock + 1);
+        smp_wmb();
+        page->slot[slot].count = device->event_count[slot];
+        page->slot[slot].timestamp = device->event_timestamp[slot];
+        page->sequence = device->event_sequence;
+        smp_wmb();
+        WRITE_ONCE(page->lock, page->lock + 1);
+    }
+    spin_unlock_irqrestore(&device->event_lock, flags);
 
-    /* Wake anyone waiting for events on this device */
-    wake_up(&device->event_wait);
+    /* Wake only the waiters for this slot, and pollers if the slot is enabled */
+    wake_up(&device->event_slot_wait[slot]);
+    if (enabled)
+        wake_up(&device->event_wait);
 
     return NTV42_RETURN_SUCCESS;
 }
 
+void ntv42device_event_read(ntv42_device_t* device, int slot, uint64_t* count, uint64_t* timestamp)
+{
+    unsigned long flags;
+
+    spin_lock_irqsave(&device->event_lock, flags);
+    *count = device->event_count[slot];
+    *timestamp = device->event_timestamp[slot];
+    spin_unlock_irqrestore(&device->event_lock, flags);
+}
+
+uint64_t ntv42device_event_sequence(ntv42_device_t* device)
+{
+    unsigned long flags;
+    uint64_t sequence;
+
+    if (device == NULL)
+        return 0;
+
+    spin_lock_irqsave(&device->event_lock, flags);
+    sequence = device->event_sequence;
+    spin_unlock_irqrestore(&device->event_lock, flags);
+    return sequence;
+}
+
 static int ntv42device_do_info(ntv42_device_t* device, ntv42_message_device_info_t* message)
 {
     if ((device == NULL) || (device->state == ntv42device_state_unknown))
@@ -12,6 +12,8 @@
 
 #include <linux/types.h>
 #include <linux/wait.h>
+#include <linux/spinlock.h>
+#include <linux/workqueue.h>
 
 #define NTV42_RETURN_SUCCESS        (0)
 #define NTV42_RETURN_FAIL           (-EAGAIN)
@@ -36,6 +38,11 @@
 /** Maximum event slots per device (covers all type+index combinations) */
 #define NTV42_EVENT_SLOT_MAX    64
 
+/** Asynchronous DMA queue depth and completion history per device */
+#define NTV42_DMA_ASYNC_MAX     32
+#define NTV42_DMA_HISTORY_MAX   64
+#define NTV42_DMA_QUEUE_ENGINES 4
+
 /** Maximum outputs/inputs for event mapping */
 #define NTV42_EVENT_MAX_OUTPUTS 8
 #define NTV42_EVENT_MAX_INPUTS  8
@@ -64,6 +71,7 @@ typedef struct ntv42_bar_t {
     uint64_t                address;                            // Bar base address
     uint64_t                size;                               // Bar size
     uint32_t                width;                              // Width for bar access
+    void*                   memory;                             // Kernel memory backing the bar (memory-backed devices), or NULL
     int                     (*reg_read)(void* host, void* id, ntv42device_regio_t* regio);
     int                     (*reg_write)(void* host, void* id, ntv42device_regio_t* regio);
 } ntv42_bar_t;
@@ -74,6 +82,14 @@ typedef struct ntv42_device_config_t {
     char                    serial[NTV42_DEVICE_DESC_MAX];      // Serial number or other way to uniquely identify the device
 } ntv42_device_config_t;
 
+typedef struct ntv42_dma_result_t {
+    uint64_t                transfer_id;                        // Transfer sequence number (0 = unused)
+    uint64_t                bytes_xfered;                       // Bytes transferred
+    uint64_t                elapsed_ns;                         // Transfer time
+    int32_t                 status;                             // Transfer status
+    uint32_t                engine;                             // DMA engine
+} ntv42_dma_result_t;
+
 typedef struct ntv42_device_t {
     uint32_t                index;                              // Device index
     void*                   host;                               // Device driver context
@@ -83,17 +99,28 @@ typedef struct ntv42_device_t {
     ntv42_bar_t             bar[NTV42_DEVICE_BAR_MAX];          // Bar info
 
     /* DMA infrastructure (Phase 3) */
-    uint8_t                *dma_buf;                            // Bounce buffer (dummy devices)
+    uint8_t                *dma_buf;                            // Device memory (dummy devices, vmalloc_user)
     uint64_t                dma_buf_size;                       // Bounce buffer size
     int                     (*dma_transfer)(void* host, void* io, uint32_t direction,
                                             void __user *user_buf, uint64_t device_addr,
                                             uint64_t bytes, uint64_t *bytes_xfered);
+    struct workqueue_struct* dma_queue;                         // Asynchronous transfers (ordered)
+    spinlock_t              dma_lock;                           // Protects the asynchronous state below
+    uint32_t                dma_pending;                        // Queued asynchronous transfers
+    uint64_t                dma_submitted[NTV42_DMA_QUEUE_ENGINES]; // Per-engine transfers submitted
+    uint64_t                dma_completed[NTV42_DMA_QUEUE_ENGINES]; // Per-engine transfers completed
+    ntv42_dma_result_t      dma_result[NTV42_DMA_HISTORY_MAX];  // Recent completions (ring)
+    uint32_t                dma_result_next;                    // Next ring entry
 
     /* Event infrastructure (Phase 2) */
     uint64_t                event_count[NTV42_EVENT_SLOT_MAX];  // Per-slot event counters
     uint64_t                event_timestamp[NTV42_EVENT_SLOT_MAX]; // Per-slot last timestamp (ns)
     bool                    event_enabled[NTV42_EVENT_SLOT_MAX]; // Per-slot enabled flags
-    wait_queue_head_t       event_wait;                         // Single wait queue for all events
+    uint64_t                event_sequence;                     // Total events on enabled slots
+    spinlock_t              event_lock;                         // Serializes event updates
+    wait_queue_head_t       event_slot_wait[NTV42_EVENT_SLOT_MAX]; // Per-slot wait queues
+    wait_queue_head_t       event_wait;                         // poll() wait queue (events on enabled slots)
+    struct ntv42_event_page_t* event_page;                      // Read-only page of counters mapped by clients
 } ntv42_device_t;
 
 
@@ -117,9 +144,30 @@ int ntv42device_message(ntv42_device_t* device, void* message, uint32_t size);
 /** Device event handler — called from ISR with ntv42 event type and index */
 int ntv42device_event(ntv42_device_t* device, uint32_t type, uint32_t index);
 
+/** Same as ntv42device_event, with the event's timestamp (ktime_get_ns() clock) */
+int ntv42device_event_time(ntv42_device_t* device, uint32_t type, uint32_t index, uint64_t timestamp);
+
 /** Convert event (type, index) to flat slot number. Returns -1 if invalid. */
 int ntv42device_event_slot(uint32_t type, uint32_t index);
 
 /** Check if event slot is supported for this device */
 bool ntv42device_event_supported(ntv42_device_t* device, uint32_t type, uint32_t index);
 
+/** Read a slot's event count and timestamp consistently */
+void ntv42device_event_read(ntv42_device_t* device, int slot, uint64_t* count, uint64_t* timestamp);
+
+/** Current device event sequence (total events on enabled slots) */
+uint64_t ntv42device_event_sequence(ntv42_device_t* device);
+
+/** File poll() handler -- readable while the event sequence exceeds the file's acknowledged sequence */
+struct file;
+struct poll_table_struct;
+struct vm_area_struct;
+unsigned int ntv42_event_poll(ntv42_device_t* device, struct file* file, struct poll_table_struct* wait, uint64_t event_ack);
+
+/** File mmap() handler for the event page, BARs and device memory (NTV42_*_PGOFF) */
+int ntv42_mmap(ntv42_device_t* device, struct vm_area_struct* vma);
+
+/** Wait for queued asynchronous DMA transfers -- call before the host's per-file io context is freed */
+void ntv42_dma_flush(ntv42_device_t* device);
+
@@ -9,8 +9,29 @@
  * handler code with the NTV2 driver.
  *
  * Build:  make -C /lib/modules/$(uname -r)/build M=$(pwd) modules
- * Load:   sudo insmod ntv42dummy.ko [num_devices=N]
+ * Load:   sudo insmod ntv42dummy.ko [num_devices=N] [mem_size_mb=M]
+ *             [output_rate=R,...] [input_rate=R,...] [device_id=ID]
  * Remove: sudo rmmod ntv42dummy
+ *
+ * Each output and input has its own high-resolution vsync timer, which raises
+ * vsync events at an exact rational frame rate (e.g. 24000/1001), once per
+ * field for interlaced cadences, timestamped with the ideal vsync time. The
+ * cadences are set at load time (output_rate=60000/1001,50i input_rate=...,
+ * default 60 on output 0 and input 0), or per device at any time with
+ * IOCTL_NTV42_VSYNC_CONFIG. The events can be waited on by any number of
+ * threads (IOCTL_NTV42_EVENT_WAIT), polled on the device file once enabled
+ * (IOCTL_NTV42_EVENT_CONTROL, IOCTL_NTV42_EVENT_ACK), and sampled from the
+ * event page (mmap at NTV42_EVENT_PAGE_PGOFF).
+ *
+ * DMA moves data between host memory and a memory-backed "device memory" of
+ * mem_size_mb megabytes (e.g. 512 holds several 8K frames), so transfer
+ * throughput can be measured without hardware. Both the registers
+ * (NTV42_BAR_PGOFF(0)) and device memory (NTV42_MEMORY_PGOFF) can also be
+ * mapped, to compare direct access with the ioctl path.
+ *
+ * BAR0 spans the NTV2 register map. With device_id set, kRegBoardID reads as
+ * that NTV2 device ID, so the SDK (built with AJANTV2_NTV42_DRIVER_INTERFACE)
+ * can open the dummy as that device, e.g. to run the demos against it.
  */
 
 #include <linux/module.h>
@@ -20,13 +41,19 @@
 #include <linux/cdev.h>
 #include <linux/device.h>
 #include <linux/slab.h>
-#include <linux/timer.h>
+#include <linux/mm.h>
+#include <linux/vmalloc.h>
+#include <linux/hrtimer.h>
+#include <linux/ktime.h>
+#include <linux/math64.h>
+#include <linux/mutex.h>
+#include <linux/poll.h>
 #include <linux/uaccess.h>
 #include <linux/version.h>
 
-/* Linux 6.12 renamed from_timer()/del_timer_sync() to timer_container_of()/timer_delete_sync() */
-#if (LINUX_VERSION_CODE >= KERNEL_VERSION(6,12,0))
-#define NTV42DUMMY_TIMER_CONTAINER_OF
+/* Linux 6.13 replaced hrtimer_init() (and setting the callback) with hrtimer_setup() */
+#if (LINUX_VERSION_CODE >= KERNEL_VERSION(6,13,0))
+#define NTV42DUMMY_HRTIMER_SETUP
 #endif
 
 /* Linux 6.2 made the dev_uevent() class callback take a const struct device * */
@@ -46,21 +73,67 @@
 #include "../ntv42ioctl.h"
 
 #define NTV42_DUMMY_MAX_DEVICES  4
-#define NTV42_DUMMY_BAR0_REGS    1024
+#define NTV42_DUMMY_BAR0_REGS    16384           /* Covers the NTV2 register map */
 #define NTV42_DUMMY_BAR0_WIDTH   4
 #define NTV42_DUMMY_BAR0_SIZE    (NTV42_DUMMY_BAR0_REGS * NTV42_DUMMY_BAR0_WIDTH)
-#define NTV42_DUMMY_DMA_BUF_SIZE (1024 * 1024)  /* 1MB DMA bounce buffer */
+#define NTV42_DUMMY_BOARD_ID_REG 50              /* kRegBoardID */
+#define NTV42_DUMMY_MEM_SIZE_MB  1               /* Default device memory size */
+#define NTV42_DUMMY_MEM_SIZE_MAX 8192            /* Largest device memory size (MB) */
+#define NTV42_DUMMY_VSYNC_CHANNELS 8             /* Outputs (and inputs) with vsync timers */
+#define NTV42_DUMMY_VSYNC_RATE_MAX 1000000       /* Largest rate numerator or denominator */
+#define NTV42_DUMMY_VSYNC_PERIOD_MIN (100 * NSEC_PER_USEC)  /* Shortest vsync (or field) period */
+#define NTV42_DUMMY_VSYNC_PERIOD_MAX (10 * NSEC_PER_SEC)    /* Longest vsync (or field) period */
 
 static int num_devices = 1;
 module_param(num_devices, int, 0444);
 MODULE_PARM_DESC(num_devices, "Number of dummy devices to create (default 1, max 4)");
 
+static uint mem_size_mb = NTV42_DUMMY_MEM_SIZE_MB;
+module_param(mem_size_mb, uint, 0444);
+MODULE_PARM_DESC(mem_size_mb, "DMA device memory per device in MB (default 1, max 8192)");
+
+static uint device_id;
+module_param(device_id, uint, 0444);
+MODULE_PARM_DESC(device_id, "NTV2 device ID reported in kRegBoardID (e.g. 0x10798400 = Kona 5; default 0 = none)");
+
+static char *output_rate[NTV42_DUMMY_VSYNC_CHANNELS];
+static int output_rate_count;
+module_param_array(output_rate, charp, &output_rate_count, 0444);
+MODULE_PARM_DESC(output_rate, "Output vsync rates, as num[/den][i] (e.g. 60000/1001,50i,0 = off; default 60 on output 0)");
+
+static char *input_rate[NTV42_DUMMY_VSYNC_CHANNELS];
+static int input_rate_count;
+module_param_array(input_rate, charp, &input_rate_count, 0444);
+MODULE_PARM_DESC(input_rate, "Input vsync rates, as num[/den][i] (default 60 on input 0)");
+
+struct ntv42_dummy_state;
+
+/* One simulated vsync source (an output or input) */
+struct ntv42_dummy_vsync {
+    struct hrtimer  timer;
+    struct ntv42_dummy_state *state;
+    uint32_t        type;           /* Vsync event type */
+    uint32_t        index;          /* Output or input index */
+    uint32_t        rate_num;       /* Frames per second = rate_num / rate_den (0 = stopped) */
+    uint32_t        rate_den;
+    bool            interlaced;     /* One event per field */
+    uint64_t        start;          /* Time of the first event (ns) */
+    uint64_t        base;           /* Time of tick 0 (advances every rate_den seconds) */
+    uint64_t        tick;           /* Events since base */
+};
+
 struct ntv42_dummy_state {
     ntv42_device_t  *device;
     struct cdev     cdev;
-    uint32_t        registers[NTV42_DUMMY_BAR0_REGS];
-    struct timer_list vsync_timer;
-    bool            vsync_running;
+    uint32_t        *registers;     /* BAR0 (vmalloc_user, so it can be mapped) */
+    struct mutex    vsync_mutex;    /* Serializes cadence changes */
+    struct ntv42_dummy_vsync vsync[2][NTV42_DUMMY_VSYNC_CHANNELS];  /* [output, input][index] */
+};
+
+/* Per-open state */
+struct ntv42_dummy_file {
+    struct ntv42_dummy_state *state;
+    uint64_t        event_ack;      /* Event sequence acknowledged for poll() */
 };
 
 static int ntv42dummy_major;
@@ -111,29 +184,64 @@ static int dummy_reg_write(void *host, void *id, ntv42device_regio_t *regio)
     return NTV42_RETURN_SUCCESS;
 }
 
+static long ntv42dummy_ioctl_vsync_config(struct ntv42_dummy_state *state, unsigned long arg);
+
 /*============================================================================
  * Chardev file operations
  *==========================================================================*/
 
 static int ntv42dummy_open(struct inode *inode, struct file *file)
 {
+    struct ntv42_dummy_file *fdata;
     int minor = iminor(inode);
     if (minor < 0 || minor >= ntv42dummy_device_count)
         return -ENODEV;
-    file->private_data = &dummy_state[minor];
+
+    fdata = kzalloc(sizeof(*fdata), GFP_KERNEL);
+    if (fdata == NULL)
+        return -ENOMEM;
+    fdata->state = &dummy_state[minor];
+    fdata->event_ack = ntv42device_event_sequence(fdata->state->device);
+    file->private_data = fdata;
     return 0;
 }
 
 static int ntv42dummy_release(struct inode *inode, struct file *file)
 {
+    struct ntv42_dummy_file *fdata = file->private_data;
     (void)inode;
+
+    if (fdata != NULL)
+        ntv42_dma_flush(fdata->state->device);
+    kfree(fdata);
     file->private_data = NULL;
     return 0;
 }
 
+static unsigned int ntv42dummy_poll(struct file *file, struct poll_table_struct *wait)
+{
+    struct ntv42_dummy_file *fdata = file->private_data;
+
+    if (fdata == NULL || fdata->state->device == NULL)
+        return POLLERR;
+
+    return ntv42_event_poll(fdata->state->device, file, wait, READ_ONCE(fdata->event_ack));
+}
+
+static int ntv42dummy_mmap(struct file *file, struct vm_area_struct *vma)
+{
+    struct ntv42_dummy_file *fdata = file->private_data;
+
+    if (fdata == NULL || fdata->state->device == NULL)
+        return -ENODEV;
+
+    return ntv42_mmap(fdata->state->device, vma);
+}
+
 static long ntv42dummy_ioctl(struct file *file, unsigned int cmd, unsigned long arg)
 {
-    struct ntv42_dummy_state *state = file->private_data;
+    struct ntv42_dummy_file *fdata = file->private_data;
+    struct ntv42_dummy_state *state = (fdata != NULL) ? fdata->state : NULL;
 
     if (state == NULL || state->device == NULL)
         return -ENODEV;
@@ -156,10 +264,18 @@ static long ntv42dummy_ioctl(struct file *file, unsigned int cmd, unsigned long
         return ntv42_ioctl_event_wait(state->device, file, arg);
     case IOCTL_NTV42_EVENT_STATUS:
         return ntv42_ioctl_event_status(state->device, file, arg);
+    case IOCTL_NTV42_EVENT_ACK:
+        return ntv42_ioctl_event_ack(state->device, &fdata->event_ack, arg);
+    case IOCTL_NTV42_VSYNC_CONFIG:
+        return ntv42dummy_ioctl_vsync_config(state, arg);
     case IOCTL_NTV42_DMA_TRANSFER:
         return ntv42_ioctl_dma_transfer(state->device, file, arg);
     case IOCTL_NTV42_DMA_INFO:
         return ntv42_ioctl_dma_info(state->device, file, arg);
+    case IOCTL_NTV42_DMA_VECTOR:
+        return ntv42_ioctl_dma_vector(state->device, file, arg);
+    case IOCTL_NTV42_DMA_STATUS:
+        return ntv42_ioctl_dma_status(state->device, file, arg);
     case IOCTL_NTV42_REGBATCH_SUBMIT:
         return ntv42_ioctl_regbatch_submit(state->device, file, arg);
     case IOCTL_NTV42_REGBATCH_CANCEL:
@@ -176,34 +292,218 @@ static const struct file_operations ntv42dummy_fops = {
     .open           = ntv42dummy_open,
     .release        = ntv42dummy_release,
     .unlocked_ioctl = ntv42dummy_ioctl,
+    .poll           = ntv42dummy_poll,
+    .mmap           = ntv42dummy_mmap,
 };
 
 /*============================================================================
- * Vsync timer simulation (~60Hz)
+ * Vsync simulation (one hrtimer per output and input)
  *==========================================================================*/
 
-#define NTV42_DUMMY_VSYNC_INTERVAL_MS  16  /* ~60Hz */
+/* Events per block of rate_den seconds (which is a whole number of nanoseconds) */
+static uint64_t ntv42dummy_vsync_events(const struct ntv42_dummy_vsync *vsync)
+{
+    return (uint64_t)vsync->rate_num * (vsync->interlaced ? 2 : 1);
+}
 
-static void ntv42dummy_vsync_timer_fn(struct timer_list *t)
+/* Ideal time of the current tick, exact to the nanosecond (tick < events) */
+static uint64_t ntv42dummy_vsync_time(const struct ntv42_dummy_vsync *vsync)
 {
-#if defined(NTV42DUMMY_TIMER_CONTAINER_OF)
-    struct ntv42_dummy_state *state = timer_container_of(state, t, vsync_timer);
+    uint64_t events = ntv42dummy_vsync_events(vsync);
+    uint64_t rem;
+    uint64_t period = div64_u64_rem((uint64_t)vsync->rate_den * NSEC_PER_SEC, events, &rem);
+
+    return vsync->base + vsync->tick * period + div64_u64(vsync->tick * rem, events);
+}
+
+static void ntv42dummy_vsync_advance(struct ntv42_dummy_vsync *vsync)
+{
+    if (++vsync->tick >= ntv42dummy_vsync_events(vsync)) {
+        vsync->base += (uint64_t)vsync->rate_den * NSEC_PER_SEC;
+        vsync->tick = 0;
+    }
+}
+
+static enum hrtimer_restart ntv42dummy_vsync_timer_fn(struct hrtimer *timer)
+{
+    struct ntv42_dummy_vsync *vsync = container_of(timer, struct ntv42_dummy_vsync, timer);
+    struct ntv42_dummy_state *state = vsync->state;
+    uint64_t events, skipped, now, next;
+
+    if (state->device == NULL || vsync->rate_num == 0)
+        return HRTIMER_NORESTART;
+
+    /* Publish the field (events per block is even when interlaced, so fields alternate), then raise the event */
+    state->registers[NTV42_VSYNC_FIELD_REG(vsync->type, vsync->index) / NTV42_DUMMY_BAR0_WIDTH] =
+        vsync->interlaced ? (uint32_t)(vsync->tick & 1) : 0;
+    ntv42device_event_time(state->device, vsync->type, vsync->index, ntv42dummy_vsync_time(vsync));
+
+    /* Skip ticks that have already passed (e.g. the timer was held off), like hardware would */
+    events = ntv42dummy_vsync_events(vsync);
+    now = ktime_get_ns();
+    skipped = 0;
+    do {
+        ntv42dummy_vsync_advance(vsync);
+        next = ntv42dummy_vsync_time(vsync);
+    } while (next <= now && ++skipped < events);
+
+    /* More than a block behind, so restart the cadence */
+    if (next <= now) {
+        vsync->base = now;
+        vsync->tick = 0;
+        ntv42dummy_vsync_advance(vsync);
+        next = ntv42dummy_vsync_time(vsync);
+    }
+
+    hrtimer_set_expires(timer, ns_to_ktime(next));
+    return HRTIMER_RESTART;
+}
+
+static void ntv42dummy_vsync_init(struct ntv42_dummy_state *state)
+{
+    int dir, index;
+
+    mutex_init(&state->vsync_mutex);
+    for (dir = 0; dir < 2; dir++) {
+        for (index = 0; index < NTV42_DUMMY_VSYNC_CHANNELS; index++) {
+            struct ntv42_dummy_vsync *vsync = &state->vsync[dir][index];
+
+            vsync->state = state;
+            vsync->type = (dir == 0) ? 0x0001 : 0x0002;
+            vsync->index = index;
+            vsync->rate_den = 1;
+#if defined(NTV42DUMMY_HRTIMER_SETUP)
+            hrtimer_setup(&vsync->timer, ntv42dummy_vsync_timer_fn, CLOCK_MONOTONIC, HRTIMER_MODE_ABS);
 #else
-    struct ntv42_dummy_state *state = from_timer(state, t, vsync_timer);
+            hrtimer_init(&vsync->timer, CLOCK_MONOTONIC, HRTIMER_MODE_ABS);
+            vsync->timer.function = ntv42dummy_vsync_timer_fn;
 #endif
+        }
+    }
+}
 
-    if (state->device == NULL || !state->vsync_running)
-        return;
+/* Changes the cadence of one vsync source (rate_num 0 stops it). The first event is one period from now. */
+static int ntv42dummy_vsync_set(struct ntv42_dummy_vsync *vsync, uint32_t rate_num, uint32_t rate_den, bool interlaced)
+{
+    uint64_t period = 0;
+
+    if (rate_num != 0) {
+        if (rate_den == 0 || rate_num > NTV42_DUMMY_VSYNC_RATE_MAX || rate_den > NTV42_DUMMY_VSYNC_RATE_MAX)
+            return -EINVAL;
+        period = div64_u64((uint64_t)rate_den * NSEC_PER_SEC, (uint64_t)rate_num * (interlaced ? 2 : 1));
+        if (period < NTV42_DUMMY_VSYNC_PERIOD_MIN || period > NTV42_DUMMY_VSYNC_PERIOD_MAX)
+            return -ERANGE;
+    }
 
-    /* Generate output vsync event for output 0 */
-    ntv42device_event(state->device, 0x0001, 0);
+    hrtimer_cancel(&vsync->timer);
+    vsync->rate_num = rate_num;
+    vsync->rate_den = (rate_num != 0) ? rate_den : 1;
+    vsync->interlaced = (rate_num != 0) && interlaced;
+    vsync->start = 0;
+    if (rate_num == 0)
+        return 0;
+
+    vsync->base = ktime_get_ns() + period;
+    vsync->tick = 0;
+    vsync->start = vsync->base;
+    hrtimer_start(&vsync->timer, ns_to_ktime(vsync->base), HRTIMER_MODE_ABS);
+    return 0;
+}
 
-    /* Generate input vsync event for input 0 */
-    ntv42device_event(state->device, 0x0002, 0);
+static void ntv42dummy_vsync_stop(struct ntv42_dummy_state *state)
+{
+    int dir, index;
+
+    for (dir = 0; dir < 2; dir++)
+        for (index = 0; index < NTV42_DUMMY_VSYNC_CHANNELS; index++)
+            ntv42dummy_vsync_set(&state->vsync[dir][index], 0, 1, false);
+}
 
-    /* Re-arm timer */
-    mod_timer(&state->vsync_timer,
-              jiffies + msecs_to_jiffies(NTV42_DUMMY_VSYNC_INTERVAL_MS));
+/* Parses a rate module parameter: num[/den][i|p], e.g. "30000/1001i". Empty or "0" is off. */
+static int ntv42dummy_vsync_parse(const char *str, uint32_t *rate_num, uint32_t *rate_den, bool *interlaced)
+{
+    char buf[32];
+    char *den;
+    size_t len;
+
+    *rate_num = 0;
+    *rate_den = 1;
+    *interlaced = false;
+    if (str == NULL || *str == '\0')
+        return 0;
+    if (strscpy(buf, str, sizeof(buf)) < 0)
+        return -EINVAL;
+
+    len = strlen(buf);
+    if (len > 0 && (buf[len - 1] == 'i' || buf[len - 1] == 'p')) {
+        *interlaced = (buf[len - 1] == 'i');
+        buf[--len] = '\0';
+    }
+    den = strchr(buf, '/');
+    if (den != NULL) {
+        *den++ = '\0';
+        if (kstrtouint(den, 10, rate_den) != 0)
+            return -EINVAL;
+    }
+    return kstrtouint(buf, 10, rate_num);
+}
+
+/* Starts the cadences given by the module parameters (default 60 Hz on output 0 and input 0) */
+static void ntv42dummy_vsync_start(struct ntv42_dummy_state *state, int dev_num)
+{
+    int dir, index;
+
+    for (dir = 0; dir < 2; dir++) {
+        char **rates = (dir == 0) ? output_rate : input_rate;
+        int count = (dir == 0) ? output_rate_count : input_rate_count;
+
+        for (index = 0; index < NTV42_DUMMY_VSYNC_CHANNELS; index++) {
+            uint32_t rate_num = 0, rate_den = 1;
+            bool interlaced = false;
+            int ret = 0;
+
+            if (count == 0)
+                rate_num = (index == 0) ? 60 : 0;
+            else if (index < count)
+                ret = ntv42dummy_vsync_parse(rates[index], &rate_num, &rate_den, &interlaced);
+            if (ret == 0 && rate_num != 0)
+                ret = ntv42dummy_vsync_set(&state->vsync[dir][index], rate_num, rate_den, interlaced);
+            if (ret != 0)
+                printk(KERN_WARNING "ntv42dummy: bad %s %d vsync rate '%s' on device %d\n",
+                       (dir == 0) ? "output" : "input", index, (index < count) ? rates[index] : "", dev_num);
+        }
+    }
+}
+
+static long ntv42dummy_ioctl_vsync_config(struct ntv42_dummy_state *state, unsigned long arg)
+{
+    ntv42_ioctl_vsync_config_t param;
+    struct ntv42_dummy_vsync *vsync;
+    int ret = 0;
+
+    if (copy_from_user(&param, (void __user *)arg, sizeof(param)))
+        return -EFAULT;
+
+    if ((param.type != 0x0001 && param.type != 0x0002) || param.index >= NTV42_DUMMY_VSYNC_CHANNELS)
+        return -EINVAL;
+    vsync = &state->vsync[(param.type == 0x0001) ? 0 : 1][param.index];
+
+    mutex_lock(&state->vsync_mutex);
+    if ((param.flags & NTV42_VSYNC_FLAG_QUERY) == 0)
+        ret = ntv42dummy_vsync_set(vsync, param.rate_num, param.rate_den,
+                                   (param.flags & NTV42_VSYNC_FLAG_INTERLACED) != 0);
+    param.rate_num = vsync->rate_num;
+    param.rate_den = vsync->rate_den;
+    param.flags = vsync->interlaced ? NTV42_VSYNC_FLAG_INTERLACED : 0;
+    param._pad0 = 0;
+    param.start_time = vsync->start;
+    mutex_unlock(&state->vsync_mutex);
+
+    if (ret != 0)
+        return ret;
+    if (copy_to_user((void __user *)arg, &param, sizeof(param)))
+        return -EFAULT;
+    return 0;
 }
 
 /*============================================================================
@@ -232,7 +532,12 @@ static int __init ntv42dummy_init(void)
     if (num_devices > NTV42_DUMMY_MAX_DEVICES)
         num_devices = NTV42_DUMMY_MAX_DEVICES;
 
-    printk(KERN_INFO "ntv42dummy: initializing %d dummy device(s)\n", num_devices);
+    if (mem_size_mb < 1)
+        mem_size_mb = 1;
+    if (mem_size_mb > NTV42_DUMMY_MEM_SIZE_MAX)
+        mem_size_mb = NTV42_DUMMY_MEM_SIZE_MAX;
+
+    printk(KERN_INFO "ntv42dummy: initializing %d dummy device(s) with %u MB memory\n", num_devices, mem_size_mb);
 
     ntv42device_init();
 
@@ -274,19 +579,31 @@ static int __init ntv42dummy_init(void)
         ntv42device_config(state->device, &config);
 
         /* Add BAR0 */
+        state->registers = vmalloc_user(PAGE_ALIGN(NTV42_DUMMY_BAR0_SIZE));
+        if (state->registers == NULL) {
+            printk(KERN_ERR "ntv42dummy: failed to allocate registers %d\n", i);
+            ntv42device_release(state->device);
+            ret = -ENOMEM;
+            goto err_cleanup;
+        }
+        state->registers[NTV42_DUMMY_BOARD_ID_REG] = device_id;
         memset(&bar0, 0, sizeof(bar0));
         snprintf(bar0.name, sizeof(bar0.name), "bar0");
         bar0.address = 0;
         bar0.size = NTV42_DUMMY_BAR0_SIZE;
         bar0.width = NTV42_DUMMY_BAR0_WIDTH;
+        bar0.memory = state->registers;
         bar0.reg_read = dummy_reg_read;
         bar0.reg_write = dummy_reg_write;
         ntv42device_bar_add(state->device, &bar0);
+        ntv42dummy_vsync_init(state);
 
-        /* Allocate DMA bounce buffer */
-        state->device->dma_buf = kzalloc(NTV42_DUMMY_DMA_BUF_SIZE, GFP_KERNEL);
+        /* Allocate device memory (DMA bounce buffer) */
+        state->device->dma_buf = vmalloc_user((size_t)mem_size_mb * 1024 * 1024);
         if (state->device->dma_buf != NULL)
-            state->device->dma_buf_size = NTV42_DUMMY_DMA_BUF_SIZE;
+            state->device->dma_buf_size = (uint64_t)mem_size_mb * 1024 * 1024;
+        else
+            printk(KERN_WARNING "ntv42dummy: failed to allocate %u MB device memory %d\n", mem_size_mb, i);
 
         ntv42device_state(state->device, ntv42device_state_enable);
 
@@ -306,11 +623,8 @@ static int __init ntv42dummy_init(void)
             goto err_cleanup;
         }
 
-        /* Start vsync simulation timer */
-        timer_setup(&state->vsync_timer, ntv42dummy_vsync_timer_fn, 0);
-        state->vsync_running = true;
-        mod_timer(&state->vsync_timer,
-                  jiffies + msecs_to_jiffies(NTV42_DUMMY_VSYNC_INTERVAL_MS));
+        /* Start vsync simulation timers */
+        ntv42dummy_vsync_start(state, i);
 
         ntv42dummy_device_count++;
         printk(KERN_INFO "ntv42dummy: created /dev/ntv42dummy%d\n", i);
@@ -320,14 +634,13 @@ static int __init ntv42dummy_init(void)
 
 err_cleanup:
     for (i = i - 1; i >= 0; i--) {
-        dummy_state[i].vsync_running = false;
-#if defined(NTV42DUMMY_TIMER_CONTAINER_OF)
-        timer_delete_sync(&dummy_state[i].vsync_timer);
-#else
-        del_timer_sync(&dummy_state[i].vsync_timer);
-#endif
+        ntv42dummy_vsync_stop(&dummy_state[i]);
         device_destroy(ntv42dummy_class, MKDEV(ntv42dummy_major, i));
         cdev_del(&dummy_state[i].cdev);
+        vfree(dummy_state[i].device->dma_buf);
+        dummy_state[i].device->dma_buf = NULL;
+        vfree(dummy_state[i].registers);
+        dummy_state[i].registers = NULL;
         ntv42device_state(dummy_state[i].device, ntv42device_state_disable);
         ntv42device_release(dummy_state[i].device);
         ntv42dummy_device_count--;
@@ -342,16 +655,14 @@ static void __exit ntv42dummy_exit(void)
     int i;
 
     for (i = 0; i < ntv42dummy_device_count; i++) {
-        dummy_state[i].vsync_running = false;
-#if defined(NTV42DUMMY_TIMER_CONTAINER_OF)
-        timer_delete_sync(&dummy_state[i].vsync_timer);
-#else
-        del_timer_sync(&dummy_state[i].vsync_timer);
-#endif
+        ntv42dummy_vsync_stop(&dummy_state[i]);
         device_destroy(ntv42dummy_class, MKDEV(ntv42dummy_major, i));
         cdev_del(&dummy_state[i].cdev);
-        kfree(dummy_state[i].device->dma_buf);
+        ntv42_dma_flush(dummy_state[i].device);
+        vfree(dummy_state[i].device->dma_buf);
         dummy_state[i].device->dma_buf = NULL;
+        vfree(dummy_state[i].registers);
+        dummy_state[i].registers = NULL;
         ntv42device_state(dummy_state[i].device, ntv42device_state_disable);
         ntv42device_release(dummy_state[i].device);
     }
@@ -9,6 +9,10 @@
 #include <linux/kernel.h>
 #include <linux/slab.h>
 #include <linux/uaccess.h>
+#include <linux/mm.h>
+#include <linux/vmalloc.h>
+#include <linux/capability.h>
+#include <linux/version.h>
 
 #include "ntv42device.h"
 #include "ntv42ioctl.h"
@@ -21,7 +25,9 @@ int ntv42_ioctl_version(ntv42_device_t *device, void *io, unsigned long arg)
         return NTV42_RETURN_NO_DEVICE;
 
     ver.version = NTV42_IOCTL_VERSION;
-    ver.capabilities = NTV42_CAP_REGIO | NTV42_CAP_EVENTS | NTV42_CAP_DMA | NTV42_CAP_REGBATCH;
+    ver.capabilities = NTV42_CAP_REGIO | NTV42_CAP_EVENTS | NTV42_CAP_DMA | NTV42_CAP_REGBATCH |
+                       NTV42_CAP_EVENT_SEQ | NTV42_CAP_EVENT_POLL | NTV42_CAP_DMA_VECTOR |
+                       NTV42_CAP_MMAP | NTV42_CAP_REGBATCH_IMMEDIATE;
 
     if (copy_to_user((void __user *)arg, &ver, sizeof(ver)))
         return -EFAULT;
@@ -179,6 +185,8 @@ int ntv42_ioctl_device_info(ntv42_device_t *device, void *io, unsigned long arg)
         info.bar[i].address = device->bar[i].address;
         info.bar[i].size = device->bar[i].size;
         info.bar[i].width = device->bar[i].width;
+        if ((device->bar[i].memory != NULL) || (device->bar[i].address != 0))
+            info.bar[i].flags |= NTV42_BAR_FLAG_MAP;
     }
 
     if (copy_to_user((void __user *)arg, &info, sizeof(info)))
@@ -186,3 +194,81 @@ int ntv42_ioctl_device_info(ntv42_device_t *device, void *io, unsigned long arg)
 
     return NTV42_RETURN_SUCCESS;
 }
+
+static int ntv42_mmap_protect(struct vm_area_struct *vma, bool writable)
+{
+    if (vma->vm_flags & VM_WRITE)
+        return writable ? NTV42_RETURN_SUCCESS : NTV42_RETURN_BAD_STATE;
+
+    /* Keep read-only mappings from being made writable by mprotect() */
+#if (LINUX_VERSION_CODE >= KERNEL_VERSION(6,3,0))
+    vm_flags_clear(vma, VM_MAYWRITE);
+#else
+    vma->vm_flags &= ~VM_MAYWRITE;
+#endif
+    return NTV42_RETURN_SUCCESS;
+}
+
+static int ntv42_mmap_memory(struct vm_area_struct *vma, void *memory)
+{
+    /* vmalloc memory must come from vmalloc_user() */
+    if (is_vmalloc_addr(memory))
+        return remap_vmalloc_range(vma, memory, 0);
+
+    return remap_pfn_range(vma, vma->vm_start, virt_to_phys(memory) >> PAGE_SHIFT,
+                           vma->vm_end - vma->vm_start, vma->vm_page_prot);
+}
+
+int ntv42_mmap(ntv42_device_t *device, struct vm_area_struct *vma)
+{
+    unsigned long size = vma->vm_end - vma->vm_start;
+    unsigned long pgoff = vma->vm_pgoff;
+    ntv42_bar_t *bar;
+    int ret;
+
+    if (device == NULL)
+        return NTV42_RETURN_NO_DEVICE;
+
+    /* Event page: one page, read-only */
+    if (pgoff == NTV42_EVENT_PAGE_PGOFF) {
+        if (device->event_page == NULL)
+            return NTV42_RETURN_NO_DEVICE;
+        if (size > PAGE_SIZE)
+            return NTV42_RETURN_BAD_PARAMETER;
+        ret = ntv42_mmap_protect(vma, false);
+        if (ret != NTV42_RETURN_SUCCESS)
+            return ret;
+        /* Inserted pages are reference counted, so the mapping outlives device release */
+        return vm_insert_page(vma, vma->vm_start, virt_to_page(device->event_page));
+    }
+
+    /* BAR register window: read-only unless privileged */
+    if ((pgoff >= NTV42_BAR_PGOFF(0)) && (pgoff < NTV42_BAR_PGOFF(NTV42_DEVICE_BAR_MAX))) {
+        if ((int)(pgoff - NTV42_BAR_PGOFF(0)) >= device->bar_count)
+            return NTV42_RETURN_BAD_PARAMETER;
+        bar = &device->bar[pgoff - NTV42_BAR_PGOFF(0)];
+        if (size > PAGE_ALIGN(bar->size))
+            return NTV42_RETURN_BAD_PARAMETER;
+        ret = ntv42_mmap_protect(vma, capable(CAP_SYS_RAWIO));
+        if (ret != NTV42_RETURN_SUCCESS)
+            return ret;
+        if (bar->memory != NULL)
+            return ntv42_mmap_memory(vma, bar->memory);
+        if (bar->address == 0)
+            return NTV42_RETURN_BAD_STATE;
+        vma->vm_page_prot = pgprot_noncached(vma->vm_page_prot);
+        return io_remap_pfn_range(vma, vma->vm_start, bar->address >> PAGE_SHIFT,
+                                  size, vma->vm_page_prot);
+    }
+
+    /* Device memory */
+    if (pgoff == NTV42_MEMORY_PGOFF) {
+        if ((device->dma_buf == NULL) || (device->dma_buf_size == 0))
+            return NTV42_RETURN_NO_DEVICE;
+        if (size > PAGE_ALIGN(device->dma_buf_size))
+            return NTV42_RETURN_BAD_PARAMETER;
+        return ntv42_mmap_memory(vma, device->dma_buf);
+    }
+
+    return NTV42_RETURN_BAD_PARAMETER;
+}
@@ -38,9 +38,25 @@ typedef struct ntv42_ioctl_version_t {
 #define NTV42_CAP_EVENTS    (1 << 1)  /* Phase 2: events */
 #define NTV42_CAP_DMA       (1 << 2)  /* Phase 3: DMA */
 #define NTV42_CAP_REGBATCH  (1 << 3)  /* Phase 4: register batch */
+#define NTV42_CAP_EVENT_SEQ (1 << 4)  /* Event waits by sequence number (NTV42_EVENT_WAIT_SEQUENCE) */
+#define NTV42_CAP_EVENT_POLL (1 << 5) /* poll() on the device, IOCTL_NTV42_EVENT_ACK and the event page */
+#define NTV42_CAP_DMA_VECTOR (1 << 6) /* Vectored and asynchronous DMA (IOCTL_NTV42_DMA_VECTOR) */
+#define NTV42_CAP_MMAP      (1 << 7)  /* mmap() of BARs and device memory */
+#define NTV42_CAP_REGBATCH_IMMEDIATE (1 << 8) /* Register batches executed at submission (NTV42_REGBATCH_IMMEDIATE) */
 
 /* Current ioctl interface version */
-#define NTV42_IOCTL_VERSION 1
+#define NTV42_IOCTL_VERSION 5
+
+/**
+ * mmap() offsets, in pages (i.e. offset = pgoff * page size). Each mapping
+ * starts at the beginning of its region, and may not exceed its size.
+ *
+ * BARs map read-only, unless the caller has CAP_SYS_RAWIO. Device memory
+ * (NTV42_MEMORY_PGOFF) is the memory DMA transfers address, and maps
+ * read-write. See NTV42_BAR_FLAG_MAP and IOCTL_NTV42_DMA_INFO.
+ */
+#define NTV42_BAR_PGOFF(bar)        (32 + (bar))    /* BAR register window (bar 0-7) */
+#define NTV42_MEMORY_PGOFF          48              /* Device memory */
 
 /** Bulk register read/write */
 typedef struct ntv42_ioctl_regio_t {
@@ -50,6 +66,9 @@ typedef struct ntv42_ioctl_regio_t {
     uint64_t    data_ptr;       /* Userspace pointer to data buffer (cast to __u64) */
 } ntv42_ioctl_regio_t;
 
+/** BAR flags */
+#define NTV42_BAR_FLAG_MAP          (1 << 0)  /* BAR can be mapped (NTV42_BAR_PGOFF) */
+
 /** Device info query */
 typedef struct ntv42_ioctl_device_info_t {
     char        name[16];       /* Device name (matches ntv42_device_config_t) */
@@ -62,7 +81,7 @@ typedef struct ntv42_ioctl_device_info_t {
         uint64_t    address;    /* BAR base address */
         uint64_t    size;       /* BAR size in bytes */
         uint32_t    width;      /* Access width in bytes */
-        uint32_t    _pad0;
+        uint32_t    flags;      /* NTV42_BAR_FLAG_* flags (0 before version 4) */
     } bar[8];
 } ntv42_ioctl_device_info_t;
 
@@ -75,22 +94,47 @@ typedef struct ntv42_ioctl_device_info_t {
  * Phase 2: Events (commands 20-29)
  *==========================================================================*/
 
+/**
+ * Event slot layout: each (type, index) event source has a fixed slot, which
+ * indexes the event page (see ntv42_event_page_t).
+ */
+#define NTV42_EVENT_SLOT_OUTPUT_VSYNC   0   /* + output index (0-7),   type 0x0001 */
+#define NTV42_EVENT_SLOT_INPUT_VSYNC    8   /* + input index (0-7),    type 0x0002 */
+#define NTV42_EVENT_SLOT_REFERENCE      16  /* index 0 only,           type 0x0003 */
+#define NTV42_EVENT_SLOT_INPUT_CHANGE   17  /* + input index (0-7),    type 0x0004 */
+#define NTV42_EVENT_SLOT_AUDIO_IN_WRAP  25  /* + audio system (0-7),   type 0x0200 */
+#define NTV42_EVENT_SLOT_AUDIO_OUT_WRAP 33  /* + audio system (0-7),   type 0x0201 */
+#define NTV42_EVENT_SLOT_OUTPUT_ANC     41  /* + output index (0-7),   type 0x0005 */
+#define NTV42_EVENT_SLOT_INPUT_ANC      49  /* + input index (0-7),    type 0x0006 */
+#define NTV42_EVENT_SLOT_DMA_COMPLETE   57  /* + DMA engine (0-3),     type 0x0100 */
+#define NTV42_EVENT_SLOT_COUNT          64
+
 /** Enable/disable/query event source */
 typedef struct ntv42_ioctl_event_control_t {
     uint32_t    type;           /* ntv42 event type (0x0001, 0x0002, etc.) */
     uint32_t    index;          /* Which instance (output 0, input 1, etc.) */
-    uint32_t    enable;         /* 1 = enable, 0 = disable */
+    uint32_t    enable;         /* 1 = enable, 0 = disable (enabled events make the device poll() readable) */
     uint32_t    _pad0;
     uint64_t    count;          /* Output: current event count */
 } ntv42_ioctl_event_control_t;
 
-/** Wait for a single event type */
+/** Event wait flags */
+#define NTV42_EVENT_WAIT_SEQUENCE   (1 << 0)  /* Wait until the event count exceeds the input count */
+
+/**
+ * Wait for a single event type.
+ *
+ * Without NTV42_EVENT_WAIT_SEQUENCE, waits for the next event after the call
+ * is made. With it, waits until the event count exceeds the input count, and
+ * returns immediately if it already does. Passing the count returned by the
+ * previous wait therefore never misses an event that occurred between calls.
+ */
 typedef struct ntv42_ioctl_event_wait_t {
     uint32_t    type;           /* ntv42 event type */
     uint32_t    index;          /* Which instance */
     int32_t     timeout_ms;     /* Timeout: -1 = infinite, 0 = poll, >0 = ms */
-    uint32_t    _pad0;
-    uint64_t    count;          /* Output: event count after wait */
+    uint32_t    flags;          /* NTV42_EVENT_WAIT_* flags (0 in version 1) */
+    uint64_t    count;          /* Input: sequence to wait past (NTV42_EVENT_WAIT_SEQUENCE). Output: event count after wait */
     uint64_t    timestamp;      /* Output: kernel timestamp (ns) */
 } ntv42_ioctl_event_wait_t;
 
@@ -103,14 +147,92 @@ typedef struct ntv42_ioctl_event_status_t {
     uint64_t    count;          /* Output: current event count */
 } ntv42_ioctl_event_status_t;
 
+/**
+ * Acknowledge events for poll().
+ *
+ * The device file is poll() readable (POLLIN) while the device event sequence
+ * (the total number of events on enabled slots) exceeds the sequence last
+ * acknowledged through this file. Acknowledging the sequence read from the
+ * event page, rather than the current one, keeps the file readable if more
+ * events arrived in the meantime.
+ */
+typedef struct ntv42_ioctl_event_ack_t {
+    uint64_t    sequence;       /* Input: sequence to acknowledge (0 = current). Output: current sequence */
+} ntv42_ioctl_event_ack_t;
+
+/** Event page magic ('N42E') and version */
+#define NTV42_EVENT_PAGE_MAGIC      0x4e343245
+#define NTV42_EVENT_PAGE_VERSION    1
+
+/** mmap() offset of the event page, in pages (see NTV42_BAR_PGOFF) */
+#define NTV42_EVENT_PAGE_PGOFF      16
+
+/**
+ * Read-only page of event counters, mapped with mmap() (one page at
+ * NTV42_EVENT_PAGE_PGOFF), so that clients can sample event counts and
+ * timestamps without a system call.
+ *
+ * The driver increments "lock" before and after each update, so it is odd
+ * while an update is in progress. Readers should sample "lock", copy what
+ * they need, and retry if "lock" was odd or has since changed.
+ */
+typedef struct ntv42_event_page_t {
+    uint32_t    magic;          /* NTV42_EVENT_PAGE_MAGIC */
+    uint32_t    version;        /* NTV42_EVENT_PAGE_VERSION */
+    uint32_t    slot_count;     /* Number of valid entries in slot[] */
+    uint32_t    lock;           /* Update sequence lock (odd = update in progress) */
+    uint64_t    sequence;       /* Total events on enabled slots (see IOCTL_NTV42_EVENT_ACK) */
+    struct {
+        uint64_t    count;      /* Event count */
+        uint64_t    timestamp;  /* Kernel timestamp of the last event (ns) */
+    } slot[NTV42_EVENT_SLOT_COUNT];
+} ntv42_event_page_t;
+
+/** Simulated vsync flags */
+#define NTV42_VSYNC_FLAG_INTERLACED (1 << 0)  /* One event per field (two per frame) */
+#define NTV42_VSYNC_FLAG_QUERY      (1 << 1)  /* Only answer the current cadence */
+
+/**
+ * Set or query the simulated vsync cadence of one output or input
+ * (ntv42dummy devices only; other devices fail with ENOTTY).
+ *
+ * Vsync events occur at exactly rate_num/rate_den frames per second (e.g.
+ * 60000/1001 for 59.94), at start_time + n * period, without drift. With
+ * NTV42_VSYNC_FLAG_INTERLACED, an event occurs for each field. A rate_num
+ * of 0 stops the events. Event timestamps are the ideal vsync times. The
+ * field of the latest event (0 = first) is bit 0 of the BAR0 register at
+ * NTV42_VSYNC_FIELD_REG, which is updated before the event is raised.
+ */
+#define NTV42_VSYNC_FIELD_REG(type, index)  (0xFC0 + ((type) == 0x0002 ? 32 : 0) + (index) * 4)  /* Byte offset */
+
+typedef struct ntv42_ioctl_vsync_config_t {
+    uint32_t    type;           /* Vsync event type (0x0001 output, 0x0002 input) */
+    uint32_t    index;          /* Output or input index (0-7) */
+    uint32_t    rate_num;       /* Frame rate numerator (0 = stopped). Output: current */
+    uint32_t    rate_den;       /* Frame rate denominator. Output: current */
+    uint32_t    flags;          /* NTV42_VSYNC_FLAG_* flags. Output: current (INTERLACED) */
+    uint32_t    _pad0;
+    uint64_t    start_time;     /* Output: time the cadence started (ns, ktime_get_ns() clock) */
+} ntv42_ioctl_vsync_config_t;
+
 #define IOCTL_NTV42_EVENT_CONTROL   _IOWR(NTV42_DEVICE_TYPE, 20, ntv42_ioctl_event_control_t)
 #define IOCTL_NTV42_EVENT_WAIT      _IOWR(NTV42_DEVICE_TYPE, 21, ntv42_ioctl_event_wait_t)
 #define IOCTL_NTV42_EVENT_STATUS    _IOWR(NTV42_DEVICE_TYPE, 22, ntv42_ioctl_event_status_t)
+#define IOCTL_NTV42_EVENT_ACK       _IOWR(NTV42_DEVICE_TYPE, 23, ntv42_ioctl_event_ack_t)
+#define IOCTL_NTV42_VSYNC_CONFIG    _IOWR(NTV42_DEVICE_TYPE, 24, ntv42_ioctl_vsync_config_t)
 
 /*============================================================================
  * Phase 3: DMA (commands 30-39)
  *==========================================================================*/
 
+/** DMA limits */
+#define NTV42_DMA_ENGINE_MAX        4
+#define NTV42_DMA_SEGMENT_MAX       256                     /* Segments per vectored transfer */
+#define NTV42_DMA_SEGMENT_BYTES_MAX (4ULL * 1024 * 1024 * 1024) /* Bytes per segment (or single transfer) */
+
+/** Asynchronous DMA completion event type (index = engine) */
+#define NTV42_EVENT_TYPE_DMA_COMPLETE   0x0100
+
 /** DMA transfer request (synchronous) */
 typedef struct ntv42_ioctl_dma_transfer_t {
     uint32_t    engine;         /* DMA engine index */
@@ -139,8 +261,63 @@ typedef struct ntv42_ioctl_dma_info_t {
     } engines[4];
 } ntv42_ioctl_dma_info_t;
 
+/** One contiguous host/device range of a vectored transfer */
+typedef struct ntv42_ioctl_dma_segment_t {
+    uint64_t    host_addr;      /* Userspace buffer address */
+    uint64_t    device_addr;    /* Device memory byte offset */
+    uint64_t    bytes;          /* Segment size in bytes */
+} ntv42_ioctl_dma_segment_t;
+
+/** Vectored DMA flags */
+#define NTV42_DMA_FLAG_ASYNC        (1 << 0)  /* Queue the transfer and return immediately */
+
+/**
+ * Vectored DMA transfer: moves up to NTV42_DMA_SEGMENT_MAX segments in one
+ * call, in order, stopping at the first failure.
+ *
+ * With NTV42_DMA_FLAG_ASYNC the transfer is queued and the call returns with
+ * a transfer_id. Asynchronous transfers complete in submission order, and
+ * each completion raises a NTV42_EVENT_TYPE_DMA_COMPLETE event for the engine,
+ * whose count then equals the transfer_id. So waiting for the event with
+ * NTV42_EVENT_WAIT_SEQUENCE and count = transfer_id - 1 waits for completion,
+ * and IOCTL_NTV42_DMA_STATUS then reports the result. The host buffers must
+ * remain valid until the transfer completes.
+ */
+typedef struct ntv42_ioctl_dma_vector_t {
+    uint32_t    engine;         /* DMA engine index (also the completion event index) */
+    uint32_t    direction;      /* 1=to_device, 2=from_device */
+    uint64_t    segments_ptr;   /* Pointer to ntv42_ioctl_dma_segment_t array */
+    uint32_t    segment_count;  /* Number of segments */
+    uint32_t    flags;          /* NTV42_DMA_FLAG_* flags */
+    /* Output */
+    uint64_t    bytes_xfered;   /* Bytes transferred (synchronous only) */
+    uint64_t    elapsed_ns;     /* Transfer time (synchronous only) */
+    uint64_t    transfer_id;    /* Transfer sequence number (asynchronous only) */
+    int32_t     status;         /* 0 = success (or queued), negative = error */
+    uint32_t    _pad0;
+} ntv42_ioctl_dma_vector_t;
+
+/** Asynchronous DMA transfer states */
+#define NTV42_DMA_STATE_PENDING     0
+#define NTV42_DMA_STATE_COMPLETE    1
+#define NTV42_DMA_STATE_UNKNOWN     2   /* Never submitted, or too old to report */
+
+/** Asynchronous DMA transfer status query */
+typedef struct ntv42_ioctl_dma_status_t {
+    uint32_t    engine;         /* DMA engine index */
+    uint32_t    state;          /* Output: NTV42_DMA_STATE_* */
+    uint64_t    transfer_id;    /* Transfer to query */
+    /* Output */
+    uint64_t    bytes_xfered;   /* Bytes transferred */
+    uint64_t    elapsed_ns;     /* Transfer time, excluding time queued */
+    int32_t     status;         /* 0 = success, negative = error */
+    uint32_t    _pad0;
+} ntv42_ioctl_dma_status_t;
+
 #define IOCTL_NTV42_DMA_TRANSFER  _IOWR(NTV42_DEVICE_TYPE, 30, ntv42_ioctl_dma_transfer_t)
 #define IOCTL_NTV42_DMA_INFO      _IOR(NTV42_DEVICE_TYPE,  31, ntv42_ioctl_dma_info_t)
+#define IOCTL_NTV42_DMA_VECTOR    _IOWR(NTV42_DEVICE_TYPE, 32, ntv42_ioctl_dma_vector_t)
+#define IOCTL_NTV42_DMA_STATUS    _IOWR(NTV42_DEVICE_TYPE, 33, ntv42_ioctl_dma_status_t)
 
 /*============================================================================
  * Phase 4: Register Sequencing (commands 40-47)
@@ -150,6 +327,7 @@ typedef struct ntv42_ioctl_dma_info_t {
 #define NTV42_REGBATCH_ONESHOT      (1 << 0)  /* Execute once, then auto-cancel */
 #define NTV42_REGBATCH_RECURRING    (1 << 1)  /* Re-arm after each execution */
 #define NTV42_REGBATCH_READBACK     (1 << 2)  /* Read registers after write */
+#define NTV42_REGBATCH_IMMEDIATE    (1 << 3)  /* Execute now, in order, then discard (batch_id = 0) */
 
 /** Maximum entries per batch */
 #define NTV42_REGBATCH_MAX_ENTRIES  256
@@ -162,7 +340,16 @@ typedef struct ntv42_ioctl_regbatch_entry_t {
     uint32_t    mask;           /* Bit mask (0xFFFFFFFF for full write) */
 } ntv42_ioctl_regbatch_entry_t;
 
-/** Batch submission */
+/**
+ * Batch submission.
+ *
+ * Batches normally wait for their trigger event. With NTV42_REGBATCH_IMMEDIATE
+ * the entries are instead written during the call, in order, without
+ * interleaving with other immediate batches. This makes a masked entry an
+ * atomic read-modify-write, and moves many registers in one call. Every entry
+ * must then address a register within its BAR, or nothing is written. Entry
+ * values are not shifted, so they must already be positioned within the mask.
+ */
 typedef struct ntv42_ioctl_regbatch_submit_t {
     uint32_t    trigger_event;  /* Event type that triggers execution */
     uint32_t    trigger_index;  /* Event index (e.g., output 0) */
@@ -201,10 +388,12 @@ int ntv42_ioctl_reg_write(struct ntv42_device_t *device, void *io, unsigned long
 int ntv42_ioctl_device_info(struct ntv42_device_t *device, void *io, unsigned long arg);
 int ntv42_ioctl_dma_transfer(struct ntv42_device_t *device, void *io, unsigned long arg);
 int ntv42_ioctl_dma_info(struct ntv42_device_t *device, void *io, unsigned long arg);
-int ntv42_ioctl_dma_info(struct ntv42_device_t *device, void *io, unsigned long arg);
+int ntv42_ioctl_dma_vector(struct ntv42_device_t *device, void *io, unsigned long arg);
+int ntv42_ioctl_dma_status(struct ntv42_device_t *device, void *io, unsigned long arg);
 int ntv42_ioctl_event_control(struct ntv42_device_t *device, void *io, unsigned long arg);
 int ntv42_ioctl_event_wait(struct ntv42_device_t *device, void *io, unsigned long arg);
 int ntv42_ioctl_event_status(struct ntv42_device_t *device, void *io, unsigned long arg);
+int ntv42_ioctl_event_ack(struct ntv42_device_t *device, uint64_t *event_ack, unsigned long arg);
 int ntv42_ioctl_regbatch_submit(struct ntv42_device_t *device, void *io, unsigned long arg);
 int ntv42_ioctl_regbatch_cancel(struct ntv42_device_t *device, void *io, unsigned long arg);
 int ntv42_ioctl_regbatch_status(struct ntv42_device_t *device, void *io, unsigned long arg);
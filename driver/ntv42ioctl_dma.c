@@ -8,21 +8,213 @@
  * The DMA transfer handler uses the ntv42_device_t's DMA callbacks (set up by
  * the host driver). For the ntv42dummy module, these are bounce-buffer based.
  * For the NTV2 driver, they wrap the existing DMA infrastructure.
+ *
+ * Transfers are split into chunks of at most NTV42_DMA_CHUNK_BYTES, so large
+ * frames never reach the host callback as a single transfer. Asynchronous
+ * vectored transfers run on the device's ordered workqueue, in the submitting
+ * process's address space.
  */
 
 #include <linux/kernel.h>
 #include <linux/slab.h>
 #include <linux/uaccess.h>
+#include <linux/sched.h>
+#include <linux/workqueue.h>
+#include <linux/ktime.h>
+#include <linux/version.h>
+#if (LINUX_VERSION_CODE >= KERNEL_VERSION(4,11,0))
+#include <linux/sched/mm.h>
+#endif
+#if (LINUX_VERSION_CODE >= KERNEL_VERSION(5,8,0))
+#include <linux/kthread.h>
+#else
+#include <linux/mmu_context.h>
+#endif
 
 #include "ntv42device.h"
 #include "ntv42ioctl.h"
 
+/* Largest piece handed to the host callback (or copied) at once */
+#define NTV42_DMA_CHUNK_BYTES   (64 * 1024 * 1024)
+
+/* Queued asynchronous transfer */
+struct ntv42_dma_job {
+    struct work_struct          work;
+    ntv42_device_t             *device;
+    void                       *io;
+    struct mm_struct           *mm;
+    uint32_t                    engine;
+    uint32_t                    direction;
+    uint64_t                    transfer_id;
+    uint32_t                    segment_count;
+    ntv42_ioctl_dma_segment_t   segments[];
+};
+
+
+static int ntv42_dma_check(ntv42_device_t *device, uint64_t device_addr, uint64_t bytes)
+{
+    if (bytes == 0 || bytes > NTV42_DMA_SEGMENT_BYTES_MAX)
+        return NTV42_RETURN_BAD_PARAMETER;
+
+    /* Host DMA validates its own device addresses */
+    if (device->dma_transfer != NULL)
+        return NTV42_RETURN_SUCCESS;
+
+    if (device->dma_buf == NULL || device->dma_buf_size == 0)
+        return NTV42_RETURN_BAD_STATE;
+
+    if (device_addr > device->dma_buf_size || bytes > device->dma_buf_size - device_addr)
+        return NTV42_RETURN_BAD_PARAMETER;
+
+    return NTV42_RETURN_SUCCESS;
+}
+
+static int ntv42_dma_segment(ntv42_device_t *device, void *io, uint32_t direction,
+                             uint64_t host_addr, uint64_t device_addr, uint64_t bytes,
+                             uint64_t *bytes_xfered)
+{
+    uint64_t done = 0;
+    int ret;
+
+    while (done < bytes) {
+        uint64_t chunk = min_t(uint64_t, bytes - done, NTV42_DMA_CHUNK_BYTES);
+        void __user *user_buf = (void __user *)(uintptr_t)(host_addr + done);
+
+        if (device->dma_transfer != NULL) {
+            /* Report what the host actually moved, even when it fails or comes up short */
+            uint64_t xfered = 0;
+            ret = device->dma_transfer(device->host, io, direction, user_buf,
+                                       device_addr + done, chunk, &xfered);
+            *bytes_xfered += min_t(uint64_t, xfered, chunk);
+            if (ret != 0)
+                return ret;
+            if (xfered < chunk)
+                return NTV42_RETURN_IO_ERROR;
+        } else if (direction == 1) {
+            /* To device: copy from user to device buffer */
+            if (copy_from_user(device->dma_buf + device_addr + done, user_buf, chunk))
+                return -EFAULT;
+            *bytes_xfered += chunk;
+        } else {
+            /* From device: copy from device buffer to user */
+            if (copy_to_user(user_buf, device->dma_buf + device_addr + done, chunk))
+                return -EFAULT;
+            *bytes_xfered += chunk;
+        }
+
+        done += chunk;
+
+        if (done < bytes) {
+            if (fatal_signal_pending(current))
+                return -EINTR;
+            cond_resched();
+        }
+    }
+
+    return NTV42_RETURN_SUCCESS;
+}
+
+static int ntv42_dma_segments(ntv42_device_t *device, void *io, uint32_t direction,
+                              const ntv42_ioctl_dma_segment_t *segments, uint32_t count,
+                              uint64_t *bytes_xfered)
+{
+    uint32_t i;
+    int ret;
+
+    for (i = 0; i < count; i++) {
+        ret = ntv42_dma_segment(device, io, direction, segments[i].host_addr,
+                                segments[i].device_addr, segments[i].bytes, bytes_xfered);
+        if (ret != NTV42_RETURN_SUCCESS)
+            return ret;
+    }
+
+    return NTV42_RETURN_SUCCESS;
+}
 
 int ntv42_ioctl_dma_transfer(ntv42_device_t *device, void *io, unsigned long arg)
 {
     ntv42_ioctl_dma_transfer_t param;
-    int status = 0;
-//    void *kbuf = NULL;
+    int ret;
+
+    if (device == NULL)
+        return NTV42_RETURN_NO_DEVICE;
+
+    if (copy_from_user(&param, (void __user *)arg, sizeof(param)))
+        return -EFAULT;
+
+    /* Validate */
+    if (param.bytes == 0 || param.bytes > NTV42_DMA_SEGMENT_BYTES_MAX)
+        return NTV42_RETURN_BAD_PARAMETER;
+
+    if (param.direction != 1 && param.direction != 2)
+        return NTV42_RETURN_BAD_PARAMETER;
+
+    param.bytes_xfered = 0;
+    ret = ntv42_dma_check(device, param.device_addr, param.bytes);
+    if (ret == NTV42_RETURN_SUCCESS)
+        ret = ntv42_dma_segment(device, io, param.direction, param.host_addr,
+                                param.device_addr, param.bytes, &param.bytes_xfered);
+    param.status = ret;
+
+    if (copy_to_user((void __user *)arg, &param, sizeof(param)))
+        return -EFAULT;
+
+    return ret;
+}
+
+static void ntv42_dma_work(struct work_struct *work)
+{
+    struct ntv42_dma_job *job = container_of(work, struct ntv42_dma_job, work);
+    ntv42_device_t *device = job->device;
+    ntv42_dma_result_t *result;
+    uint64_t bytes_xfered = 0;
+    uint64_t start;
+    unsigned long flags;
+    int ret;
+
+    /* Run in the submitter's address space, so the user buffers resolve */
+    start = ktime_get_ns();
+#if (LINUX_VERSION_CODE >= KERNEL_VERSION(5,8,0))
+    kthread_use_mm(job->mm);
+#else
+    use_mm(job->mm);
+#endif
+    ret = ntv42_dma_segments(device, job->io, job->direction, job->segments,
+                             job->segment_count, &bytes_xfered);
+#if (LINUX_VERSION_CODE >= KERNEL_VERSION(5,8,0))
+    kthread_unuse_mm(job->mm);
+#else
+    unuse_mm(job->mm);
+#endif
+    mmput(job->mm);
+
+    spin_lock_irqsave(&device->dma_lock, flags);
+    result = &device->dma_result[device->dma_result_next];
+    device->dma_result_next = (device->dma_result_next + 1) % NTV42_DMA_HISTORY_MAX;
+    result->transfer_id = job->transfer_id;
+    result->engine = job->engine;
+    result->bytes_xfered = bytes_xfered;
+    result->elapsed_ns = ktime_get_ns() - start;
+    result->status = ret;
+    device->dma_completed[job->engine] = job->transfer_id;
+    device->dma_pending--;
+    spin_unlock_irqrestore(&device->dma_lock, flags);
+
+    /* The engine's completion event count now equals the transfer id */
+    ntv42device_event(device, NTV42_EVENT_TYPE_DMA_COMPLETE, job->engine);
+
+    kfree(job);
+}
+
+int ntv42_ioctl_dma_vector(ntv42_device_t *device, void *io, unsigned long arg)
+{
+    ntv42_ioctl_dma_vector_t param;
+    ntv42_ioctl_dma_segment_t *segments;
+    struct ntv42_dma_job *job = NULL;
+    unsigned long flags;
+    uint64_t start;
+    uint32_t i;
+    int ret;
 
     if (device == NULL)
         return NTV42_RETURN_NO_DEVICE;
@@ -31,76 +223,149 @@ int ntv42_ioctl_dma_transfer(ntv42_device_t *device, void *io, unsigned long arg
         return -EFAULT;
 
     /* Validate */
-    if (param.bytes == 0 || param.bytes > (64 * 1024 * 1024))
+    if (param.segment_count == 0 || param.segment_count > NTV42_DMA_SEGMENT_MAX)
         return NTV42_RETURN_BAD_PARAMETER;
 
     if (param.direction != 1 && param.direction != 2)
         return NTV42_RETURN_BAD_PARAMETER;
 
-    /* Use device DMA callback if available */
-    if (device->dma_transfer != NULL) {
-        int ret = device->dma_transfer(device->host, io, param.direction,
-                                        (void __user *)(uintptr_t)param.host_addr,
-                                        param.device_addr, param.bytes,
-                                        &param.bytes_xfered);
-        param.status = ret;
+    if (param.engine >= NTV42_DMA_ENGINE_MAX)
+        return NTV42_RETURN_BAD_PARAMETER;
+
+    if ((param.flags & ~NTV42_DMA_FLAG_ASYNC) != 0)
+        return NTV42_RETURN_BAD_PARAMETER;
 
-        if (copy_to_user((void __user *)arg, &param, sizeof(param)))
-            return -EFAULT;
+    param.bytes_xfered = 0;
+    param.elapsed_ns = 0;
+    param.transfer_id = 0;
 
-        return (ret == 0) ? NTV42_RETURN_SUCCESS : ret;
+    /* Copy segments from userspace (into the job, if asynchronous) */
+    if (param.flags & NTV42_DMA_FLAG_ASYNC) {
+        job = kzalloc(sizeof(*job) + (size_t)param.segment_count * sizeof(job->segments[0]), GFP_KERNEL);
+        if (job == NULL)
+            return NTV42_RETURN_NO_MEMORY;
+        segments = job->segments;
+    } else {
+        segments = kmalloc_array(param.segment_count, sizeof(*segments), GFP_KERNEL);
+        if (segments == NULL)
+            return NTV42_RETURN_NO_MEMORY;
     }
 
-    /* Fallback: bounce-buffer DMA using device memory array */
-    /* This is used by the dummy module */
-    if (device->dma_buf == NULL || device->dma_buf_size == 0) {
-        param.status = NTV42_RETURN_BAD_STATE;
-        param.bytes_xfered = 0;
-        if (copy_to_user((void __user *)arg, &param, sizeof(param)))
-            return -EFAULT;
-        return NTV42_RETURN_BAD_STATE;
+    if (copy_from_user(segments, (void __user *)(uintptr_t)param.segments_ptr,
+                       (size_t)param.segment_count * sizeof(*segments))) {
+        ret = -EFAULT;
+        goto done;
     }
 
-    /* Bounds check device address */
-    if (param.device_addr + param.bytes > device->dma_buf_size) {
-        param.status = NTV42_RETURN_BAD_PARAMETER;
-        param.bytes_xfered = 0;
-        if (copy_to_user((void __user *)arg, &param, sizeof(param)))
-            return -EFAULT;
-        return NTV42_RETURN_BAD_PARAMETER;
+    /* Check every segment before moving any data */
+    for (i = 0; i < param.segment_count; i++) {
+        ret = ntv42_dma_check(device, segments[i].device_addr, segments[i].bytes);
+        if (ret != NTV42_RETURN_SUCCESS)
+            goto done;
     }
 
-    if (param.direction == 1) {
-        /* To device: copy from user to device buffer */
-        if (copy_from_user(device->dma_buf + param.device_addr,
-                           (void __user *)(uintptr_t)param.host_addr,
-                           param.bytes)) {
-            param.status = -EFAULT;
-            param.bytes_xfered = 0;
-            status = copy_to_user((void __user *)arg, &param, sizeof(param));
-            return -EFAULT;
-        }
-    } else {
-        /* From device: copy from device buffer to user */
-        if (copy_to_user((void __user *)(uintptr_t)param.host_addr,
-                         device->dma_buf + param.device_addr,
-                         param.bytes)) {
-            param.status = -EFAULT;
-            param.bytes_xfered = 0;
-            status = copy_to_user((void __user *)arg, &param, sizeof(param));
-            return -EFAULT;
-        }
+    if (job == NULL) {
+        start = ktime_get_ns();
+        ret = ntv42_dma_segments(device, io, param.direction, segments,
+                                 param.segment_count, &param.bytes_xfered);
+        param.elapsed_ns = ktime_get_ns() - start;
+        goto done;
+    }
+
+    job->mm = get_task_mm(current);
+    if (job->mm == NULL) {
+        ret = NTV42_RETURN_BAD_STATE;
+        goto done;
+    }
+    job->device = device;
+    job->io = io;
+    job->engine = param.engine;
+    job->direction = param.direction;
+    job->segment_count = param.segment_count;
+    INIT_WORK(&job->work, ntv42_dma_work);
+
+    /* Assign the id and queue together, so ids complete in order */
+    spin_lock_irqsave(&device->dma_lock, flags);
+    if (device->dma_pending >= NTV42_DMA_ASYNC_MAX) {
+        spin_unlock_irqrestore(&device->dma_lock, flags);
+        mmput(job->mm);
+        ret = NTV42_RETURN_BUSY;
+        goto done;
     }
+    device->dma_pending++;
+    job->transfer_id = ++device->dma_submitted[param.engine];
+    param.transfer_id = job->transfer_id;
+    queue_work(device->dma_queue, &job->work);
+    spin_unlock_irqrestore(&device->dma_lock, flags);
+
+    job = NULL;     /* owned by the worker */
+    segments = NULL;
+    ret = NTV42_RETURN_SUCCESS;
+
+done:
+    if (job != NULL)
+        kfree(job);
+    else if (!(param.flags & NTV42_DMA_FLAG_ASYNC))
+        kfree(segments);
+
+    param.status = ret;
+    if (copy_to_user((void __user *)arg, &param, sizeof(param)))
+        return -EFAULT;
+
+    return ret;
+}
+
+int ntv42_ioctl_dma_status(ntv42_device_t *device, void *io, unsigned long arg)
+{
+    ntv42_ioctl_dma_status_t param;
+    unsigned long flags;
+    int i;
+
+    if (device == NULL)
+        return NTV42_RETURN_NO_DEVICE;
+
+    if (copy_from_user(&param, (void __user *)arg, sizeof(param)))
+        return -EFAULT;
+
+    if (param.engine >= NTV42_DMA_ENGINE_MAX)
+        return NTV42_RETURN_BAD_PARAMETER;
 
-    param.bytes_xfered = param.bytes;
+    param.state = NTV42_DMA_STATE_UNKNOWN;
+    param.bytes_xfered = 0;
+    param.elapsed_ns = 0;
     param.status = 0;
 
+    spin_lock_irqsave(&device->dma_lock, flags);
+    if (param.transfer_id != 0 && param.transfer_id <= device->dma_submitted[param.engine]) {
+        if (param.transfer_id > device->dma_completed[param.engine]) {
+            param.state = NTV42_DMA_STATE_PENDING;
+        } else {
+            for (i = 0; i < NTV42_DMA_HISTORY_MAX; i++) {
+                ntv42_dma_result_t *result = &device->dma_result[i];
+                if (result->transfer_id == param.transfer_id && result->engine == param.engine) {
+                    param.state = NTV42_DMA_STATE_COMPLETE;
+                    param.bytes_xfered = result->bytes_xfered;
+                    param.elapsed_ns = result->elapsed_ns;
+                    param.status = result->status;
+                    break;
+                }
+            }
+        }
+    }
+    spin_unlock_irqrestore(&device->dma_lock, flags);
+
     if (copy_to_user((void __user *)arg, &param, sizeof(param)))
         return -EFAULT;
 
     return NTV42_RETURN_SUCCESS;
 }
 
+void ntv42_dma_flush(ntv42_device_t *device)
+{
+    if (device != NULL && device->dma_queue != NULL)
+        flush_workqueue(device->dma_queue);
+}
+
 int ntv42_ioctl_dma_info(ntv42_device_t *device, void *io, unsigned long arg)
 {
     ntv42_ioctl_dma_info_t info;
@@ -117,14 +382,14 @@ int ntv42_ioctl_dma_info(ntv42_device_t *device, void *io, unsigned long arg)
         info.engines[0].host_align = 1;
         info.engines[0].device_align = 1;
         info.engines[0].xfer_align = 1;
-        info.engines[0].max_xfer = device->dma_buf_size;
+        info.engines[0].max_xfer = min_t(uint64_t, device->dma_buf_size, NTV42_DMA_SEGMENT_BYTES_MAX);
     } else if (device->dma_transfer != NULL) {
         info.engine_count = 1;
         info.engines[0].directions = 0x03;
         info.engines[0].host_align = 4;
         info.engines[0].device_align = 4;
         info.engines[0].xfer_align = 4;
-        info.engines[0].max_xfer = 64 * 1024 * 1024;
+        info.engines[0].max_xfer = NTV42_DMA_SEGMENT_BYTES_MAX;
     }
 
     if (copy_to_user((void __user *)arg, &info, sizeof(info)))
@@ -12,6 +12,7 @@
 #include <linux/sched.h>
 #include <linux/wait.h>
 #include <linux/ktime.h>
+#include <linux/poll.h>
 
 #include "ntv42device.h"
 #include "ntv42ioctl.h"
@@ -45,7 +46,7 @@ int ntv42_ioctl_event_wait(ntv42_device_t *device, void *io, unsigned long arg)
 {
     ntv42_ioctl_event_wait_t param;
     int slot;
-    uint64_t start_count;
+    uint64_t wait_count;
     long timeout_jiffies;
     long ret;
 
@@ -59,25 +60,32 @@ int ntv42_ioctl_event_wait(ntv42_device_t *device, void *io, unsigned long arg)
     if (slot < 0)
         return NTV42_RETURN_BAD_PARAMETER;
 
-    start_count = device->event_count[slot];
+    if ((param.flags & ~NTV42_EVENT_WAIT_SEQUENCE) != 0)
+        return NTV42_RETURN_BAD_PARAMETER;
+
+    /* Wait until the count passes the caller's sequence, or the count at entry */
+    if (param.flags & NTV42_EVENT_WAIT_SEQUENCE)
+        wait_count = param.count;
+    else
+        wait_count = READ_ONCE(device->event_count[slot]);
 
     /* Determine timeout */
     if (param.timeout_ms == 0) {
         /* Poll mode — check immediately */
-        if (device->event_count[slot] == start_count) {
+        if (READ_ONCE(device->event_count[slot]) <= wait_count) {
             return NTV42_RETURN_TIMEOUT;
         }
     } else if (param.timeout_ms < 0) {
         /* Infinite wait */
-        ret = wait_event_interruptible(device->event_wait,
-            device->event_count[slot] != start_count);
+        ret = wait_event_interruptible(device->event_slot_wait[slot],
+            READ_ONCE(device->event_count[slot]) > wait_count);
         if (ret != 0)
             return -EINTR;
     } else {
         /* Timed wait */
         timeout_jiffies = msecs_to_jiffies(param.timeout_ms);
-        ret = wait_event_interruptible_timeout(device->event_wait,
-            device->event_count[slot] != start_count,
+        ret = wait_event_interruptible_timeout(device->event_slot_wait[slot],
+            READ_ONCE(device->event_count[slot]) > wait_count,
             timeout_jiffies);
         if (ret == 0)
             return NTV42_RETURN_TIMEOUT;
@@ -86,8 +94,7 @@ int ntv42_ioctl_event_wait(ntv42_device_t *device, void *io, unsigned long arg)
     }
 
     /* Fill output */
-    param.count = device->event_count[slot];
-    param.timestamp = device->event_timestamp[slot];
+    ntv42device_event_read(device, slot, &param.count, &param.timestamp);
 
     if (copy_to_user((void __user *)arg, &param, sizeof(param)))
         return -EFAULT;
@@ -111,7 +118,7 @@ int ntv42_ioctl_event_status(ntv42_device_t *device, void *io, unsigned long arg
 
     if (slot >= 0) {
         param.enabled = device->event_enabled[slot] ? 1 : 0;
-        param.count = device->event_count[slot];
+        param.count = READ_ONCE(device->event_count[slot]);
     } else {
         param.enabled = 0;
         param.count = 0;
@@ -122,3 +129,43 @@ int ntv42_ioctl_event_status(ntv42_device_t *device, void *io, unsigned long arg
 
     return NTV42_RETURN_SUCCESS;
 }
+
+int ntv42_ioctl_event_ack(ntv42_device_t *device, uint64_t *event_ack, unsigned long arg)
+{
+    ntv42_ioctl_event_ack_t param;
+    uint64_t sequence;
+
+    if (device == NULL)
+        return NTV42_RETURN_NO_DEVICE;
+
+    if (event_ack == NULL)
+        return NTV42_RETURN_BAD_STATE;
+
+    if (copy_from_user(&param, (void __user *)arg, sizeof(param)))
+        return -EFAULT;
+
+    /* Never acknowledge past the current sequence */
+    sequence = ntv42device_event_sequence(device);
+    if ((param.sequence == 0) || (param.sequence > sequence))
+        param.sequence = sequence;
+    WRITE_ONCE(*event_ack, param.sequence);
+    param.sequence = sequence;
+
+    if (copy_to_user((void __user *)arg, &param, sizeof(param)))
+        return -EFAULT;
+
+    return NTV42_RETURN_SUCCESS;
+}
+
+unsigned int ntv42_event_poll(ntv42_device_t *device, struct file *file, struct poll_table_struct *wait, uint64_t event_ack)
+{
+    if (device == NULL)
+        return POLLERR;
+
+    poll_wait(file, &device->event_wait, wait);
+
+    if (ntv42device_event_sequence(device) > event_ack)
+        return POLLIN | POLLRDNORM;
+
+    return 0;
+}
@@ -43,6 +43,29 @@ static DEFINE_SPINLOCK(batch_lock);
 
 void ntv42_regbatch_check(ntv42_device_t *device, uint32_t event_type, uint32_t event_index);
 
+/* Writes the batch entries, in order (entries for missing BARs are skipped) */
+static void ntv42_regbatch_execute(ntv42_device_t *device, struct ntv42_regbatch_entry *entries, int entry_count)
+{
+    int j;
+
+    for (j = 0; j < entry_count; j++) {
+        struct ntv42_regbatch_entry *e = &entries[j];
+        ntv42device_regio_t regio;
+
+        if ((int)e->bar >= device->bar_count)
+            continue;
+
+        regio.address = e->offset;
+        regio.mask = e->mask;
+        regio.shift = 0;
+        regio.data = e->value;
+
+        device->bar[e->bar].reg_write(device->host,
+                                       device->bar[e->bar].id,
+                                       &regio);
+    }
+}
+
 /**
  * Called from ntv42device_event() in ISR context.
  * Executes all pending batches matching the given trigger.
@@ -59,7 +82,6 @@ void ntv42_regbatch_check(ntv42_device_t *device, uint32_t event_type, uint32_t
 
     for (i = 0; i < NTV42_REGBATCH_MAX_ACTIVE; i++) {
         struct ntv42_regbatch *batch = &batches[dev_idx][i];
-        int j;
 
         if (batch->state != 0)  /* not pending */
             continue;
@@ -70,22 +92,7 @@ void ntv42_regbatch_check(ntv42_device_t *device, uint32_t event_type, uint32_t
             continue;
 
         /* Execute all entries */
-        for (j = 0; j < batch->entry_count; j++) {
-            struct ntv42_regbatch_entry *e = &batch->entries[j];
-            ntv42device_regio_t regio;
-
-            if ((int)e->bar >= device->bar_count)
-                continue;
-
-            regio.address = e->offset;
-            regio.mask = e->mask;
-            regio.shift = 0;
-            regio.data = e->value;
-
-            device->bar[e->bar].reg_write(device->host,
-                                           device->bar[e->bar].id,
-                                           &regio);
-        }
+        ntv42_regbatch_execute(device, batch->entries, batch->entry_count);
 
         batch->exec_count++;
         batch->last_exec_time = ktime_get_ns();
@@ -96,6 +103,31 @@ void ntv42_regbatch_check(ntv42_device_t *device, uint32_t event_type, uint32_t
     }
 }
 
+/* Executes an NTV42_REGBATCH_IMMEDIATE batch: all entries must address valid registers */
+static int ntv42_regbatch_immediate(ntv42_device_t *device, struct ntv42_regbatch_entry *entries, int entry_count)
+{
+    unsigned long flags;
+    int j;
+
+    for (j = 0; j < entry_count; j++) {
+        struct ntv42_regbatch_entry *e = &entries[j];
+        ntv42_bar_t *bar;
+
+        if ((int)e->bar >= device->bar_count)
+            return NTV42_RETURN_BAD_PARAMETER;
+        bar = &device->bar[e->bar];
+        if (((uint64_t)e->offset + bar->width > bar->size) || (e->offset % bar->width != 0))
+            return NTV42_RETURN_BAD_PARAMETER;
+    }
+
+    /* The batch lock keeps immediate batches from interleaving with each other */
+    spin_lock_irqsave(&batch_lock, flags);
+    ntv42_regbatch_execute(device, entries, entry_count);
+    spin_unlock_irqrestore(&batch_lock, flags);
+
+    return NTV42_RETURN_SUCCESS;
+}
+
 int ntv42_ioctl_regbatch_submit(ntv42_device_t *device, void *io, unsigned long arg)
 {
     ntv42_ioctl_regbatch_submit_t param;
@@ -129,6 +161,19 @@ int ntv42_ioctl_regbatch_submit(ntv42_device_t *device, void *io, unsigned long
         return -EFAULT;
     }
 
+    /* Immediate batches execute now, and don't occupy a slot */
+    if (param.flags & NTV42_REGBATCH_IMMEDIATE) {
+        int ret = ntv42_regbatch_immediate(device, entries, param.entry_count);
+
+        kfree(entries);
+        if (ret != NTV42_RETURN_SUCCESS)
+            return ret;
+        param.batch_id = 0;
+        if (copy_to_user((void __user *)arg, &param, sizeof(param)))
+            return -EFAULT;
+        return NTV42_RETURN_SUCCESS;
+    }
+
     /* Find empty slot and assign batch */
     spin_lock_irqsave(&batch_lock, flags);
 
@@ -82,6 +82,7 @@
 #include "buildenv.h"
 
 #if defined(AJA_NTV42)
+#include <linux/poll.h>
 #include "../ntv42device.h"
 #include "../ntv42ioctl.h"
 
@@ -375,6 +376,9 @@ static struct file_operations ntv2_fops =
 	.ioctl   = ntv2_ioctl,
 #endif
 	.mmap    = ntv2_mmap,
+#if defined(AJA_NTV42)
+	.poll    = ntv2_poll,
+#endif
 	.open    = ntv2_open,
 	.release = ntv2_release
 };
@@ -1775,12 +1779,22 @@ messageError:
 	case IOCTL_NTV42_EVENT_STATUS:
 		return ntv42_ioctl_event_status(pNTV2Params->ntv42_device, pFileData, arg);
 
+	case IOCTL_NTV42_EVENT_ACK:
+		return ntv42_ioctl_event_ack(pNTV2Params->ntv42_device,
+									 (pFileData != NULL) ? &pFileData->ntv42EventAck : NULL, arg);
+
 	case IOCTL_NTV42_DMA_TRANSFER:
 		return ntv42_ioctl_dma_transfer(pNTV2Params->ntv42_device, pFileData, arg);
 
 	case IOCTL_NTV42_DMA_INFO:
 		return ntv42_ioctl_dma_info(pNTV2Params->ntv42_device, pFileData, arg);
 
+	case IOCTL_NTV42_DMA_VECTOR:
+		return ntv42_ioctl_dma_vector(pNTV2Params->ntv42_device, pFileData, arg);
+
+	case IOCTL_NTV42_DMA_STATUS:
+		return ntv42_ioctl_dma_status(pNTV2Params->ntv42_device, pFileData, arg);
+
 	case IOCTL_NTV42_REGBATCH_SUBMIT:
 		return ntv42_ioctl_regbatch_submit(pNTV2Params->ntv42_device, pFileData, arg);
 
@@ -1806,6 +1820,8 @@ messageError:
 // vm_pgoff = 2
 // PCI Flash Buffer
 // vm_pgoff = 4
+// ntv42 event page, BARs and device memory
+// vm_pgoff = NTV42_EVENT_PAGE_PGOFF, NTV42_BAR_PGOFF(n), NTV42_MEMORY_PGOFF
 
 int ntv2_mmap(struct file *file,struct vm_area_struct* vma)
 {
@@ -1857,12 +1873,36 @@ int ntv2_mmap(struct file *file,struct vm_area_struct* vma)
 		break;
 
 	default:
+#if defined(AJA_NTV42)
+		// ntv42 event page, BARs and device memory
+		return ntv42_mmap(pNTV2Params->ntv42_device, vma);
+#else
 		return -EAGAIN;
+#endif
 		break;
 	}
 	return 0;
 }
 
+#if defined(AJA_NTV42)
+// poll() reports ntv42 events on enabled slots that this file hasn't acknowledged
+unsigned int ntv2_poll(struct file *file, struct poll_table_struct *wait)
+{
+#if (LINUX_VERSION_CODE >= KERNEL_VERSION(3,19,0))
+	UWord deviceNumber = MINOR(file->f_path.dentry->d_inode->i_rdev);
+#else
+	UWord deviceNumber = MINOR(file->f_dentry->d_inode->i_rdev);
+#endif
+	NTV2PrivateParams* pNTV2Params;
+	PFILE_DATA pFileData = (PFILE_DATA)file->private_data;
+
+	if ( !(pNTV2Params = getNTV2Params(deviceNumber)) || (pFileData == NULL) )
+		return POLLERR;
+
+	return ntv42_event_poll(pNTV2Params->ntv42_device, file, wait, READ_ONCE(pFileData->ntv42EventAck));
+}
+#endif
+
 
 // Initialize lookup table that translates from an INTERRUPT_ENUM to
 // a single-bit mask in either the Audio/Video Interrupt Control register
@@ -1926,6 +1966,9 @@ int ntv2_open(struct inode *minode, struct file *mfile)
 	{
 		if (dmaPageRootInit(deviceNumber, &pFileData->dmaRoot) == 0)
 		{
+#if defined(AJA_NTV42)
+			pFileData->ntv42EventAck = ntv42device_event_sequence(pNTV2Params->ntv42_device);
+#endif
 			mfile->private_data = pFileData;
 		}
 		else
@@ -1958,6 +2001,10 @@ int ntv2_release(struct inode *minode, struct file *mfile) {
 	pFileData = (PFILE_DATA)mfile->private_data;
 	if (pFileData != NULL)
 	{
+#if defined(AJA_NTV42)
+		// finish queued ntv42 transfers that may use this file's context
+		ntv42_dma_flush(pNTV2Params->ntv42_device);
+#endif
 		dmaPageRootRelease(deviceNumber, &pFileData->dmaRoot);
 		kfree(pFileData);
 		mfile->private_data = NULL;
@@ -80,6 +80,10 @@ long        ntv2_ioctl(struct file *file, unsigned int cmd,  unsigned long arg);
 int         ntv2_ioctl(struct inode *inode, struct file *file, unsigned int cmd, unsigned long arg);
 #endif
 int         ntv2_mmap(struct file *file,struct vm_area_struct* vma);
+#if defined(AJA_NTV42)
+struct poll_table_struct;
+unsigned int ntv2_poll(struct file *file, struct poll_table_struct *wait);
+#endif
 int         ntv2_open(struct inode *minode, struct file *mfile);
 int         ntv2_release(struct inode *minode, struct file *mfile);
 
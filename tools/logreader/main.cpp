@@ -15,6 +15,8 @@
 #include "ajabase/common/timebase.h"
 #include <iostream>
 #include <signal.h>
+#include <stdint.h>
+#include <stdio.h>
 #include <string>
 
 using namespace std;
@@ -53,19 +55,16 @@ static const string kEscPercent		("%%");	//	%%	Percent sign
 
 static int		gIsVerbose(0);		//	Verbose output?
 static int32_t	gRefCount(0);
+static AJADebugLogFile	gLogFile;	//	Optional indexed log file
+
+
+static volatile sig_atomic_t	gQuit(0);	//	Set by SignalHandler, main loop exits when set
 
 
 static void SignalHandler (int inSignal)
 {
 	(void)inSignal;
-	AJADebug::GetClientReferenceCount(&gRefCount);
-	if (gIsVerbose)
-		cerr << endl << "## NOTE: Closing, reference count is " << DEC(gRefCount) << endl;
-
-	if (gRefCount > 0)
-		AJADebug::SetClientReferenceCount(--gRefCount);
-	AJADebug::Close();
-	exit(1);
+	gQuit = 1;	//	Only async-signal-safe work here -- main does the cleanup
 }
 
 
@@ -448,9 +447,59 @@ class DebugInfoSettings
 };
 
 
+//	Appends the given message to the given string, using the default (tab-delimited) or custom formatting...
+static void AppendMessage (string & outStr, const AJADebugMessage & inMsg, const DebugInfoSettings & inDbgInfo, const string & inFormatStr)
+{
+	const string & severityStr (inDbgInfo.SeverityToString(AJADebugSeverity(inMsg.severity)));
+	const string & debugUnitStr (inDbgInfo.DebugUnitToString(AJADebugUnit(inMsg.groupIndex)));
+	if (inFormatStr.empty())
+	{
+		char nums[128];
+		::snprintf(nums, sizeof(nums), "%llu\t%llu\t%llu\t%lld\t", static_cast<unsigned long long>(inMsg.sequenceNumber),
+					static_cast<unsigned long long>(inMsg.pid), static_cast<unsigned long long>(inMsg.tid),
+					static_cast<long long>(inMsg.time));
+		outStr += nums;
+		outStr += debugUnitStr;		outStr += '\t';
+		outStr += severityStr;		outStr += '\t';
+		outStr += inMsg.fileName;	outStr += '\t';
+		::snprintf(nums, sizeof(nums), "%d\t", int(inMsg.lineNumber));
+		outStr += nums;
+		outStr += inMsg.messageText;
+		outStr += '\n';
+	}
+	else
+	{	//	Custom formatting:
+		string outputString (inFormatStr);
+		aja::replace(outputString, kEscIndexNumber, NumToString(inMsg.sequenceNumber));
+		aja::replace(outputString, kEscProcessID, NumToString(inMsg.pid));
+		aja::replace(outputString, kEscThreadID, NumToString(inMsg.tid));
+		aja::replace(outputString, kEscTimestamp, NumToString(inMsg.time));
+		aja::replace(outputString, kEscDebugUnit, debugUnitStr);
+		aja::replace(outputString, kEscSeverity, severityStr);
+		aja::replace(outputString, kEscLineNumber, NumToString(inMsg.lineNumber));
+		aja::replace(outputString, kEscMessage, string(inMsg.messageText));
+		aja::replace(outputString, kEscPercent, "%");
+		FormatPaths(outputString, string(inMsg.fileName));
+		outStr += outputString;	//	User responsible for linebreaks!
+	}
+}
+
+//	Formats & writes a batch of messages, splitting them between stdout and stderr by severity...
+static void WriteMessages (const vector<AJADebugMessage> & inMsgs, const DebugInfoSettings & inDbgInfo,
+							const string & inFormatStr, const AJADebugSeverity inSevThreshold)
+{
+	string outStr, errStr;
+	for (size_t ndx(0);  ndx < inMsgs.size();  ndx++)
+		AppendMessage(inMsgs[ndx].severity < inSevThreshold ? errStr : outStr, inMsgs[ndx], inDbgInfo, inFormatStr);
+	if (!errStr.empty())
+		{cerr.write(errStr.data(), streamsize(errStr.size()));  cerr.flush();}
+	if (!outStr.empty())
+		{cout.write(outStr.data(), streamsize(outStr.size()));  cout.flush();}
+}
+
+
 int main(int argc, const char *argv[])
 {
-	int				samplesPerSec	(100);		//	Message log rate, messages per second (defaults to once per second)
 	int				pidFilter		(0);		//	Filter: process ID (defaults to 0 == don't filter by pid)
 	int				tidFilter		(0);		//	Filter: thread ID (defaults to 0 == don't filter by tid)
 	int				showVersion		(0);		//	Show version?
@@ -460,6 +509,10 @@ int main(int argc, const char *argv[])
 	char *			pSeverity		(AJA_NULL);	//	Message severities (defaults to all)
 	char *			pSevThreshold	(AJA_NULL);	//	Severity threshold above which output goes to stderr
 	char *			pFormatStr		(AJA_NULL);	//	Custom output formatting string
+	char *			pLogPath		(AJA_NULL);	//	Also record messages into this indexed log file
+	char *			pSearchPath		(AJA_NULL);	//	Search this indexed log file instead of reading live messages
+	long long		startTime		(0);		//	Search: earliest message time (microseconds)
+	long long		endTime			(0);		//	Search: latest message time (microseconds, 0 == no limit)
 	poptContext		optionsContext;				//	Context for parsing command line arguments
 	StringMap		sEscapes;
 	const string	DLIM("\t");
@@ -488,7 +541,10 @@ int main(int argc, const char *argv[])
 		{"tid",			0,		POPT_ARG_INT,		&tidFilter,			0,		"thread ID filter",				"thread ID"},
 		{"enable",		0,		POPT_ARG_NONE,		&enableDebugUnits,	0,		"enable debug units",			""},
 		{"format",		'f',	POPT_ARG_STRING,	&pFormatStr,		0,		"custom formatting",			"%I|%P|%T|%t|%D|%S|%F|%L|%M|%%"},
-//		{"rate",		'r',	POPT_ARG_INT,		&samplesPerSec,		0,		"polling rate",					"samples per second"					},
+		{"log",			'l',	POPT_ARG_STRING,	&pLogPath,			0,		"also record to indexed log file",	"path"},
+		{"search",		0,		POPT_ARG_STRING,	&pSearchPath,		0,		"search indexed log file",		"path"},
+		{"start",		0,		POPT_ARG_LONGLONG,	&startTime,			0,		"search start time",			"microseconds"},
+		{"end",			0,		POPT_ARG_LONGLONG,	&endTime,			0,		"search end time",				"microseconds"},
 		{"verbose",		'v',	POPT_ARG_NONE,		&gIsVerbose,		0,		"verbose output",				""},
 		{"version",		0,		POPT_ARG_NONE,		&showVersion,		0,		"show version & exit",			""},
 		{"stats",		0,		POPT_ARG_NONE,		&listStats,			0,		"list active stats",			""},
@@ -528,6 +584,29 @@ int main(int argc, const char *argv[])
 	if (!err.str().empty())
 		cerr << err.str();
 
+	if (pSearchPath)
+	{	//	Search an indexed log file...
+		AJADebugLogFile logFile;
+		vector<AJADebugMessage> msgs, matches;
+		AJAStatus st(logFile.Open(pSearchPath));
+		if (AJA_FAILURE(st))
+			{cerr << "## ERROR: Unable to open log file '" << pSearchPath << "': " << AJAStatusToString(st) << endl;  return 1;}
+		st = logFile.Find(int64_t(startTime), endTime ? int64_t(endTime) : INT64_MAX, msgs);
+		if (AJA_FAILURE(st))
+			{cerr << "## ERROR: Log file search failed: " << AJAStatusToString(st) << endl;  return 3;}
+		for (size_t ndx(0);  ndx < msgs.size();  ndx++)
+		{	const AJADebugMessage & msg (msgs[ndx]);
+			if ((!filterPID || msg.pid == filterPID)  &&  (!filterTID || msg.tid == filterTID)
+				&&  dbgInfo.HasSeverity(AJADebugSeverity(msg.severity))  &&  dbgInfo.HasDebugUnit(AJADebugUnit(msg.groupIndex)))
+					matches.push_back(msg);
+		}
+		if (gIsVerbose)
+			cerr << "## NOTE: " << DEC(matches.size()) << " of " << DEC(logFile.GetMessageCount()) << " message(s) matched, "
+				<< DEC(msgs.size()) << " within time range, " << DEC(logFile.GetIndex().size()) << " index block(s)" << endl;
+		WriteMessages(matches, dbgInfo, formatStr, sevThreshold);
+		return 0;
+	}
+
 	if (!AJADebug::IsOpen())
 		{cerr << "## ERROR: AJADebug facility not open" << endl;  return 1;}
 	if (showVersion)
@@ -576,8 +655,8 @@ int main(int argc, const char *argv[])
 			cerr << "## NOTE: Filtering: Showing messages only from process " << DEC(filterPID) << endl;
 		if (filterTID)
 			cerr << "## NOTE: Filtering: Showing messages only from thread " << DEC(filterTID) << endl;
-		if (samplesPerSec)
-			cerr << "## NOTE: Will poll for messages " << DEC(samplesPerSec) << " times per second" << endl;
+		if (pLogPath)
+			cerr << "## NOTE: Recording messages to '" << pLogPath << "'" << endl;
 		if (sevThreshold == AJA_DebugSeverity_Size)
 			cerr << "## NOTE: All messages will be written to stdout" << endl;
 		else
@@ -607,77 +686,44 @@ int main(int argc, const char *argv[])
 		::signal (SIGQUIT, SignalHandler);
 	#endif
 
-	uint64_t lastIndex(0), readIndex(0);
-	AJADebug::GetSequenceNumber(readIndex);
+	//	Filter in the reader, so rejected messages are never copied...
+	AJADebugReader reader;
+	reader.SetAllUnits(false).SetAllSeverities(false).SetProcessID(filterPID).SetThreadID(filterTID);
+	for (AJADebugUnit du(AJA_DebugUnit_Unknown);  du < AJA_DebugUnit_Size;  du = AJADebugUnit(du+1))
+		reader.SetUnit(int32_t(du), dbgInfo.HasDebugUnit(du));
+	for (AJADebugSeverity sv(AJA_DebugSeverity_Emergency);  sv < AJA_DebugSeverity_Size;  sv = AJADebugSeverity(sv+1))
+		reader.SetSeverity(int32_t(sv), dbgInfo.HasSeverity(sv));
+
+	if (pLogPath  &&  AJA_FAILURE(gLogFile.Create(pLogPath)))
+		{cerr << "## ERROR: Unable to create log file '" << pLogPath << "'" << endl;  return 1;}
+
+	uint64_t lastDropped(0);
+	vector<AJADebugMessage> msgs;
 	do
 	{
-		uint64_t newIndex(0), messageIndex(0);
-		while (AJA_SUCCESS(AJADebug::GetSequenceNumber(newIndex))
-			 &&  newIndex > lastIndex
-			 &&  AJA_SUCCESS(AJADebug::GetMessageSequenceNumber(readIndex, messageIndex))
-			 &&  messageIndex > lastIndex)
+		if (!reader.Wait(250))
+			continue;
+		while (reader.Read(msgs, 1024))
 		{
-			uint32_t destination(0);
-			lastIndex = messageIndex;
-			if (AJA_SUCCESS(AJADebug::GetMessageDestination(readIndex, destination))  &&  (destination != AJA_DEBUG_DESTINATION_NONE))
-			{
-				int32_t groupIndex(0), severity(0);
-				uint64_t time(0);
-				string	msg;
-				if (AJA_SUCCESS(AJADebug::GetMessageGroup(readIndex, groupIndex))
-					&&  AJA_SUCCESS(AJADebug::GetMessageTime(readIndex, time))
-					&&  AJA_SUCCESS(AJADebug::GetMessageSeverity(readIndex, severity))
-					&&  AJA_SUCCESS(AJADebug::GetMessageText(readIndex, msg)))
-				{
-					uint64_t pid(0), tid(0);
-					AJADebug::GetProcessId(readIndex, pid);
-					AJADebug::GetThreadId(readIndex,  tid);
-					if ((!filterPID || (pid == filterPID))
-						&&  (!filterTID || (tid == filterTID))
-						&&  dbgInfo.HasSeverity(AJADebugSeverity(severity))
-						&&  dbgInfo.HasDebugUnit(AJADebugUnit(groupIndex)))
-					{
-						const string & severityStr (dbgInfo.SeverityToString(AJADebugSeverity(severity)));
-						int32_t lineNum(0);
-						AJADebug::GetMessageLineNumber(readIndex, lineNum);
-						string path;
-						AJADebug::GetMessageFileName(readIndex, path);
-						ostream & outputStream (severity < sevThreshold ? cerr : cout);
-						ostringstream timess;
-						timess << time;
-						if (formatStr.empty())
-							outputStream	<< DEC(messageIndex)
-											<< DLIM << DEC(pid)
-											<< DLIM << DEC(tid)
-											<< DLIM << timess.str()
-											<< DLIM << dbgInfo.DebugUnitToString(AJADebugUnit(groupIndex))
-											<< DLIM << severityStr
-											<< DLIM << path
-											<< DLIM << DEC(lineNum)
-											<< DLIM << msg
-											<< endl;
-						else
-						{	//	Custom formatting:
-							string outputString (formatStr);
-							aja::replace(outputString, kEscIndexNumber, NumToString(messageIndex));
-							aja::replace(outputString, kEscProcessID, NumToString(pid));
-							aja::replace(outputString, kEscThreadID, NumToString(tid));
-							aja::replace(outputString, kEscTimestamp, timess.str());
-							aja::replace(outputString, kEscDebugUnit, dbgInfo.DebugUnitToString(AJADebugUnit(groupIndex)));
-							aja::replace(outputString, kEscSeverity, severityStr);
-							aja::replace(outputString, kEscLineNumber, NumToString(lineNum));
-							aja::replace(outputString, kEscMessage, msg);
-							aja::replace(outputString, kEscPercent, "%");
-							FormatPaths(outputString, path);
-							outputStream << outputString;	//	User responsible for linebreaks!
-						}
-					}	//	if not filtered out
-				}	//	if  GetMessageGroup|GetMessageTime|GetMessageSeverity|GetMessageText OK
-			}	//	if MessageDestination != "none"
-			readIndex++;	//	On to the next message
-		} // while GetSequenceNumber OK
-		if (samplesPerSec)
-			AJATime::SleepInMicroseconds(1000000 / uint32_t(samplesPerSec));
-	} while (true);	//	Loop til ctrl-c
+			WriteMessages(msgs, dbgInfo, formatStr, sevThreshold);
+			if (gLogFile.IsOpen())
+				for (size_t ndx(0);  ndx < msgs.size();  ndx++)
+					gLogFile.Append(msgs[ndx]);
+		}
+		if (gIsVerbose  &&  reader.GetStats().fMessagesDropped != lastDropped)
+		{
+			cerr << "## WARNING: " << DEC(reader.GetStats().fMessagesDropped - lastDropped) << " message(s) dropped (overwritten before they could be read)" << endl;
+			lastDropped = reader.GetStats().fMessagesDropped;
+		}
+	} while (!gQuit);	//	Loop til ctrl-c
+
+	AJADebug::GetClientReferenceCount(&gRefCount);
+	if (gIsVerbose)
+		cerr << endl << "## NOTE: Closing, reference count is " << DEC(gRefCount) << endl;
+	if (gRefCount > 0)
+		AJADebug::SetClientReferenceCount(--gRefCount);
+	gLogFile.Close();	//	Writes its index
+	AJADebug::Close();
+	return 1;
 
 }	//	main
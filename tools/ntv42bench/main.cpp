@@ -0,0 +1,213 @@
+/* SPDX-License-Identifier: MIT */
+/**
+	@file		ntv42bench/main.cpp
+	@brief		Command line application that compares the register and memory access paths of ntv42 devices:
+				the register and DMA ioctls versus mmap() of the BAR register window and device memory.
+	@copyright	(C) 2026 AJA Video Systems, Inc.
+**/
+
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <iomanip>
+#include <string>
+#include <vector>
+#include <cerrno>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include "ntv2utils.h"
+#include "ajabase/common/common.h"
+#include "ajabase/common/options_popt.h"
+#include "ajabase/system/systemtime.h"
+#include "ntv42ioctl.h"
+
+using namespace std;
+
+
+static void ShowRate (const string & inWhat, const uint64_t inCount, const uint64_t inNanoseconds)
+{
+	const double nsEach (inCount ? double(inNanoseconds) / double(inCount) : 0.0);
+	cout << "  " << left << setw(28) << inWhat << right << setw(12) << fixed << setprecision(1) << nsEach << " ns/op"
+		<< setw(14) << setprecision(0) << (nsEach > 0.0 ? 1.0e9 / nsEach : 0.0) << " op/s" << endl;
+}
+
+static void ShowThroughput (const string & inWhat, const uint64_t inBytes, const uint64_t inNanoseconds)
+{
+	const double mbPerSec (inNanoseconds ? double(inBytes) / double(inNanoseconds) * 1.0e9 / 1048576.0 : 0.0);
+	cout << "  " << left << setw(28) << inWhat << right << setw(12) << fixed << setprecision(1) << mbPerSec << " MB/s" << endl;
+}
+
+//	Reads "inCount" registers, one ioctl per register, then the same registers through the mapped BAR.
+static bool BenchRegisters (const int inFD, const ntv42_ioctl_device_info_t & inInfo, const uint32_t inBar, const uint32_t inCount, const uint32_t inNumRegs)
+{
+	const uint64_t barSize (inInfo.bar[inBar].size);
+	const uint32_t width (inInfo.bar[inBar].width ? inInfo.bar[inBar].width : 4);
+	const uint32_t numRegs (uint32_t(min<uint64_t>(inNumRegs, barSize / width)));
+	if (!numRegs  ||  width != 4)
+		{cerr << "## ERROR:  BAR " << inBar << " has no 32-bit registers to read" << endl;  return false;}
+	cout << "Registers:  BAR " << inBar << " '" << inInfo.bar[inBar].name << "', " << numRegs << " register(s), " << inCount << " read(s)" << endl;
+
+	vector<uint32_t> ioctlValues(numRegs), mmapValues(numRegs);
+	uint32_t value (0);
+	ntv42_ioctl_regio_t regio;
+	memset(&regio, 0, sizeof(regio));
+	regio.bar = inBar;
+	regio.count = 1;
+	regio.data_ptr = uint64_t(uintptr_t(&value));
+
+	uint64_t startNs (AJATime::GetSystemNanoseconds());
+	for (uint32_t n(0);  n < inCount;  n++)
+	{
+		regio.offset = uint64_t(n % numRegs) * width;
+		if (::ioctl(inFD, IOCTL_NTV42_REG_READ, &regio) < 0)
+			{cerr << "## ERROR:  IOCTL_NTV42_REG_READ failed: " << ::strerror(errno) << endl;  return false;}
+		ioctlValues[n % numRegs] = value;
+	}
+	ShowRate("ioctl (1 reg/call)", inCount, AJATime::GetSystemNanoseconds() - startNs);
+
+	//	The bulk ioctl amortizes the syscall over all registers...
+	regio.offset = 0;
+	regio.count = numRegs;
+	regio.data_ptr = uint64_t(uintptr_t(&ioctlValues[0]));
+	const uint32_t numBulk ((inCount + numRegs - 1) / numRegs);
+	startNs = AJATime::GetSystemNanoseconds();
+	for (uint32_t n(0);  n < numBulk;  n++)
+		if (::ioctl(inFD, IOCTL_NTV42_REG_READ, &regio) < 0)
+			{cerr << "## ERROR:  IOCTL_NTV42_REG_READ failed: " << ::strerror(errno) << endl;  return false;}
+	ShowRate("ioctl (" + aja::to_string(numRegs) + " regs/call)", uint64_t(numBulk) * numRegs, AJATime::GetSystemNanoseconds() - startNs);
+
+	if (!(inInfo.bar[inBar].flags & NTV42_BAR_FLAG_MAP))
+		{cout << "  BAR " << inBar << " can't be mapped -- skipping mmap" << endl;  return true;}
+	const long pageSize (::sysconf(_SC_PAGESIZE));
+	const size_t mapBytes ((size_t(numRegs) * width + pageSize - 1) / pageSize * pageSize);
+	void * pMap (::mmap(AJA_NULL, mapBytes, PROT_READ, MAP_SHARED, inFD, off_t(NTV42_BAR_PGOFF(inBar)) * pageSize));
+	if (pMap == MAP_FAILED)
+		{cerr << "## ERROR:  mmap of BAR " << inBar << " failed: " << ::strerror(errno) << endl;  return false;}
+	const volatile uint32_t * pRegs (reinterpret_cast<const volatile uint32_t*>(pMap));
+
+	startNs = AJATime::GetSystemNanoseconds();
+	for (uint32_t n(0);  n < inCount;  n++)
+		mmapValues[n % numRegs] = pRegs[n % numRegs];
+	ShowRate("mmap", inCount, AJATime::GetSystemNanoseconds() - startNs);
+	::munmap(pMap, mapBytes);
+
+	//	Live registers can change between reads, so mismatches are reported, not treated as failures...
+	uint32_t numMismatches (0);
+	for (uint32_t reg(0);  reg < numRegs;  reg++)
+		if (ioctlValues[reg] != mmapValues[reg])
+			numMismatches++;
+	if (numMismatches)
+		cout << "  " << numMismatches << " register(s) differed between ioctl and mmap reads" << endl;
+	return true;
+}
+
+//	Transfers "inBytes" of device memory "inCount" times using the DMA ioctl, then copies it through the mapped memory.
+static bool BenchMemory (const int inFD, const uint64_t inBytes, const uint32_t inCount, const bool inDoWrite)
+{
+	ntv42_ioctl_dma_info_t dmaInfo;
+	memset(&dmaInfo, 0, sizeof(dmaInfo));
+	if (::ioctl(inFD, IOCTL_NTV42_DMA_INFO, &dmaInfo) < 0  ||  !dmaInfo.engine_count)
+		{cout << "Memory:  device has no DMA engines -- skipping" << endl;  return true;}
+	const uint64_t bytes (dmaInfo.engines[0].max_xfer ? min(inBytes, dmaInfo.engines[0].max_xfer) : inBytes);
+	cout << "Memory:  " << bytes << " byte(s), " << inCount << " transfer(s)" << (inDoWrite ? ", read & write" : ", read only") << endl;
+
+	NTV2Buffer hostBuffer;
+	if (!hostBuffer.Allocate(size_t(bytes), /*pageAligned*/true))
+		{cerr << "## ERROR:  failed to allocate " << bytes << "-byte host buffer" << endl;  return false;}
+
+	for (int write(0);  write <= (inDoWrite ? 1 : 0);  write++)
+	{
+		ntv42_ioctl_dma_transfer_t xfer;
+		memset(&xfer, 0, sizeof(xfer));
+		xfer.engine = 0;
+		xfer.direction = write ? 1 : 2;
+		xfer.host_addr = uint64_t(uintptr_t(hostBuffer.GetHostPointer()));
+		xfer.bytes = bytes;
+		xfer.timeout_ms = -1;
+		const uint64_t startNs (AJATime::GetSystemNanoseconds());
+		for (uint32_t n(0);  n < inCount;  n++)
+			if (::ioctl(inFD, IOCTL_NTV42_DMA_TRANSFER, &xfer) < 0  ||  xfer.status)
+				{cerr << "## ERROR:  IOCTL_NTV42_DMA_TRANSFER failed: " << ::strerror(xfer.status ? -xfer.status : errno) << endl;  return false;}
+		ShowThroughput(write ? "DMA ioctl (write)" : "DMA ioctl (read)", bytes * inCount, AJATime::GetSystemNanoseconds() - startNs);
+	}
+
+	const long pageSize (::sysconf(_SC_PAGESIZE));
+	const size_t mapBytes ((size_t(bytes) + pageSize - 1) / pageSize * pageSize);
+	void * pMap (::mmap(AJA_NULL, mapBytes, inDoWrite ? PROT_READ | PROT_WRITE : PROT_READ, MAP_SHARED, inFD, off_t(NTV42_MEMORY_PGOFF) * pageSize));
+	if (pMap == MAP_FAILED)
+		{cout << "  device memory can't be mapped (" << ::strerror(errno) << ") -- skipping mmap" << endl;  return true;}
+
+	for (int write(0);  write <= (inDoWrite ? 1 : 0);  write++)
+	{
+		const uint64_t startNs (AJATime::GetSystemNanoseconds());
+		for (uint32_t n(0);  n < inCount;  n++)
+			if (write)
+				::memcpy(pMap, hostBuffer.GetHostPointer(), size_t(bytes));
+			else
+				::memcpy(hostBuffer.GetHostPointer(), pMap, size_t(bytes));
+		ShowThroughput(write ? "mmap memcpy (write)" : "mmap memcpy (read)", bytes * inCount, AJATime::GetSystemNanoseconds() - startNs);
+	}
+	::munmap(pMap, mapBytes);
+	return true;
+}
+
+
+int main (int argc, const char ** argv)
+{
+	char *			pDevicePath		(AJA_NULL);		//	Device node argument
+	uint32_t		barNum			(0);			//	BAR argument
+	uint32_t		regCount		(1000000);		//	Register read count argument
+	uint32_t		numRegs			(256);			//	Registers to cycle through
+	uint32_t		memSize			(1024 * 1024);	//	Memory transfer size argument
+	uint32_t		memCount		(100);			//	Memory transfer count argument
+	int				doWrite			(0);			//	Also write device memory?
+	int				showVersion		(0);			//	Show version info?
+	poptContext		optionsContext;					//	Context for parsing command line arguments
+
+	//	Command line option descriptions:
+	const struct poptOption userOptionsTable [] =
+	{
+		{"version",		0,		POPT_ARG_NONE,		&showVersion,	0,	"show version & exit",			AJA_NULL},
+		{"device",		'd',	POPT_ARG_STRING,	&pDevicePath,	0,	"device node to use",			"/dev/ntv42dummy0"},
+		{"bar",			'b',	POPT_ARG_INT,		&barNum,		0,	"BAR to read",					"0-7"},
+		{"count",		'n',	POPT_ARG_INT,		&regCount,		0,	"register reads",				AJA_NULL},
+		{"regs",		'r',	POPT_ARG_INT,		&numRegs,		0,	"registers to cycle through",	AJA_NULL},
+		{"size",		's',	POPT_ARG_INT,		&memSize,		0,	"memory transfer size",			"bytes"},
+		{"xfers",		'x',	POPT_ARG_INT,		&memCount,		0,	"memory transfers",				AJA_NULL},
+		{"write",		'w',	POPT_ARG_NONE,		&doWrite,		0,	"also write device memory?",	AJA_NULL},
+		POPT_AUTOHELP
+		POPT_TABLEEND
+	};
+
+	//	Read command line arguments...
+	optionsContext = ::poptGetContext (AJA_NULL, argc, argv, userOptionsTable, 0);
+	::poptGetNextOpt (optionsContext);
+	optionsContext = ::poptFreeContext (optionsContext);
+	if (showVersion)
+		{cout << argv[0] << ", NTV2 SDK " << ::NTV2Version() << endl;  return 0;}
+
+	const string devicePath (pDevicePath ? pDevicePath : "/dev/ntv42dummy0");
+	const int fd (::open(devicePath.c_str(), O_RDWR));
+	if (fd < 0)
+		{cerr << "## ERROR:  can't open '" << devicePath << "': " << ::strerror(errno) << endl;  return 1;}
+
+	ntv42_ioctl_version_t version;
+	ntv42_ioctl_device_info_t info;
+	memset(&version, 0, sizeof(version));
+	memset(&info, 0, sizeof(info));
+	if (::ioctl(fd, IOCTL_NTV42_VERSION, &version) < 0  ||  ::ioctl(fd, IOCTL_NTV42_DEVICE_INFO, &info) < 0)
+		{cerr << "## ERROR:  '" << devicePath << "' isn't an ntv42 device: " << ::strerror(errno) << endl;  ::close(fd);  return 1;}
+	cout << devicePath << ": '" << info.name << "' (" << info.desc << "), ntv42 ioctl version " << version.version
+		<< ", capabilities " << xHEX0N(version.capabilities,8) << endl;
+	if (!(version.capabilities & NTV42_CAP_MMAP))
+		cout << "## WARNING:  driver doesn't support mmap -- only ioctls will be measured" << endl;
+	if (barNum >= info.bar_count  ||  barNum >= 8)
+		{cerr << "## ERROR:  BAR " << barNum << " doesn't exist" << endl;  ::close(fd);  return 2;}
+
+	bool ok (BenchRegisters(fd, info, barNum, regCount ? regCount : 1, numRegs));
+	if (ok  &&  (version.capabilities & NTV42_CAP_DMA)  &&  memSize)
+		ok = BenchMemory(fd, memSize, memCount ? memCount : 1, doWrite ? true : false);
+	::close(fd);
+	return ok ? 0 : 2;
+}	//	main
@@ -38,7 +38,7 @@ static void SignalHandler (int inSignal)
 int main(int argc, const char ** argv)
 {
 	char	*pDeviceSpec(AJA_NULL), *pInputFileName(AJA_NULL);
-	int		doStdout(0), doSDRAM(0), waitSeconds(0), forceLoad(0), isVerbose(0), showVersion(0);
+	int		doStdout(0), doSDRAM(0), waitSeconds(0), forceLoad(0), isVerbose(0), showVersion(0), doSnapshot(0);
 	CNTV2Card device;
 	poptContext	optionsContext;	//	Context for parsing command line arguments
 
@@ -51,6 +51,7 @@ int main(int argc, const char ** argv)
 		{"forceload",	'f',	POPT_ARG_NONE,		&forceLoad,			0,	"load onto different device",		AJA_NULL},
 		{"stdout",		's',	POPT_ARG_NONE,		&doStdout,			0,	"dump to stdout instead of file?",	AJA_NULL},
 		{"sdram",		'r',	POPT_ARG_NONE,		&doSDRAM,			0,	"dump device SDRAM to .raw file?",	AJA_NULL},
+		{"snapshot",	'n',	POPT_ARG_NONE,		&doSnapshot,		0,	"bulk-read device, then render?",	AJA_NULL},
 		{"verbose",		'v',	POPT_ARG_NONE,		&isVerbose,			0,	"verbose mode?",					AJA_NULL},
 		{"wait",		'w',	POPT_ARG_INT,		&waitSeconds,		0,	"time to wait before capture",		"seconds"},
 		POPT_AUTOHELP
@@ -100,6 +101,7 @@ int main(int argc, const char ** argv)
 	}	//	if waitTime > 0
 
 	CNTV2SupportLogger logger(device);
+	logger.setUseSnapshot(doSnapshot ? true : false);
 
 	if (!inputFile.empty())
 	{
@@ -121,6 +123,12 @@ int main(int argc, const char ** argv)
 		}
 		if (isVerbose)
 			cout << "## NOTE: Support log for device '" << deviceName << "' written to '" << supportLogFileName << "'" << endl;
+		if (isVerbose  &&  doSnapshot)
+		{	const CNTV2SupportLogger::SnapshotStats & stats (logger.getLastSnapshotStats());
+			cout << "## NOTE: Device held for " << stats.fHoldMicroseconds << "us (" << stats.fNumRegisters << " regs, "
+				<< stats.fNumQueries << " queries), rendered in " << stats.fRenderMicroseconds << "us using "
+				<< stats.fNumWorkers << " worker(s), " << stats.fNumLateReads << " late read(s)" << endl;
+		}
 		if (doSDRAM)
 		{	ostringstream oss;
 			if (!CNTV2SupportLogger::DumpDeviceSDRAM (device, ramDumpFileName, oss))